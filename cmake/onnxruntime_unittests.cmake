@@ -587,6 +587,8 @@ set_target_properties(onnx_test_runner_common PROPERTIES FOLDER "ONNXRuntimeTest
 
 set(all_tests ${onnxruntime_test_common_src} ${onnxruntime_test_ir_src} ${onnxruntime_test_optimizer_src}
         ${onnxruntime_test_framework_src} ${onnxruntime_test_providers_src})
+# the perf test latency histogram has no dependencies, so its source is compiled into the unit tests directly
+list(APPEND all_tests ${TEST_SRC_DIR}/perftest/test/latency_histogram_test.cc ${TEST_SRC_DIR}/perftest/latency_histogram.cc)
 if(NOT TARGET onnxruntime AND NOT onnxruntime_BUILD_WEBASSEMBLY)
   list(APPEND all_tests ${onnxruntime_shared_lib_test_SRC})
 endif()
@@ -0,0 +1,226 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+namespace onnxruntime {
+
+/**
+   A vector of trivially copyable elements that stores up to N elements inline and only allocates from the heap
+   when it grows beyond that. Used for short lists such as the dimensions of a tensor shape, which are created and
+   destroyed for every node that is run.
+   The subset of the std::vector interface used for such lists is provided.
+*/
+template <typename T, size_t N>
+class InlinedVector {
+  static_assert(std::is_trivially_copyable<T>::value, "InlinedVector only holds trivially copyable types.");
+  static_assert(N > 0, "InlinedVector requires inline storage.");
+
+ public:
+  using value_type = T;
+  using size_type = size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = T&;
+  using const_reference = const T&;
+  using pointer = T*;
+  using const_pointer = const T*;
+  using iterator = T*;
+  using const_iterator = const T*;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  InlinedVector() noexcept = default;
+
+  explicit InlinedVector(size_t count, const T& value = T()) { assign(count, value); }
+
+  InlinedVector(std::initializer_list<T> values) { assign(values.begin(), values.end()); }
+
+  template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+  InlinedVector(InputIt first, InputIt last) { assign(first, last); }
+
+  InlinedVector(const InlinedVector& other) { assign(other.begin(), other.end()); }
+
+  InlinedVector(InlinedVector&& other) noexcept { MoveFrom(other); }
+
+  InlinedVector& operator=(const InlinedVector& other) {
+    if (this != &other) {
+      assign(other.begin(), other.end());
+    }
+    return *this;
+  }
+
+  InlinedVector& operator=(InlinedVector&& other) noexcept {
+    if (this != &other) {
+      MoveFrom(other);
+    }
+    return *this;
+  }
+
+  InlinedVector& operator=(std::initializer_list<T> values) {
+    assign(values.begin(), values.end());
+    return *this;
+  }
+
+  size_t size() const noexcept { return size_; }
+  size_t capacity() const noexcept { return capacity_; }
+  bool empty() const noexcept { return size_ == 0; }
+
+  T* data() noexcept { return data_; }
+  const T* data() const noexcept { return data_; }
+
+  T& operator[](size_t idx) { return data_[idx]; }
+  const T& operator[](size_t idx) const { return data_[idx]; }
+
+  T& front() { return data_[0]; }
+  const T& front() const { return data_[0]; }
+  T& back() { return data_[size_ - 1]; }
+  const T& back() const { return data_[size_ - 1]; }
+
+  iterator begin() noexcept { return data_; }
+  const_iterator begin() const noexcept { return data_; }
+  const_iterator cbegin() const noexcept { return data_; }
+  iterator end() noexcept { return data_ + size_; }
+  const_iterator end() const noexcept { return data_ + size_; }
+  const_iterator cend() const noexcept { return data_ + size_; }
+  reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+  const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+  reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+  const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+
+  void reserve(size_t new_capacity) {
+    if (new_capacity > capacity_) {
+      std::unique_ptr<T[]> heap_data(new T[new_capacity]);
+      std::copy_n(data_, size_, heap_data.get());
+      heap_data_ = std::move(heap_data);
+      data_ = heap_data_.get();
+      capacity_ = new_capacity;
+    }
+  }
+
+  void resize(size_t new_size) { resize(new_size, T()); }
+
+  void resize(size_t new_size, const T& value) {
+    if (new_size > size_) {
+      // value may refer to an element of this vector, which reserve frees.
+      const T copy = value;
+      reserve(std::max(new_size, 2 * capacity_));
+      std::fill(data_ + size_, data_ + new_size, copy);
+    }
+    size_ = new_size;
+  }
+
+  void clear() noexcept { size_ = 0; }
+
+  void assign(size_t count, const T& value) {
+    const T copy = value;
+    size_ = 0;
+    reserve(count);
+    std::fill_n(data_, count, copy);
+    size_ = count;
+  }
+
+  template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+  void assign(InputIt first, InputIt last) {
+    size_ = 0;
+    reserve(static_cast<size_t>(std::distance(first, last)));
+    size_ = static_cast<size_t>(std::copy(first, last, data_) - data_);
+  }
+
+  void push_back(const T& value) {
+    if (size_ == capacity_) {
+      // value may refer to an element of this vector.
+      const T copy = value;
+      reserve(2 * capacity_);
+      data_[size_++] = copy;
+    } else {
+      data_[size_++] = value;
+    }
+  }
+
+  template <typename... Args>
+  T& emplace_back(Args&&... args) {
+    push_back(T(std::forward<Args>(args)...));
+    return back();
+  }
+
+  void pop_back() { --size_; }
+
+  iterator insert(const_iterator position, const T& value) { return insert(position, 1, value); }
+
+  iterator insert(const_iterator position, size_t count, const T& value) {
+    const size_t offset = static_cast<size_t>(position - data_);
+    const T copy = value;
+    if (size_ + count > capacity_) {
+      reserve(std::max(size_ + count, 2 * capacity_));
+    }
+    std::copy_backward(data_ + offset, data_ + size_, data_ + size_ + count);
+    std::fill_n(data_ + offset, count, copy);
+    size_ += count;
+    return data_ + offset;
+  }
+
+  template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+  iterator insert(const_iterator position, InputIt first, InputIt last) {
+    // The range is copied first as it may refer to elements of this vector.
+    const InlinedVector values(first, last);
+    const size_t offset = static_cast<size_t>(position - data_);
+    if (size_ + values.size() > capacity_) {
+      reserve(std::max(size_ + values.size(), 2 * capacity_));
+    }
+    std::copy_backward(data_ + offset, data_ + size_, data_ + size_ + values.size());
+    std::copy(values.begin(), values.end(), data_ + offset);
+    size_ += values.size();
+    return data_ + offset;
+  }
+
+  iterator erase(const_iterator position) { return erase(position, position + 1); }
+
+  iterator erase(const_iterator first, const_iterator last) {
+    const size_t offset = static_cast<size_t>(first - data_);
+    const size_t count = static_cast<size_t>(last - first);
+    std::copy(data_ + offset + count, data_ + size_, data_ + offset);
+    size_ -= count;
+    return data_ + offset;
+  }
+
+  bool operator==(const InlinedVector& other) const {
+    return size_ == other.size_ && std::equal(begin(), end(), other.begin());
+  }
+
+  bool operator!=(const InlinedVector& other) const { return !(*this == other); }
+
+ private:
+  void MoveFrom(InlinedVector& other) noexcept {
+    if (other.heap_data_) {
+      heap_data_ = std::move(other.heap_data_);
+      data_ = heap_data_.get();
+      capacity_ = other.capacity_;
+    } else {
+      heap_data_.reset();
+      data_ = inline_data_;
+      capacity_ = N;
+      std::copy_n(other.inline_data_, other.size_, inline_data_);
+    }
+    size_ = other.size_;
+
+    other.data_ = other.inline_data_;
+    other.size_ = 0;
+    other.capacity_ = N;
+  }
+
+  T* data_{inline_data_};
+  size_t size_{0};
+  size_t capacity_{N};
+  T inline_data_[N];
+  std::unique_ptr<T[]> heap_data_;
+};
+
+}  // namespace onnxruntime
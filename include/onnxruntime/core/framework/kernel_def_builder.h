@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -90,6 +91,11 @@ class KernelDef {
 
   bool HasExternalOutputs() const { return external_outputs_; }
 
+  bool AcceptsSparseInitializer(size_t input_index) const {
+    return std::find(sparse_initializer_inputs_.cbegin(), sparse_initializer_inputs_.cend(),
+                     static_cast<int>(input_index)) != sparse_initializer_inputs_.cend();
+  }
+
   OrtMemType OutputMemoryType(size_t output_index) const {
     auto it = output_memory_type_args_.find(output_index);
     if (it == output_memory_type_args_.end())
@@ -163,6 +169,9 @@ class KernelDef {
   // Whether the outputs are from external.
   bool external_outputs_ = false;
 
+  // Inputs that take a constant initializer stored in sparse form through OpKernel::PrePackSparse.
+  std::vector<int> sparse_initializer_inputs_;
+
   // The memory types of inputs/outputs of this kernel
   MemTypeMap input_memory_type_args_;
   MemTypeMap output_memory_type_args_;
@@ -287,6 +296,17 @@ class KernelDefBuilder {
     return *this;
   }
 
+  /**
+     Specify that this kernel takes constant initializers that the model
+     stores in sparse form for these inputs through OpKernel::PrePackSparse,
+     so the session does not need to hold them densely. The kernel must not
+     read these inputs with OpKernelInfo::TryGetConstantInput.
+  */
+  KernelDefBuilder& SparseInitializerInputs(const std::vector<int>& input_indexes) {
+    kernel_def_->sparse_initializer_inputs_ = input_indexes;
+    return *this;
+  }
+
   /**
      Specify that this kernel's output buffers are passed from external, 
      i.e. not created or managed by ORT's memory allocator.
@@ -68,6 +68,14 @@ class OpKernel {
     return Status::OK();
   }
 
+  // Override this function to PrePack a constant initializer that the model stores in sparse form, for the inputs
+  // listed with KernelDefBuilder::SparseInitializerInputs. The tensor holds coordinate (COO) indices of shape
+  // [NumValues(), rank]. If is_packed is left false the initializer is made dense and passed to PrePack instead.
+  virtual Status PrePackSparse(const SparseTensor& /*tensor*/, int /*input_idx*/, bool& is_packed) {
+    is_packed = false;
+    return Status::OK();
+  }
+
   const OrtMemoryInfo& Allocator(int id, OrtMemType mem_type) const;
   const OpKernelInfo& Info() const { return *op_kernel_info_; }
 
@@ -20,12 +20,20 @@ struct OrtRunOptions {
   // Set to 'true' to ensure the termination of all the outstanding Run() calls
   // that use this OrtRunOptions instance. Some of the outstanding Run() calls may
   // be forced to terminate with an error status.
-  bool terminate = false;
+  // This is atomic as it is set while the Run() calls using this instance read it.
+  std::atomic_bool terminate{false};
 
   // Set to 'true' to run only the nodes from feeds to required fetches.
   // So it is possible that only some of the nodes are executed.
   bool only_execute_path_to_fetches = false;
 
+  // Priority of the Run relative to concurrent Run calls that share its thread pools.
+  OrtRunPriority priority = ORT_RUN_PRIORITY_NORMAL;
+
+  // If positive, the Run is cancelled once this many milliseconds have passed since it started,
+  // and fails as if 'terminate' had been set.
+  int64_t deadline_ms = 0;
+
 #ifdef ENABLE_TRAINING
   // Set to 'true' to run in training mode.
   bool training_mode = true;
@@ -33,6 +41,22 @@ struct OrtRunOptions {
 
   OrtRunOptions() = default;
   ~OrtRunOptions() = default;
+
+  OrtRunOptions(const OrtRunOptions& other) { *this = other; }
+
+  OrtRunOptions& operator=(const OrtRunOptions& other) {
+    run_log_severity_level = other.run_log_severity_level;
+    run_log_verbosity_level = other.run_log_verbosity_level;
+    run_tag = other.run_tag;
+    terminate = other.terminate.load();
+    only_execute_path_to_fetches = other.only_execute_path_to_fetches;
+    priority = other.priority;
+    deadline_ms = other.deadline_ms;
+#ifdef ENABLE_TRAINING
+    training_mode = other.training_mode;
+#endif
+    return *this;
+  }
 };
 
 namespace onnxruntime {
@@ -8,19 +8,29 @@
 #include <string>
 #include <cstring>
 #include "onnxruntime_config.h"
+#include "core/common/inlined_vector.h"
+#include "gsl/gsl"
 
 namespace onnxruntime {
+
+// Number of dimensions a TensorShape stores without allocating. Higher ranks spill to the heap.
+constexpr size_t kTensorShapeSmallBufferElementsSize = 6;
+
+// Dimensions of a shape being built or modified, e.g. by the shape computation of a kernel, stored inline up to
+// the same rank as TensorShape.
+using TensorShapeVector = InlinedVector<int64_t, kTensorShapeSmallBufferElementsSize>;
+
 #ifdef __GNUC__
 #pragma GCC diagnostic push
 #ifdef HAS_NULL_DEREFERENCE
 #pragma GCC diagnostic ignored "-Wnull-dereference"
 #endif
 #endif
-class TensorShape : private std::vector<int64_t> {
-  // TODO - Use a custom STL allocator to avoid heap allocations in the common case.
+class TensorShape {
   // We use negative numbers for unknown symbolic dimension. Each negative
   // number represents a unique symbolic dimension.
-  // Private inheritance is used to prevent ambiguity of element versus dimension size
+  // The dimensions are stored inline for the common ranks so that creating a shape, which happens for every output
+  // of every node that is run, does not allocate.
  public:
   TensorShape() = default;
 
@@ -30,31 +40,35 @@ class TensorShape : private std::vector<int64_t> {
   TensorShape(TensorShape&& /*other*/) = default;
   TensorShape& operator=(TensorShape&& /*other*/) = default;
 
-  TensorShape(const std::vector<int64_t>& dims) : std::vector<int64_t>(dims) {}
+  TensorShape(gsl::span<const int64_t> dims) : values_(dims.begin(), dims.end()) {}
 
-  TensorShape(std::vector<int64_t>&& dims) : std::vector<int64_t>(std::move(dims)) {}
+  TensorShape(const std::vector<int64_t>& dims) : values_(dims.begin(), dims.end()) {}
 
-  TensorShape(const std::initializer_list<int64_t>& dims) : std::vector<int64_t>(dims) {}
+  TensorShape(const TensorShapeVector& dims) : values_(dims) {}
 
-  TensorShape(const int64_t* dimension_sizes, size_t dimension_count);
+  TensorShape(TensorShapeVector&& dims) noexcept : values_(std::move(dims)) {}
 
-  TensorShape(const std::vector<int64_t>& dims, size_t start, size_t end);
+  TensorShape(const std::initializer_list<int64_t>& dims) : values_(dims) {}
+
+  TensorShape(const int64_t* dimension_sizes, size_t dimension_count)
+      : values_(dimension_sizes, dimension_sizes + dimension_count) {}
+
+  TensorShape(const std::vector<int64_t>& dims, size_t start, size_t end)
+      : values_(dims.begin() + start, dims.begin() + end) {}
 
   /**
      Return the dimension specified by <idx>.
   */
   const int64_t& operator[](size_t idx) const {
-    return std::vector<int64_t>::operator[](static_cast<int>(idx));
+    return values_[idx];
   }
 
   int64_t& operator[](size_t idx) {
-    return std::vector<int64_t>::operator[](static_cast<int>(idx));
+    return values_[idx];
   }
 
   bool operator==(const TensorShape& other) const noexcept {
-    auto thisVector = static_cast<const std::vector<int64_t>*>(this);
-    auto otherVector = static_cast<const std::vector<int64_t>*>(&other);
-    return *thisVector == *otherVector;
+    return values_ == other.values_;
   }
 
   bool operator!=(const TensorShape& other) const noexcept {
@@ -62,20 +76,30 @@ class TensorShape : private std::vector<int64_t> {
   }
 
   size_t NumDimensions() const noexcept {
-    return size();
+    return values_.size();
   }
 
   /**
      Copy dims into an array with given size
   */
   void CopyDims(int64_t* dims, size_t num_dims) const {
-    memcpy(dims, data(), sizeof(value_type) * std::min(num_dims, NumDimensions()));
+    memcpy(dims, values_.data(), sizeof(int64_t) * std::min(num_dims, NumDimensions()));
   }
 
   /**
-     Return underlying vector representation.
+     Return a view of the dimensions. The view is invalidated when the TensorShape is modified or destroyed.
+  */
+  gsl::span<const int64_t> GetDims() const { return gsl::make_span(values_.data(), values_.size()); }
+
+  /**
+     Return a copy of the dimensions as a std::vector.
+  */
+  std::vector<int64_t> GetDimsAsVector() const { return std::vector<int64_t>(values_.begin(), values_.end()); }
+
+  /**
+     Return a copy of the dimensions that can be modified without allocating for the common ranks.
   */
-  const std::vector<int64_t>& GetDims() const { return *this; }
+  TensorShapeVector AsShapeVector() const { return values_; }
 
   /**
    * Return the total number of elements. Returns 1 for an empty (rank 0) TensorShape.
@@ -125,14 +149,12 @@ class TensorShape : private std::vector<int64_t> {
      empty shape or 1D shape (1) is regarded as scalar tensor
   */
   bool IsScalar() const {
-    size_t len = size();
-    return len == 0 || (len == 1 && operator[](0) == 1);
+    size_t len = values_.size();
+    return len == 0 || (len == 1 && values_[0] == 1);
   }
 
-  static const TensorShape& ReinterpretBaseType(const std::vector<int64_t>& dimensions) {
-    static_assert(sizeof(TensorShape) == sizeof(std::vector<int64_t>), "Size of TensorShape prevents safe casting from vector");
-    return *static_cast<const TensorShape*>(&dimensions);
-  }
+ private:
+  TensorShapeVector values_;
 };
 #ifdef __GNUC__
 #pragma GCC diagnostic pop
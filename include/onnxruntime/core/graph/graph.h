@@ -617,6 +617,10 @@ class Graph {
   /** Check if a given name is an initializer tensor's name in this graph. */
   bool IsInitializedTensor(const std::string& name) const;
 
+  /** Check if a given name is an initializer that the model stores as a sparse_initializer.
+  @remarks The Graph holds the initializer as a dense TensorProto all the same. */
+  bool IsSparseInitializer(const std::string& name) const;
+
   /** Gets an initializer tensor with the provided name.
   @param[out] value Set to the TensorProto* if the initializer is found, or nullptr if not.
   @returns True if found.
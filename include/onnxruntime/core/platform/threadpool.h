@@ -16,6 +16,8 @@ limitations under the License.
 /* Modifications Copyright (c) Microsoft. */
 
 #pragma once
+#include <atomic>
+#include <chrono>
 #include <string>
 #include <vector>
 #include <functional>
@@ -112,6 +114,32 @@ limitations under the License.
 // - Given the extensive modifications to original Eigen code, should
 //   we separate that out as a new class and remove the dependence on
 //   other Eigen components.
+//
+// Requests
+// --------
+//
+// Work from concurrent requests (such as InferenceSession::Run calls)
+// shares the threads of a pool.  A thread working on behalf of a
+// request identifies it via ThreadPool::RequestScope, and the parallel
+// loops it starts are then associated with that request:
+//
+// - Helper threads stop claiming iterations of a loop while a loop of
+//   a more urgent request is running in the same pool, and return to
+//   the pool where they can pick up the more urgent work.  The thread
+//   that entered a loop always runs it to completion, so each loop
+//   makes progress.  Requests are ordered by priority, and then by
+//   deadline.
+//
+// - Once a request is cancelled, via its terminate flag or by passing
+//   its deadline, helper threads stop claiming iterations of its loops
+//   and return to the pool.  The thread that entered a loop still runs
+//   the remaining iterations, so loops always complete and kernels never
+//   see partially computed results.  Kernels that can stop early poll
+//   CurrentRequest()->IsCancelled() themselves, and the executors check
+//   it between kernels.
+//
+// - When a request carries a RequestAccounting record, the CPU time
+//   that helper threads spend in its loops is added to the record.
 
 // This file use PIMPL to avoid having eigen headers here
 namespace Eigen {
@@ -137,6 +165,8 @@ class ExtendedThreadPoolInterface;
 class LoopCounter;
 class ThreadPoolParallelSection;
 
+class RequestScheduler;
+
 class ThreadPool {
  public:
 #ifdef _WIN32
@@ -144,6 +174,65 @@ class ThreadPool {
 #else
   using NAME_CHAR_TYPE = char;
 #endif
+
+  enum class RequestPriority {
+    Low = 0,
+    Normal = 1,
+    High = 2,
+  };
+
+  // Resources used on behalf of a request.  The counters are updated
+  // concurrently by the threads working on the request.
+  struct RequestAccounting {
+    RequestAccounting();
+
+    // Unique among the records created in the process, so that allocators
+    // can attribute memory to the request.
+    const uint64_t id;
+
+    std::atomic<uint64_t> worker_cpu_time_ns{0};
+    std::atomic<uint64_t> kernels_executed{0};
+    std::atomic<uint64_t> bytes_copied{0};
+  };
+
+  // Scheduling attributes of a request, see "Requests" above.  The
+  // context must outlive all work run on behalf of the request.
+  struct RequestContext {
+    RequestPriority priority = RequestPriority::Normal;
+    std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max();
+
+    // Optional flag that is set to cancel the request.  It is written
+    // while the threads working on the request read it.
+    const std::atomic<bool>* terminate = nullptr;
+
+    // Optional record of the resources used by the request.
+    RequestAccounting* accounting = nullptr;
+
+    bool HasDeadline() const {
+      return deadline != std::chrono::steady_clock::time_point::max();
+    }
+
+    bool IsCancelled() const {
+      return (terminate != nullptr && terminate->load(std::memory_order_relaxed)) ||
+             (HasDeadline() && std::chrono::steady_clock::now() >= deadline);
+    }
+  };
+
+  // Associates the calling thread with a request until the scope is
+  // destroyed.  Scopes may be nested, and a nullptr request clears the
+  // association.
+  class RequestScope {
+   public:
+    explicit RequestScope(const RequestContext* request);
+    ~RequestScope();
+
+   private:
+    const RequestContext* const previous_;
+    ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(RequestScope);
+  };
+
+  // Returns the request the calling thread is working on, or nullptr.
+  static const RequestContext* CurrentRequest();
   // Constructs a pool for running with with "degree_of_parallelism" threads with
   // specified "name". env->StartThread() is used to create individual threads
   // with the given ThreadOptions. If "low_latency_hint" is true the thread pool
@@ -433,6 +522,12 @@ class ThreadPool {
 
   std::string StopProfiling();
 
+  // Non-owning reference to the current thread's request (or nullptr
+  // outside requests).
+  static thread_local const RequestContext* current_request;
+  static_assert(std::is_trivially_destructible<decltype(current_request)>::value,
+                "Per-thread state should be trivially destructible");
+
   ThreadOptions thread_options_;
 
   // If a thread pool is created with degree_of_parallelism != 1 then an underlying
@@ -443,6 +538,9 @@ class ThreadPool {
 
   // If used, underlying_threadpool_ is instantiated and owned by the ThreadPool.
   std::unique_ptr<ThreadPoolTempl<Env> > extended_eigen_threadpool_;
+
+  // Tracks the loops of concurrent requests running in the pool.
+  std::unique_ptr<RequestScheduler> request_scheduler_;
 };
 
 }  // namespace concurrency
@@ -206,6 +206,12 @@ typedef void(ORT_API_CALL* OrtLoggingFunction)(
     void* param, OrtLoggingLevel severity, const char* category, const char* logid, const char* code_location,
     const char* message);
 
+// Invoked when a request queued with RunAsync completes. 'outputs' is the output array that was passed to RunAsync.
+// If 'status' is nullptr the run succeeded and 'outputs' holds the results, which the caller owns.
+// 'status' is owned by ORT and is only valid during the call.
+typedef void(ORT_API_CALL* RunAsyncCallbackFn)(void* user_data, OrtValue** outputs, size_t num_outputs,
+                                               OrtStatusPtr status);
+
 // Set Graph optimization level.
 // Refer https://github.com/microsoft/onnxruntime/blob/master/docs/ONNX_Runtime_Graph_Optimizations.md
 // for in-depth undersrtanding of Graph Optimizations in ORT
@@ -221,6 +227,13 @@ typedef enum ExecutionMode {
   ORT_PARALLEL = 1,
 } ExecutionMode;
 
+// Priority of a Run relative to concurrent Run calls that share its thread pools.
+typedef enum OrtRunPriority {
+  ORT_RUN_PRIORITY_LOW = 0,
+  ORT_RUN_PRIORITY_NORMAL = 1,  // default
+  ORT_RUN_PRIORITY_HIGH = 2,
+} OrtRunPriority;
+
 // Set the language projection, default is C, which means it will classify the language not in the list to C also.
 typedef enum OrtLanguageProjection {
   ORT_PROJECTION_C = 0,  // default
@@ -1276,6 +1289,69 @@ struct OrtApi {
      */
   ORT_API2_STATUS(KernelInfoGetAttributeArray_int64, _In_ const OrtKernelInfo* info, _In_ const char* name,
                   _Out_ int64_t* out, _Inout_ size_t* size);
+
+  /**
+   * Get the aggregate per-operator latency metrics collected by the session since it was created.
+   * Metrics are collected if the session config entry "session.enable_operator_metrics" is set to "1".
+   * This may be called at any time, including while other threads are calling Run.
+   * \param out is set to a null terminated JSON string allocated using 'allocator'. The caller is responsible
+   * for freeing it. The document contains a "nodes" array and an "op_types" array. Each entry holds
+   * "count", "total_ns", "max_ns" and "histogram", and "histogram_bounds_ns" gives the upper bound of each
+   * histogram bucket but the last.
+   */
+  ORT_API2_STATUS(SessionGetOperatorMetrics, _In_ const OrtSession* sess, _Inout_ OrtAllocator* allocator,
+                  _Outptr_ char** out);
+
+  /**
+   * Queue a Run and return without waiting for it. Requests are run in order by threads of the session dedicated
+   * to them, whose number is set by the session config entry "session.run_async_num_threads" (1 by default).
+   * The inputs and names are captured by the call.
+   * 'run_options' is not copied: it must remain valid until the callback is invoked, and RunOptionsSetTerminate
+   * on it cancels the run.
+   * 'output' must remain valid until the callback is invoked. It may contain nullptr or preallocated values,
+   * as for Run.
+   * 'callback' is invoked on a request thread once the run completes. It must not release the session;
+   * releasing the session waits for all outstanding requests.
+   * If this returns an error the request was not queued and the callback is not invoked.
+   */
+  ORT_API2_STATUS(RunAsync, _Inout_ OrtSession* sess, _In_opt_ const OrtRunOptions* run_options,
+                  _In_reads_(input_len) const char* const* input_names,
+                  _In_reads_(input_len) const OrtValue* const* input, size_t input_len,
+                  _In_reads_(output_names_len) const char* const* output_names, size_t output_names_len,
+                  _Inout_updates_all_(output_names_len) OrtValue** output,
+                  _In_ RunAsyncCallbackFn callback, _In_opt_ void* user_data);
+
+  /**
+   * Set the priority of Run calls that use these options. The threads of an intra-op thread pool shared by
+   * concurrent runs help with the parallel work of the most urgent run first. Runs are ordered by priority, and
+   * then by deadline. The default is ORT_RUN_PRIORITY_NORMAL.
+   */
+  ORT_API2_STATUS(RunOptionsSetPriority, _Inout_ OrtRunOptions* options, OrtRunPriority priority);
+
+  /**
+   * Set a deadline for Run calls that use these options, in milliseconds from the start of each run. A run that
+   * passes its deadline stops as if RunOptionsSetTerminate had been called and returns an error. The deadline is
+   * checked between kernels, so a kernel that is running when it passes completes first. A value of 0 removes
+   * the deadline.
+   */
+  ORT_API2_STATUS(RunOptionsSetDeadline, _Inout_ OrtRunOptions* options, int64_t deadline_ms);
+
+  /**
+   * Run the model as Run does, and also account for the resources used by the run. Accounting adds a small
+   * overhead, so it is only done for runs made with this function.
+   * 'statistics' receives a JSON document allocated with 'allocator' with the wall time and CPU time of the run
+   * in nanoseconds ("wall_time_ns", "cpu_time_ns"), the number of kernels executed ("kernels_executed"), the bytes
+   * copied between devices ("bytes_copied") and, for each arena allocator of the session, the peak number of bytes
+   * allocated on behalf of the run ("arenas": [{"name", "device_id", "peak_bytes"}]). CPU time includes the time
+   * intra-op and inter-op worker threads spent on the run. The peak bytes include the buffer the run allocates
+   * for its memory pattern, but not the memory reserved for initializers when the session was created.
+   */
+  ORT_API2_STATUS(RunWithStatistics, _Inout_ OrtSession* sess, _In_opt_ const OrtRunOptions* run_options,
+                  _In_reads_(input_len) const char* const* input_names,
+                  _In_reads_(input_len) const OrtValue* const* input, size_t input_len,
+                  _In_reads_(output_names_len) const char* const* output_names, size_t output_names_len,
+                  _Inout_updates_all_(output_names_len) OrtValue** output,
+                  _Inout_ OrtAllocator* allocator, _Outptr_ char** statistics);
 };
 
 /*
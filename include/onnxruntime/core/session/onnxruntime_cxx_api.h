@@ -288,6 +288,10 @@ struct RunOptions : Base<OrtRunOptions> {
   RunOptions& SetTerminate();
   // unset the terminate flag so this RunOptions instance can be used in a new Session::Run call
   RunOptions& UnsetTerminate();
+
+  // see OrtApi::RunOptionsSetPriority and OrtApi::RunOptionsSetDeadline
+  RunOptions& SetPriority(OrtRunPriority priority);
+  RunOptions& SetDeadline(int64_t deadline_ms);
 };
 
 struct SessionOptions : Base<OrtSessionOptions> {
@@ -358,6 +362,18 @@ struct Session : Base<OrtSession> {
 
   void Run(const RunOptions& run_options, const struct IoBinding&);
 
+  // Queues the run and returns immediately, see OrtApi::RunAsync. run_options and output_values must remain valid
+  // until callback is invoked; on success output_values holds the outputs.
+  void RunAsync(const RunOptions& run_options, const char* const* input_names, const Value* input_values, size_t input_count,
+                const char* const* output_names, Value* output_values, size_t output_count,
+                RunAsyncCallbackFn callback, void* user_data);
+
+  // Run for when there is a list of preallocated outputs, also returning the resources used by the run as a
+  // JSON document allocated with allocator, see OrtApi::RunWithStatistics.
+  char* RunWithStatistics(const RunOptions& run_options, const char* const* input_names, const Value* input_values,
+                          size_t input_count, const char* const* output_names, Value* output_values,
+                          size_t output_count, OrtAllocator* allocator);
+
   size_t GetInputCount() const;
   size_t GetOutputCount() const;
   size_t GetOverridableInitializerCount() const;
@@ -366,6 +382,7 @@ struct Session : Base<OrtSession> {
   char* GetOutputName(size_t index, OrtAllocator* allocator) const;
   char* GetOverridableInitializerName(size_t index, OrtAllocator* allocator) const;
   char* EndProfiling(OrtAllocator* allocator) const;
+  char* GetOperatorMetrics(OrtAllocator* allocator) const;
   uint64_t GetProfilingStartTimeNs() const;
   ModelMetadata GetModelMetadata() const;
 
@@ -395,6 +395,16 @@ inline RunOptions& RunOptions::UnsetTerminate() {
   return *this;
 }
 
+inline RunOptions& RunOptions::SetPriority(OrtRunPriority priority) {
+  ThrowOnError(GetApi().RunOptionsSetPriority(p_, priority));
+  return *this;
+}
+
+inline RunOptions& RunOptions::SetDeadline(int64_t deadline_ms) {
+  ThrowOnError(GetApi().RunOptionsSetDeadline(p_, deadline_ms));
+  return *this;
+}
+
 inline SessionOptions::SessionOptions() {
   ThrowOnError(GetApi().CreateSessionOptions(&p_));
 }
@@ -534,6 +544,27 @@ inline void Session::Run(const RunOptions& run_options, const IoBinding& io_bind
   ThrowOnError(GetApi().RunWithBinding(p_, run_options, io_binding));
 }
 
+inline void Session::RunAsync(const RunOptions& run_options, const char* const* input_names, const Value* input_values, size_t input_count,
+                              const char* const* output_names, Value* output_values, size_t output_count,
+                              RunAsyncCallbackFn callback, void* user_data) {
+  auto ort_input_values = reinterpret_cast<const OrtValue**>(const_cast<Value*>(input_values));
+  auto ort_output_values = reinterpret_cast<OrtValue**>(output_values);
+  ThrowOnError(GetApi().RunAsync(p_, run_options, input_names, ort_input_values, input_count, output_names, output_count,
+                                 ort_output_values, callback, user_data));
+}
+
+inline char* Session::RunWithStatistics(const RunOptions& run_options, const char* const* input_names,
+                                        const Value* input_values, size_t input_count,
+                                        const char* const* output_names, Value* output_values, size_t output_count,
+                                        OrtAllocator* allocator) {
+  auto ort_input_values = reinterpret_cast<const OrtValue**>(const_cast<Value*>(input_values));
+  auto ort_output_values = reinterpret_cast<OrtValue**>(output_values);
+  char* out;
+  ThrowOnError(GetApi().RunWithStatistics(p_, run_options, input_names, ort_input_values, input_count, output_names,
+                                          output_count, ort_output_values, allocator, &out));
+  return out;
+}
+
 inline size_t Session::GetInputCount() const {
   size_t out;
   ThrowOnError(GetApi().SessionGetInputCount(p_, &out));
@@ -576,6 +607,12 @@ inline char* Session::EndProfiling(OrtAllocator* allocator) const {
   return out;
 }
 
+inline char* Session::GetOperatorMetrics(OrtAllocator* allocator) const {
+  char* out;
+  ThrowOnError(GetApi().SessionGetOperatorMetrics(p_, allocator, &out));
+  return out;
+}
+
 inline uint64_t Session::GetProfilingStartTimeNs() const {
   uint64_t out;
   ThrowOnError(GetApi().SessionGetProfilingStartTimeNs(p_, &out));
@@ -56,3 +56,33 @@ static const char* const kOrtSessionOptionsEnableGeluApproximation = "optimizati
 // "1": default, thread will spin a number of times before blocking
 static const char* const kOrtSessionOptionsConfigAllowInterOpSpinning = "session.inter_op.allow_spinning";
 static const char* const kOrtSessionOptionsConfigAllowIntraOpSpinning = "session.intra_op.allow_spinning";
+
+// If a value is "1", aggregate per-operator latency metrics (call counts, total/maximum latency and a latency
+// histogram for each node and op type) are collected on every run. The default is "0".
+// Unlike profiling, no per-run events are stored, so the overhead is low enough to leave enabled in production.
+// The metrics can be read at any time with SessionGetOperatorMetrics.
+static const char* const kOrtSessionOptionsEnableOperatorMetrics = "session.enable_operator_metrics";
+
+// If a value is "1", the first run that uses a cached memory pattern is recorded, and later runs with the same input
+// shapes replay it: the kernels are run in the recorded order on the intermediate tensors of the recording, without
+// looking up the memory pattern or allocating them again. The default is "0".
+// Requires the memory pattern optimization and sequential execution. Runs with profiling enabled, and runs on nodes
+// that need fences, are not replayed.
+static const char* const kOrtSessionOptionsEnableStaticShapeReplay = "session.enable_static_shape_replay";
+
+// If a value is "1", the CPU execution provider stores eligible constant float weights as float16 and widens them to
+// float when they are used: input B of MatMul and Gemm, and the data input of Gather. This halves the memory held
+// by these weights, at the cost of the precision lost in rounding them to float16 and of converting them back on
+// every run. The default is "0".
+static const char* const kOrtSessionOptionsConfigUseFp16Initializers = "session.use_fp16_initializers";
+
+// If a value is "1", the CPU execution provider stores the constant float data input of Gather and EmbeddingBag as
+// int8, with each row (one slice along the gathered axis) scaled by its own largest magnitude. This quarters the
+// memory held by embedding tables and the memory traffic of looking them up, at the cost of an error of up to half a
+// quantization step per element. It takes precedence over kOrtSessionOptionsConfigUseFp16Initializers for these
+// inputs. The default is "0".
+static const char* const kOrtSessionOptionsConfigQuantizeGatherTables = "session.quantize_gather_tables";
+
+// Number of threads that run the requests queued with RunAsync, which are started by the first request. Each runs
+// one request at a time, and the kernels of the request use the intra-op thread pool as usual. The default is "1".
+static const char* const kOrtSessionOptionsConfigRunAsyncNumThreads = "session.run_async_num_threads";
@@ -13,6 +13,13 @@
 namespace onnxruntime {
 namespace contrib {
 
+// Total sequence length (S*) from which the attention is computed without materializing the attention probs.
+constexpr int kFusedAttentionMinimumSequenceLength = 512;
+
+// Number of queries and keys in the blocks processed by the fused attention.
+constexpr int kFusedAttentionQueryBlockSize = 64;
+constexpr int kFusedAttentionKeyBlockSize = 256;
+
 class AttentionCPUBase : public AttentionBase {
  protected:
   AttentionCPUBase(const OpKernelInfo& info) : AttentionBase(info) {}
@@ -40,6 +47,21 @@ class AttentionCPUBase : public AttentionBase {
     // Total sequence length including that of past state: S* = S' + S
     const int all_sequence_length = past_sequence_length + sequence_length;
 
+    const int32_t* mask_index_data = mask_index != nullptr ? mask_index->template Data<int32_t>() : nullptr;
+    gsl::span<const int64_t> mask_index_dims = mask_index != nullptr ? mask_index->Shape().GetDims() : gsl::span<const int64_t>{};
+    const T* past_data = past != nullptr ? past->template Data<T>() : nullptr;
+    T* present_data = present != nullptr ? present->template MutableData<T>() : nullptr;
+
+    // For long sequences, the keys and values are processed in blocks so that the attention probs are not
+    // materialized.
+    if (all_sequence_length >= kFusedAttentionMinimumSequenceLength) {
+      ComputeFusedAttention<T>(output->template MutableData<T>(), Q, K, V,
+                               mask_index_data, mask_index_dims,
+                               batch_size, sequence_length, past_sequence_length, head_size,
+                               past_data, present_data, tp);
+      return Status::OK();
+    }
+
     // Compute the attention score. It does 2 things:
     //         I. attention_probs(B, N, S, S*) = 1/sqrt(H) x Q(B, N, S, H) x K'(B, N, S*, H -> B, N, H, S*) +
     //                                           1 x mask_data(B, N, S, S*)
@@ -56,11 +78,6 @@ class AttentionCPUBase : public AttentionBase {
     }
     BufferUniquePtr mask_data_buffer(mask_data, BufferDeleter(allocator));
 
-    const int32_t* mask_index_data = mask_index != nullptr ? mask_index->template Data<int32_t>() : nullptr;
-    const std::vector<int64_t>* mask_index_dims = mask_index != nullptr ? &(mask_index->Shape().GetDims()) : nullptr;
-    const T* past_data = past != nullptr ? past->template Data<T>() : nullptr;
-    T* present_data = present != nullptr ? present->template MutableData<T>() : nullptr;
-
     ComputeAttentionProbs<T>(static_cast<T*>(attention_probs), Q, K,
                              mask_index_data, mask_index_dims, static_cast<T*>(mask_data),
                              batch_size, sequence_length, past_sequence_length, head_size,
@@ -79,6 +96,133 @@ class AttentionCPUBase : public AttentionBase {
   }
 
  private:
+  // Helper function to compute the attention without materializing the attention probs. The work is split among the
+  // threads by batch, head and block of queries. For each block of queries, the keys and values are read in blocks,
+  // and the softmax is computed online: the running maximum and sum of the exponentials of each row are kept, and the
+  // partial output is rescaled when the maximum grows. The result is written to the output in BxSxNxH layout.
+  template <typename T>
+  void ComputeFusedAttention(T* output,                                // output tensor with size BxSxNxH
+                             const T* Q,                               // Q data. Its size is BxNxSxH
+                             const T* K,                               // K data. Its size is BxNxSxH
+                             const T* V,                               // V data. Its size is BxNxSxH
+                             const int32_t* mask_index,                // mask index. nullptr if no mask
+                             gsl::span<const int64_t> mask_index_dims,  // mask index shape
+                             int batch_size,                           // batch size of self-attention
+                             int sequence_length,                      // sequence length of self-attention
+                             int past_sequence_length,                 // sequence length of past state
+                             int head_size,                            // head size of self-attention
+                             const T* past,                            // past state
+                             T* present,                               // present state
+                             ThreadPool* tp) const {
+    const int all_sequence_length = past_sequence_length + sequence_length;                  // S* = S' + S
+    const size_t past_chunk_length = static_cast<size_t>(past_sequence_length) * head_size;  // S' x H
+    const size_t input_chunk_length = static_cast<size_t>(sequence_length) * head_size;      // S x H
+    const size_t present_chunk_length = past_chunk_length + input_chunk_length;              // S* x H
+    const int loop_len = batch_size * num_heads_;
+
+    // concatenate past_K and K, and past_V and V: (BxNx)S'xH, (BxNx)SxH -> (BxNx)S*xH
+    if (nullptr != present) {
+      const T* past_v = past != nullptr ? past + loop_len * past_chunk_length : nullptr;
+      T* present_v = present + loop_len * present_chunk_length;
+      ThreadPool::TryParallelFor(tp, loop_len, static_cast<double>(present_chunk_length) * 2,
+                                 [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+                                   for (std::ptrdiff_t i = begin; i != end; ++i) {
+                                     ConcatStateChunk(past, K + input_chunk_length * i, present,
+                                                      past_chunk_length, present_chunk_length, i);
+                                     ConcatStateChunk(past_v, V + input_chunk_length * i, present_v,
+                                                      past_chunk_length, present_chunk_length, i);
+                                   }
+                                 });
+    }
+
+    const bool has_mask = mask_index != nullptr || (is_unidirectional_ && sequence_length > 1);
+    const int query_block_count = (sequence_length + kFusedAttentionQueryBlockSize - 1) / kFusedAttentionQueryBlockSize;
+    const float alpha = 1.0f / sqrt(static_cast<float>(head_size));
+
+    // The cost of the two Gemms of a block of queries
+    const double cost = 2.0 * kFusedAttentionQueryBlockSize * all_sequence_length * head_size;
+
+    ThreadPool::TryParallelFor(tp, static_cast<std::ptrdiff_t>(loop_len) * query_block_count, cost, [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+      std::vector<T> scores(static_cast<size_t>(kFusedAttentionQueryBlockSize) * kFusedAttentionKeyBlockSize);
+      std::vector<T> partial_output(static_cast<size_t>(kFusedAttentionQueryBlockSize) * head_size);
+      std::vector<T> row_max(kFusedAttentionQueryBlockSize);
+      std::vector<T> row_sum(kFusedAttentionQueryBlockSize);
+
+      for (std::ptrdiff_t task = begin; task != end; ++task) {
+        const std::ptrdiff_t i = task / query_block_count;
+        const int batch_index = static_cast<int>(i / num_heads_);
+        const int head_index = static_cast<int>(i % num_heads_);
+        const int query_start = static_cast<int>(task % query_block_count) * kFusedAttentionQueryBlockSize;
+        const int query_count = std::min(kFusedAttentionQueryBlockSize, sequence_length - query_start);
+
+        const T* q = Q + input_chunk_length * i + static_cast<size_t>(query_start) * head_size;
+        const T* k = nullptr != present ? present + present_chunk_length * i : K + input_chunk_length * i;
+        const T* v = nullptr != present ? present + present_chunk_length * (loop_len + i) : V + input_chunk_length * i;
+
+        std::fill_n(row_max.begin(), query_count, -std::numeric_limits<T>::infinity());
+        std::fill_n(row_sum.begin(), query_count, static_cast<T>(0));
+        std::fill_n(partial_output.begin(), static_cast<size_t>(query_count) * head_size, static_cast<T>(0));
+
+        for (int key_start = 0; key_start < all_sequence_length; key_start += kFusedAttentionKeyBlockSize) {
+          const int key_count = std::min(kFusedAttentionKeyBlockSize, all_sequence_length - key_start);
+
+          // scores(S_q, S_k) = 1/sqrt(H) x Q(S_q, H) x K'(S_k, H -> H, S_k) + mask(S_q, S_k)
+          math::Gemm<T, ThreadPool>(CblasNoTrans, CblasTrans, query_count, key_count, head_size, alpha,
+                                    q, k + static_cast<size_t>(key_start) * head_size, 0.0f, scores.data(), nullptr);
+          if (has_mask) {
+            ApplyMaskToScoreBlock(scores.data(), mask_index, mask_index_dims, is_unidirectional_,
+                                  batch_index, batch_size, sequence_length, past_sequence_length,
+                                  query_start, query_count, key_start, key_count);
+          }
+
+          // Replace the scores with their exponentials relative to the new maximum of each row, and rescale the
+          // sums and the partial outputs computed relative to the previous maximum.
+          for (int q_i = 0; q_i < query_count; q_i++) {
+            T* p_score = scores.data() + q_i * key_count;
+
+            T block_max;
+            MlasReduceRows(MlasMaximumReduction, p_score, &block_max, 1, key_count);
+            const T new_max = std::max(row_max[q_i], block_max);
+
+            for (int k_i = 0; k_i < key_count; k_i++) {
+              p_score[k_i] -= new_max;
+            }
+            MlasComputeExp(p_score, p_score, key_count);
+
+            T block_sum;
+            MlasReduceRows(MlasSumReduction, p_score, &block_sum, 1, key_count);
+
+            const T scale = std::exp(row_max[q_i] - new_max);
+            row_sum[q_i] = row_sum[q_i] * scale + block_sum;
+            row_max[q_i] = new_max;
+
+            if (scale != static_cast<T>(1)) {
+              T* p_output = partial_output.data() + static_cast<size_t>(q_i) * head_size;
+              for (int h = 0; h < head_size; h++) {
+                p_output[h] *= scale;
+              }
+            }
+          }
+
+          // partial_output(S_q, H) += scores(S_q, S_k) x V(S_k, H)
+          math::Gemm<T, ThreadPool>(CblasNoTrans, CblasNoTrans, query_count, head_size, key_count, 1.0f,
+                                    scores.data(), v + static_cast<size_t>(key_start) * head_size, 1.0f,
+                                    partial_output.data(), nullptr);
+        }
+
+        // out(B, S, N, H) = partial_output(S_q, H) / sum, which also transposes (BxN)xSxH to BxSxNxH.
+        for (int q_i = 0; q_i < query_count; q_i++) {
+          const T* src = partial_output.data() + static_cast<size_t>(q_i) * head_size;
+          T* dest = output + ((static_cast<size_t>(batch_index) * sequence_length + query_start + q_i) * num_heads_ + head_index) * head_size;
+          const T reciprocal_sum = static_cast<T>(1) / row_sum[q_i];
+          for (int h = 0; h < head_size; h++) {
+            dest[h] = src[h] * reciprocal_sum;
+          }
+        }
+      }
+    });
+  }
+
   // Helper function to compute the attention probs. It does 2 things:
   //  I. attention_probs(B, N, S, S*) = 1/sqrt(H) x Q(B, N, S, H) x K'(B, N, S*, H -> B, N, H, S*) +
   //                                    1 x mask_data(B, N, S, S*)
@@ -88,7 +232,7 @@ class AttentionCPUBase : public AttentionBase {
                              const T* Q,                                   // Q data. Its size is BxNxSxH
                              const T* K,                                   // k data. Its size is BxNxSxH
                              const int32_t* mask_index,                    // mask index. nullptr if no mask or its size is B
-                             const std::vector<int64_t>* mask_index_dims,  // mask index shape
+                             gsl::span<const int64_t> mask_index_dims,     // mask index shape
                              T* mask_data,                                 // buffer for mask data. It is nullptr if mask_index is nullptr, otherwise its shape is BxSxS*
                              int batch_size,                               // batch size of self-attention
                              int sequence_length,                          // sequence length of self-attention
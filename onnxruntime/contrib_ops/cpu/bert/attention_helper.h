@@ -61,7 +61,7 @@ inline void ComputeAttentionSoftmaxInplace(float* score, int N, int D, ThreadPoo
 
 template <typename T>
 void PrepareMask(const int32_t* mask_index,
-                 const std::vector<int64_t>* mask_index_dims,
+                 gsl::span<const int64_t> mask_index_dims,
                  T* mask_data,
                  bool is_unidirectional,
                  int batch_size,
@@ -73,7 +73,7 @@ void PrepareMask(const int32_t* mask_index,
   T* p_mask = mask_data;
 
   // For 3D mask, convert values 0 to -10000.0, and 1 to 0.0, then apply unidirectional mask if any.
-  if (nullptr != mask_index_dims && mask_index_dims->size() == 3) {
+  if (mask_index_dims.size() == 3) {
     for (int i = 0; i < batch_size * sequence_length * all_sequence_length; i++) {
       p_mask[i] = (mask_index[i] > 0) ? static_cast<T>(0.0f) : static_cast<T>(-10000.0f);
     }
@@ -92,8 +92,8 @@ void PrepareMask(const int32_t* mask_index,
     return;
   }
 
-  bool is_raw_attention_mask = (nullptr != mask_index_dims && mask_index_dims->size() == 2);
-  bool has_mask_start_position = (nullptr != mask_index_dims && mask_index_dims->size() == 1 && static_cast<int>(mask_index_dims->at(0)) == 2 * batch_size);
+  bool is_raw_attention_mask = (mask_index_dims.size() == 2);
+  bool has_mask_start_position = (mask_index_dims.size() == 1 && static_cast<int>(mask_index_dims[0]) == 2 * batch_size);
 
   for (int b_i = 0; b_i < batch_size; b_i++) {
     // TODO: mask_index can be used in softmax to save some calculation.
@@ -141,6 +141,62 @@ void PrepareMask(const int32_t* mask_index,
   }
 }
 
+// Add the mask of one batch to a block of attention scores, for the queries [query_start, query_start + query_count)
+// and the keys [key_start, key_start + key_count). The scores have a row per query with key_count values. The added
+// values are the same as the ones generated by PrepareMask, without materializing the mask for all the queries.
+template <typename T>
+void ApplyMaskToScoreBlock(T* scores,
+                           const int32_t* mask_index,
+                           gsl::span<const int64_t> mask_index_dims,
+                           bool is_unidirectional,
+                           int batch_index,
+                           int batch_size,
+                           int sequence_length,
+                           int past_sequence_length,
+                           int query_start,
+                           int query_count,
+                           int key_start,
+                           int key_count) {
+  const int all_sequence_length = past_sequence_length + sequence_length;
+
+  // Keys in [masked_end, S*) and [0, masked_start) are masked for masks of shape (B) or (2B).
+  int masked_end = all_sequence_length;
+  int masked_start = 0;
+  if (mask_index != nullptr && mask_index_dims.size() == 1) {
+    masked_end = mask_index[batch_index];
+    if (static_cast<int>(mask_index_dims[0]) == 2 * batch_size) {
+      masked_start = std::min(mask_index[batch_index + batch_size], all_sequence_length);
+    }
+  }
+
+  for (int q_i = 0; q_i < query_count; q_i++) {
+    const int s_i = query_start + q_i;
+    T* p_score = scores + q_i * key_count;
+
+    const int32_t* raw_mask = nullptr;
+    if (mask_index != nullptr && mask_index_dims.size() == 3) {
+      raw_mask = mask_index + (batch_index * sequence_length + s_i) * all_sequence_length;
+    } else if (mask_index != nullptr && mask_index_dims.size() == 2) {
+      raw_mask = mask_index + batch_index * all_sequence_length;
+    }
+
+    for (int k_i = 0; k_i < key_count; k_i++) {
+      const int m_i = key_start + k_i;
+      if (raw_mask != nullptr) {
+        if (raw_mask[m_i] <= 0) {
+          p_score[k_i] += static_cast<T>(-10000.0f);
+        }
+      } else if (m_i >= masked_end || m_i < masked_start) {
+        p_score[k_i] += static_cast<T>(-10000.0f);
+      }
+
+      if (is_unidirectional && m_i > past_sequence_length + s_i) {
+        p_score[k_i] += static_cast<T>(-10000.0f);
+      }
+    }
+  }
+}
+
 // Concatenate a past state chunk S'xH with input state chunk SxH into present state chunk S*xH
 // Returns a pointer to the start of present state chunk.
 template <typename T>
@@ -74,10 +74,13 @@ Status BiasGelu<T, use_approximation>::Compute(OpKernelContext* context) const {
   const T* bias_data = bias->template Data<T>();
   int64_t bias_len = bias->Shape().Size();
 
-  AllocatorPtr alloc;
-  ORT_RETURN_IF_ERROR(context->GetTempSpaceAllocator(&alloc));
-  BufferUniquePtr buffer = BufferUniquePtr(alloc->Alloc(SafeInt<size_t>(sizeof(T)) * elem_count),
-                                           BufferDeleter(alloc));
+  // Only the approximation needs a temporary buffer.
+  BufferUniquePtr buffer;
+  if (use_approximation) {
+    AllocatorPtr alloc;
+    ORT_RETURN_IF_ERROR(context->GetTempSpaceAllocator(&alloc));
+    buffer = BufferUniquePtr(alloc->Alloc(SafeInt<size_t>(sizeof(T)) * elem_count), BufferDeleter(alloc));
+  }
   T* tmp_data = static_cast<T*>(buffer.get());
 
   int64_t task_count = elem_count / bias_len;
@@ -87,7 +90,7 @@ Status BiasGelu<T, use_approximation>::Compute(OpKernelContext* context) const {
       [&](ptrdiff_t task_idx) {
         const T* p_input = input_data + task_idx * bias_len;
         T* p_output = output_data + task_idx * bias_len;
-        T* p_tmp = tmp_data + task_idx * bias_len;
+        T* p_tmp = tmp_data != nullptr ? tmp_data + task_idx * bias_len : nullptr;
 
         AddBiasGelu(p_input, bias_data, p_tmp, p_output, bias_len);
       },
@@ -113,16 +116,10 @@ void BiasGelu<T, use_approximation>::AddBiasGelu(
     }
   } else {  // BiasGelu
     for (int64_t i = 0; i < count; i++) {
-      T value = input[i] + bias[i];
-      output[i] = value * static_cast<T>(M_SQRT1_2);
-      temp[i] = value * 0.5f;
+      output[i] = input[i] + bias[i];
     }
 
-    MlasComputeErf(output, output, count);
-
-    for (int64_t i = 0; i < count; i++) {
-      output[i] = temp[i] * (output[i] + 1.0f);
-    }
+    MlasComputeGelu(output, output, count);
   }
 }
 
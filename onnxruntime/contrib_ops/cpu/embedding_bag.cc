@@ -0,0 +1,168 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/common/common.h"
+#include "core/framework/op_kernel.h"
+#include "core/platform/threadpool.h"
+#include "core/providers/cpu/tensor/gather_table.h"
+
+namespace onnxruntime {
+namespace contrib {
+
+// Gathers rows along the first axis of the data and sums or averages each bag of rows directly into the output.
+class EmbeddingBag final : public OpKernel {
+ public:
+  explicit EmbeddingBag(const OpKernelInfo& info) : OpKernel(info) {
+    const std::string mode = info.GetAttrOrDefault<std::string>("mode", "sum");
+    ORT_ENFORCE(mode == "sum" || mode == "mean", "Invalid mode attribute value: ", mode);
+    mean_ = mode == "mean";
+    keepdims_ = info.GetAttrOrDefault<int64_t>("keepdims", 1) != 0;
+  }
+
+  Status PrePack(const Tensor& tensor, int input_idx, bool& is_packed) override;
+
+  Status Compute(OpKernelContext* context) const override;
+
+ private:
+  template <typename Tind>
+  Status ComputeImpl(const TensorShape& data_shape, const float* data, const Tensor& indices, Tensor& output,
+                     concurrency::ThreadPool* tp) const;
+
+  bool mean_;
+  bool keepdims_;
+
+  // Constant data stored with a narrower type, with a row for each index of the first axis.
+  TensorShape packed_data_shape_;
+  std::unique_ptr<PackedGatherTable> packed_data_;
+};
+
+ONNX_OPERATOR_KERNEL_EX(
+    EmbeddingBag,
+    kMSDomain,
+    1,
+    kCpuExecutionProvider,
+    KernelDefBuilder()
+        .TypeConstraint("T", DataTypeImpl::GetTensorType<float>())
+        .TypeConstraint("Tind", {DataTypeImpl::GetTensorType<int32_t>(), DataTypeImpl::GetTensorType<int64_t>()}),
+    EmbeddingBag);
+
+Status EmbeddingBag::PrePack(const Tensor& tensor, int input_idx, bool& is_packed) {
+  is_packed = false;
+
+  PackedGatherTable::Format format;
+  if (input_idx == 0 && tensor.Shape().NumDimensions() >= 1 && tensor.Shape().Size() > 0 &&
+      PackedGatherTable::GetFormat(Info(), format)) {
+    const TensorShape& shape = tensor.Shape();
+    packed_data_ = onnxruntime::make_unique<PackedGatherTable>(tensor.Data<float>(), shape[0],
+                                                               shape.SizeFromDimension(1), format,
+                                                               Info().GetAllocator(0, OrtMemTypeDefault));
+    packed_data_shape_ = shape;
+    is_packed = true;
+  }
+
+  return Status::OK();
+}
+
+template <typename Tind>
+Status EmbeddingBag::ComputeImpl(const TensorShape& data_shape, const float* data, const Tensor& indices,
+                                 Tensor& output, concurrency::ThreadPool* tp) const {
+  const Tind* indices_data = indices.Data<Tind>();
+  const TensorShape& indices_shape = indices.Shape();
+
+  const int64_t row_count = data_shape[0];
+  const int64_t row_size = data_shape.SizeFromDimension(1);
+  const int64_t bag_size = indices_shape[indices_shape.NumDimensions() - 1];
+  const int64_t bag_count = indices_shape.SizeToDimension(indices_shape.NumDimensions() - 1);
+  const int64_t index_count = indices_shape.Size();
+
+  for (int64_t i = 0; i < index_count; ++i) {
+    const Tind idx = indices_data[i];
+    if (idx < -row_count || idx >= row_count) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                             "indices element out of data bounds, idx=", idx,
+                             " must be within the inclusive range [", -row_count, ",", row_count - 1, "]");
+    }
+  }
+
+  auto row_of = [&](int64_t i) -> int64_t {
+    const int64_t idx = static_cast<int64_t>(indices_data[i]);
+    return idx < 0 ? idx + row_count : idx;
+  };
+
+  const PackedGatherTable* packed_data = packed_data_.get();
+  const size_t row_bytes = static_cast<size_t>(row_size) * sizeof(float);
+  float* output_data = output.MutableData<float>();
+
+  // The indices are walked in order across the bags of a partition so that the rows of the next bag are
+  // prefetched while the current one is finished.
+  auto reduce_bags = [&](ptrdiff_t first, ptrdiff_t last) {
+    const int64_t index_end = last * bag_size;
+
+    for (ptrdiff_t bag = first; bag < last; ++bag) {
+      float* bag_output = output_data + bag * row_size;
+      std::fill_n(bag_output, row_size, 0.0f);
+
+      for (int64_t i = bag * bag_size; i < (bag + 1) * bag_size; ++i) {
+        if (i + kGatherPrefetchDistance < index_end) {
+          const int64_t prefetch_row = row_of(i + kGatherPrefetchDistance);
+          if (packed_data != nullptr) {
+            packed_data->PrefetchRow(prefetch_row);
+          } else if (row_bytes >= kGatherPrefetchMinRowBytes) {
+            GatherPrefetchRow(data + prefetch_row * row_size, row_bytes);
+          }
+        }
+
+        const int64_t row = row_of(i);
+        if (packed_data != nullptr) {
+          packed_data->AccumulateRow(row, bag_output);
+        } else {
+          const float* row_data = data + row * row_size;
+          for (int64_t j = 0; j < row_size; ++j) {
+            bag_output[j] += row_data[j];
+          }
+        }
+      }
+
+      if (mean_ && bag_size > 1) {
+        const float scale = 1.0f / static_cast<float>(bag_size);
+        for (int64_t j = 0; j < row_size; ++j) {
+          bag_output[j] *= scale;
+        }
+      }
+    }
+  };
+
+  concurrency::ThreadPool::TryParallelFor(tp, static_cast<std::ptrdiff_t>(bag_count),
+                                          static_cast<double>(bag_size * row_size), reduce_bags);
+
+  return Status::OK();
+}
+
+Status EmbeddingBag::Compute(OpKernelContext* context) const {
+  const Tensor* data = packed_data_ ? nullptr : context->Input<Tensor>(0);
+  const Tensor& indices = *context->Input<Tensor>(1);
+
+  const TensorShape& data_shape = packed_data_ ? packed_data_shape_ : data->Shape();
+  const TensorShape& indices_shape = indices.Shape();
+  if (data_shape.NumDimensions() < 1 || indices_shape.NumDimensions() < 1) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "data and indices must have a rank of at least 1.");
+  }
+
+  std::vector<int64_t> output_dims(indices_shape.GetDims().begin(), indices_shape.GetDims().end() - 1);
+  if (keepdims_) {
+    output_dims.push_back(1);
+  }
+  output_dims.insert(output_dims.end(), data_shape.GetDims().begin() + 1, data_shape.GetDims().end());
+  Tensor& output = *context->Output(0, TensorShape(output_dims));
+
+  const float* data_values = packed_data_ ? nullptr : data->Data<float>();
+  concurrency::ThreadPool* tp = context->GetOperatorThreadPool();
+
+  if (indices.IsDataType<int32_t>()) {
+    return ComputeImpl<int32_t>(data_shape, data_values, indices, output, tp);
+  }
+  return ComputeImpl<int64_t>(data_shape, data_values, indices, output, tp);
+}
+
+}  // namespace contrib
+}  // namespace onnxruntime
@@ -0,0 +1,292 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/common/common.h"
+#include "core/common/safeint.h"
+#include "core/framework/op_kernel.h"
+#include "core/mlas/inc/mlas.h"
+#include "core/platform/threadpool.h"
+#include "core/util/math_cpuonly.h"
+
+namespace onnxruntime {
+namespace contrib {
+
+namespace {
+
+enum class ElementwiseOp {
+  Add,
+  Sub,
+  Mul,
+  Div,
+  Abs,
+  Erf,
+  Exp,
+  Neg,
+  Reciprocal,
+  Relu,
+  Sigmoid,
+  Sqrt,
+  Tanh,
+};
+
+bool ParseElementwiseOp(const std::string& name, ElementwiseOp& op) {
+  static const std::unordered_map<std::string, ElementwiseOp> ops{
+      {"Add", ElementwiseOp::Add},
+      {"Sub", ElementwiseOp::Sub},
+      {"Mul", ElementwiseOp::Mul},
+      {"Div", ElementwiseOp::Div},
+      {"Abs", ElementwiseOp::Abs},
+      {"Erf", ElementwiseOp::Erf},
+      {"Exp", ElementwiseOp::Exp},
+      {"Neg", ElementwiseOp::Neg},
+      {"Reciprocal", ElementwiseOp::Reciprocal},
+      {"Relu", ElementwiseOp::Relu},
+      {"Sigmoid", ElementwiseOp::Sigmoid},
+      {"Sqrt", ElementwiseOp::Sqrt},
+      {"Tanh", ElementwiseOp::Tanh},
+  };
+
+  auto it = ops.find(name);
+  if (it == ops.end()) {
+    return false;
+  }
+  op = it->second;
+  return true;
+}
+
+bool IsBinary(ElementwiseOp op) {
+  return op == ElementwiseOp::Add || op == ElementwiseOp::Sub || op == ElementwiseOp::Mul || op == ElementwiseOp::Div;
+}
+
+void EvaluateElementwiseOp(ElementwiseOp op, const float* a, const float* b, float* y, int64_t count) {
+  ConstEigenVectorArrayMap<float> am(a, count);
+  EigenVectorArrayMap<float> ym(y, count);
+
+  switch (op) {
+    case ElementwiseOp::Add:
+      ym = am + ConstEigenVectorArrayMap<float>(b, count);
+      break;
+    case ElementwiseOp::Sub:
+      ym = am - ConstEigenVectorArrayMap<float>(b, count);
+      break;
+    case ElementwiseOp::Mul:
+      ym = am * ConstEigenVectorArrayMap<float>(b, count);
+      break;
+    case ElementwiseOp::Div:
+      ym = am / ConstEigenVectorArrayMap<float>(b, count);
+      break;
+    case ElementwiseOp::Abs:
+      ym = am.abs();
+      break;
+    case ElementwiseOp::Erf:
+      MlasComputeErf(a, y, static_cast<size_t>(count));
+      break;
+    case ElementwiseOp::Exp:
+      ym = am.exp();
+      break;
+    case ElementwiseOp::Neg:
+      ym = -am;
+      break;
+    case ElementwiseOp::Reciprocal:
+      ym = am.inverse();
+      break;
+    case ElementwiseOp::Relu:
+      ym = am.cwiseMax(0.0f);
+      break;
+    case ElementwiseOp::Sigmoid:
+      MlasComputeLogistic(a, y, static_cast<size_t>(count));
+      break;
+    case ElementwiseOp::Sqrt:
+      ym = am.sqrt();
+      break;
+    case ElementwiseOp::Tanh:
+      MlasComputeTanh(a, y, static_cast<size_t>(count));
+      break;
+  }
+}
+
+// Number of elements evaluated at a time. Every step of the chain reads and writes blocks of this size, so the
+// intermediate results stay in the cache instead of being streamed through memory.
+constexpr int64_t kTileSize = 1024;
+
+// Number of elements below which splitting the work with another thread costs more than it saves.
+constexpr int64_t kMinElementsPerTask = 16 * kTileSize;
+
+}  // namespace
+
+// Evaluates a chain of elementwise operators tile by tile. See the FusedElementwise schema.
+class FusedElementwise final : public OpKernel {
+ public:
+  explicit FusedElementwise(const OpKernelInfo& info) : OpKernel(info) {
+    std::vector<std::string> ops;
+    std::vector<int64_t> operands;
+    ORT_ENFORCE(info.GetAttrs<std::string>("ops", ops).IsOK() && !ops.empty(), "Missing or empty 'ops' attribute");
+    ORT_ENFORCE(info.GetAttrs<int64_t>("operands", operands).IsOK() && operands.size() == 2 * ops.size(),
+                "The 'operands' attribute must have two entries for each operator");
+
+    input_count_ = static_cast<int64_t>(info.node().InputDefs().size());
+
+    for (size_t k = 0; k < ops.size(); ++k) {
+      Step step;
+      ORT_ENFORCE(ParseElementwiseOp(ops[k], step.op), "Unsupported operator in FusedElementwise: ", ops[k]);
+
+      // Operands refer to the inputs or to the results of the preceding operators.
+      const int64_t operand_limit = input_count_ + static_cast<int64_t>(k);
+      const int operand_count = IsBinary(step.op) ? 2 : 1;
+      for (int j = 0; j < 2; ++j) {
+        step.operands[j] = operands[2 * k + j];
+        if (j < operand_count) {
+          ORT_ENFORCE(step.operands[j] >= 0 && step.operands[j] < operand_limit,
+                      "Invalid operand ", step.operands[j], " for operator ", k, " of FusedElementwise");
+        }
+      }
+      steps_.push_back(step);
+    }
+  }
+
+  Status Compute(OpKernelContext* context) const override;
+
+ private:
+  struct Step {
+    ElementwiseOp op;
+    int64_t operands[2];
+  };
+
+  int64_t input_count_;
+  std::vector<Step> steps_;
+};
+
+ONNX_OPERATOR_KERNEL_EX(
+    FusedElementwise,
+    kMSDomain,
+    1,
+    kCpuExecutionProvider,
+    KernelDefBuilder()
+        .TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
+    FusedElementwise);
+
+Status FusedElementwise::Compute(OpKernelContext* context) const {
+  // Broadcast the input shapes to the output shape.
+  std::vector<int64_t> output_dims;
+  for (int64_t i = 0; i < input_count_; ++i) {
+    const auto& dims = context->Input<Tensor>(static_cast<int>(i))->Shape().GetDims();
+    if (dims.size() > output_dims.size()) {
+      output_dims.insert(output_dims.begin(), dims.size() - output_dims.size(), 1);
+    }
+    const size_t offset = output_dims.size() - dims.size();
+    for (size_t d = 0; d < dims.size(); ++d) {
+      int64_t& output_dim = output_dims[offset + d];
+      if (output_dim == 1) {
+        output_dim = dims[d];
+      } else if (dims[d] != 1 && dims[d] != output_dim) {
+        return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "FusedElementwise inputs are not broadcastable: ",
+                               context->Input<Tensor>(0)->Shape(), " and ",
+                               context->Input<Tensor>(static_cast<int>(i))->Shape());
+      }
+    }
+  }
+
+  const TensorShape output_shape(output_dims);
+  Tensor* Y = context->Output(0, output_shape);
+  const int64_t output_size = output_shape.Size();
+  if (output_size == 0) {
+    return Status::OK();
+  }
+
+  // Each input is read as the full output, a single element, or a block that repeats along the leading axes of the
+  // output. The latter two are expanded into per-thread tile buffers.
+  struct Input {
+    const float* data;
+    int64_t period;
+    int64_t buffer;
+  };
+  std::vector<Input> inputs;
+  int64_t buffer_count = static_cast<int64_t>(steps_.size()) - 1;
+
+  for (int64_t i = 0; i < input_count_; ++i) {
+    const Tensor* X = context->Input<Tensor>(static_cast<int>(i));
+    const auto& dims = X->Shape().GetDims();
+    const int64_t size = X->Shape().Size();
+
+    if (size != output_size && size != 1) {
+      size_t first = 0;
+      while (first < dims.size() && dims[first] == 1) {
+        ++first;
+      }
+      const size_t trailing_rank = dims.size() - first;
+      if (!std::equal(dims.begin() + first, dims.end(), output_dims.end() - trailing_rank)) {
+        return ORT_MAKE_STATUS(ONNXRUNTIME, NOT_IMPLEMENTED, "FusedElementwise input ", i, " with shape ",
+                               X->Shape(), " does not match the trailing dimensions of the output shape ",
+                               output_shape);
+      }
+    }
+
+    inputs.push_back({X->Data<float>(), size, size == output_size ? -1 : buffer_count++});
+  }
+
+  float* output_data = Y->MutableData<float>();
+  concurrency::ThreadPool* tp = context->GetOperatorThreadPool();
+
+  const int64_t tile_count = (output_size + kTileSize - 1) / kTileSize;
+  const int64_t task_count = std::max<int64_t>(std::min<int64_t>(concurrency::ThreadPool::DegreeOfParallelism(tp),
+                                                                 output_size / kMinElementsPerTask),
+                                               1);
+  const size_t task_buffer_size = SafeInt<size_t>(buffer_count) * kTileSize;
+
+  AllocatorPtr alloc;
+  ORT_RETURN_IF_ERROR(context->GetTempSpaceAllocator(&alloc));
+  auto buffers = IAllocator::MakeUniquePtr<float>(alloc, SafeInt<size_t>(task_count) * task_buffer_size);
+
+  concurrency::ThreadPool::TrySimpleParallelFor(tp, static_cast<std::ptrdiff_t>(task_count), [&](std::ptrdiff_t task) {
+    float* task_buffers = buffers.get() + task * task_buffer_size;
+    std::vector<const float*> values(static_cast<size_t>(input_count_) + steps_.size());
+
+    // Single element inputs are the same in every tile.
+    for (const auto& input : inputs) {
+      if (input.period == 1 && input.buffer >= 0) {
+        std::fill_n(task_buffers + input.buffer * kTileSize, kTileSize, input.data[0]);
+      }
+    }
+
+    const int64_t tile_start = task * tile_count / task_count;
+    const int64_t tile_end = (task + 1) * tile_count / task_count;
+
+    for (int64_t tile = tile_start; tile < tile_end; ++tile) {
+      const int64_t offset = tile * kTileSize;
+      const int64_t count = std::min(kTileSize, output_size - offset);
+
+      for (size_t i = 0; i < inputs.size(); ++i) {
+        const auto& input = inputs[i];
+        if (input.buffer < 0) {
+          values[i] = input.data + offset;
+          continue;
+        }
+
+        float* buffer = task_buffers + input.buffer * kTileSize;
+        if (input.period > 1) {
+          int64_t position = offset % input.period;
+          for (int64_t filled = 0; filled < count;) {
+            const int64_t n = std::min(count - filled, input.period - position);
+            std::copy_n(input.data + position, n, buffer + filled);
+            filled += n;
+            position = 0;
+          }
+        }
+        values[i] = buffer;
+      }
+
+      for (size_t k = 0; k < steps_.size(); ++k) {
+        const Step& step = steps_[k];
+        float* result = (k + 1 == steps_.size()) ? output_data + offset : task_buffers + k * kTileSize;
+        EvaluateElementwiseOp(step.op, values[step.operands[0]],
+                              IsBinary(step.op) ? values[step.operands[1]] : nullptr, result, count);
+        values[input_count_ + k] = result;
+      }
+    }
+  });
+
+  return Status::OK();
+}
+
+}  // namespace contrib
+}  // namespace onnxruntime
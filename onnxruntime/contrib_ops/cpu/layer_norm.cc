@@ -5,6 +5,7 @@
 
 #include "core/common/safeint.h"
 #include "core/framework/tensor.h"
+#include "core/mlas/inc/mlas.h"
 #include "core/platform/threadpool.h"
 #include "core/providers/common.h"
 #include "core/util/math_cpuonly.h"
@@ -35,6 +36,57 @@ namespace contrib {
 REGISTER_KERNEL_TYPED(float)
 REGISTER_KERNEL_TYPED(double)
 
+namespace {
+
+template <typename T>
+void ComputeJob(const T* X_data, const T* scale_data, const T* bias_data, ptrdiff_t task_idx, int64_t norm_size,
+                float epsilon, bool simplified, T* Y_data, T* mean_data, T* inv_std_var_data) {
+  const T* p_input = X_data + task_idx * norm_size;
+  T* p_output = Y_data + task_idx * norm_size;
+
+  T mean = 0;
+  T mean_square = 0;
+
+  for (int64_t h = 0; h < norm_size; h++) {
+    mean += p_input[h];
+    mean_square += p_input[h] * p_input[h];
+  }
+
+  mean = mean / norm_size;
+  if (simplified) {
+    mean_square = sqrt(mean_square / norm_size + epsilon);
+  } else {
+    mean_square = sqrt(mean_square / norm_size - mean * mean + epsilon);
+  }
+
+  for (int64_t h = 0; h < norm_size; h++) {
+    if (simplified) {
+      p_output[h] = p_input[h] / mean_square * scale_data[h];
+    } else if (nullptr == bias_data) {
+      p_output[h] = (p_input[h] - mean) / mean_square * scale_data[h];
+    } else {
+      p_output[h] = (p_input[h] - mean) / mean_square * scale_data[h] + bias_data[h];
+    }
+  }
+
+  if (mean_data != nullptr) {
+    mean_data[task_idx] = mean;
+  }
+  inv_std_var_data[task_idx] = 1 / mean_square;
+}
+
+// The float kernel accumulates the row statistics and applies the normalization with SIMD instructions.
+void ComputeJob(const float* X_data, const float* scale_data, const float* bias_data, ptrdiff_t task_idx,
+                int64_t norm_size, float epsilon, bool simplified, float* Y_data, float* mean_data,
+                float* inv_std_var_data) {
+  MlasComputeLayerNormalization(X_data + task_idx * norm_size, nullptr, nullptr, scale_data, bias_data,
+                                Y_data + task_idx * norm_size, static_cast<size_t>(norm_size), epsilon, simplified,
+                                mean_data == nullptr ? nullptr : mean_data + task_idx,
+                                inv_std_var_data + task_idx);
+}
+
+}  // namespace
+
 template <typename T, bool simplified>
 LayerNorm<T, simplified>::LayerNorm(const OpKernelInfo& op_kernel_info)
     : OpKernel(op_kernel_info) {
@@ -103,38 +155,8 @@ Status LayerNorm<T, simplified>::Compute(OpKernelContext* p_ctx) const {
 
   concurrency::ThreadPool::TryBatchParallelFor(p_ctx->GetOperatorThreadPool(), static_cast<int32_t>(norm_count),
                                                [&](ptrdiff_t task_idx) {
-                                                 const T* p_input = X_data + task_idx * norm_size;
-                                                 T* p_output = Y_data + task_idx * norm_size;
-
-                                                 T mean = 0;
-                                                 T mean_square = 0;
-
-                                                 for (int64_t h = 0; h < norm_size; h++) {
-                                                   mean += p_input[h];
-                                                   mean_square += p_input[h] * p_input[h];
-                                                 }
-
-                                                 mean = mean / norm_size;
-                                                 if (simplified) {
-                                                   mean_square = sqrt(mean_square / norm_size + epsilon_);
-                                                 } else {
-                                                   mean_square = sqrt(mean_square / norm_size - mean * mean + epsilon_);
-                                                 }
-
-                                                 for (int64_t h = 0; h < norm_size; h++) {
-                                                   if (simplified) {
-                                                     p_output[h] = p_input[h] / mean_square * scale_data[h];
-                                                   } else if (nullptr == bias){
-                                                     p_output[h] = (p_input[h] - mean) / mean_square * scale_data[h];
-                                                   } else {
-                                                     p_output[h] = (p_input[h] - mean) / mean_square * scale_data[h] + bias_data[h];
-                                                   }
-                                                 }
-
-                                                 if (mean_data != nullptr) {
-                                                   mean_data[task_idx] = mean;
-                                                 }
-                                                 inv_std_var_data[task_idx] = 1 / mean_square;
+                                                 ComputeJob(X_data, scale_data, bias_data, task_idx, norm_size, epsilon_,
+                                                            simplified, Y_data, mean_data, inv_std_var_data);
                                                }, 0);
 
   return Status::OK();
@@ -98,11 +98,11 @@ Status QLinearGlobalAveragePool::Compute(OpKernelContext* context) const {
   const size_t spatial_dim_end = spatial_dim_start + (x_shape.size() - 2);
 
   int64_t N = x_shape[0];
-  int64_t C = (channels_last_ ? x_shape.back() : x_shape[1]);
+  int64_t C = (channels_last_ ? x_shape[x_shape.size() - 1] : x_shape[1]);
   int64_t image_size = std::accumulate(x_shape.cbegin() + spatial_dim_start, x_shape.cbegin() + spatial_dim_end,
                                        1LL, std::multiplies<int64_t>());
 
-  std::vector<int64_t> output_dims(x_shape);
+  std::vector<int64_t> output_dims(x_shape.begin(), x_shape.end());
   std::transform(x_shape.cbegin() + spatial_dim_start, x_shape.cbegin() + spatial_dim_end,
                  output_dims.begin() + spatial_dim_start, [](const int64_t&) { return int64_t{1}; });
   Tensor& Y = *context->Output(0, output_dims);
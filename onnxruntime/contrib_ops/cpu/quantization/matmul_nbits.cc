@@ -0,0 +1,182 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/op_kernel.h"
+#include "core/mlas/inc/mlas.h"
+#include "core/providers/common.h"
+#include "core/providers/cpu/math/matmul_helper.h"
+
+namespace onnxruntime {
+namespace contrib {
+
+class MatMulNBits final : public OpKernel {
+ public:
+  MatMulNBits(const OpKernelInfo& info) : OpKernel(info) {
+    ORT_ENFORCE(Status::OK() == info.GetAttr<int64_t>("K", &K_));
+    ORT_ENFORCE(Status::OK() == info.GetAttr<int64_t>("N", &N_));
+    ORT_ENFORCE(Status::OK() == info.GetAttr<int64_t>("block_size", &block_size_));
+    nbits_ = info.GetAttrOrDefault<int64_t>("bits", 4);
+
+    ORT_ENFORCE(nbits_ == 4, "MatMulNBits: only 4-bit quantization is supported, got bits=", nbits_);
+    ORT_ENFORCE(K_ > 0 && N_ > 0, "MatMulNBits: attributes K and N must be positive.");
+    ORT_ENFORCE(MlasQ4GemmPackBSize(static_cast<size_t>(N_), static_cast<size_t>(K_), static_cast<size_t>(block_size_)) != 0,
+                "MatMulNBits: block_size must be a power of 2 from 16 to 256, got ", block_size_);
+  }
+
+  Status PrePack(const Tensor& tensor, int input_idx, bool& is_packed) override;
+
+  Status Compute(OpKernelContext* context) const override;
+
+  enum InputTensors : int {
+    IN_A = 0,
+    IN_B = 1,
+    IN_SCALES = 2,
+    IN_ZERO_POINTS = 3
+  };
+
+ private:
+  Status ValidateQuantizedInputs(const Tensor& b, const Tensor& scales, const Tensor* zero_points) const;
+
+  void PackB(void* packed_b, const Tensor& b, const Tensor& scales, const Tensor* zero_points) const;
+
+  int64_t K_;
+  int64_t N_;
+  int64_t block_size_;
+  int64_t nbits_;
+  BufferUniquePtr packed_b_;
+};
+
+Status MatMulNBits::ValidateQuantizedInputs(const Tensor& b, const Tensor& scales, const Tensor* zero_points) const {
+  const int64_t blocks_per_col = (K_ + block_size_ - 1) / block_size_;
+  const int64_t blob_size = block_size_ * nbits_ / 8;
+
+  ORT_RETURN_IF_NOT(b.Shape().Size() == N_ * blocks_per_col * blob_size,
+                    "MatMulNBits: input B must have N * n_blocks_per_col * blob_size elements, got shape ",
+                    b.Shape());
+  ORT_RETURN_IF_NOT(scales.Shape().Size() == N_ * blocks_per_col,
+                    "MatMulNBits: input scales must have N * n_blocks_per_col elements, got shape ",
+                    scales.Shape());
+  if (zero_points != nullptr) {
+    ORT_RETURN_IF_NOT(zero_points->Shape().Size() == N_ * ((blocks_per_col + 1) / 2),
+                      "MatMulNBits: input zero_points must have N * ((n_blocks_per_col + 1) / 2) elements, got shape ",
+                      zero_points->Shape());
+  }
+
+  return Status::OK();
+}
+
+void MatMulNBits::PackB(void* packed_b, const Tensor& b, const Tensor& scales, const Tensor* zero_points) const {
+  MlasQ4GemmPackB(packed_b,
+                  b.Data<uint8_t>(),
+                  scales.Data<float>(),
+                  zero_points != nullptr ? zero_points->Data<uint8_t>() : nullptr,
+                  static_cast<size_t>(N_),
+                  static_cast<size_t>(K_),
+                  static_cast<size_t>(block_size_));
+}
+
+Status MatMulNBits::PrePack(const Tensor& tensor, int input_idx, bool& is_packed) {
+  is_packed = false;
+
+  if (input_idx != IN_B) {
+    return Status::OK();
+  }
+
+  // The packed layout interleaves the scales and zero points with the
+  // quantized data, so these must also be constant to pack matrix B.
+  const Tensor* scales = nullptr;
+  const Tensor* zero_points = nullptr;
+  if (!Info().TryGetConstantInput(IN_SCALES, &scales)) {
+    return Status::OK();
+  }
+  const auto& input_defs = Info().node().InputDefs();
+  if (input_defs.size() > static_cast<size_t>(IN_ZERO_POINTS) && input_defs[IN_ZERO_POINTS]->Exists() &&
+      !Info().TryGetConstantInput(IN_ZERO_POINTS, &zero_points)) {
+    return Status::OK();
+  }
+
+  ORT_RETURN_IF_ERROR(ValidateQuantizedInputs(tensor, *scales, zero_points));
+
+  const size_t packed_b_size = MlasQ4GemmPackBSize(static_cast<size_t>(N_), static_cast<size_t>(K_),
+                                                   static_cast<size_t>(block_size_));
+
+  auto alloc = Info().GetAllocator(0, OrtMemTypeDefault);
+  auto* packed_b_data = alloc->Alloc(packed_b_size);
+  packed_b_ = BufferUniquePtr(packed_b_data, BufferDeleter(alloc));
+  PackB(packed_b_data, tensor, *scales, zero_points);
+
+  is_packed = true;
+  return Status::OK();
+}
+
+Status MatMulNBits::Compute(OpKernelContext* ctx) const {
+  const Tensor* a = ctx->Input<Tensor>(IN_A);
+
+  TensorShape b_shape({K_, N_});
+
+  MatMulComputeHelper helper;
+  ORT_RETURN_IF_ERROR(helper.Compute(a->Shape(), b_shape));
+
+  Tensor* y = ctx->Output(0, helper.OutputShape());
+
+  // Bail out early if the output is going to be empty
+  if (y->Shape().Size() == 0)
+    return Status::OK();
+
+  const void* packed_b = packed_b_.get();
+
+  // Pack matrix B for this run if it was not a constant initializer.
+  BufferUniquePtr packed_b_holder;
+  if (packed_b == nullptr) {
+    const Tensor* b = ctx->Input<Tensor>(IN_B);
+    const Tensor* scales = ctx->Input<Tensor>(IN_SCALES);
+    const Tensor* zero_points = ctx->Input<Tensor>(IN_ZERO_POINTS);
+    ORT_RETURN_IF_ERROR(ValidateQuantizedInputs(*b, *scales, zero_points));
+
+    AllocatorPtr allocator;
+    ORT_RETURN_IF_ERROR(ctx->GetTempSpaceAllocator(&allocator));
+    void* packed_b_data = allocator->Alloc(MlasQ4GemmPackBSize(static_cast<size_t>(N_), static_cast<size_t>(K_),
+                                                               static_cast<size_t>(block_size_)));
+    packed_b_holder = BufferUniquePtr(packed_b_data, BufferDeleter(allocator));
+    PackB(packed_b_data, *b, *scales, zero_points);
+    packed_b = packed_b_data;
+  }
+
+  const size_t M = static_cast<size_t>(helper.M());
+  const size_t N = static_cast<size_t>(helper.N());
+  const size_t K = static_cast<size_t>(helper.K());
+
+  const auto* a_data = a->Data<float>();
+  auto* y_data = y->MutableData<float>();
+
+  const size_t num_gemms = helper.OutputOffsets().size();
+  std::vector<MLAS_Q4_GEMM_DATA_PARAMS> gemm_data_vec(num_gemms);
+
+  for (size_t gemm_idx = 0; gemm_idx < num_gemms; gemm_idx++) {
+    auto& params = gemm_data_vec[gemm_idx];
+    params.A = a_data + helper.LeftOffsets()[gemm_idx];
+    params.lda = K;
+    params.PackedB = packed_b;
+    params.C = y_data + helper.OutputOffsets()[gemm_idx];
+    params.ldc = N;
+  }
+
+  MlasQ4GemmBatch(M, N, K, static_cast<size_t>(block_size_), gemm_data_vec.data(), num_gemms,
+                  ctx->GetOperatorThreadPool());
+
+  return Status::OK();
+}
+
+ONNX_OPERATOR_TYPED_KERNEL_EX(
+    MatMulNBits,
+    kMSDomain,
+    1,
+    float,
+    kCpuExecutionProvider,
+    KernelDefBuilder()
+        .TypeConstraint("T1", DataTypeImpl::GetTensorType<float>())
+        .TypeConstraint("T2", DataTypeImpl::GetTensorType<uint8_t>()),
+    MatMulNBits);
+
+}  // namespace contrib
+}  // namespace onnxruntime
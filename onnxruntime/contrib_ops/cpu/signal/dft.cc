@@ -10,9 +10,12 @@
 #include "dft.h"
 #include <functional>
 
+#include "core/platform/ort_mutex.h"
 #include "core/platform/threadpool.h"
 
 #include <complex>
+#include <memory>
+#include <unordered_map>
 
 namespace onnxruntime {
 namespace contrib {
@@ -54,233 +57,447 @@ static bool is_complex_valued_signal(const onnxruntime::TensorShape& shape) {
   return shape.NumDimensions() == 3 && shape[2] == 2;
 }
 
-static bool is_power_of_2(size_t size) {
-  unsigned n_bits = 0;
-  while (size != 0) {
-    n_bits += size & 1;
-    size = size >> 1;
-  }
-  return n_bits == 1;
+// Multiplies two complex values without the NaN and infinity recovery that
+// std::complex applies, which otherwise prevents inlining in the butterflies.
+template <typename T>
+static inline std::complex<T> complex_multiply(const std::complex<T>& a, const std::complex<T>& b) {
+  return std::complex<T>(a.real() * b.real() - a.imag() * b.imag(), a.real() * b.imag() + a.imag() * b.real());
 }
 
-static const unsigned char BitReverseTable256[] =
-{
-    0x00, 0x80, 0x40, 0xC0, 0x20, 0xA0, 0x60, 0xE0, 0x10, 0x90, 0x50, 0xD0, 0x30, 0xB0, 0x70, 0xF0,
-    0x08, 0x88, 0x48, 0xC8, 0x28, 0xA8, 0x68, 0xE8, 0x18, 0x98, 0x58, 0xD8, 0x38, 0xB8, 0x78, 0xF8,
-    0x04, 0x84, 0x44, 0xC4, 0x24, 0xA4, 0x64, 0xE4, 0x14, 0x94, 0x54, 0xD4, 0x34, 0xB4, 0x74, 0xF4,
-    0x0C, 0x8C, 0x4C, 0xCC, 0x2C, 0xAC, 0x6C, 0xEC, 0x1C, 0x9C, 0x5C, 0xDC, 0x3C, 0xBC, 0x7C, 0xFC,
-    0x02, 0x82, 0x42, 0xC2, 0x22, 0xA2, 0x62, 0xE2, 0x12, 0x92, 0x52, 0xD2, 0x32, 0xB2, 0x72, 0xF2,
-    0x0A, 0x8A, 0x4A, 0xCA, 0x2A, 0xAA, 0x6A, 0xEA, 0x1A, 0x9A, 0x5A, 0xDA, 0x3A, 0xBA, 0x7A, 0xFA,
-    0x06, 0x86, 0x46, 0xC6, 0x26, 0xA6, 0x66, 0xE6, 0x16, 0x96, 0x56, 0xD6, 0x36, 0xB6, 0x76, 0xF6,
-    0x0E, 0x8E, 0x4E, 0xCE, 0x2E, 0xAE, 0x6E, 0xEE, 0x1E, 0x9E, 0x5E, 0xDE, 0x3E, 0xBE, 0x7E, 0xFE,
-    0x01, 0x81, 0x41, 0xC1, 0x21, 0xA1, 0x61, 0xE1, 0x11, 0x91, 0x51, 0xD1, 0x31, 0xB1, 0x71, 0xF1,
-    0x09, 0x89, 0x49, 0xC9, 0x29, 0xA9, 0x69, 0xE9, 0x19, 0x99, 0x59, 0xD9, 0x39, 0xB9, 0x79, 0xF9,
-    0x05, 0x85, 0x45, 0xC5, 0x25, 0xA5, 0x65, 0xE5, 0x15, 0x95, 0x55, 0xD5, 0x35, 0xB5, 0x75, 0xF5,
-    0x0D, 0x8D, 0x4D, 0xCD, 0x2D, 0xAD, 0x6D, 0xED, 0x1D, 0x9D, 0x5D, 0xDD, 0x3D, 0xBD, 0x7D, 0xFD,
-    0x03, 0x83, 0x43, 0xC3, 0x23, 0xA3, 0x63, 0xE3, 0x13, 0x93, 0x53, 0xD3, 0x33, 0xB3, 0x73, 0xF3,
-    0x0B, 0x8B, 0x4B, 0xCB, 0x2B, 0xAB, 0x6B, 0xEB, 0x1B, 0x9B, 0x5B, 0xDB, 0x3B, 0xBB, 0x7B, 0xFB,
-    0x07, 0x87, 0x47, 0xC7, 0x27, 0xA7, 0x67, 0xE7, 0x17, 0x97, 0x57, 0xD7, 0x37, 0xB7, 0x77, 0xF7,
-    0x0F, 0x8F, 0x4F, 0xCF, 0x2F, 0xAF, 0x6F, 0xEF, 0x1F, 0x9F, 0x5F, 0xDF, 0x3F, 0xBF, 0x7F, 0xFF};
-
-template <unsigned TSignificantBits>
-uint32_t bit_reverse(uint32_t num) {
-  uint32_t rev = (BitReverseTable256[num & 0xff] << 24) |
-         (BitReverseTable256[(num >> 8) & 0xff] << 16) |
-         (BitReverseTable256[(num >> 16) & 0xff] << 8) |
-         (BitReverseTable256[(num >> 24) & 0xff]);
-  return static_cast<uint32_t>(((uint64_t)rev) >> (32 - TSignificantBits));
+// Multiplies a complex value by -i.
+template <typename T>
+static inline std::complex<T> multiply_by_minus_i(const std::complex<T>& a) {
+  return std::complex<T>(a.imag(), -a.real());
 }
 
+// Precomputed state for the forward transform of a fixed number of samples.
+//
+// Lengths whose prime factors are all 2, 3 or 5 use a mixed-radix
+// decimation-in-time transform with radix 4, 2, 3 and 5 butterflies. Other
+// lengths use Bluestein's algorithm, which evaluates the transform as a
+// convolution computed with a power of two transform. Even lengths that are
+// created with real input support also transform real signals as a complex
+// signal of half the length.
 template <typename T>
-static inline T bit_reverse(T num, unsigned significant_bits) {
-  switch (significant_bits) {
-    case 0: return static_cast<T>(bit_reverse<0>(static_cast<uint32_t>(num)));
-    case 1: return static_cast<T>(bit_reverse<1>(static_cast<uint32_t>(num)));
-    case 2: return static_cast<T>(bit_reverse<2>(static_cast<uint32_t>(num)));
-    case 3: return static_cast<T>(bit_reverse<3>(static_cast<uint32_t>(num)));
-    case 4: return static_cast<T>(bit_reverse<4>(static_cast<uint32_t>(num)));
-    case 5: return static_cast<T>(bit_reverse<5>(static_cast<uint32_t>(num)));
-    case 6: return static_cast<T>(bit_reverse<6>(static_cast<uint32_t>(num)));
-    case 7: return static_cast<T>(bit_reverse<7>(static_cast<uint32_t>(num)));
-    case 8: return static_cast<T>(bit_reverse<8>(static_cast<uint32_t>(num)));
-    case 9: return static_cast<T>(bit_reverse<9>(static_cast<uint32_t>(num)));
-    case 10: return static_cast<T>(bit_reverse<10>(static_cast<uint32_t>(num)));
-    case 11: return static_cast<T>(bit_reverse<11>(static_cast<uint32_t>(num)));
-    case 12: return static_cast<T>(bit_reverse<12>(static_cast<uint32_t>(num)));
-    case 13: return static_cast<T>(bit_reverse<13>(static_cast<uint32_t>(num)));
-    case 14: return static_cast<T>(bit_reverse<14>(static_cast<uint32_t>(num)));
-    case 15: return static_cast<T>(bit_reverse<15>(static_cast<uint32_t>(num)));
-    case 16: return static_cast<T>(bit_reverse<16>(static_cast<uint32_t>(num)));
-    case 17: return static_cast<T>(bit_reverse<17>(static_cast<uint32_t>(num)));
-    case 18: return static_cast<T>(bit_reverse<18>(static_cast<uint32_t>(num)));
-    case 19: return static_cast<T>(bit_reverse<19>(static_cast<uint32_t>(num)));
-    case 20: return static_cast<T>(bit_reverse<20>(static_cast<uint32_t>(num)));
-    case 21: return static_cast<T>(bit_reverse<21>(static_cast<uint32_t>(num)));
-    case 22: return static_cast<T>(bit_reverse<22>(static_cast<uint32_t>(num)));
-    case 23: return static_cast<T>(bit_reverse<23>(static_cast<uint32_t>(num)));
-    case 24: return static_cast<T>(bit_reverse<24>(static_cast<uint32_t>(num)));
-    case 25: return static_cast<T>(bit_reverse<25>(static_cast<uint32_t>(num)));
-    case 26: return static_cast<T>(bit_reverse<26>(static_cast<uint32_t>(num)));
-    case 27: return static_cast<T>(bit_reverse<27>(static_cast<uint32_t>(num)));
-    case 28: return static_cast<T>(bit_reverse<28>(static_cast<uint32_t>(num)));
-    case 29: return static_cast<T>(bit_reverse<29>(static_cast<uint32_t>(num)));
-    case 30: return static_cast<T>(bit_reverse<30>(static_cast<uint32_t>(num)));
-    case 31: return static_cast<T>(bit_reverse<31>(static_cast<uint32_t>(num)));
-    case 32: return static_cast<T>(bit_reverse<32>(static_cast<uint32_t>(num)));
-    default: ORT_THROW("Unsupported bit size.");
+class FftPlan {
+ public:
+  FftPlan(size_t number_of_samples, bool supports_real_input) : number_of_samples_(number_of_samples) {
+    twiddles_.resize(number_of_samples);
+    for (size_t i = 0; i < number_of_samples; i++) {
+      twiddles_[i] = unit_phasor(-2.0 * static_cast<double>(i) / static_cast<double>(number_of_samples));
+    }
+
+    size_t remaining = number_of_samples;
+    for (size_t radix : {4, 2, 3, 5}) {
+      while (remaining > 1 && remaining % radix == 0) {
+        remaining /= radix;
+        stages_.push_back({radix, remaining});
+      }
+    }
+
+    if (remaining > 1) {
+      stages_.clear();
+      initialize_bluestein();
+    }
+
+    if (supports_real_input && number_of_samples % 2 == 0) {
+      half_plan_ = onnxruntime::make_unique<FftPlan<T>>(number_of_samples / 2, false);
+    }
   }
-}
 
-template <typename T>
-static T compute_angular_velocity(size_t number_of_samples, bool inverse) {
-  // Calculate fundamental angular velocity
-  static const T pi = static_cast<T>(3.14159265);
-  static const T tau = 2 * pi;
-  T inverse_switch = inverse ? 1.f : -1.f;
-  T angular_velocity = inverse_switch * tau / number_of_samples;
-  return angular_velocity;
-}
+  size_t Size() const { return number_of_samples_; }
 
-template <typename T, typename U>
-static Status fft_radix2(OpKernelContext* /*ctx*/, size_t batch_idx,
-    const Tensor* X, Tensor* Y, const Tensor* window, bool is_onesided, bool inverse,
-    std::vector<std::complex<T>>& V,
-    std::vector<std::complex<T>>& temp_output) {
+  bool SupportsRealInput() const { return half_plan_ != nullptr; }
 
-  // Get shape and significant bits
-  const auto& X_shape = X->Shape();
-  size_t number_of_samples = static_cast<size_t>(X_shape[1]);
-  unsigned significant_bits = static_cast<unsigned>(log2(number_of_samples));
-
-  // Get data
-  auto* X_data = const_cast<U*>(reinterpret_cast<const U*>(X->DataRaw())) + (batch_idx * number_of_samples);
-  // Get window
-  U* window_data = nullptr;
-  if (window) {
-    window_data = const_cast<U*>(reinterpret_cast<const U*>(window->DataRaw()));
+  // Returns the number of complex elements of scratch space used by Forward.
+  size_t ScratchSize() const { return bluestein_plan_ ? 2 * bluestein_plan_->Size() : 0; }
+
+  // Returns the number of complex elements of scratch space used by ForwardReal.
+  size_t RealScratchSize() const { return number_of_samples_ + half_plan_->ScratchSize(); }
+
+  // Transforms the complex input into the complex output, which must not
+  // overlap the input.
+  void Forward(const std::complex<T>* input, std::complex<T>* output, std::complex<T>* scratch) const {
+    if (bluestein_plan_) {
+      bluestein(input, output, scratch);
+    } else if (stages_.empty()) {
+      std::copy(input, input + number_of_samples_, output);
+    } else {
+      transform(input, output, 1, 0);
+    }
   }
 
-  std::complex<T>* Y_data;
-  if (is_onesided) {
-    if (temp_output.size() != number_of_samples) {
-      temp_output = std::vector<std::complex<T>>(number_of_samples);
+  // Transforms the real input, multiplied by the optional window, and
+  // returns the non-redundant first half of the spectrum: number_of_samples/2
+  // + 1 values. Only valid if SupportsRealInput().
+  void ForwardReal(const T* input, const T* window, std::complex<T>* output, std::complex<T>* scratch) const {
+    const size_t half = number_of_samples_ / 2;
+
+    // Pair the even and odd samples as the real and imaginary parts of a
+    // signal of half the length.
+    std::complex<T>* packed = scratch;
+    std::complex<T>* packed_spectrum = scratch + half;
+    if (window) {
+      for (size_t i = 0; i < half; i++) {
+        packed[i] = std::complex<T>(input[2 * i] * window[2 * i], input[2 * i + 1] * window[2 * i + 1]);
+      }
+    } else {
+      for (size_t i = 0; i < half; i++) {
+        packed[i] = std::complex<T>(input[2 * i], input[2 * i + 1]);
+      }
+    }
+
+    half_plan_->Forward(packed, packed_spectrum, scratch + number_of_samples_);
+
+    // Separate the spectra of the even and odd samples and combine them.
+    for (size_t k = 0; k <= half; k++) {
+      const std::complex<T> z = packed_spectrum[k == half ? 0 : k];
+      const std::complex<T> z_mirror = std::conj(packed_spectrum[k == 0 ? 0 : half - k]);
+      const std::complex<T> even = (z + z_mirror) * static_cast<T>(0.5);
+      const std::complex<T> odd = multiply_by_minus_i((z - z_mirror) * static_cast<T>(0.5));
+      output[k] = even + complex_multiply(twiddles_[k], odd);
     }
-    Y_data = temp_output.data();
-  } else {
-    Y_data = reinterpret_cast<std::complex<T>*>(Y->MutableDataRaw()) + (batch_idx * number_of_samples);
   }
 
-  auto angular_velocity = compute_angular_velocity<T>(number_of_samples, inverse);
+ private:
+  struct Stage {
+    size_t radix;
+    size_t stride;  // length of each sub-transform combined by the stage
+  };
 
-  // Create vandermonde matrix V ordered with the bit-reversed permutation
-  if (V.size() != number_of_samples) {
-    V = std::vector<std::complex<T>>(number_of_samples);  // e^(i *2*pi / N * k)
-    for (size_t i = 0; i < number_of_samples; i++) {
-      size_t bit_reversed_index = bit_reverse(i, significant_bits);
-      V[bit_reversed_index] = std::complex<T>(cos(i * angular_velocity), sin(i * angular_velocity));
+  static std::complex<T> unit_phasor(double turns_times_two) {
+    const double angle = 3.14159265358979323846 * turns_times_two;
+    return std::complex<T>(static_cast<T>(std::cos(angle)), static_cast<T>(std::sin(angle)));
+  }
+
+  void initialize_bluestein() {
+    size_t convolution_size = 1;
+    while (convolution_size < 2 * number_of_samples_ - 1) {
+      convolution_size <<= 1;
+    }
+    bluestein_plan_ = onnxruntime::make_unique<FftPlan<T>>(convolution_size, false);
+
+    // chirp[k] = e^(-i*pi*k^2/N), with k^2 reduced modulo 2N to keep the angle
+    // exact for long signals.
+    chirp_.resize(number_of_samples_);
+    for (size_t k = 0; k < number_of_samples_; k++) {
+      const size_t k_squared = static_cast<size_t>((static_cast<uint64_t>(k) * k) % (2 * number_of_samples_));
+      chirp_[k] = unit_phasor(-static_cast<double>(k_squared) / static_cast<double>(number_of_samples_));
+    }
+
+    // The transform of the conjugate chirp, wrapped around for negative
+    // indices, and scaled by 1/M for the inverse transform of the product.
+    std::vector<std::complex<T>> filter(convolution_size);
+    filter[0] = std::conj(chirp_[0]);
+    for (size_t k = 1; k < number_of_samples_; k++) {
+      filter[k] = std::conj(chirp_[k]);
+      filter[convolution_size - k] = std::conj(chirp_[k]);
+    }
+
+    chirp_filter_.resize(convolution_size);
+    bluestein_plan_->Forward(filter.data(), chirp_filter_.data(), nullptr);
+
+    const T scale = static_cast<T>(1) / static_cast<T>(convolution_size);
+    for (auto& value : chirp_filter_) {
+      value *= scale;
     }
   }
 
-  for (size_t i = 0; i < number_of_samples; i++) {
-    size_t bit_reversed_index = bit_reverse(i, significant_bits);
-    auto x = *(X_data + bit_reversed_index);
-    auto window_element = window_data ? *(window_data + bit_reversed_index) : 1; 
-    *(Y_data + i) = std::complex<T>(1, 0) * x * window_element;
+  void bluestein(const std::complex<T>* input, std::complex<T>* output, std::complex<T>* scratch) const {
+    const size_t convolution_size = bluestein_plan_->Size();
+    std::complex<T>* a = scratch;
+    std::complex<T>* b = scratch + convolution_size;
+
+    for (size_t k = 0; k < number_of_samples_; k++) {
+      a[k] = complex_multiply(input[k], chirp_[k]);
+    }
+    std::fill(a + number_of_samples_, a + convolution_size, std::complex<T>());
+
+    bluestein_plan_->Forward(a, b, nullptr);
+
+    // The inverse transform is computed as the conjugate of the forward
+    // transform of the conjugate.
+    for (size_t k = 0; k < convolution_size; k++) {
+      b[k] = std::conj(complex_multiply(b[k], chirp_filter_[k]));
+    }
+
+    bluestein_plan_->Forward(b, a, nullptr);
+
+    for (size_t k = 0; k < number_of_samples_; k++) {
+      output[k] = complex_multiply(std::conj(a[k]), chirp_[k]);
+    }
   }
 
-  // Run fft_radix2
-  unsigned current_significant_bits = 0;
-  for (size_t i = 2; i <= number_of_samples; i <<= 1) {
-    size_t midpoint = i >> 1;
-    current_significant_bits++;
-
-    for (size_t k = 0; k < midpoint; k++) {
-      auto first_idx = bit_reverse(k, current_significant_bits);
-      auto second_idx = bit_reverse(midpoint + k, current_significant_bits);
-      for (size_t j = 0; j < number_of_samples; j += i) {
-        std::complex<T>* even = (Y_data + j) + k;
-        std::complex<T>* odd = (Y_data + j) + (midpoint + k);
-        std::complex<T> first = *even + (V[first_idx] * *odd);
-        std::complex<T> second = *even + (V[second_idx] * *odd);
-        *even = first;
-        *odd = second;
+  // Computes the sub-transform for the given stage from every input_stride'th
+  // input element, writing radix * stride contiguous output elements.
+  void transform(const std::complex<T>* input, std::complex<T>* output, size_t input_stride, size_t stage_index) const {
+    const size_t radix = stages_[stage_index].radix;
+    const size_t stride = stages_[stage_index].stride;
+
+    if (stride == 1) {
+      for (size_t q = 0; q < radix; q++) {
+        output[q] = input[q * input_stride];
       }
+    } else {
+      for (size_t q = 0; q < radix; q++) {
+        transform(input + q * input_stride, output + q * stride, input_stride * radix, stage_index + 1);
+      }
+    }
+
+    switch (radix) {
+      case 2:
+        butterfly2(output, input_stride, stride);
+        break;
+      case 3:
+        butterfly3(output, input_stride, stride);
+        break;
+      case 4:
+        butterfly4(output, input_stride, stride);
+        break;
+      default:
+        butterfly5(output, input_stride, stride);
+        break;
     }
   }
 
-  // Scale the output if inverse
-  if (inverse) {
-    for (size_t i = 0; i < number_of_samples; i++) {
-      std::complex<T>& val = *(Y_data + i);
-      val /= static_cast<T>(number_of_samples);
+  void butterfly2(std::complex<T>* output, size_t twiddle_stride, size_t stride) const {
+    for (size_t k = 0; k < stride; k++) {
+      const std::complex<T> t = complex_multiply(output[stride + k], twiddles_[k * twiddle_stride]);
+      output[stride + k] = output[k] - t;
+      output[k] += t;
     }
   }
 
-  if (is_onesided) {
-    const auto& Y_shape = Y->Shape();
-    size_t fft_output_size = static_cast<size_t>(Y_shape[1]);
-    auto destination = reinterpret_cast<std::complex<T>*>(Y->MutableDataRaw()) + (batch_idx * fft_output_size);
-    memcpy(destination, Y_data, sizeof(std::complex<T>) * fft_output_size);
+  void butterfly3(std::complex<T>* output, size_t twiddle_stride, size_t stride) const {
+    const T sin_third = twiddles_[twiddle_stride * stride].imag();
+
+    for (size_t k = 0; k < stride; k++) {
+      const std::complex<T> t1 = complex_multiply(output[stride + k], twiddles_[k * twiddle_stride]);
+      const std::complex<T> t2 = complex_multiply(output[2 * stride + k], twiddles_[2 * k * twiddle_stride]);
+      const std::complex<T> sum = t1 + t2;
+      const std::complex<T> difference = (t1 - t2) * sin_third;
+      const std::complex<T> center = output[k] - sum * static_cast<T>(0.5);
+
+      output[k] += sum;
+      output[stride + k] = std::complex<T>(center.real() - difference.imag(), center.imag() + difference.real());
+      output[2 * stride + k] = std::complex<T>(center.real() + difference.imag(), center.imag() - difference.real());
+    }
   }
 
-  return Status::OK();
-}
+  void butterfly4(std::complex<T>* output, size_t twiddle_stride, size_t stride) const {
+    for (size_t k = 0; k < stride; k++) {
+      const std::complex<T> t0 = output[k];
+      const std::complex<T> t1 = complex_multiply(output[stride + k], twiddles_[k * twiddle_stride]);
+      const std::complex<T> t2 = complex_multiply(output[2 * stride + k], twiddles_[2 * k * twiddle_stride]);
+      const std::complex<T> t3 = complex_multiply(output[3 * stride + k], twiddles_[3 * k * twiddle_stride]);
+
+      const std::complex<T> sum02 = t0 + t2;
+      const std::complex<T> difference02 = t0 - t2;
+      const std::complex<T> sum13 = t1 + t3;
+      const std::complex<T> difference13 = multiply_by_minus_i(t1 - t3);
+
+      output[k] = sum02 + sum13;
+      output[stride + k] = difference02 + difference13;
+      output[2 * stride + k] = sum02 - sum13;
+      output[3 * stride + k] = difference02 - difference13;
+    }
+  }
 
-template <typename T, typename U>
-static Status dft_naive(size_t batch_idx, const Tensor* X, Tensor* Y, const Tensor* window, bool inverse) {
-  // Get shape and significant bits
-  const auto& X_shape = X->Shape();
-  size_t number_of_samples = static_cast<size_t>(X_shape[1]);
-  const auto& Y_shape = Y->Shape();
-  size_t dft_output_size = static_cast<size_t>(Y_shape[1]);
+  void butterfly5(std::complex<T>* output, size_t twiddle_stride, size_t stride) const {
+    const std::complex<T> ya = twiddles_[twiddle_stride * stride];
+    const std::complex<T> yb = twiddles_[2 * twiddle_stride * stride];
+
+    for (size_t k = 0; k < stride; k++) {
+      const std::complex<T> t0 = output[k];
+      const std::complex<T> t1 = complex_multiply(output[stride + k], twiddles_[k * twiddle_stride]);
+      const std::complex<T> t2 = complex_multiply(output[2 * stride + k], twiddles_[2 * k * twiddle_stride]);
+      const std::complex<T> t3 = complex_multiply(output[3 * stride + k], twiddles_[3 * k * twiddle_stride]);
+      const std::complex<T> t4 = complex_multiply(output[4 * stride + k], twiddles_[4 * k * twiddle_stride]);
+
+      const std::complex<T> sum14 = t1 + t4;
+      const std::complex<T> difference14 = t1 - t4;
+      const std::complex<T> sum23 = t2 + t3;
+      const std::complex<T> difference23 = t2 - t3;
+
+      output[k] = t0 + sum14 + sum23;
+
+      const std::complex<T> a = t0 + sum14 * ya.real() + sum23 * yb.real();
+      const std::complex<T> b(difference14.imag() * ya.imag() + difference23.imag() * yb.imag(),
+                              -difference14.real() * ya.imag() - difference23.real() * yb.imag());
+      output[stride + k] = a - b;
+      output[4 * stride + k] = a + b;
+
+      const std::complex<T> c = t0 + sum14 * yb.real() + sum23 * ya.real();
+      const std::complex<T> d(-difference14.imag() * yb.imag() + difference23.imag() * ya.imag(),
+                              difference14.real() * yb.imag() - difference23.real() * ya.imag());
+      output[2 * stride + k] = c + d;
+      output[3 * stride + k] = c - d;
+    }
+  }
 
-  // Get data
-  auto* X_data = const_cast<U*>(reinterpret_cast<const U*>(X->DataRaw())) + (batch_idx * number_of_samples);
-  auto* Y_data = reinterpret_cast<std::complex<T>*>(Y->MutableDataRaw()) + (batch_idx * dft_output_size);
-  
-  U* window_data = nullptr;
-  if (window) {
-    window_data = const_cast<U*>(reinterpret_cast<const U*>(window->DataRaw()));
+  size_t number_of_samples_;
+  std::vector<Stage> stages_;
+  std::vector<std::complex<T>> twiddles_;  // e^(-2*pi*i*k/N)
+
+  std::unique_ptr<FftPlan<T>> half_plan_;
+
+  std::unique_ptr<FftPlan<T>> bluestein_plan_;
+  std::vector<std::complex<T>> chirp_;
+  std::vector<std::complex<T>> chirp_filter_;
+};
+
+// Returns the shared plan for the given number of samples. Plans are built
+// once per length and reused by every DFT, IDFT and STFT node.
+template <typename T>
+static std::shared_ptr<const FftPlan<T>> get_fft_plan(size_t number_of_samples) {
+  // Bound the cache for models that transform many distinct lengths.
+  constexpr size_t max_cached_plans = 64;
+
+  static OrtMutex mutex;
+  static std::unordered_map<size_t, std::shared_ptr<const FftPlan<T>>> plans;
+
+  std::lock_guard<OrtMutex> lock(mutex);
+  auto it = plans.find(number_of_samples);
+  if (it != plans.end()) {
+    return it->second;
   }
 
-  auto angular_velocity = compute_angular_velocity<T>(number_of_samples, inverse);
+  if (plans.size() >= max_cached_plans) {
+    plans.clear();
+  }
 
-  for (size_t i = 0; i < dft_output_size; i++) {
-    std::complex<T>& out = *(Y_data + i);
-    out.real(0);
-    out.imag(0);
+  auto plan = std::make_shared<const FftPlan<T>>(number_of_samples, true);
+  plans.emplace(number_of_samples, plan);
+  return plan;
+}
 
-    for (size_t j = 0; j < number_of_samples; j++) {  // vectorize over this loop
-      auto exponential = std::complex<T>(cos(i * j * angular_velocity), sin(i * j * angular_velocity));
-      auto window_element = window_data ? * (window_data + j) : 1;
-      auto element = *(X_data + j) * window_element;
-      out += exponential * element;
-    }
+// Per-thread buffers used to transform a frame.
+template <typename T>
+struct FftWorkspace {
+  std::vector<std::complex<T>> frame;
+  std::vector<std::complex<T>> spectrum;
+  std::vector<std::complex<T>> scratch;
+};
+
+// Transforms the complex frame held in the workspace and writes the first
+// output_size values of the spectrum.
+template <typename T>
+static void transform_complex_frame(const FftPlan<T>& plan, std::complex<T>* output, size_t output_size,
+                                    FftWorkspace<T>& workspace) {
+  workspace.scratch.resize(plan.ScratchSize());
+
+  if (output_size == plan.Size()) {
+    plan.Forward(workspace.frame.data(), output, workspace.scratch.data());
+  } else {
+    workspace.spectrum.resize(plan.Size());
+    plan.Forward(workspace.frame.data(), workspace.spectrum.data(), workspace.scratch.data());
+    std::copy(workspace.spectrum.data(), workspace.spectrum.data() + output_size, output);
+  }
+}
 
-    if (inverse) {
-      out /= static_cast<T>(number_of_samples);
+template <typename T>
+static void transform_frame(const FftPlan<T>& plan, const T* input, const T* window, bool /*inverse*/,
+                            std::complex<T>* output, size_t output_size, FftWorkspace<T>& workspace) {
+  const size_t number_of_samples = plan.Size();
+
+  if (plan.SupportsRealInput()) {
+    workspace.scratch.resize(plan.RealScratchSize());
+    plan.ForwardReal(input, window, output, workspace.scratch.data());
+
+    // The remaining values follow from the conjugate symmetry of the spectrum
+    // of a real signal.
+    for (size_t k = (number_of_samples >> 1) + 1; k < output_size; k++) {
+      output[k] = std::conj(output[number_of_samples - k]);
     }
+    return;
   }
 
-  return Status::OK();
+  workspace.frame.resize(number_of_samples);
+  for (size_t i = 0; i < number_of_samples; i++) {
+    workspace.frame[i] = std::complex<T>(window ? input[i] * window[i] : input[i], 0);
+  }
+
+  transform_complex_frame(plan, output, output_size, workspace);
+}
+
+template <typename T>
+static void transform_frame(const FftPlan<T>& plan, const std::complex<T>* input, const T* window, bool inverse,
+                            std::complex<T>* output, size_t output_size, FftWorkspace<T>& workspace) {
+  const size_t number_of_samples = plan.Size();
+
+  // The input is always copied as the output may share its buffer. The
+  // inverse transform is computed from the forward transform of the conjugate.
+  workspace.frame.resize(number_of_samples);
+  for (size_t i = 0; i < number_of_samples; i++) {
+    const std::complex<T> value = window ? input[i] * window[i] : input[i];
+    workspace.frame[i] = inverse ? std::conj(value) : value;
+  }
+
+  transform_complex_frame(plan, output, output_size, workspace);
+}
+
+// Transforms frame_count frames of frame_length samples from each of
+// batch_count batches. Frames of a batch start frame_step samples apart and
+// batches start batch_stride samples apart, so the STFT frames are read in
+// place from the signal. The frames are distributed over the thread pool.
+template <typename T, typename U>
+static void fourier_transform_frames(concurrency::ThreadPool* thread_pool, const U* input,
+                                     size_t batch_count, size_t batch_stride,
+                                     size_t frame_count, size_t frame_step, size_t frame_length,
+                                     const T* window, bool inverse,
+                                     std::complex<T>* output, size_t output_size) {
+  const size_t total_frames = batch_count * frame_count;
+
+  if (frame_length == 0) {
+    std::fill(output, output + total_frames * output_size, std::complex<T>());
+    return;
+  }
+
+  const auto plan = get_fft_plan<T>(frame_length);
+
+  const double compute_cycles = 5.0 * static_cast<double>(frame_length) * std::log2(static_cast<double>(frame_length) + 1);
+  const TensorOpCost cost{static_cast<double>(frame_length * sizeof(U)),
+                          static_cast<double>(output_size * sizeof(std::complex<T>)),
+                          compute_cycles};
+
+  concurrency::ThreadPool::TryParallelFor(
+      thread_pool, static_cast<std::ptrdiff_t>(total_frames), cost,
+      [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+        FftWorkspace<T> workspace;
+
+        for (std::ptrdiff_t frame = first; frame < last; frame++) {
+          const size_t batch_idx = static_cast<size_t>(frame) / frame_count;
+          const size_t frame_idx = static_cast<size_t>(frame) % frame_count;
+          const U* frame_input = input + batch_idx * batch_stride + frame_idx * frame_step;
+          std::complex<T>* frame_output = output + static_cast<size_t>(frame) * output_size;
+
+          transform_frame(*plan, frame_input, window, inverse, frame_output, output_size, workspace);
+
+          if (inverse) {
+            const T scale = static_cast<T>(1) / static_cast<T>(frame_length);
+            for (size_t k = 0; k < output_size; k++) {
+              frame_output[k] = std::conj(frame_output[k]) * scale;
+            }
+          }
+        }
+      });
 }
 
 template <typename T, typename U>
-static Status discrete_fourier_transform(OpKernelContext* ctx, const Tensor* X, Tensor* Y, const Tensor* window, bool is_onesided, bool inverse,
-                                         std::vector<std::complex<T>>& V, std::vector<std::complex<T>>& temp_output) {
+static Status discrete_fourier_transform(OpKernelContext* ctx, const Tensor* X, Tensor* Y, bool inverse) {
   // Get shape
   const auto& X_shape = X->Shape();
   size_t number_of_batches = static_cast<size_t>(X_shape[0]);
   size_t number_of_samples = static_cast<size_t>(X_shape[1]);
-   
-  // radix 2 fft
-  for (size_t i = 0; i < number_of_batches; i++) {
-    if (is_power_of_2(number_of_samples)) {
-      ORT_RETURN_IF_ERROR((fft_radix2<T, U>(ctx, i, X, Y, window, is_onesided, inverse, V, temp_output)));
-    } else {
-      ORT_RETURN_IF_ERROR((dft_naive<T, U>(i, X, Y, window, inverse)));
-    }
-  }
+  size_t dft_output_size = static_cast<size_t>(Y->Shape()[1]);
+
+  const auto* X_data = reinterpret_cast<const U*>(X->DataRaw());
+  auto* Y_data = reinterpret_cast<std::complex<T>*>(Y->MutableDataRaw());
+
+  fourier_transform_frames<T, U>(ctx->GetOperatorThreadPool(), X_data,
+                                 number_of_batches, number_of_samples,
+                                 1, 0, number_of_samples,
+                                 nullptr, inverse, Y_data, dft_output_size);
 
   return Status::OK();
 }
@@ -308,22 +525,18 @@ static Status discrete_fourier_transform(OpKernelContext* ctx, bool is_onesided,
 
   auto element_size = data_type->Size();
   if (element_size == sizeof(float)) {
-    std::vector<std::complex<float>> V;
-    std::vector<std::complex<float>> temp_output;
     if (is_real_valued) {
-      ORT_RETURN_IF_ERROR((discrete_fourier_transform<float, float>(ctx, X, Y, nullptr, is_onesided, inverse, V, temp_output)));
+      ORT_RETURN_IF_ERROR((discrete_fourier_transform<float, float>(ctx, X, Y, inverse)));
     } else if (is_complex_valued) {
-      ORT_RETURN_IF_ERROR((discrete_fourier_transform<float, std::complex<float>>(ctx, X, Y, nullptr, is_onesided, inverse, V, temp_output)));
+      ORT_RETURN_IF_ERROR((discrete_fourier_transform<float, std::complex<float>>(ctx, X, Y, inverse)));
     } else {
         ORT_THROW("Unsupported input signal shape. The signal's first dimenstion must be the batch dimension and its second dimension must be the signal length dimension. It may optionally include a 3rd dimension of size 2 for complex inputs.", data_type);
     }
   } else if (element_size == sizeof(double)) {
-    std::vector<std::complex<double>> V;
-    std::vector<std::complex<double>> temp_output;
     if (is_real_valued) {
-      ORT_RETURN_IF_ERROR((discrete_fourier_transform<double, double>(ctx, X, Y, nullptr, is_onesided, inverse, V, temp_output)));
+      ORT_RETURN_IF_ERROR((discrete_fourier_transform<double, double>(ctx, X, Y, inverse)));
     } else if (is_complex_valued) {
-      ORT_RETURN_IF_ERROR((discrete_fourier_transform<double, std::complex<double>>(ctx, X, Y, nullptr, is_onesided, inverse, V, temp_output)));
+      ORT_RETURN_IF_ERROR((discrete_fourier_transform<double, std::complex<double>>(ctx, X, Y, inverse)));
     } else {
       ORT_THROW("Unsupported input signal shape. The signal's first dimenstion must be the batch dimension and its second dimension must be the signal length dimension. It may optionally include a 3rd dimension of size 2 for complex inputs.", data_type);
     }
@@ -423,53 +636,17 @@ static Status short_time_fourier_transform(OpKernelContext* ctx, bool is_oneside
   // Get/create the output mutable data
   auto output_spectra_shape = onnxruntime::TensorShape({batch_size, n_dfts, dft_output_size, 2});
   auto Y = ctx->Output(0, output_spectra_shape);
-  auto Y_data = reinterpret_cast<T*>(Y->MutableDataRaw());
-
-  // Get/create the signal mutable data
-  auto* signal_data = const_cast<U*>(reinterpret_cast<const U*>(signal->DataRaw()));
-
-  // Define tensor shapes for each dft run
-  const int64_t output_components = 2;
-  auto dft_input_shape = onnxruntime::TensorShape({1, window_size, signal_components});
-  auto dft_output_shape = onnxruntime::TensorShape({1, dft_output_size, output_components});
-
-  std::vector<std::complex<T>> V;
-  std::vector<std::complex<T>> temp_output;
-
-  // Run each dft of each batch as if it was a real-valued batch size 1 dft operation
-  for (int64_t batch_idx = 0; batch_idx < batch_size; batch_idx++) {
-    for (int64_t i = 0; i < n_dfts; i++) {
-      auto input_frame_begin =
-        signal_data +
-        (batch_idx * signal_size * signal_components) +
-        (i * frame_step * signal_components);
-
-      auto output_frame_begin =
-        Y_data +
-        (batch_idx * n_dfts * dft_output_size * output_components) +
-        (i * dft_output_size * output_components);
-
-      // Tensors do not own the backing memory, so no worries on destruction
-      auto input =
-          onnxruntime::Tensor(
-              signal->DataType(),
-              dft_input_shape,
-              input_frame_begin,
-              signal->Location(),
-              0);
-
-      auto output =
-          onnxruntime::Tensor(
-              Y->DataType(),
-              dft_output_shape,
-              output_frame_begin,
-              Y->Location(),
-              0);
-
-      // Run individual dft
-      ORT_RETURN_IF_ERROR((discrete_fourier_transform<T, U>(ctx, &input, &output, window, is_onesided, false, V, temp_output)));
-    }
-  }
+  auto* Y_data = reinterpret_cast<std::complex<T>*>(Y->MutableDataRaw());
+
+  const auto* signal_data = reinterpret_cast<const U*>(signal->DataRaw());
+  const auto* window_data = window ? reinterpret_cast<const T*>(window->DataRaw()) : nullptr;
+
+  // Transform each frame directly from the signal
+  fourier_transform_frames<T, U>(ctx->GetOperatorThreadPool(), signal_data,
+                                 static_cast<size_t>(batch_size), static_cast<size_t>(signal_size),
+                                 static_cast<size_t>(n_dfts), static_cast<size_t>(frame_step),
+                                 static_cast<size_t>(window_size),
+                                 window_data, false, Y_data, static_cast<size_t>(dft_output_size));
 
   return Status::OK();
 }
@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 
 #include "core/framework/tensor.h"
+#include "core/mlas/inc/mlas.h"
 #include "core/util/math_cpuonly.h"
 #include "core/providers/common.h"
 #include "core/platform/threadpool.h"
@@ -24,6 +25,50 @@ namespace contrib {
 REGISTER_KERNEL_TYPED(float)
 REGISTER_KERNEL_TYPED(double)
 
+namespace {
+
+template <typename T>
+void ComputeJob(const T* input_data, const T* skip_data, const T* gamma_data, const T* beta_data, const T* bias_data,
+                ptrdiff_t task_idx, int64_t hidden_size, float epsilon, T* output_data) {
+  const T* p_input = input_data + task_idx * hidden_size;
+  const T* p_skip = skip_data + task_idx * hidden_size;
+  T* p_output = output_data + task_idx * hidden_size;
+
+  T mean = 0;
+  T mean_square = 0;
+
+  for (int64_t h = 0; h < hidden_size; h++) {
+    T value = p_input[h] + p_skip[h];
+    if (nullptr != bias_data) {
+      value += bias_data[h];
+    }
+    p_output[h] = value;
+    mean += value;
+    mean_square += value * value;
+  }
+
+  mean = mean / hidden_size;
+  mean_square = sqrt(mean_square / hidden_size - mean * mean + epsilon);
+
+  for (int64_t h = 0; h < hidden_size; h++) {
+    if (nullptr == beta_data) {
+      p_output[h] = (p_output[h] - mean) / mean_square * gamma_data[h];
+    } else {
+      p_output[h] = (p_output[h] - mean) / mean_square * gamma_data[h] + beta_data[h];
+    }
+  }
+}
+
+// The float kernel fuses the skip and bias additions into the SIMD statistics pass.
+void ComputeJob(const float* input_data, const float* skip_data, const float* gamma_data, const float* beta_data,
+                const float* bias_data, ptrdiff_t task_idx, int64_t hidden_size, float epsilon, float* output_data) {
+  MlasComputeLayerNormalization(input_data + task_idx * hidden_size, skip_data + task_idx * hidden_size, bias_data,
+                                gamma_data, beta_data, output_data + task_idx * hidden_size,
+                                static_cast<size_t>(hidden_size), epsilon, false, nullptr, nullptr);
+}
+
+}  // namespace
+
 template <typename T>
 SkipLayerNorm<T>::SkipLayerNorm(const OpKernelInfo& op_kernel_info)
     : OpKernel(op_kernel_info) {
@@ -100,33 +145,8 @@ Status SkipLayerNorm<T>::Compute(OpKernelContext* p_ctx) const {
 
   concurrency::ThreadPool::TryBatchParallelFor(p_ctx->GetOperatorThreadPool(), static_cast<int32_t>(task_count),
                                                [&](ptrdiff_t task_idx) {
-                                                 const T* p_input = input_data + task_idx * hidden_size;
-                                                 const T* p_skip = skip_data + task_idx * hidden_size;
-                                                 T* p_output = output_data + task_idx * hidden_size;
-
-                                                 T mean = 0;
-                                                 T mean_square = 0;
-
-                                                 for (int64_t h = 0; h < hidden_size; h++) {
-                                                   T value = p_input[h] + p_skip[h];
-                                                   if (nullptr != bias_data) {
-                                                     value += bias_data[h];
-                                                   }
-                                                   p_output[h] = value;
-                                                   mean += value;
-                                                   mean_square += value * value;
-                                                 }
-
-                                                 mean = mean / hidden_size;
-                                                 mean_square = sqrt(mean_square / hidden_size - mean * mean + epsilon_);
-
-                                                 for (int64_t h = 0; h < hidden_size; h++) {
-                                                   if (nullptr == beta_data) {
-                                                     p_output[h] = (p_output[h] - mean) / mean_square * gamma_data[h];
-                                                   } else {
-                                                     p_output[h] = (p_output[h] - mean) / mean_square * gamma_data[h] + beta_data[h];
-                                                   }
-                                                 }
+                                                 ComputeJob(input_data, skip_data, gamma_data, beta_data, bias_data,
+                                                            task_idx, hidden_size, epsilon_, output_data);
                                                }, 0);
 
   return Status::OK();
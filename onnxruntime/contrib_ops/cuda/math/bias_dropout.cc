@@ -74,7 +74,7 @@ Status BiasDropout::ComputeInternal(OpKernelContext* context) const {
     return Status(common::ONNXRUNTIME, common::FAIL, "Bias input is not a 1D tensor.");
   }
   const int64_t dim = bias_shape[0];
-  if (dim != x_shape.GetDims().back()) {
+  if (dim != x_shape[x_shape.NumDimensions() - 1]) {
     return Status(common::ONNXRUNTIME, common::FAIL, "Bias' dimension doesn't match input's last dimension.");
   }
 
@@ -168,12 +168,16 @@ Status QAttention<T, int8_t>::ComputeInternal(OpKernelContext* context) const {
 
   size_t workSpaceSize = GetAttentionWorkspaceSize(element_size, batch_size, num_heads_, head_size, sequence_length, past_sequence_length);
   auto temp_buffer = GetScratchBuffer<void>(workSpaceSize);
+  std::vector<int64_t> mask_index_dims;
+  if (nullptr != mask_index) {
+    mask_index_dims = mask_index->Shape().GetDimsAsVector();
+  }
   if (!LaunchAttentionKernel(
           GetDeviceProp(),
           Stream(),
           reinterpret_cast<const CudaT*>(gemm_buffer.get()),
           nullptr == mask_index ? nullptr : mask_index->template Data<int>(),
-          nullptr == mask_index ? nullptr : &(mask_index->Shape().GetDims()),
+          nullptr == mask_index ? nullptr : &mask_index_dims,
           output->template MutableData<T>(),
           batch_size,
           sequence_length,
@@ -90,7 +90,7 @@ std::vector<int64_t> WeightLayoutTiling2D::ToActualShape(const Tensor* X) const
   int pad_row = vector_width_ / X->DataType()->Size();
   int pad_col = vector_width_ / sizeof(int32_t);
 
-  auto old_shape = X->Shape().GetDims();
+  auto old_shape = X->Shape().GetDimsAsVector();
   auto new_shape0 = (old_shape[1] + pad_col - 1) / pad_col * pad_col;
   auto new_shape1 = ((old_shape[0] + pad_row - 1) / pad_row) * pad_row;
 
@@ -61,7 +61,7 @@ tvm::Array<tvm::Expr> WeightLayoutVerticalStripe2D::ToActualShape(const tvm::Ten
 
 std::vector<int64_t> WeightLayoutVerticalStripe2D::ToActualShape(const Tensor* X) const {
   ORT_ENFORCE(X != nullptr);
-  auto old_shape = X->Shape().GetDims();
+  auto old_shape = X->Shape().GetDimsAsVector();
 
   ORT_ENFORCE(old_shape.size() == 2);
 
@@ -13,7 +13,10 @@ See the License for the specific language governing permissions and
 limitations under the License.
 ==============================================================================*/
 
+#include <atomic>
+#include <limits>
 #include <memory>
+#include <set>
 
 #include "core/platform/threadpool.h"
 #include "core/common/common.h"
@@ -366,12 +369,81 @@ class alignas(CACHE_LINE_BYTES) LoopCounter {
 #pragma warning(pop) /* Padding added in LoopCounterShard, LoopCounter */
 #endif
 
+// The request scheduler tracks the parallel loops running in a pool on behalf of requests, so that helper threads
+// can give way to loops of more urgent requests.  Each loop has a rank, with lower ranks being more urgent.  The
+// priority is held in the top bits of the rank, and the deadline, in microseconds of the steady clock, in the
+// remaining bits.
+//
+// Most requests use the default priority and no deadline.  Loops of such requests, and loops run outside any
+// request, are only counted.  Other loops are kept in an ordered set, which is guarded by a mutex.
+
+static constexpr int kRankDeadlineBits = 56;
+static constexpr uint64_t kRankNoDeadline = (uint64_t{1} << kRankDeadlineBits) - 1;
+
+static constexpr uint64_t GetPriorityRank(ThreadPool::RequestPriority priority) {
+  return (static_cast<uint64_t>(ThreadPool::RequestPriority::High) - static_cast<uint64_t>(priority))
+         << kRankDeadlineBits;
+}
+
+static constexpr uint64_t kDefaultRank = GetPriorityRank(ThreadPool::RequestPriority::Normal) | kRankNoDeadline;
+
+class RequestScheduler {
+ public:
+  static uint64_t GetRank(const ThreadPool::RequestContext* request) {
+    if (request == nullptr) {
+      return kDefaultRank;
+    }
+
+    uint64_t deadline = kRankNoDeadline;
+    if (request->HasDeadline()) {
+      auto since_epoch = std::chrono::duration_cast<std::chrono::microseconds>(request->deadline.time_since_epoch());
+      deadline = std::min<uint64_t>(static_cast<uint64_t>(std::max<int64_t>(since_epoch.count(), 0)),
+                                    kRankNoDeadline - 1);
+    }
+    return GetPriorityRank(request->priority) | deadline;
+  }
+
+  void StartLoop(uint64_t rank) {
+    if (rank == kDefaultRank) {
+      default_loops_.fetch_add(1, std::memory_order_relaxed);
+    } else {
+      std::lock_guard<OrtMutex> lock(mutex_);
+      ranks_.insert(rank);
+      most_urgent_rank_.store(*ranks_.begin(), std::memory_order_relaxed);
+    }
+  }
+
+  void EndLoop(uint64_t rank) {
+    if (rank == kDefaultRank) {
+      default_loops_.fetch_sub(1, std::memory_order_relaxed);
+    } else {
+      std::lock_guard<OrtMutex> lock(mutex_);
+      ranks_.erase(ranks_.find(rank));
+      most_urgent_rank_.store(ranks_.empty() ? std::numeric_limits<uint64_t>::max() : *ranks_.begin(),
+                              std::memory_order_relaxed);
+    }
+  }
+
+  // Returns true if a loop of a request more urgent than the given rank is running.
+  bool HasMoreUrgentLoop(uint64_t rank) const {
+    return most_urgent_rank_.load(std::memory_order_relaxed) < rank ||
+           (rank > kDefaultRank && default_loops_.load(std::memory_order_relaxed) > 0);
+  }
+
+ private:
+  OrtMutex mutex_;
+  std::multiset<uint64_t> ranks_;
+  std::atomic<uint64_t> most_urgent_rank_{std::numeric_limits<uint64_t>::max()};
+  std::atomic<int> default_loops_{0};
+};
+
 ThreadPool::ThreadPool(Env* env,
                        const ThreadOptions& thread_options,
                        const NAME_CHAR_TYPE* name,
                        int degree_of_parallelism,
                        bool low_latency_hint)
-    : thread_options_(thread_options) {
+    : thread_options_(thread_options),
+      request_scheduler_(onnxruntime::make_unique<RequestScheduler>()) {
   // In the current implementation, a thread pool with degree_of_parallelism==1 uses
   // the caller as one of the threads for executing work.  Hence we only create
   // additional thread(s) for degree_of_parallelism>=2.
@@ -411,14 +483,49 @@ void ThreadPool::ParallelForFixedBlockSizeScheduling(const std::ptrdiff_t total,
   int num_work_items = static_cast<int>(std::min(static_cast<std::ptrdiff_t>(d_of_p), num_blocks));
   assert(num_work_items > 0);
 
+  // Helper threads give way to loops of more urgent requests, and stop claiming iterations once the
+  // request is cancelled.  The current thread (idx 0) always runs the loop to completion, so callers
+  // never see a partially run loop.
+  const RequestContext* request = current_request;
+  const uint64_t rank = RequestScheduler::GetRank(request);
+  request_scheduler_->StartLoop(rank);
+  struct LoopRegistration {
+    ~LoopRegistration() { scheduler.EndLoop(rank); }
+    RequestScheduler& scheduler;
+    uint64_t rank;
+  } registration{*request_scheduler_, rank};
+
   LoopCounter lc(total, d_of_p, block_size);
   std::function<void(unsigned)> run_work = [&](unsigned idx) {
+    RequestScope request_scope(request);
+
+    // The current thread's CPU time is accounted for by the caller.
+    RequestAccounting* accounting = (idx != 0 && request != nullptr) ? request->accounting : nullptr;
+    uint64_t cpu_time_start = 0;
+    if (accounting != nullptr && !GetThreadCpuTimeNanos(&cpu_time_start)) {
+      accounting = nullptr;
+    }
+    struct CpuTimeAccumulator {
+      ~CpuTimeAccumulator() {
+        uint64_t cpu_time_end;
+        if (accounting != nullptr && GetThreadCpuTimeNanos(&cpu_time_end) && cpu_time_end > start) {
+          accounting->worker_cpu_time_ns.fetch_add(cpu_time_end - start, std::memory_order_relaxed);
+        }
+      }
+      RequestAccounting* accounting;
+      uint64_t start;
+    } cpu_time_accumulator{accounting, cpu_time_start};
+
     unsigned my_home_shard = lc.GetHomeShard(idx);
     unsigned my_shard = my_home_shard;
     uint64_t my_iter_start, my_iter_end;
     while (lc.ClaimIterations(my_home_shard, my_shard, my_iter_start, my_iter_end)) {
       fn(static_cast<std::ptrdiff_t>(my_iter_start),
          static_cast<std::ptrdiff_t>(my_iter_end));
+      if (idx != 0 && (request_scheduler_->HasMoreUrgentLoop(rank) ||
+                       (request != nullptr && request->IsCancelled()))) {
+        break;
+      }
     }
   };
 
@@ -460,6 +567,26 @@ std::string ThreadPool::StopProfiling() {
 
 thread_local ThreadPool::ParallelSection* ThreadPool::ParallelSection::current_parallel_section{nullptr};
 
+thread_local const ThreadPool::RequestContext* ThreadPool::current_request{nullptr};
+
+static std::atomic<uint64_t> next_request_accounting_id{1};
+
+ThreadPool::RequestAccounting::RequestAccounting()
+    : id(next_request_accounting_id.fetch_add(1, std::memory_order_relaxed)) {
+}
+
+ThreadPool::RequestScope::RequestScope(const RequestContext* request) : previous_(current_request) {
+  current_request = request;
+}
+
+ThreadPool::RequestScope::~RequestScope() {
+  current_request = previous_;
+}
+
+const ThreadPool::RequestContext* ThreadPool::CurrentRequest() {
+  return current_request;
+}
+
 ThreadPool::ParallelSection::ParallelSection(ThreadPool* tp) {
 #ifdef _OPENMP
   // Nothing
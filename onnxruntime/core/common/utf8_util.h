@@ -5,6 +5,8 @@
 
 #include "core/common/common.h"
 
+#include <string>
+
 namespace onnxruntime {
 namespace utf8_util {
 
@@ -142,5 +144,58 @@ inline bool utf8_validate(const unsigned char* s, size_t len, size_t& utf8_chars
   return true;
 }
 
+// Decodes the utf8 character that starts at s[idx] and advances idx past it.
+// The input must have been validated with utf8_validate.
+inline char32_t utf8_decode(const unsigned char* s, size_t& idx) {
+  const unsigned char ch = s[idx];
+  if (ch < 0x80u) {
+    ++idx;
+    return ch;
+  }
+  if ((ch & 0xE0u) == 0xC0u) {
+    const char32_t code_point = ((ch & 0x1Fu) << 6) | (s[idx + 1] & 0x3Fu);
+    idx += 2;
+    return code_point;
+  }
+  if ((ch & 0xF0u) == 0xE0u) {
+    const char32_t code_point = ((ch & 0x0Fu) << 12) | ((s[idx + 1] & 0x3Fu) << 6) | (s[idx + 2] & 0x3Fu);
+    idx += 3;
+    return code_point;
+  }
+  const char32_t code_point = ((ch & 0x07u) << 18) | ((s[idx + 1] & 0x3Fu) << 12) |
+                              ((s[idx + 2] & 0x3Fu) << 6) | (s[idx + 3] & 0x3Fu);
+  idx += 4;
+  return code_point;
+}
+
+// Appends the utf8 encoding of a valid code point
+inline void utf8_append(char32_t code_point, std::string& out) {
+  if (code_point < 0x80u) {
+    out.push_back(static_cast<char>(code_point));
+  } else if (code_point < 0x800u) {
+    out.push_back(static_cast<char>(0xC0u | (code_point >> 6)));
+    out.push_back(static_cast<char>(0x80u | (code_point & 0x3Fu)));
+  } else if (code_point < 0x10000u) {
+    out.push_back(static_cast<char>(0xE0u | (code_point >> 12)));
+    out.push_back(static_cast<char>(0x80u | ((code_point >> 6) & 0x3Fu)));
+    out.push_back(static_cast<char>(0x80u | (code_point & 0x3Fu)));
+  } else {
+    out.push_back(static_cast<char>(0xF0u | (code_point >> 18)));
+    out.push_back(static_cast<char>(0x80u | ((code_point >> 12) & 0x3Fu)));
+    out.push_back(static_cast<char>(0x80u | ((code_point >> 6) & 0x3Fu)));
+    out.push_back(static_cast<char>(0x80u | (code_point & 0x3Fu)));
+  }
+}
+
+// Maps a code point with the simple (one to one) Unicode case mappings,
+// independent of locale.
+char32_t to_upper_code_point(char32_t code_point);
+char32_t to_lower_code_point(char32_t code_point);
+
+// Converts a utf8 string to upper or lower case with the simple Unicode case
+// mappings. Strings that are entirely ASCII take a byte-wise fast path.
+// Returns false if the input is not valid utf8.
+bool utf8_change_case(const std::string& in, bool to_upper, std::string& out);
+
 }  // namespace utf8_util
 }  // namespace onnxruntime
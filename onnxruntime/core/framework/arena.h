@@ -27,6 +27,13 @@ class IArenaAllocator : public IAllocator {
   void Free(void* p) override = 0;
   virtual size_t Used() const = 0;
   virtual size_t Max() const = 0;
+  // Attribute the memory allocated on behalf of the request with the given accounting id
+  // (see concurrency::ThreadPool::RequestAccounting) to it, until EndRequestAccounting is
+  // called. Arenas that do not support this ignore it.
+  virtual void StartRequestAccounting(uint64_t /*request_id*/) {}
+  // Returns the peak number of bytes in use on behalf of the request, and stops
+  // attributing memory to it.
+  virtual size_t EndRequestAccounting(uint64_t /*request_id*/) { return 0; }
   // allocate host pinned memory?
 };
 
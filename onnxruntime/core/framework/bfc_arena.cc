@@ -3,6 +3,7 @@
 
 #include "core/framework/bfc_arena.h"
 #include <type_traits>
+#include "core/platform/threadpool.h"
 
 namespace onnxruntime {
 BFCArena::BFCArena(std::unique_ptr<IAllocator> resource_allocator,
@@ -310,6 +311,24 @@ void BFCArena::GetStats(AllocatorStats* stats) {
   *stats = stats_;
 }
 
+void BFCArena::StartRequestAccounting(uint64_t request_id) {
+  std::lock_guard<OrtMutex> lock(lock_);
+  request_usage_.emplace(request_id, RequestUsage{});
+}
+
+size_t BFCArena::EndRequestAccounting(uint64_t request_id) {
+  std::lock_guard<OrtMutex> lock(lock_);
+  auto usage = request_usage_.find(request_id);
+  if (usage == request_usage_.end()) {
+    return 0;
+  }
+
+  // Chunks still attributed to the request are released from it when freed.
+  const size_t max_bytes_in_use = usage->second.max_bytes_in_use;
+  request_usage_.erase(usage);
+  return max_bytes_in_use;
+}
+
 void* BFCArena::FindChunkPtr(BinNum bin_num, size_t rounded_bytes,
                              size_t num_bytes) {
   // First identify the first bin that could satisfy rounded_bytes.
@@ -349,6 +368,19 @@ void* BFCArena::FindChunkPtr(BinNum bin_num, size_t rounded_bytes,
             std::max(stats_.max_bytes_in_use, stats_.bytes_in_use);
         stats_.max_alloc_size =
             std::max<int64_t>(stats_.max_alloc_size, static_cast<int64_t>(chunk->size));
+        // Attribute the chunk to the current request if it is being accounted for.
+        chunk->request_id = 0;
+        if (!request_usage_.empty()) {
+          const auto* request = concurrency::ThreadPool::CurrentRequest();
+          if (request != nullptr && request->accounting != nullptr) {
+            auto usage = request_usage_.find(request->accounting->id);
+            if (usage != request_usage_.end()) {
+              chunk->request_id = usage->first;
+              usage->second.bytes_in_use += chunk->size;
+              usage->second.max_bytes_in_use = std::max(usage->second.max_bytes_in_use, usage->second.bytes_in_use);
+            }
+          }
+        }
         return chunk->ptr;
       }
     }
@@ -491,6 +523,13 @@ void BFCArena::FreeAndMaybeCoalesce(BFCArena::ChunkHandle h) {
 
   // Updates the stats.
   stats_.bytes_in_use -= c->size;
+  if (c->request_id != 0) {
+    auto usage = request_usage_.find(c->request_id);
+    if (usage != request_usage_.end()) {
+      usage->second.bytes_in_use -= c->size;
+    }
+    c->request_id = 0;
+  }
 
   // This chunk is no longer in-use, consider coalescing the chunk
   // with adjacent chunks.
@@ -90,6 +90,11 @@ class BFCArena : public IArenaAllocator {
 
   void GetStats(AllocatorStats* stats);
 
+  // Memory from Reserve is not attributed to requests.
+  void StartRequestAccounting(uint64_t request_id) override;
+
+  size_t EndRequestAccounting(uint64_t request_id) override;
+
   size_t RequestedSize(const void* ptr);
 
   size_t AllocatedSize(const void* ptr);
@@ -128,6 +133,10 @@ class BFCArena : public IArenaAllocator {
     int64_t allocation_id = -1;
     void* ptr = nullptr;  // pointer to granted subbuffer.
 
+    // Accounting id of the request the chunk was allocated on behalf of,
+    // or 0 if the allocation is not attributed to a request.
+    uint64_t request_id = 0;
+
     // If not kInvalidChunkHandle, the memory referred to by 'prev' is directly
     // preceding the memory used by this chunk.  E.g., It should start
     // at 'ptr - prev->size'
@@ -448,6 +457,13 @@ class BFCArena : public IArenaAllocator {
 
   std::unordered_map<void*, size_t> reserved_chunks_;
 
+  // Memory in use on behalf of the requests being accounted for, by accounting id.
+  struct RequestUsage {
+    size_t bytes_in_use = 0;
+    size_t max_bytes_in_use = 0;
+  };
+  std::unordered_map<uint64_t, RequestUsage> request_usage_;
+
   const int initial_chunk_size_bytes_;
   const int max_dead_bytes_per_chunk_;
 
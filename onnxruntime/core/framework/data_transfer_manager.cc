@@ -2,10 +2,19 @@
 // Licensed under the MIT License.
 
 #include "core/framework/data_transfer_manager.h"
+#include "core/platform/threadpool.h"
 
 namespace onnxruntime {
 using namespace common;
 
+// Counts a copy across devices towards the accounting of the current request, if it has one.
+static void AccountBytesCopied(const Tensor& src, const Tensor& dst) {
+  const auto* request = concurrency::ThreadPool::CurrentRequest();
+  if (request != nullptr && request->accounting != nullptr && src.Location().device != dst.Location().device) {
+    request->accounting->bytes_copied.fetch_add(src.SizeInBytes(), std::memory_order_relaxed);
+  }
+}
+
 Status DataTransferManager::RegisterDataTransfer(std::unique_ptr<IDataTransfer> data_transfer) {
   if (nullptr == data_transfer) {
     return Status(ONNXRUNTIME, INVALID_ARGUMENT, "data_transfer registered is nullptr.");
@@ -39,7 +48,9 @@ Status DataTransferManager::CopyTensor(const Tensor& src, Tensor& dst, int exec_
       continue;
     }
 
-    return data_transfer->CopyTensor(src, dst, exec_queue_id);
+    ORT_RETURN_IF_ERROR(data_transfer->CopyTensor(src, dst, exec_queue_id));
+    AccountBytesCopied(src, dst);
+    return Status::OK();
   }
 
   return ORT_MAKE_STATUS(ONNXRUNTIME,
@@ -84,7 +95,11 @@ common::Status DataTransferManager::CopyTensors(const std::vector<IDataTransfer:
 
   // all copies are between the same devices so we can do them all at once
   if (all_same) {
-    return first_dt->CopyTensors(src_dst_pairs);
+    ORT_RETURN_IF_ERROR(first_dt->CopyTensors(src_dst_pairs));
+    for (const auto& pair : src_dst_pairs) {
+      AccountBytesCopied(pair.src, pair.dst);
+    }
+    return Status::OK();
   }
 
   // there are a mix of devices requiring copies. we don't expect this to happen, so just iterate the pairs
@@ -93,6 +108,7 @@ common::Status DataTransferManager::CopyTensors(const std::vector<IDataTransfer:
 
   // copy the first one as we already did the IDataTransfer lookup
   ORT_RETURN_IF_ERROR(first_dt->CopyTensor(first_pair.src.get(), first_pair.dst.get(), first_pair.exec_queue_id));
+  AccountBytesCopied(first_pair.src, first_pair.dst);
 
   for (auto cur_pair = src_dst_pairs.cbegin() + 1, end_pair = src_dst_pairs.cend(); cur_pair != end_pair; ++cur_pair) {
     ORT_RETURN_IF_ERROR(CopyTensor(cur_pair->src, cur_pair->dst, cur_pair->exec_queue_id));
@@ -224,11 +224,12 @@ bool IExecutionFrame::IsOutput(int ort_value_idx) const {
 ExecutionFrame::ExecutionFrame(const std::vector<int>& feed_mlvalue_idxs, const std::vector<OrtValue>& feeds,
                                const std::vector<int>& fetch_mlvalue_idxs, const std::vector<OrtValue>& fetches,
                                const std::unordered_map<size_t, IExecutor::CustomAllocator>& fetch_allocators,
-                               const SessionState& session_state)
+                               const SessionState& session_state, const StaticShapeReplay* replay)
     : IExecutionFrame(session_state.GetOrtValueNameIdxMap(), session_state.GetNodeIndexInfo(), fetch_mlvalue_idxs),
       session_state_(session_state),
       mem_patterns_(nullptr),
-      planner_(nullptr) {
+      planner_(nullptr),
+      replay_(replay) {
   Init(feed_mlvalue_idxs, feeds, session_state.GetInitializedTensors(), fetches);
 #if !defined(ORT_MINIMAL_BUILD) && defined(ORT_MEMORY_PROFILE)
   MemoryInfo::IncreaseIteration();
@@ -248,8 +249,8 @@ ExecutionFrame::ExecutionFrame(const std::vector<int>& feed_mlvalue_idxs, const
 
   // If the session enable memory pattern optimization
   // and we have execution plan generated, try to setup
-  // memory pattern optimization.
-  if (session_state.GetEnableMemoryPattern() && session_state.GetExecutionPlan()) {
+  // memory pattern optimization. A replayed run takes its intermediate values from the recording instead.
+  if (replay_ == nullptr && session_state.GetEnableMemoryPattern() && session_state.GetExecutionPlan()) {
     std::vector<std::reference_wrapper<const TensorShape>> input_shapes;
     bool all_tensors = true;
     // Reserve mem to avoid re-allocation.
@@ -623,7 +624,57 @@ AllocatorPtr ExecutionFrame::GetAllocatorImpl(const OrtMemoryInfo& info) const {
 // Return S_OK and nullptr if index map to an value that is an unused optional input/output
 Status ExecutionFrame::CreateNodeOutputMLValueImpl(OrtValue& ort_value, int ort_value_idx,
                                                    const TensorShape* shape, size_t nnz) {
-  return AllocateAsPerAllocationPlan(ort_value, ort_value_idx, shape, nnz);
+  if (replay_ && shape) {
+    const OrtValue* recorded = replay_->GetValue(ort_value_idx, *shape);
+    if (recorded) {
+      ort_value = *recorded;
+      return Status::OK();
+    }
+  }
+
+  ORT_RETURN_IF_ERROR(AllocateAsPerAllocationPlan(ort_value, ort_value_idx, shape, nnz));
+  if (recording_) {
+    RecordValue(ort_value_idx, ort_value);
+  }
+  return Status::OK();
+}
+
+// Keep track of the intermediate tensors placed in the memory pattern buffers. Values allocated elsewhere are not
+// recorded and are allocated as usual when the run is replayed.
+void ExecutionFrame::RecordValue(int ort_value_idx, const OrtValue& ort_value) {
+  if (!ort_value.IsTensor() || IsOutput(ort_value_idx)) {
+    return;
+  }
+
+  const auto& tensor = ort_value.Get<Tensor>();
+  if (utils::IsDataTypeString(tensor.DataType())) {
+    return;
+  }
+
+  const auto& location = tensor.Location();
+  auto buffer = buffers_.find(location);
+  const auto* pattern = mem_patterns_->GetPatterns(location);
+  if (buffer == buffers_.end() || pattern == nullptr) {
+    return;
+  }
+
+  const auto base = reinterpret_cast<uintptr_t>(buffer->second.get());
+  const auto data = reinterpret_cast<uintptr_t>(tensor.DataRaw());
+  if (data < base || data + tensor.SizeInBytes() > base + pattern->PeakSize()) {
+    return;
+  }
+
+  recorded_values_.push_back({ort_value_idx, tensor.DataType(), tensor.Shape(), location,
+                              static_cast<size_t>(data - base)});
+}
+
+Status ExecutionFrame::SaveRecording(StaticShapeReplay& replay, const std::vector<int>& feed_mlvalue_idxs,
+                                     const std::vector<OrtValue>& feeds, const std::vector<int>& fetch_mlvalue_idxs,
+                                     std::vector<StaticShapeReplay::Step> steps) {
+  ORT_RETURN_IF_NOT(recording_, "The run was not recorded.");
+  recording_ = false;
+  return replay.Record(feed_mlvalue_idxs, feeds, fetch_mlvalue_idxs, std::move(steps), recorded_values_,
+                       std::move(buffers_));
 }
 
 Status ExecutionFrame::ReleaseMLValueImpl(int ort_value_idx) {
@@ -700,6 +751,11 @@ bool ExecutionFrame::TryGetInferredShape(int index, TensorShape& shape) const {
     return false;
   }
 
+  // A replayed run uses the shapes of the recorded values.
+  if (replay_) {
+    return replay_->TryGetShape(ort_value_idx, shape);
+  }
+
   // Search for inferred shape.
   // If inferred shape is found, it's assigned to "shape" so that caller can use it.
   auto it = inferred_shapes_.find(ort_value_idx);
@@ -14,6 +14,7 @@
 #include "core/framework/ml_value.h"
 #include "core/framework/node_index_info.h"
 #include "core/framework/sequential_execution_plan.h"
+#include "core/framework/static_shape_replay.h"
 #include "core/framework/tensor.h"
 #include "core/graph/graph_viewer.h"
 
@@ -122,7 +123,9 @@ class ExecutionFrame final : public IExecutionFrame {
                  const std::vector<int>& fetch_mlvalue_idxs, const std::vector<OrtValue>& fetches,
                  // optional custom allocators. key is index in fetches
                  const std::unordered_map<size_t, IExecutor::CustomAllocator>& fetch_allocators,
-                 const SessionState& session_state);
+                 const SessionState& session_state,
+                 // optional recording to take the intermediate values from instead of the memory pattern
+                 const StaticShapeReplay* replay = nullptr);
 
   ~ExecutionFrame() override;
 
@@ -144,6 +147,23 @@ class ExecutionFrame final : public IExecutionFrame {
     return planner_ != nullptr;
   }
 
+  // Returns true if this run allocates its intermediate values from a cached memory pattern, in which case it can
+  // be recorded for StaticShapeReplay.
+  bool CanRecord() const {
+    return mem_patterns_ != nullptr && !buffers_.empty();
+  }
+
+  // Keep track of the intermediate values allocated in the memory pattern buffers.
+  void StartRecording() {
+    recording_ = true;
+  }
+
+  // Move the memory pattern buffers and the values allocated in them into the recording. Must be called after the
+  // run completes, and the frame must not allocate any more values.
+  Status SaveRecording(StaticShapeReplay& replay, const std::vector<int>& feed_mlvalue_idxs,
+                       const std::vector<OrtValue>& feeds, const std::vector<int>& fetch_mlvalue_idxs,
+                       std::vector<StaticShapeReplay::Step> steps);
+
   // This function try retrieve the inferred shapes for the given NodeArg index.
   // If the retrival is sucessful, this function returns true and false otherwise.
   bool TryGetInferredShape(int index, TensorShape& shape) const override;
@@ -186,6 +206,8 @@ class ExecutionFrame final : public IExecutionFrame {
   Status AllocateTensorWithPreAllocateBufferHelper(OrtValue& ort_value, void* pBuffer, MLDataType element_type,
                                                    const OrtMemoryInfo& location, const TensorShape& shape);
 
+  void RecordValue(int ort_value_idx, const OrtValue& ort_value);
+
   void TraceAllocate(int ort_value_idx, size_t size);
   void TraceFree(int ort_value_idx);
 
@@ -210,6 +232,13 @@ class ExecutionFrame final : public IExecutionFrame {
   // Big chunks on different locations that will be used by mem_pattern.
   std::map<OrtMemoryInfo, BufferUniquePtr> buffers_;
 
+  // If set, intermediate values with the recorded shape are taken from this recording.
+  const StaticShapeReplay* replay_;
+
+  // Values allocated in buffers_ when this run is being recorded.
+  bool recording_ = false;
+  std::vector<StaticShapeReplay::RecordedValue> recorded_values_;
+
   // Given the input shapes of the executed graph, ExecutionFrame tries inferring
   // all symbolic shapes. inferred_shapes_[i] is the shape of OrtValue indexed
   // by i, if the key i exists.
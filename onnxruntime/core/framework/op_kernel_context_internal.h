@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <functional>
 #include "core/framework/op_kernel.h"
 #include "core/framework/session_state.h"
@@ -21,7 +22,7 @@ class OpKernelContextInternal : public OpKernelContext {
                                    IExecutionFrame& frame,
                                    const OpKernel& kernel,
                                    const logging::Logger& logger,
-                                   const bool& terminate_flag)
+                                   const std::atomic_bool& terminate_flag)
       : OpKernelContext(&frame, &kernel, session_state.GetThreadPool(), logger),
         session_state_(session_state),
         terminate_flag_(terminate_flag) {
@@ -68,11 +69,11 @@ class OpKernelContextInternal : public OpKernelContext {
     return implicit_input_values_;
   }
 
-  const bool& GetTerminateFlag() const noexcept { return terminate_flag_; }
+  const std::atomic_bool& GetTerminateFlag() const noexcept { return terminate_flag_; }
 
  private:
   const SessionState& session_state_;
-  const bool& terminate_flag_;
+  const std::atomic_bool& terminate_flag_;
   std::vector<const OrtValue*> implicit_input_values_;
 };
 
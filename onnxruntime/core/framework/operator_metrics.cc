@@ -0,0 +1,172 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/operator_metrics.h"
+
+#include <algorithm>
+#include <map>
+#include <sstream>
+
+#include "core/graph/graph_viewer.h"
+#include "core/platform/env.h"
+
+namespace onnxruntime {
+
+namespace {
+
+// Upper limit on the number of slots. Each slot holds a full set of counters for every node.
+constexpr size_t kMaxSlots = 8;
+
+size_t GetThreadSlotId() noexcept {
+  static std::atomic<size_t> next_thread_id{0};
+  thread_local const size_t thread_id = next_thread_id.fetch_add(1, std::memory_order_relaxed);
+  return thread_id;
+}
+
+void WriteJsonString(std::ostringstream& ss, const std::string& value) {
+  ss << '"';
+  for (char c : value) {
+    switch (c) {
+      case '"':
+        ss << "\\\"";
+        break;
+      case '\\':
+        ss << "\\\\";
+        break;
+      case '\n':
+        ss << "\\n";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          ss << ' ';
+        } else {
+          ss << c;
+        }
+    }
+  }
+  ss << '"';
+}
+
+void WriteJsonSummary(std::ostringstream& ss, const OperatorMetrics::NodeSummary& summary) {
+  ss << "\"count\":" << summary.count
+     << ",\"total_ns\":" << summary.total_ns
+     << ",\"max_ns\":" << summary.max_ns
+     << ",\"histogram\":[";
+  for (size_t i = 0; i < summary.histogram.size(); ++i) {
+    ss << (i == 0 ? "" : ",") << summary.histogram[i];
+  }
+  ss << "]";
+}
+
+}  // namespace
+
+OperatorMetrics::OperatorMetrics(const GraphViewer& graph_viewer)
+    : num_nodes_(static_cast<size_t>(graph_viewer.MaxNodeIndex())),
+      num_slots_(std::min(kMaxSlots, static_cast<size_t>(std::max(Env::Default().GetNumCpuCores(), 1)))),
+      counters_(new NodeCounters[num_slots_ * num_nodes_]),
+      node_names_(num_nodes_),
+      op_types_(num_nodes_) {
+  for (const auto& node : graph_viewer.Nodes()) {
+    node_names_[node.Index()] = node.Name();
+    op_types_[node.Index()] = node.OpType();
+  }
+}
+
+size_t OperatorMetrics::GetBucket(uint64_t duration_ns) noexcept {
+  size_t bucket = 0;
+  uint64_t value = duration_ns >> kFirstBucketShift;
+  while (value != 0 && bucket < kNumBuckets - 1) {
+    value >>= 1;
+    ++bucket;
+  }
+  return bucket;
+}
+
+void OperatorMetrics::Record(NodeIndex node_index, uint64_t duration_ns) noexcept {
+  if (node_index >= num_nodes_) {
+    return;
+  }
+
+  NodeCounters& counters = counters_[(GetThreadSlotId() % num_slots_) * num_nodes_ + node_index];
+
+  counters.count.fetch_add(1, std::memory_order_relaxed);
+  counters.total_ns.fetch_add(duration_ns, std::memory_order_relaxed);
+  counters.histogram[GetBucket(duration_ns)].fetch_add(1, std::memory_order_relaxed);
+
+  uint64_t max_ns = counters.max_ns.load(std::memory_order_relaxed);
+  while (duration_ns > max_ns &&
+         !counters.max_ns.compare_exchange_weak(max_ns, duration_ns, std::memory_order_relaxed)) {
+  }
+}
+
+OperatorMetrics::NodeSummary OperatorMetrics::GetNodeSummary(NodeIndex node_index) const {
+  NodeSummary summary;
+  if (node_index >= num_nodes_) {
+    return summary;
+  }
+
+  for (size_t slot = 0; slot < num_slots_; ++slot) {
+    const NodeCounters& counters = counters_[slot * num_nodes_ + node_index];
+    summary.count += counters.count.load(std::memory_order_relaxed);
+    summary.total_ns += counters.total_ns.load(std::memory_order_relaxed);
+    summary.max_ns = std::max(summary.max_ns, counters.max_ns.load(std::memory_order_relaxed));
+    for (size_t i = 0; i < kNumBuckets; ++i) {
+      summary.histogram[i] += counters.histogram[i].load(std::memory_order_relaxed);
+    }
+  }
+
+  return summary;
+}
+
+std::string OperatorMetrics::ToJson() const {
+  std::ostringstream ss;
+  std::map<std::string, NodeSummary> op_type_summaries;
+
+  ss << "{\"histogram_bounds_ns\":[";
+  for (size_t i = 0; i + 1 < kNumBuckets; ++i) {
+    ss << (i == 0 ? "" : ",") << (uint64_t{1} << (kFirstBucketShift + i));
+  }
+
+  ss << "],\"nodes\":[";
+  bool first = true;
+  for (size_t node_index = 0; node_index < num_nodes_; ++node_index) {
+    if (op_types_[node_index].empty()) {
+      continue;
+    }
+
+    const NodeSummary summary = GetNodeSummary(node_index);
+
+    auto& op_type_summary = op_type_summaries[op_types_[node_index]];
+    op_type_summary.count += summary.count;
+    op_type_summary.total_ns += summary.total_ns;
+    op_type_summary.max_ns = std::max(op_type_summary.max_ns, summary.max_ns);
+    for (size_t i = 0; i < kNumBuckets; ++i) {
+      op_type_summary.histogram[i] += summary.histogram[i];
+    }
+
+    ss << (first ? "" : ",") << "{\"index\":" << node_index << ",\"name\":";
+    WriteJsonString(ss, node_names_[node_index]);
+    ss << ",\"op_type\":";
+    WriteJsonString(ss, op_types_[node_index]);
+    ss << ",";
+    WriteJsonSummary(ss, summary);
+    ss << "}";
+    first = false;
+  }
+
+  ss << "],\"op_types\":[";
+  first = true;
+  for (const auto& entry : op_type_summaries) {
+    ss << (first ? "" : ",") << "{\"op_type\":";
+    WriteJsonString(ss, entry.first);
+    ss << ",";
+    WriteJsonSummary(ss, entry.second);
+    ss << "}";
+    first = false;
+  }
+  ss << "]}";
+
+  return ss.str();
+}
+
+}  // namespace onnxruntime
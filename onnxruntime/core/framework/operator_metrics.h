@@ -0,0 +1,80 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "core/common/common.h"
+#include "core/graph/basic_types.h"
+
+namespace onnxruntime {
+
+class GraphViewer;
+
+/**
+ * Aggregate per-node latency metrics that are cheap enough to leave enabled in production.
+ *
+ * Unlike profiling::Profiler, no per-event records are kept. Each node has a fixed set of counters
+ * (call count, total/maximum latency and a log2 latency histogram) in preallocated slots indexed by
+ * node index. Threads are spread over several slots to limit contention between concurrent Run calls
+ * and the parallel executor, and all updates are relaxed atomics so recording never takes a lock.
+ *
+ * The metrics can be read at any time with ToJson, which sums the slots and also aggregates by op type.
+ */
+class OperatorMetrics {
+ public:
+  // Histogram bucket i counts latencies below (1 << (kFirstBucketShift + i)) nanoseconds that are not
+  // counted by a lower bucket. The last bucket is open ended.
+  static constexpr size_t kNumBuckets = 24;
+  static constexpr size_t kFirstBucketShift = 10;
+
+  struct NodeSummary {
+    uint64_t count{0};
+    uint64_t total_ns{0};
+    uint64_t max_ns{0};
+    std::array<uint64_t, kNumBuckets> histogram{};
+  };
+
+  explicit OperatorMetrics(const GraphViewer& graph_viewer);
+
+  /** Records one execution of the node with the given latency. */
+  void Record(NodeIndex node_index, uint64_t duration_ns) noexcept;
+
+  /** Returns the metrics for a node summed over all slots. */
+  NodeSummary GetNodeSummary(NodeIndex node_index) const;
+
+  /**
+   * Returns the metrics as a JSON document with "nodes" and "op_types" arrays. Each entry holds
+   * "count", "total_ns", "max_ns" and "histogram". "histogram_bounds_ns" holds the exclusive upper
+   * bound of each histogram bucket but the last.
+   */
+  std::string ToJson() const;
+
+ private:
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(OperatorMetrics);
+
+  struct NodeCounters {
+    std::atomic<uint64_t> count{0};
+    std::atomic<uint64_t> total_ns{0};
+    std::atomic<uint64_t> max_ns{0};
+    std::array<std::atomic<uint64_t>, kNumBuckets> histogram{};
+  };
+
+  static size_t GetBucket(uint64_t duration_ns) noexcept;
+
+  size_t num_nodes_;
+  size_t num_slots_;
+  // num_slots_ * num_nodes_ counters, slot major.
+  std::unique_ptr<NodeCounters[]> counters_;
+
+  // Names and op types indexed by node index. Empty for removed nodes.
+  std::vector<std::string> node_names_;
+  std::vector<std::string> op_types_;
+};
+
+}  // namespace onnxruntime
@@ -14,12 +14,53 @@
 #include "core/framework/session_state.h"
 #include "core/framework/op_kernel_context_internal.h"
 #include "core/framework/utils.h"
+#include "core/platform/env_time.h"
 #include "core/platform/threadpool.h"
 
 namespace onnxruntime {
 
-ParallelExecutor::ParallelExecutor(const SessionState& session_state, const bool& terminate_flag)
-    : out_standings_(0), terminate_flag_(terminate_flag), executor_pool_(session_state.GetInterOpThreadPool()) {
+namespace {
+
+// Adds the CPU time that inter-op threads spend running nodes to the accounting of the run. Only the outermost scope
+// on a thread measures, so that nodes run inline, including on the thread that called Execute whose CPU time is
+// accounted for by the caller, are not counted twice.
+class CpuTimeAccountingScope {
+ public:
+  explicit CpuTimeAccountingScope(concurrency::ThreadPool::RequestAccounting* accounting)
+      : outermost_(!in_scope_) {
+    in_scope_ = true;
+    if (outermost_ && accounting != nullptr && GetThreadCpuTimeNanos(&start_)) {
+      accounting_ = accounting;
+    }
+  }
+
+  ~CpuTimeAccountingScope() {
+    uint64_t end;
+    if (accounting_ != nullptr && GetThreadCpuTimeNanos(&end) && end > start_) {
+      accounting_->worker_cpu_time_ns.fetch_add(end - start_, std::memory_order_relaxed);
+    }
+    if (outermost_) {
+      in_scope_ = false;
+    }
+  }
+
+ private:
+  static thread_local bool in_scope_;
+  const bool outermost_;
+  concurrency::ThreadPool::RequestAccounting* accounting_ = nullptr;
+  uint64_t start_ = 0;
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(CpuTimeAccountingScope);
+};
+
+thread_local bool CpuTimeAccountingScope::in_scope_ = false;
+
+}  // namespace
+
+ParallelExecutor::ParallelExecutor(const SessionState& session_state, const std::atomic_bool& terminate_flag)
+    : out_standings_(0),
+      terminate_flag_(terminate_flag),
+      request_(concurrency::ThreadPool::CurrentRequest()),
+      executor_pool_(session_state.GetInterOpThreadPool()) {
   const auto& graph_viewer = session_state.GetGraphViewer();
   node_refs_.resize(graph_viewer.MaxNodeIndex());
   for (auto& node : graph_viewer.Nodes()) {
@@ -38,6 +79,8 @@ Status ParallelExecutor::Execute(const SessionState& session_state, const std::v
     tp = session_state.Profiler().Now();
   }
 
+  CpuTimeAccountingScope caller_cpu_time_scope(nullptr);
+
   root_frame_ = onnxruntime::make_unique<ExecutionFrame>(feed_mlvalue_idxs, feeds, fetch_mlvalue_idxs, fetches,
                                                          fetch_allocators, session_state);
   //std::cout << "start nodes:" << std::endl;
@@ -120,6 +163,7 @@ Status ParallelExecutor::RunNodeAsync(size_t p_node_index,
   TimePoint sync_time_begin;
   TimePoint kernel_begin_time, kernel_end_time;
   const bool f_profiler_enabled = session_state.Profiler().IsEnabled();
+  OperatorMetrics* operator_metrics = session_state.GetOperatorMetrics();
   const SequentialExecutionPlan& exec_plan = *session_state.GetExecutionPlan();
 
   // Avoid context switching if possible.
@@ -131,6 +175,11 @@ Status ParallelExecutor::RunNodeAsync(size_t p_node_index,
       ORT_THROW("Exiting due to terminate flag being set to true.");
     }
 
+    if (request_ != nullptr && request_->IsCancelled()) {
+      LOGS(logger, WARNING) << "Exiting due to the run deadline having passed.";
+      ORT_THROW("Exiting due to the run deadline having passed.");
+    }
+
     const auto* p_op_kernel = session_state.GetKernel(node_index);
     const auto& node = *graph_viewer.GetNode(node_index);
 
@@ -189,6 +238,11 @@ Status ParallelExecutor::RunNodeAsync(size_t p_node_index,
     // call compute on the kernel
     VLOGS(logger, 1) << "Computing kernel: " << node.Name();
 
+    std::chrono::steady_clock::time_point metrics_begin_time;
+    if (operator_metrics != nullptr) {
+      metrics_begin_time = std::chrono::steady_clock::now();
+    }
+
     // Execute the kernel.
     ORT_TRY {
 #ifdef ENABLE_TRAINING
@@ -215,6 +269,22 @@ Status ParallelExecutor::RunNodeAsync(size_t p_node_index,
       break;
     }
 
+    if (request_ != nullptr && request_->accounting != nullptr) {
+      request_->accounting->kernels_executed.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Fail a run that was cancelled while the kernel ran, as the sequential executor does.
+    if (terminate_flag_ || (request_ != nullptr && request_->IsCancelled())) {
+      status = ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Exiting due to the run being cancelled.");
+      break;
+    }
+
+    if (operator_metrics != nullptr) {
+      operator_metrics->Record(node_index, static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                                                     std::chrono::steady_clock::now() - metrics_begin_time)
+                                                                     .count()));
+    }
+
     if (f_profiler_enabled) {
       kernel_end_time = session_state.Profiler().Now();
       session_state.Profiler().EndTimeAndRecordEvent(profiling::NODE_EVENT,
@@ -298,6 +368,7 @@ void ParallelExecutor::EnqueueNode(size_t p_node_index, const SessionState& sess
   }
 
   onnxruntime::concurrency::ThreadPool::Schedule(executor_pool_, [this, p_node_index, &session_state, &logger]() {
+    concurrency::ThreadPool::RequestScope request_scope(request_);
     auto create_exception_message = [p_node_index, &session_state](const std::exception* ex) {
       const auto* node = session_state.GetGraphViewer().GetNode(p_node_index);
 
@@ -307,17 +378,21 @@ void ParallelExecutor::EnqueueNode(size_t p_node_index, const SessionState& sess
     };
 
     Status status;
-    ORT_TRY {
-      status = ParallelExecutor::RunNodeAsync(p_node_index, std::cref(session_state), std::cref(logger));
-    }
-    ORT_CATCH(const std::exception& ex) {
-      ORT_HANDLE_EXCEPTION([&]() {
-        status = create_exception_message(&ex);
-      });
-    }
-    ORT_CATCH(...) {
-      // catch node processing failure exceptions here to prevent app crash.
-      status = create_exception_message(nullptr);
+    {
+      // The accounting may be released once the last node finishes, so stop measuring before FinishNodeRun.
+      CpuTimeAccountingScope cpu_time_scope(request_ != nullptr ? request_->accounting : nullptr);
+      ORT_TRY {
+        status = ParallelExecutor::RunNodeAsync(p_node_index, std::cref(session_state), std::cref(logger));
+      }
+      ORT_CATCH(const std::exception& ex) {
+        ORT_HANDLE_EXCEPTION([&]() {
+          status = create_exception_message(&ex);
+        });
+      }
+      ORT_CATCH(...) {
+        // catch node processing failure exceptions here to prevent app crash.
+        status = create_exception_message(nullptr);
+      }
     }
 
     FinishNodeRun(status);
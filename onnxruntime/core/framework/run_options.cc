@@ -53,3 +53,19 @@ ORT_API_STATUS_IMPL(OrtApis::RunOptionsUnsetTerminate, _Inout_ OrtRunOptions* op
   options->terminate = false;
   return nullptr;
 }
+
+ORT_API_STATUS_IMPL(OrtApis::RunOptionsSetPriority, _Inout_ OrtRunOptions* options, OrtRunPriority priority) {
+  if (priority < ORT_RUN_PRIORITY_LOW || priority > ORT_RUN_PRIORITY_HIGH) {
+    return OrtApis::CreateStatus(ORT_INVALID_ARGUMENT, "Invalid run priority.");
+  }
+  options->priority = priority;
+  return nullptr;
+}
+
+ORT_API_STATUS_IMPL(OrtApis::RunOptionsSetDeadline, _Inout_ OrtRunOptions* options, int64_t deadline_ms) {
+  if (deadline_ms < 0) {
+    return OrtApis::CreateStatus(ORT_INVALID_ARGUMENT, "The run deadline must not be negative.");
+  }
+  options->deadline_ms = deadline_ms;
+  return nullptr;
+}
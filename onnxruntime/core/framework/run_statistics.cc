@@ -0,0 +1,28 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/run_statistics.h"
+
+#include <sstream>
+
+namespace onnxruntime {
+
+std::string RunStatistics::ToJson() const {
+  std::ostringstream ss;
+  ss << "{\"wall_time_ns\":" << wall_time_ns
+     << ",\"cpu_time_ns\":" << cpu_time_ns
+     << ",\"kernels_executed\":" << kernels_executed
+     << ",\"bytes_copied\":" << bytes_copied
+     << ",\"arenas\":[";
+  for (size_t i = 0; i < arenas.size(); ++i) {
+    // arena names are the fixed allocator names of the execution providers, so need no escaping.
+    ss << (i == 0 ? "" : ",") << "{\"name\":\"" << arenas[i].name << "\""
+       << ",\"device_id\":" << arenas[i].device_id
+       << ",\"peak_bytes\":" << arenas[i].peak_bytes << "}";
+  }
+  ss << "]}";
+
+  return ss.str();
+}
+
+}  // namespace onnxruntime
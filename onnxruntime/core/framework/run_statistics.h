@@ -0,0 +1,36 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace onnxruntime {
+
+/**
+ * Resources used by a single Run call, so that they can be attributed to whoever issued it.
+ *
+ * CPU time is the time of the calling thread plus the time that intra-op and inter-op worker threads spent
+ * working on the run. Memory is the peak number of bytes allocated on behalf of the run from each arena. This
+ * includes the buffer a run allocates for its memory pattern, but not the initializer buffer that the session
+ * reserved when it was loaded.
+ */
+struct RunStatistics {
+  struct ArenaUsage {
+    std::string name;
+    int device_id{0};
+    uint64_t peak_bytes{0};
+  };
+
+  uint64_t wall_time_ns{0};
+  uint64_t cpu_time_ns{0};
+  uint64_t kernels_executed{0};
+  uint64_t bytes_copied{0};
+  std::vector<ArenaUsage> arenas;
+
+  std::string ToJson() const;
+};
+
+}  // namespace onnxruntime
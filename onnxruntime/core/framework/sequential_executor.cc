@@ -3,6 +3,7 @@
 
 #include "core/framework/sequential_executor.h"
 
+#include <algorithm>
 #include <chrono>
 #include <thread>
 #include <vector>
@@ -14,6 +15,7 @@
 #include "core/framework/session_state.h"
 #include "core/framework/op_kernel_context_internal.h"
 #include "core/framework/utils.h"
+#include "core/platform/threadpool.h"
 
 #if defined DEBUG_NODE_INPUTS_OUTPUTS
 #include "core/framework/debug_node_inputs_outputs_utils.h"
@@ -122,12 +124,95 @@ static Status ReleaseNodeMLValues(ExecutionFrame& frame,
                                   const SequentialExecutionPlan::NodeExecutionPlan& node_exec_plan,
                                   const logging::Logger& logger);
 
+// Returns an error if the run was terminated or has passed its deadline. This is checked before and after each
+// kernel, so that a run cancelled during its last kernel also fails.
+static Status CheckNotCancelled(const std::atomic_bool& terminate_flag, const logging::Logger& logger) {
+  if (terminate_flag) {
+    LOGS(logger, WARNING) << "Exiting due to terminate flag being set to true.";
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Exiting due to terminate flag being set to true.");
+  }
+
+  const auto* request = concurrency::ThreadPool::CurrentRequest();
+  if (request != nullptr && request->IsCancelled()) {
+    LOGS(logger, WARNING) << "Exiting due to the run deadline having passed.";
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Exiting due to the run deadline having passed.");
+  }
+
+  return Status::OK();
+}
+
+// Counts a kernel towards the accounting of the current request, if it has one.
+static void AccountKernelExecuted() {
+  const auto* request = concurrency::ThreadPool::CurrentRequest();
+  if (request != nullptr && request->accounting != nullptr) {
+    request->accounting->kernels_executed.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+// Run the kernels of a recorded execution, taking the intermediate values from the recording.
+static Status Replay(const SessionState& session_state, const StaticShapeReplay& replay,
+                     const std::vector<int>& feed_mlvalue_idxs, const std::vector<OrtValue>& feeds,
+                     const std::vector<int>& fetch_mlvalue_idxs, std::vector<OrtValue>& fetches,
+                     const std::atomic_bool& terminate_flag, const logging::Logger& logger) {
+  OperatorMetrics* operator_metrics = session_state.GetOperatorMetrics();
+  const SequentialExecutionPlan& seq_exec_plan = *session_state.GetExecutionPlan();
+
+  ExecutionFrame frame{feed_mlvalue_idxs, feeds, fetch_mlvalue_idxs, fetches, {}, session_state, &replay};
+
+  for (const auto& step : replay.Steps()) {
+    ORT_RETURN_IF_ERROR(CheckNotCancelled(terminate_flag, logger));
+
+    const OpKernel& op_kernel = *step.kernel;
+    OpKernelContextInternal op_kernel_context(session_state, frame, op_kernel, logger, terminate_flag);
+
+    std::chrono::steady_clock::time_point metrics_begin_time;
+    if (operator_metrics != nullptr) {
+      metrics_begin_time = std::chrono::steady_clock::now();
+    }
+
+    Status compute_status;
+    ORT_TRY {
+      compute_status = op_kernel.Compute(&op_kernel_context);
+    }
+    ORT_CATCH(const std::exception& ex) {
+      ORT_HANDLE_EXCEPTION([&]() {
+        compute_status = ORT_MAKE_STATUS(ONNXRUNTIME, RUNTIME_EXCEPTION, ex.what());
+      });
+    }
+
+    if (!compute_status.IsOK()) {
+      const Node& node = op_kernel.Node();
+      std::ostringstream ss;
+      ss << "Non-zero status code returned while running " << node.OpType() << " node. Name:'" << node.Name()
+         << "' Status Message: " << compute_status.ErrorMessage();
+      const auto msg_string = ss.str();
+      LOGS(logger, ERROR) << msg_string;
+      return Status(compute_status.Category(), compute_status.Code(), msg_string);
+    }
+
+    AccountKernelExecuted();
+    ORT_RETURN_IF_ERROR(CheckNotCancelled(terminate_flag, logger));
+
+    if (operator_metrics != nullptr) {
+      operator_metrics->Record(step.node_exec_plan->node_index,
+                               static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                                         std::chrono::steady_clock::now() - metrics_begin_time)
+                                                         .count()));
+    }
+
+    ORT_RETURN_IF_ERROR(ReleaseNodeMLValues(frame, seq_exec_plan, *step.node_exec_plan, logger));
+  }
+
+  return frame.GetOutputs(fetches);
+}
+
 Status SequentialExecutor::Execute(const SessionState& session_state, const std::vector<int>& feed_mlvalue_idxs,
                                    const std::vector<OrtValue>& feeds, const std::vector<int>& fetch_mlvalue_idxs,
                                    std::vector<OrtValue>& fetches,
                                    const std::unordered_map<size_t, CustomAllocator>& fetch_allocators,
                                    const logging::Logger& logger) {
   const bool is_profiler_enabled = session_state.Profiler().IsEnabled();
+  OperatorMetrics* operator_metrics = session_state.GetOperatorMetrics();
   TimePoint tp;
   TimePoint sync_time_begin;
   TimePoint kernel_begin_time, kernel_end_time;
@@ -139,7 +224,6 @@ Status SequentialExecutor::Execute(const SessionState& session_state, const std:
     tp = session_state.Profiler().Now();
   }
 
-  ExecutionFrame frame{feed_mlvalue_idxs, feeds, fetch_mlvalue_idxs, fetches, fetch_allocators, session_state};
   const std::unordered_set<NodeIndex>* to_be_executed_nodes = nullptr;
 
 #if !defined(ORT_MINIMAL_BUILD)
@@ -159,6 +243,37 @@ Status SequentialExecutor::Execute(const SessionState& session_state, const std:
   const auto& exec_plan_vec = seq_exec_plan.execution_plan;
   VLOGS(logger, 1) << "Size of execution plan vector: " << exec_plan_vec.size();
 
+  // Runs with the input shapes of a recorded run replay it. Profiling needs the per node events of the regular path.
+  StaticShapeReplay* replay = session_state.GetStaticShapeReplay();
+  if (replay != nullptr && (is_profiler_enabled || only_execute_path_to_fetches || !fetch_allocators.empty())) {
+    replay = nullptr;
+  }
+
+  if (replay != nullptr && replay->TryAcquire(feed_mlvalue_idxs, feeds, fetch_mlvalue_idxs)) {
+    VLOGS(logger, 1) << "Replaying recorded execution.";
+    struct ReplayLease {
+      ~ReplayLease() { replay.Release(); }
+      StaticShapeReplay& replay;
+    } lease{*replay};
+    return Replay(session_state, *replay, feed_mlvalue_idxs, feeds, fetch_mlvalue_idxs, fetches, terminate_flag_,
+                  logger);
+  }
+
+  ExecutionFrame frame{feed_mlvalue_idxs, feeds, fetch_mlvalue_idxs, fetches, fetch_allocators, session_state};
+
+  // Record this run if it uses a cached memory pattern. Fences synchronize with other devices, so nodes with fences
+  // are not recorded.
+  std::vector<StaticShapeReplay::Step> recorded_steps;
+  const bool record = replay != nullptr && replay->NeedsRecording() && frame.CanRecord() &&
+                      std::none_of(exec_plan_vec.cbegin(), exec_plan_vec.cend(),
+                                   [&seq_exec_plan](const SequentialExecutionPlan::NodeExecutionPlan& node_exec_plan) {
+                                     return seq_exec_plan.NodeHasFence(node_exec_plan.node_index);
+                                   });
+  if (record) {
+    frame.StartRecording();
+    recorded_steps.reserve(exec_plan_vec.size());
+  }
+
 // Enable TRACE_EXECUTION compile flag to dump execution plan
 #if defined(TRACE_EXECUTION)
   std::cout << std::make_pair(&seq_exec_plan, &session_state) << std::endl;
@@ -189,10 +304,7 @@ Status SequentialExecutor::Execute(const SessionState& session_state, const std:
 #endif
 
   for (const auto& node_exec_plan : exec_plan_vec) {
-    if (terminate_flag_) {
-      LOGS(logger, WARNING) << "Exiting due to terminate flag being set to true.";
-      return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Exiting due to terminate flag being set to true.");
-    }
+    ORT_RETURN_IF_ERROR(CheckNotCancelled(terminate_flag_, logger));
 
     auto node_index = node_exec_plan.node_index;
 
@@ -295,6 +407,11 @@ Status SequentialExecutor::Execute(const SessionState& session_state, const std:
       kernel_begin_time = session_state.Profiler().Now();
     }
 
+    std::chrono::steady_clock::time_point metrics_begin_time;
+    if (operator_metrics != nullptr) {
+      metrics_begin_time = std::chrono::steady_clock::now();
+    }
+
     Status compute_status;
     {
 #ifdef CONCURRENCY_VISUALIZER
@@ -339,6 +456,15 @@ Status SequentialExecutor::Execute(const SessionState& session_state, const std:
       return Status(compute_status.Category(), compute_status.Code(), msg_string);
     }
 
+    AccountKernelExecuted();
+    ORT_RETURN_IF_ERROR(CheckNotCancelled(terminate_flag_, logger));
+
+    if (operator_metrics != nullptr) {
+      operator_metrics->Record(node_index, static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                                                     std::chrono::steady_clock::now() - metrics_begin_time)
+                                                                     .count()));
+    }
+
     if (is_profiler_enabled) {
       kernel_end_time = session_state.Profiler().Now();
       // Calculate total output sizes for this operation.
@@ -420,6 +546,10 @@ Status SequentialExecutor::Execute(const SessionState& session_state, const std:
     utils::DumpNodeOutputs(op_kernel_context, p_op_kernel->Node(), session_state);
 #endif
 
+    if (record) {
+      recorded_steps.push_back({p_op_kernel, &node_exec_plan});
+    }
+
     // free ml-values corresponding to this node
     VLOGS(logger, 1) << "Releasing node ML values.";
     ORT_RETURN_IF_ERROR(ReleaseNodeMLValues(frame, seq_exec_plan, node_exec_plan, logger));
@@ -447,6 +577,11 @@ Status SequentialExecutor::Execute(const SessionState& session_state, const std:
   ORT_RETURN_IF_ERROR(frame.GetOutputs(fetches));
   VLOGS(logger, 1) << "Done with execution.";
 
+  if (record) {
+    ORT_RETURN_IF_ERROR(frame.SaveRecording(*replay, feed_mlvalue_idxs, feeds, fetch_mlvalue_idxs,
+                                             std::move(recorded_steps)));
+  }
+
 #if !defined(ORT_MINIMAL_BUILD) && defined(ORT_MEMORY_PROFILE)
   MemoryInfo::MemoryInfoProfile::CreateEvents("dynamic activations_" + std::to_string(MemoryInfo::GetIteration()),
                                               MemoryInfo::MemoryInfoProfile::GetAndIncreasePid(), MemoryInfo::MapType::DynamicActivation, "", 0);
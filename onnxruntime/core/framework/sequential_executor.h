@@ -18,7 +18,7 @@
 namespace onnxruntime {
 class SequentialExecutor : public IExecutor {
  public:
-  SequentialExecutor(const bool& terminate_flag = false, const bool only_execute_path_to_fetches = false)
+  SequentialExecutor(const std::atomic_bool& terminate_flag, const bool only_execute_path_to_fetches = false)
       : terminate_flag_{terminate_flag}, only_execute_path_to_fetches_(only_execute_path_to_fetches) {}
 
   common::Status Execute(const SessionState& session_state, const std::vector<int>& feed_mlvalue_idxs,
@@ -29,7 +29,7 @@ class SequentialExecutor : public IExecutor {
 
  private:
   ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(SequentialExecutor);
-  const bool& terminate_flag_;
+  const std::atomic_bool& terminate_flag_;
   const bool only_execute_path_to_fetches_;
 };
 }  // namespace onnxruntime
@@ -3,6 +3,8 @@
 
 #include "core/framework/session_state.h"
 
+#include <algorithm>
+#include <cstring>
 #include <sstream>
 
 #include "core/common/logging/logging.h"
@@ -13,6 +15,7 @@
 #include "core/framework/op_kernel.h"
 #include "core/framework/ort_value_pattern_planner.h"
 #include "core/framework/session_state_utils.h"
+#include "core/framework/sparse_tensor.h"
 #include "core/framework/utils.h"
 #include "core/providers/cpu/controlflow/utils.h"
 #include "core/session/onnxruntime_session_options_config_keys.h"
@@ -274,8 +277,18 @@ Status SessionState::PrepackConstantInitializedTensors(std::unordered_map<std::s
             std::unordered_map<int, OrtValue>& constant_initialized_tensors = st->constant_initialized_tensors_;
             if (constant_initialized_tensors.count(ort_value_idx)) {
               bool is_packed = false;
-              const Tensor& const_initialized_tensor = constant_initialized_tensors[ort_value_idx].Get<Tensor>();
-              ORT_RETURN_IF_ERROR(kernel->PrePack(const_initialized_tensor, input_idx, is_packed));
+              if (constant_initialized_tensors[ort_value_idx].IsSparseTensor()) {
+                const SparseTensor& sparse_initializer = constant_initialized_tensors[ort_value_idx].Get<SparseTensor>();
+                ORT_RETURN_IF_ERROR(kernel->PrePackSparse(sparse_initializer, input_idx, is_packed));
+                if (!is_packed) {
+                  // the kernel needs the dense values, either for PrePack or at compute time
+                  ORT_RETURN_IF_ERROR(st->DensifySparseInitializer(ort_value_idx));
+                }
+              }
+              if (!is_packed) {
+                const Tensor& const_initialized_tensor = constant_initialized_tensors[ort_value_idx].Get<Tensor>();
+                ORT_RETURN_IF_ERROR(kernel->PrePack(const_initialized_tensor, input_idx, is_packed));
+              }
               if (is_packed && constant_initializers_use_count.count(input_name) && --constant_initializers_use_count[input_name] == 0) {
                 // release the constant initialized tensor
                 st->initialized_tensors_.erase(ort_value_idx);
@@ -299,6 +312,81 @@ Status SessionState::PrepackConstantInitializedTensors(std::unordered_map<std::s
   return Status::OK();
 }
 
+std::unordered_set<std::string> SessionState::GetInitializersToKeepSparse(
+    const SessionOptions& session_options) const {
+  std::unordered_set<std::string> sparse_initializers;
+  const auto& allocation_order = p_seq_exec_plan_->initializer_allocation_order;
+  for (const auto& entry : graph_viewer_->GetAllInitializedTensors()) {
+    const std::string& name = entry.first;
+    int ort_value_idx;
+    if (!graph_.IsSparseInitializer(name) ||
+        entry.second->data_type() == ONNX_NAMESPACE::TensorProto_DataType_STRING ||
+        !graph_viewer_->IsConstantInitializer(name, false) ||
+        session_options.initializers_to_share_map.count(name) > 0 ||
+        !ort_value_name_idx_map_.GetIdx(name, ort_value_idx).IsOK() ||
+        std::find(allocation_order.cbegin(), allocation_order.cend(), ort_value_idx) != allocation_order.cend() ||
+        p_seq_exec_plan_->GetLocation(ort_value_idx).device.Type() != OrtDevice::CPU) {
+      continue;
+    }
+    sparse_initializers.insert(name);
+  }
+
+  if (sparse_initializers.empty()) {
+    return sparse_initializers;
+  }
+
+  for (const auto* output : graph_viewer_->GetOutputs()) {
+    sparse_initializers.erase(output->Name());
+  }
+
+  for (const auto& node : graph_viewer_->Nodes()) {
+    // values consumed by subgraphs are read from the outer scope as dense tensors
+    for (const auto* implicit_input : node.ImplicitInputDefs()) {
+      sparse_initializers.erase(implicit_input->Name());
+    }
+
+    const KernelDef& kernel_def = *GetNodeKernelCreateInfo(node.Index()).kernel_def;
+    const auto& input_defs = node.InputDefs();
+    for (size_t i = 0; i < input_defs.size(); ++i) {
+      if (input_defs[i]->Exists() && !kernel_def.AcceptsSparseInitializer(i)) {
+        sparse_initializers.erase(input_defs[i]->Name());
+      }
+    }
+  }
+
+  return sparse_initializers;
+}
+
+Status SessionState::DensifySparseInitializer(int ort_value_index) {
+  const SparseTensor& sparse = constant_initialized_tensors_[ort_value_index].Get<SparseTensor>();
+  const Tensor& values = sparse.Values();
+  const size_t element_size = values.DataType()->Size();
+  const auto& dims = sparse.Shape().GetDims();
+  const size_t rank = dims.size();
+
+  auto p_tensor = onnxruntime::make_unique<Tensor>(values.DataType(), sparse.Shape(),
+                                                   execution_providers_.GetDefaultCpuAllocator());
+  auto* dense_data = static_cast<uint8_t*>(p_tensor->MutableDataRaw());
+  std::memset(dense_data, 0, p_tensor->SizeInBytes());
+
+  const auto* values_data = static_cast<const uint8_t*>(values.DataRaw());
+  const int64_t* indices = sparse.Indices().Data<int64_t>();
+  for (size_t i = 0, end = sparse.NumValues(); i < end; ++i) {
+    size_t offset = 0;
+    for (size_t d = 0; d < rank; ++d) {
+      offset = offset * static_cast<size_t>(dims[d]) + static_cast<size_t>(indices[i * rank + d]);
+    }
+    std::memcpy(dense_data + offset * element_size, values_data + i * element_size, element_size);
+  }
+
+  auto ml_tensor = DataTypeImpl::GetType<Tensor>();
+  OrtValue dense_value;
+  dense_value.Init(p_tensor.release(), ml_tensor, ml_tensor->GetDeleteFunc());
+  initialized_tensors_[ort_value_index] = dense_value;
+  constant_initialized_tensors_[ort_value_index] = dense_value;
+  return Status::OK();
+}
+
 static int64_t CalculateMemoryPatternsKey(const std::vector<std::reference_wrapper<const TensorShape>>& shapes) {
   int64_t key = 0;
   for (auto shape : shapes) {
@@ -1036,6 +1124,14 @@ Status SessionState::FinalizeSessionStateImpl(const std::basic_string<PATH_CHAR_
 
   const auto& initializer_allocation_order = p_seq_exec_plan_->initializer_allocation_order;
 
+  // sparse initializers stay sparse until the kernels consuming them have had a chance to pack them in PrePack
+  std::unordered_set<std::string> sparse_initializers;
+#if !defined(ENABLE_TRAINING) && !defined(ORT_MEMORY_PROFILE)
+  if (session_options.GetConfigOrDefault(kOrtSessionOptionsConfigDisablePrepacking, "0") != "1") {
+    sparse_initializers = GetInitializersToKeepSparse(session_options);
+  }
+#endif
+
   // move initializers from TensorProto instances in Graph to OrtValue instances in SessionState
   ORT_RETURN_IF_ERROR(
       session_state_utils::SaveInitializedTensors(
@@ -1045,7 +1141,7 @@ Status SessionState::FinalizeSessionStateImpl(const std::basic_string<PATH_CHAR_
           [this](int idx, const OrtValue& value, const OrtCallback& d, bool constant) -> Status {
             return AddInitializedTensor(idx, value, &d, constant);
           },
-          logger_, data_transfer_mgr_, *p_seq_exec_plan_.get(), session_options));
+          logger_, data_transfer_mgr_, *p_seq_exec_plan_.get(), session_options, sparse_initializers));
 #if !defined(ORT_MINIMAL_BUILD) && defined(ORT_MEMORY_PROFILE)
   //Record Weight allocation info on device
   MemoryInfo::RecordInitializerAllocInfo(GetInitializedTensors());
@@ -6,6 +6,7 @@
 #include <memory>
 #include <map>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "gsl/gsl"
@@ -24,6 +25,8 @@
 #include "core/framework/mem_pattern.h"
 #include "core/framework/ml_value.h"
 #include "core/framework/node_index_info.h"
+#include "core/framework/operator_metrics.h"
+#include "core/framework/static_shape_replay.h"
 #include "core/framework/op_kernel.h"
 #include "core/framework/ort_value_name_idx_map.h"
 #include "core/graph/graph_viewer.h"
@@ -192,6 +195,27 @@ class SessionState {
   */
   profiling::Profiler& Profiler() const noexcept { return profiler_; }
 
+  /**
+  Enable aggregate per-node latency metrics for the nodes of this graph.
+  Metrics are not collected for the nodes of subgraphs, whose time is included in the node that owns them.
+  */
+  void EnableOperatorMetrics() { operator_metrics_ = onnxruntime::make_unique<OperatorMetrics>(GetGraphViewer()); }
+
+  /**
+  Get the aggregate per-node latency metrics, or nullptr if they are not enabled.
+  */
+  OperatorMetrics* GetOperatorMetrics() const noexcept { return operator_metrics_.get(); }
+
+  /**
+  Record the first run that uses a cached memory pattern, and replay it for later runs with the same input shapes.
+  */
+  void EnableStaticShapeReplay() { static_shape_replay_ = onnxruntime::make_unique<StaticShapeReplay>(); }
+
+  /**
+  Get the recording of this graph, or nullptr if static shape replay is not enabled.
+  */
+  StaticShapeReplay* GetStaticShapeReplay() const noexcept { return static_shape_replay_.get(); }
+
   /**
   Get cached memory pattern based on input shapes
   */
@@ -323,6 +347,16 @@ class SessionState {
   */
   Status PrepackConstantInitializedTensors(std::unordered_map<std::string, size_t>& constant_initializers_use_count);
 
+  /**
+  * Names of the sparse initializers in the model that are stored as SparseTensor instances until PrePack.
+  * An initializer qualifies if it is a constant placed on CPU and every consumer declares the input in
+  * KernelDef::SparseInitializerInputs.
+  */
+  std::unordered_set<std::string> GetInitializersToKeepSparse(const SessionOptions& session_options) const;
+
+  // replace a sparse initializer with its dense equivalent for kernels that did not pack it
+  Status DensifySparseInitializer(int ort_value_index);
+
   SessionState* GetMutableSubgraphSessionState(onnxruntime::NodeIndex index, const std::string& attribute_name);
 
   Status CreateSubgraphSessionState();
@@ -417,6 +451,8 @@ class SessionState {
 
   const logging::Logger& logger_;
   profiling::Profiler& profiler_;
+  std::unique_ptr<OperatorMetrics> operator_metrics_;
+  std::unique_ptr<StaticShapeReplay> static_shape_replay_;
 
   // switch for enable memory pattern optimization or not.
   bool enable_mem_pattern_;
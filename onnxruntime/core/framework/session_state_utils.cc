@@ -4,6 +4,8 @@
 #include "core/graph/onnx_protobuf.h"
 #include "core/framework/session_state_utils.h"
 
+#include <algorithm>
+#include <cstring>
 #include <functional>
 #include <limits>
 #include <core/common/status.h>
@@ -13,12 +15,14 @@
 
 #include "core/graph/graph_viewer.h"
 #include "core/framework/data_transfer_manager.h"
+#include "core/framework/endian.h"
 #include "core/framework/graph_partitioner.h"
 #include "core/framework/ml_value.h"
 #include "core/framework/ort_value_pattern_planner.h"
 #include "core/framework/ort_value_name_idx_map.h"
 #include "core/framework/sequential_execution_plan.h"
 #include "core/framework/session_state.h"
+#include "core/framework/sparse_tensor.h"
 #include "core/framework/tensorprotoutils.h"
 #include "core/framework/utils.h"
 #include "core/framework/mem_buffer.h"
@@ -86,6 +90,65 @@ static common::Status DeserializeTensorProto(const Env& env, const std::basic_st
   return common::Status::OK();
 }
 
+// Creates a sparse tensor with coordinate indices from the nonzero elements of a CPU initializer, so that the
+// initializer is never held densely by the session.
+static common::Status DeserializeTensorProtoToSparseTensor(const Env& env,
+                                                          const std::basic_string<PATH_CHAR_TYPE>& proto_path,
+                                                          const ONNX_NAMESPACE::TensorProto& tensor_proto,
+                                                          const AllocatorPtr& alloc, OrtValue& ort_value) {
+  const TensorShape tensor_shape{utils::GetTensorShapeFromTensorProto(tensor_proto)};
+  const DataTypeImpl* const type = DataTypeImpl::TensorTypeFromONNXEnum(tensor_proto.data_type())->GetElementType();
+  const size_t element_size = type->Size();
+  const size_t element_count = static_cast<size_t>(tensor_shape.Size());
+
+  // The Graph holds sparse initializers as raw data, which is read in place. Other initializers are deserialized
+  // to a temporary dense tensor first.
+  const uint8_t* dense_data = nullptr;
+  std::unique_ptr<Tensor> dense_tensor;
+  if (utils::HasRawData(tensor_proto) && !utils::HasExternalData(tensor_proto) && endian::native == endian::little) {
+    ORT_RETURN_IF_NOT(tensor_proto.raw_data().size() == element_count * element_size,
+                      "Initializer ", tensor_proto.name(), " has ", tensor_proto.raw_data().size(),
+                      " bytes of raw data, expected ", element_count * element_size);
+    dense_data = reinterpret_cast<const uint8_t*>(tensor_proto.raw_data().data());
+  } else {
+    dense_tensor = onnxruntime::make_unique<Tensor>(type, tensor_shape, alloc);
+    ORT_RETURN_IF_ERROR(utils::TensorProtoToTensor(env, proto_path.c_str(), tensor_proto, *dense_tensor));
+    dense_data = static_cast<const uint8_t*>(dense_tensor->DataRaw());
+  }
+
+  auto is_nonzero = [dense_data, element_size](size_t i) {
+    const uint8_t* element = dense_data + i * element_size;
+    return std::any_of(element, element + element_size, [](uint8_t byte) { return byte != 0; });
+  };
+
+  size_t nonzero_count = 0;
+  for (size_t i = 0; i < element_count; ++i) {
+    nonzero_count += is_nonzero(i) ? 1 : 0;
+  }
+
+  auto p_tensor = onnxruntime::make_unique<SparseTensor>(type, tensor_shape, nonzero_count, alloc);
+  auto* values = static_cast<uint8_t*>(p_tensor->MutableValues().MutableDataRaw());
+  auto* indices = p_tensor->MutableIndices().MutableData<int64_t>();
+  const auto& dims = tensor_shape.GetDims();
+  const size_t rank = dims.size();
+  for (size_t i = 0, value_idx = 0; i < element_count; ++i) {
+    if (!is_nonzero(i)) {
+      continue;
+    }
+    std::memcpy(values + value_idx * element_size, dense_data + i * element_size, element_size);
+    size_t remainder = i;
+    for (size_t d = rank; d-- > 0;) {
+      indices[value_idx * rank + d] = static_cast<int64_t>(remainder % static_cast<size_t>(dims[d]));
+      remainder /= static_cast<size_t>(dims[d]);
+    }
+    ++value_idx;
+  }
+
+  auto ml_sparse_tensor = DataTypeImpl::GetType<SparseTensor>();
+  ort_value.Init(p_tensor.release(), ml_sparse_tensor, ml_sparse_tensor->GetDeleteFunc());
+  return common::Status::OK();
+}
+
 common::Status SaveInitializedTensors(
     const Env& env, const std::basic_string<PATH_CHAR_TYPE>& graph_loc,
     const GraphViewer& graph, const AllocatorPtr& default_cpu_alloc,
@@ -95,7 +158,8 @@ common::Status SaveInitializedTensors(
     const std::function<Status(int idx, const OrtValue& value, const OrtCallback& d, bool constant)>& save_tensor_func,
     const logging::Logger& logger, const DataTransferManager& data_transfer_mgr,
     const ExecutionPlanBase& exec_plan,
-    const SessionOptions& session_options) {
+    const SessionOptions& session_options,
+    const std::unordered_set<std::string>& sparse_initializers) {
   LOGS(logger, INFO) << "Saving initialized tensors.";
   ORT_ENFORCE(ort_value_name_idx_map.MaxIdx() > -1, "OrtValue indexes should have been populated.");
 
@@ -161,6 +225,10 @@ common::Status SaveInitializedTensors(
         // do not trace string tensor
       continue;
     }
+    // initializers kept in sparse form are allocated separately
+    if (sparse_initializers.count(entry.second->name()) > 0) {
+      continue;
+    }
     ORT_RETURN_IF_ERROR(planner.Trace(entry.first, entry.second));
   }
   //2. allocate weight buffer on different locations
@@ -191,6 +259,11 @@ common::Status SaveInitializedTensors(
     if (user_supplied_initializer_ids.find(entry.first) != user_supplied_initializer_ids.end()) {
       ort_value = *(session_options.initializers_to_share_map.at(name));
       LOGS(logger, INFO) << "Using user supplied initializer with name (" << name << ").";
+    } else if (sparse_initializers.count(entry.second->name()) > 0) {
+      ORT_RETURN_IF_ERROR(DeserializeTensorProtoToSparseTensor(env, graph_loc, *entry.second, default_cpu_alloc,
+                                                               ort_value));
+      VLOGS(logger, 1) << "Keeping sparse initializer " << name << " with "
+                       << ort_value.Get<SparseTensor>().NumValues() << " values in sparse form.";
     } else {
       const ONNX_NAMESPACE::TensorProto& tensor_proto = *(entry.second);
 
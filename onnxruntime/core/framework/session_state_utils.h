@@ -3,6 +3,8 @@
 
 #pragma once
 #include <map>
+#include <string>
+#include <unordered_set>
 
 #include "core/common/const_pointer_container.h"
 #include "core/framework/allocator.h"
@@ -39,7 +41,8 @@ common::Status SaveInitializedTensors(
     const logging::Logger& logger,
     const DataTransferManager& data_transfer_mgr,
     const ExecutionPlanBase& exec_plan,
-    const SessionOptions& session_options);
+    const SessionOptions& session_options,
+    const std::unordered_set<std::string>& sparse_initializers);
 common::Status SaveInputOutputNamesToNodeMapping(const GraphViewer& graph,
                                                  SessionState& session_state,
                                                  const std::vector<const NodeArg*>& implicit_inputs);
@@ -0,0 +1,84 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/static_shape_replay.h"
+
+#include <algorithm>
+
+namespace onnxruntime {
+
+Status StaticShapeReplay::Record(const std::vector<int>& feed_mlvalue_idxs, const std::vector<OrtValue>& feeds,
+                                 const std::vector<int>& fetch_mlvalue_idxs, std::vector<Step> steps,
+                                 const std::vector<RecordedValue>& values,
+                                 std::map<OrtMemoryInfo, BufferUniquePtr> buffers) {
+  std::lock_guard<std::mutex> lock(record_mutex_);
+  if (recorded_.load(std::memory_order_relaxed)) {
+    return Status::OK();
+  }
+
+  feed_mlvalue_idxs_ = feed_mlvalue_idxs;
+  feed_shapes_.clear();
+  feed_shapes_.reserve(feeds.size());
+  for (const auto& feed : feeds) {
+    ORT_RETURN_IF_NOT(feed.IsTensor(), "Only runs with tensor feeds can be recorded.");
+    feed_shapes_.push_back(feed.Get<Tensor>().Shape());
+  }
+
+  fetch_mlvalue_idxs_ = fetch_mlvalue_idxs;
+  steps_ = std::move(steps);
+
+  auto ml_tensor = DataTypeImpl::GetType<Tensor>();
+  for (const auto& value : values) {
+    auto buffer = buffers.find(value.location);
+    ORT_RETURN_IF(buffer == buffers.end(), "No recorded buffer for ", value.location.ToString());
+    ORT_RETURN_IF(std::find(fetch_mlvalue_idxs.cbegin(), fetch_mlvalue_idxs.cend(), value.ort_value_idx) !=
+                      fetch_mlvalue_idxs.cend(),
+                  "A fetch cannot be recorded. OrtValue index: ", value.ort_value_idx);
+
+    if (static_cast<size_t>(value.ort_value_idx) >= values_.size()) {
+      values_.resize(static_cast<size_t>(value.ort_value_idx) + 1);
+    }
+
+    void* data = static_cast<char*>(buffer->second.get()) + value.offset;
+    auto p_tensor = onnxruntime::make_unique<Tensor>(value.element_type, value.shape, data, value.location);
+    values_[value.ort_value_idx].Init(p_tensor.release(), ml_tensor, ml_tensor->GetDeleteFunc());
+  }
+
+  buffers_ = std::move(buffers);
+  recorded_.store(true, std::memory_order_release);
+  return Status::OK();
+}
+
+bool StaticShapeReplay::TryAcquire(const std::vector<int>& feed_mlvalue_idxs, const std::vector<OrtValue>& feeds,
+                                   const std::vector<int>& fetch_mlvalue_idxs) noexcept {
+  // The recorded values are shared by all replays, so they must never be handed out as fetches.
+  if (!recorded_.load(std::memory_order_acquire) ||
+      feed_mlvalue_idxs != feed_mlvalue_idxs_ || fetch_mlvalue_idxs != fetch_mlvalue_idxs_ ||
+      feeds.size() != feed_shapes_.size()) {
+    return false;
+  }
+
+  for (size_t i = 0; i < feeds.size(); ++i) {
+    if (!feeds[i].IsTensor() || feeds[i].Get<Tensor>().Shape() != feed_shapes_[i]) {
+      return false;
+    }
+  }
+
+  if (in_use_.exchange(true, std::memory_order_acquire)) {
+    return false;
+  }
+
+  replay_count_.fetch_add(1, std::memory_order_relaxed);
+  return true;
+}
+
+bool StaticShapeReplay::TryGetShape(int ort_value_idx, TensorShape& shape) const {
+  if (static_cast<size_t>(ort_value_idx) >= values_.size() || !values_[ort_value_idx].IsAllocated()) {
+    return false;
+  }
+
+  shape = values_[ort_value_idx].Get<Tensor>().Shape();
+  return true;
+}
+
+}  // namespace onnxruntime
@@ -0,0 +1,115 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include "core/common/common.h"
+#include "core/framework/allocator.h"
+#include "core/framework/ml_value.h"
+#include "core/framework/sequential_execution_plan.h"
+#include "core/framework/tensor.h"
+#include "core/framework/tensor_shape.h"
+
+namespace onnxruntime {
+
+class OpKernel;
+
+/**
+ * Records the execution of a graph with fixed input shapes so that later runs with the same input shapes can skip
+ * the per-run work of the executor.
+ *
+ * A run whose memory pattern is already cached is recorded. The recording keeps the kernels in execution order and
+ * the memory pattern buffers, and wraps each intermediate tensor allocated in them in an OrtValue with the shape it
+ * had. When the input shapes match, a later run reuses these values instead of looking up the memory pattern,
+ * allocating the buffers and creating a tensor for each intermediate value. A kernel that requests a shape other than
+ * the recorded one gets a normally allocated value, so data dependent shapes still run correctly.
+ *
+ * A replay is keyed on the feed shapes and on the set of fetches. The recorded values never include the fetches of
+ * the recorded run, so a run that fetches a recorded intermediate value uses the regular execution path instead of
+ * returning a tensor in the shared buffers.
+ *
+ * The recorded buffers are shared by all runs, so only one run replays at a time. Concurrent runs, and runs with other
+ * input shapes or fetches, use the regular execution path.
+ */
+class StaticShapeReplay {
+ public:
+  struct Step {
+    const OpKernel* kernel;
+    const SequentialExecutionPlan::NodeExecutionPlan* node_exec_plan;
+  };
+
+  // An intermediate tensor in one of the recorded buffers.
+  struct RecordedValue {
+    int ort_value_idx;
+    MLDataType element_type;
+    TensorShape shape;
+    OrtMemoryInfo location;
+    size_t offset;
+  };
+
+  StaticShapeReplay() = default;
+
+  /** Returns true if no run has been recorded yet. */
+  bool NeedsRecording() const noexcept { return !recorded_.load(std::memory_order_acquire); }
+
+  /**
+   * Stores a recording of a run with the given feeds and fetches. Does nothing if another run was recorded first.
+   * @param values The recorded intermediate values. They must not include any of the fetches.
+   * @param buffers The memory pattern buffers holding the recorded values, keyed by location.
+   */
+  Status Record(const std::vector<int>& feed_mlvalue_idxs, const std::vector<OrtValue>& feeds,
+                const std::vector<int>& fetch_mlvalue_idxs, std::vector<Step> steps,
+                const std::vector<RecordedValue>& values, std::map<OrtMemoryInfo, BufferUniquePtr> buffers);
+
+  /**
+   * Starts a replay if a run with the same feed shapes and fetches was recorded and no other replay is in progress.
+   * Release must be called when the replay is done.
+   */
+  bool TryAcquire(const std::vector<int>& feed_mlvalue_idxs, const std::vector<OrtValue>& feeds,
+                  const std::vector<int>& fetch_mlvalue_idxs) noexcept;
+
+  /** Ends the replay started by TryAcquire. */
+  void Release() noexcept { in_use_.store(false, std::memory_order_release); }
+
+  /** The kernels of the recorded run in execution order. */
+  const std::vector<Step>& Steps() const noexcept { return steps_; }
+
+  /** Returns the recorded value for the index if it has the given shape, or nullptr. */
+  const OrtValue* GetValue(int ort_value_idx, const TensorShape& shape) const noexcept {
+    if (static_cast<size_t>(ort_value_idx) >= values_.size()) {
+      return nullptr;
+    }
+    const OrtValue& value = values_[ort_value_idx];
+    return value.IsAllocated() && value.Get<Tensor>().Shape() == shape ? &value : nullptr;
+  }
+
+  /** Returns the recorded shape for the index. */
+  bool TryGetShape(int ort_value_idx, TensorShape& shape) const;
+
+  /** Number of runs that have been replayed. */
+  size_t ReplayCount() const noexcept { return replay_count_.load(std::memory_order_relaxed); }
+
+ private:
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(StaticShapeReplay);
+
+  std::mutex record_mutex_;
+  std::atomic<bool> recorded_{false};
+  std::atomic<bool> in_use_{false};
+  std::atomic<size_t> replay_count_{0};
+
+  std::vector<int> feed_mlvalue_idxs_;
+  std::vector<TensorShape> feed_shapes_;
+  std::vector<int> fetch_mlvalue_idxs_;
+  std::vector<Step> steps_;
+
+  // Indexed by OrtValue index. Values that were not recorded are not allocated.
+  std::vector<OrtValue> values_;
+  std::map<OrtMemoryInfo, BufferUniquePtr> buffers_;
+};
+
+}  // namespace onnxruntime
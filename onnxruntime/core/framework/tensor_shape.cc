@@ -9,29 +9,18 @@
 
 namespace onnxruntime {
 
-TensorShape::TensorShape(const int64_t* dimension_sizes, size_t dimension_count)
-    : std::vector<int64_t>(dimension_count) {
-  for (size_t i = 0; i < dimension_count; ++i) {
-    (*this)[i] = dimension_sizes[i];
-  }
-}
-
-TensorShape::TensorShape(const std::vector<int64_t>& dims, size_t start, size_t end) {
-  assign(dims.begin() + start, dims.begin() + end);
-}
-
 /**
  * Return the total number of elements. Returns 1 for an empty (rank 0) TensorShape.
  */
 int64_t TensorShape::Size() const {
-  size_t arraySize = size();
+  size_t arraySize = values_.size();
   int64_t size = SizeHelper(0, arraySize);
   //should we cache the size? as multiple operation may be expensive.
   return size;
 }
 
 int64_t TensorShape::SizeToDimension(size_t dimension) const {
-  const size_t num_dims = size();
+  const size_t num_dims = values_.size();
   ORT_ENFORCE(dimension <= num_dims,
               "Invalid dimension of ", dimension, " for SizeFromDimension. Tensor has ",
               num_dims, " dimensions.");
@@ -41,7 +30,7 @@ int64_t TensorShape::SizeToDimension(size_t dimension) const {
 }
 
 int64_t TensorShape::SizeFromDimension(size_t dimension) const {
-  const size_t num_dims = size();
+  const size_t num_dims = values_.size();
   ORT_ENFORCE(dimension <= num_dims,
               "Invalid dimension of ", dimension, " for SizeFromDimension. Tensor has ",
               num_dims, " dimensions.");
@@ -51,13 +40,13 @@ int64_t TensorShape::SizeFromDimension(size_t dimension) const {
 }
 
 TensorShape TensorShape::Slice(size_t dimstart, size_t dimend) const {
-  ORT_ENFORCE(dimstart <= dimend && dimend <= size(),
+  ORT_ENFORCE(dimstart <= dimend && dimend <= values_.size(),
               "Invalid tensor shape slice argument.");
-  return TensorShape(*this, dimstart, dimend);
+  return TensorShape(GetDims().subspan(dimstart, dimend - dimstart));
 }
 
 TensorShape TensorShape::Slice(size_t dimstart) const {
-  return Slice(dimstart, size());
+  return Slice(dimstart, values_.size());
 }
 
 // output dimensions
@@ -66,7 +55,7 @@ std::string TensorShape::ToString() const {
 
   result.append("{");
   bool first = true;
-  for (auto dim : (*this)) {
+  for (auto dim : values_) {
     if (!first) {
       result.append(",");
     }
@@ -83,8 +72,8 @@ int64_t TensorShape::SizeHelper(size_t start, size_t end) const {
   // Must return 1 for an empty sequence
   SafeInt<int64_t> size = 1;  // this is used to calculate the size, which is used for memory allocations, so validate no overflow
   for (size_t i = start; i < end; i++) {
-    if ((*this)[i] < 0) return -1;
-    size *= (*this)[i];
+    if (values_[i] < 0) return -1;
+    size *= values_[i];
   }
   return size;
 }
@@ -1655,6 +1655,41 @@ Matrix product that behaves like numpy.matmul: https://docs.scipy.org/doc/numpy-
         FusedMatMulShapeInference(ctx);
       });
 
+  static const char* FusedElementwise_ver1_doc = R"DOC(
+Evaluates a chain of elementwise operators as a single operator, without writing the intermediate results to memory.
+
+The operators are evaluated in order. Each operator reads its operands from `operands`, two entries per operator.
+An operand below the number of inputs refers to that input, an operand of `number of inputs + k` refers to the
+result of operator k, and a unary operator has -1 as its second operand. The output is the result of the last
+operator.
+
+Supported operators are Add, Sub, Mul and Div, which broadcast their operands as in ONNX, and Abs, Erf, Exp, Neg,
+Reciprocal, Relu, Sigmoid, Sqrt and Tanh. Every input must either have the shape of the output, hold a single
+element, or match the trailing dimensions of the output.
+)DOC";
+
+  ONNX_CONTRIB_OPERATOR_SCHEMA(FusedElementwise)
+      .SetDomain(kMSDomain)
+      .SinceVersion(1)
+      .SetDoc(FusedElementwise_ver1_doc)
+      .Attr("ops", "Operator type of each step of the chain.", AttributeProto::STRINGS)
+      .Attr("operands", "Two operands for each operator.", AttributeProto::INTS)
+      .Input(0, "inputs", "Input tensors.", "T", OpSchema::Variadic)
+      .Output(0, "Y", "Result of the last operator.", "T")
+      .TypeConstraint("T", {"tensor(float)"}, "Constrain input and output types to float tensors.")
+      .TypeAndShapeInferenceFunction([](ONNX_NAMESPACE::InferenceContext& ctx) {
+        propagateElemTypeFromInputToOutput(ctx, 0, 0);
+
+        std::vector<const TensorShapeProto*> shapes;
+        for (size_t i = 0; i < ctx.getNumInputs(); ++i) {
+          if (!hasInputShape(ctx, i)) {
+            return;
+          }
+          shapes.push_back(&getInputShape(ctx, i));
+        }
+        multidirectionalBroadcastShapeInference(shapes, *getOutputShape(ctx, 0));
+      });
+
   ONNX_CONTRIB_OPERATOR_SCHEMA(MurmurHash3)
       .SetDomain(kMSDomain)
       .SinceVersion(1)
@@ -1794,6 +1829,53 @@ Example 4:
           "Constrain to tensor(float).")
       .SetDoc(R"DOC(The WordConvEmbedding takes in a batch of sequence words and embed each word to a vector.)DOC");
 
+  static const char* EmbeddingBag_ver1_doc = R"DOC(
+Gathers rows of `data` along its first axis and reduces each bag of rows to a single row. This computes Gather with
+axis 0 followed by ReduceSum or ReduceMean over the last axis of `indices`, without materializing the gathered rows.
+
+The last axis of `indices` enumerates the rows of each bag. The output has shape
+`indices.shape[:-1] + [1] + data.shape[1:]` when `keepdims` is 1 and `indices.shape[:-1] + data.shape[1:]`
+otherwise. Negative indices count back from the end of the first axis of `data`. An empty bag reduces to zeros.
+)DOC";
+
+  ONNX_CONTRIB_OPERATOR_SCHEMA(EmbeddingBag)
+      .SetDomain(kMSDomain)
+      .SinceVersion(1)
+      .SetDoc(EmbeddingBag_ver1_doc)
+      .Attr("mode", "How the rows of a bag are reduced: `sum` (default) or `mean`.", AttributeProto::STRING,
+            std::string("sum"))
+      .Attr("keepdims", "Keep the reduced bag dimension or not, default 1 means keep it.", AttributeProto::INT,
+            static_cast<int64_t>(1))
+      .Input(0, "data", "Tensor of rank r >= 1 whose first axis is indexed.", "T")
+      .Input(1, "indices", "Tensor of rank q >= 1 holding a bag of indices along its last axis.", "Tind")
+      .Output(0, "output", "Tensor of rank q + r - 2 + keepdims.", "T")
+      .TypeConstraint("T", {"tensor(float)"}, "Constrain input and output types to float tensors.")
+      .TypeConstraint("Tind", {"tensor(int32)", "tensor(int64)"}, "Constrain indices to integer types.")
+      .TypeAndShapeInferenceFunction([](ONNX_NAMESPACE::InferenceContext& ctx) {
+        propagateElemTypeFromInputToOutput(ctx, 0, 0);
+
+        if (!hasNInputShapes(ctx, 2)) {
+          return;
+        }
+
+        const auto& data_shape = getInputShape(ctx, 0);
+        const auto& indices_shape = getInputShape(ctx, 1);
+        if (data_shape.dim_size() < 1 || indices_shape.dim_size() < 1) {
+          fail_shape_inference("data and indices must have a rank of at least 1.");
+        }
+
+        auto* output_shape = getOutputShape(ctx, 0);
+        for (int i = 0; i < indices_shape.dim_size() - 1; ++i) {
+          *output_shape->add_dim() = indices_shape.dim(i);
+        }
+        if (getAttribute(ctx, "keepdims", 1) != 0) {
+          output_shape->add_dim()->set_dim_value(1);
+        }
+        for (int i = 1; i < data_shape.dim_size(); ++i) {
+          *output_shape->add_dim() = data_shape.dim(i);
+        }
+      });
+
   ONNX_CONTRIB_OPERATOR_SCHEMA(Pad)
       .SetDomain(kMSDomain)
       .SinceVersion(1)
@@ -174,7 +174,7 @@ void RegisterNhwcSchemas() {
       .SinceVersion(1)
       .Input(0, "x", "", "T")
       .Output(0, "y", "", "T")
-      .TypeConstraint("T", {"tensor(int8)", "tensor(uint8)"}, "")
+      .TypeConstraint("T", {"tensor(int8)", "tensor(uint8)", "tensor(float)"}, "")
       .Attr("auto_pad", "", AttributeProto::STRING, std::string("NOTSET"))
       .Attr("kernel_shape", "", AttributeProto::INTS)
       .Attr("dilations", "", AttributeProto::INTS, OPTIONAL_VALUE)
@@ -186,6 +186,31 @@ void RegisterNhwcSchemas() {
         convPoolShapeInferenceNhwc(ctx, true, true, 0, 1);
       });
 
+  ONNX_CONTRIB_OPERATOR_SCHEMA(NhwcFusedConv)
+      .SetDomain(kMSDomain)
+      .SinceVersion(1)
+      .SetDoc(R"DOC(
+NhwcFusedConv is a Conv that consumes and produces tensors in channels last format (N x D1 x ... x Dn x C).
+The filter is in the standard channels first format (M x C/group x k1 x ... x kn). The optional activation
+is applied to the output as in FusedConv.)DOC")
+      .Input(0, "X", "", "T")
+      .Input(1, "W", "", "T")
+      .Input(2, "B", "", "T", OpSchema::Optional)
+      .Output(0, "Y", "", "T")
+      .TypeConstraint("T", {"tensor(float)"}, "Constrain input and output types to float tensors")
+      .Attr("auto_pad", "", AttributeProto::STRING, std::string("NOTSET"))
+      .Attr("kernel_shape", "", AttributeProto::INTS, OPTIONAL_VALUE)
+      .Attr("dilations", "", AttributeProto::INTS, OPTIONAL_VALUE)
+      .Attr("strides", "", AttributeProto::INTS, OPTIONAL_VALUE)
+      .Attr("pads", "", AttributeProto::INTS, OPTIONAL_VALUE)
+      .Attr("group", "", AttributeProto::INT, static_cast<int64_t>(1))
+      .Attr("activation", "", AttributeProto::STRING, OPTIONAL_VALUE)
+      .Attr("activation_params", "", AttributeProto::FLOATS, OPTIONAL_VALUE)
+      .TypeAndShapeInferenceFunction([](InferenceContext& ctx) {
+        propagateElemTypeFromInputToOutput(ctx, 0, 0);
+        convPoolShapeInferenceNhwc(ctx, true, false, 0, 1);
+      });
+
   ONNX_CONTRIB_OPERATOR_SCHEMA(QLinearGlobalAveragePool)
       .SetDomain(kMSDomain)
       .SinceVersion(1)
@@ -428,6 +428,60 @@ C (int32) = (A - A_zero_point) * (B - B_zero_point)
         ONNX_NAMESPACE::matmulShapeInference(ctx, 0, 1);
       });
 
+  ONNX_CONTRIB_OPERATOR_SCHEMA(MatMulNBits)
+      .SetDomain(kMSDomain)
+      .SinceVersion(1)
+      .SetDoc(R"DOC(
+MatMulNBits computes Y = A * B, where A is a float tensor and B is a 2D weight matrix of shape [K, N] quantized
+to 'bits' bits (only 4 is currently supported) along the K dimension in blocks of 'block_size' elements. Each
+block of each column has its own scale and optional zero point:
+
+  B[k, n] = (quantized(B)[k, n] - zero_point[k / block_size, n]) * scale[k / block_size, n]
+
+Input B is stored column by column with shape [N, n_blocks_per_col, blob_size], where
+n_blocks_per_col = (K + block_size - 1) / block_size and blob_size = block_size * bits / 8. Two 4-bit
+elements are packed to a byte, with the element at the lower K index in the low nibble. The padding of the final
+block of a column is ignored.
+Input scales has shape [N * n_blocks_per_col]. Input zero_points is optional and has shape
+[N * ((n_blocks_per_col + 1) / 2)], packing the zero points of two consecutive blocks of a column to a byte
+with the lower block in the low nibble. The zero point defaults to 8 (2^(bits - 1)) if not provided.
+)DOC")
+      .Attr("K", "size of each input feature", AttributeProto::INT)
+      .Attr("N", "size of each output feature", AttributeProto::INT)
+      .Attr("bits", "number of bits used for weight quantization (default 4)", AttributeProto::INT, static_cast<int64_t>(4))
+      .Attr("block_size", "number of groupsize used for weight quantization, must be a power of 2 from 16 to 256", AttributeProto::INT)
+      .Input(0, "A", "The input tensor, not quantized", "T1")
+      .Input(1, "B", "1-dimensional data blob", "T2")
+      .Input(2, "scales", "quantization scale", "T1")
+      .Input(3, "zero_points", "quantization zero points", "T2", OpSchema::Optional)
+      .Output(0, "Y", "tensor. The output tensor has the same rank as the input. ", "T1")
+      .TypeConstraint("T1", {"tensor(float)"}, "Constrain input A, scales and output Y data type as float tensor.")
+      .TypeConstraint("T2", {"tensor(uint8)"}, "Constrain quantized weight types to uint8.")
+      .TypeAndShapeInferenceFunction([](ONNX_NAMESPACE::InferenceContext& ctx) {
+        propagateElemTypeFromInputToOutput(ctx, 0, 0);
+
+        const auto* n_attr = ctx.getAttribute("N");
+        if (n_attr == nullptr || !n_attr->has_i()) {
+          fail_shape_inference("Attribute 'N' is required.");
+        }
+
+        if (!hasInputShape(ctx, 0)) {
+          return;
+        }
+
+        const auto& a_shape = getInputShape(ctx, 0);
+        if (a_shape.dim_size() == 0) {
+          fail_shape_inference("Input A must have at least 1 dimension.");
+        }
+
+        ONNX_NAMESPACE::TensorShapeProto y_shape;
+        for (int i = 0; i < a_shape.dim_size() - 1; ++i) {
+          *y_shape.add_dim() = a_shape.dim(i);
+        }
+        y_shape.add_dim()->set_dim_value(n_attr->i());
+        updateOutputShape(ctx, 0, y_shape);
+      });
+
   ONNX_CONTRIB_OPERATOR_SCHEMA(QLinearAdd)
       .SetDomain(kMSDomain)
       .SinceVersion(1)
@@ -2618,6 +2618,10 @@ bool Graph::IsInitializedTensor(const std::string& name) const {
   return name_to_initial_tensor_.count(name) > 0;
 }
 
+bool Graph::IsSparseInitializer(const std::string& name) const {
+  return sparse_tensor_names_.count(name) > 0;
+}
+
 void Graph::RemoveInitializedTensor(const std::string& tensor_name) {
   bool found = false;
   auto iter = name_to_initial_tensor_.find(tensor_name);
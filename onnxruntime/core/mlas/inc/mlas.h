@@ -118,6 +118,12 @@ enum MLAS_ACTIVATION_KIND {
     MlasTanhActivation,
     MlasLogisticActivation,
     MlasClipActivation,
+    MlasHardSigmoidActivation,
+    MlasGeluActivation,
+    MlasSiluActivation,
+    MlasSoftplusActivation,
+    MlasMishActivation,
+    MlasHardSwishActivation,
 };
 
 struct MLAS_ACTIVATION {
@@ -130,6 +136,10 @@ struct MLAS_ACTIVATION {
             float minimum;
             float maximum;
         } Clip;
+        struct {
+            float alpha;
+            float beta;
+        } HardSigmoid;
         float Values[2];
     } Parameters;
 };
@@ -280,10 +290,17 @@ private:
     MLAS_QUANTIZATION_GRANULARITY QuantGran_;
 };
 
+//
+// N.B. When AIsSigned is true, the elements of matrix A and ZeroPointA are
+// interpreted as int8_t values reinterpreted through the uint8_t fields of
+// MLAS_GEMM_U8X8_DATA_PARAMS.
+//
+
 struct MLAS_GEMM_U8X8_SHAPE_PARAMS {
     size_t M = 0;
     size_t N = 0;
     size_t K = 0;
+    bool AIsSigned = false;
     bool BIsSigned = false;
 };
 
@@ -313,7 +330,7 @@ MlasGemm(
 /** 
  * @brief Batched GEMM, for multiplying multiple pairs of matrices. 
  * Note:  We only support uniform batching, so shapes and types of the
- *        input must be same: M, N, K, BIsSigned must be the
+ *        input must be same: M, N, K, AIsSigned, BIsSigned must be the
  *        same across all parameter blocks. 
  * 
  * @param [IN]  Shape        A single shape descriptor for all the multiplications
@@ -330,6 +347,48 @@ MlasGemmBatch(
     MLAS_THREADPOOL* ThreadPool
     );
 
+//
+// Sparse GEMM routines.
+//
+// C = alpha * A * B where one of the source matrices is sparse. A sparse A
+// matrix is supplied in compressed sparse row form and a sparse B matrix in
+// compressed sparse column form. The offsets arrays hold one element more
+// than the number of rows (or columns), the last being the number of nonzero
+// values. The existing contents of matrix C are overwritten.
+//
+
+void
+MLASCALL
+MlasSparseGemmCsrA(
+    size_t M,
+    size_t N,
+    float alpha,
+    const float* AValues,
+    const uint32_t* AColumnIndices,
+    const size_t* ARowOffsets,
+    const float* B,
+    size_t ldb,
+    float* C,
+    size_t ldc,
+    MLAS_THREADPOOL* ThreadPool
+    );
+
+void
+MLASCALL
+MlasSparseGemmCscB(
+    size_t M,
+    size_t N,
+    float alpha,
+    const float* A,
+    size_t lda,
+    const float* BValues,
+    const uint32_t* BRowIndices,
+    const size_t* BColumnOffsets,
+    float* C,
+    size_t ldc,
+    MLAS_THREADPOOL* ThreadPool
+    );
+
 //
 // Buffer packing routines.
 //
@@ -371,6 +430,89 @@ MlasGemmPackB(
     void* PackedB
     );
 
+//
+// Blockwise 4-bit quantized matrix/matrix multiply routines.
+//
+// Matrix B is quantized along K in blocks of BlockSize elements with a float
+// scale and a 4-bit zero point per block and column. Matrix B must be packed
+// with MlasQ4GemmPackB before invoking MlasQ4GemmBatch.
+//
+
+struct MLAS_Q4_GEMM_DATA_PARAMS {
+    const float* A = nullptr;
+    size_t lda = 0;
+    const void* PackedB = nullptr;
+    float* C = nullptr;
+    size_t ldc = 0;
+    const float* Bias = nullptr;
+};
+
+/**
+ * @brief Returns the size of the packed buffer for a blockwise 4-bit
+ *        quantized matrix B.
+ *
+ * @param N          Number of columns of matrix B
+ * @param K          Number of rows of matrix B
+ * @param BlockSize  Number of elements along K sharing a scale and zero
+ *                   point, a power of two from 16 to 256
+ * @return Size of the packed buffer in bytes, 0 if BlockSize is unsupported
+ */
+size_t
+MLASCALL
+MlasQ4GemmPackBSize(
+    size_t N,
+    size_t K,
+    size_t BlockSize
+    );
+
+/**
+ * @brief Packs a blockwise 4-bit quantized matrix B.
+ *
+ * @param PackedB     Destination buffer of MlasQ4GemmPackBSize bytes
+ * @param QuantData   Quantized elements with shape [N][BlockCountK][BlockSize/2],
+ *                    two elements per byte with the lower K index in the
+ *                    low nibble
+ * @param Scales      Scales with shape [N][BlockCountK]
+ * @param ZeroPoints  Optional zero points with shape [N][(BlockCountK+1)/2],
+ *                    two blocks per byte with the lower block in the low
+ *                    nibble. The zero point is 8 when nullptr.
+ */
+void
+MLASCALL
+MlasQ4GemmPackB(
+    void* PackedB,
+    const uint8_t* QuantData,
+    const float* Scales,
+    const uint8_t* ZeroPoints,
+    size_t N,
+    size_t K,
+    size_t BlockSize
+    );
+
+/**
+ * @brief Batched multiply of a float matrix A by a packed blockwise 4-bit
+ *        quantized matrix B: C = A * B + Bias.
+ *
+ * @param M           Number of rows of matrix A and matrix C
+ * @param N           Number of columns of matrix B and matrix C
+ * @param K           Number of columns of matrix A and rows of matrix B
+ * @param BlockSize   Quantization block size used to pack matrix B
+ * @param DataParams  Array of data descriptors for the matrices
+ * @param BatchN      Size of the parameters array
+ * @param ThreadPool  optional thread pool for parallel processing
+ */
+void
+MLASCALL
+MlasQ4GemmBatch(
+    size_t M,
+    size_t N,
+    size_t K,
+    size_t BlockSize,
+    const MLAS_Q4_GEMM_DATA_PARAMS* DataParams,
+    size_t BatchN,
+    MLAS_THREADPOOL* ThreadPool
+    );
+
 //
 // Convolution routines.
 //
@@ -379,9 +521,8 @@ enum MLAS_CONV_ALGORITHM {
     MlasConvAlgorithmGemmDirect,
     MlasConvAlgorithmExpandThenGemm,
     MlasConvAlgorithmExpandThenGemmSegmented,
-#if defined(MLAS_TARGET_WASM)
     MlasConvAlgorithmDepthwise,
-#endif
+    MlasConvAlgorithmWinograd,
 };
 
 struct MLAS_CONV_PARAMETERS {
@@ -410,6 +551,16 @@ struct MLAS_CONV_PARAMETERS {
         struct {
             size_t ThreadStrideN;
         } ExpandThenGemmSegmented;
+        struct {
+            size_t PaddedHeight;
+            size_t PhaseWidth;
+        } Depthwise;
+        struct {
+            size_t TileSize;
+            size_t TileRowsPerBlock;
+            size_t FilterBlockSize;
+            const float* TransformedFilter;
+        } Winograd;
     } u;
 };
 
@@ -445,6 +596,52 @@ MlasConv(
     MLAS_THREADPOOL* ThreadPool
     );
 
+//
+// Winograd convolution filter transform routines. When MlasConvPrepare selects
+// MlasConvAlgorithmWinograd, the caller may set u.Winograd.TransformedFilter to
+// filters transformed with the same tile size to avoid transforming the filters
+// on every call to MlasConv. MlasConvWinogradIsSupported and
+// MlasConvWinogradTileSize report the selection MlasConvPrepare will make.
+//
+
+bool
+MLASCALL
+MlasConvWinogradIsSupported(
+    size_t Dimensions,
+    const int64_t* KernelShape,
+    const int64_t* DilationShape,
+    const int64_t* StrideShape,
+    size_t InputChannels,
+    size_t FilterCount
+    );
+
+size_t
+MLASCALL
+MlasConvWinogradTileSize(
+    size_t OutputHeight,
+    size_t OutputWidth
+    );
+
+size_t
+MLASCALL
+MlasConvWinogradTransformedFilterSize(
+    size_t TileSize,
+    size_t GroupCount,
+    size_t FilterCount,
+    size_t InputChannels
+    );
+
+void
+MLASCALL
+MlasConvWinogradTransformFilter(
+    size_t TileSize,
+    size_t GroupCount,
+    size_t FilterCount,
+    size_t InputChannels,
+    const float* Filter,
+    float* TransformedFilter
+    );
+
 void
 MLASCALL
 MlasConvDepthwise(
@@ -459,6 +656,19 @@ MlasConvDepthwise(
     size_t KernelSize
     );
 
+void
+MLASCALL
+MlasConvDepthwise(
+    const float* const* Input,
+    const float* Filter,
+    const float* Bias,
+    float* Output,
+    size_t Channels,
+    size_t OutputCount,
+    size_t KernelSize,
+    const MLAS_ACTIVATION* Activation
+    );
+
 //
 // Pooling routines.
 //
@@ -495,6 +705,16 @@ MlasMaximumPool(
     size_t KernelSize
     );
 
+void
+MLASCALL
+MlasMaximumPool(
+    const float* const* Input,
+    float* Output,
+    size_t Channels,
+    size_t OutputCount,
+    size_t KernelSize
+    );
+
 //
 // Miscellaneous compute routines.
 //
@@ -515,6 +735,22 @@ MlasComputeExp(
     size_t N
     );
 
+void
+MLASCALL
+MlasComputeGelu(
+    const float* Input,
+    float* Output,
+    size_t N
+    );
+
+void
+MLASCALL
+MlasComputeHardSwish(
+    const float* Input,
+    float* Output,
+    size_t N
+    );
+
 void
 MLASCALL
 MlasComputeLogistic(
@@ -523,6 +759,22 @@ MlasComputeLogistic(
     size_t N
     );
 
+void
+MLASCALL
+MlasComputeMish(
+    const float* Input,
+    float* Output,
+    size_t N
+    );
+
+void
+MLASCALL
+MlasComputeSilu(
+    const float* Input,
+    float* Output,
+    size_t N
+    );
+
 void
 MLASCALL
 MlasComputeSoftmax(
@@ -534,6 +786,14 @@ MlasComputeSoftmax(
     MLAS_THREADPOOL* ThreadPool
     );
 
+void
+MLASCALL
+MlasComputeSoftplus(
+    const float* Input,
+    float* Output,
+    size_t N
+    );
+
 void
 MLASCALL
 MlasComputeTanh(
@@ -542,6 +802,70 @@ MlasComputeTanh(
     size_t N
     );
 
+//
+// Reduction routines.
+//
+// MlasReduceRows reduces each of the Rows rows of Columns contiguous elements
+// to one output element. MlasReduceColumns reduces each of the Columns
+// columns of Rows rows, which are InputStride elements apart, to one output
+// element. Rows and Columns must be non-zero.
+//
+
+enum MLAS_REDUCTION_KIND {
+    MlasSumReduction,
+    MlasMaximumReduction,
+    MlasMinimumReduction,
+    MlasLogSumExpReduction,
+    MlasReductionKindCount,
+};
+
+void
+MLASCALL
+MlasReduceRows(
+    MLAS_REDUCTION_KIND ReductionKind,
+    const float* Input,
+    float* Output,
+    size_t Rows,
+    size_t Columns
+    );
+
+void
+MLASCALL
+MlasReduceColumns(
+    MLAS_REDUCTION_KIND ReductionKind,
+    const float* Input,
+    size_t InputStride,
+    float* Output,
+    size_t Rows,
+    size_t Columns
+    );
+
+//
+// Layer normalization routines.
+//
+// Normalizes one row of D elements: the optional Skip and Bias rows are first
+// added to Input, then the sum is normalized to zero mean and unit variance
+// (or unit root mean square when Simplified is true) and scaled by Gamma and
+// offset by the optional Beta. Mean and InvStdDev optionally receive the row
+// statistics.
+//
+
+void
+MLASCALL
+MlasComputeLayerNormalization(
+    const float* Input,
+    const float* Skip,
+    const float* Bias,
+    const float* Gamma,
+    const float* Beta,
+    float* Output,
+    size_t D,
+    float Epsilon,
+    bool Simplified,
+    float* Mean,
+    float* InvStdDev
+    );
+
 //
 // Half-precision floating-point routines.
 //
@@ -555,6 +879,15 @@ MlasConvertHalfToFloatBuffer(
     size_t Count
     );
 
+extern "C"
+void
+MLASCALL
+MlasConvertFloatToHalfBuffer(
+    const float* Source,
+    unsigned short* Destination,
+    size_t Count
+    );
+
 //
 // Transpose routines.
 //
@@ -586,6 +919,55 @@ MlasTranspose(
     size_t N
     );
 
+//
+// Strided transpose routines: the rows of the input and output matrices are
+// InputStride and OutputStride elements apart.
+//
+
+void
+MLASCALL
+MlasTranspose(
+    const uint8_t* Input,
+    size_t InputStride,
+    uint8_t* Output,
+    size_t OutputStride,
+    size_t M,
+    size_t N
+    );
+
+void
+MLASCALL
+MlasTranspose(
+    const uint16_t* Input,
+    size_t InputStride,
+    uint16_t* Output,
+    size_t OutputStride,
+    size_t M,
+    size_t N
+    );
+
+void
+MLASCALL
+MlasTranspose(
+    const uint32_t* Input,
+    size_t InputStride,
+    uint32_t* Output,
+    size_t OutputStride,
+    size_t M,
+    size_t N
+    );
+
+void
+MLASCALL
+MlasTranspose(
+    const uint64_t* Input,
+    size_t InputStride,
+    uint64_t* Output,
+    size_t OutputStride,
+    size_t M,
+    size_t N
+    );
+
 //
 // Buffer reordering routines.
 //
@@ -698,17 +1080,18 @@ MlasQuantizeLinear(
     OutputType ZeroPoint
     );
 
+template<typename OutputType>
 void
 MLASCALL
 MlasRequantizeOutput(
     const int32_t* Input,
-    uint8_t* Output,
+    OutputType* Output,
     const int32_t* Bias,
     size_t M,
     size_t N,
     const float* Scale,
     bool PerColumnScale,
-    uint8_t ZeroPoint
+    OutputType ZeroPoint
     );
 
 void
@@ -193,6 +193,35 @@ struct MLAS_ACTIVATION_FUNCTION<MlasClipActivation>
     }
 };
 
+template<>
+struct MLAS_ACTIVATION_FUNCTION<MlasHardSigmoidActivation>
+{
+    MLAS_FLOAT32X4 AlphaBroadcast;
+    MLAS_FLOAT32X4 BetaBroadcast;
+    const MLAS_FLOAT32X4 ZeroFloat32x4 = MlasZeroFloat32x4();
+    const MLAS_FLOAT32X4 OneFloat32x4 = MlasBroadcastFloat32x4(1.0f);
+
+    MLAS_ACTIVATION_FUNCTION(const MLAS_ACTIVATION* Activation)
+    {
+        AlphaBroadcast = MlasBroadcastFloat32x4(&Activation->Parameters.HardSigmoid.alpha);
+        BetaBroadcast = MlasBroadcastFloat32x4(&Activation->Parameters.HardSigmoid.beta);
+    }
+
+    MLAS_FLOAT32X4 Activate(MLAS_FLOAT32X4 Value)
+    {
+        Value = MlasMultiplyAddFloat32x4(Value, AlphaBroadcast, BetaBroadcast);
+        Value = MlasMinimumFloat32x4(OneFloat32x4, Value);
+        Value = MlasMaximumFloat32x4(ZeroFloat32x4, Value);
+
+        return Value;
+    }
+
+    float Activate(float Value)
+    {
+        return MlasExtractLaneFloat32x4<0>(Activate(MlasBroadcastFloat32x4(Value)));
+    }
+};
+
 template<MLAS_ACTIVATION_KIND ActivationKind, bool AddBias>
 void
 MlasActivationKernel(
@@ -365,6 +394,61 @@ Return Value:
     }
 }
 
+void
+MlasActivationUnaryFunction(
+    MLAS_COMPUTE_UNARY_FLOAT_KERNEL* UnaryFunction,
+    const MLAS_ACTIVATION* Activation,
+    float* Buffer,
+    const float* Bias,
+    size_t M,
+    size_t N,
+    size_t ldc
+    )
+/*++
+
+Routine Description:
+
+    This routine applies an activation function that is computed by one of the
+    elementwise compute routines to the output matrix after optionally adding
+    a bias vector.
+
+Arguments:
+
+    UnaryFunction - Supplies the elementwise compute routine.
+
+    Activation - Supplies the parameters for the activation.
+
+    Buffer - Supplies the output matrix.
+
+    Bias - Supplies the optional bias vector.
+
+    M - Supplies the number of elements of the bias vector and the number of
+        rows in the output matrix.
+
+    N - Supplies the number of columns of the output matrix.
+
+    ldc - Supplies the number of elements per row of the output matrix.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    if (Bias != nullptr) {
+        MlasActivationKernel<MlasIdentityActivation, true>(Activation, Buffer, Bias, M, N, ldc);
+    }
+
+    if (N == ldc) {
+        UnaryFunction(Buffer, Buffer, M * N);
+    } else {
+        while (M-- > 0) {
+            UnaryFunction(Buffer, Buffer, N);
+            Buffer += ldc;
+        }
+    }
+}
+
 void
 MLASCALL
 MlasActivation(
@@ -425,37 +509,13 @@ Return Value:
 
         case MlasTanhActivation:
         {
-            if (Bias != nullptr) {
-                MlasActivationKernel<MlasIdentityActivation, true>(Activation, Buffer, Bias, M, N, ldc);
-            }
-
-            if (N == ldc) {
-                MlasComputeTanh(Buffer, Buffer, M * N);
-            } else {
-                while (M-- > 0) {
-                    MlasComputeTanh(Buffer, Buffer, N);
-                    Buffer += ldc;
-                }
-            }
-
+            MlasActivationUnaryFunction(MlasComputeTanh, Activation, Buffer, Bias, M, N, ldc);
             break;
         }
 
         case MlasLogisticActivation:
         {
-            if (Bias != nullptr) {
-                MlasActivationKernel<MlasIdentityActivation, true>(Activation, Buffer, Bias, M, N, ldc);
-            }
-
-            if (N == ldc) {
-                MlasComputeLogistic(Buffer, Buffer, M * N);
-            } else {
-                while (M-- > 0) {
-                    MlasComputeLogistic(Buffer, Buffer, N);
-                    Buffer += ldc;
-                }
-            }
-
+            MlasActivationUnaryFunction(MlasComputeLogistic, Activation, Buffer, Bias, M, N, ldc);
             break;
         }
 
@@ -464,5 +524,41 @@ Return Value:
             MlasActivationKernel<MlasClipActivation>(Activation, Buffer, Bias, M, N, ldc);
             break;
         }
+
+        case MlasHardSigmoidActivation:
+        {
+            MlasActivationKernel<MlasHardSigmoidActivation>(Activation, Buffer, Bias, M, N, ldc);
+            break;
+        }
+
+        case MlasGeluActivation:
+        {
+            MlasActivationUnaryFunction(MlasComputeGelu, Activation, Buffer, Bias, M, N, ldc);
+            break;
+        }
+
+        case MlasSiluActivation:
+        {
+            MlasActivationUnaryFunction(MlasComputeSilu, Activation, Buffer, Bias, M, N, ldc);
+            break;
+        }
+
+        case MlasSoftplusActivation:
+        {
+            MlasActivationUnaryFunction(MlasComputeSoftplus, Activation, Buffer, Bias, M, N, ldc);
+            break;
+        }
+
+        case MlasMishActivation:
+        {
+            MlasActivationUnaryFunction(MlasComputeMish, Activation, Buffer, Bias, M, N, ldc);
+            break;
+        }
+
+        case MlasHardSwishActivation:
+        {
+            MlasActivationUnaryFunction(MlasComputeHardSwish, Activation, Buffer, Bias, M, N, ldc);
+            break;
+        }
     }
 }
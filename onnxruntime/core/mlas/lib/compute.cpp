@@ -277,6 +277,412 @@ Return Value:
 #endif
 }
 
+//
+// Bundles the constants for the activation functions built on the exponential
+// function.
+//
+
+MLAS_INTERNAL_DATA const struct {
+    float MishUpperRange;
+    float GeluScale;
+    float HardSwishAlpha;
+    float HardSwishBeta;
+    float Log1p_15;
+    float Log1p_13;
+    float Log1p_11;
+    float Log1p_9;
+    float Log1p_7;
+    float Log1p_5;
+    float Log1p_3;
+    float Log1p_1;
+} MlasActivationConstants = {
+    20.0f,
+    0.70710678118654752440f,
+    1.0f / 6.0f,
+    0.5f,
+    2.0f / 15.0f,
+    2.0f / 13.0f,
+    2.0f / 11.0f,
+    2.0f / 9.0f,
+    2.0f / 7.0f,
+    2.0f / 5.0f,
+    2.0f / 3.0f,
+    2.0f,
+};
+
+//
+// Templates for the activation functions that are computed one vector at a
+// time.
+//
+
+struct MLAS_SOFTPLUS_FUNCTION
+{
+    static
+    MLAS_FORCEINLINE
+    MLAS_FLOAT32X4
+    Compute(
+        MLAS_FLOAT32X4 Vector
+        )
+    {
+        //
+        // Compute "max(x, 0) + log1p(exp(-|x|))" so that the exponential
+        // cannot overflow. The logarithm is computed as "2 * atanh(y / (2 + y))"
+        // for y in (0, 1], where the series converges quickly as the argument
+        // is at most 1/3.
+        //
+
+        const MLAS_FLOAT32X4 ZeroVector = MlasZeroFloat32x4();
+
+        MLAS_FLOAT32X4 NegativeAbsolute = MlasMinimumFloat32x4(MlasXorFloat32x4(Vector,
+            MlasBroadcastFloat32x4(-0.0f)), Vector);
+        MLAS_FLOAT32X4 y = MlasComputeExpVector(NegativeAbsolute);
+
+        MLAS_FLOAT32X4 s = MlasDivideFloat32x4(y, MlasAddFloat32x4(y, MlasBroadcastFloat32x4(2.0f)));
+        MLAS_FLOAT32X4 s2 = MlasMultiplyFloat32x4(s, s);
+
+        MLAS_FLOAT32X4 p = MlasBroadcastFloat32x4(MlasActivationConstants.Log1p_15);
+        p = MlasMultiplyAddFloat32x4(p, s2, MlasActivationConstants.Log1p_13);
+        p = MlasMultiplyAddFloat32x4(p, s2, MlasActivationConstants.Log1p_11);
+        p = MlasMultiplyAddFloat32x4(p, s2, MlasActivationConstants.Log1p_9);
+        p = MlasMultiplyAddFloat32x4(p, s2, MlasActivationConstants.Log1p_7);
+        p = MlasMultiplyAddFloat32x4(p, s2, MlasActivationConstants.Log1p_5);
+        p = MlasMultiplyAddFloat32x4(p, s2, MlasActivationConstants.Log1p_3);
+        p = MlasMultiplyAddFloat32x4(p, s2, MlasActivationConstants.Log1p_1);
+
+        return MlasMultiplyAddFloat32x4(p, s, MlasMaximumFloat32x4(ZeroVector, Vector));
+    }
+};
+
+struct MLAS_MISH_FUNCTION
+{
+    static
+    MLAS_FORCEINLINE
+    MLAS_FLOAT32X4
+    Compute(
+        MLAS_FLOAT32X4 Vector
+        )
+    {
+        //
+        // Compute "x * tanh(log(1 + exp(x)))" as "x * n / (n + 2)" where
+        // "n = exp(x) * (exp(x) + 2)". The ratio is one for inputs above the
+        // upper range.
+        //
+
+        MLAS_FLOAT32X4 e = MlasComputeExpVector(MlasMinimumFloat32x4(
+            MlasBroadcastFloat32x4(MlasActivationConstants.MishUpperRange), Vector));
+        MLAS_FLOAT32X4 n = MlasMultiplyFloat32x4(e, MlasAddFloat32x4(e, MlasBroadcastFloat32x4(2.0f)));
+        MLAS_FLOAT32X4 Ratio = MlasDivideFloat32x4(n, MlasAddFloat32x4(n, MlasBroadcastFloat32x4(2.0f)));
+
+        return MlasMultiplyFloat32x4(Vector, Ratio);
+    }
+};
+
+struct MLAS_HARD_SWISH_FUNCTION
+{
+    static
+    MLAS_FORCEINLINE
+    MLAS_FLOAT32X4
+    Compute(
+        MLAS_FLOAT32X4 Vector
+        )
+    {
+        MLAS_FLOAT32X4 Gate = MlasMultiplyAddFloat32x4(Vector,
+            MlasBroadcastFloat32x4(MlasActivationConstants.HardSwishAlpha),
+            MlasActivationConstants.HardSwishBeta);
+
+        Gate = MlasClampFloat32x4(Gate, 0.0f, 1.0f);
+
+        return MlasMultiplyFloat32x4(Vector, Gate);
+    }
+};
+
+template<typename Function>
+void
+MlasComputeUnaryKernel(
+    const float* Input,
+    float* Output,
+    size_t N
+    )
+/*++
+
+Routine Description:
+
+    This routine steps over the input buffer and invokes the templated
+    activation function.
+
+    N.B. This implementation supports in place updates of the output buffer.
+
+Arguments:
+
+    Input - Supplies the input buffer.
+
+    Output - Supplies the output buffer.
+
+    N - Supplies the number of elements to process.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    while (N >= 4) {
+
+        MlasStoreFloat32x4(Output, Function::Compute(MlasLoadFloat32x4(Input)));
+
+        Input += 4;
+        Output += 4;
+        N -= 4;
+    }
+
+    while (N > 0) {
+
+        MLAS_FLOAT32X4 Vector = Function::Compute(MlasBroadcastFloat32x4(Input));
+
+        MlasStoreLaneFloat32x4<0>(Output, Vector);
+
+        Input += 1;
+        Output += 1;
+        N -= 1;
+    }
+}
+
+void
+MLASCALL
+MlasComputeSoftplus(
+    const float* Input,
+    float* Output,
+    size_t N
+    )
+/*++
+
+Routine Description:
+
+    This routine computes the softplus function, log(1 + exp(x)).
+
+    N.B. This implementation supports in place updates of the output buffer.
+
+Arguments:
+
+    Input - Supplies the input buffer.
+
+    Output - Supplies the output buffer.
+
+    N - Supplies the number of elements to process.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    MlasComputeUnaryKernel<MLAS_SOFTPLUS_FUNCTION>(Input, Output, N);
+}
+
+void
+MLASCALL
+MlasComputeMish(
+    const float* Input,
+    float* Output,
+    size_t N
+    )
+/*++
+
+Routine Description:
+
+    This routine computes the mish function, x * tanh(softplus(x)).
+
+    N.B. This implementation supports in place updates of the output buffer.
+
+Arguments:
+
+    Input - Supplies the input buffer.
+
+    Output - Supplies the output buffer.
+
+    N - Supplies the number of elements to process.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    MlasComputeUnaryKernel<MLAS_MISH_FUNCTION>(Input, Output, N);
+}
+
+void
+MLASCALL
+MlasComputeHardSwish(
+    const float* Input,
+    float* Output,
+    size_t N
+    )
+/*++
+
+Routine Description:
+
+    This routine computes the hard swish function, x * max(0, min(1, x / 6 + 0.5)).
+
+    N.B. This implementation supports in place updates of the output buffer.
+
+Arguments:
+
+    Input - Supplies the input buffer.
+
+    Output - Supplies the output buffer.
+
+    N - Supplies the number of elements to process.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    MlasComputeUnaryKernel<MLAS_HARD_SWISH_FUNCTION>(Input, Output, N);
+}
+
+//
+// Number of elements processed per block by the activation functions that
+// are computed from the output of another kernel.
+//
+
+constexpr size_t MLAS_ACTIVATION_BLOCK_SIZE = 256;
+
+void
+MLASCALL
+MlasComputeGelu(
+    const float* Input,
+    float* Output,
+    size_t N
+    )
+/*++
+
+Routine Description:
+
+    This routine computes the gaussian error linear unit, 0.5 * x * (1 + erf(x / sqrt(2))).
+
+    The input is processed in blocks that stay resident in the cache, so that
+    the platform specific error function kernel can be used.
+
+    N.B. This implementation supports in place updates of the output buffer.
+
+Arguments:
+
+    Input - Supplies the input buffer.
+
+    Output - Supplies the output buffer.
+
+    N - Supplies the number of elements to process.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    MLAS_DECLSPEC_ALIGN(float Buffer[MLAS_ACTIVATION_BLOCK_SIZE], 64);
+
+    const MLAS_FLOAT32X4 ScaleVector = MlasBroadcastFloat32x4(MlasActivationConstants.GeluScale);
+    const MLAS_FLOAT32X4 HalfVector = MlasBroadcastFloat32x4(0.5f);
+
+    while (N > 0) {
+
+        const size_t BlockSize = std::min(N, MLAS_ACTIVATION_BLOCK_SIZE);
+        size_t n = 0;
+
+        for (; n + 4 <= BlockSize; n += 4) {
+            MlasStoreFloat32x4(&Buffer[n], MlasMultiplyFloat32x4(MlasLoadFloat32x4(&Input[n]), ScaleVector));
+        }
+
+        for (; n < BlockSize; n++) {
+            Buffer[n] = Input[n] * MlasActivationConstants.GeluScale;
+        }
+
+        MlasComputeErf(Buffer, Buffer, BlockSize);
+
+        for (n = 0; n + 4 <= BlockSize; n += 4) {
+            MLAS_FLOAT32X4 HalfInput = MlasMultiplyFloat32x4(MlasLoadFloat32x4(&Input[n]), HalfVector);
+            MlasStoreFloat32x4(&Output[n], MlasMultiplyAddFloat32x4(HalfInput, MlasLoadFloat32x4(&Buffer[n]), HalfInput));
+        }
+
+        for (; n < BlockSize; n++) {
+            float HalfInput = Input[n] * 0.5f;
+            Output[n] = HalfInput * Buffer[n] + HalfInput;
+        }
+
+        Input += BlockSize;
+        Output += BlockSize;
+        N -= BlockSize;
+    }
+}
+
+void
+MLASCALL
+MlasComputeSilu(
+    const float* Input,
+    float* Output,
+    size_t N
+    )
+/*++
+
+Routine Description:
+
+    This routine computes the sigmoid linear unit (also known as swish),
+    x * logistic(x).
+
+    The input is processed in blocks that stay resident in the cache, so that
+    the platform specific logistic kernel can be used.
+
+    N.B. This implementation supports in place updates of the output buffer.
+
+Arguments:
+
+    Input - Supplies the input buffer.
+
+    Output - Supplies the output buffer.
+
+    N - Supplies the number of elements to process.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    MLAS_DECLSPEC_ALIGN(float Buffer[MLAS_ACTIVATION_BLOCK_SIZE], 64);
+
+    const MLAS_FLOAT32X4 ZeroVector = MlasZeroFloat32x4();
+
+    while (N > 0) {
+
+        const size_t BlockSize = std::min(N, MLAS_ACTIVATION_BLOCK_SIZE);
+        size_t n = 0;
+
+        MlasComputeLogistic(Input, Buffer, BlockSize);
+
+        //
+        // The logistic kernel approximates the function with a rational
+        // polynomial that can be slightly negative for large negative inputs,
+        // so clamp the gate to keep the sign of the product.
+        //
+
+        for (; n + 4 <= BlockSize; n += 4) {
+            MLAS_FLOAT32X4 Gate = MlasMaximumFloat32x4(ZeroVector, MlasLoadFloat32x4(&Buffer[n]));
+            MlasStoreFloat32x4(&Output[n], MlasMultiplyFloat32x4(MlasLoadFloat32x4(&Input[n]), Gate));
+        }
+
+        for (; n < BlockSize; n++) {
+            Output[n] = Input[n] * std::max(0.0f, Buffer[n]);
+        }
+
+        Input += BlockSize;
+        Output += BlockSize;
+        N -= BlockSize;
+    }
+}
+
 MLAS_FORCEINLINE
 MLAS_FLOAT32X4
 MlasComputeSumExpVector(
@@ -989,3 +1395,476 @@ Return Value:
 
     MlasExecuteThreaded(MlasComputeSoftmaxThreaded, &WorkBlock, ThreadCountN, ThreadPool);
 }
+
+//
+// Define the vector and scalar operations of the reductions that combine
+// elements pairwise.
+//
+
+struct MLAS_REDUCE_SUM_OPERATION {
+
+    static MLAS_FLOAT32X4 Reduce(MLAS_FLOAT32X4 Vector0, MLAS_FLOAT32X4 Vector1)
+    {
+        return MlasAddFloat32x4(Vector0, Vector1);
+    }
+
+    static float Reduce(float Value0, float Value1)
+    {
+        return Value0 + Value1;
+    }
+
+    static float ReduceVector(MLAS_FLOAT32X4 Vector)
+    {
+        return MlasReduceAddFloat32x4(Vector);
+    }
+};
+
+struct MLAS_REDUCE_MAXIMUM_OPERATION {
+
+    static MLAS_FLOAT32X4 Reduce(MLAS_FLOAT32X4 Vector0, MLAS_FLOAT32X4 Vector1)
+    {
+        return MlasMaximumFloat32x4(Vector0, Vector1);
+    }
+
+    static float Reduce(float Value0, float Value1)
+    {
+        return std::max(Value0, Value1);
+    }
+
+    static float ReduceVector(MLAS_FLOAT32X4 Vector)
+    {
+        return MlasReduceMaximumFloat32x4(Vector);
+    }
+};
+
+struct MLAS_REDUCE_MINIMUM_OPERATION {
+
+    static MLAS_FLOAT32X4 Reduce(MLAS_FLOAT32X4 Vector0, MLAS_FLOAT32X4 Vector1)
+    {
+        return MlasMinimumFloat32x4(Vector0, Vector1);
+    }
+
+    static float Reduce(float Value0, float Value1)
+    {
+        return std::min(Value0, Value1);
+    }
+
+    static float ReduceVector(MLAS_FLOAT32X4 Vector)
+    {
+        return MlasReduceMinimumFloat32x4(Vector);
+    }
+};
+
+template<typename ReduceOperation>
+float
+MlasReduceRowKernel(
+    const float* Input,
+    size_t N
+    )
+/*++
+
+Routine Description:
+
+    This routine reduces the supplied buffer to a single value.
+
+Arguments:
+
+    Input - Supplies the input buffer.
+
+    N - Supplies the number of elements to process. Must be non-zero.
+
+Return Value:
+
+    Returns the reduced value.
+
+--*/
+{
+    if (N < 4) {
+
+        float Value = Input[0];
+
+        for (size_t n = 1; n < N; n++) {
+            Value = ReduceOperation::Reduce(Value, Input[n]);
+        }
+
+        return Value;
+    }
+
+    MLAS_FLOAT32X4 Vector0 = MlasLoadFloat32x4(Input);
+
+    Input += 4;
+    N -= 4;
+
+    if (N >= 12) {
+
+        //
+        // Use independent accumulators to hide the latency of the reduction.
+        //
+
+        MLAS_FLOAT32X4 Vector1 = MlasLoadFloat32x4(Input);
+        MLAS_FLOAT32X4 Vector2 = MlasLoadFloat32x4(Input + 4);
+        MLAS_FLOAT32X4 Vector3 = MlasLoadFloat32x4(Input + 8);
+
+        Input += 12;
+        N -= 12;
+
+        while (N >= 16) {
+
+            Vector0 = ReduceOperation::Reduce(Vector0, MlasLoadFloat32x4(Input));
+            Vector1 = ReduceOperation::Reduce(Vector1, MlasLoadFloat32x4(Input + 4));
+            Vector2 = ReduceOperation::Reduce(Vector2, MlasLoadFloat32x4(Input + 8));
+            Vector3 = ReduceOperation::Reduce(Vector3, MlasLoadFloat32x4(Input + 12));
+
+            Input += 16;
+            N -= 16;
+        }
+
+        Vector0 = ReduceOperation::Reduce(Vector0, Vector1);
+        Vector2 = ReduceOperation::Reduce(Vector2, Vector3);
+        Vector0 = ReduceOperation::Reduce(Vector0, Vector2);
+    }
+
+    while (N >= 4) {
+
+        Vector0 = ReduceOperation::Reduce(Vector0, MlasLoadFloat32x4(Input));
+
+        Input += 4;
+        N -= 4;
+    }
+
+    float Value = ReduceOperation::ReduceVector(Vector0);
+
+    while (N > 0) {
+
+        Value = ReduceOperation::Reduce(Value, *Input);
+
+        Input += 1;
+        N -= 1;
+    }
+
+    return Value;
+}
+
+template<typename ReduceOperation>
+void
+MlasReduceColumnsKernel(
+    const float* Input,
+    size_t InputStride,
+    float* Output,
+    size_t Rows,
+    size_t Columns
+    )
+/*++
+
+Routine Description:
+
+    This routine reduces each column of the supplied matrix to a single value.
+
+Arguments:
+
+    Input - Supplies the input matrix.
+
+    InputStride - Supplies the number of elements between the rows of the
+        input matrix.
+
+    Output - Supplies the output buffer.
+
+    Rows - Supplies the number of rows to process. Must be non-zero.
+
+    Columns - Supplies the number of columns to process.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    while (Columns >= 16) {
+
+        const float* input = Input;
+
+        MLAS_FLOAT32X4 Vector0 = MlasLoadFloat32x4(input);
+        MLAS_FLOAT32X4 Vector1 = MlasLoadFloat32x4(input + 4);
+        MLAS_FLOAT32X4 Vector2 = MlasLoadFloat32x4(input + 8);
+        MLAS_FLOAT32X4 Vector3 = MlasLoadFloat32x4(input + 12);
+
+        for (size_t r = 1; r < Rows; r++) {
+
+            input += InputStride;
+
+            Vector0 = ReduceOperation::Reduce(Vector0, MlasLoadFloat32x4(input));
+            Vector1 = ReduceOperation::Reduce(Vector1, MlasLoadFloat32x4(input + 4));
+            Vector2 = ReduceOperation::Reduce(Vector2, MlasLoadFloat32x4(input + 8));
+            Vector3 = ReduceOperation::Reduce(Vector3, MlasLoadFloat32x4(input + 12));
+        }
+
+        MlasStoreFloat32x4(Output, Vector0);
+        MlasStoreFloat32x4(Output + 4, Vector1);
+        MlasStoreFloat32x4(Output + 8, Vector2);
+        MlasStoreFloat32x4(Output + 12, Vector3);
+
+        Input += 16;
+        Output += 16;
+        Columns -= 16;
+    }
+
+    while (Columns >= 4) {
+
+        const float* input = Input;
+
+        MLAS_FLOAT32X4 Vector = MlasLoadFloat32x4(input);
+
+        for (size_t r = 1; r < Rows; r++) {
+            input += InputStride;
+            Vector = ReduceOperation::Reduce(Vector, MlasLoadFloat32x4(input));
+        }
+
+        MlasStoreFloat32x4(Output, Vector);
+
+        Input += 4;
+        Output += 4;
+        Columns -= 4;
+    }
+
+    while (Columns > 0) {
+
+        const float* input = Input;
+
+        float Value = *input;
+
+        for (size_t r = 1; r < Rows; r++) {
+            input += InputStride;
+            Value = ReduceOperation::Reduce(Value, *input);
+        }
+
+        *Output = Value;
+
+        Input += 1;
+        Output += 1;
+        Columns -= 1;
+    }
+}
+
+void
+MLASCALL
+MlasReduceRows(
+    MLAS_REDUCTION_KIND ReductionKind,
+    const float* Input,
+    float* Output,
+    size_t Rows,
+    size_t Columns
+    )
+/*++
+
+Routine Description:
+
+    This routine reduces each row of the supplied matrix to a single value.
+
+Arguments:
+
+    ReductionKind - Supplies the kind of reduction.
+
+    Input - Supplies the input matrix.
+
+    Output - Supplies the output buffer.
+
+    Rows - Supplies the number of rows to process.
+
+    Columns - Supplies the number of columns per row to process.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    for (size_t r = 0; r < Rows; r++) {
+
+        switch (ReductionKind) {
+
+            case MlasSumReduction:
+            {
+                *Output = MlasReduceRowKernel<MLAS_REDUCE_SUM_OPERATION>(Input, Columns);
+                break;
+            }
+
+            case MlasMaximumReduction:
+            {
+#if defined(MLAS_TARGET_AMD64)
+                *Output = MlasPlatform.ReduceMaximumF32Kernel(Input, Columns);
+#else
+                *Output = MlasReduceMaximumF32Kernel(Input, Columns);
+#endif
+                break;
+            }
+
+            case MlasMinimumReduction:
+            {
+                *Output = MlasReduceRowKernel<MLAS_REDUCE_MINIMUM_OPERATION>(Input, Columns);
+                break;
+            }
+
+            case MlasLogSumExpReduction:
+            {
+#if defined(MLAS_TARGET_AMD64)
+                float Maximum = MlasPlatform.ReduceMaximumF32Kernel(Input, Columns);
+#else
+                float Maximum = MlasReduceMaximumF32Kernel(Input, Columns);
+#endif
+
+                //
+                // An infinite maximum is also the result of the reduction.
+                //
+
+                if (std::isinf(Maximum)) {
+                    *Output = Maximum;
+                    break;
+                }
+
+                float NegativeMaximum = -Maximum;
+
+#if defined(MLAS_TARGET_AMD64)
+                float Accumulation = MlasPlatform.ComputeSumExpF32Kernel(Input, nullptr, Columns, &NegativeMaximum);
+#else
+                float Accumulation = MlasComputeSumExpF32Kernel(Input, nullptr, Columns, &NegativeMaximum);
+#endif
+
+                *Output = std::log(Accumulation) + Maximum;
+                break;
+            }
+
+            default:
+#ifdef MLAS_NO_EXCEPTION
+                abort();
+#else
+                throw std::runtime_error("bad reduction kind");
+#endif
+        }
+
+        Input += Columns;
+        Output += 1;
+    }
+}
+
+void
+MLASCALL
+MlasReduceColumns(
+    MLAS_REDUCTION_KIND ReductionKind,
+    const float* Input,
+    size_t InputStride,
+    float* Output,
+    size_t Rows,
+    size_t Columns
+    )
+/*++
+
+Routine Description:
+
+    This routine reduces each column of the supplied matrix to a single value.
+
+Arguments:
+
+    ReductionKind - Supplies the kind of reduction.
+
+    Input - Supplies the input matrix.
+
+    InputStride - Supplies the number of elements between the rows of the
+        input matrix.
+
+    Output - Supplies the output buffer.
+
+    Rows - Supplies the number of rows to process.
+
+    Columns - Supplies the number of columns to process.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    switch (ReductionKind) {
+
+        case MlasSumReduction:
+        {
+            MlasReduceColumnsKernel<MLAS_REDUCE_SUM_OPERATION>(Input, InputStride, Output, Rows, Columns);
+            break;
+        }
+
+        case MlasMaximumReduction:
+        {
+            MlasReduceColumnsKernel<MLAS_REDUCE_MAXIMUM_OPERATION>(Input, InputStride, Output, Rows, Columns);
+            break;
+        }
+
+        case MlasMinimumReduction:
+        {
+            MlasReduceColumnsKernel<MLAS_REDUCE_MINIMUM_OPERATION>(Input, InputStride, Output, Rows, Columns);
+            break;
+        }
+
+        case MlasLogSumExpReduction:
+        {
+            //
+            // Find the maximum of each column, then accumulate the exponential
+            // functions of the columns reduced by their maximum.
+            //
+
+            MlasReduceColumnsKernel<MLAS_REDUCE_MAXIMUM_OPERATION>(Input, InputStride, Output, Rows, Columns);
+
+            size_t c = 0;
+
+            for (; c + 4 <= Columns; c += 4) {
+
+                MLAS_FLOAT32X4 MaximumVector = MlasLoadFloat32x4(Output + c);
+                MLAS_FLOAT32X4 NegativeMaximumVector = MlasSubtractFloat32x4(MlasZeroFloat32x4(), MaximumVector);
+                MLAS_FLOAT32X4 AccumulatorVector = MlasZeroFloat32x4();
+
+                const float* input = Input + c;
+
+                for (size_t r = 0; r < Rows; r++) {
+                    AccumulatorVector = MlasAddFloat32x4(AccumulatorVector,
+                        MlasComputeSumExpVector(MlasLoadFloat32x4(input), NegativeMaximumVector));
+                    input += InputStride;
+                }
+
+                float Accumulation[4];
+                MlasStoreFloat32x4(Accumulation, AccumulatorVector);
+
+                for (size_t i = 0; i < 4; i++) {
+                    float Maximum = Output[c + i];
+                    Output[c + i] = std::isinf(Maximum) ? Maximum : std::log(Accumulation[i]) + Maximum;
+                }
+            }
+
+            for (; c < Columns; c++) {
+
+                float Maximum = Output[c];
+
+                if (std::isinf(Maximum)) {
+                    continue;
+                }
+
+                float Accumulation = 0.0f;
+
+                const float* input = Input + c;
+
+                for (size_t r = 0; r < Rows; r++) {
+                    Accumulation += std::exp(*input - Maximum);
+                    input += InputStride;
+                }
+
+                Output[c] = std::log(Accumulation) + Maximum;
+            }
+
+            break;
+        }
+
+        default:
+#ifdef MLAS_NO_EXCEPTION
+            abort();
+#else
+            throw std::runtime_error("bad reduction kind");
+#endif
+    }
+}
@@ -42,6 +42,32 @@ struct MLAS_CONV_WORK_BLOCK {
     ptrdiff_t TargetThreadCount;
 };
 
+size_t
+MlasConvDepthwiseWorkingBufferSizePerThread(
+    const MLAS_CONV_PARAMETERS* Parameters
+    )
+/*++
+
+Routine Description:
+
+    This routine returns the number of elements of the working buffer used by
+    each thread of a depthwise convolution to hold a padded input channel.
+
+Arguments:
+
+    Parameters - Supplies the structure that contains the convolution
+        parameters.
+
+Return Value:
+
+    Returns the number of elements per thread.
+
+--*/
+{
+    return Parameters->u.Depthwise.PaddedHeight * Parameters->StrideShape[1] *
+        Parameters->u.Depthwise.PhaseWidth;
+}
+
 void
 MlasConvIm2Col(
     const MLAS_CONV_PARAMETERS* Parameters,
@@ -728,6 +754,89 @@ Return Value:
     }
 }
 
+#if !defined(MLAS_TARGET_WASM_SCALAR)
+
+void
+MlasConvDepthwiseThreaded(
+    void* Context,
+    ptrdiff_t Index
+    )
+/*++
+
+Routine Description:
+
+    This routine is invoked from a worker thread to execute a segment of a
+    depthwise convolution operation.
+
+Arguments:
+
+    Context - Supplies the pointer to the context for the threaded operation.
+
+    Index - Supplies the current index of the threaded operation.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    MLAS_CONV_WORK_BLOCK* WorkBlock = (MLAS_CONV_WORK_BLOCK*)Context;
+
+    const MLAS_CONV_PARAMETERS* Parameters = WorkBlock->Parameters;
+
+    //
+    // Compute the range of channels to use for this thread.
+    //
+
+    const size_t GroupCount = Parameters->GroupCount;
+    const size_t BatchGroupCount = Parameters->BatchCount * GroupCount;
+
+    size_t BatchGroupStart;
+    size_t BatchGroupRemaining;
+
+    MlasPartitionWork(Index, WorkBlock->TargetThreadCount, BatchGroupCount,
+        &BatchGroupStart, &BatchGroupRemaining);
+
+    size_t BatchGroupEnd = BatchGroupStart + BatchGroupRemaining;
+
+    //
+    // Each thread pads its input channels into a private slice of the working
+    // buffer.
+    //
+
+    const size_t InputSize = Parameters->InputSize;
+    const size_t OutputSize = Parameters->OutputSize;
+    const size_t K = Parameters->K;
+
+    float* WorkingBuffer = WorkBlock->WorkingBuffer +
+        Index * MlasConvDepthwiseWorkingBufferSizePerThread(Parameters);
+
+    for (size_t bg = BatchGroupStart; bg < BatchGroupEnd; bg++) {
+
+        size_t group = bg % GroupCount;
+
+        const float* input = WorkBlock->Input + bg * InputSize;
+        const float* filter = WorkBlock->Filter + group * K;
+        float* output = WorkBlock->Output + bg * OutputSize;
+
+        MlasConvDepthwiseFloat(Parameters, input, filter, output, WorkingBuffer);
+
+        //
+        // Apply the activation with optional bias.
+        //
+
+        const float* bias = WorkBlock->Bias;
+
+        if (bias != nullptr) {
+            bias += group;
+        }
+
+        MlasActivation(Parameters->Activation, output, bias, 1, OutputSize, OutputSize);
+    }
+}
+
+#endif
+
 inline
 bool
 MlasConvTryMultithread(
@@ -842,7 +951,8 @@ Arguments:
 
     Input - Supplies the input tensor.
 
-    Filter - Supplies the filter tensor.
+    Filter - Supplies the filter tensor. This may be nullptr if the Winograd
+        algorithm is selected and u.Winograd.TransformedFilter is supplied.
 
     Bias - Optionally supplies the bias vector.
 
@@ -902,6 +1012,31 @@ Return Value:
         return;
     }
 
+#if !defined(MLAS_TARGET_WASM_SCALAR)
+
+    //
+    // Schedule the depthwise channels across multiple threads.
+    //
+
+    if (Algorithm == MlasConvAlgorithmDepthwise) {
+
+        MLAS_CONV_WORK_BLOCK WorkBlock;
+
+        WorkBlock.Parameters = Parameters;
+        WorkBlock.Input = Input;
+        WorkBlock.Filter = Filter;
+        WorkBlock.Bias = Bias;
+        WorkBlock.WorkingBuffer = WorkingBuffer;
+        WorkBlock.Output = Output;
+        WorkBlock.TargetThreadCount = Parameters->ThreadCount;
+
+        MlasExecuteThreaded(MlasConvDepthwiseThreaded, &WorkBlock, Parameters->ThreadCount, ThreadPool);
+
+        return;
+    }
+
+#endif
+
 #if defined(MLAS_TARGET_WASM_SCALAR)
 
     if (Algorithm == MlasConvAlgorithmDepthwise) {
@@ -974,17 +1109,34 @@ Return Value:
                     break;
                 }
 
-#if defined(MLAS_TARGET_WASM_SCALAR)
+                case MlasConvAlgorithmWinograd:
+                {
+                    const float* TransformedFilter = Parameters->u.Winograd.TransformedFilter;
+
+                    if (TransformedFilter != nullptr) {
+                        TransformedFilter += group * MlasConvWinogradTransformedFilterSize(
+                            Parameters->u.Winograd.TileSize, 1, FilterCount, Parameters->InputChannels);
+                    }
+
+                    MlasConvWinograd(Parameters, Input, filter, TransformedFilter, bias,
+                        WorkingBuffer, Output, ThreadPool);
+
+                    break;
+                }
 
                 case MlasConvAlgorithmDepthwise:
                 {
+#if defined(MLAS_TARGET_WASM_SCALAR)
                     MlasConvDepthwiseFloat_CHW(Parameters, Input, filter, Output, WorkingBuffer);
                     MlasActivation(Parameters->Activation, Output, bias, FilterCount, OutputSize, OutputSize);
+#endif
+                    //
+                    // Other targets schedule the depthwise convolution above.
+                    //
+
                     break;
                 }
 
-#endif
-
                 case MlasConvAlgorithmExpandThenGemmSegmented:
                 {
                     //
@@ -1010,7 +1162,14 @@ Return Value:
                 bias += FilterCount;
             }
 
-            filter += FilterGroupSize;
+            //
+            // The filter may be nullptr if the Winograd algorithm is supplied
+            // with transformed filters.
+            //
+
+            if (filter != nullptr) {
+                filter += FilterGroupSize;
+            }
             Input += InputGroupSize;
             Output += OutputGroupSize;
         }
@@ -1128,6 +1287,9 @@ Return Value:
     Parameters->OutputSize = OutputSize;
     Parameters->K = K;
 
+    const bool UseWinograd = MlasConvWinogradIsSupported(Dimensions, KernelShape,
+        DilationShape, StrideShape, InputChannels, FilterCount);
+
     //
     // Promote 1D convolutions to 2D convolutions.
     //
@@ -1203,6 +1365,19 @@ Return Value:
         }
     }
 
+    //
+    // Detect a 3x3 convolution with unit stride and dilation where the channel
+    // counts are large enough for the Winograd algorithm to amortize the cost
+    // of the tile transforms.
+    //
+
+    if (UseWinograd) {
+
+        MlasConvWinogradPrepare(Parameters, WorkingBufferSize, ThreadPool);
+
+        return;
+    }
+
     if (FilterCount > OutputSize) {
 
         //
@@ -1234,6 +1409,57 @@ Return Value:
             return;
         }
 
+#else
+
+        //
+        // Detect a depthwise convolution with a 3x3 or 5x5 kernel. Each
+        // channel is padded into a working buffer and then convolved with a
+        // vectorized direct kernel.
+        //
+
+        if (Dimensions == 2 && FilterCount == 1 && InputChannels == 1 &&
+            Parameters->KernelShape[0] == Parameters->KernelShape[1] &&
+            (Parameters->KernelShape[0] == 3 || Parameters->KernelShape[0] == 5) &&
+            Parameters->StrideShape[0] <= 2 && Parameters->StrideShape[1] <= 2) {
+
+            const size_t StrideWidth = Parameters->StrideShape[1];
+
+            const size_t PaddedHeight = (Parameters->OutputShape[0] - 1) * Parameters->StrideShape[0] +
+                (Parameters->KernelShape[0] - 1) * Parameters->DilationShape[0] + 1;
+            const size_t PaddedWidth = (Parameters->OutputShape[1] - 1) * StrideWidth +
+                (Parameters->KernelShape[1] - 1) * Parameters->DilationShape[1] + 1;
+
+            Parameters->Algorithm = MlasConvAlgorithmDepthwise;
+            Parameters->u.Depthwise.PaddedHeight = PaddedHeight;
+            Parameters->u.Depthwise.PhaseWidth = (PaddedWidth + StrideWidth - 1) / StrideWidth;
+
+            //
+            // Compute the number of target threads given the complexity of the
+            // convolution operation. Threads are assigned whole channels.
+            //
+
+            const size_t BatchGroupCount = BatchCount * GroupCount;
+            const double Complexity = double(BatchGroupCount) * double(OutputSize) * double(K);
+
+            ptrdiff_t TargetThreadCount = ptrdiff_t(Complexity / double(MLAS_SGEMM_THREAD_COMPLEXITY)) + 1;
+            ptrdiff_t MaximumThreadCount = MlasGetMaximumThreadCount(ThreadPool);
+
+            if (TargetThreadCount >= MaximumThreadCount) {
+                TargetThreadCount = MaximumThreadCount;
+            }
+
+            if (size_t(TargetThreadCount) >= BatchGroupCount) {
+                TargetThreadCount = ptrdiff_t(BatchGroupCount);
+            }
+
+            Parameters->ThreadCount = TargetThreadCount;
+
+            *WorkingBufferSize = size_t(TargetThreadCount) *
+                MlasConvDepthwiseWorkingBufferSizePerThread(Parameters);
+
+            return;
+        }
+
 #endif
 
         //
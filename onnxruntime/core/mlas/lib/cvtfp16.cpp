@@ -0,0 +1,267 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    cvtfp16.cpp
+
+Abstract:
+
+    This module implements routines to convert between FP16 and FP32 formats.
+
+    The portable kernels operate on the bit patterns of the values so that the
+    results match the hardware conversion instructions: single precision values
+    are rounded to the nearest half precision value with ties to even, values
+    too large to represent become infinity, and denormals are handled in both
+    directions.
+
+--*/
+
+#include "mlasi.h"
+
+MLAS_FORCEINLINE
+unsigned short
+MlasConvertFloatToHalf(
+    float Value
+    )
+/*++
+
+Routine Description:
+
+    This routine converts a single precision value to half precision.
+
+Arguments:
+
+    Value - Supplies the value to convert.
+
+Return Value:
+
+    Returns the half precision bit pattern of the value.
+
+--*/
+{
+    const uint32_t Bits = MlasBitsOfFp32(Value);
+    const uint32_t Sign = Bits & 0x80000000;
+    uint32_t Magnitude = Bits ^ Sign;
+    uint32_t Half;
+
+    if (Magnitude >= 0x47800000) {
+
+        //
+        // The value overflows to infinity or is a NaN, which is made quiet.
+        //
+
+        Half = (Magnitude > 0x7F800000) ? 0x7E00 : 0x7C00;
+
+    } else if (Magnitude < 0x38800000) {
+
+        //
+        // The value is a half precision denormal or zero. Adding 0.5f aligns
+        // the mantissa such that the floating point unit does the rounding.
+        //
+
+        Half = MlasBitsOfFp32(MlasFp32FromBits(Magnitude) + 0.5f) - 0x3F000000;
+
+    } else {
+
+        //
+        // Rebias the exponent and round the mantissa to nearest even.
+        //
+
+        const uint32_t MantissaOdd = (Magnitude >> 13) & 1;
+        Magnitude += 0xC8000FFF + MantissaOdd;
+        Half = Magnitude >> 13;
+    }
+
+    return static_cast<unsigned short>(Half | (Sign >> 16));
+}
+
+MLAS_FORCEINLINE
+float
+MlasConvertHalfToFloat(
+    unsigned short Value
+    )
+/*++
+
+Routine Description:
+
+    This routine converts a half precision value to single precision.
+
+Arguments:
+
+    Value - Supplies the half precision bit pattern to convert.
+
+Return Value:
+
+    Returns the single precision value.
+
+--*/
+{
+    constexpr uint32_t ShiftedExponent = 0x7C00 << 13;
+
+    uint32_t Bits = (uint32_t(Value) & 0x7FFF) << 13;
+
+    const uint32_t Exponent = Bits & ShiftedExponent;
+    Bits += (127 - 15) << 23;
+
+    if (Exponent == ShiftedExponent) {
+
+        //
+        // Infinity or NaN: extend the exponent to all ones.
+        //
+
+        Bits += (128 - 16) << 23;
+
+    } else if (Exponent == 0) {
+
+        //
+        // Zero or denormal: renormalize through the floating point unit.
+        //
+
+        Bits += 1 << 23;
+        Bits = MlasBitsOfFp32(MlasFp32FromBits(Bits) - MlasFp32FromBits(113 << 23));
+    }
+
+    Bits |= (uint32_t(Value) & 0x8000) << 16;
+
+    return MlasFp32FromBits(Bits);
+}
+
+void
+MLASCALL
+MlasConvertFloatToHalfKernel(
+    const float* Source,
+    unsigned short* Destination,
+    size_t Count
+    )
+/*++
+
+Routine Description:
+
+    This routine converts the source buffer of single precision floats to the
+    destination buffer of half precision floats.
+
+Arguments:
+
+    Source - Supplies the source buffer of single precision floats.
+
+    Destination - Supplies the destination buffer of half precision floats.
+
+    Count - Supplies the number of elements to convert.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    for (size_t i = 0; i < Count; i++) {
+        Destination[i] = MlasConvertFloatToHalf(Source[i]);
+    }
+}
+
+void
+MLASCALL
+MlasConvertHalfToFloatKernel(
+    const unsigned short* Source,
+    float* Destination,
+    size_t Count
+    )
+/*++
+
+Routine Description:
+
+    This routine converts the source buffer of half precision floats to the
+    destination buffer of single precision floats.
+
+Arguments:
+
+    Source - Supplies the source buffer of half precision floats.
+
+    Destination - Supplies the destination buffer of single precision floats.
+
+    Count - Supplies the number of elements to convert.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    for (size_t i = 0; i < Count; i++) {
+        Destination[i] = MlasConvertHalfToFloat(Source[i]);
+    }
+}
+
+void
+MLASCALL
+MlasConvertFloatToHalfBuffer(
+    const float* Source,
+    unsigned short* Destination,
+    size_t Count
+    )
+/*++
+
+Routine Description:
+
+    This routine converts the source buffer of single precision floats to the
+    destination buffer of half precision floats, rounding to nearest even.
+
+Arguments:
+
+    Source - Supplies the source buffer of single precision floats.
+
+    Destination - Supplies the destination buffer of half precision floats.
+
+    Count - Supplies the number of elements to convert.
+
+Return Value:
+
+    None.
+
+--*/
+{
+#if defined(MLAS_TARGET_AMD64)
+    MlasPlatform.ConvertFloatToHalfKernel(Source, Destination, Count);
+#else
+    MlasConvertFloatToHalfKernel(Source, Destination, Count);
+#endif
+}
+
+void
+MLASCALL
+MlasConvertHalfToFloatBuffer(
+    const unsigned short* Source,
+    float* Destination,
+    size_t Count
+    )
+/*++
+
+Routine Description:
+
+    This routine converts the source buffer of half precision floats to the
+    destination buffer of single precision floats.
+
+Arguments:
+
+    Source - Supplies the source buffer of half precision floats.
+
+    Destination - Supplies the destination buffer of single precision floats.
+
+    Count - Supplies the number of elements to convert.
+
+Return Value:
+
+    None.
+
+--*/
+{
+#if defined(MLAS_TARGET_AMD64)
+    MlasPlatform.ConvertHalfToFloatKernel(Source, Destination, Count);
+#else
+    MlasConvertHalfToFloatKernel(Source, Destination, Count);
+#endif
+}
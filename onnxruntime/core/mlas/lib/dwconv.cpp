@@ -0,0 +1,429 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    dwconv.cpp
+
+Abstract:
+
+    This module implements the single precision depthwise convolution routines
+    for tensors in channels last and channels first formats.
+
+--*/
+
+#include "mlasi.h"
+
+void
+MLASCALL
+MlasConvDepthwise(
+    const float* const* Input,
+    const float* Filter,
+    const float* Bias,
+    float* Output,
+    size_t Channels,
+    size_t OutputCount,
+    size_t KernelSize,
+    const MLAS_ACTIVATION* Activation
+    )
+/*++
+
+Routine Description:
+
+    This routine implements the single precision depthwise convolution
+    operation for tensors in channels last format.
+
+    The input is supplied as an indirection buffer. Every pointer in the
+    indirection buffer points at a Channels length vector (either from the
+    input tensor or a vector of padding values). These are grouped in batches
+    of length KernelSize that are processed by the kernel to produce a single
+    output of length Channels. These batches are then repeated OutputCount
+    times.
+
+Arguments:
+
+    Input - Supplies an indirection buffer to the elements of the input tensor.
+
+    Filter - Supplies the filter tensor in [KernelSize][Channels] order.
+
+    Bias - Optionally supplies the bias vector of length Channels.
+
+    Output - Supplies the output tensor in channels last format.
+
+    Channels - Supplies the number of channels.
+
+    OutputCount - Supplies the number of channel sized output elements to
+        produce.
+
+    KernelSize - Supplies the total number of channel sized kernel elements to
+        consume.
+
+    Activation - Optionally supplies the activation to apply to the output.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    float* OutputStart = Output;
+    const size_t TotalOutputCount = OutputCount;
+
+    while (OutputCount > 0) {
+
+        size_t ChannelOffset = 0;
+        size_t c = Channels;
+
+        while (c >= 8) {
+
+            MLAS_FLOAT32X4 Accumulator0 = MlasZeroFloat32x4();
+            MLAS_FLOAT32X4 Accumulator1 = MlasZeroFloat32x4();
+
+            if (Bias != nullptr) {
+                Accumulator0 = MlasLoadFloat32x4(&Bias[ChannelOffset]);
+                Accumulator1 = MlasLoadFloat32x4(&Bias[ChannelOffset + 4]);
+            }
+
+            size_t ChannelKernelOffset = ChannelOffset;
+
+            for (size_t k = 0; k < KernelSize; k++) {
+
+                MLAS_FLOAT32X4 InputVector0 = MlasLoadFloat32x4(&Input[k][ChannelOffset]);
+                MLAS_FLOAT32X4 InputVector1 = MlasLoadFloat32x4(&Input[k][ChannelOffset + 4]);
+                MLAS_FLOAT32X4 FilterVector0 = MlasLoadFloat32x4(&Filter[ChannelKernelOffset]);
+                MLAS_FLOAT32X4 FilterVector1 = MlasLoadFloat32x4(&Filter[ChannelKernelOffset + 4]);
+
+                Accumulator0 = MlasMultiplyAddFloat32x4(InputVector0, FilterVector0, Accumulator0);
+                Accumulator1 = MlasMultiplyAddFloat32x4(InputVector1, FilterVector1, Accumulator1);
+                ChannelKernelOffset += Channels;
+            }
+
+            MlasStoreFloat32x4(&Output[0], Accumulator0);
+            MlasStoreFloat32x4(&Output[4], Accumulator1);
+            Output += 8;
+
+            ChannelOffset += 8;
+            c -= 8;
+        }
+
+        if (c >= 4) {
+
+            MLAS_FLOAT32X4 Accumulator0 = MlasZeroFloat32x4();
+
+            if (Bias != nullptr) {
+                Accumulator0 = MlasLoadFloat32x4(&Bias[ChannelOffset]);
+            }
+
+            size_t ChannelKernelOffset = ChannelOffset;
+
+            for (size_t k = 0; k < KernelSize; k++) {
+
+                MLAS_FLOAT32X4 InputVector0 = MlasLoadFloat32x4(&Input[k][ChannelOffset]);
+                MLAS_FLOAT32X4 FilterVector0 = MlasLoadFloat32x4(&Filter[ChannelKernelOffset]);
+
+                Accumulator0 = MlasMultiplyAddFloat32x4(InputVector0, FilterVector0, Accumulator0);
+                ChannelKernelOffset += Channels;
+            }
+
+            MlasStoreFloat32x4(&Output[0], Accumulator0);
+            Output += 4;
+
+            ChannelOffset += 4;
+            c -= 4;
+        }
+
+        while (c > 0) {
+
+            float Accumulator = (Bias != nullptr) ? Bias[ChannelOffset] : 0.0f;
+            size_t ChannelKernelOffset = ChannelOffset;
+
+            for (size_t k = 0; k < KernelSize; k++) {
+                Accumulator += Input[k][ChannelOffset] * Filter[ChannelKernelOffset];
+                ChannelKernelOffset += Channels;
+            }
+
+            *Output++ = Accumulator;
+
+            ChannelOffset += 1;
+            c -= 1;
+        }
+
+        Input += KernelSize;
+        OutputCount -= 1;
+    }
+
+    //
+    // Apply the activation to the output block, which is still resident in
+    // the cache.
+    //
+
+    if (Activation != nullptr && Activation->ActivationKind != MlasIdentityActivation) {
+        MlasActivation(Activation, OutputStart, nullptr, TotalOutputCount, Channels, Channels);
+    }
+}
+
+void
+MlasConvDepthwisePadInput(
+    const MLAS_CONV_PARAMETERS* Parameters,
+    const float* Input,
+    float* PaddedInput
+    )
+/*++
+
+Routine Description:
+
+    This routine copies a single channel of the input tensor to the working
+    buffer with the zero padding applied.
+
+    Each padded row is split into StrideWidth phases so that the elements used
+    by consecutive output columns for a given kernel column are contiguous.
+    Padded column c is stored at phase (c % StrideWidth), offset
+    (c / StrideWidth). For a stride of one, this is a plain padded row.
+
+Arguments:
+
+    Parameters - Supplies the structure that contains the convolution
+        parameters.
+
+    Input - Supplies the input channel.
+
+    PaddedInput - Supplies the working buffer to receive the padded channel.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const size_t InputHeight = Parameters->InputShape[0];
+    const size_t InputWidth = Parameters->InputShape[1];
+    const size_t PaddingTop = Parameters->Padding[0];
+    const size_t PaddingLeft = Parameters->Padding[1];
+    const size_t StrideWidth = Parameters->StrideShape[1];
+
+    const size_t PaddedHeight = Parameters->u.Depthwise.PaddedHeight;
+    const size_t PhaseWidth = Parameters->u.Depthwise.PhaseWidth;
+    const size_t RowStride = StrideWidth * PhaseWidth;
+
+    for (size_t r = 0; r < PaddedHeight; r++) {
+
+        float* row = PaddedInput + r * RowStride;
+
+        //
+        // Use unsigned wraparound to test both edges at once.
+        //
+
+        const size_t ih = r - PaddingTop;
+
+        if (ih >= InputHeight) {
+            std::fill_n(row, RowStride, 0.0f);
+            continue;
+        }
+
+        const float* input = Input + ih * InputWidth;
+
+        if (StrideWidth == 1) {
+
+            const size_t LeftCount = std::min(PaddingLeft, RowStride);
+            const size_t CopyCount = std::min(InputWidth, RowStride - LeftCount);
+
+            std::fill_n(row, LeftCount, 0.0f);
+            std::copy_n(input, CopyCount, row + LeftCount);
+            std::fill_n(row + LeftCount + CopyCount, RowStride - LeftCount - CopyCount, 0.0f);
+
+        } else {
+
+            for (size_t c = 0; c < RowStride; c++) {
+                const size_t iw = c - PaddingLeft;
+                row[(c % StrideWidth) * PhaseWidth + c / StrideWidth] =
+                    (iw < InputWidth) ? input[iw] : 0.0f;
+            }
+        }
+    }
+}
+
+template<size_t KernelSize>
+void
+MlasConvDepthwiseKernelChw(
+    const MLAS_CONV_PARAMETERS* Parameters,
+    const float* PaddedInput,
+    const float* Filter,
+    float* Output
+    )
+/*++
+
+Routine Description:
+
+    This routine computes a single output channel of a depthwise convolution
+    from the padded input channel produced by MlasConvDepthwisePadInput.
+
+    Outputs are computed four or eight columns at a time. Because the padded
+    rows are split by stride phase, every kernel tap loads contiguous input
+    elements for consecutive output columns.
+
+Arguments:
+
+    Parameters - Supplies the structure that contains the convolution
+        parameters.
+
+    PaddedInput - Supplies the padded input channel.
+
+    Filter - Supplies the KernelSize x KernelSize filter.
+
+    Output - Supplies the output channel.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const size_t OutputHeight = Parameters->OutputShape[0];
+    const size_t OutputWidth = Parameters->OutputShape[1];
+    const size_t StrideHeight = Parameters->StrideShape[0];
+    const size_t StrideWidth = Parameters->StrideShape[1];
+    const size_t DilationHeight = Parameters->DilationShape[0];
+    const size_t DilationWidth = Parameters->DilationShape[1];
+
+    const size_t PhaseWidth = Parameters->u.Depthwise.PhaseWidth;
+    const size_t RowStride = StrideWidth * PhaseWidth;
+
+    //
+    // Compute the offset of each kernel column within a padded row.
+    //
+
+    size_t ColumnOffset[KernelSize];
+
+    for (size_t kw = 0; kw < KernelSize; kw++) {
+        const size_t c = kw * DilationWidth;
+        ColumnOffset[kw] = (c % StrideWidth) * PhaseWidth + c / StrideWidth;
+    }
+
+    const size_t KernelRowStride = DilationHeight * RowStride;
+
+    for (size_t oh = 0; oh < OutputHeight; oh++) {
+
+        const float* input = PaddedInput + oh * StrideHeight * RowStride;
+        size_t ow = 0;
+
+        for (; ow + 8 <= OutputWidth; ow += 8) {
+
+            MLAS_FLOAT32X4 Accumulator0 = MlasZeroFloat32x4();
+            MLAS_FLOAT32X4 Accumulator1 = MlasZeroFloat32x4();
+
+            const float* row = input + ow;
+            const float* filter = Filter;
+
+            for (size_t kh = 0; kh < KernelSize; kh++) {
+
+                for (size_t kw = 0; kw < KernelSize; kw++) {
+
+                    MLAS_FLOAT32X4 FilterVector = MlasBroadcastFloat32x4(filter[kw]);
+
+                    Accumulator0 = MlasMultiplyAddFloat32x4(
+                        MlasLoadFloat32x4(row + ColumnOffset[kw]), FilterVector, Accumulator0);
+                    Accumulator1 = MlasMultiplyAddFloat32x4(
+                        MlasLoadFloat32x4(row + ColumnOffset[kw] + 4), FilterVector, Accumulator1);
+                }
+
+                row += KernelRowStride;
+                filter += KernelSize;
+            }
+
+            MlasStoreFloat32x4(Output + ow, Accumulator0);
+            MlasStoreFloat32x4(Output + ow + 4, Accumulator1);
+        }
+
+        for (; ow + 4 <= OutputWidth; ow += 4) {
+
+            MLAS_FLOAT32X4 Accumulator0 = MlasZeroFloat32x4();
+
+            const float* row = input + ow;
+            const float* filter = Filter;
+
+            for (size_t kh = 0; kh < KernelSize; kh++) {
+
+                for (size_t kw = 0; kw < KernelSize; kw++) {
+                    Accumulator0 = MlasMultiplyAddFloat32x4(MlasLoadFloat32x4(row + ColumnOffset[kw]),
+                        MlasBroadcastFloat32x4(filter[kw]), Accumulator0);
+                }
+
+                row += KernelRowStride;
+                filter += KernelSize;
+            }
+
+            MlasStoreFloat32x4(Output + ow, Accumulator0);
+        }
+
+        for (; ow < OutputWidth; ow++) {
+
+            float Accumulator = 0.0f;
+
+            const float* row = input + ow;
+            const float* filter = Filter;
+
+            for (size_t kh = 0; kh < KernelSize; kh++) {
+
+                for (size_t kw = 0; kw < KernelSize; kw++) {
+                    Accumulator += row[ColumnOffset[kw]] * filter[kw];
+                }
+
+                row += KernelRowStride;
+                filter += KernelSize;
+            }
+
+            Output[ow] = Accumulator;
+        }
+
+        Output += OutputWidth;
+    }
+}
+
+void
+MlasConvDepthwiseFloat(
+    const MLAS_CONV_PARAMETERS* Parameters,
+    const float* Input,
+    const float* Filter,
+    float* Output,
+    float* WorkingBuffer
+    )
+/*++
+
+Routine Description:
+
+    This routine implements the single precision depthwise convolution
+    operation for a single channel of a tensor in channels first format.
+
+    MlasConvPrepare selects this algorithm for 2D convolutions with one input
+    and one output channel per group and a square 3x3 or 5x5 kernel.
+
+Arguments:
+
+    Parameters - Supplies the structure that contains the convolution
+        parameters.
+
+    Input - Supplies the input channel.
+
+    Filter - Supplies the filter for the channel.
+
+    Output - Supplies the output channel.
+
+    WorkingBuffer - Supplies a working buffer for the padded input channel.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    MlasConvDepthwisePadInput(Parameters, Input, WorkingBuffer);
+
+    if (Parameters->KernelShape[0] == 3) {
+        MlasConvDepthwiseKernelChw<3>(Parameters, WorkingBuffer, Filter, Output);
+    } else {
+        MlasConvDepthwiseKernelChw<5>(Parameters, WorkingBuffer, Filter, Output);
+    }
+}
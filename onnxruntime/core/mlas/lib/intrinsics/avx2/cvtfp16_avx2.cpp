@@ -0,0 +1,149 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    cvtfp16_avx2.cpp
+
+Abstract:
+
+    This module implements routines to convert between FP16 and FP32 formats
+    with F16C instructions. These kernels are dispatched on AVX2 processors
+    that also report F16C support.
+
+--*/
+
+#include "mlasi.h"
+
+void
+MLASCALL
+MlasConvertFloatToHalfKernelAvx2(
+    const float* Source,
+    unsigned short* Destination,
+    size_t Count
+    )
+/*++
+
+Routine Description:
+
+    This routine converts the source buffer of single precision floats to the
+    destination buffer of half precision floats.
+
+Arguments:
+
+    Source - Supplies the source buffer of single precision floats.
+
+    Destination - Supplies the destination buffer of half precision floats.
+
+    Count - Supplies the number of elements to convert.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    while (Count >= 16) {
+
+        __m128i Half0 = _mm256_cvtps_ph(_mm256_loadu_ps(Source), _MM_FROUND_TO_NEAREST_INT);
+        __m128i Half1 = _mm256_cvtps_ph(_mm256_loadu_ps(Source + 8), _MM_FROUND_TO_NEAREST_INT);
+
+        _mm_storeu_si128((__m128i*)Destination, Half0);
+        _mm_storeu_si128((__m128i*)(Destination + 8), Half1);
+
+        Source += 16;
+        Destination += 16;
+        Count -= 16;
+    }
+
+    if (Count >= 8) {
+
+        __m128i Half = _mm256_cvtps_ph(_mm256_loadu_ps(Source), _MM_FROUND_TO_NEAREST_INT);
+
+        _mm_storeu_si128((__m128i*)Destination, Half);
+
+        Source += 8;
+        Destination += 8;
+        Count -= 8;
+    }
+
+    if (Count > 0) {
+
+        float SourceBuffer[8] = {};
+        unsigned short DestinationBuffer[8];
+
+        std::copy_n(Source, Count, SourceBuffer);
+
+        __m128i Half = _mm256_cvtps_ph(_mm256_loadu_ps(SourceBuffer), _MM_FROUND_TO_NEAREST_INT);
+
+        _mm_storeu_si128((__m128i*)DestinationBuffer, Half);
+
+        std::copy_n(DestinationBuffer, Count, Destination);
+    }
+}
+
+void
+MLASCALL
+MlasConvertHalfToFloatKernelAvx2(
+    const unsigned short* Source,
+    float* Destination,
+    size_t Count
+    )
+/*++
+
+Routine Description:
+
+    This routine converts the source buffer of half precision floats to the
+    destination buffer of single precision floats.
+
+Arguments:
+
+    Source - Supplies the source buffer of half precision floats.
+
+    Destination - Supplies the destination buffer of single precision floats.
+
+    Count - Supplies the number of elements to convert.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    while (Count >= 16) {
+
+        __m256 Float0 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)Source));
+        __m256 Float1 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)(Source + 8)));
+
+        _mm256_storeu_ps(Destination, Float0);
+        _mm256_storeu_ps(Destination + 8, Float1);
+
+        Source += 16;
+        Destination += 16;
+        Count -= 16;
+    }
+
+    if (Count >= 8) {
+
+        _mm256_storeu_ps(Destination, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)Source)));
+
+        Source += 8;
+        Destination += 8;
+        Count -= 8;
+    }
+
+    if (Count > 0) {
+
+        unsigned short SourceBuffer[8] = {};
+        float DestinationBuffer[8];
+
+        std::copy_n(Source, Count, SourceBuffer);
+
+        _mm256_storeu_ps(DestinationBuffer, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)SourceBuffer)));
+
+        std::copy_n(DestinationBuffer, Count, Destination);
+    }
+}
@@ -0,0 +1,225 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    layernorm_avx2.cpp
+
+Abstract:
+
+    This module implements routines to compute layer normalization with AVX2
+    and FMA3 instructions.
+
+--*/
+
+#include "mlasi.h"
+
+MLAS_FORCEINLINE
+static
+__m256
+MlasLayerNormalizationLoadInputAvx2(
+    const float* Input,
+    const float* Skip,
+    const float* Bias,
+    size_t Index
+    )
+{
+    __m256 Vector = _mm256_loadu_ps(Input + Index);
+
+    if (Skip != nullptr) {
+        Vector = _mm256_add_ps(Vector, _mm256_loadu_ps(Skip + Index));
+    }
+    if (Bias != nullptr) {
+        Vector = _mm256_add_ps(Vector, _mm256_loadu_ps(Bias + Index));
+    }
+
+    return Vector;
+}
+
+MLAS_FORCEINLINE
+static
+float
+MlasReduceAddFloat32x8(
+    __m256 Vector
+    )
+{
+    __m128 Vector128 = _mm_add_ps(_mm256_castps256_ps128(Vector), _mm256_extractf128_ps(Vector, 1));
+    Vector128 = _mm_add_ps(Vector128, _mm_movehl_ps(Vector128, Vector128));
+    Vector128 = _mm_add_ss(Vector128, _mm_movehdup_ps(Vector128));
+    return _mm_cvtss_f32(Vector128);
+}
+
+void
+MLASCALL
+MlasLayerNormalizationKernelAvx2(
+    const float* Input,
+    const float* Skip,
+    const float* Bias,
+    const float* Gamma,
+    const float* Beta,
+    float* Output,
+    size_t D,
+    float Epsilon,
+    bool Simplified,
+    float* Mean,
+    float* InvStdDev
+    )
+/*++
+
+Routine Description:
+
+    This routine implements layer normalization of a single row with AVX2
+    and FMA3 instructions.
+
+Arguments:
+
+    Input - Supplies the input row.
+
+    Skip - Optionally supplies a row that is added to the input row.
+
+    Bias - Optionally supplies a row that is added to the input row.
+
+    Gamma - Supplies the scale applied to the normalized row.
+
+    Beta - Optionally supplies the offset applied to the normalized row.
+
+    Output - Supplies the output row. If Skip or Bias is supplied, the output
+        row is also used to hold the sum of the input rows between passes.
+
+    D - Supplies the number of elements in the row.
+
+    Epsilon - Supplies the value added to the variance.
+
+    Simplified - Supplies true to normalize by the root mean square only.
+
+    Mean - Optionally receives the mean of the row.
+
+    InvStdDev - Optionally receives the reciprocal standard deviation of the
+        row.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const bool HasAddends = (Skip != nullptr) || (Bias != nullptr);
+
+    float Pivot = 0.0f;
+
+    if (!Simplified) {
+        Pivot = Input[0] + (Skip != nullptr ? Skip[0] : 0.0f) + (Bias != nullptr ? Bias[0] : 0.0f);
+    }
+
+    //
+    // Form the input row and accumulate the row statistics. Two sets of
+    // accumulators hide the latency of the dependent adds.
+    //
+
+    __m256 PivotVector = _mm256_set1_ps(Pivot);
+    __m256 SumVector0 = _mm256_setzero_ps();
+    __m256 SumVector1 = _mm256_setzero_ps();
+    __m256 SumSquaresVector0 = _mm256_setzero_ps();
+    __m256 SumSquaresVector1 = _mm256_setzero_ps();
+
+    size_t d = 0;
+
+    for (; d + 16 <= D; d += 16) {
+
+        __m256 Vector0 = MlasLayerNormalizationLoadInputAvx2(Input, Skip, Bias, d);
+        __m256 Vector1 = MlasLayerNormalizationLoadInputAvx2(Input, Skip, Bias, d + 8);
+
+        if (HasAddends) {
+            _mm256_storeu_ps(Output + d, Vector0);
+            _mm256_storeu_ps(Output + d + 8, Vector1);
+        }
+
+        Vector0 = _mm256_sub_ps(Vector0, PivotVector);
+        Vector1 = _mm256_sub_ps(Vector1, PivotVector);
+        SumVector0 = _mm256_add_ps(SumVector0, Vector0);
+        SumVector1 = _mm256_add_ps(SumVector1, Vector1);
+        SumSquaresVector0 = _mm256_fmadd_ps(Vector0, Vector0, SumSquaresVector0);
+        SumSquaresVector1 = _mm256_fmadd_ps(Vector1, Vector1, SumSquaresVector1);
+    }
+
+    if (d + 8 <= D) {
+
+        __m256 Vector = MlasLayerNormalizationLoadInputAvx2(Input, Skip, Bias, d);
+
+        if (HasAddends) {
+            _mm256_storeu_ps(Output + d, Vector);
+        }
+
+        Vector = _mm256_sub_ps(Vector, PivotVector);
+        SumVector0 = _mm256_add_ps(SumVector0, Vector);
+        SumSquaresVector0 = _mm256_fmadd_ps(Vector, Vector, SumSquaresVector0);
+
+        d += 8;
+    }
+
+    float Sum = MlasReduceAddFloat32x8(_mm256_add_ps(SumVector0, SumVector1));
+    float SumSquares = MlasReduceAddFloat32x8(_mm256_add_ps(SumSquaresVector0, SumSquaresVector1));
+
+    for (; d < D; d++) {
+
+        float Value = Input[d];
+
+        if (Skip != nullptr) {
+            Value += Skip[d];
+        }
+        if (Bias != nullptr) {
+            Value += Bias[d];
+        }
+        if (HasAddends) {
+            Output[d] = Value;
+        }
+
+        Value -= Pivot;
+        Sum += Value;
+        SumSquares += Value * Value;
+    }
+
+    float Center;
+    float Multiplier;
+
+    MlasLayerNormalizationFinalize(Pivot, Sum, SumSquares, D, Epsilon, Simplified,
+        Mean, InvStdDev, &Center, &Multiplier);
+
+    //
+    // Apply the normalization and the affine transform.
+    //
+
+    const float* Source = HasAddends ? Output : Input;
+
+    __m256 CenterVector = _mm256_set1_ps(Center);
+    __m256 MultiplierVector = _mm256_set1_ps(Multiplier);
+
+    for (d = 0; d + 8 <= D; d += 8) {
+
+        __m256 Vector = _mm256_sub_ps(_mm256_loadu_ps(Source + d), CenterVector);
+
+        Vector = _mm256_mul_ps(Vector, MultiplierVector);
+
+        if (Beta != nullptr) {
+            Vector = _mm256_fmadd_ps(Vector, _mm256_loadu_ps(Gamma + d), _mm256_loadu_ps(Beta + d));
+        } else {
+            Vector = _mm256_mul_ps(Vector, _mm256_loadu_ps(Gamma + d));
+        }
+
+        _mm256_storeu_ps(Output + d, Vector);
+    }
+
+    for (; d < D; d++) {
+
+        float Value = (Source[d] - Center) * Multiplier * Gamma[d];
+
+        if (Beta != nullptr) {
+            Value += Beta[d];
+        }
+
+        Output[d] = Value;
+    }
+}
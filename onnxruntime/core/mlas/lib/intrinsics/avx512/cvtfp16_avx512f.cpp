@@ -0,0 +1,149 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    cvtfp16_avx512f.cpp
+
+Abstract:
+
+    This module implements routines to convert between FP16 and FP32 formats
+    with AVX512F instructions.
+
+--*/
+
+#include "mlasi.h"
+
+void
+MLASCALL
+MlasConvertFloatToHalfKernelAvx512F(
+    const float* Source,
+    unsigned short* Destination,
+    size_t Count
+    )
+/*++
+
+Routine Description:
+
+    This routine converts the source buffer of single precision floats to the
+    destination buffer of half precision floats.
+
+Arguments:
+
+    Source - Supplies the source buffer of single precision floats.
+
+    Destination - Supplies the destination buffer of half precision floats.
+
+    Count - Supplies the number of elements to convert.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    while (Count >= 32) {
+
+        __m256i Half0 = _mm512_cvtps_ph(_mm512_loadu_ps(Source), _MM_FROUND_TO_NEAREST_INT);
+        __m256i Half1 = _mm512_cvtps_ph(_mm512_loadu_ps(Source + 16), _MM_FROUND_TO_NEAREST_INT);
+
+        _mm256_storeu_si256((__m256i*)Destination, Half0);
+        _mm256_storeu_si256((__m256i*)(Destination + 16), Half1);
+
+        Source += 32;
+        Destination += 32;
+        Count -= 32;
+    }
+
+    while (Count > 0) {
+
+        //
+        // Storing 16-bit elements under a mask requires AVX512BW, so partial
+        // vectors are stored through a temporary buffer.
+        //
+
+        const size_t CountThisIteration = std::min(Count, size_t(16));
+        const __mmask16 Mask = __mmask16((1u << CountThisIteration) - 1);
+
+        __m256i Half = _mm512_cvtps_ph(_mm512_maskz_loadu_ps(Mask, Source), _MM_FROUND_TO_NEAREST_INT);
+
+        if (CountThisIteration == 16) {
+            _mm256_storeu_si256((__m256i*)Destination, Half);
+        } else {
+            unsigned short DestinationBuffer[16];
+            _mm256_storeu_si256((__m256i*)DestinationBuffer, Half);
+            std::copy_n(DestinationBuffer, CountThisIteration, Destination);
+        }
+
+        Source += CountThisIteration;
+        Destination += CountThisIteration;
+        Count -= CountThisIteration;
+    }
+}
+
+void
+MLASCALL
+MlasConvertHalfToFloatKernelAvx512F(
+    const unsigned short* Source,
+    float* Destination,
+    size_t Count
+    )
+/*++
+
+Routine Description:
+
+    This routine converts the source buffer of half precision floats to the
+    destination buffer of single precision floats.
+
+Arguments:
+
+    Source - Supplies the source buffer of half precision floats.
+
+    Destination - Supplies the destination buffer of single precision floats.
+
+    Count - Supplies the number of elements to convert.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    while (Count >= 32) {
+
+        __m512 Float0 = _mm512_cvtph_ps(_mm256_loadu_si256((const __m256i*)Source));
+        __m512 Float1 = _mm512_cvtph_ps(_mm256_loadu_si256((const __m256i*)(Source + 16)));
+
+        _mm512_storeu_ps(Destination, Float0);
+        _mm512_storeu_ps(Destination + 16, Float1);
+
+        Source += 32;
+        Destination += 32;
+        Count -= 32;
+    }
+
+    while (Count > 0) {
+
+        const size_t CountThisIteration = std::min(Count, size_t(16));
+        const __mmask16 Mask = __mmask16((1u << CountThisIteration) - 1);
+
+        __m256i Half;
+
+        if (CountThisIteration == 16) {
+            Half = _mm256_loadu_si256((const __m256i*)Source);
+        } else {
+            unsigned short SourceBuffer[16] = {};
+            std::copy_n(Source, CountThisIteration, SourceBuffer);
+            Half = _mm256_loadu_si256((const __m256i*)SourceBuffer);
+        }
+
+        _mm512_mask_storeu_ps(Destination, Mask, _mm512_cvtph_ps(Half));
+
+        Source += CountThisIteration;
+        Destination += CountThisIteration;
+        Count -= CountThisIteration;
+    }
+}
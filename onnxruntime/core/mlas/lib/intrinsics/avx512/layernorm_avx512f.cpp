@@ -0,0 +1,194 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    layernorm_avx512f.cpp
+
+Abstract:
+
+    This module implements routines to compute layer normalization with
+    AVX512F instructions.
+
+--*/
+
+#include "mlasi.h"
+
+MLAS_FORCEINLINE
+static
+__m512
+MlasLayerNormalizationLoadInputAvx512F(
+    __mmask16 Mask,
+    const float* Input,
+    const float* Skip,
+    const float* Bias,
+    size_t Index
+    )
+{
+    __m512 Vector = _mm512_maskz_loadu_ps(Mask, Input + Index);
+
+    if (Skip != nullptr) {
+        Vector = _mm512_add_ps(Vector, _mm512_maskz_loadu_ps(Mask, Skip + Index));
+    }
+    if (Bias != nullptr) {
+        Vector = _mm512_add_ps(Vector, _mm512_maskz_loadu_ps(Mask, Bias + Index));
+    }
+
+    return Vector;
+}
+
+void
+MLASCALL
+MlasLayerNormalizationKernelAvx512F(
+    const float* Input,
+    const float* Skip,
+    const float* Bias,
+    const float* Gamma,
+    const float* Beta,
+    float* Output,
+    size_t D,
+    float Epsilon,
+    bool Simplified,
+    float* Mean,
+    float* InvStdDev
+    )
+/*++
+
+Routine Description:
+
+    This routine implements layer normalization of a single row with AVX512F
+    instructions. Partial vectors at the end of the row are handled with
+    masked loads and stores.
+
+Arguments:
+
+    Input - Supplies the input row.
+
+    Skip - Optionally supplies a row that is added to the input row.
+
+    Bias - Optionally supplies a row that is added to the input row.
+
+    Gamma - Supplies the scale applied to the normalized row.
+
+    Beta - Optionally supplies the offset applied to the normalized row.
+
+    Output - Supplies the output row. If Skip or Bias is supplied, the output
+        row is also used to hold the sum of the input rows between passes.
+
+    D - Supplies the number of elements in the row.
+
+    Epsilon - Supplies the value added to the variance.
+
+    Simplified - Supplies true to normalize by the root mean square only.
+
+    Mean - Optionally receives the mean of the row.
+
+    InvStdDev - Optionally receives the reciprocal standard deviation of the
+        row.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const bool HasAddends = (Skip != nullptr) || (Bias != nullptr);
+
+    float Pivot = 0.0f;
+
+    if (!Simplified) {
+        Pivot = Input[0] + (Skip != nullptr ? Skip[0] : 0.0f) + (Bias != nullptr ? Bias[0] : 0.0f);
+    }
+
+    //
+    // Form the input row and accumulate the row statistics. Two sets of
+    // accumulators hide the latency of the dependent adds.
+    //
+
+    __m512 PivotVector = _mm512_set1_ps(Pivot);
+    __m512 SumVector0 = _mm512_setzero_ps();
+    __m512 SumVector1 = _mm512_setzero_ps();
+    __m512 SumSquaresVector0 = _mm512_setzero_ps();
+    __m512 SumSquaresVector1 = _mm512_setzero_ps();
+
+    size_t d = 0;
+
+    for (; d + 32 <= D; d += 32) {
+
+        __m512 Vector0 = MlasLayerNormalizationLoadInputAvx512F(0xFFFF, Input, Skip, Bias, d);
+        __m512 Vector1 = MlasLayerNormalizationLoadInputAvx512F(0xFFFF, Input, Skip, Bias, d + 16);
+
+        if (HasAddends) {
+            _mm512_storeu_ps(Output + d, Vector0);
+            _mm512_storeu_ps(Output + d + 16, Vector1);
+        }
+
+        Vector0 = _mm512_sub_ps(Vector0, PivotVector);
+        Vector1 = _mm512_sub_ps(Vector1, PivotVector);
+        SumVector0 = _mm512_add_ps(SumVector0, Vector0);
+        SumVector1 = _mm512_add_ps(SumVector1, Vector1);
+        SumSquaresVector0 = _mm512_fmadd_ps(Vector0, Vector0, SumSquaresVector0);
+        SumSquaresVector1 = _mm512_fmadd_ps(Vector1, Vector1, SumSquaresVector1);
+    }
+
+    while (d < D) {
+
+        const size_t Count = std::min<size_t>(D - d, 16);
+        const __mmask16 Mask = __mmask16((uint32_t(1) << Count) - uint32_t(1));
+
+        __m512 Vector = MlasLayerNormalizationLoadInputAvx512F(Mask, Input, Skip, Bias, d);
+
+        if (HasAddends) {
+            _mm512_mask_storeu_ps(Output + d, Mask, Vector);
+        }
+
+        //
+        // Masked lanes are zero and must stay zero after removing the pivot.
+        //
+
+        Vector = _mm512_maskz_sub_ps(Mask, Vector, PivotVector);
+        SumVector0 = _mm512_add_ps(SumVector0, Vector);
+        SumSquaresVector0 = _mm512_fmadd_ps(Vector, Vector, SumSquaresVector0);
+
+        d += Count;
+    }
+
+    float Sum = _mm512_reduce_add_ps(_mm512_add_ps(SumVector0, SumVector1));
+    float SumSquares = _mm512_reduce_add_ps(_mm512_add_ps(SumSquaresVector0, SumSquaresVector1));
+
+    float Center;
+    float Multiplier;
+
+    MlasLayerNormalizationFinalize(Pivot, Sum, SumSquares, D, Epsilon, Simplified,
+        Mean, InvStdDev, &Center, &Multiplier);
+
+    //
+    // Apply the normalization and the affine transform.
+    //
+
+    const float* Source = HasAddends ? Output : Input;
+
+    __m512 CenterVector = _mm512_set1_ps(Center);
+    __m512 MultiplierVector = _mm512_set1_ps(Multiplier);
+
+    for (d = 0; d < D; d += 16) {
+
+        const size_t Count = std::min<size_t>(D - d, 16);
+        const __mmask16 Mask = __mmask16((uint32_t(1) << Count) - uint32_t(1));
+
+        __m512 Vector = _mm512_sub_ps(_mm512_maskz_loadu_ps(Mask, Source + d), CenterVector);
+
+        Vector = _mm512_mul_ps(Vector, MultiplierVector);
+
+        if (Beta != nullptr) {
+            Vector = _mm512_fmadd_ps(Vector, _mm512_maskz_loadu_ps(Mask, Gamma + d), _mm512_maskz_loadu_ps(Mask, Beta + d));
+        } else {
+            Vector = _mm512_mul_ps(Vector, _mm512_maskz_loadu_ps(Mask, Gamma + d));
+        }
+
+        _mm512_mask_storeu_ps(Output + d, Mask, Vector);
+    }
+}
@@ -0,0 +1,278 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    layernorm.cpp
+
+Abstract:
+
+    This module implements routines to compute layer normalization, with the
+    optional residual and bias additions used by SkipLayerNormalization and
+    the embedding additions used by EmbedLayerNormalization.
+
+    Each row is processed in two passes over memory. The first pass forms the
+    input row (adding the Skip and Bias rows if present) and accumulates its
+    sum and sum of squares. The second pass applies the normalization and the
+    Gamma/Beta affine transform.
+
+--*/
+
+#include "mlasi.h"
+
+MLAS_FORCEINLINE
+float
+MlasLayerNormalizationLoadInput(
+    const float* Input,
+    const float* Skip,
+    const float* Bias,
+    size_t Index
+    )
+{
+    float Value = Input[Index];
+
+    if (Skip != nullptr) {
+        Value += Skip[Index];
+    }
+    if (Bias != nullptr) {
+        Value += Bias[Index];
+    }
+
+    return Value;
+}
+
+MLAS_FORCEINLINE
+MLAS_FLOAT32X4
+MlasLayerNormalizationLoadInputVector(
+    const float* Input,
+    const float* Skip,
+    const float* Bias,
+    size_t Index
+    )
+{
+    MLAS_FLOAT32X4 Vector = MlasLoadFloat32x4(Input + Index);
+
+    if (Skip != nullptr) {
+        Vector = MlasAddFloat32x4(Vector, MlasLoadFloat32x4(Skip + Index));
+    }
+    if (Bias != nullptr) {
+        Vector = MlasAddFloat32x4(Vector, MlasLoadFloat32x4(Bias + Index));
+    }
+
+    return Vector;
+}
+
+void
+MLASCALL
+MlasLayerNormalizationKernel(
+    const float* Input,
+    const float* Skip,
+    const float* Bias,
+    const float* Gamma,
+    const float* Beta,
+    float* Output,
+    size_t D,
+    float Epsilon,
+    bool Simplified,
+    float* Mean,
+    float* InvStdDev
+    )
+/*++
+
+Routine Description:
+
+    This routine implements the generic kernel for layer normalization of a
+    single row.
+
+Arguments:
+
+    Input - Supplies the input row.
+
+    Skip - Optionally supplies a row that is added to the input row.
+
+    Bias - Optionally supplies a row that is added to the input row.
+
+    Gamma - Supplies the scale applied to the normalized row.
+
+    Beta - Optionally supplies the offset applied to the normalized row.
+
+    Output - Supplies the output row. If Skip or Bias is supplied, the output
+        row is also used to hold the sum of the input rows between passes.
+
+    D - Supplies the number of elements in the row.
+
+    Epsilon - Supplies the value added to the variance.
+
+    Simplified - Supplies true to normalize by the root mean square only.
+
+    Mean - Optionally receives the mean of the row.
+
+    InvStdDev - Optionally receives the reciprocal standard deviation of the
+        row.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const bool HasAddends = (Skip != nullptr) || (Bias != nullptr);
+    const float Pivot = Simplified ? 0.0f : MlasLayerNormalizationLoadInput(Input, Skip, Bias, 0);
+
+    //
+    // Form the input row and accumulate the row statistics.
+    //
+
+    MLAS_FLOAT32X4 PivotVector = MlasBroadcastFloat32x4(Pivot);
+    MLAS_FLOAT32X4 SumVector = MlasZeroFloat32x4();
+    MLAS_FLOAT32X4 SumSquaresVector = MlasZeroFloat32x4();
+
+    size_t d = 0;
+
+    for (; d + 4 <= D; d += 4) {
+
+        MLAS_FLOAT32X4 Vector = MlasLayerNormalizationLoadInputVector(Input, Skip, Bias, d);
+
+        if (HasAddends) {
+            MlasStoreFloat32x4(Output + d, Vector);
+        }
+
+        Vector = MlasSubtractFloat32x4(Vector, PivotVector);
+        SumVector = MlasAddFloat32x4(SumVector, Vector);
+        SumSquaresVector = MlasMultiplyAddFloat32x4(Vector, Vector, SumSquaresVector);
+    }
+
+    float Sum = MlasReduceAddFloat32x4(SumVector);
+    float SumSquares = MlasReduceAddFloat32x4(SumSquaresVector);
+
+    for (; d < D; d++) {
+
+        float Value = MlasLayerNormalizationLoadInput(Input, Skip, Bias, d);
+
+        if (HasAddends) {
+            Output[d] = Value;
+        }
+
+        Value -= Pivot;
+        Sum += Value;
+        SumSquares += Value * Value;
+    }
+
+    float Center;
+    float Multiplier;
+
+    MlasLayerNormalizationFinalize(Pivot, Sum, SumSquares, D, Epsilon, Simplified,
+        Mean, InvStdDev, &Center, &Multiplier);
+
+    //
+    // Apply the normalization and the affine transform.
+    //
+
+    const float* Source = HasAddends ? Output : Input;
+
+    MLAS_FLOAT32X4 CenterVector = MlasBroadcastFloat32x4(Center);
+    MLAS_FLOAT32X4 MultiplierVector = MlasBroadcastFloat32x4(Multiplier);
+
+    for (d = 0; d + 4 <= D; d += 4) {
+
+        MLAS_FLOAT32X4 Vector = MlasLoadFloat32x4(Source + d);
+
+        Vector = MlasSubtractFloat32x4(Vector, CenterVector);
+        Vector = MlasMultiplyFloat32x4(Vector, MultiplierVector);
+
+        if (Beta != nullptr) {
+            Vector = MlasMultiplyAddFloat32x4(Vector, MlasLoadFloat32x4(Gamma + d), MlasLoadFloat32x4(Beta + d));
+        } else {
+            Vector = MlasMultiplyFloat32x4(Vector, MlasLoadFloat32x4(Gamma + d));
+        }
+
+        MlasStoreFloat32x4(Output + d, Vector);
+    }
+
+    for (; d < D; d++) {
+
+        float Value = (Source[d] - Center) * Multiplier * Gamma[d];
+
+        if (Beta != nullptr) {
+            Value += Beta[d];
+        }
+
+        Output[d] = Value;
+    }
+}
+
+void
+MLASCALL
+MlasComputeLayerNormalization(
+    const float* Input,
+    const float* Skip,
+    const float* Bias,
+    const float* Gamma,
+    const float* Beta,
+    float* Output,
+    size_t D,
+    float Epsilon,
+    bool Simplified,
+    float* Mean,
+    float* InvStdDev
+    )
+/*++
+
+Routine Description:
+
+    This routine computes layer normalization of a single row.
+
+    The row is formed as Input + Skip + Bias, with the Skip and Bias terms
+    omitted when not supplied, and is then normalized and transformed as:
+
+        Output = (Row - Mean(Row)) * InvStdDev(Row) * Gamma + Beta
+
+    When Simplified is true, the mean is not subtracted and InvStdDev is the
+    reciprocal root mean square of the row.
+
+Arguments:
+
+    Input - Supplies the input row.
+
+    Skip - Optionally supplies a row that is added to the input row.
+
+    Bias - Optionally supplies a row that is added to the input row.
+
+    Gamma - Supplies the scale applied to the normalized row.
+
+    Beta - Optionally supplies the offset applied to the normalized row.
+
+    Output - Supplies the output row. The output row may alias the input row.
+
+    D - Supplies the number of elements in the row.
+
+    Epsilon - Supplies the value added to the variance.
+
+    Simplified - Supplies true to normalize by the root mean square only.
+
+    Mean - Optionally receives the mean of the row.
+
+    InvStdDev - Optionally receives the reciprocal standard deviation of the
+        row.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    if (D == 0) {
+        return;
+    }
+
+#if defined(MLAS_TARGET_AMD64)
+    MlasPlatform.LayerNormalizationKernel(Input, Skip, Bias, Gamma, Beta, Output, D,
+        Epsilon, Simplified, Mean, InvStdDev);
+#else
+    MlasLayerNormalizationKernel(Input, Skip, Bias, Gamma, Beta, Output, D,
+        Epsilon, Simplified, Mean, InvStdDev);
+#endif
+}
@@ -465,6 +465,116 @@ void
     int8_t ZeroPoint
     );
 
+typedef
+void
+(MLASCALL MLAS_LAYER_NORMALIZATION_KERNEL)(
+    const float* Input,
+    const float* Skip,
+    const float* Bias,
+    const float* Gamma,
+    const float* Beta,
+    float* Output,
+    size_t D,
+    float Epsilon,
+    bool Simplified,
+    float* Mean,
+    float* InvStdDev
+    );
+
+typedef
+void
+(MLASCALL MLAS_CONVERT_FLOAT_TO_HALF_KERNEL)(
+    const float* Source,
+    unsigned short* Destination,
+    size_t Count
+    );
+
+typedef
+void
+(MLASCALL MLAS_CONVERT_HALF_TO_FLOAT_KERNEL)(
+    const unsigned short* Source,
+    float* Destination,
+    size_t Count
+    );
+
+MLAS_FORCEINLINE
+void
+MlasLayerNormalizationFinalize(
+    float Pivot,
+    float Sum,
+    float SumSquares,
+    size_t D,
+    float Epsilon,
+    bool Simplified,
+    float* Mean,
+    float* InvStdDev,
+    float* Center,
+    float* Multiplier
+    )
+/*++
+
+Routine Description:
+
+    This routine converts the row statistics accumulated by a layer
+    normalization kernel into the transform applied to each element.
+
+    The kernels accumulate the sum and sum of squares of (x - Pivot) in a
+    single pass. Shifting by a value taken from the row keeps the variance
+    computation from cancelling catastrophically when the row mean is large
+    relative to its spread. The simplified (RMS) form uses a zero pivot.
+
+Arguments:
+
+    Pivot - Supplies the value subtracted from each element before
+        accumulating.
+
+    Sum - Supplies the sum of (x - Pivot).
+
+    SumSquares - Supplies the sum of (x - Pivot)^2.
+
+    D - Supplies the number of elements in the row.
+
+    Epsilon - Supplies the value added to the variance.
+
+    Simplified - Supplies true to normalize by the root mean square only.
+
+    Mean - Optionally receives the mean of the row.
+
+    InvStdDev - Optionally receives the reciprocal standard deviation (or
+        reciprocal root mean square) of the row.
+
+    Center - Receives the value subtracted from each element: the row mean, or
+        zero for the simplified form.
+
+    Multiplier - Receives the value each centered element is multiplied by.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const float ShiftedMean = Sum / float(D);
+    float Variance = SumSquares / float(D);
+
+    if (!Simplified) {
+        Variance = std::max(Variance - ShiftedMean * ShiftedMean, 0.0f);
+    }
+
+    const float RowMean = Pivot + ShiftedMean;
+    const float RowInvStdDev = 1.0f / std::sqrt(Variance + Epsilon);
+
+    if (Mean != nullptr) {
+        *Mean = RowMean;
+    }
+    if (InvStdDev != nullptr) {
+        *InvStdDev = RowInvStdDev;
+    }
+
+    *Center = Simplified ? 0.0f : RowMean;
+    *Multiplier = RowInvStdDev;
+}
+
 template<typename FilterType>
 struct MLAS_U8X8_KERNEL
 {
@@ -576,6 +686,9 @@ extern "C" {
     MLAS_QLINEAR_BINARY_OP_U8_KERNEL MlasQLinearAddU8Kernel;
     MLAS_QUANTIZE_LINEAR_S8_KERNEL MlasQuantizeLinearS8Kernel;
     MLAS_QUANTIZE_LINEAR_U8_KERNEL MlasQuantizeLinearU8Kernel;
+    MLAS_LAYER_NORMALIZATION_KERNEL MlasLayerNormalizationKernel;
+    MLAS_CONVERT_FLOAT_TO_HALF_KERNEL MlasConvertFloatToHalfKernel;
+    MLAS_CONVERT_HALF_TO_FLOAT_KERNEL MlasConvertHalfToFloatKernel;
 #if defined(MLAS_TARGET_AMD64)
     MLAS_COMPUTE_UNARY_FLOAT_KERNEL MlasErfKernelFma3;
     MLAS_COMPUTE_UNARY_FLOAT_KERNEL MlasComputeExpF32KernelFma3;
@@ -590,6 +703,13 @@ extern "C" {
     MLAS_QLINEAR_BINARY_OP_U8_KERNEL MlasQLinearAddU8KernelAvx2;
     MLAS_QUANTIZE_LINEAR_S8_KERNEL MlasQuantizeLinearS8KernelAvx512F;
     MLAS_QUANTIZE_LINEAR_U8_KERNEL MlasQuantizeLinearU8KernelAvx512F;
+    MLAS_LAYER_NORMALIZATION_KERNEL MlasLayerNormalizationKernelAvx2;
+    MLAS_LAYER_NORMALIZATION_KERNEL MlasLayerNormalizationKernelAvx512F;
+    MLAS_CONVERT_HALF_TO_FLOAT_KERNEL MlasConvertHalfToFloatKernelSse2;
+    MLAS_CONVERT_FLOAT_TO_HALF_KERNEL MlasConvertFloatToHalfKernelAvx2;
+    MLAS_CONVERT_HALF_TO_FLOAT_KERNEL MlasConvertHalfToFloatKernelAvx2;
+    MLAS_CONVERT_FLOAT_TO_HALF_KERNEL MlasConvertFloatToHalfKernelAvx512F;
+    MLAS_CONVERT_HALF_TO_FLOAT_KERNEL MlasConvertHalfToFloatKernelAvx512F;
 #endif
 
     MLAS_REDUCE_MAXIMUM_FLOAT_KERNEL MlasReduceMaximumF32Kernel;
@@ -735,6 +855,9 @@ struct MLAS_PLATFORM {
     MLAS_REDUCE_MINIMUM_MAXIMUM_FLOAT_KERNEL* ReduceMinimumMaximumF32Kernel;
     MLAS_QUANTIZE_LINEAR_S8_KERNEL* QuantizeLinearS8Kernel;
     MLAS_QUANTIZE_LINEAR_U8_KERNEL* QuantizeLinearU8Kernel;
+    MLAS_LAYER_NORMALIZATION_KERNEL* LayerNormalizationKernel;
+    MLAS_CONVERT_FLOAT_TO_HALF_KERNEL* ConvertFloatToHalfKernel;
+    MLAS_CONVERT_HALF_TO_FLOAT_KERNEL* ConvertHalfToFloatKernel;
     uint32_t NchwcBlockSize;
     uint32_t PreferredBufferAlignment;
     int32_t MaximumThreadCount;
@@ -879,6 +1002,34 @@ MlasConvDepthwiseFloat_CHW(
 
 #endif
 
+void
+MlasConvDepthwiseFloat(
+    const MLAS_CONV_PARAMETERS* Parameters,
+    const float* Input,
+    const float* Filter,
+    float* Output,
+    float* WorkingBuffer
+    );
+
+void
+MlasConvWinogradPrepare(
+    MLAS_CONV_PARAMETERS* Parameters,
+    size_t* WorkingBufferSize,
+    MLAS_THREADPOOL* ThreadPool
+    );
+
+void
+MlasConvWinograd(
+    const MLAS_CONV_PARAMETERS* Parameters,
+    const float* Input,
+    const float* Filter,
+    const float* TransformedFilter,
+    const float* Bias,
+    float* WorkingBuffer,
+    float* Output,
+    MLAS_THREADPOOL* ThreadPool
+    );
+
 
 //
 // Define the missing ARM64 NEON intrinsic macros from arm64_neon.h that enable
@@ -1153,6 +1304,22 @@ MlasShiftLeftInt32x4(MLAS_INT32X4 Vector)
 #endif
 }
 
+template<unsigned ShiftCount>
+MLAS_FORCEINLINE
+MLAS_INT32X4
+MlasShiftRightInt32x4(MLAS_INT32X4 Vector)
+{
+#if defined(MLAS_NEON_INTRINSICS)
+    return vshrq_n_s32(Vector, ShiftCount);
+#elif defined(MLAS_SSE2_INTRINSICS)
+    return _mm_srai_epi32(Vector, ShiftCount);
+#elif defined(MLAS_WASM_SIMD_INTRINSICS)
+    return wasm_i32x4_shr(Vector, ShiftCount);
+#else
+    return Vector >> ShiftCount;
+#endif
+}
+
 MLAS_FORCEINLINE
 MLAS_INT32X4
 MlasMaximumInt32x4(MLAS_INT32X4 Vector1, MLAS_INT32X4 Vector2)
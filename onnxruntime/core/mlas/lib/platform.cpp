@@ -153,6 +153,13 @@ Return Value:
     this->QLinearAddU8Kernel = MlasQLinearAddU8Kernel;
     this->QuantizeLinearS8Kernel = MlasQuantizeLinearS8Kernel;
     this->QuantizeLinearU8Kernel = MlasQuantizeLinearU8Kernel;
+    this->LayerNormalizationKernel = MlasLayerNormalizationKernel;
+    this->ConvertFloatToHalfKernel = MlasConvertFloatToHalfKernel;
+#if defined(_WIN32)
+    this->ConvertHalfToFloatKernel = MlasConvertHalfToFloatKernelSse2;
+#else
+    this->ConvertHalfToFloatKernel = MlasConvertHalfToFloatKernel;
+#endif
     this->ConvDepthwiseU8S8Kernel = MlasConvDepthwiseKernel<int8_t>;
     this->ConvDepthwiseU8U8Kernel = MlasConvDepthwiseKernel<uint8_t>;
 
@@ -238,6 +245,16 @@ Return Value:
                 this->ConvDepthwiseU8S8Kernel = MlasConvDepthwiseKernelAvx2<int8_t>;
                 this->ConvDepthwiseU8U8Kernel = MlasConvDepthwiseKernelAvx2<uint8_t>;
                 this->ComputeSumExpF32Kernel = MlasComputeSumExpF32KernelFma3;
+                this->LayerNormalizationKernel = MlasLayerNormalizationKernelAvx2;
+
+                //
+                // Check if the processor supports the F16C conversion instructions.
+                //
+
+                if ((Cpuid1[2] & 0x20000000) != 0) {
+                    this->ConvertFloatToHalfKernel = MlasConvertFloatToHalfKernelAvx2;
+                    this->ConvertHalfToFloatKernel = MlasConvertHalfToFloatKernelAvx2;
+                }
 
                 //
                 // Check if the processor supports Hybrid core architecture.
@@ -291,6 +308,9 @@ Return Value:
 #if !defined(MLAS_AVX512F_INTRINSICS_UNSUPPORTED)
                     this->QuantizeLinearS8Kernel = MlasQuantizeLinearS8KernelAvx512F;
                     this->QuantizeLinearU8Kernel = MlasQuantizeLinearU8KernelAvx512F;
+                    this->LayerNormalizationKernel = MlasLayerNormalizationKernelAvx512F;
+                    this->ConvertFloatToHalfKernel = MlasConvertFloatToHalfKernelAvx512F;
+                    this->ConvertHalfToFloatKernel = MlasConvertHalfToFloatKernelAvx512F;
 #endif
 
                     //
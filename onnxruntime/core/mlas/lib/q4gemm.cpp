@@ -0,0 +1,709 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    q4gemm.cpp
+
+Abstract:
+
+    This module implements the single precision matrix/matrix multiply
+    operation where matrix B is quantized to 4 bits in blocks along the K
+    dimension (weight-only quantization).
+
+    Matrix B is packed in groups of four columns. For each block of K, a group
+    stores the per-column scales, the per-column offsets (-ZeroPoint * Scale),
+    and then the 4-bit elements. Each 32-bit word of element data holds eight
+    consecutive K elements of one column, so a 128-bit load yields eight
+    vectors of four columns after shifting and masking.
+
+--*/
+
+#include "mlasi.h"
+
+//
+// Define the number of columns of matrix B packed together.
+//
+
+#define MLAS_Q4GEMM_GROUP_N                         4
+
+//
+// Define the panel size used to dequantize matrix B before invoking the
+// single precision GEMM kernels for larger values of M.
+//
+
+#define MLAS_Q4GEMM_PANEL_K                         256
+#define MLAS_Q4GEMM_PANEL_N                         32
+
+//
+// Define the number of rows of matrix A below which the direct kernel is
+// used instead of dequantizing panels of matrix B.
+//
+
+#define MLAS_Q4GEMM_DIRECT_MAXIMUM_M                4
+
+//
+// Define the default zero point used when none is supplied.
+//
+
+#define MLAS_Q4GEMM_DEFAULT_ZERO_POINT              8
+
+MLAS_FORCEINLINE
+bool
+MlasQ4GemmIsSupportedBlockSize(
+    size_t BlockSize
+    )
+{
+    return BlockSize >= 16 && BlockSize <= MLAS_Q4GEMM_PANEL_K &&
+        (BlockSize & (BlockSize - 1)) == 0;
+}
+
+MLAS_FORCEINLINE
+size_t
+MlasQ4GemmPackedBlockBytes(
+    size_t BlockSize
+    )
+{
+    //
+    // Each block of a column group stores the scale and offset vectors
+    // followed by the 4-bit elements of the four columns.
+    //
+
+    return 2 * MLAS_Q4GEMM_GROUP_N * sizeof(float) + (MLAS_Q4GEMM_GROUP_N * BlockSize) / 2;
+}
+
+size_t
+MLASCALL
+MlasQ4GemmPackBSize(
+    size_t N,
+    size_t K,
+    size_t BlockSize
+    )
+/*++
+
+Routine Description:
+
+    This routine computes the number of bytes required to pack a blockwise
+    4-bit quantized matrix B with the supplied shape.
+
+Arguments:
+
+    N - Supplies the number of columns of matrix B.
+
+    K - Supplies the number of rows of matrix B.
+
+    BlockSize - Supplies the number of elements along K sharing a scale and
+        zero point. Must be a power of two from 16 to 256.
+
+Return Value:
+
+    Returns the size in bytes of the packed buffer, or zero if the block size
+    is not supported.
+
+--*/
+{
+    if (!MlasQ4GemmIsSupportedBlockSize(BlockSize)) {
+        return 0;
+    }
+
+    const size_t GroupCountN = (N + MLAS_Q4GEMM_GROUP_N - 1) / MLAS_Q4GEMM_GROUP_N;
+    const size_t BlockCountK = (K + BlockSize - 1) / BlockSize;
+
+    return GroupCountN * BlockCountK * MlasQ4GemmPackedBlockBytes(BlockSize);
+}
+
+void
+MLASCALL
+MlasQ4GemmPackB(
+    void* PackedB,
+    const uint8_t* QuantData,
+    const float* Scales,
+    const uint8_t* ZeroPoints,
+    size_t N,
+    size_t K,
+    size_t BlockSize
+    )
+/*++
+
+Routine Description:
+
+    This routine packs the contents of a blockwise 4-bit quantized matrix B
+    to the layout consumed by MlasQ4GemmBatch.
+
+Arguments:
+
+    PackedB - Supplies the address of the packed buffer, which must be at
+        least MlasQ4GemmPackBSize bytes.
+
+    QuantData - Supplies the 4-bit elements of matrix B in column major
+        order with shape [N][BlockCountK][BlockSize / 2]. Each byte holds two
+        elements along K with the lower indexed element in the low nibble.
+
+    Scales - Supplies the scales with shape [N][BlockCountK].
+
+    ZeroPoints - Optionally supplies the 4-bit zero points with shape
+        [N][(BlockCountK + 1) / 2], packed two blocks to a byte with the lower
+        indexed block in the low nibble. If nullptr, the zero point is 8.
+
+    N - Supplies the number of columns of matrix B.
+
+    K - Supplies the number of rows of matrix B.
+
+    BlockSize - Supplies the number of elements along K sharing a scale and
+        zero point.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const size_t BlockCountK = (K + BlockSize - 1) / BlockSize;
+    const size_t BlockBytes = BlockSize / 2;
+    const size_t ZeroPointBytes = (BlockCountK + 1) / 2;
+
+    uint8_t* pb = static_cast<uint8_t*>(PackedB);
+
+    for (size_t n = 0; n < N; n += MLAS_Q4GEMM_GROUP_N) {
+
+        const size_t CountN = std::min(N - n, size_t(MLAS_Q4GEMM_GROUP_N));
+
+        for (size_t b = 0; b < BlockCountK; b++) {
+
+            float* ScaleOffset = reinterpret_cast<float*>(pb);
+            uint8_t* Data = pb + 2 * MLAS_Q4GEMM_GROUP_N * sizeof(float);
+
+            //
+            // Columns beyond N are padded with zero scales and offsets, so
+            // the dequantized elements are zero.
+            //
+
+            std::fill_n(ScaleOffset, 2 * MLAS_Q4GEMM_GROUP_N, 0.0f);
+            std::fill_n(Data, (MLAS_Q4GEMM_GROUP_N * BlockSize) / 2, uint8_t(0));
+
+            for (size_t nn = 0; nn < CountN; nn++) {
+
+                const size_t Column = n + nn;
+                const float Scale = Scales[Column * BlockCountK + b];
+
+                uint8_t ZeroPoint = MLAS_Q4GEMM_DEFAULT_ZERO_POINT;
+
+                if (ZeroPoints != nullptr) {
+                    const uint8_t ZeroPointPair = ZeroPoints[Column * ZeroPointBytes + b / 2];
+                    ZeroPoint = (b & 1) ? (ZeroPointPair >> 4) : (ZeroPointPair & 0x0F);
+                }
+
+                ScaleOffset[nn] = Scale;
+                ScaleOffset[MLAS_Q4GEMM_GROUP_N + nn] = -float(ZeroPoint) * Scale;
+
+                //
+                // Repack each run of eight elements (four source bytes) of
+                // the column to the column's lane of a 128-bit vector. The
+                // source bytes already hold the elements in the nibble order
+                // consumed by the kernel.
+                //
+
+                const uint8_t* Source = QuantData + (Column * BlockCountK + b) * BlockBytes;
+
+                for (size_t k = 0; k < BlockBytes; k += 4) {
+                    uint8_t* Lane = Data + (k / 4) * (MLAS_Q4GEMM_GROUP_N * 4) + nn * 4;
+                    std::copy_n(Source + k, 4, Lane);
+                }
+            }
+
+            pb += MlasQ4GemmPackedBlockBytes(BlockSize);
+        }
+    }
+}
+
+MLAS_FORCEINLINE
+MLAS_FLOAT32X4
+MlasQ4GemmDequantize(
+    MLAS_INT32X4 Elements,
+    MLAS_INT32X4 NibbleMask,
+    MLAS_FLOAT32X4 ScaleVector,
+    MLAS_FLOAT32X4 OffsetVector
+    )
+{
+    MLAS_FLOAT32X4 Value = MlasCastToFloat32x4(MlasAndInt32x4(Elements, NibbleMask));
+
+    return MlasMultiplyAddFloat32x4(Value, ScaleVector, OffsetVector);
+}
+
+template<size_t RowCount>
+MLAS_FORCEINLINE
+void
+MlasQ4GemmAccumulate(
+    MLAS_FLOAT32X4 Accumulators[RowCount],
+    const float* const RowA[RowCount],
+    size_t k,
+    MLAS_FLOAT32X4 WeightVector
+    )
+{
+    for (size_t r = 0; r < RowCount; r++) {
+        Accumulators[r] = MlasMultiplyAddFloat32x4(MlasBroadcastFloat32x4(RowA[r][k]),
+            WeightVector, Accumulators[r]);
+    }
+}
+
+template<size_t RowCount>
+void
+MlasQ4GemmKernelDirect(
+    const float* A,
+    size_t lda,
+    const uint8_t* PackedB,
+    float* C,
+    size_t ldc,
+    size_t CountN,
+    size_t CountK,
+    size_t BlockSize,
+    const float* Bias
+    )
+/*++
+
+Routine Description:
+
+    This routine computes up to four rows by four columns of the output
+    matrix. Each block of matrix B is dequantized into registers and
+    accumulated against the rows of matrix A without an intermediate buffer.
+
+Arguments:
+
+    A - Supplies the address of matrix A.
+
+    lda - Supplies the first dimension of matrix A.
+
+    PackedB - Supplies the address of the packed column group of matrix B.
+
+    C - Supplies the address of matrix C.
+
+    ldc - Supplies the first dimension of matrix C.
+
+    CountN - Supplies the number of columns to store, at most four.
+
+    CountK - Supplies the number of columns of matrix A.
+
+    BlockSize - Supplies the quantization block size along K.
+
+    Bias - Optionally supplies the address of the bias vector for the column
+        group.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const MLAS_INT32X4 NibbleMask = MlasBroadcastInt32x4(0x0F);
+
+    MLAS_FLOAT32X4 Accumulators[RowCount];
+
+    for (size_t r = 0; r < RowCount; r++) {
+        Accumulators[r] = MlasZeroFloat32x4();
+    }
+
+    for (size_t k = 0; k < CountK; k += BlockSize) {
+
+        const float* ScaleOffset = reinterpret_cast<const float*>(PackedB);
+        const MLAS_FLOAT32X4 ScaleVector = MlasLoadFloat32x4(ScaleOffset);
+        const MLAS_FLOAT32X4 OffsetVector = MlasLoadFloat32x4(ScaleOffset + MLAS_Q4GEMM_GROUP_N);
+        const int32_t* Data = reinterpret_cast<const int32_t*>(PackedB + 2 * MLAS_Q4GEMM_GROUP_N * sizeof(float));
+
+        const size_t CountBlockK = std::min(CountK - k, BlockSize);
+
+        for (size_t kk = 0; kk < CountBlockK; kk += 8) {
+
+            //
+            // Read eight elements from each row of matrix A. The final run of
+            // a partial block is copied to a zero padded buffer so that the
+            // padding elements of matrix B are multiplied by zero.
+            //
+
+            const float* RowA[RowCount];
+            float PaddedA[RowCount][8];
+
+            if (CountBlockK - kk >= 8) {
+
+                for (size_t r = 0; r < RowCount; r++) {
+                    RowA[r] = A + r * lda + k + kk;
+                }
+
+            } else {
+
+                for (size_t r = 0; r < RowCount; r++) {
+                    std::fill_n(PaddedA[r], 8, 0.0f);
+                    std::copy_n(A + r * lda + k + kk, CountBlockK - kk, PaddedA[r]);
+                    RowA[r] = PaddedA[r];
+                }
+            }
+
+            const MLAS_INT32X4 Elements = MlasLoadInt32x4(Data);
+            Data += MLAS_Q4GEMM_GROUP_N;
+
+            MlasQ4GemmAccumulate<RowCount>(Accumulators, RowA, 0,
+                MlasQ4GemmDequantize(Elements, NibbleMask, ScaleVector, OffsetVector));
+            MlasQ4GemmAccumulate<RowCount>(Accumulators, RowA, 1,
+                MlasQ4GemmDequantize(MlasShiftRightInt32x4<4>(Elements), NibbleMask, ScaleVector, OffsetVector));
+            MlasQ4GemmAccumulate<RowCount>(Accumulators, RowA, 2,
+                MlasQ4GemmDequantize(MlasShiftRightInt32x4<8>(Elements), NibbleMask, ScaleVector, OffsetVector));
+            MlasQ4GemmAccumulate<RowCount>(Accumulators, RowA, 3,
+                MlasQ4GemmDequantize(MlasShiftRightInt32x4<12>(Elements), NibbleMask, ScaleVector, OffsetVector));
+            MlasQ4GemmAccumulate<RowCount>(Accumulators, RowA, 4,
+                MlasQ4GemmDequantize(MlasShiftRightInt32x4<16>(Elements), NibbleMask, ScaleVector, OffsetVector));
+            MlasQ4GemmAccumulate<RowCount>(Accumulators, RowA, 5,
+                MlasQ4GemmDequantize(MlasShiftRightInt32x4<20>(Elements), NibbleMask, ScaleVector, OffsetVector));
+            MlasQ4GemmAccumulate<RowCount>(Accumulators, RowA, 6,
+                MlasQ4GemmDequantize(MlasShiftRightInt32x4<24>(Elements), NibbleMask, ScaleVector, OffsetVector));
+            MlasQ4GemmAccumulate<RowCount>(Accumulators, RowA, 7,
+                MlasQ4GemmDequantize(MlasShiftRightInt32x4<28>(Elements), NibbleMask, ScaleVector, OffsetVector));
+        }
+
+        PackedB += MlasQ4GemmPackedBlockBytes(BlockSize);
+    }
+
+    //
+    // Add the optional bias vector and store the output block.
+    //
+
+    for (size_t r = 0; r < RowCount; r++) {
+
+        MLAS_FLOAT32X4 Accumulator = Accumulators[r];
+        float* c = C + r * ldc;
+
+        if (CountN == MLAS_Q4GEMM_GROUP_N) {
+
+            if (Bias != nullptr) {
+                Accumulator = MlasAddFloat32x4(Accumulator, MlasLoadFloat32x4(Bias));
+            }
+
+            MlasStoreFloat32x4(c, Accumulator);
+
+        } else {
+
+            float Buffer[MLAS_Q4GEMM_GROUP_N];
+            MlasStoreFloat32x4(Buffer, Accumulator);
+
+            for (size_t n = 0; n < CountN; n++) {
+                c[n] = Buffer[n] + ((Bias != nullptr) ? Bias[n] : 0.0f);
+            }
+        }
+    }
+}
+
+void
+MlasQ4GemmDequantizePanel(
+    const uint8_t* PackedB,
+    size_t PackedGroupStride,
+    float* Panel,
+    size_t CountN,
+    size_t StartK,
+    size_t CountK,
+    size_t BlockSize
+    )
+/*++
+
+Routine Description:
+
+    This routine dequantizes a panel of matrix B to a row major buffer with
+    MLAS_Q4GEMM_PANEL_N columns.
+
+Arguments:
+
+    PackedB - Supplies the address of the first packed column group of the
+        panel.
+
+    PackedGroupStride - Supplies the number of bytes between packed column
+        groups.
+
+    Panel - Supplies the address of the output buffer.
+
+    CountN - Supplies the number of columns to dequantize.
+
+    StartK - Supplies the starting row of the panel, aligned to BlockSize.
+
+    CountK - Supplies the number of rows to dequantize, which is a multiple of
+        BlockSize unless the panel contains the end of matrix B.
+
+    BlockSize - Supplies the quantization block size along K.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const MLAS_INT32X4 NibbleMask = MlasBroadcastInt32x4(0x0F);
+    const size_t PackedBlockBytes = MlasQ4GemmPackedBlockBytes(BlockSize);
+
+    for (size_t n = 0; n < CountN; n += MLAS_Q4GEMM_GROUP_N) {
+
+        const uint8_t* pb = PackedB + (StartK / BlockSize) * PackedBlockBytes;
+        float* p = Panel + n;
+
+        for (size_t k = 0; k < CountK; k += BlockSize) {
+
+            const float* ScaleOffset = reinterpret_cast<const float*>(pb);
+            const MLAS_FLOAT32X4 ScaleVector = MlasLoadFloat32x4(ScaleOffset);
+            const MLAS_FLOAT32X4 OffsetVector = MlasLoadFloat32x4(ScaleOffset + MLAS_Q4GEMM_GROUP_N);
+            const int32_t* Data = reinterpret_cast<const int32_t*>(pb + 2 * MLAS_Q4GEMM_GROUP_N * sizeof(float));
+
+            const size_t CountBlockK = std::min(CountK - k, BlockSize);
+
+            for (size_t kk = 0; kk < CountBlockK; kk += 8) {
+
+                MLAS_INT32X4 Elements = MlasLoadInt32x4(Data);
+                Data += MLAS_Q4GEMM_GROUP_N;
+
+                //
+                // The panel is padded to a multiple of eight rows, so the
+                // final run can always be stored in full.
+                //
+
+                MlasStoreFloat32x4(p + 0 * MLAS_Q4GEMM_PANEL_N,
+                    MlasQ4GemmDequantize(Elements, NibbleMask, ScaleVector, OffsetVector));
+                MlasStoreFloat32x4(p + 1 * MLAS_Q4GEMM_PANEL_N,
+                    MlasQ4GemmDequantize(MlasShiftRightInt32x4<4>(Elements), NibbleMask, ScaleVector, OffsetVector));
+                MlasStoreFloat32x4(p + 2 * MLAS_Q4GEMM_PANEL_N,
+                    MlasQ4GemmDequantize(MlasShiftRightInt32x4<8>(Elements), NibbleMask, ScaleVector, OffsetVector));
+                MlasStoreFloat32x4(p + 3 * MLAS_Q4GEMM_PANEL_N,
+                    MlasQ4GemmDequantize(MlasShiftRightInt32x4<12>(Elements), NibbleMask, ScaleVector, OffsetVector));
+                MlasStoreFloat32x4(p + 4 * MLAS_Q4GEMM_PANEL_N,
+                    MlasQ4GemmDequantize(MlasShiftRightInt32x4<16>(Elements), NibbleMask, ScaleVector, OffsetVector));
+                MlasStoreFloat32x4(p + 5 * MLAS_Q4GEMM_PANEL_N,
+                    MlasQ4GemmDequantize(MlasShiftRightInt32x4<20>(Elements), NibbleMask, ScaleVector, OffsetVector));
+                MlasStoreFloat32x4(p + 6 * MLAS_Q4GEMM_PANEL_N,
+                    MlasQ4GemmDequantize(MlasShiftRightInt32x4<24>(Elements), NibbleMask, ScaleVector, OffsetVector));
+                MlasStoreFloat32x4(p + 7 * MLAS_Q4GEMM_PANEL_N,
+                    MlasQ4GemmDequantize(MlasShiftRightInt32x4<28>(Elements), NibbleMask, ScaleVector, OffsetVector));
+
+                p += 8 * MLAS_Q4GEMM_PANEL_N;
+            }
+
+            pb += PackedBlockBytes;
+        }
+
+        PackedB += PackedGroupStride;
+    }
+}
+
+void
+MlasQ4GemmOperation(
+    size_t M,
+    size_t K,
+    size_t BlockSize,
+    const MLAS_Q4_GEMM_DATA_PARAMS* DataParams,
+    size_t RangeStartN,
+    size_t RangeCountN
+    )
+/*++
+
+Routine Description:
+
+    This routine computes a range of columns of the output matrix on a single
+    thread.
+
+Arguments:
+
+    M - Supplies the number of rows of matrix A and matrix C.
+
+    K - Supplies the number of columns of matrix A and rows of matrix B.
+
+    BlockSize - Supplies the quantization block size along K.
+
+    DataParams - Supplies the data parameters of the operation.
+
+    RangeStartN - Supplies the starting column, aligned to a column group.
+
+    RangeCountN - Supplies the number of columns to compute.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const size_t BlockCountK = (K + BlockSize - 1) / BlockSize;
+    const size_t PackedGroupStride = BlockCountK * MlasQ4GemmPackedBlockBytes(BlockSize);
+
+    const float* A = DataParams->A;
+    const size_t lda = DataParams->lda;
+    const uint8_t* PackedB = static_cast<const uint8_t*>(DataParams->PackedB) +
+        (RangeStartN / MLAS_Q4GEMM_GROUP_N) * PackedGroupStride;
+    float* C = DataParams->C + RangeStartN;
+    const size_t ldc = DataParams->ldc;
+    const float* Bias = (DataParams->Bias != nullptr) ? DataParams->Bias + RangeStartN : nullptr;
+
+    if (M <= MLAS_Q4GEMM_DIRECT_MAXIMUM_M) {
+
+        //
+        // Matrix B is streamed once per group of four rows, so dequantize
+        // each block directly into registers.
+        //
+
+        for (size_t n = 0; n < RangeCountN; n += MLAS_Q4GEMM_GROUP_N) {
+
+            const size_t CountN = std::min(RangeCountN - n, size_t(MLAS_Q4GEMM_GROUP_N));
+            const float* bias = (Bias != nullptr) ? Bias + n : nullptr;
+
+            size_t m = 0;
+
+            while (M - m >= 4) {
+                MlasQ4GemmKernelDirect<4>(A + m * lda, lda, PackedB, C + m * ldc + n, ldc, CountN, K, BlockSize, bias);
+                m += 4;
+            }
+
+            if (M - m >= 2) {
+                MlasQ4GemmKernelDirect<2>(A + m * lda, lda, PackedB, C + m * ldc + n, ldc, CountN, K, BlockSize, bias);
+                m += 2;
+            }
+
+            if (M - m >= 1) {
+                MlasQ4GemmKernelDirect<1>(A + m * lda, lda, PackedB, C + m * ldc + n, ldc, CountN, K, BlockSize, bias);
+            }
+
+            PackedB += PackedGroupStride;
+        }
+
+        return;
+    }
+
+    //
+    // Dequantize panels of matrix B and reuse the single precision GEMM
+    // kernels, which amortize the dequantization across the rows of matrix A.
+    //
+
+    MLAS_DECLSPEC_ALIGN(float Panel[MLAS_Q4GEMM_PANEL_K * MLAS_Q4GEMM_PANEL_N], 16 * sizeof(float));
+
+    for (size_t n = 0; n < RangeCountN; n += MLAS_Q4GEMM_PANEL_N) {
+
+        const size_t CountN = std::min(RangeCountN - n, size_t(MLAS_Q4GEMM_PANEL_N));
+        const uint8_t* pb = PackedB + (n / MLAS_Q4GEMM_GROUP_N) * PackedGroupStride;
+
+        for (size_t k = 0; k < K; k += MLAS_Q4GEMM_PANEL_K) {
+
+            const size_t CountK = std::min(K - k, size_t(MLAS_Q4GEMM_PANEL_K));
+
+            MlasQ4GemmDequantizePanel(pb, PackedGroupStride, Panel, CountN, k, CountK, BlockSize);
+
+            MlasSgemmOperation(CblasNoTrans, CblasNoTrans, M, CountN, CountK, 1.0f,
+                A + k, lda, Panel, MLAS_Q4GEMM_PANEL_N, (k == 0) ? 0.0f : 1.0f, C + n, ldc);
+        }
+
+        if (Bias != nullptr) {
+
+            for (size_t m = 0; m < M; m++) {
+
+                float* c = C + m * ldc + n;
+
+                for (size_t nn = 0; nn < CountN; nn++) {
+                    c[nn] += Bias[n + nn];
+                }
+            }
+        }
+    }
+}
+
+void
+MLASCALL
+MlasQ4GemmBatch(
+    size_t M,
+    size_t N,
+    size_t K,
+    size_t BlockSize,
+    const MLAS_Q4_GEMM_DATA_PARAMS* DataParams,
+    size_t BatchN,
+    MLAS_THREADPOOL* ThreadPool
+    )
+/*++
+
+Routine Description:
+
+    This routine implements a batch of single precision matrix/matrix
+    multiply operations where matrix B has been packed by MlasQ4GemmPackB.
+
+Arguments:
+
+    M - Supplies the number of rows of matrix A and matrix C.
+
+    N - Supplies the number of columns of matrix B and matrix C.
+
+    K - Supplies the number of columns of matrix A and rows of matrix B.
+
+    BlockSize - Supplies the quantization block size along K.
+
+    DataParams - Supplies an array of BatchN data parameter blocks.
+
+    BatchN - Supplies the number of operations in the batch.
+
+    ThreadPool - Supplies the thread pool object to use, else nullptr if the
+        base library threading support should be used.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    //
+    // Compute the number of target threads given the complexity of the
+    // operation. Small requests should run using the single threaded path.
+    //
+
+    const double Complexity = double(M) * double(N) * double(K) * double(BatchN);
+
+    ptrdiff_t TargetThreadCount;
+
+    if (Complexity < double(MLAS_SGEMM_THREAD_COMPLEXITY * MlasPlatform.MaximumThreadCount)) {
+        TargetThreadCount = ptrdiff_t(Complexity / double(MLAS_SGEMM_THREAD_COMPLEXITY)) + 1;
+    } else {
+        TargetThreadCount = MlasPlatform.MaximumThreadCount;
+    }
+
+    ptrdiff_t MaximumThreadCount = MlasGetMaximumThreadCount(ThreadPool);
+
+    if (TargetThreadCount >= MaximumThreadCount) {
+        TargetThreadCount = MaximumThreadCount;
+    }
+
+    //
+    // Segment the operation across multiple threads by partitioning the
+    // columns of matrix B, so that each thread streams a disjoint slice of the
+    // quantized weights.
+    //
+
+    const size_t StrideN = (M <= MLAS_Q4GEMM_DIRECT_MAXIMUM_M) ?
+        MLAS_SGEMM_STRIDEN_THREAD_ALIGN : MLAS_Q4GEMM_PANEL_N;
+    const size_t BlockedN = (N + StrideN - 1) / StrideN;
+
+    ptrdiff_t ThreadsPerGemm = TargetThreadCount / ptrdiff_t(BatchN);
+
+    if (ThreadsPerGemm < 1) {
+        ThreadsPerGemm = 1;
+    }
+
+    if (size_t(ThreadsPerGemm) > BlockedN) {
+        ThreadsPerGemm = ptrdiff_t(BlockedN);
+    }
+
+    MlasTrySimpleParallel(ThreadPool, ThreadsPerGemm * ptrdiff_t(BatchN), [&](ptrdiff_t tid) {
+
+        const ptrdiff_t GemmIndex = tid / ThreadsPerGemm;
+        const ptrdiff_t ThreadIdN = tid % ThreadsPerGemm;
+
+        size_t RangeStartN;
+        size_t RangeCountN;
+
+        MlasPartitionWork(ThreadIdN, ThreadsPerGemm, BlockedN, &RangeStartN, &RangeCountN);
+
+        RangeStartN *= StrideN;
+        RangeCountN *= StrideN;
+        RangeCountN = std::min(N - RangeStartN, RangeCountN);
+
+        if (RangeCountN > 0) {
+            MlasQ4GemmOperation(M, K, BlockSize, &DataParams[GemmIndex], RangeStartN, RangeCountN);
+        }
+    });
+}
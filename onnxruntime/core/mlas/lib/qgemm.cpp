@@ -125,6 +125,26 @@ MlasGemmU8X8ScaleSumBuffer(
     return MlasGemmU8X8ScaleSumBuffer(SumBuffer, SumBuffer, N, Scale);
 }
 
+MLAS_FORCEINLINE
+int32_t
+MlasGemmU8X8FixupZeroPointA(
+    uint8_t ZeroPointA,
+    bool AIsSigned
+    )
+{
+    //
+    // Signed matrix A data is converted to unsigned data by flipping the sign
+    // bit as the data is copied to the packed buffer. Apply the same offset to
+    // the zero point so that the differences (A[i] - ZeroPointA) are preserved.
+    //
+
+    if (AIsSigned) {
+        ZeroPointA = uint8_t(ZeroPointA ^ 0x80);
+    }
+
+    return int32_t(ZeroPointA);
+}
+
 template<typename KernelType>
 MLAS_FORCEINLINE
 bool
@@ -196,7 +216,8 @@ MlasGemmU8X8CopyPackA(
     size_t lda,
     size_t CountM,
     size_t CountK,
-    int32_t* RowSumBuffer
+    int32_t* RowSumBuffer,
+    bool AIsSigned
     );
 
 template<typename KernelType>
@@ -285,14 +306,15 @@ Return Value:
     const uint8_t* PackedZeroPointB = Data->PerColumnZeroPoints ?
         Data->ZeroPointB + RangeStartN : nullptr;
 
-    int32_t ZeroPointA = Data->ZeroPointA;
+    int32_t ZeroPointA = MlasGemmU8X8FixupZeroPointA(Data->ZeroPointA, Shape->AIsSigned);
     int32_t ZeroPointB = typename KernelType::OffsetBType(*Data->ZeroPointB);
 
     //
-    // Try to use a GEMV kernel if supported by this kernel type.
+    // Try to use a GEMV kernel if supported by this kernel type. The GEMV
+    // kernels consume matrix A directly, so signed data cannot be handled.
     //
 
-    if ((RangeCountM == 1) &&
+    if ((RangeCountM == 1) && !Shape->AIsSigned &&
         (ZeroPointA == 0) && (PackedZeroPointB == nullptr) && (ZeroPointB == 0) &&
         (Data->OutputProcessor == nullptr)) {
         if (MlasGemmU8X8TryGemvKernel<KernelType>(A, B, ldb, C, K, RangeCountN, Shape->BIsSigned)) {
@@ -379,7 +401,8 @@ Return Value:
                     lda,
                     CountM,
                     CountK,
-                    RowSumBuffer);
+                    RowSumBuffer,
+                    Shape->AIsSigned);
 
                 //
                 // Apply the global depth value constant without the ZeroPointB scaling from:
@@ -509,7 +532,7 @@ Return Value:
     const uint8_t* PackedZeroPointB = Data->PerColumnZeroPoints ?
         Data->ZeroPointB + RangeStartN : nullptr;
 
-    int32_t ZeroPointA = Data->ZeroPointA;
+    int32_t ZeroPointA = MlasGemmU8X8FixupZeroPointA(Data->ZeroPointA, Shape->AIsSigned);
     int32_t ZeroPointB = typename KernelType::OffsetBType(*Data->ZeroPointB);
 
     //
@@ -597,7 +620,8 @@ Return Value:
                     lda,
                     CountM,
                     CountK,
-                    RowSumBuffer);
+                    RowSumBuffer,
+                    Shape->AIsSigned);
 
                 //
                 // Apply the global depth value constant without the ZeroPointB scaling from:
@@ -709,11 +733,14 @@ MlasGemmU8X8CopyPackA<MLAS_GEMM_U8X8_KERNEL_SSE>(
     size_t lda,
     size_t CountM,
     size_t CountK,
-    int32_t* RowSumBuffer
+    int32_t* RowSumBuffer,
+    bool AIsSigned
     )
 {
     const __m128i ZeroVector = _mm_setzero_si128();
     const __m128i OnesWordBroadcast = _mm_set1_epi16(1);
+    const __m128i BitFlipVector = _mm_set1_epi32(AIsSigned ? 0x80808080 : 0);
+    const uint8_t BitFlipValue = (AIsSigned ? 0x80 : 0);
     uint8_t PaddedMatrixAData[8] = { 0 };
 
     //
@@ -742,6 +769,7 @@ MlasGemmU8X8CopyPackA<MLAS_GEMM_U8X8_KERNEL_SSE>(
         while (k >= 8) {
 
             __m128i Bytes = _mm_loadl_epi64((__m128i*)&a[0]);
+            Bytes = _mm_xor_si128(Bytes, BitFlipVector);
             __m128i Words = _mm_unpacklo_epi8(Bytes, ZeroVector);
 
             ReductionVector = _mm_add_epi16(ReductionVector, Words);
@@ -763,7 +791,7 @@ MlasGemmU8X8CopyPackA<MLAS_GEMM_U8X8_KERNEL_SSE>(
             uint8_t* padded_end = padded + k;
 
             do {
-                padded[0] = a[0];
+                padded[0] = uint8_t(a[0] ^ BitFlipValue);
                 padded++;
                 a++;
             } while (padded < padded_end);
@@ -1208,6 +1236,104 @@ extern "C" {
         );
 }
 
+template<typename PackedAType>
+void
+MlasGemmU8X8CopyPackASignedSse(
+    PackedAType* D,
+    const uint8_t* A,
+    size_t lda,
+    size_t CountM,
+    size_t CountK,
+    size_t AlignedCountK,
+    int32_t* RowSumBuffer
+    )
+/*++
+
+Routine Description:
+
+    This routine copies elements from the signed source matrix to the
+    destination packed buffer.
+
+    The elements are converted to unsigned values by flipping the sign bit and
+    are optionally zero extended to 16-bits. The packed buffer has the same
+    data ordering as the source bytes, but CountK is aligned up to the supplied
+    AlignedCountK and all padding elements are zero filled. This matches the
+    layout produced by the AVX2 assembly CopyPackA routines.
+
+Arguments:
+
+    D - Supplies the address of the destination packed buffer.
+
+    A - Supplies the address of the source matrix.
+
+    lda - Supplies the number of elements per row of the source matrix.
+
+    CountM - Supplies the number of rows of the source matrix to copy.
+
+    CountK - Supplies the number of columns of the source matrix to copy.
+
+    AlignedCountK - Supplies the number of columns of the packed buffer.
+
+    RowSumBuffer - Supplies the address of the buffer to receive the sums of
+        the elements along each of the rows.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const __m128i ZeroVector = _mm_setzero_si128();
+    const __m128i BitFlipVector = _mm_set1_epi32(0x80808080);
+
+    while (CountM-- > 0) {
+
+        const uint8_t* a = A;
+        size_t k = CountK;
+        __m128i ReductionVector = ZeroVector;
+
+        while (k >= 16) {
+
+            __m128i Bytes = _mm_loadu_si128((const __m128i*)a);
+            Bytes = _mm_xor_si128(Bytes, BitFlipVector);
+
+            ReductionVector = _mm_add_epi64(ReductionVector, _mm_sad_epu8(Bytes, ZeroVector));
+
+            if (std::is_same<PackedAType, uint8_t>::value) {
+                _mm_storeu_si128((__m128i*)&D[0], Bytes);
+            } else {
+                _mm_storeu_si128((__m128i*)&D[0], _mm_unpacklo_epi8(Bytes, ZeroVector));
+                _mm_storeu_si128((__m128i*)&D[8], _mm_unpackhi_epi8(Bytes, ZeroVector));
+            }
+
+            a += 16;
+            D += 16;
+            k -= 16;
+        }
+
+        ReductionVector = _mm_add_epi32(ReductionVector,
+            _mm_shuffle_epi32(ReductionVector, _MM_SHUFFLE(3, 2, 3, 2)));
+
+        int32_t RowSum = _mm_cvtsi128_si32(ReductionVector);
+
+        for (; k > 0; k--) {
+
+            uint8_t a0 = uint8_t(*a++ ^ 0x80);
+            *D++ = PackedAType(a0);
+
+            RowSum += a0;
+        }
+
+        for (size_t kk = CountK; kk < AlignedCountK; kk++) {
+            *D++ = 0;
+        }
+
+        *RowSumBuffer++ = RowSum;
+
+        A += lda;
+    }
+}
+
 struct MLAS_GEMM_U8S8_KERNEL_AVX2
 {
     typedef uint8_t PackedAType;
@@ -1268,10 +1394,17 @@ MlasGemmU8X8CopyPackA<MLAS_GEMM_U8S8_KERNEL_AVX2>(
     size_t lda,
     size_t CountM,
     size_t CountK,
-    int32_t* RowSumBuffer
+    int32_t* RowSumBuffer,
+    bool AIsSigned
     )
 {
-    MlasGemmU8S8CopyPackAAvx2(D, A, lda, CountM, CountK, RowSumBuffer);
+    if (AIsSigned) {
+        const size_t AlignedCountK = (CountK + MLAS_GEMM_U8S8_KERNEL_AVX2::PackedK - 1) &
+            ~(MLAS_GEMM_U8S8_KERNEL_AVX2::PackedK - 1);
+        MlasGemmU8X8CopyPackASignedSse(D, A, lda, CountM, CountK, AlignedCountK, RowSumBuffer);
+    } else {
+        MlasGemmU8S8CopyPackAAvx2(D, A, lda, CountM, CountK, RowSumBuffer);
+    }
 }
 
 template<>
@@ -1356,10 +1489,17 @@ MlasGemmU8X8CopyPackA<MLAS_GEMM_U8U8_KERNEL_AVX2>(
     size_t lda,
     size_t CountM,
     size_t CountK,
-    int32_t* RowSumBuffer
+    int32_t* RowSumBuffer,
+    bool AIsSigned
     )
 {
-    MlasGemmU8U8CopyPackAAvx2(D, A, lda, CountM, CountK, RowSumBuffer);
+    if (AIsSigned) {
+        const size_t AlignedCountK = (CountK + MLAS_GEMM_U8U8_KERNEL_AVX2::PackedK - 1) &
+            ~(MLAS_GEMM_U8U8_KERNEL_AVX2::PackedK - 1);
+        MlasGemmU8X8CopyPackASignedSse(D, A, lda, CountM, CountK, AlignedCountK, RowSumBuffer);
+    } else {
+        MlasGemmU8U8CopyPackAAvx2(D, A, lda, CountM, CountK, RowSumBuffer);
+    }
 }
 
 template<>
@@ -1476,9 +1616,13 @@ MlasGemmU8X8CopyPackA<MLAS_GEMM_U8X8_KERNEL_NEON>(
     size_t lda,
     size_t CountM,
     size_t CountK,
-    int32_t* RowSumBuffer
+    int32_t* RowSumBuffer,
+    bool AIsSigned
     )
 {
+    const uint32_t BitFlipValue32 = (AIsSigned ? 0x80808080 : 0);
+    const uint32x4_t BitFlipVector = vmovq_n_u32(BitFlipValue32);
+    const uint8_t BitFlipValue = (AIsSigned ? 0x80 : 0);
     uint8_t PaddedMatrixAData[16];
 
     //
@@ -1508,13 +1652,13 @@ MlasGemmU8X8CopyPackA<MLAS_GEMM_U8X8_KERNEL_NEON>(
 
         while (k >= 16) {
 
-            uint32x4_t v0 = vld1q_u32(reinterpret_cast<const uint32_t*>(a0));
+            uint32x4_t v0 = veorq_u32(vld1q_u32(reinterpret_cast<const uint32_t*>(a0)), BitFlipVector);
             a0 += 16;
-            uint32x4_t v1 = vld1q_u32(reinterpret_cast<const uint32_t*>(a1));
+            uint32x4_t v1 = veorq_u32(vld1q_u32(reinterpret_cast<const uint32_t*>(a1)), BitFlipVector);
             a1 += 16;
-            uint32x4_t v2 = vld1q_u32(reinterpret_cast<const uint32_t*>(a2));
+            uint32x4_t v2 = veorq_u32(vld1q_u32(reinterpret_cast<const uint32_t*>(a2)), BitFlipVector);
             a2 += 16;
-            uint32x4_t v3 = vld1q_u32(reinterpret_cast<const uint32_t*>(a3));
+            uint32x4_t v3 = veorq_u32(vld1q_u32(reinterpret_cast<const uint32_t*>(a3)), BitFlipVector);
             a3 += 16;
 
 #if defined(MLAS_NEON32_INTRINSICS)
@@ -1561,13 +1705,13 @@ MlasGemmU8X8CopyPackA<MLAS_GEMM_U8X8_KERNEL_NEON>(
 
         while (k >= 4) {
 
-            uint32_t v0 = *reinterpret_cast<const uint32_t*>(a0);
+            uint32_t v0 = *reinterpret_cast<const uint32_t*>(a0) ^ BitFlipValue32;
             a0 += 4;
-            uint32_t v1 = *reinterpret_cast<const uint32_t*>(a1);
+            uint32_t v1 = *reinterpret_cast<const uint32_t*>(a1) ^ BitFlipValue32;
             a1 += 4;
-            uint32_t v2 = *reinterpret_cast<const uint32_t*>(a2);
+            uint32_t v2 = *reinterpret_cast<const uint32_t*>(a2) ^ BitFlipValue32;
             a2 += 4;
-            uint32_t v3 = *reinterpret_cast<const uint32_t*>(a3);
+            uint32_t v3 = *reinterpret_cast<const uint32_t*>(a3) ^ BitFlipValue32;
             a3 += 4;
 
             *reinterpret_cast<uint32_t*>(&D[0]) = v0;
@@ -1593,10 +1737,10 @@ MlasGemmU8X8CopyPackA<MLAS_GEMM_U8X8_KERNEL_NEON>(
 
             while (k > 0) {
 
-                d[0] = *a0++;
-                d[4] = *a1++;
-                d[8] = *a2++;
-                d[12] = *a3++;
+                d[0] = uint8_t(*a0++ ^ BitFlipValue);
+                d[4] = uint8_t(*a1++ ^ BitFlipValue);
+                d[8] = uint8_t(*a2++ ^ BitFlipValue);
+                d[12] = uint8_t(*a3++ ^ BitFlipValue);
 
                 d += 1;
                 k -= 1;
@@ -1642,9 +1786,9 @@ MlasGemmU8X8CopyPackA<MLAS_GEMM_U8X8_KERNEL_NEON>(
 
         while (k >= 4) {
 
-            uint32_t v0 = *reinterpret_cast<const uint32_t*>(a0);
+            uint32_t v0 = *reinterpret_cast<const uint32_t*>(a0) ^ BitFlipValue32;
             a0 += 4;
-            uint32_t v1 = *reinterpret_cast<const uint32_t*>(a1);
+            uint32_t v1 = *reinterpret_cast<const uint32_t*>(a1) ^ BitFlipValue32;
             a1 += 4;
 
             *reinterpret_cast<uint32_t*>(&D[0]) = v0;
@@ -1668,8 +1812,8 @@ MlasGemmU8X8CopyPackA<MLAS_GEMM_U8X8_KERNEL_NEON>(
 
             while (k > 0) {
 
-                d[0] = *a0++;
-                d[4] = *a1++;
+                d[0] = uint8_t(*a0++ ^ BitFlipValue);
+                d[4] = uint8_t(*a1++ ^ BitFlipValue);
 
                 d += 1;
                 k -= 1;
@@ -1712,7 +1856,7 @@ MlasGemmU8X8CopyPackA<MLAS_GEMM_U8X8_KERNEL_NEON>(
 
         while (k >= 16) {
 
-            uint8x16_t v = vld1q_u8(a);
+            uint8x16_t v = veorq_u8(vld1q_u8(a), vreinterpretq_u8_u32(BitFlipVector));
             a += 16;
 
             vst1q_u8(D, v);
@@ -1732,7 +1876,7 @@ MlasGemmU8X8CopyPackA<MLAS_GEMM_U8X8_KERNEL_NEON>(
             vst1q_u8(PaddedMatrixAData, vmovq_n_u8(0));
 
             for (size_t kk = 0; kk < k; kk++) {
-                PaddedMatrixAData[kk] = a[kk];
+                PaddedMatrixAData[kk] = uint8_t(a[kk] ^ BitFlipValue);
             }
 
             uint8x16_t v = vld1q_u8(PaddedMatrixAData);
@@ -1970,9 +2114,13 @@ MlasGemmU8X8CopyPackA<MLAS_GEMM_U8X8_KERNEL_UDOT>(
     size_t lda,
     size_t CountM,
     size_t CountK,
-    int32_t* RowSumBuffer
+    int32_t* RowSumBuffer,
+    bool AIsSigned
     )
 {
+    const uint32_t BitFlipValue32 = (AIsSigned ? 0x80808080 : 0);
+    const uint32x4_t BitFlipVector = vmovq_n_u32(BitFlipValue32);
+    const uint8_t BitFlipValue = (AIsSigned ? 0x80 : 0);
     uint8_t PaddedMatrixAData[16];
 
     //
@@ -2002,13 +2150,13 @@ MlasGemmU8X8CopyPackA<MLAS_GEMM_U8X8_KERNEL_UDOT>(
 
         while (k >= 16) {
 
-            uint32x4_t v0 = vld1q_u32(reinterpret_cast<const uint32_t*>(a0));
+            uint32x4_t v0 = veorq_u32(vld1q_u32(reinterpret_cast<const uint32_t*>(a0)), BitFlipVector);
             a0 += 16;
-            uint32x4_t v1 = vld1q_u32(reinterpret_cast<const uint32_t*>(a1));
+            uint32x4_t v1 = veorq_u32(vld1q_u32(reinterpret_cast<const uint32_t*>(a1)), BitFlipVector);
             a1 += 16;
-            uint32x4_t v2 = vld1q_u32(reinterpret_cast<const uint32_t*>(a2));
+            uint32x4_t v2 = veorq_u32(vld1q_u32(reinterpret_cast<const uint32_t*>(a2)), BitFlipVector);
             a2 += 16;
-            uint32x4_t v3 = vld1q_u32(reinterpret_cast<const uint32_t*>(a3));
+            uint32x4_t v3 = veorq_u32(vld1q_u32(reinterpret_cast<const uint32_t*>(a3)), BitFlipVector);
             a3 += 16;
 
             uint32x4_t z0 = vzip1q_u32(v0, v2);
@@ -2037,13 +2185,13 @@ MlasGemmU8X8CopyPackA<MLAS_GEMM_U8X8_KERNEL_UDOT>(
 
         while (k >= 4) {
 
-            uint32_t v0 = *reinterpret_cast<const uint32_t*>(a0);
+            uint32_t v0 = *reinterpret_cast<const uint32_t*>(a0) ^ BitFlipValue32;
             a0 += 4;
-            uint32_t v1 = *reinterpret_cast<const uint32_t*>(a1);
+            uint32_t v1 = *reinterpret_cast<const uint32_t*>(a1) ^ BitFlipValue32;
             a1 += 4;
-            uint32_t v2 = *reinterpret_cast<const uint32_t*>(a2);
+            uint32_t v2 = *reinterpret_cast<const uint32_t*>(a2) ^ BitFlipValue32;
             a2 += 4;
-            uint32_t v3 = *reinterpret_cast<const uint32_t*>(a3);
+            uint32_t v3 = *reinterpret_cast<const uint32_t*>(a3) ^ BitFlipValue32;
             a3 += 4;
 
             *reinterpret_cast<uint32_t*>(&D[0]) = v0;
@@ -2069,10 +2217,10 @@ MlasGemmU8X8CopyPackA<MLAS_GEMM_U8X8_KERNEL_UDOT>(
 
             while (k > 0) {
 
-                d[0] = *a0++;
-                d[4] = *a1++;
-                d[8] = *a2++;
-                d[12] = *a3++;
+                d[0] = uint8_t(*a0++ ^ BitFlipValue);
+                d[4] = uint8_t(*a1++ ^ BitFlipValue);
+                d[8] = uint8_t(*a2++ ^ BitFlipValue);
+                d[12] = uint8_t(*a3++ ^ BitFlipValue);
 
                 d += 1;
                 k -= 1;
@@ -2125,9 +2273,9 @@ MlasGemmU8X8CopyPackA<MLAS_GEMM_U8X8_KERNEL_UDOT>(
 
         while (k >= 4) {
 
-            uint32_t v0 = *reinterpret_cast<const uint32_t*>(a0);
+            uint32_t v0 = *reinterpret_cast<const uint32_t*>(a0) ^ BitFlipValue32;
             a0 += 4;
-            uint32_t v1 = *reinterpret_cast<const uint32_t*>(a1);
+            uint32_t v1 = *reinterpret_cast<const uint32_t*>(a1) ^ BitFlipValue32;
             a1 += 4;
 
             *reinterpret_cast<uint32_t*>(&D[0]) = v0;
@@ -2151,8 +2299,8 @@ MlasGemmU8X8CopyPackA<MLAS_GEMM_U8X8_KERNEL_UDOT>(
 
             while (k > 0) {
 
-                d[0] = *a0++;
-                d[4] = *a1++;
+                d[0] = uint8_t(*a0++ ^ BitFlipValue);
+                d[4] = uint8_t(*a1++ ^ BitFlipValue);
 
                 d += 1;
                 k -= 1;
@@ -2202,7 +2350,7 @@ MlasGemmU8X8CopyPackA<MLAS_GEMM_U8X8_KERNEL_UDOT>(
 
         while (k >= 16) {
 
-            uint8x16_t v = vld1q_u8(a);
+            uint8x16_t v = veorq_u8(vld1q_u8(a), vreinterpretq_u8_u32(BitFlipVector));
             a += 16;
 
             vst1q_u8(D, v);
@@ -2222,7 +2370,7 @@ MlasGemmU8X8CopyPackA<MLAS_GEMM_U8X8_KERNEL_UDOT>(
             vst1q_u8(PaddedMatrixAData, vmovq_n_u8(0));
 
             for (size_t kk = 0; kk < k; kk++) {
-                PaddedMatrixAData[kk] = a[kk];
+                PaddedMatrixAData[kk] = uint8_t(a[kk] ^ BitFlipValue);
             }
 
             uint8x16_t v = vld1q_u8(PaddedMatrixAData);
@@ -2513,11 +2661,13 @@ MlasGemmU8X8CopyPackA<MLAS_GEMM_U8X8_KERNEL_DEFAULT>(
     size_t lda,
     size_t CountM,
     size_t CountK,
-    int32_t* RowSumBuffer
+    int32_t* RowSumBuffer,
+    bool AIsSigned
     )
 {
     const size_t AlignedCountK =
         (CountK + MLAS_GEMM_U8X8_KERNEL_DEFAULT::PackedK - 1) & ~(MLAS_GEMM_U8X8_KERNEL_DEFAULT::PackedK - 1);
+    const uint8_t BitFlipValue = (AIsSigned ? 0x80 : 0);
 
     //
     // Process a single row of matrix A in a loop.
@@ -2529,7 +2679,7 @@ MlasGemmU8X8CopyPackA<MLAS_GEMM_U8X8_KERNEL_DEFAULT>(
 
         for (size_t k = 0; k < CountK; k++) {
 
-            uint8_t a0 = A[k];
+            uint8_t a0 = uint8_t(A[k] ^ BitFlipValue);
             D[k] = a0;
 
             RowSum += a0;
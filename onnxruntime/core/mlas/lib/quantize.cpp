@@ -352,17 +352,18 @@ MlasQuantizeLinear<uint8_t>(
 
 #if defined(MLAS_SSE2_INTRINSICS)
 
+template<typename OutputType>
 void
 MLASCALL
 MlasRequantizeOutput(
     const int32_t* Input,
-    uint8_t* Output,
+    OutputType* Output,
     const int32_t* Bias,
     size_t M,
     size_t N,
     const float* Scale,
     bool PerColumnScale,
-    uint8_t ZeroPoint
+    OutputType ZeroPoint
     )
 /*++
 
@@ -402,8 +403,8 @@ Return Value:
 --*/
 {
     const __m128 PerMatrixScaleVector = PerColumnScale ? _mm_setzero_ps() : _mm_load1_ps(Scale);
-    const __m128 MinimumValueVector = _mm_set1_ps(float(0 - ZeroPoint));
-    const __m128 MaximumValueVector = _mm_set1_ps(float(255 - ZeroPoint));
+    const __m128 MinimumValueVector = _mm_set1_ps(float(int32_t(std::numeric_limits<OutputType>::lowest()) - ZeroPoint));
+    const __m128 MaximumValueVector = _mm_set1_ps(float(int32_t(std::numeric_limits<OutputType>::max()) - ZeroPoint));
     const __m128i ZeroPointVector = _mm_set1_epi32(ZeroPoint);
 
     //
@@ -486,10 +487,22 @@ Return Value:
             IntegerVector2 = _mm_add_epi32(IntegerVector2, ZeroPointVector);
             IntegerVector3 = _mm_add_epi32(IntegerVector3, ZeroPointVector);
 
-            __m128i WordVector0 = _mm_packus_epi16(IntegerVector0, IntegerVector1);
-            __m128i WordVector1 = _mm_packus_epi16(IntegerVector2, IntegerVector3);
+            __m128i ByteVector;
+
+            if (std::is_signed<OutputType>::value) {
 
-            __m128i ByteVector = _mm_packus_epi16(WordVector0, WordVector1);
+                __m128i WordVector0 = _mm_packs_epi32(IntegerVector0, IntegerVector1);
+                __m128i WordVector1 = _mm_packs_epi32(IntegerVector2, IntegerVector3);
+
+                ByteVector = _mm_packs_epi16(WordVector0, WordVector1);
+
+            } else {
+
+                __m128i WordVector0 = _mm_packus_epi16(IntegerVector0, IntegerVector1);
+                __m128i WordVector1 = _mm_packus_epi16(IntegerVector2, IntegerVector3);
+
+                ByteVector = _mm_packus_epi16(WordVector0, WordVector1);
+            }
 
             _mm_storeu_si128((__m128i*)Output, ByteVector);
             Output += 16;
@@ -560,8 +573,13 @@ Return Value:
             IntegerVector = _mm_cvtps_epi32(FloatVector);
             IntegerVector = _mm_add_epi32(IntegerVector, ZeroPointVector);
 
-            IntegerVector = _mm_packus_epi16(IntegerVector, IntegerVector);
-            IntegerVector = _mm_packus_epi16(IntegerVector, IntegerVector);
+            if (std::is_signed<OutputType>::value) {
+                IntegerVector = _mm_packs_epi32(IntegerVector, IntegerVector);
+                IntegerVector = _mm_packs_epi16(IntegerVector, IntegerVector);
+            } else {
+                IntegerVector = _mm_packus_epi16(IntegerVector, IntegerVector);
+                IntegerVector = _mm_packus_epi16(IntegerVector, IntegerVector);
+            }
 
             uint32_t OutputValue = uint32_t(_mm_cvtsi128_si32(IntegerVector));
 
@@ -574,7 +592,7 @@ Return Value:
 
             } else {
 
-                *Output = uint8_t(OutputValue);
+                *Output = OutputType(OutputValue);
                 Output += 1;
 
                 n -= 1;
@@ -585,17 +603,18 @@ Return Value:
 
 #elif defined(MLAS_NEON64_INTRINSICS)
 
+template<typename OutputType>
 void
 MLASCALL
 MlasRequantizeOutput(
     const int32_t* Input,
-    uint8_t* Output,
+    OutputType* Output,
     const int32_t* Bias,
     size_t M,
     size_t N,
     const float* Scale,
     bool PerColumnScale,
-    uint8_t ZeroPoint
+    OutputType ZeroPoint
     )
 /*++
 
@@ -720,7 +739,7 @@ Return Value:
 
             //
             // Pack the integers with saturation to 16-bit values and shift by
-            // the zero point, then pack the integers again to unsigned bytes.
+            // the zero point, then pack the integers again to bytes.
             //
 
             int16x8x2_t WordVector;
@@ -731,7 +750,15 @@ Return Value:
             WordVector.val[0] = vqaddq_s16(WordVector.val[0], ZeroPointVector);
             WordVector.val[1] = vqaddq_s16(WordVector.val[1], ZeroPointVector);
 
-            vst1q_u8(Output, vqmovun_high_s16(vqmovun_s16(WordVector.val[0]), WordVector.val[1]));
+            uint8x16_t ByteVector;
+
+            if (std::is_signed<OutputType>::value) {
+                ByteVector = vreinterpretq_u8_s8(vqmovn_high_s16(vqmovn_s16(WordVector.val[0]), WordVector.val[1]));
+            } else {
+                ByteVector = vqmovun_high_s16(vqmovun_s16(WordVector.val[0]), WordVector.val[1]);
+            }
+
+            vst1q_u8(reinterpret_cast<uint8_t*>(Output), ByteVector);
             Output += 16;
 
             n -= 16;
@@ -803,13 +830,19 @@ Return Value:
 
             //
             // Pack the integers with saturation to 16-bit values and shift by
-            // the zero point, then pack the integers again to unsigned bytes.
+            // the zero point, then pack the integers again to bytes.
             //
 
             int16x8_t WordVector = vcombine_s16(vqmovn_s32(IntegerVector), vdup_n_s16(0));
             WordVector = vqaddq_s16(WordVector, ZeroPointVector);
 
-            uint8x16_t ByteVector = vcombine_u8(vqmovun_s16(WordVector), vdup_n_u8(0));
+            uint8x16_t ByteVector;
+
+            if (std::is_signed<OutputType>::value) {
+                ByteVector = vcombine_u8(vreinterpret_u8_s8(vqmovn_s16(WordVector)), vdup_n_u8(0));
+            } else {
+                ByteVector = vcombine_u8(vqmovun_s16(WordVector), vdup_n_u8(0));
+            }
 
             if (n >= 4) {
 
@@ -820,7 +853,7 @@ Return Value:
 
             } else {
 
-                vst1q_lane_u8(Output, ByteVector, 0);
+                vst1q_lane_u8(reinterpret_cast<uint8_t*>(Output), ByteVector, 0);
                 Output += 1;
 
                 n -= 1;
@@ -831,17 +864,18 @@ Return Value:
 
 #else
 
+template<typename OutputType>
 void
 MLASCALL
 MlasRequantizeOutput(
     const int32_t* Input,
-    uint8_t* Output,
+    OutputType* Output,
     const int32_t* Bias,
     size_t M,
     size_t N,
     const float* Scale,
     bool PerColumnScale,
-    uint8_t ZeroPoint
+    OutputType ZeroPoint
     )
 /*++
 
@@ -881,8 +915,8 @@ Return Value:
 --*/
 {
     const float PerMatrixScaleValue = PerColumnScale ? 0.0f : *Scale;
-    const float MinimumValue = float(0 - ZeroPoint);
-    const float MaximumValue = float(255 - ZeroPoint);
+    const float MinimumValue = float(int32_t(std::numeric_limits<OutputType>::lowest()) - ZeroPoint);
+    const float MaximumValue = float(int32_t(std::numeric_limits<OutputType>::max()) - ZeroPoint);
 
     //
     // Step through each row of the output matrix.
@@ -920,7 +954,7 @@ Return Value:
             IntegerValue = int32_t(MlasBitsOfFp32(FloatValue + MLAS_ROUNDING_BIAS_MAGIC)) -
                 MLAS_ROUNDING_BIAS_MAGIC_BITS;
 
-            *Output++ = uint8_t(IntegerValue + ZeroPoint);
+            *Output++ = OutputType(IntegerValue + ZeroPoint);
 
             n -= 1;
         }
@@ -929,6 +963,34 @@ Return Value:
 
 #endif
 
+template
+void
+MLASCALL
+MlasRequantizeOutput<int8_t>(
+    const int32_t* Input,
+    int8_t* Output,
+    const int32_t* Bias,
+    size_t M,
+    size_t N,
+    const float* Scale,
+    bool PerColumnScale,
+    int8_t ZeroPoint
+    );
+
+template
+void
+MLASCALL
+MlasRequantizeOutput<uint8_t>(
+    const int32_t* Input,
+    uint8_t* Output,
+    const int32_t* Bias,
+    size_t M,
+    size_t N,
+    const float* Scale,
+    bool PerColumnScale,
+    uint8_t ZeroPoint
+    );
+
 void
 MLASCALL
 MlasFindMinMaxElement(
@@ -0,0 +1,571 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    spgemm.cpp
+
+Abstract:
+
+    This module implements the single precision matrix/matrix multiply
+    operation (SGEMM) where one of the source matrices is sparse.
+
+    A sparse A matrix is supplied in compressed sparse row (CSR) form and is
+    multiplied by a dense B matrix: each nonzero of a row of A scales a row
+    of B that is accumulated into the same row of C.
+
+    A sparse B matrix is supplied in compressed sparse column (CSC) form and
+    a dense A matrix is multiplied by it: each element of C is the dot
+    product of a row of A gathered at the nonzero rows of a column of B. Rows
+    of A are transposed into panels so that one nonzero element of B updates
+    the dot products of a panel of rows with vector operations.
+
+--*/
+
+#include "mlasi.h"
+
+//
+// Define the number of rows of matrix A assigned to a thread as a unit by the
+// dense A by sparse B kernel.
+//
+
+#define MLAS_SPARSE_GEMM_ROWS 4
+
+//
+// Define the parameters to execute segments of a sparse GEMM operation on
+// worker threads.
+//
+
+struct MLAS_SPARSE_GEMM_WORK_BLOCK {
+    ptrdiff_t ThreadCountM;
+    ptrdiff_t ThreadCountN;
+    size_t M;
+    size_t N;
+    float Alpha;
+    const float* Dense;
+    size_t ldd;
+    const float* Values;
+    const uint32_t* Indices;
+    const size_t* Offsets;
+    float* C;
+    size_t ldc;
+};
+
+void
+MlasSparseGemmPartition(
+    const size_t* Offsets,
+    size_t Count,
+    ptrdiff_t ThreadId,
+    ptrdiff_t ThreadCount,
+    size_t* Start,
+    size_t* End
+    )
+/*++
+
+Routine Description:
+
+    This routine partitions the rows (or columns) of a compressed sparse
+    matrix so that each thread is assigned a similar amount of work. The cost
+    of a row is estimated as its number of nonzero elements plus one for the
+    fixed per row overhead.
+
+Arguments:
+
+    Offsets - Supplies the Count + 1 offsets of the rows into the values.
+
+    Count - Supplies the number of rows.
+
+    ThreadId - Supplies the current index of the threaded operation.
+
+    ThreadCount - Supplies the total number of threads.
+
+    Start - Receives the index of the first row for this thread.
+
+    End - Receives the index one past the last row for this thread.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const size_t TotalWork = Offsets[Count] - Offsets[0] + Count;
+
+    auto FindRow = [&](ptrdiff_t Index) -> size_t {
+
+        if (Index >= ThreadCount) {
+            return Count;
+        }
+
+        const size_t Target = size_t((uint64_t(TotalWork) * uint64_t(Index)) / uint64_t(ThreadCount));
+
+        size_t Low = 0;
+        size_t High = Count;
+
+        while (Low < High) {
+            const size_t Middle = Low + (High - Low) / 2;
+            if (Offsets[Middle] - Offsets[0] + Middle < Target) {
+                Low = Middle + 1;
+            } else {
+                High = Middle;
+            }
+        }
+
+        return Low;
+    };
+
+    *Start = FindRow(ThreadId);
+    *End = FindRow(ThreadId + 1);
+}
+
+void
+MlasSparseGemmCsrAThreaded(
+    void* Context,
+    ptrdiff_t Index
+    )
+/*++
+
+Routine Description:
+
+    This routine is invoked from a worker thread to execute a segment of a
+    sparse A by dense B matrix multiply.
+
+Arguments:
+
+    Context - Supplies the pointer to the context for the threaded operation.
+
+    ThreadId - Supplies the current index of the threaded operation.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const auto* WorkBlock = (MLAS_SPARSE_GEMM_WORK_BLOCK*)Context;
+
+    size_t RowStart;
+    size_t RowEnd;
+
+    MlasSparseGemmPartition(WorkBlock->Offsets, WorkBlock->M, Index, WorkBlock->ThreadCountM,
+        &RowStart, &RowEnd);
+
+    const size_t N = WorkBlock->N;
+    const float Alpha = WorkBlock->Alpha;
+    const float* B = WorkBlock->Dense;
+    const size_t ldb = WorkBlock->ldd;
+    const float* Values = WorkBlock->Values;
+    const uint32_t* Indices = WorkBlock->Indices;
+    const size_t* Offsets = WorkBlock->Offsets;
+
+    for (size_t m = RowStart; m < RowEnd; m++) {
+
+        float* c = WorkBlock->C + m * WorkBlock->ldc;
+
+        std::fill_n(c, N, 0.0f);
+
+        //
+        // Accumulate the rows of B selected by the nonzero elements of this
+        // row of A.
+        //
+
+        for (size_t i = Offsets[m]; i < Offsets[m + 1]; i++) {
+
+            const float Scale = Alpha * Values[i];
+            const float* b = B + size_t(Indices[i]) * ldb;
+
+            MLAS_FLOAT32X4 ScaleVector = MlasBroadcastFloat32x4(Scale);
+
+            size_t n = 0;
+
+            for (; n + 8 <= N; n += 8) {
+
+                MLAS_FLOAT32X4 Vector0 = MlasLoadFloat32x4(c + n);
+                MLAS_FLOAT32X4 Vector1 = MlasLoadFloat32x4(c + n + 4);
+
+                Vector0 = MlasMultiplyAddFloat32x4(MlasLoadFloat32x4(b + n), ScaleVector, Vector0);
+                Vector1 = MlasMultiplyAddFloat32x4(MlasLoadFloat32x4(b + n + 4), ScaleVector, Vector1);
+
+                MlasStoreFloat32x4(c + n, Vector0);
+                MlasStoreFloat32x4(c + n + 4, Vector1);
+            }
+
+            for (; n + 4 <= N; n += 4) {
+                MLAS_FLOAT32X4 Vector = MlasLoadFloat32x4(c + n);
+                Vector = MlasMultiplyAddFloat32x4(MlasLoadFloat32x4(b + n), ScaleVector, Vector);
+                MlasStoreFloat32x4(c + n, Vector);
+            }
+
+            for (; n < N; n++) {
+                c[n] += Scale * b[n];
+            }
+        }
+    }
+}
+
+void
+MlasSparseGemmCscBThreaded(
+    void* Context,
+    ptrdiff_t Index
+    )
+/*++
+
+Routine Description:
+
+    This routine is invoked from a worker thread to execute a segment of a
+    dense A by sparse B matrix multiply.
+
+Arguments:
+
+    Context - Supplies the pointer to the context for the threaded operation.
+
+    ThreadId - Supplies the current index of the threaded operation.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const auto* WorkBlock = (MLAS_SPARSE_GEMM_WORK_BLOCK*)Context;
+
+    const ptrdiff_t ThreadCountN = WorkBlock->ThreadCountN;
+
+    const ptrdiff_t ThreadIdM = Index / ThreadCountN;
+    const ptrdiff_t ThreadIdN = Index % ThreadCountN;
+
+    //
+    // Partition the operation along the M dimension in blocks of rows and
+    // along the N dimension by the number of nonzero elements in the columns
+    // of B.
+    //
+
+    const size_t M = WorkBlock->M;
+    const size_t BlockCountM = (M + MLAS_SPARSE_GEMM_ROWS - 1) / MLAS_SPARSE_GEMM_ROWS;
+
+    size_t BlockStartM;
+    size_t BlocksRemainingM;
+
+    MlasPartitionWork(ThreadIdM, WorkBlock->ThreadCountM, BlockCountM, &BlockStartM, &BlocksRemainingM);
+
+    const size_t RangeStartM = BlockStartM * MLAS_SPARSE_GEMM_ROWS;
+    size_t RangeCountM = std::min(BlocksRemainingM * MLAS_SPARSE_GEMM_ROWS, M - std::min(M, RangeStartM));
+
+    size_t ColumnStart;
+    size_t ColumnEnd;
+
+    MlasSparseGemmPartition(WorkBlock->Offsets, WorkBlock->N, ThreadIdN, ThreadCountN,
+        &ColumnStart, &ColumnEnd);
+
+    const float Alpha = WorkBlock->Alpha;
+    const size_t lda = WorkBlock->ldd;
+    const size_t ldc = WorkBlock->ldc;
+    const float* Values = WorkBlock->Values;
+    const uint32_t* Indices = WorkBlock->Indices;
+    const size_t* Offsets = WorkBlock->Offsets;
+
+    const float* a = WorkBlock->Dense + RangeStartM * lda;
+    float* c = WorkBlock->C + RangeStartM * ldc;
+
+    //
+    // Process four rows of A at a time so that each nonzero element of B is
+    // loaded once for all four rows.
+    //
+
+    while (RangeCountM >= 4) {
+
+        for (size_t n = ColumnStart; n < ColumnEnd; n++) {
+
+            float Accumulator0 = 0.0f;
+            float Accumulator1 = 0.0f;
+            float Accumulator2 = 0.0f;
+            float Accumulator3 = 0.0f;
+
+            for (size_t i = Offsets[n]; i < Offsets[n + 1]; i++) {
+
+                const float Value = Values[i];
+                const size_t k = Indices[i];
+
+                Accumulator0 += Value * a[k];
+                Accumulator1 += Value * a[lda + k];
+                Accumulator2 += Value * a[lda * 2 + k];
+                Accumulator3 += Value * a[lda * 3 + k];
+            }
+
+            c[n] = Alpha * Accumulator0;
+            c[ldc + n] = Alpha * Accumulator1;
+            c[ldc * 2 + n] = Alpha * Accumulator2;
+            c[ldc * 3 + n] = Alpha * Accumulator3;
+        }
+
+        a += lda * 4;
+        c += ldc * 4;
+        RangeCountM -= 4;
+    }
+
+    //
+    // Process the remaining rows one at a time, splitting the dot product
+    // over two accumulators to shorten the dependency chain.
+    //
+
+    while (RangeCountM > 0) {
+
+        for (size_t n = ColumnStart; n < ColumnEnd; n++) {
+
+            float Accumulator0 = 0.0f;
+            float Accumulator1 = 0.0f;
+
+            size_t i = Offsets[n];
+            const size_t iEnd = Offsets[n + 1];
+
+            for (; i + 2 <= iEnd; i += 2) {
+                Accumulator0 += Values[i] * a[Indices[i]];
+                Accumulator1 += Values[i + 1] * a[Indices[i + 1]];
+            }
+
+            if (i < iEnd) {
+                Accumulator0 += Values[i] * a[Indices[i]];
+            }
+
+            c[n] = Alpha * (Accumulator0 + Accumulator1);
+        }
+
+        a += lda;
+        c += ldc;
+        RangeCountM -= 1;
+    }
+}
+
+ptrdiff_t
+MlasSparseGemmGetThreadCount(
+    size_t Work,
+    MLAS_THREADPOOL* ThreadPool
+    )
+/*++
+
+Routine Description:
+
+    This routine computes the number of threads to use for a sparse GEMM
+    operation, keeping each thread busy for a minimum amount of work before
+    using another thread.
+
+Arguments:
+
+    Work - Supplies the estimated number of multiply-add operations.
+
+    ThreadPool - Supplies the thread pool object to use, else nullptr if the
+        base library threading support should be used.
+
+Return Value:
+
+    Returns the number of threads to use.
+
+--*/
+{
+    constexpr size_t MinimumWorkPerThread = 32768;
+
+    ptrdiff_t ThreadCount = MlasGetMaximumThreadCount(ThreadPool);
+
+    const size_t BlockCount = (Work / MinimumWorkPerThread) + 1;
+
+    if (size_t(ThreadCount) > BlockCount) {
+        ThreadCount = ptrdiff_t(BlockCount);
+    }
+
+    return ThreadCount;
+}
+
+void
+MLASCALL
+MlasSparseGemmCsrA(
+    size_t M,
+    size_t N,
+    float alpha,
+    const float* AValues,
+    const uint32_t* AColumnIndices,
+    const size_t* ARowOffsets,
+    const float* B,
+    size_t ldb,
+    float* C,
+    size_t ldc,
+    MLAS_THREADPOOL* ThreadPool
+    )
+/*++
+
+Routine Description:
+
+    This routine computes C = alpha * A * B where A is a sparse M by K matrix
+    in compressed sparse row form and B is a dense K by N matrix.
+
+Arguments:
+
+    M - Supplies the number of rows of matrix A and matrix C.
+
+    N - Supplies the number of columns of matrix B and matrix C.
+
+    alpha - Supplies the scalar multiplier (see SGEMM definition).
+
+    AValues - Supplies the nonzero values of matrix A in row order.
+
+    AColumnIndices - Supplies the column index of each nonzero value of
+        matrix A.
+
+    ARowOffsets - Supplies the M + 1 offsets into AValues of the start of each
+        row of matrix A. The last element is the number of nonzero values.
+
+    B - Supplies the address of matrix B.
+
+    ldb - Supplies the first dimension of matrix B.
+
+    C - Supplies the address of matrix C. The existing contents of matrix C
+        are overwritten.
+
+    ldc - Supplies the first dimension of matrix C.
+
+    ThreadPool - Supplies the thread pool object to use, else nullptr if the
+        base library threading support should be used.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    if (M == 0 || N == 0) {
+        return;
+    }
+
+    MLAS_SPARSE_GEMM_WORK_BLOCK WorkBlock;
+
+    WorkBlock.M = M;
+    WorkBlock.N = N;
+    WorkBlock.Alpha = alpha;
+    WorkBlock.Dense = B;
+    WorkBlock.ldd = ldb;
+    WorkBlock.Values = AValues;
+    WorkBlock.Indices = AColumnIndices;
+    WorkBlock.Offsets = ARowOffsets;
+    WorkBlock.C = C;
+    WorkBlock.ldc = ldc;
+
+    //
+    // Limit the number of threads to the number of rows.
+    //
+
+    const size_t NonzeroCount = ARowOffsets[M] - ARowOffsets[0];
+
+    ptrdiff_t ThreadCountM = MlasSparseGemmGetThreadCount((NonzeroCount + M) * N, ThreadPool);
+
+    if (size_t(ThreadCountM) > M) {
+        ThreadCountM = ptrdiff_t(M);
+    }
+
+    WorkBlock.ThreadCountM = ThreadCountM;
+    WorkBlock.ThreadCountN = 1;
+
+    MlasExecuteThreaded(MlasSparseGemmCsrAThreaded, &WorkBlock, ThreadCountM, ThreadPool);
+}
+
+void
+MLASCALL
+MlasSparseGemmCscB(
+    size_t M,
+    size_t N,
+    float alpha,
+    const float* A,
+    size_t lda,
+    const float* BValues,
+    const uint32_t* BRowIndices,
+    const size_t* BColumnOffsets,
+    float* C,
+    size_t ldc,
+    MLAS_THREADPOOL* ThreadPool
+    )
+/*++
+
+Routine Description:
+
+    This routine computes C = alpha * A * B where A is a dense M by K matrix
+    and B is a sparse K by N matrix in compressed sparse column form.
+
+Arguments:
+
+    M - Supplies the number of rows of matrix A and matrix C.
+
+    N - Supplies the number of columns of matrix B and matrix C.
+
+    alpha - Supplies the scalar multiplier (see SGEMM definition).
+
+    A - Supplies the address of matrix A.
+
+    lda - Supplies the first dimension of matrix A.
+
+    BValues - Supplies the nonzero values of matrix B in column order.
+
+    BRowIndices - Supplies the row index of each nonzero value of matrix B.
+
+    BColumnOffsets - Supplies the N + 1 offsets into BValues of the start of
+        each column of matrix B. The last element is the number of nonzero
+        values.
+
+    C - Supplies the address of matrix C. The existing contents of matrix C
+        are overwritten.
+
+    ldc - Supplies the first dimension of matrix C.
+
+    ThreadPool - Supplies the thread pool object to use, else nullptr if the
+        base library threading support should be used.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    if (M == 0 || N == 0) {
+        return;
+    }
+
+    MLAS_SPARSE_GEMM_WORK_BLOCK WorkBlock;
+
+    WorkBlock.M = M;
+    WorkBlock.N = N;
+    WorkBlock.Alpha = alpha;
+    WorkBlock.Dense = A;
+    WorkBlock.ldd = lda;
+    WorkBlock.Values = BValues;
+    WorkBlock.Indices = BRowIndices;
+    WorkBlock.Offsets = BColumnOffsets;
+    WorkBlock.C = C;
+    WorkBlock.ldc = ldc;
+
+    //
+    // Split the threads between the M and N dimensions, preferring the M
+    // dimension in blocks of rows so that each thread reuses the nonzero
+    // values of B across rows.
+    //
+
+    const size_t NonzeroCount = BColumnOffsets[N] - BColumnOffsets[0];
+
+    const ptrdiff_t ThreadCount = MlasSparseGemmGetThreadCount((NonzeroCount + N) * M, ThreadPool);
+
+    ptrdiff_t ThreadCountM = ptrdiff_t((M + MLAS_SPARSE_GEMM_ROWS - 1) / MLAS_SPARSE_GEMM_ROWS);
+
+    if (ThreadCountM > ThreadCount) {
+        ThreadCountM = ThreadCount;
+    }
+
+    ptrdiff_t ThreadCountN = ThreadCount / ThreadCountM;
+
+    if (size_t(ThreadCountN) > N) {
+        ThreadCountN = ptrdiff_t(N);
+    }
+
+    WorkBlock.ThreadCountM = ThreadCountM;
+    WorkBlock.ThreadCountN = ThreadCountN;
+
+    MlasExecuteThreaded(MlasSparseGemmCscBThreaded, &WorkBlock, ThreadCountM * ThreadCountN, ThreadPool);
+}
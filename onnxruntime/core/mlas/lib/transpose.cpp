@@ -95,6 +95,52 @@ MlasTranspose8x8Block(
     _mm_storeh_pi((__m64*)&Output[OutputStride * 7], d3);
 }
 
+MLAS_FORCEINLINE
+void
+MlasTranspose8x8Block(
+    const uint16_t* Input,
+    size_t InputStride,
+    uint16_t* Output,
+    size_t OutputStride
+    )
+{
+    __m128i a0 = _mm_loadu_si128((const __m128i*)&Input[InputStride * 0]);
+    __m128i a1 = _mm_loadu_si128((const __m128i*)&Input[InputStride * 1]);
+    __m128i a2 = _mm_loadu_si128((const __m128i*)&Input[InputStride * 2]);
+    __m128i a3 = _mm_loadu_si128((const __m128i*)&Input[InputStride * 3]);
+    __m128i a4 = _mm_loadu_si128((const __m128i*)&Input[InputStride * 4]);
+    __m128i a5 = _mm_loadu_si128((const __m128i*)&Input[InputStride * 5]);
+    __m128i a6 = _mm_loadu_si128((const __m128i*)&Input[InputStride * 6]);
+    __m128i a7 = _mm_loadu_si128((const __m128i*)&Input[InputStride * 7]);
+
+    __m128i b0 = _mm_unpacklo_epi16(a0, a1);
+    __m128i b1 = _mm_unpackhi_epi16(a0, a1);
+    __m128i b2 = _mm_unpacklo_epi16(a2, a3);
+    __m128i b3 = _mm_unpackhi_epi16(a2, a3);
+    __m128i b4 = _mm_unpacklo_epi16(a4, a5);
+    __m128i b5 = _mm_unpackhi_epi16(a4, a5);
+    __m128i b6 = _mm_unpacklo_epi16(a6, a7);
+    __m128i b7 = _mm_unpackhi_epi16(a6, a7);
+
+    __m128i c0 = _mm_unpacklo_epi32(b0, b2);
+    __m128i c1 = _mm_unpackhi_epi32(b0, b2);
+    __m128i c2 = _mm_unpacklo_epi32(b1, b3);
+    __m128i c3 = _mm_unpackhi_epi32(b1, b3);
+    __m128i c4 = _mm_unpacklo_epi32(b4, b6);
+    __m128i c5 = _mm_unpackhi_epi32(b4, b6);
+    __m128i c6 = _mm_unpacklo_epi32(b5, b7);
+    __m128i c7 = _mm_unpackhi_epi32(b5, b7);
+
+    _mm_storeu_si128((__m128i*)&Output[OutputStride * 0], _mm_unpacklo_epi64(c0, c4));
+    _mm_storeu_si128((__m128i*)&Output[OutputStride * 1], _mm_unpackhi_epi64(c0, c4));
+    _mm_storeu_si128((__m128i*)&Output[OutputStride * 2], _mm_unpacklo_epi64(c1, c5));
+    _mm_storeu_si128((__m128i*)&Output[OutputStride * 3], _mm_unpackhi_epi64(c1, c5));
+    _mm_storeu_si128((__m128i*)&Output[OutputStride * 4], _mm_unpacklo_epi64(c2, c6));
+    _mm_storeu_si128((__m128i*)&Output[OutputStride * 5], _mm_unpackhi_epi64(c2, c6));
+    _mm_storeu_si128((__m128i*)&Output[OutputStride * 6], _mm_unpacklo_epi64(c3, c7));
+    _mm_storeu_si128((__m128i*)&Output[OutputStride * 7], _mm_unpackhi_epi64(c3, c7));
+}
+
 #elif defined(MLAS_NEON_INTRINSICS)
 
 MLAS_FORCEINLINE
@@ -168,48 +214,131 @@ MlasTranspose8x8Block(
     vst1_u8(&Output[OutputStride * 7], vreinterpret_u8_u32(d3.val[1]));
 }
 
-#endif
-
-template<typename ElementType>
 MLAS_FORCEINLINE
 void
-MlasTranspose4xNVector(
-    const ElementType* Input,
+MlasTranspose8x8Block(
+    const uint16_t* Input,
     size_t InputStride,
-    ElementType* Output,
+    uint16_t* Output,
     size_t OutputStride
     )
 {
-    ElementType a0 = Input[InputStride * 0];
-    ElementType a1 = Input[InputStride * 1];
-    ElementType a2 = Input[InputStride * 2];
-    ElementType a3 = Input[InputStride * 3];
-
-    Output[OutputStride * 0] = a0;
-    Output[OutputStride * 1] = a1;
-    Output[OutputStride * 2] = a2;
-    Output[OutputStride * 3] = a3;
+    uint16x8x2_t b0 = vzipq_u16(vld1q_u16(&Input[InputStride * 0]), vld1q_u16(&Input[InputStride * 1]));
+    uint16x8x2_t b1 = vzipq_u16(vld1q_u16(&Input[InputStride * 2]), vld1q_u16(&Input[InputStride * 3]));
+    uint16x8x2_t b2 = vzipq_u16(vld1q_u16(&Input[InputStride * 4]), vld1q_u16(&Input[InputStride * 5]));
+    uint16x8x2_t b3 = vzipq_u16(vld1q_u16(&Input[InputStride * 6]), vld1q_u16(&Input[InputStride * 7]));
+
+    uint32x4x2_t c0 = vzipq_u32(vreinterpretq_u32_u16(b0.val[0]), vreinterpretq_u32_u16(b1.val[0]));
+    uint32x4x2_t c1 = vzipq_u32(vreinterpretq_u32_u16(b0.val[1]), vreinterpretq_u32_u16(b1.val[1]));
+    uint32x4x2_t c2 = vzipq_u32(vreinterpretq_u32_u16(b2.val[0]), vreinterpretq_u32_u16(b3.val[0]));
+    uint32x4x2_t c3 = vzipq_u32(vreinterpretq_u32_u16(b2.val[1]), vreinterpretq_u32_u16(b3.val[1]));
+
+    vst1q_u16(&Output[OutputStride * 0], vreinterpretq_u16_u32(vcombine_u32(vget_low_u32(c0.val[0]), vget_low_u32(c2.val[0]))));
+    vst1q_u16(&Output[OutputStride * 1], vreinterpretq_u16_u32(vcombine_u32(vget_high_u32(c0.val[0]), vget_high_u32(c2.val[0]))));
+    vst1q_u16(&Output[OutputStride * 2], vreinterpretq_u16_u32(vcombine_u32(vget_low_u32(c0.val[1]), vget_low_u32(c2.val[1]))));
+    vst1q_u16(&Output[OutputStride * 3], vreinterpretq_u16_u32(vcombine_u32(vget_high_u32(c0.val[1]), vget_high_u32(c2.val[1]))));
+    vst1q_u16(&Output[OutputStride * 4], vreinterpretq_u16_u32(vcombine_u32(vget_low_u32(c1.val[0]), vget_low_u32(c3.val[0]))));
+    vst1q_u16(&Output[OutputStride * 5], vreinterpretq_u16_u32(vcombine_u32(vget_high_u32(c1.val[0]), vget_high_u32(c3.val[0]))));
+    vst1q_u16(&Output[OutputStride * 6], vreinterpretq_u16_u32(vcombine_u32(vget_low_u32(c1.val[1]), vget_low_u32(c3.val[1]))));
+    vst1q_u16(&Output[OutputStride * 7], vreinterpretq_u16_u32(vcombine_u32(vget_high_u32(c1.val[1]), vget_high_u32(c3.val[1]))));
 }
 
+#endif
+
+//
+// Number of rows of the input matrix transposed at a time. The input cache
+// lines loaded for one strip of columns are then reused by the next strip.
+//
+
+constexpr size_t MlasTransposeRowTile = 64;
+
+template<typename ElementType>
+struct MLAS_TRANSPOSE_BLOCK_KERNEL
+{
+    static constexpr size_t BlockSize = 4;
+
+    static
+    void
+    Transpose(
+        const ElementType* Input,
+        size_t InputStride,
+        ElementType* Output,
+        size_t OutputStride
+        )
+    {
+        for (size_t i = 0; i < BlockSize; i++) {
+            for (size_t j = 0; j < BlockSize; j++) {
+                Output[OutputStride * j + i] = Input[InputStride * i + j];
+            }
+        }
+    }
+};
+
+#if defined(MLAS_SSE2_INTRINSICS) || defined(MLAS_NEON_INTRINSICS)
+
+template<>
+struct MLAS_TRANSPOSE_BLOCK_KERNEL<uint8_t>
+{
+    static constexpr size_t BlockSize = 8;
+
+    static
+    void
+    Transpose(
+        const uint8_t* Input,
+        size_t InputStride,
+        uint8_t* Output,
+        size_t OutputStride
+        )
+    {
+        MlasTranspose8x8Block(Input, InputStride, Output, OutputStride);
+    }
+};
+
+template<>
+struct MLAS_TRANSPOSE_BLOCK_KERNEL<uint16_t>
+{
+    static constexpr size_t BlockSize = 8;
+
+    static
+    void
+    Transpose(
+        const uint16_t* Input,
+        size_t InputStride,
+        uint16_t* Output,
+        size_t OutputStride
+        )
+    {
+        MlasTranspose8x8Block(Input, InputStride, Output, OutputStride);
+    }
+};
+
+template<>
+struct MLAS_TRANSPOSE_BLOCK_KERNEL<uint32_t>
+{
+    static constexpr size_t BlockSize = 4;
+
+    static
+    void
+    Transpose(
+        const uint32_t* Input,
+        size_t InputStride,
+        uint32_t* Output,
+        size_t OutputStride
+        )
+    {
+        MlasTranspose4x4Block(Input, InputStride, Output, OutputStride);
+    }
+};
+
+#endif
+
 template<typename ElementType>
-MLAS_FORCEINLINE
 void
-MlasTranspose8xNVector(
+MlasTransposeStrided(
     const ElementType* Input,
     size_t InputStride,
     ElementType* Output,
-    size_t OutputStride
-    )
-{
-    MlasTranspose4xNVector(&Input[InputStride * 0], InputStride, &Output[OutputStride * 0], OutputStride);
-    MlasTranspose4xNVector(&Input[InputStride * 4], InputStride, &Output[OutputStride * 4], OutputStride);
-}
-
-void
-MLASCALL
-MlasTranspose(
-    const uint32_t* Input,
-    uint32_t* Output,
+    size_t OutputStride,
     size_t M,
     size_t N
     )
@@ -224,8 +353,14 @@ Arguments:
 
     Input - Supplies the input buffer.
 
+    InputStride - Supplies the number of elements between rows of the input
+        matrix.
+
     Output - Supplies the output buffer.
 
+    OutputStride - Supplies the number of elements between rows of the output
+        matrix.
+
     M - Supplies the number of rows for the input matrix and the number of
         columns for the output matrix.
 
@@ -238,102 +373,138 @@ Return Value:
 
 --*/
 {
-    size_t n = N;
+    using BlockKernel = MLAS_TRANSPOSE_BLOCK_KERNEL<ElementType>;
+    constexpr size_t BlockSize = BlockKernel::BlockSize;
 
-    //
-    // Transpose elements from the input matrix to the output matrix 4 columns
-    // at a time.
-    //
+    while (M > 0) {
 
-    while (n >= 4) {
+        const size_t RowCount = std::min(M, MlasTransposeRowTile);
+        const ElementType* input = Input;
+        ElementType* output = Output;
+        size_t n = N;
 
-        const uint32_t* s = Input;
-        uint32_t* d = Output;
-        size_t m = M;
+        //
+        // Transpose elements from the input matrix to the output matrix
+        // BlockSize columns at a time.
+        //
 
-#if defined(MLAS_SSE2_INTRINSICS) || defined(MLAS_NEON_INTRINSICS)
+        while (n >= BlockSize) {
 
-        while (m >= 4) {
+            const ElementType* s = input;
+            ElementType* d = output;
+            size_t m = RowCount;
 
-            MlasTranspose4x4Block(s, N, d, M);
+            while (m >= BlockSize) {
 
-            s += N * 4;
-            d += 4;
-            m -= 4;
-        }
+                BlockKernel::Transpose(s, InputStride, d, OutputStride);
 
-#endif
+                s += InputStride * BlockSize;
+                d += BlockSize;
+                m -= BlockSize;
+            }
 
-        while (m > 0) {
+            while (m > 0) {
 
-            MlasTranspose4xNVector(s, 1, d, M);
-
-            s += N;
-            d += 1;
-            m -= 1;
-        }
+                for (size_t i = 0; i < BlockSize; i++) {
+                    d[OutputStride * i] = s[i];
+                }
 
-        Input += 4;
-        Output += M * 4;
-        n -= 4;
-    }
+                s += InputStride;
+                d += 1;
+                m -= 1;
+            }
 
-    //
-    // Transpose elements from the input matrix to the output matrix for the
-    // remaining columns.
-    //
+            input += BlockSize;
+            output += OutputStride * BlockSize;
+            n -= BlockSize;
+        }
 
-    while (n > 0) {
+        //
+        // Transpose elements from the input matrix to the output matrix for
+        // the remaining columns.
+        //
 
-        const uint32_t* s = Input;
-        uint32_t* d = Output;
-        size_t m = M;
+        while (n > 0) {
 
-        while (m >= 4) {
+            const ElementType* s = input;
 
-            MlasTranspose4xNVector(s, N, d, 1);
+            for (size_t m = 0; m < RowCount; m++) {
+                output[m] = s[0];
+                s += InputStride;
+            }
 
-            s += N * 4;
-            d += 4;
-            m -= 4;
+            input += 1;
+            output += OutputStride;
+            n -= 1;
         }
 
-        while (m > 0) {
+        Input += InputStride * RowCount;
+        Output += RowCount;
+        M -= RowCount;
+    }
+}
 
-            d[0] = s[0];
+void
+MLASCALL
+MlasTranspose(
+    const uint8_t* Input,
+    size_t InputStride,
+    uint8_t* Output,
+    size_t OutputStride,
+    size_t M,
+    size_t N
+    )
+{
+    MlasTransposeStrided(Input, InputStride, Output, OutputStride, M, N);
+}
 
-            s += N;
-            d += 1;
-            m -= 1;
-        }
+void
+MLASCALL
+MlasTranspose(
+    const uint16_t* Input,
+    size_t InputStride,
+    uint16_t* Output,
+    size_t OutputStride,
+    size_t M,
+    size_t N
+    )
+{
+    MlasTransposeStrided(Input, InputStride, Output, OutputStride, M, N);
+}
 
-        Input += 1;
-        Output += M;
-        n -= 1;
-    }
+void
+MLASCALL
+MlasTranspose(
+    const uint32_t* Input,
+    size_t InputStride,
+    uint32_t* Output,
+    size_t OutputStride,
+    size_t M,
+    size_t N
+    )
+{
+    MlasTransposeStrided(Input, InputStride, Output, OutputStride, M, N);
 }
 
 void
 MLASCALL
 MlasTranspose(
-    const float* Input,
-    float* Output,
+    const uint64_t* Input,
+    size_t InputStride,
+    uint64_t* Output,
+    size_t OutputStride,
     size_t M,
     size_t N
     )
 {
-    MlasTranspose(
-        reinterpret_cast<const uint32_t*>(Input),
-        reinterpret_cast<uint32_t*>(Output),
-        M,
-        N);
+    MlasTransposeStrided(Input, InputStride, Output, OutputStride, M, N);
 }
 
 void
 MLASCALL
 MlasTranspose(
-    const uint8_t* Input,
-    uint8_t* Output,
+    const uint32_t* Input,
+    uint32_t* Output,
     size_t M,
     size_t N
     )
@@ -362,77 +533,57 @@ Return Value:
 
 --*/
 {
-    size_t n = N;
-
-    //
-    // Transpose elements from the input matrix to the output matrix 8 columns
-    // at a time.
-    //
-
-    while (n >= 8) {
-
-        const uint8_t* s = Input;
-        uint8_t* d = Output;
-        size_t m = M;
-
-#if defined(MLAS_SSE2_INTRINSICS) || defined(MLAS_NEON_INTRINSICS)
-
-        while (m >= 8) {
-
-            MlasTranspose8x8Block(s, N, d, M);
-
-            s += N * 8;
-            d += 8;
-            m -= 8;
-        }
-
-#endif
-
-        while (m > 0) {
-
-            MlasTranspose8xNVector(s, 1, d, M);
+    MlasTransposeStrided(Input, N, Output, M, M, N);
+}
 
-            s += N;
-            d += 1;
-            m -= 1;
-        }
+void
+MLASCALL
+MlasTranspose(
+    const float* Input,
+    float* Output,
+    size_t M,
+    size_t N
+    )
+{
+    MlasTranspose(
+        reinterpret_cast<const uint32_t*>(Input),
+        reinterpret_cast<uint32_t*>(Output),
+        M,
+        N);
+}
 
-        Input += 8;
-        Output += M * 8;
-        n -= 8;
-    }
+void
+MLASCALL
+MlasTranspose(
+    const uint8_t* Input,
+    uint8_t* Output,
+    size_t M,
+    size_t N
+    )
+/*++
 
-    //
-    // Transpose elements from the input matrix to the output matrix for the
-    // remaining columns.
-    //
+Routine Description:
 
-    while (n > 0) {
+    This routine transposes the input matrix (M rows by N columns) to the
+    output matrix (N rows by M columns).
 
-        const uint8_t* s = Input;
-        uint8_t* d = Output;
-        size_t m = M;
+Arguments:
 
-        while (m >= 8) {
+    Input - Supplies the input buffer.
 
-            MlasTranspose8xNVector(s, N, d, 1);
+    Output - Supplies the output buffer.
 
-            s += N * 8;
-            d += 8;
-            m -= 8;
-        }
+    M - Supplies the number of rows for the input matrix and the number of
+        columns for the output matrix.
 
-        while (m > 0) {
+    N - Supplies the number of columns for the input matrix and the number of
+        rows for the output matrix.
 
-            d[0] = s[0];
+Return Value:
 
-            s += N;
-            d += 1;
-            m -= 1;
-        }
+    None.
 
-        Input += 1;
-        Output += M;
-        n -= 1;
-    }
+--*/
+{
+    MlasTransposeStrided(Input, N, Output, M, M, N);
 }
@@ -0,0 +1,1004 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    winograd.cpp
+
+Abstract:
+
+    This module implements the Winograd minimal filtering algorithms
+    F(2x2,3x3) and F(4x4,3x3) for single precision 3x3 convolutions with
+    unit stride and dilation.
+
+    The input and filter tiles are transformed to Alpha x Alpha tiles (where
+    Alpha is TileSize + 2). The element-wise products of the transformed tiles
+    summed over the input channels are computed as Alpha * Alpha independent
+    GEMMs, which are then transformed back to TileSize x TileSize output
+    tiles.
+
+--*/
+
+#include "mlasi.h"
+
+//
+// Define the target number of elements for the transformed input block of a
+// single thread.
+//
+
+#define MLAS_CONV_WINOGRAD_BLOCK_ELEMENTS           (64 * 1024)
+
+//
+// Define the minimum number of input channels and filters per group to select
+// the Winograd algorithm.
+//
+
+#define MLAS_CONV_WINOGRAD_MINIMUM_CHANNELS         16
+
+//
+// Define the transform matrices for each tile size.
+//
+
+template<size_t TileSize>
+struct MLAS_WINOGRAD_TRANSFORM;
+
+template<>
+struct MLAS_WINOGRAD_TRANSFORM<2>
+{
+    static constexpr size_t Alpha = 4;
+
+    static constexpr float InputTransform[4][4] = {
+        { 1.0f,  0.0f, -1.0f,  0.0f },
+        { 0.0f,  1.0f,  1.0f,  0.0f },
+        { 0.0f, -1.0f,  1.0f,  0.0f },
+        { 0.0f,  1.0f,  0.0f, -1.0f },
+    };
+
+    static constexpr float FilterTransform[4][3] = {
+        { 1.0f,  0.0f,  0.0f },
+        { 0.5f,  0.5f,  0.5f },
+        { 0.5f, -0.5f,  0.5f },
+        { 0.0f,  0.0f,  1.0f },
+    };
+
+    static constexpr float OutputTransform[2][4] = {
+        { 1.0f,  1.0f,  1.0f,  0.0f },
+        { 0.0f,  1.0f, -1.0f, -1.0f },
+    };
+};
+
+template<>
+struct MLAS_WINOGRAD_TRANSFORM<4>
+{
+    static constexpr size_t Alpha = 6;
+
+    static constexpr float InputTransform[6][6] = {
+        { 4.0f,  0.0f, -5.0f,  0.0f,  1.0f,  0.0f },
+        { 0.0f, -4.0f, -4.0f,  1.0f,  1.0f,  0.0f },
+        { 0.0f,  4.0f, -4.0f, -1.0f,  1.0f,  0.0f },
+        { 0.0f, -2.0f, -1.0f,  2.0f,  1.0f,  0.0f },
+        { 0.0f,  2.0f, -1.0f, -2.0f,  1.0f,  0.0f },
+        { 0.0f,  4.0f,  0.0f, -5.0f,  0.0f,  1.0f },
+    };
+
+    static constexpr float FilterTransform[6][3] = {
+        {  1.0f / 4.0f,   0.0f,          0.0f        },
+        { -1.0f / 6.0f,  -1.0f / 6.0f,  -1.0f / 6.0f },
+        { -1.0f / 6.0f,   1.0f / 6.0f,  -1.0f / 6.0f },
+        {  1.0f / 24.0f,  1.0f / 12.0f,  1.0f / 6.0f },
+        {  1.0f / 24.0f, -1.0f / 12.0f,  1.0f / 6.0f },
+        {  0.0f,          0.0f,          1.0f        },
+    };
+
+    static constexpr float OutputTransform[4][6] = {
+        { 1.0f,  1.0f,  1.0f,  1.0f,  1.0f,  0.0f },
+        { 0.0f,  1.0f, -1.0f,  2.0f, -2.0f,  0.0f },
+        { 0.0f,  1.0f,  1.0f,  4.0f,  4.0f,  0.0f },
+        { 0.0f,  1.0f, -1.0f,  8.0f, -8.0f,  1.0f },
+    };
+};
+
+constexpr float MLAS_WINOGRAD_TRANSFORM<2>::InputTransform[4][4];
+constexpr float MLAS_WINOGRAD_TRANSFORM<2>::FilterTransform[4][3];
+constexpr float MLAS_WINOGRAD_TRANSFORM<2>::OutputTransform[2][4];
+constexpr float MLAS_WINOGRAD_TRANSFORM<4>::InputTransform[6][6];
+constexpr float MLAS_WINOGRAD_TRANSFORM<4>::FilterTransform[6][3];
+constexpr float MLAS_WINOGRAD_TRANSFORM<4>::OutputTransform[4][6];
+
+//
+// Define the parameters to execute segments of a Winograd convolution on
+// worker threads.
+//
+
+struct MLAS_CONV_WINOGRAD_WORK_BLOCK {
+    const MLAS_CONV_PARAMETERS* Parameters;
+    const float* Input;
+    const float* TransformedFilter;
+    const float* Bias;
+    float* WorkingBuffer;
+    float* Output;
+    size_t TileBlockCount;
+    size_t FilterBlockCount;
+    ptrdiff_t TargetThreadCount;
+};
+
+template<size_t TileSize>
+void
+MlasConvWinogradTransformFilterTile(
+    const float* Filter,
+    float* TransformedFilter,
+    size_t TransformedFilterStride
+    )
+/*++
+
+Routine Description:
+
+    This routine transforms a single 3x3 filter to an Alpha x Alpha tile
+    computed as G * g * G^T.
+
+Arguments:
+
+    Filter - Supplies the 3x3 filter.
+
+    TransformedFilter - Supplies the location of the first element of the
+        transformed tile.
+
+    TransformedFilterStride - Supplies the number of elements between
+        consecutive elements of the transformed tile.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    using Transform = MLAS_WINOGRAD_TRANSFORM<TileSize>;
+    constexpr size_t Alpha = Transform::Alpha;
+
+    float Temp[Alpha][3];
+
+    for (size_t i = 0; i < Alpha; i++) {
+        for (size_t j = 0; j < 3; j++) {
+            float Sum = 0.0f;
+            for (size_t k = 0; k < 3; k++) {
+                Sum += Transform::FilterTransform[i][k] * Filter[k * 3 + j];
+            }
+            Temp[i][j] = Sum;
+        }
+    }
+
+    for (size_t i = 0; i < Alpha; i++) {
+        for (size_t j = 0; j < Alpha; j++) {
+            float Sum = 0.0f;
+            for (size_t k = 0; k < 3; k++) {
+                Sum += Temp[i][k] * Transform::FilterTransform[j][k];
+            }
+            TransformedFilter[(i * Alpha + j) * TransformedFilterStride] = Sum;
+        }
+    }
+}
+
+template<size_t TileSize>
+void
+MlasConvWinogradTransformFilterGroup(
+    size_t FilterCount,
+    size_t InputChannels,
+    const float* Filter,
+    float* TransformedFilter
+    )
+/*++
+
+Routine Description:
+
+    This routine transforms the filters of a single group to the layout
+    [Alpha * Alpha][FilterCount][InputChannels] used by the tile GEMMs.
+
+Arguments:
+
+    FilterCount - Supplies the number of filters.
+
+    InputChannels - Supplies the number of input channels.
+
+    Filter - Supplies the filters in [FilterCount][InputChannels][3][3]
+        order.
+
+    TransformedFilter - Supplies the buffer to receive the transformed
+        filters.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const size_t Stride = FilterCount * InputChannels;
+
+    for (size_t f = 0; f < FilterCount; f++) {
+        for (size_t c = 0; c < InputChannels; c++) {
+            MlasConvWinogradTransformFilterTile<TileSize>(Filter, TransformedFilter, Stride);
+            Filter += 9;
+            TransformedFilter += 1;
+        }
+    }
+}
+
+bool
+MLASCALL
+MlasConvWinogradIsSupported(
+    size_t Dimensions,
+    const int64_t* KernelShape,
+    const int64_t* DilationShape,
+    const int64_t* StrideShape,
+    size_t InputChannels,
+    size_t FilterCount
+    )
+/*++
+
+Routine Description:
+
+    This routine determines whether MlasConvPrepare selects the Winograd
+    algorithm for a convolution with the supplied parameters.
+
+Arguments:
+
+    Dimensions - Supplies the number of dimensions.
+
+    KernelShape - Supplies the shape of the kernel transform.
+
+    DilationShape - Supplies the shape of the dilation.
+
+    StrideShape - Supplies the shape of the stride.
+
+    InputChannels - Supplies the number of input channels per group.
+
+    FilterCount - Supplies the number of filters per group.
+
+Return Value:
+
+    Returns true if the Winograd algorithm is selected, else false.
+
+--*/
+{
+    if (Dimensions != 2) {
+        return false;
+    }
+
+    for (size_t dim = 0; dim < Dimensions; dim++) {
+        if (KernelShape[dim] != 3 || DilationShape[dim] != 1 || StrideShape[dim] != 1) {
+            return false;
+        }
+    }
+
+    return InputChannels >= MLAS_CONV_WINOGRAD_MINIMUM_CHANNELS &&
+        FilterCount >= MLAS_CONV_WINOGRAD_MINIMUM_CHANNELS;
+}
+
+size_t
+MLASCALL
+MlasConvWinogradTileSize(
+    size_t OutputHeight,
+    size_t OutputWidth
+    )
+/*++
+
+Routine Description:
+
+    This routine computes the output tile size that MlasConvPrepare selects
+    for a Winograd convolution.
+
+Arguments:
+
+    OutputHeight - Supplies the height of the output image.
+
+    OutputWidth - Supplies the width of the output image.
+
+Return Value:
+
+    Returns the output tile size (2 or 4).
+
+--*/
+{
+    //
+    // Use the larger tile size unless most of each tile would be clipped.
+    //
+
+    return (OutputHeight >= 8 && OutputWidth >= 8) ? 4 : 2;
+}
+
+size_t
+MLASCALL
+MlasConvWinogradTransformedFilterSize(
+    size_t TileSize,
+    size_t GroupCount,
+    size_t FilterCount,
+    size_t InputChannels
+    )
+/*++
+
+Routine Description:
+
+    This routine computes the number of elements required to store the
+    transformed filters for a Winograd convolution.
+
+Arguments:
+
+    TileSize - Supplies the output tile size (2 or 4).
+
+    GroupCount - Supplies the number of channel groups.
+
+    FilterCount - Supplies the number of filters per group.
+
+    InputChannels - Supplies the number of input channels per group.
+
+Return Value:
+
+    Returns the number of elements of the transformed filter buffer, or zero
+    if the tile size is not supported.
+
+--*/
+{
+    if (TileSize != 2 && TileSize != 4) {
+        return 0;
+    }
+
+    const size_t Alpha = TileSize + 2;
+
+    return GroupCount * Alpha * Alpha * FilterCount * InputChannels;
+}
+
+void
+MLASCALL
+MlasConvWinogradTransformFilter(
+    size_t TileSize,
+    size_t GroupCount,
+    size_t FilterCount,
+    size_t InputChannels,
+    const float* Filter,
+    float* TransformedFilter
+    )
+/*++
+
+Routine Description:
+
+    This routine transforms the 3x3 filters of a convolution for use by the
+    Winograd algorithm. The result may be supplied to MlasConv through
+    MLAS_CONV_PARAMETERS::u.Winograd.TransformedFilter to avoid transforming
+    the filters on every call.
+
+Arguments:
+
+    TileSize - Supplies the output tile size (2 or 4).
+
+    GroupCount - Supplies the number of channel groups.
+
+    FilterCount - Supplies the number of filters per group.
+
+    InputChannels - Supplies the number of input channels per group.
+
+    Filter - Supplies the filters in [GroupCount * FilterCount][InputChannels]
+        [3][3] order.
+
+    TransformedFilter - Supplies the buffer to receive the transformed
+        filters, sized by MlasConvWinogradTransformedFilterSize.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const size_t Alpha = TileSize + 2;
+    const size_t TransformedGroupSize = Alpha * Alpha * FilterCount * InputChannels;
+
+    for (size_t group = 0; group < GroupCount; group++) {
+
+        if (TileSize == 2) {
+            MlasConvWinogradTransformFilterGroup<2>(FilterCount, InputChannels, Filter, TransformedFilter);
+        } else {
+            MlasConvWinogradTransformFilterGroup<4>(FilterCount, InputChannels, Filter, TransformedFilter);
+        }
+
+        Filter += FilterCount * InputChannels * 9;
+        TransformedFilter += TransformedGroupSize;
+    }
+}
+
+template<size_t TileSize>
+void
+MlasConvWinogradTransformInput(
+    const MLAS_CONV_PARAMETERS* Parameters,
+    const float* Input,
+    float* TransformedInput,
+    size_t TileRowStart,
+    size_t TileRowCount
+    )
+/*++
+
+Routine Description:
+
+    This routine transforms a block of input tiles computed as B^T * d * B to
+    the layout [Alpha * Alpha][InputChannels][TileCount] used by the tile
+    GEMMs.
+
+Arguments:
+
+    Parameters - Supplies the structure that contains the convolution
+        parameters.
+
+    Input - Supplies the input tensor for the group.
+
+    TransformedInput - Supplies the buffer to receive the transformed tiles.
+
+    TileRowStart - Supplies the first row of tiles to transform.
+
+    TileRowCount - Supplies the number of rows of tiles to transform.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    using Transform = MLAS_WINOGRAD_TRANSFORM<TileSize>;
+    constexpr size_t Alpha = Transform::Alpha;
+
+    const size_t InputChannels = Parameters->InputChannels;
+    const size_t InputHeight = Parameters->InputShape[0];
+    const size_t InputWidth = Parameters->InputShape[1];
+    const size_t InputSize = Parameters->InputSize;
+    const size_t PaddingTop = Parameters->Padding[0];
+    const size_t PaddingLeft = Parameters->Padding[1];
+
+    const size_t TileColumns = (Parameters->OutputShape[1] + TileSize - 1) / TileSize;
+    const size_t TileCount = TileRowCount * TileColumns;
+    const size_t Stride = InputChannels * TileCount;
+
+    for (size_t c = 0; c < InputChannels; c++) {
+
+        float* transformed = TransformedInput + c * TileCount;
+
+        for (size_t tr = 0; tr < TileRowCount; tr++) {
+
+            //
+            // Use unsigned wraparound to detect elements in the padding.
+            //
+
+            const size_t ih0 = (TileRowStart + tr) * TileSize - PaddingTop;
+
+            for (size_t tc = 0; tc < TileColumns; tc++) {
+
+                const size_t iw0 = tc * TileSize - PaddingLeft;
+
+                float d[Alpha][Alpha];
+
+                if (ih0 + Alpha <= InputHeight && iw0 + Alpha <= InputWidth &&
+                    ih0 < InputHeight && iw0 < InputWidth) {
+
+                    const float* input = Input + ih0 * InputWidth + iw0;
+
+                    for (size_t i = 0; i < Alpha; i++) {
+                        for (size_t j = 0; j < Alpha; j++) {
+                            d[i][j] = input[i * InputWidth + j];
+                        }
+                    }
+
+                } else {
+
+                    for (size_t i = 0; i < Alpha; i++) {
+                        const size_t ih = ih0 + i;
+                        for (size_t j = 0; j < Alpha; j++) {
+                            const size_t iw = iw0 + j;
+                            d[i][j] = (ih < InputHeight && iw < InputWidth) ?
+                                Input[ih * InputWidth + iw] : 0.0f;
+                        }
+                    }
+                }
+
+                float Temp[Alpha][Alpha];
+
+                for (size_t i = 0; i < Alpha; i++) {
+                    for (size_t j = 0; j < Alpha; j++) {
+                        float Sum = 0.0f;
+                        for (size_t k = 0; k < Alpha; k++) {
+                            Sum += Transform::InputTransform[i][k] * d[k][j];
+                        }
+                        Temp[i][j] = Sum;
+                    }
+                }
+
+                for (size_t i = 0; i < Alpha; i++) {
+                    for (size_t j = 0; j < Alpha; j++) {
+                        float Sum = 0.0f;
+                        for (size_t k = 0; k < Alpha; k++) {
+                            Sum += Temp[i][k] * Transform::InputTransform[j][k];
+                        }
+                        transformed[(i * Alpha + j) * Stride] = Sum;
+                    }
+                }
+
+                transformed++;
+            }
+        }
+
+        Input += InputSize;
+    }
+}
+
+template<size_t TileSize>
+void
+MlasConvWinogradTransformOutput(
+    const MLAS_CONV_PARAMETERS* Parameters,
+    const float* TransformedOutput,
+    float* Output,
+    size_t FilterCount,
+    size_t TileRowStart,
+    size_t TileRowCount
+    )
+/*++
+
+Routine Description:
+
+    This routine transforms a block of output tiles computed as A^T * m * A
+    from the layout [Alpha * Alpha][FilterCount][TileCount] produced by the
+    tile GEMMs.
+
+Arguments:
+
+    Parameters - Supplies the structure that contains the convolution
+        parameters.
+
+    TransformedOutput - Supplies the tile GEMM results.
+
+    Output - Supplies the output tensor for the first filter of the block.
+
+    FilterCount - Supplies the number of filters of the block.
+
+    TileRowStart - Supplies the first row of tiles to transform.
+
+    TileRowCount - Supplies the number of rows of tiles to transform.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    using Transform = MLAS_WINOGRAD_TRANSFORM<TileSize>;
+    constexpr size_t Alpha = Transform::Alpha;
+
+    const size_t OutputHeight = Parameters->OutputShape[0];
+    const size_t OutputWidth = Parameters->OutputShape[1];
+    const size_t OutputSize = Parameters->OutputSize;
+
+    const size_t TileColumns = (OutputWidth + TileSize - 1) / TileSize;
+    const size_t TileCount = TileRowCount * TileColumns;
+    const size_t Stride = FilterCount * TileCount;
+
+    for (size_t f = 0; f < FilterCount; f++) {
+
+        const float* transformed = TransformedOutput + f * TileCount;
+
+        for (size_t tr = 0; tr < TileRowCount; tr++) {
+
+            const size_t oh0 = (TileRowStart + tr) * TileSize;
+
+            for (size_t tc = 0; tc < TileColumns; tc++) {
+
+                const size_t ow0 = tc * TileSize;
+
+                float Temp[TileSize][Alpha];
+
+                for (size_t i = 0; i < TileSize; i++) {
+                    for (size_t j = 0; j < Alpha; j++) {
+                        float Sum = 0.0f;
+                        for (size_t k = 0; k < Alpha; k++) {
+                            Sum += Transform::OutputTransform[i][k] * transformed[(k * Alpha + j) * Stride];
+                        }
+                        Temp[i][j] = Sum;
+                    }
+                }
+
+                const size_t RowCount = std::min(TileSize, OutputHeight - oh0);
+                const size_t ColumnCount = std::min(TileSize, OutputWidth - ow0);
+
+                for (size_t i = 0; i < RowCount; i++) {
+                    float* output = Output + (oh0 + i) * OutputWidth + ow0;
+                    for (size_t j = 0; j < ColumnCount; j++) {
+                        float Sum = 0.0f;
+                        for (size_t k = 0; k < Alpha; k++) {
+                            Sum += Temp[i][k] * Transform::OutputTransform[j][k];
+                        }
+                        output[j] = Sum;
+                    }
+                }
+
+                transformed++;
+            }
+        }
+
+        Output += OutputSize;
+    }
+}
+
+size_t
+MlasConvWinogradWorkingBufferSizePerThread(
+    const MLAS_CONV_PARAMETERS* Parameters
+    )
+/*++
+
+Routine Description:
+
+    This routine returns the number of elements of the working buffer used by
+    each thread of a Winograd convolution to hold the transformed input and
+    output tiles.
+
+Arguments:
+
+    Parameters - Supplies the structure that contains the convolution
+        parameters.
+
+Return Value:
+
+    Returns the number of elements per thread.
+
+--*/
+{
+    const size_t TileSize = Parameters->u.Winograd.TileSize;
+    const size_t Alpha = TileSize + 2;
+    const size_t TileColumns = (Parameters->OutputShape[1] + TileSize - 1) / TileSize;
+    const size_t TileCount = Parameters->u.Winograd.TileRowsPerBlock * TileColumns;
+
+    return Alpha * Alpha * TileCount *
+        (Parameters->InputChannels + Parameters->u.Winograd.FilterBlockSize);
+}
+
+template<size_t TileSize>
+void
+MlasConvWinogradOperation(
+    const MLAS_CONV_WINOGRAD_WORK_BLOCK* WorkBlock,
+    float* WorkingBuffer,
+    size_t TileBlockIndex,
+    size_t FilterBlockIndex
+    )
+/*++
+
+Routine Description:
+
+    This routine computes a block of output tiles for a block of filters.
+
+Arguments:
+
+    WorkBlock - Supplies the structure that contains the Winograd convolution
+        parameters.
+
+    WorkingBuffer - Supplies the working buffer for the thread.
+
+    TileBlockIndex - Supplies the index of the block of tile rows.
+
+    FilterBlockIndex - Supplies the index of the block of filters.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    constexpr size_t Alpha = MLAS_WINOGRAD_TRANSFORM<TileSize>::Alpha;
+
+    const MLAS_CONV_PARAMETERS* Parameters = WorkBlock->Parameters;
+
+    const size_t InputChannels = Parameters->InputChannels;
+    const size_t FilterCount = Parameters->FilterCount;
+    const size_t OutputWidth = Parameters->OutputShape[1];
+    const size_t OutputSize = Parameters->OutputSize;
+
+    const size_t TileRows = (Parameters->OutputShape[0] + TileSize - 1) / TileSize;
+    const size_t TileColumns = (OutputWidth + TileSize - 1) / TileSize;
+    const size_t TileRowsPerBlock = Parameters->u.Winograd.TileRowsPerBlock;
+    const size_t FilterBlockSize = Parameters->u.Winograd.FilterBlockSize;
+
+    const size_t TileRowStart = TileBlockIndex * TileRowsPerBlock;
+    const size_t TileRowCount = std::min(TileRowsPerBlock, TileRows - TileRowStart);
+    const size_t TileCount = TileRowCount * TileColumns;
+
+    const size_t FilterStart = FilterBlockIndex * FilterBlockSize;
+    const size_t FilterBlockCount = std::min(FilterBlockSize, FilterCount - FilterStart);
+
+    //
+    // Transform the input tiles. Blocks of filters that share the same tile
+    // block repeat this step, which is cheap relative to the tile GEMMs.
+    //
+
+    float* TransformedInput = WorkingBuffer;
+    float* TransformedOutput = WorkingBuffer + Alpha * Alpha * InputChannels * TileCount;
+
+    MlasConvWinogradTransformInput<TileSize>(Parameters, WorkBlock->Input, TransformedInput,
+        TileRowStart, TileRowCount);
+
+    //
+    // Multiply the transformed filters by the transformed input for each
+    // element of the transformed tile.
+    //
+
+    const float* TransformedFilter = WorkBlock->TransformedFilter + FilterStart * InputChannels;
+
+    for (size_t e = 0; e < Alpha * Alpha; e++) {
+
+        MlasSgemmOperation(CblasNoTrans, CblasNoTrans, FilterBlockCount, TileCount,
+            InputChannels, 1.0f, TransformedFilter + e * FilterCount * InputChannels,
+            InputChannels, TransformedInput + e * InputChannels * TileCount, TileCount,
+            0.0f, TransformedOutput + e * FilterBlockCount * TileCount, TileCount);
+    }
+
+    //
+    // Transform the output tiles and then apply the activation with optional
+    // bias to the rows of the output produced by this block.
+    //
+
+    float* Output = WorkBlock->Output + FilterStart * OutputSize;
+
+    MlasConvWinogradTransformOutput<TileSize>(Parameters, TransformedOutput, Output,
+        FilterBlockCount, TileRowStart, TileRowCount);
+
+    const size_t OutputRowStart = TileRowStart * TileSize;
+    const size_t OutputRowCount =
+        std::min(TileRowCount * TileSize, Parameters->OutputShape[0] - OutputRowStart);
+
+    const float* Bias = WorkBlock->Bias;
+
+    if (Bias != nullptr) {
+        Bias += FilterStart;
+    }
+
+    MlasActivation(Parameters->Activation, Output + OutputRowStart * OutputWidth, Bias,
+        FilterBlockCount, OutputRowCount * OutputWidth, OutputSize);
+}
+
+void
+MlasConvWinogradThreaded(
+    void* Context,
+    ptrdiff_t Index
+    )
+/*++
+
+Routine Description:
+
+    This routine is invoked from a worker thread to execute a segment of a
+    Winograd convolution operation.
+
+Arguments:
+
+    Context - Supplies the pointer to the context for the threaded operation.
+
+    Index - Supplies the current index of the threaded operation.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const auto* WorkBlock = (MLAS_CONV_WINOGRAD_WORK_BLOCK*)Context;
+
+    const MLAS_CONV_PARAMETERS* Parameters = WorkBlock->Parameters;
+
+    //
+    // Compute the range of work items to use for this thread.
+    //
+
+    const size_t WorkItemCount = WorkBlock->TileBlockCount * WorkBlock->FilterBlockCount;
+
+    size_t WorkIndex;
+    size_t WorkRemaining;
+
+    MlasPartitionWork(Index, WorkBlock->TargetThreadCount, WorkItemCount, &WorkIndex,
+        &WorkRemaining);
+
+    float* WorkingBuffer = WorkBlock->WorkingBuffer +
+        Index * MlasConvWinogradWorkingBufferSizePerThread(Parameters);
+
+    while (WorkRemaining > 0) {
+
+        const size_t TileBlockIndex = WorkIndex / WorkBlock->FilterBlockCount;
+        const size_t FilterBlockIndex = WorkIndex % WorkBlock->FilterBlockCount;
+
+        if (Parameters->u.Winograd.TileSize == 2) {
+            MlasConvWinogradOperation<2>(WorkBlock, WorkingBuffer, TileBlockIndex, FilterBlockIndex);
+        } else {
+            MlasConvWinogradOperation<4>(WorkBlock, WorkingBuffer, TileBlockIndex, FilterBlockIndex);
+        }
+
+        WorkIndex++;
+        WorkRemaining--;
+    }
+}
+
+void
+MlasConvWinogradPrepare(
+    MLAS_CONV_PARAMETERS* Parameters,
+    size_t* WorkingBufferSize,
+    MLAS_THREADPOOL* ThreadPool
+    )
+/*++
+
+Routine Description:
+
+    This routine computes the tile size, the blocking of the tiles and filters
+    and the working buffer size for a Winograd convolution.
+
+Arguments:
+
+    Parameters - Supplies the structure that stores the provided and computed
+        parameters for the convolution operation.
+
+    WorkingBufferSize - Receives the number of elements to allocate for the
+        working buffer for intermediate results.
+
+    ThreadPool - Supplies the thread pool object to use, else nullptr if the
+        base library threading support should be used.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const size_t InputChannels = Parameters->InputChannels;
+    const size_t FilterCount = Parameters->FilterCount;
+    const size_t OutputHeight = Parameters->OutputShape[0];
+    const size_t OutputWidth = Parameters->OutputShape[1];
+
+    const size_t TileSize = MlasConvWinogradTileSize(OutputHeight, OutputWidth);
+    const size_t Alpha = TileSize + 2;
+
+    const size_t TileRows = (OutputHeight + TileSize - 1) / TileSize;
+    const size_t TileColumns = (OutputWidth + TileSize - 1) / TileSize;
+
+    //
+    // Block the rows of tiles so that the transformed input of a block stays
+    // near the target size.
+    //
+
+    size_t TileRowsPerBlock =
+        MLAS_CONV_WINOGRAD_BLOCK_ELEMENTS / (Alpha * Alpha * InputChannels * TileColumns);
+
+    TileRowsPerBlock = std::min(std::max(TileRowsPerBlock, size_t(1)), TileRows);
+
+    const size_t TileBlockCount = (TileRows + TileRowsPerBlock - 1) / TileRowsPerBlock;
+
+    //
+    // Compute the number of target threads given the complexity of the
+    // convolution operation. If there are fewer blocks of tiles than threads,
+    // then also split the filters into blocks.
+    //
+
+    const double Complexity = double(FilterCount) * double(Parameters->OutputSize) *
+        double(Parameters->K);
+
+    ptrdiff_t TargetThreadCount;
+
+    if (Complexity < double(MLAS_SGEMM_THREAD_COMPLEXITY * MLAS_MAXIMUM_THREAD_COUNT)) {
+        TargetThreadCount = ptrdiff_t(Complexity / double(MLAS_SGEMM_THREAD_COMPLEXITY)) + 1;
+    } else {
+        TargetThreadCount = MLAS_MAXIMUM_THREAD_COUNT;
+    }
+
+    ptrdiff_t MaximumThreadCount = MlasGetMaximumThreadCount(ThreadPool);
+
+    if (TargetThreadCount >= MaximumThreadCount) {
+        TargetThreadCount = MaximumThreadCount;
+    }
+
+    size_t FilterBlockCount = 1;
+
+    if (TileBlockCount < size_t(TargetThreadCount)) {
+        FilterBlockCount = (size_t(TargetThreadCount) + TileBlockCount - 1) / TileBlockCount;
+        FilterBlockCount = std::min(FilterBlockCount, (FilterCount + 15) / 16);
+    }
+
+    const size_t FilterBlockSize = (FilterCount + FilterBlockCount - 1) / FilterBlockCount;
+    FilterBlockCount = (FilterCount + FilterBlockSize - 1) / FilterBlockSize;
+
+    const size_t WorkItemCount = TileBlockCount * FilterBlockCount;
+
+    if (size_t(TargetThreadCount) >= WorkItemCount) {
+        TargetThreadCount = ptrdiff_t(WorkItemCount);
+    }
+
+    Parameters->Algorithm = MlasConvAlgorithmWinograd;
+    Parameters->ThreadCount = TargetThreadCount;
+    Parameters->u.Winograd.TileSize = TileSize;
+    Parameters->u.Winograd.TileRowsPerBlock = TileRowsPerBlock;
+    Parameters->u.Winograd.FilterBlockSize = FilterBlockSize;
+    Parameters->u.Winograd.TransformedFilter = nullptr;
+
+    //
+    // The working buffer holds the transformed filters of a group followed by
+    // the per thread buffers.
+    //
+
+    *WorkingBufferSize = MlasConvWinogradTransformedFilterSize(TileSize, 1, FilterCount, InputChannels) +
+        size_t(TargetThreadCount) * MlasConvWinogradWorkingBufferSizePerThread(Parameters);
+}
+
+void
+MlasConvWinograd(
+    const MLAS_CONV_PARAMETERS* Parameters,
+    const float* Input,
+    const float* Filter,
+    const float* TransformedFilter,
+    const float* Bias,
+    float* WorkingBuffer,
+    float* Output,
+    MLAS_THREADPOOL* ThreadPool
+    )
+/*++
+
+Routine Description:
+
+    This routine implements the Winograd convolution for a single batch and
+    group.
+
+Arguments:
+
+    Parameters - Supplies the structure that contains the convolution
+        parameters.
+
+    Input - Supplies the input tensor for the group.
+
+    Filter - Supplies the filter tensor for the group.
+
+    TransformedFilter - Optionally supplies the transformed filters for the
+        group, else nullptr if the filters are transformed to the working
+        buffer.
+
+    Bias - Optionally supplies the bias vector for the group.
+
+    WorkingBuffer - Supplies a working buffer sized to the number of elements
+        returned by MlasConvPrepare.
+
+    Output - Supplies the output tensor for the group.
+
+    ThreadPool - Supplies the thread pool object to use, else nullptr if the
+        base library threading support should be used.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const size_t TileSize = Parameters->u.Winograd.TileSize;
+    const size_t FilterCount = Parameters->FilterCount;
+    const size_t InputChannels = Parameters->InputChannels;
+
+    const size_t TransformedFilterSize =
+        MlasConvWinogradTransformedFilterSize(TileSize, 1, FilterCount, InputChannels);
+
+    if (TransformedFilter == nullptr) {
+        MlasConvWinogradTransformFilter(TileSize, 1, FilterCount, InputChannels, Filter,
+            WorkingBuffer);
+        TransformedFilter = WorkingBuffer;
+    }
+
+    const size_t TileRows = (Parameters->OutputShape[0] + TileSize - 1) / TileSize;
+    const size_t TileRowsPerBlock = Parameters->u.Winograd.TileRowsPerBlock;
+    const size_t FilterBlockSize = Parameters->u.Winograd.FilterBlockSize;
+
+    MLAS_CONV_WINOGRAD_WORK_BLOCK WorkBlock;
+
+    WorkBlock.Parameters = Parameters;
+    WorkBlock.Input = Input;
+    WorkBlock.TransformedFilter = TransformedFilter;
+    WorkBlock.Bias = Bias;
+    WorkBlock.WorkingBuffer = WorkingBuffer + TransformedFilterSize;
+    WorkBlock.Output = Output;
+    WorkBlock.TileBlockCount = (TileRows + TileRowsPerBlock - 1) / TileRowsPerBlock;
+    WorkBlock.FilterBlockCount = (FilterCount + FilterBlockSize - 1) / FilterBlockSize;
+    WorkBlock.TargetThreadCount = Parameters->ThreadCount;
+
+    MlasExecuteThreaded(MlasConvWinogradThreaded, &WorkBlock, Parameters->ThreadCount, ThreadPool);
+}
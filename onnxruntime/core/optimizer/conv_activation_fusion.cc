@@ -171,7 +171,16 @@ Status ConvActivationFusion::ApplyImpl(Graph& graph, bool& modified, int graph_l
           } else {
             continue;
           }
-        } else {
+        } else if (node->GetExecutionProviderType() != onnxruntime::kCpuExecutionProvider) {
+          // The remaining activations are only implemented by the CPU FusedConv kernel.
+          continue;
+        } else if (graph_utils::IsSupportedOptypeVersionAndDomain(next_node, "HardSigmoid", {6})) {
+          const auto* alpha_attr = graph_utils::GetNodeAttribute(next_node, "alpha");
+          const auto* beta_attr = graph_utils::GetNodeAttribute(next_node, "beta");
+          activation_params.push_back(alpha_attr == nullptr ? 0.2f : alpha_attr->f());
+          activation_params.push_back(beta_attr == nullptr ? 0.5f : beta_attr->f());
+        } else if (!graph_utils::IsSupportedOptypeVersionAndDomain(next_node, "Softplus", {1}) &&
+                   !graph_utils::IsSupportedOptypeVersionAndDomain(next_node, "HardSwish", {14})) {
           continue;
         }
       }
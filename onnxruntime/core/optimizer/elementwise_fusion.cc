@@ -0,0 +1,287 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/optimizer/elementwise_fusion.h"
+
+#include "core/framework/tensorprotoutils.h"
+#include "core/graph/graph_utils.h"
+
+using namespace ONNX_NAMESPACE;
+using namespace ::onnxruntime::common;
+namespace onnxruntime {
+
+namespace {
+
+bool IsBinaryOp(const Node& node) {
+  return graph_utils::IsSupportedOptypeVersionAndDomain(node, "Add", {7, 13}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Sub", {7, 13}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Mul", {7, 13}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Div", {7, 13});
+}
+
+bool IsUnaryOp(const Node& node) {
+  return graph_utils::IsSupportedOptypeVersionAndDomain(node, "Abs", {6, 13}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Erf", {9, 13}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Exp", {6, 13}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Neg", {6, 13}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Reciprocal", {6, 13}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Relu", {6, 13}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Sigmoid", {6, 13}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Sqrt", {6, 13}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Tanh", {6, 13});
+}
+
+bool DimsEqual(const TensorShapeProto_Dimension& dim, const TensorShapeProto_Dimension& other) {
+  if (utils::HasDimValue(dim) && utils::HasDimValue(other)) {
+    return dim.dim_value() == other.dim_value();
+  }
+  return utils::HasDimParam(dim) && utils::HasDimParam(other) && dim.dim_param() == other.dim_param();
+}
+
+bool ShapesEqual(const TensorShapeProto& shape, const TensorShapeProto& other) {
+  if (shape.dim_size() != other.dim_size()) {
+    return false;
+  }
+  for (int i = 0; i < shape.dim_size(); ++i) {
+    if (!DimsEqual(shape.dim(i), other.dim(i))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Returns true if a tensor of the input shape is read by FusedElementwise as the full output, as a single element
+// or as a block that repeats along the leading axes of the output.
+bool IsTrailingBroadcast(const TensorShapeProto& input_shape, const TensorShapeProto& output_shape) {
+  int first = 0;
+  while (first < input_shape.dim_size() && utils::HasDimValue(input_shape.dim(first)) &&
+         input_shape.dim(first).dim_value() == 1) {
+    ++first;
+  }
+
+  const int trailing_rank = input_shape.dim_size() - first;
+  if (trailing_rank > output_shape.dim_size()) {
+    return false;
+  }
+  for (int i = 0; i < trailing_rank; ++i) {
+    if (!DimsEqual(input_shape.dim(first + i), output_shape.dim(output_shape.dim_size() - trailing_rank + i))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Operators that the layout transformers convert to the NCHWc or channels last format.
+bool IsLayoutSource(const Node& node) {
+  static const std::unordered_set<std::string> op_types = {"Conv", "FusedConv", "MaxPool", "AveragePool",
+                                                           "GlobalMaxPool", "GlobalAveragePool"};
+  return op_types.count(node.OpType()) != 0;
+}
+
+// Operators that the NCHWc transformer keeps in the format of their inputs, or fuses into a convolution.
+bool IsLayoutPropagating(const Node& node) {
+  static const std::unordered_set<std::string> op_types = {"Add", "Sum", "Mul", "Relu", "Sigmoid", "Tanh",
+                                                           "Concat", "BatchNormalization", "Upsample", "Resize"};
+  return op_types.count(node.OpType()) != 0;
+}
+
+// Returns true if an input of the node is produced by a layout candidate, i.e. a convolution or pooling node or an
+// operator the layout transformers carry that format through. These chains are left to the layout transformers,
+// which would otherwise have to reorder the tensor back to NCHW before the fused node.
+bool HasLayoutCandidateInput(const Node& node, const std::unordered_set<NodeIndex>& layout_candidates) {
+  for (auto it = node.InputNodesBegin(); it != node.InputNodesEnd(); ++it) {
+    if (layout_candidates.count(it->Index()) != 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool IsFusableNode(const Node& node, const std::unordered_set<std::string>& providers,
+                   const std::unordered_set<NodeIndex>& layout_candidates) {
+  if ((!IsBinaryOp(node) && !IsUnaryOp(node)) ||
+      !graph_utils::IsSupportedProvider(node, providers) ||
+      HasLayoutCandidateInput(node, layout_candidates)) {
+    return false;
+  }
+
+  const NodeArg& output = *node.OutputDefs()[0];
+  return output.TypeAsProto() != nullptr &&
+         output.TypeAsProto()->tensor_type().elem_type() == TensorProto_DataType_FLOAT &&
+         output.Shape() != nullptr;
+}
+
+}  // namespace
+
+/**
+ElementwiseFusion walks the graph from its outputs. Each fusable node seeds a group, which then absorbs the
+fusable nodes producing its inputs when all the consumers of their output are already in the group and the output
+has the same shape as the output of the seed. The absorbed nodes can form a DAG, e.g.
+
+      X     bias                                       X   bias
+      |      |                                         |    |
+      v      v                                         v    v
+        Add -----------+                      FusedElementwise(ops=[Add, Sigmoid, Mul])
+         |             |          ---->                  |
+         v             |                                 v
+      Sigmoid          |                               (Y)
+         |             |
+         v             v
+              Mul
+               |
+               v
+              (Y)
+
+The inputs of the group must be broadcastable to the output by prepending dimensions. The intermediate results
+are no longer written to memory, and the kernel reads each input and writes the output once.
+*/
+Status ElementwiseFusion::ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const {
+  GraphViewer graph_viewer(graph);
+  const auto& node_topology_list = graph_viewer.GetNodesInTopologicalOrder();
+
+  std::unordered_map<NodeIndex, size_t> topological_position;
+  std::unordered_set<NodeIndex> layout_candidates;
+  for (size_t i = 0; i < node_topology_list.size(); ++i) {
+    auto* node_ptr = graph.GetNode(node_topology_list[i]);
+    if (nullptr == node_ptr)
+      continue;  // node was removed
+
+    ORT_RETURN_IF_ERROR(Recurse(*node_ptr, modified, graph_level, logger));
+    topological_position[node_topology_list[i]] = i;
+
+    if (IsLayoutSource(*node_ptr) ||
+        (IsLayoutPropagating(*node_ptr) && HasLayoutCandidateInput(*node_ptr, layout_candidates))) {
+      layout_candidates.insert(node_ptr->Index());
+    }
+  }
+
+  const auto& providers = GetCompatibleExecutionProviders();
+
+  for (auto node_it = node_topology_list.rbegin(); node_it != node_topology_list.rend(); ++node_it) {
+    auto* seed_ptr = graph.GetNode(*node_it);
+    if (nullptr == seed_ptr || !IsFusableNode(*seed_ptr, providers, layout_candidates))
+      continue;
+
+    Node& seed = *seed_ptr;
+    const TensorShapeProto& output_shape = *seed.OutputDefs()[0]->Shape();
+
+    std::vector<Node*> group{&seed};
+    std::unordered_set<NodeIndex> group_indices{seed.Index()};
+
+    for (bool grown = true; grown;) {
+      grown = false;
+      for (size_t member = 0; member < group.size(); ++member) {
+        for (auto it = group[member]->InputNodesBegin(); it != group[member]->InputNodesEnd(); ++it) {
+          Node& producer = *graph.GetNode(it->Index());
+          if (group_indices.count(producer.Index()) != 0 ||
+              !IsFusableNode(producer, providers, layout_candidates) ||
+              !graph.GetNodeOutputsInGraphOutputs(producer).empty() ||
+              !ShapesEqual(*producer.OutputDefs()[0]->Shape(), output_shape) ||
+              producer.GetExecutionProviderType() != seed.GetExecutionProviderType()) {
+            continue;
+          }
+
+          bool consumed_by_group = true;
+          for (auto consumer = producer.OutputNodesBegin(); consumer != producer.OutputNodesEnd(); ++consumer) {
+            consumed_by_group = consumed_by_group && group_indices.count(consumer->Index()) != 0;
+          }
+          if (consumed_by_group) {
+            group.push_back(&producer);
+            group_indices.insert(producer.Index());
+            grown = true;
+          }
+        }
+      }
+    }
+
+    if (group.size() < 2) {
+      continue;
+    }
+
+    std::sort(group.begin(), group.end(), [&topological_position](const Node* a, const Node* b) {
+      return topological_position[a->Index()] < topological_position[b->Index()];
+    });
+
+    // Collect the inputs from outside the group, which must be broadcastable to the output by prepending
+    // dimensions.
+    std::vector<NodeArg*> inputs;
+    bool is_fusable = true;
+    for (Node* node : group) {
+      for (NodeArg* input : node->MutableInputDefs()) {
+        const Node* producer = graph.GetProducerNode(input->Name());
+        if ((producer != nullptr && group_indices.count(producer->Index()) != 0) ||
+            std::find(inputs.begin(), inputs.end(), input) != inputs.end()) {
+          continue;
+        }
+        if (input->Shape() == nullptr || !IsTrailingBroadcast(*input->Shape(), output_shape)) {
+          is_fusable = false;
+        }
+        inputs.push_back(input);
+      }
+    }
+
+    if (!is_fusable) {
+      continue;
+    }
+
+    // Operands refer to the inputs, followed by the results of the steps.
+    std::vector<std::string> ops;
+    std::vector<int64_t> operands;
+    for (Node* node : group) {
+      const auto& input_defs = node->InputDefs();
+      for (size_t j = 0; j < 2; ++j) {
+        if (j >= input_defs.size()) {
+          operands.push_back(-1);
+          continue;
+        }
+
+        auto input = std::find(inputs.begin(), inputs.end(), input_defs[j]);
+        if (input != inputs.end()) {
+          operands.push_back(static_cast<int64_t>(input - inputs.begin()));
+          continue;
+        }
+
+        const Node* producer = graph.GetProducerNode(input_defs[j]->Name());
+        auto step = std::find(group.begin(), group.end(), producer);
+        operands.push_back(static_cast<int64_t>(inputs.size()) + static_cast<int64_t>(step - group.begin()));
+      }
+      ops.push_back(node->OpType());
+    }
+
+    Node& fused_node = graph.AddNode(graph.GenerateNodeName("FusedElementwise"),
+                                     "FusedElementwise",
+                                     "fused elementwise chain ending in " + seed.Name(),
+                                     inputs,
+                                     {},
+                                     nullptr,
+                                     kMSDomain);
+    fused_node.AddAttribute("ops", ops);
+    fused_node.AddAttribute("operands", operands);
+
+    // Assign provider to this new node. Provider should be same as the provider for old node.
+    fused_node.SetExecutionProviderType(seed.GetExecutionProviderType());
+
+    for (size_t i = 0; i < inputs.size(); ++i) {
+      const Node* producer = graph.GetProducerNode(inputs[i]->Name());
+      if (producer != nullptr) {
+        graph.AddEdge(producer->Index(), fused_node.Index(),
+                      graph_utils::GetNodeOutputIndexFromOutputName(*producer, inputs[i]->Name()),
+                      static_cast<int>(i));
+      }
+    }
+
+    // Remove the group from its inputs to its seed, then move the output of the seed to the fused node.
+    for (Node* node : group) {
+      if (node != &seed) {
+        graph_utils::RemoveNodeOutputEdges(graph, *node);
+        graph.RemoveNode(node->Index());
+      }
+    }
+    graph_utils::FinalizeNodeFusion(graph, fused_node, seed);
+
+    modified = true;
+  }
+
+  return Status::OK();
+}
+}  // namespace onnxruntime
@@ -0,0 +1,121 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/optimizer/embedding_bag_fusion.h"
+
+#include "core/graph/graph_utils.h"
+#include "core/optimizer/utils.h"
+
+using namespace ONNX_NAMESPACE;
+using namespace ::onnxruntime::common;
+namespace onnxruntime {
+
+/**
+EmbeddingBagFusion will fuse subgraph like below into EmbeddingBag:
+      (data)   (indices)                         (data)   (indices)
+         |         |                                |         |
+         v         v                                v         v
+        Gather(axis=0)                ---->      EmbeddingBag(mode=sum|mean)
+              |                                          |
+              v                                          v
+  ReduceSum|ReduceMean(axes=[rank(indices)-1])        (output)
+              |
+              v
+          (output)
+
+ReduceMean is only fused when the bag dimension is known to be non-empty, as EmbeddingBag reduces an empty bag to
+zeros.
+ */
+Status EmbeddingBagFusion::ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const {
+  GraphViewer graph_viewer(graph);
+  const auto& node_topology_list = graph_viewer.GetNodesInTopologicalOrder();
+
+  for (auto node_index : node_topology_list) {
+    auto* node_ptr = graph.GetNode(node_index);
+    if (nullptr == node_ptr)
+      continue;  // node was removed
+
+    auto& gather_node = *node_ptr;
+
+    ORT_RETURN_IF_ERROR(Recurse(gather_node, modified, graph_level, logger));
+
+    if (!graph_utils::IsSupportedOptypeVersionAndDomain(gather_node, "Gather", {1, 11, 13}) ||
+        !graph_utils::IsSupportedProvider(gather_node, GetCompatibleExecutionProviders()) ||
+        !optimizer_utils::CheckOutputEdges(graph, gather_node, 1)) {
+      continue;
+    }
+
+    // EmbeddingBag is implemented for float data.
+    const NodeArg& data = *gather_node.InputDefs()[0];
+    const NodeArg& indices = *gather_node.InputDefs()[1];
+    if (data.TypeAsProto() == nullptr ||
+        data.TypeAsProto()->tensor_type().elem_type() != TensorProto_DataType_FLOAT ||
+        data.Shape() == nullptr || indices.Shape() == nullptr) {
+      continue;
+    }
+
+    const int64_t data_rank = data.Shape()->dim_size();
+    const int64_t indices_rank = indices.Shape()->dim_size();
+    if (data_rank < 1 || indices_rank < 1) {
+      continue;
+    }
+
+    const auto* axis_attr = graph_utils::GetNodeAttribute(gather_node, "axis");
+    const int64_t axis = axis_attr != nullptr ? axis_attr->i() : 0;
+    if (axis != 0 && axis != -data_rank) {
+      continue;
+    }
+
+    Node& reduce_node = *graph.GetNode(gather_node.OutputNodesBegin()->Index());
+    const bool is_mean = graph_utils::IsSupportedOptypeVersionAndDomain(reduce_node, "ReduceMean", {1, 11, 13});
+    if ((!is_mean && !graph_utils::IsSupportedOptypeVersionAndDomain(reduce_node, "ReduceSum", {1, 11, 13})) ||
+        reduce_node.GetExecutionProviderType() != gather_node.GetExecutionProviderType() ||
+        reduce_node.InputDefs()[0] != gather_node.OutputDefs()[0]) {
+      continue;
+    }
+
+    // The axes are an attribute before ReduceSum-13 and an optional constant input since.
+    std::vector<int64_t> axes;
+    if (!graph_utils::GetRepeatedNodeAttributeValues(reduce_node, "axes", axes) &&
+        reduce_node.InputDefs().size() > 1 && reduce_node.InputDefs()[1]->Exists() &&
+        !optimizer_utils::AppendTensorFromInitializer(graph, *reduce_node.InputDefs()[1], axes)) {
+      continue;
+    }
+
+    const int64_t output_rank = indices_rank + data_rank - 1;
+    if (axes.size() != 1 || (axes[0] < 0 ? axes[0] + output_rank : axes[0]) != indices_rank - 1) {
+      continue;
+    }
+
+    if (is_mean) {
+      const auto& bag_dim = indices.Shape()->dim(static_cast<int>(indices_rank - 1));
+      if (!bag_dim.has_dim_value() || bag_dim.dim_value() <= 0) {
+        continue;
+      }
+    }
+
+    const auto* keepdims_attr = graph_utils::GetNodeAttribute(reduce_node, "keepdims");
+    const int64_t keepdims = keepdims_attr != nullptr ? keepdims_attr->i() : 1;
+
+    Node& embedding_bag_node = graph.AddNode(graph.GenerateNodeName("EmbeddingBag"),
+                                             "EmbeddingBag",
+                                             "fused Gather and " + reduce_node.OpType(),
+                                             gather_node.MutableInputDefs(),
+                                             {},
+                                             nullptr,
+                                             kMSDomain);
+    embedding_bag_node.AddAttribute("mode", is_mean ? "mean" : "sum");
+    embedding_bag_node.AddAttribute("keepdims", keepdims);
+
+    // Assign provider to this new node. Provider should be same as the provider for old node.
+    embedding_bag_node.SetExecutionProviderType(gather_node.GetExecutionProviderType());
+
+    std::vector<std::reference_wrapper<Node>> nodes_to_fuse{gather_node, reduce_node};
+    graph_utils::FinalizeNodeFusion(graph, nodes_to_fuse, embedding_bag_node);
+
+    modified = true;
+  }
+
+  return Status::OK();
+}
+}  // namespace onnxruntime
@@ -1,6 +1,7 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 
+#include <algorithm>
 #include <deque>
 #include "core/graph/graph_utils.h"
 #include "core/optimizer/initializer.h"
@@ -44,14 +45,17 @@ class NhwcTransformerImpl {
   void CreateNhwcArgument(Node& node, Node& nhwc_node, int rank, size_t output_index);
   void CreateNhwcArgument(Node& node, Node& nhwc_node, int rank);
   void InsertReorderInput(Node& node, int rank);
+  NodeArg* LookupTransposedInput(NodeArg* arg, int rank);
 
   void TransformQLinearConv(Node& node);
-  void TransformQLinearBinary(Node& node);
-  void TransformQLinearActivation(Node& node);
+  void TransformConv(Node& node);
+  void TransformBinary(Node& node, int input_index_a, int input_index_b);
+  void TransformActivation(Node& node);
   void TransformQLinearGlobalAveragePool(Node& node);
   void TransformMaxPool(Node& node);
   void TransformSplit(Node& node);
   void TransformPad(Node& node);
+  void TransformTranspose(Node& node);
 
   Graph& graph_;
 
@@ -67,6 +71,42 @@ class NhwcTransformerImpl {
   std::deque<NodeIndex> removed_nodes_;
 };
 
+// Build the permute vector from channels first to channels last, example: {0, 2, 3, 1}
+static std::vector<int64_t> ChannelsLastPerm(int rank) {
+  std::vector<int64_t> perm(static_cast<size_t>(rank));
+  perm[rank - 1] = 1;
+  for (auto r = 2; r < rank; r++) {
+    perm[r - 1] = r;
+  }
+  return perm;
+}
+
+// Build the permute vector from channels last to channels first, example: {0, 3, 1, 2}
+static std::vector<int64_t> ChannelsFirstPerm(int rank) {
+  std::vector<int64_t> perm(static_cast<size_t>(rank));
+  perm[1] = rank - 1;
+  for (auto r = 2; r < rank; r++) {
+    perm[r] = r - 1;
+  }
+  return perm;
+}
+
+static bool IsTransposeWithPerm(const Node& node, const std::vector<int64_t>& perm) {
+  if (!graph_utils::IsSupportedOptypeVersionAndDomain(node, "Transpose", {1, 13})) {
+    return false;
+  }
+  const auto* perm_attr = graph_utils::GetNodeAttribute(node, "perm");
+  if (perm_attr == nullptr) {
+    return false;
+  }
+  return std::vector<int64_t>(perm_attr->ints().begin(), perm_attr->ints().end()) == perm;
+}
+
+static bool IsFloatTensor(const NodeArg* arg) {
+  const auto* type = arg->TypeAsProto();
+  return type != nullptr && type->tensor_type().elem_type() == ONNX_NAMESPACE::TensorProto_DataType_FLOAT;
+}
+
 // Remove node's output edge starting from specified index, return number of edges removed.
 // If output at specified index for the node is graph output, inc the count returned.
 size_t NhwcTransformerImpl::RemoveOutputEdge(Node& node, size_t output_index) {
@@ -120,13 +160,7 @@ void NhwcTransformerImpl::InsertReorderInput(Node& node, int rank) {
                                               nullptr);
     reorder_input_node.SetExecutionProviderType(kCpuExecutionProvider);
 
-    // Build the permute vector, example: {0, 2, 3, 1}
-    std::vector<int64_t> perm(static_cast<size_t>(rank));
-    perm[rank - 1] = 1;
-    for (auto r = 2; r < rank; r++) {
-      perm[r - 1] = r;
-    }
-    reorder_input_node.AddAttribute("perm", perm);
+    reorder_input_node.AddAttribute("perm", ChannelsLastPerm(rank));
 
     input_defs[0] = input_nhwc_arg;
   } else {
@@ -134,6 +168,28 @@ void NhwcTransformerImpl::InsertReorderInput(Node& node, int rank) {
   }
 }
 
+// Returns the channels last source of an input that is produced by a Transpose
+// from channels last to channels first. The Transpose is removed if the input
+// is its only use.
+NodeArg* NhwcTransformerImpl::LookupTransposedInput(NodeArg* arg, int rank) {
+  Node* producer = graph_.GetMutableProducerNode(arg->Name());
+  if (producer == nullptr || !IsTransposeWithPerm(*producer, ChannelsFirstPerm(rank))) {
+    return nullptr;
+  }
+
+  Node& transpose_node = *producer;
+  if (transpose_node.GetExecutionProviderType() != kCpuExecutionProvider) {
+    return nullptr;
+  }
+
+  NodeArg* nhwc_arg = transpose_node.MutableInputDefs()[0];
+  if (optimizer_utils::CheckOutputEdges(graph_, transpose_node, 1)) {
+    graph_utils::RemoveNodeOutputEdges(graph_, transpose_node);
+    removed_nodes_.push_front(transpose_node.Index());
+  }
+  return nhwc_arg;
+}
+
 void NhwcTransformerImpl::TransformQLinearConv(Node& node) {
   auto& input_defs = node.MutableInputDefs();
   auto& output_defs = node.MutableOutputDefs();
@@ -180,11 +236,61 @@ void NhwcTransformerImpl::TransformQLinearConv(Node& node) {
   removed_nodes_.push_front(node.Index());
 }
 
-void NhwcTransformerImpl::TransformQLinearBinary(Node& node) {
+void NhwcTransformerImpl::TransformConv(Node& node) {
+  auto& input_defs = node.MutableInputDefs();
+  auto& output_defs = node.MutableOutputDefs();
+
+  if (!IsFloatTensor(input_defs[0])) {
+    return;
+  }
+
+  // Require that the weights tensor have a shape in order to know the rank of
+  // the convolution.
+  auto* weights_shape = input_defs[1]->Shape();
+  if (weights_shape == nullptr || weights_shape->dim_size() < 3) {
+    return;
+  }
+  const int rank = weights_shape->dim_size();
+
+  // Only convert convolutions whose input is already channels last: either the
+  // output of another NHWC node or a Transpose from a channels last tensor. Models
+  // in channels first format are left to the NCHWc transformer.
+  auto* nhwc_input = LookupNhwcArgument(input_defs[0]);
+  NodeArg* transposed_input = nullptr;
+  if (nhwc_input == nullptr) {
+    transposed_input = LookupTransposedInput(input_defs[0], rank);
+    if (transposed_input == nullptr) {
+      return;
+    }
+  }
+
+  // Create the replacement node.
+  std::string nhwc_node_name = graph_.GenerateNodeName(output_defs[0]->Name() + "_nhwc");
+  Node& nhwc_node = graph_.AddNode(nhwc_node_name,
+                                   "NhwcFusedConv",
+                                   nhwc_node_name,
+                                   input_defs,
+                                   output_defs,
+                                   &node.GetAttributes(),
+                                   kMSDomain);
+  nhwc_node.SetExecutionProviderType(kCpuExecutionProvider);
+
+  if (nhwc_input == nullptr) {
+    nhwc_node.MutableInputDefs()[0] = transposed_input;
+  } else {
+    nhwc_node.MutableInputDefs()[0] = nhwc_input->nhwc_arg_;
+    nhwc_input->remaining_original_uses_--;
+  }
+
+  CreateNhwcArgument(node, nhwc_node, rank);
+  removed_nodes_.push_front(node.Index());
+}
+
+void NhwcTransformerImpl::TransformBinary(Node& node, int input_index_a, int input_index_b) {
   auto& input_defs = node.MutableInputDefs();
 
-  auto* input_def_a = input_defs[0];
-  auto* input_def_b = input_defs[3];
+  auto* input_def_a = input_defs[input_index_a];
+  auto* input_def_b = input_defs[input_index_b];
 
   // For simplicity, require that both inputs have the same tensor rank.
   auto* input_shape_a = input_def_a->Shape();
@@ -204,15 +310,15 @@ void NhwcTransformerImpl::TransformQLinearBinary(Node& node) {
 
   // Update the node to directly use the NHWC inputs and decrement the original
   // use counts of the NHWC inputs.
-  input_defs[0] = nhwc_input_a->nhwc_arg_;
+  input_defs[input_index_a] = nhwc_input_a->nhwc_arg_;
   nhwc_input_a->remaining_original_uses_--;
-  input_defs[3] = nhwc_input_b->nhwc_arg_;
+  input_defs[input_index_b] = nhwc_input_b->nhwc_arg_;
   nhwc_input_b->remaining_original_uses_--;
 
   CreateNhwcArgument(node, node, nhwc_input_a->rank_);
 }
 
-void NhwcTransformerImpl::TransformQLinearActivation(Node& node) {
+void NhwcTransformerImpl::TransformActivation(Node& node) {
   auto& input_defs = node.MutableInputDefs();
 
   auto* nhwc_input = LookupNhwcArgument(input_defs[0]);
@@ -260,6 +366,17 @@ void NhwcTransformerImpl::TransformMaxPool(Node& node) {
     return;
   }
 
+  // Bail out if the element type is not supported by NhwcMaxPool.
+  const auto* input_type = input_defs[0]->TypeAsProto();
+  if (input_type == nullptr) {
+    return;
+  }
+  const auto elem_type = input_type->tensor_type().elem_type();
+  if (elem_type != ONNX_NAMESPACE::TensorProto_DataType_UINT8 &&
+      elem_type != ONNX_NAMESPACE::TensorProto_DataType_FLOAT) {
+    return;
+  }
+
   auto* nhwc_input = LookupNhwcArgument(input_defs[0]);
   if (nhwc_input == nullptr) {
     return;
@@ -366,23 +483,84 @@ void NhwcTransformerImpl::TransformPad(Node& node) {
   CreateNhwcArgument(node, node, nhwc_input->rank_);
 }
 
+void NhwcTransformerImpl::TransformTranspose(Node& node) {
+  auto& input_defs = node.MutableInputDefs();
+
+  auto* nhwc_input = LookupNhwcArgument(input_defs[0]);
+  if (nhwc_input == nullptr) {
+    return;
+  }
+
+  // A Transpose back to channels last produces the NHWC tensor that is
+  // already available, so the Transpose can be removed.
+  if (!IsTransposeWithPerm(node, ChannelsLastPerm(nhwc_input->rank_))) {
+    return;
+  }
+
+  auto* output_arg = node.MutableOutputDefs()[0];
+
+  if (nhwc_input->remaining_original_uses_ == nhwc_input->starting_original_uses_) {
+    // Nothing consumes the NHWC tensor yet, so the NHWC node can directly
+    // produce the output of the Transpose. This also handles the case of the
+    // Transpose producing a graph output.
+    auto& nhwc_output_defs = nhwc_input->output_node_.MutableOutputDefs();
+    std::replace(nhwc_output_defs.begin(), nhwc_output_defs.end(), nhwc_input->nhwc_arg_, output_arg);
+    nhwc_input->nhwc_arg_ = output_arg;
+    graph_utils::RemoveNodeOutputEdges(graph_, node);
+  } else {
+    // Otherwise, forward the NHWC tensor directly to the consumers.
+    if (!graph_.GetNodeOutputsInGraphOutputs(node).empty()) {
+      return;
+    }
+
+    std::vector<std::pair<NodeIndex, int>> consumers;
+    for (auto it = node.OutputEdgesBegin(), end = node.OutputEdgesEnd(); it != end; ++it) {
+      // Bail out if the output is used as an implicit input to a subgraph.
+      if (static_cast<size_t>(it->GetDstArgIndex()) >= it->GetNode().InputDefs().size()) {
+        return;
+      }
+      consumers.emplace_back(it->GetNode().Index(), it->GetDstArgIndex());
+    }
+
+    graph_utils::RemoveNodeOutputEdges(graph_, node);
+    for (const auto& consumer : consumers) {
+      graph_utils::ReplaceNodeInput(*graph_.GetNode(consumer.first), consumer.second, *nhwc_input->nhwc_arg_);
+    }
+  }
+
+  nhwc_input->remaining_original_uses_--;
+  removed_nodes_.push_front(node.Index());
+}
+
 void NhwcTransformerImpl::Transform(Node& node) {
   if (graph_utils::IsSupportedOptypeVersionAndDomain(node, "QLinearConv", {10})) {
     TransformQLinearConv(node);
+  } else if (graph_utils::IsSupportedOptypeVersionAndDomain(node, "Conv", {1, 11}) ||
+             graph_utils::IsSupportedOptypeVersionAndDomain(node, "FusedConv", {1}, kMSDomain)) {
+    TransformConv(node);
   } else if (graph_utils::IsSupportedOptypeVersionAndDomain(node, "QLinearAdd", {1}, kMSDomain) ||
              graph_utils::IsSupportedOptypeVersionAndDomain(node, "QLinearMul", {1}, kMSDomain)) {
-    TransformQLinearBinary(node);
+    TransformBinary(node, 0, 3);
+  } else if (graph_utils::IsSupportedOptypeVersionAndDomain(node, "Add", {7, 13}) ||
+             graph_utils::IsSupportedOptypeVersionAndDomain(node, "Mul", {7, 13})) {
+    TransformBinary(node, 0, 1);
   } else if (graph_utils::IsSupportedOptypeVersionAndDomain(node, "QLinearLeakyRelu", {1}, kMSDomain) ||
-             graph_utils::IsSupportedOptypeVersionAndDomain(node, "QLinearSigmoid", {1}, kMSDomain)) {
-    TransformQLinearActivation(node);
+             graph_utils::IsSupportedOptypeVersionAndDomain(node, "QLinearSigmoid", {1}, kMSDomain) ||
+             graph_utils::IsSupportedOptypeVersionAndDomain(node, "Relu", {6, 13}) ||
+             graph_utils::IsSupportedOptypeVersionAndDomain(node, "LeakyRelu", {6}) ||
+             graph_utils::IsSupportedOptypeVersionAndDomain(node, "Sigmoid", {6, 13}) ||
+             graph_utils::IsSupportedOptypeVersionAndDomain(node, "Tanh", {6, 13})) {
+    TransformActivation(node);
   } else if (graph_utils::IsSupportedOptypeVersionAndDomain(node, "QLinearGlobalAveragePool", {1}, kMSDomain)) {
     TransformQLinearGlobalAveragePool(node);
-  } else if (graph_utils::IsSupportedOptypeVersionAndDomain(node, "MaxPool", {12})) {
+  } else if (graph_utils::IsSupportedOptypeVersionAndDomain(node, "MaxPool", {8, 10, 11, 12})) {
     TransformMaxPool(node);
   } else if (graph_utils::IsSupportedOptypeVersionAndDomain(node, "Split", {2, 11, 13})) {
     TransformSplit(node);
   } else if (graph_utils::IsSupportedOptypeVersionAndDomain(node, "Pad", {11, 13})) {
     TransformPad(node);
+  } else if (graph_utils::IsSupportedOptypeVersionAndDomain(node, "Transpose", {1, 13})) {
+    TransformTranspose(node);
   }
 }
 
@@ -402,13 +580,7 @@ void NhwcTransformerImpl::Finalize(bool& modified) {
                                                  nullptr);
       reorder_output_node.SetExecutionProviderType(kCpuExecutionProvider);
 
-      // Build the permute vector, example: {0, 3, 1, 2}
-      std::vector<int64_t> perm(static_cast<size_t>(rank));
-      perm[1] = rank - 1;
-      for (auto r = 2; r < rank; r++) {
-        perm[r] = r - 1;
-      }
-      reorder_output_node.AddAttribute("perm", perm);
+      reorder_output_node.AddAttribute("perm", ChannelsFirstPerm(rank));
     }
   }
 
@@ -31,6 +31,10 @@ using TIME_SPEC = timespec;
 //If the function succeeds, return true. If the function fails, return false
 bool GetMonotonicTimeCounter(TIME_SPEC* value);
 
+//Get the CPU time consumed by the calling thread, in nanoseconds
+//If the function succeeds, return true. If the function fails, return false
+bool GetThreadCpuTimeNanos(uint64_t* value);
+
 void SetTimeSpecToZero(TIME_SPEC* value);
 void AccumulateTimeSpec(TIME_SPEC* base, const TIME_SPEC* start, const TIME_SPEC* end);
 
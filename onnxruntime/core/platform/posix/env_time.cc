@@ -47,6 +47,20 @@ bool GetMonotonicTimeCounter(TIME_SPEC* value) {
   return clock_gettime(CLOCK_MONOTONIC, value) == 0;
 }
 
+bool GetThreadCpuTimeNanos(uint64_t* value) {
+#ifdef CLOCK_THREAD_CPUTIME_ID
+  timespec ts;
+  if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) != 0) {
+    return false;
+  }
+  *value = static_cast<uint64_t>(ts.tv_sec) * 1000000000 + static_cast<uint64_t>(ts.tv_nsec);
+  return true;
+#else
+  (void)value;
+  return false;
+#endif
+}
+
 void SetTimeSpecToZero(TIME_SPEC* value) {
   memset(value, 0, sizeof(TIME_SPEC));
 }
@@ -93,6 +93,21 @@ bool GetMonotonicTimeCounter(TIME_SPEC* value) {
   return QueryPerformanceCounter((LARGE_INTEGER*)value) != 0;
 }
 
+bool GetThreadCpuTimeNanos(uint64_t* value) {
+  FILETIME creation_time, exit_time, kernel_time, user_time;
+  if (!GetThreadTimes(GetCurrentThread(), &creation_time, &exit_time, &kernel_time, &user_time)) {
+    return false;
+  }
+  // FILETIME counts 100-nanosecond intervals
+  ULARGE_INTEGER kernel, user;
+  kernel.LowPart = kernel_time.dwLowDateTime;
+  kernel.HighPart = kernel_time.dwHighDateTime;
+  user.LowPart = user_time.dwLowDateTime;
+  user.HighPart = user_time.dwHighDateTime;
+  *value = (kernel.QuadPart + user.QuadPart) * 100;
+  return true;
+}
+
 static INIT_ONCE g_InitOnce = INIT_ONCE_STATIC_INIT;
 static LARGE_INTEGER freq;
 
@@ -62,6 +62,7 @@ REGISTER_UNARY_ELEMENTWISE_KERNEL(Celu, 12);
 REGISTER_UNARY_ELEMENTWISE_TYPED_KERNEL(Tanh, 13, float);
 REGISTER_UNARY_ELEMENTWISE_TYPED_KERNEL(Tanh, 13, double);
 REGISTER_UNARY_ELEMENTWISE_KERNEL(ThresholdedRelu, 10);
+REGISTER_UNARY_ELEMENTWISE_KERNEL(HardSwish, 14);
 
 namespace functors {
 template <typename T>
@@ -70,6 +71,7 @@ Status ElementWiseRangedTransform<T>::Create(const std::string& type, const Node
   CREATE_ELE_KERNEL(Celu);
   CREATE_ELE_KERNEL(Elu);
   CREATE_ELE_KERNEL(HardSigmoid);
+  CREATE_ELE_KERNEL(HardSwish);
   CREATE_ELE_KERNEL(LeakyRelu);
   CREATE_ELE_KERNEL(Softplus);
   CREATE_ELE_KERNEL(Relu);
@@ -103,6 +105,40 @@ void Tanh<float>::operator()(std::ptrdiff_t first, std::ptrdiff_t last) const {
   float* output_ptr = output + first;
   MlasComputeTanh(input + first, output_ptr, static_cast<size_t>(len));
 }
+
+template <>
+void HardSigmoid<float>::operator()(std::ptrdiff_t first, std::ptrdiff_t last) const {
+  MLAS_ACTIVATION activation;
+  activation.ActivationKind = MlasHardSigmoidActivation;
+  activation.Parameters.HardSigmoid.alpha = alpha;
+  activation.Parameters.HardSigmoid.beta = beta;
+
+  // MlasActivation works in place, so copy the input in blocks that stay in cache for the activation.
+  constexpr std::ptrdiff_t block_size = 4096;
+  for (std::ptrdiff_t block_first = first; block_first < last; block_first += block_size) {
+    const size_t len = static_cast<size_t>(std::min(block_size, last - block_first));
+    float* output_ptr = output + block_first;
+    const float* input_ptr = input + block_first;
+    if (output_ptr != input_ptr) {
+      memcpy(output_ptr, input_ptr, len * sizeof(float));
+    }
+    MlasActivation(&activation, output_ptr, nullptr, 1, len, len);
+  }
+}
+
+template <>
+void Softplus<float>::operator()(std::ptrdiff_t first, std::ptrdiff_t last) const {
+  ptrdiff_t len = last - first;
+  float* output_ptr = output + first;
+  MlasComputeSoftplus(input + first, output_ptr, static_cast<size_t>(len));
+}
+
+template <>
+void HardSwish<float>::operator()(std::ptrdiff_t first, std::ptrdiff_t last) const {
+  ptrdiff_t len = last - first;
+  float* output_ptr = output + first;
+  MlasComputeHardSwish(input + first, output_ptr, static_cast<size_t>(len));
+}
 }  // namespace functors
 
 }  // namespace onnxruntime
@@ -9,6 +9,8 @@
 
 namespace onnxruntime {
 
+class OpKernelInfo;
+
 // Information needed to construct CPU execution providers.
 struct CPUExecutionProviderInfo {
   bool create_arena{true};
@@ -49,10 +51,26 @@ class CPUExecutionProvider : public IExecutionProvider {
   std::shared_ptr<KernelRegistry> GetKernelRegistry() const override;
   std::unique_ptr<IDataTransfer> GetDataTransfer() const override;
 
+  // Whether kernels should store eligible constant float weights as float16 when prepacking them.
+  // See kOrtSessionOptionsConfigUseFp16Initializers.
+  bool UseFp16Initializers() const { return use_fp16_initializers_; }
+  void SetUseFp16Initializers(bool use_fp16_initializers) { use_fp16_initializers_ = use_fp16_initializers; }
+
+  // Whether Gather style kernels should store constant float tables as int8 rows with a scale per row.
+  // See kOrtSessionOptionsConfigQuantizeGatherTables.
+  bool QuantizeGatherTables() const { return quantize_gather_tables_; }
+  void SetQuantizeGatherTables(bool quantize_gather_tables) { quantize_gather_tables_ = quantize_gather_tables; }
+
  private:
   std::vector<FuseRuleFn> fuse_rules_;
+  bool use_fp16_initializers_{false};
+  bool quantize_gather_tables_{false};
 };
 
+// Returns true if the kernel described by info runs on a CPU execution provider that stores eligible
+// constant float weights as float16.
+bool UseFp16Initializers(const OpKernelInfo& info);
+
 // Registers all available CPU kernels
 Status RegisterCPUKernels(KernelRegistry& kernel_registry);
 
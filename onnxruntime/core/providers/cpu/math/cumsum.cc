@@ -188,7 +188,7 @@ Status CumSum<T>::Compute(OpKernelContext* ctx) const {
   TensorShape slice_shape(input->Shape());  // the shape of one slice of input/output for the given value of the axis
   slice_shape[axis] = 1;
   auto slice_size(slice_shape.Size());     // total number of elements in each slice
-  auto slice_dims(slice_shape.GetDims());  // dim array for the slice
+  auto slice_dims(slice_shape.GetDimsAsVector());  // dim array for the slice
 
   std::vector<int64_t> steps(rank, 1);  // steps for the slice -- always set to 1
 
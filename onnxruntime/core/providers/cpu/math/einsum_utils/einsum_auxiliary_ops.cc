@@ -237,7 +237,7 @@ std::unique_ptr<Tensor> Diagonal(const Tensor& input, int64_t dim_1, int64_t dim
   }
 
   // Make copy of the output dims
-  auto output_dims = output->Shape().GetDims();
+  auto output_dims = output->Shape().GetDimsAsVector();
 
   // Unsqueeze the reduced dim
   auto iter = output_dims.begin() + second_dim;
@@ -273,7 +273,7 @@ bool IsTransposeRequired(size_t input_rank, const std::vector<size_t>& permutati
 }
 
 // The following are thin wrappers over device specific helpers
-std::unique_ptr<Tensor> Transpose(const Tensor& input, const std::vector<int64_t>& input_shape_override,
+std::unique_ptr<Tensor> Transpose(const Tensor& input, gsl::span<const int64_t> input_shape_override,
                                   const std::vector<size_t>& permutation, AllocatorPtr allocator,
                                   void* einsum_cuda_assets, const DeviceHelpers::Transpose& device_transpose_func) {
   auto input_rank = input_shape_override.size();
@@ -346,7 +346,7 @@ std::unique_ptr<Tensor> MatMul(const Tensor& input_1, const std::vector<int64_t>
 }
 
 template <typename T>
-std::unique_ptr<Tensor> ReduceSum(const Tensor& input, const std::vector<int64_t>& input_shape_override,
+std::unique_ptr<Tensor> ReduceSum(const Tensor& input, gsl::span<const int64_t> input_shape_override,
                                   const std::vector<int64_t>& reduce_axes, AllocatorPtr allocator,
                                   concurrency::ThreadPool* tp, void* einsum_cuda_assets,
                                   const DeviceHelpers::ReduceSum<T>& device_reduce_sum_func) {
@@ -377,7 +377,7 @@ template Tensor DeviceHelpers::CpuDeviceHelpers::ReduceSum<float>(
     concurrency::ThreadPool* tp, void* einsum_cuda_assets);
 
 template std::unique_ptr<Tensor> ReduceSum<float>(
-    const Tensor& input, const std::vector<int64_t>& input_shape_override,
+    const Tensor& input, gsl::span<const int64_t> input_shape_override,
     const std::vector<int64_t>& reduce_axes, AllocatorPtr allocator,
     concurrency::ThreadPool* tp, void* einsum_cuda_assets, const DeviceHelpers::ReduceSum<float>& device_reduce_sum_func);
 
@@ -401,7 +401,7 @@ template Tensor DeviceHelpers::CpuDeviceHelpers::ReduceSum<int32_t>(
     concurrency::ThreadPool* tp, void* einsum_cuda_assets);
 
 template std::unique_ptr<Tensor> ReduceSum<int32_t>(
-    const Tensor& input, const std::vector<int64_t>& input_shape_override,
+    const Tensor& input, gsl::span<const int64_t> input_shape_override,
     const std::vector<int64_t>& reduce_axes, AllocatorPtr allocator,
     concurrency::ThreadPool* tp, void* einsum_cuda_assets,
     const DeviceHelpers::ReduceSum<int32_t>& device_reduce_sum_func);
@@ -426,7 +426,7 @@ template Tensor DeviceHelpers::CpuDeviceHelpers::ReduceSum<double>(
     concurrency::ThreadPool* tp, void* einsum_cuda_assets);
 
 template std::unique_ptr<Tensor> ReduceSum<double>(
-    const Tensor& input, const std::vector<int64_t>& input_shape_override,
+    const Tensor& input, gsl::span<const int64_t> input_shape_override,
     const std::vector<int64_t>& reduce_axes, AllocatorPtr allocator,
     concurrency::ThreadPool* tp, void* einsum_cuda_assets,
     const DeviceHelpers::ReduceSum<double>& device_reduce_sum_func);
@@ -451,7 +451,7 @@ template std::unique_ptr<Tensor> MatMul<int64_t>(
     const DeviceHelpers::MatMul<int64_t>& device_matmul_func);
 
 template std::unique_ptr<Tensor> ReduceSum<int64_t>(
-    const Tensor& input, const std::vector<int64_t>& input_shape_override,
+    const Tensor& input, gsl::span<const int64_t> input_shape_override,
     const std::vector<int64_t>& reduce_axes, AllocatorPtr allocator,
     concurrency::ThreadPool* tp, void* einsum_cuda_assets, const DeviceHelpers::ReduceSum<int64_t>& reduce_sum_func);
 
@@ -463,7 +463,7 @@ template std::unique_ptr<Tensor> MatMul<MLFloat16>(
     const DeviceHelpers::MatMul<MLFloat16>& device_matmul_func);
 
 template std::unique_ptr<Tensor> ReduceSum<MLFloat16>(
-    const Tensor& input, const std::vector<int64_t>& input_shape_override,
+    const Tensor& input, gsl::span<const int64_t> input_shape_override,
     const std::vector<int64_t>& reduce_axes, AllocatorPtr allocator,
     concurrency::ThreadPool* tp, void* einsum_cuda_assets,
     const DeviceHelpers::ReduceSum<MLFloat16>& device_reduce_sum_func);
@@ -3,8 +3,304 @@
 
 #include "einsum_typed_compute_processor.h"
 
+#include <algorithm>
+#include <functional>
+#include <limits>
+
 namespace onnxruntime {
 
+namespace EinsumOp {
+
+// All contraction orders are searched for up to this many operands (3^n splits of the operand subsets)
+static constexpr size_t kMaxOperandsForOptimalPath = 8;
+
+// Number of multiply-adds of a pair-wise contraction: the product of the dims of the subscript indices in
+// either operand
+static double ContractionCost(const std::vector<int64_t>& left_dims, const std::vector<int64_t>& right_dims) {
+  double cost = 1.0;
+  for (size_t i = 0; i < left_dims.size(); ++i) {
+    cost *= static_cast<double>(std::max(left_dims[i], right_dims[i]));
+  }
+  return cost;
+}
+
+static double Size(const std::vector<int64_t>& dims) {
+  double size = 1.0;
+  for (auto dim : dims) {
+    size *= static_cast<double>(dim);
+  }
+  return size;
+}
+
+// Returns true if the non-trivial dims of an operand are ordered by their group, i.e. the operand can be read as
+// [group 0, group 1, group 2] without a transpose. `group` holds the group of each subscript index or -1 if the
+// operand doesn't have it.
+static bool IsInGroupOrder(const std::vector<int>& group) {
+  int last_group = 0;
+  for (auto g : group) {
+    if (g < 0)
+      continue;
+    if (g < last_group)
+      return false;
+    last_group = g;
+  }
+  return true;
+}
+
+// Number of elements PairwiseOperandProcess() transposes to lay out the operands as [lro, lo, reduce_dims] and
+// [lro, reduce_dims, ro] for the batched MatMul, and the MatMul result back to the subscript order when it isn't
+// the final result, if `left_dims` is used as the left operand.
+static double TransposeCost(const std::vector<int64_t>& left_dims, const std::vector<int64_t>& right_dims,
+                            const std::vector<int64_t>& reduce_dims, bool is_final_pair) {
+  const size_t rank = left_dims.size();
+  std::vector<int> left_group(rank, -1);
+  std::vector<int> right_group(rank, -1);
+  std::vector<int> output_group(rank, -1);
+  std::vector<int64_t> output_dims(rank, 1);
+
+  for (size_t i = 0; i < rank; ++i) {
+    const bool has_left_dim = left_dims[i] > 1;
+    const bool has_right_dim = right_dims[i] > 1;
+    const bool is_reduced = std::binary_search(reduce_dims.begin(), reduce_dims.end(), static_cast<int64_t>(i));
+    if (is_reduced) {
+      // Dims that only one operand has are summed over before the MatMul
+      if (has_left_dim && has_right_dim) {
+        left_group[i] = 2;
+        right_group[i] = 1;
+      }
+    } else if (has_left_dim && has_right_dim) {
+      left_group[i] = right_group[i] = output_group[i] = 0;
+      output_dims[i] = left_dims[i];
+    } else if (has_left_dim) {
+      left_group[i] = output_group[i] = 1;
+      output_dims[i] = left_dims[i];
+    } else if (has_right_dim) {
+      right_group[i] = output_group[i] = 2;
+      output_dims[i] = right_dims[i];
+    }
+  }
+
+  double cost = 0.0;
+  if (!IsInGroupOrder(left_group))
+    cost += Size(left_dims);
+  if (!IsInGroupOrder(right_group))
+    cost += Size(right_dims);
+  if (!is_final_pair && !IsInGroupOrder(output_group))
+    cost += Size(output_dims);
+  return cost;
+}
+
+namespace {
+
+class ContractionPathBuilder {
+ public:
+  ContractionPathBuilder(const std::vector<std::vector<int64_t>>& operand_dims,
+                         const std::vector<int64_t>& subscript_indices_to_output_indices)
+      : operand_dims_(operand_dims),
+        subscript_indices_to_output_indices_(subscript_indices_to_output_indices) {}
+
+  // Dims of the result of contracting `left` and `right`: a subscript index keeps its dim if it is in the output or
+  // in one of the `others`, and is summed over otherwise. The indices that are summed over are added to
+  // `reduce_dims`.
+  std::vector<int64_t> ResultDims(const std::vector<int64_t>& left, const std::vector<int64_t>& right,
+                                  const std::vector<const std::vector<int64_t>*>& others,
+                                  std::vector<int64_t>* reduce_dims) const {
+    const size_t rank = left.size();
+    std::vector<int64_t> dims(rank, 1);
+    for (size_t i = 0; i < rank; ++i) {
+      bool is_kept = subscript_indices_to_output_indices_[i] != -1;
+      for (auto it = others.begin(); !is_kept && it != others.end(); ++it) {
+        is_kept = (**it)[i] > 1;
+      }
+      if (is_kept) {
+        dims[i] = std::max(left[i], right[i]);
+      } else if (reduce_dims != nullptr) {
+        reduce_dims->push_back(static_cast<int64_t>(i));
+      }
+    }
+    return dims;
+  }
+
+  // Adds the contraction of the operands to the path and returns the number of its result
+  size_t AddContraction(size_t left, const std::vector<int64_t>& left_dims,
+                        size_t right, const std::vector<int64_t>& right_dims,
+                        std::vector<int64_t> reduce_dims, bool is_final_pair) {
+    // Swap the operands if that avoids transposes
+    if (TransposeCost(right_dims, left_dims, reduce_dims, is_final_pair) <
+        TransposeCost(left_dims, right_dims, reduce_dims, is_final_pair)) {
+      std::swap(left, right);
+    }
+    path_.push_back({left, right, std::move(reduce_dims)});
+    return operand_dims_.size() + path_.size() - 1;
+  }
+
+  // Searches all contraction trees by dynamic programming over the subsets of the operands
+  ContractionPath Optimal() {
+    const size_t num_operands = operand_dims_.size();
+    const uint32_t all_operands = (1u << num_operands) - 1;
+
+    std::vector<std::vector<int64_t>> subset_dims(all_operands + 1);
+    std::vector<double> subset_cost(all_operands + 1, std::numeric_limits<double>::infinity());
+    std::vector<uint32_t> subset_split(all_operands + 1, 0);
+
+    for (uint32_t subset = 1; subset <= all_operands; ++subset) {
+      std::vector<const std::vector<int64_t>*> others;
+      std::vector<int64_t> union_dims(operand_dims_[0].size(), 1);
+      for (size_t i = 0; i < num_operands; ++i) {
+        if (subset & (1u << i)) {
+          for (size_t j = 0; j < union_dims.size(); ++j) {
+            union_dims[j] = std::max(union_dims[j], operand_dims_[i][j]);
+          }
+        } else {
+          others.push_back(&operand_dims_[i]);
+        }
+      }
+
+      if ((subset & (subset - 1)) == 0) {
+        // A single operand - it keeps the dims that only it has until its first contraction
+        subset_dims[subset] = union_dims;
+        subset_cost[subset] = 0.0;
+        continue;
+      }
+
+      subset_dims[subset] = ResultDims(union_dims, union_dims, others, nullptr);
+
+      // Visit each split into two non-empty subsets once
+      for (uint32_t left = (subset - 1) & subset; left != 0; left = (left - 1) & subset) {
+        const uint32_t right = subset ^ left;
+        if (left < right)
+          continue;
+        const double cost = subset_cost[left] + subset_cost[right] +
+                            ContractionCost(subset_dims[left], subset_dims[right]);
+        if (cost < subset_cost[subset]) {
+          subset_cost[subset] = cost;
+          subset_split[subset] = left;
+        }
+      }
+    }
+
+    // Emit the contractions of the cheapest tree, children first
+    std::function<size_t(uint32_t)> emit = [&](uint32_t subset) -> size_t {
+      if ((subset & (subset - 1)) == 0) {
+        size_t operand = 0;
+        while (!(subset & (1u << operand)))
+          ++operand;
+        return operand;
+      }
+
+      // The subset with the lowest operand is the left one
+      const uint32_t lowest_operand = subset & (~subset + 1);
+      const uint32_t left = (subset_split[subset] & lowest_operand) ? subset_split[subset]
+                                                                    : subset ^ subset_split[subset];
+      const uint32_t right = subset ^ left;
+      const size_t left_operand = emit(left);
+      const size_t right_operand = emit(right);
+
+      std::vector<const std::vector<int64_t>*> others;
+      for (size_t i = 0; i < num_operands; ++i) {
+        if (!(subset & (1u << i)))
+          others.push_back(&operand_dims_[i]);
+      }
+      std::vector<int64_t> reduce_dims;
+      ResultDims(subset_dims[left], subset_dims[right], others, &reduce_dims);
+      return AddContraction(left_operand, subset_dims[left], right_operand, subset_dims[right],
+                            std::move(reduce_dims), subset == all_operands);
+    };
+    emit(all_operands);
+
+    return std::move(path_);
+  }
+
+  // Repeatedly contracts the pair of operands with the fewest multiply-adds
+  ContractionPath Greedy() {
+    std::vector<size_t> remaining;
+    std::vector<std::vector<int64_t>> dims(operand_dims_);
+    for (size_t i = 0; i < operand_dims_.size(); ++i) {
+      remaining.push_back(i);
+    }
+
+    while (remaining.size() > 1) {
+      size_t best_left = 0;
+      size_t best_right = 1;
+      double best_cost = std::numeric_limits<double>::infinity();
+      double best_size = std::numeric_limits<double>::infinity();
+      for (size_t i = 0; i < remaining.size(); ++i) {
+        for (size_t j = i + 1; j < remaining.size(); ++j) {
+          const double cost = ContractionCost(dims[remaining[i]], dims[remaining[j]]);
+          if (cost > best_cost)
+            continue;
+          const double size = Size(ResultDims(dims[remaining[i]], dims[remaining[j]], Others(remaining, i, j, dims),
+                                              nullptr));
+          if (cost < best_cost || size < best_size) {
+            best_left = i;
+            best_right = j;
+            best_cost = cost;
+            best_size = size;
+          }
+        }
+      }
+
+      const size_t left = remaining[best_left];
+      const size_t right = remaining[best_right];
+      std::vector<int64_t> reduce_dims;
+      auto result_dims = ResultDims(dims[left], dims[right], Others(remaining, best_left, best_right, dims),
+                                    &reduce_dims);
+      const size_t result = AddContraction(left, dims[left], right, dims[right], std::move(reduce_dims),
+                                           remaining.size() == 2);
+      dims.push_back(std::move(result_dims));
+
+      remaining.erase(remaining.begin() + best_right);
+      remaining[best_left] = result;
+    }
+
+    return std::move(path_);
+  }
+
+ private:
+  static std::vector<const std::vector<int64_t>*> Others(const std::vector<size_t>& remaining, size_t left,
+                                                         size_t right,
+                                                         const std::vector<std::vector<int64_t>>& dims) {
+    std::vector<const std::vector<int64_t>*> others;
+    for (size_t i = 0; i < remaining.size(); ++i) {
+      if (i != left && i != right)
+        others.push_back(&dims[remaining[i]]);
+    }
+    return others;
+  }
+
+  const std::vector<std::vector<int64_t>>& operand_dims_;
+  const std::vector<int64_t>& subscript_indices_to_output_indices_;
+  ContractionPath path_;
+};
+
+}  // namespace
+
+ContractionPath FindContractionPath(const std::vector<std::vector<int64_t>>& operand_dims,
+                                    const std::vector<int64_t>& subscript_indices_to_output_indices) {
+  ContractionPathBuilder builder(operand_dims, subscript_indices_to_output_indices);
+  return operand_dims.size() <= kMaxOperandsForOptimalPath ? builder.Optimal() : builder.Greedy();
+}
+
+bool ContractionPathCache::TryGet(const std::vector<int64_t>& operand_dims, ContractionPath& path) const {
+  std::lock_guard<OrtMutex> lock(mutex_);
+  auto it = paths_.find(operand_dims);
+  if (it == paths_.end()) {
+    return false;
+  }
+  path = it->second;
+  return true;
+}
+
+void ContractionPathCache::Add(const std::vector<int64_t>& operand_dims, const ContractionPath& path) {
+  std::lock_guard<OrtMutex> lock(mutex_);
+  if (paths_.size() >= kMaxPaths) {
+    paths_.clear();
+  }
+  paths_.emplace(operand_dims, path);
+}
+
+}  // namespace EinsumOp
+
 template <typename T>
 void EinsumTypedComputeProcessor<T>::FinalizeOutput(const Tensor& candidate_output,
                                                     const std::vector<int64_t>& ordered_subscript_indices_in_candidate) {
@@ -71,7 +367,7 @@ void EinsumTypedComputeProcessor<T>::FinalizeOutput(const Tensor& candidate_outp
 }
 
 static bool IsTransposeReshapeForEinsum(const std::vector<size_t>& perm,
-                                        const std::vector<int64_t>& input_dims,
+                                        gsl::span<const int64_t> input_dims,
                                         std::vector<int64_t>& new_shape) {
   // As long as the dims with values > 1 stay in the same order, it's a reshape.
   // Example: Shape=(1,1,1024,4096) -> perm=(2,0,3,1).
@@ -83,7 +379,7 @@ static bool IsTransposeReshapeForEinsum(const std::vector<size_t>& perm,
       return false;
     last_permuted_axis = perm[i];
   }
-  new_shape = input_dims;
+  new_shape.assign(input_dims.begin(), input_dims.end());
   for (size_t i = 0; i < perm.size(); ++i) {
     new_shape[i] = input_dims[perm[i]];
   }
@@ -158,10 +454,12 @@ std::unique_ptr<Tensor> EinsumTypedComputeProcessor<T>::PairwiseOperandProcess(c
         reduced_size *= left_dim;
       } else if (has_left_dim) {  // if it is only in one of left and right, we can reduce right away
         current_left = EinsumOp::ReduceSum<T>(
-            left, left_dims, {i}, allocator_, tp_, einsum_ep_assets_, device_reduce_sum_func_);
+            current_left ? *current_left : left, current_left ? current_left->Shape().GetDims() : left_dims,
+            {i}, allocator_, tp_, einsum_ep_assets_, device_reduce_sum_func_);
       } else if (has_right_dim) {
         current_right = EinsumOp::ReduceSum<T>(
-            right, right_dims, {i}, allocator_, tp_, einsum_ep_assets_, device_reduce_sum_func_);
+            current_right ? *current_right : right, current_right ? current_right->Shape().GetDims() : right_dims,
+            {i}, allocator_, tp_, einsum_ep_assets_, device_reduce_sum_func_);
       }
     } else {  // This dimension is not reduced (i.e.) it appears in the output after processing these 2 operands
       // Both the left and right operands have non-trivial dimension value along this axis
@@ -194,14 +492,17 @@ std::unique_ptr<Tensor> EinsumTypedComputeProcessor<T>::PairwiseOperandProcess(c
   left_permutation.insert(left_permutation.end(), ro.begin(), ro.end());
   if (EinsumOp::IsTransposeRequired(current_left ? current_left->Shape().GetDims().size() : left_dims.size(),
                                     left_permutation)) {
-    if (current_left && IsTransposeReshapeForEinsum(left_permutation,
-                                                    current_left->Shape().GetDims(),
-                                                    reshaped_dims)) {
-      // This can be done because curent_* tensors (if they exist) and output tensors are
-      // intermediate tensors and cannot be input tensors to the Einsum node itself
-      // (which are immutable).
+    if (IsTransposeReshapeForEinsum(left_permutation,
+                                    current_left ? current_left->Shape().GetDims() : left_dims,
+                                    reshaped_dims)) {
+      // The MatMul reads the operands through the [lro, lo, reduce_dims] and [lro, reduce_dims, ro] views,
+      // so an operand whose non-trivial dims are already in that order is used as is.
+      // curent_* tensors (if they exist) are intermediate tensors and are reshaped to match.
+      // The input tensors of the Einsum node itself are immutable and are only read.
       // Covered by ExplicitEinsumAsTensorContractionReshapeLeft.
-      current_left->Reshape(reshaped_dims);
+      if (current_left) {
+        current_left->Reshape(reshaped_dims);
+      }
     } else {
       // Covered by ExplicitEinsumAsTensorContraction, DiagonalWithMatmul, ...
       current_left = EinsumOp::Transpose(current_left ? *current_left : left,
@@ -220,12 +521,14 @@ std::unique_ptr<Tensor> EinsumTypedComputeProcessor<T>::PairwiseOperandProcess(c
   right_permutation.insert(right_permutation.end(), lo.begin(), lo.end());
   if (EinsumOp::IsTransposeRequired(current_right ? current_right->Shape().GetDims().size() : right_dims.size(),
                                     right_permutation)) {
-    if (current_right && IsTransposeReshapeForEinsum(right_permutation,
-                                                     current_right->Shape().GetDims(),
-                                                     reshaped_dims)) {
+    if (IsTransposeReshapeForEinsum(right_permutation,
+                                    current_right ? current_right->Shape().GetDims() : right_dims,
+                                    reshaped_dims)) {
       // See note following the previous call of function IsTransposeReshapeForEinsum.
       // Covered by ExplicitEinsumAsBatchedMatmulWithBroadcasting_1, ExplicitEinsumAsMatmul_2, ...
-      current_right->Reshape(reshaped_dims);
+      if (current_right) {
+        current_right->Reshape(reshaped_dims);
+      }
     } else {
       // Covered by DiagonalWithMatmul, ExplicitEinsumAsBatchedMatmul, ...
       current_right = EinsumOp::Transpose(current_right ? *current_right : right,
@@ -383,28 +686,82 @@ Status EinsumTypedComputeProcessor<T>::Run() {
     }
   }
 
-  // Process the operands in a pair-wise fashion
+  // Process the operands in a pair-wise fashion, in the order given by the contraction path
   {
-    bool is_final_pair = false;
-    // Keep processing each input pair-wise
+    const auto& subscript_indices_to_output_indices =
+        einsum_compute_preprocessor_.GetMappedSubscriptIndicesToOutputindices();
+
+    // Holds the operands that are not inputs of the node (reduced inputs and the results of contractions)
+    std::vector<std::unique_ptr<const Tensor>> owned_operands;
+    std::vector<const Tensor*> operands;
+    std::vector<TensorShape> operand_shapes;
+    owned_operands.reserve(2 * static_cast<size_t>(num_inputs));
+    operands.reserve(2 * static_cast<size_t>(num_inputs));
+    operand_shapes.reserve(2 * static_cast<size_t>(num_inputs));
+
+    operands.push_back(result ? result.get() : raw_inputs[0]);
+    operand_shapes.push_back(result ? result->Shape() : homogenized_input_dims[0]);
+    owned_operands.push_back(std::move(result));
+
     for (int input = 1; input < num_inputs; ++input) {
+      const Tensor& tensor = preprocessed_inputs[input] ? *preprocessed_inputs[input] : *raw_inputs[input];
+      const auto& input_dims = homogenized_input_dims[input].GetDims();
+
+      // Reduce the dims that no other input has and that don't show up in the output
       std::vector<int64_t> reduced_dims;
-      reduced_dims.reserve(num_subscript_labels);  // num_subscript_labels is the upper bound. No harm in over-reserving by a small margin.
       for (int64_t dim = 0; dim < num_subscript_labels; ++dim) {
-        if (mapped_indices_to_last_input_index[dim] == input) {
-          // This is the last input we are seeing this dimension (and it doesn't occur in the output), so reduce along the dimension
-          reduced_dims.push_back(dim);
+        if (input_dims[dim] == 1 || subscript_indices_to_output_indices[dim] != -1)
+          continue;
+        bool is_only_in_input = true;
+        for (int other = 0; other < num_inputs && is_only_in_input; ++other) {
+          is_only_in_input = other == input || homogenized_input_dims[other][dim] == 1;
         }
+        if (is_only_in_input)
+          reduced_dims.push_back(dim);
       }
-      if (input == num_inputs - 1) {
-        is_final_pair = true;
+
+      if (!reduced_dims.empty()) {
+        owned_operands.push_back(EinsumOp::ReduceSum<T>(tensor, input_dims, reduced_dims, allocator_, tp_,
+                                                        einsum_ep_assets_, device_reduce_sum_func_));
+        operands.push_back(owned_operands.back().get());
+        operand_shapes.push_back(owned_operands.back()->Shape());
+      } else {
+        owned_operands.push_back(std::move(preprocessed_inputs[input]));
+        operands.push_back(&tensor);
+        operand_shapes.push_back(homogenized_input_dims[input]);
+      }
+    }
+
+    std::vector<std::vector<int64_t>> operand_dims;
+    std::vector<int64_t> path_key;
+    operand_dims.reserve(static_cast<size_t>(num_inputs));
+    path_key.reserve(static_cast<size_t>(num_inputs * num_subscript_labels));
+    for (const auto& shape : operand_shapes) {
+      operand_dims.push_back(shape.GetDimsAsVector());
+      path_key.insert(path_key.end(), operand_dims.back().begin(), operand_dims.back().end());
+    }
+
+    EinsumOp::ContractionPath path;
+    if (contraction_path_cache_ == nullptr || !contraction_path_cache_->TryGet(path_key, path)) {
+      path = EinsumOp::FindContractionPath(operand_dims, subscript_indices_to_output_indices);
+      if (contraction_path_cache_ != nullptr) {
+        contraction_path_cache_->Add(path_key, path);
       }
-      // Use either the preprocessed inputs (if it is available) or the corresponding raw inputs
-      result = PairwiseOperandProcess(result ? *result : *raw_inputs[0],
-                                      result ? result->Shape() : homogenized_input_dims[0],
-                                      preprocessed_inputs[input] ? *preprocessed_inputs[input] : *raw_inputs[input],
-                                      homogenized_input_dims[input],
-                                      reduced_dims, is_final_pair);
+    }
+
+    for (size_t i = 0; i < path.size(); ++i) {
+      const auto& contraction = path[i];
+      auto contracted = PairwiseOperandProcess(*operands[contraction.left], operand_shapes[contraction.left],
+                                               *operands[contraction.right], operand_shapes[contraction.right],
+                                               contraction.reduce_dims, i == path.size() - 1);
+
+      // Each operand is contracted once, so intermediate operands can be released right away
+      owned_operands[contraction.left].reset();
+      owned_operands[contraction.right].reset();
+
+      operand_shapes.push_back(contracted->Shape());
+      operands.push_back(contracted.get());
+      owned_operands.push_back(std::move(contracted));
     }
   }
 
@@ -7,11 +7,52 @@
 
 #pragma once
 
+#include <map>
+
+#include "core/platform/ort_mutex.h"
 #include "einsum_auxiliary_ops.h"
 #include "einsum_compute_preprocessor.h"
 
 namespace onnxruntime {
 
+namespace EinsumOp {
+
+// A pair-wise contraction in the contraction path of an Einsum node.
+// Operands are numbered in the order they are created: the inputs come first, followed by the result of each
+// contraction of the path.
+struct Contraction {
+  size_t left;
+  size_t right;
+  // Subscript indices (in ascending order) that are summed over by this contraction
+  std::vector<int64_t> reduce_dims;
+};
+
+using ContractionPath = std::vector<Contraction>;
+
+// Finds the order in which to contract the operands so that the number of multiply-adds is minimal.
+// `operand_dims` holds the homogenized dims of each operand (a dim value of 1 for subscript indices it doesn't have).
+// All orders are searched for a small number of operands, and the cheapest pair is contracted first otherwise.
+ContractionPath FindContractionPath(const std::vector<std::vector<int64_t>>& operand_dims,
+                                    const std::vector<int64_t>& subscript_indices_to_output_indices);
+
+// Caches the contraction paths of an Einsum node by the dims of its operands.
+class ContractionPathCache {
+ public:
+  bool TryGet(const std::vector<int64_t>& operand_dims, ContractionPath& path) const;
+
+  void Add(const std::vector<int64_t>& operand_dims, const ContractionPath& path);
+
+ private:
+  // A node usually sees a handful of input shapes. The cache is cleared when it is full so that nodes with
+  // dynamic shapes don't grow it without bound.
+  static constexpr size_t kMaxPaths = 16;
+
+  mutable OrtMutex mutex_;
+  std::map<std::vector<int64_t>, ContractionPath> paths_;
+};
+
+}  // namespace EinsumOp
+
 // This method does the heavy-lifting compute portion of Einsum Compute()
 template <typename T>
 class EinsumTypedComputeProcessor {
@@ -33,6 +74,11 @@ class EinsumTypedComputeProcessor {
                         const EinsumOp::DeviceHelpers::ReduceSum<T>& device_reduce_sum_func,
                         const EinsumOp::DeviceHelpers::DataCopy& device_data_copy_func);
 
+  // Contraction paths are looked up in and added to the given cache, if any
+  void SetContractionPathCache(EinsumOp::ContractionPathCache* contraction_path_cache) {
+    contraction_path_cache_ = contraction_path_cache;
+  }
+
   Status Run();
 
  private:
@@ -67,6 +113,8 @@ class EinsumTypedComputeProcessor {
 
   // Holds EP-specific assets required for (auxiliary) ops that need to be executed on non-CPU EPs
   void* einsum_ep_assets_;
+
+  EinsumOp::ContractionPathCache* contraction_path_cache_ = nullptr;
 };
 
 }  // namespace onnxruntime
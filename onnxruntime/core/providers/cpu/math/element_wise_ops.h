@@ -527,9 +527,12 @@ struct BroadcastIterator {
     counts_.push_back(1);
   }
 
-  std::vector<ptrdiff_t> counters_;
-  std::vector<ptrdiff_t> deltas_;
-  std::vector<ptrdiff_t> counts_;
+  // Sized for the common ranks so that broadcasting does not allocate.
+  using DimsVector = InlinedVector<ptrdiff_t, kTensorShapeSmallBufferElementsSize>;
+
+  DimsVector counters_;
+  DimsVector deltas_;
+  DimsVector counts_;
   ptrdiff_t count_{1};  // Running total count of entries in tensor, used while building up the entries
 
  private:
@@ -537,7 +540,7 @@ struct BroadcastIterator {
 };
 
 struct Broadcaster {
-  Broadcaster(const std::vector<int64_t>& shape1, const std::vector<int64_t>& shape2) {
+  Broadcaster(gsl::span<const int64_t> shape1, gsl::span<const int64_t> shape2) {
     size_t dimension_count_max = std::max(shape1.size(), shape2.size());
     size_t dimension_count_min = std::min(shape1.size(), shape2.size());
     output_shape_.resize(dimension_count_max);
@@ -642,7 +645,7 @@ struct Broadcaster {
   size_t GetSpanSize() const { return std::min(iterator1_.counts_.front(), iterator2_.counts_.front()); }
 
   BroadcastIterator iterator1_, iterator2_;
-  std::vector<int64_t> output_shape_;
+  TensorShapeVector output_shape_;
 };
 
 struct InputBroadcaster {
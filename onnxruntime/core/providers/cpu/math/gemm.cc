@@ -2,7 +2,9 @@
 // Licensed under the MIT License.
 
 #include "core/providers/cpu/math/gemm.h"
+#include "core/common/safeint.h"
 #include "core/providers/cpu/math/gemm_matmul_common.h"
+#include "core/providers/cpu/cpu_execution_provider.h"
 #include "core/util/math_cpuonly.h"
 #include "gemm_helper.h"
 #include "core/mlas/inc/mlas.h"
@@ -102,6 +104,113 @@ bool GemmPackBFp32(const OpKernelInfo& info,
   return true;
 }
 
+bool GemmPackBFp16(const OpKernelInfo& info,
+                   const Tensor& tensor_b,
+                   BufferUniquePtr& packed_b,
+                   TensorShape& b_shape) {
+  if (tensor_b.Shape().NumDimensions() != 2 || tensor_b.Shape().Size() == 0) {
+    return false;
+  }
+  b_shape = tensor_b.Shape();
+
+  const size_t count = static_cast<size_t>(b_shape.Size());
+
+  auto alloc = info.GetAllocator(0, OrtMemTypeDefault);
+  auto* packed_b_data = alloc->Alloc(SafeInt<size_t>(count) * sizeof(uint16_t));
+  packed_b = BufferUniquePtr(packed_b_data, BufferDeleter(alloc));
+  MlasConvertFloatToHalfBuffer(tensor_b.Data<float>(), static_cast<uint16_t*>(packed_b_data), count);
+  return true;
+}
+
+void GemmWithPackedBFp16(CBLAS_TRANSPOSE trans_a,
+                         bool trans_b,
+                         size_t M,
+                         size_t N,
+                         size_t K,
+                         float alpha,
+                         const float* a_data,
+                         size_t lda,
+                         const uint16_t* packed_b,
+                         float beta,
+                         float* c_data,
+                         size_t ldc,
+                         const AllocatorPtr& alloc,
+                         concurrency::ThreadPool* thread_pool) {
+  if (M == 0 || N == 0) {
+    return;
+  }
+
+  // Columns are split between the tasks in multiples of the panel alignment and
+  // each task widens its columns in panels of at most this many elements.
+  constexpr size_t kPanelAlignment = 16;
+  constexpr size_t kMaxPanelElements = 64 * 1024;
+  // When there are fewer column ranges than threads, the rows are split too.
+  // Each task widens its own panels, so it gets at least this many rows to keep
+  // the widening small next to the product.
+  constexpr size_t kMinRowsPerTask = 16;
+
+  const size_t degree = static_cast<size_t>(concurrency::ThreadPool::DegreeOfParallelism(thread_pool));
+  size_t column_task_count = std::min(degree, (N + kPanelAlignment - 1) / kPanelAlignment);
+  size_t columns_per_task = (N + column_task_count - 1) / column_task_count;
+  columns_per_task = (columns_per_task + kPanelAlignment - 1) / kPanelAlignment * kPanelAlignment;
+  column_task_count = (N + columns_per_task - 1) / columns_per_task;
+
+  size_t row_task_count = std::min((degree + column_task_count - 1) / column_task_count,
+                                   (M + kMinRowsPerTask - 1) / kMinRowsPerTask);
+  row_task_count = std::max(row_task_count, static_cast<size_t>(1));
+  const size_t rows_per_task = (M + row_task_count - 1) / row_task_count;
+  row_task_count = (M + rows_per_task - 1) / rows_per_task;
+
+  const size_t task_count = row_task_count * column_task_count;
+
+  const size_t panel_columns = std::min(
+      columns_per_task, std::max(kPanelAlignment, kMaxPanelElements / K / kPanelAlignment * kPanelAlignment));
+
+  auto panels = IAllocator::MakeUniquePtr<float>(alloc, SafeInt<size_t>(task_count) * panel_columns * K);
+
+  concurrency::ThreadPool::TrySimpleParallelFor(thread_pool, static_cast<std::ptrdiff_t>(task_count),
+                                                [&](std::ptrdiff_t task) {
+    float* panel = panels.get() + static_cast<size_t>(task) * panel_columns * K;
+    const size_t row_task = static_cast<size_t>(task) / column_task_count;
+    const size_t column_task = static_cast<size_t>(task) % column_task_count;
+
+    const size_t m = row_task * rows_per_task;
+    const size_t rows = std::min(rows_per_task, M - m);
+    const float* a = a_data + (trans_a == CblasNoTrans ? m * lda : m);
+    float* c = c_data + m * ldc;
+
+    const size_t n_end = std::min(N, (column_task + 1) * columns_per_task);
+
+    for (size_t n = column_task * columns_per_task; n < n_end; n += panel_columns) {
+      const size_t count = std::min(panel_columns, n_end - n);
+
+      // With B transposed the panel is a contiguous run of its rows.
+      if (trans_b) {
+        MlasConvertHalfToFloatBuffer(packed_b + n * K, panel, count * K);
+      } else {
+        for (size_t k = 0; k < K; k++) {
+          MlasConvertHalfToFloatBuffer(packed_b + k * N + n, panel + k * count, count);
+        }
+      }
+
+      MlasGemm(trans_a,
+               trans_b ? CblasTrans : CblasNoTrans,
+               rows,
+               count,
+               K,
+               alpha,
+               a,
+               lda,
+               panel,
+               trans_b ? K : count,
+               beta,
+               c + n,
+               ldc,
+               nullptr);
+    }
+  });
+}
+
 template <typename T>
 static void GemmBroadcastBias(int64_t M, int64_t N, float beta,
                               const T* c_data, const TensorShape* c_shape,
@@ -175,6 +284,13 @@ Status Gemm<float>::PrePack(const Tensor& tensor, int input_idx, bool& is_packed
 
   // only pack Matrix B
   if (input_idx == 1) {
+    if (UseFp16Initializers(Info())) {
+      packed_b_fp16_ = GemmPackBFp16(Info(), tensor, packed_b_, b_shape_);
+      if (packed_b_fp16_) {
+        is_packed = true;
+        return Status::OK();
+      }
+    }
     is_packed = GemmPackBFp32(Info(), tensor, trans_B_ != CblasNoTrans, packed_b_, b_shape_);
   }
   return Status::OK();
@@ -266,6 +382,25 @@ Status Gemm<float>::Compute(OpKernelContext* context) const {
   if (B) {
     ComputeGemm(trans_A_, trans_B_, M, N, K, alpha_, A->Data<float>(), B->Data<float>(), beta_,
                 c_data, c_shape, y_data, thread_pool);
+  } else if (packed_b_fp16_) {
+    AllocatorPtr alloc;
+    ORT_RETURN_IF_ERROR(context->GetTempSpaceAllocator(&alloc));
+    GemmBroadcastBias(M, N, beta_, c_data, c_shape, y_data);
+    GemmWithPackedBFp16(
+        trans_A_,
+        trans_B_ != CblasNoTrans,
+        static_cast<size_t>(M),
+        static_cast<size_t>(N),
+        static_cast<size_t>(K),
+        alpha_,
+        A->Data<float>(),
+        static_cast<size_t>(trans_A_ != CblasNoTrans ? M : K),
+        static_cast<const uint16_t*>(packed_b_.get()),
+        c_data != nullptr ? beta_ : 0.0f,
+        y_data,
+        static_cast<size_t>(N),
+        alloc,
+        thread_pool);
   } else {
     GemmBroadcastBias(M, N, beta_, c_data, c_shape, y_data);
     MlasGemm(
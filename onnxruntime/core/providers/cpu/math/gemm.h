@@ -47,6 +47,8 @@ class Gemm : public OpKernel {
  protected:
   TensorShape b_shape_;
   BufferUniquePtr packed_b_;
+  // packed_b_ holds B as float16 in its original layout instead of the MLAS packed format
+  bool packed_b_fp16_{false};
 
   // For fused gemm + activation
   std::unique_ptr<functors::ElementWiseRangedTransform<T>> activation_;
@@ -4,6 +4,7 @@
 #pragma once
 
 #include "core/framework/op_kernel.h"
+#include "core/util/math.h"
 
 namespace onnxruntime {
 
@@ -13,4 +14,29 @@ bool GemmPackBFp32(const OpKernelInfo& info,
                    BufferUniquePtr& packed_b,
                    TensorShape& b_shape);
 
+// Stores the 2-D float matrix B as float16 in its original layout, for use with
+// GemmWithPackedBFp16. Returns false if B is not a non-empty 2-D matrix.
+bool GemmPackBFp16(const OpKernelInfo& info,
+                   const Tensor& tensor_b,
+                   BufferUniquePtr& packed_b,
+                   TensorShape& b_shape);
+
+// Computes C = alpha * op(A) * op(B) + beta * C for B stored by GemmPackBFp16.
+// B is widened back to float a panel of columns at a time, so only a bounded
+// float copy of it exists while the product is computed.
+void GemmWithPackedBFp16(CBLAS_TRANSPOSE trans_a,
+                         bool trans_b,
+                         size_t M,
+                         size_t N,
+                         size_t K,
+                         float alpha,
+                         const float* a_data,
+                         size_t lda,
+                         const uint16_t* packed_b,
+                         float beta,
+                         float* c_data,
+                         size_t ldc,
+                         const AllocatorPtr& alloc,
+                         concurrency::ThreadPool* thread_pool);
+
 };  // namespace onnxruntime
@@ -4,17 +4,23 @@
 #include "core/providers/cpu/math/matmul.h"
 #include "core/providers/cpu/math/gemm_matmul_common.h"
 #include "core/providers/cpu/math/matmul_helper.h"
+#include "core/providers/cpu/cpu_execution_provider.h"
 #include "core/util/math.h"
 #include "core/util/math_cpuonly.h"
 #include "core/mlas/inc/mlas.h"
 
+#include <algorithm>
+#include <limits>
+
 namespace onnxruntime {
 
 ONNX_CPU_OPERATOR_VERSIONED_TYPED_KERNEL(
     MatMul,
     1, 8,
     float,
-    KernelDefBuilder().TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
+    KernelDefBuilder()
+        .TypeConstraint("T", DataTypeImpl::GetTensorType<float>())
+        .SparseInitializerInputs({0, 1}),
     MatMul<float>);
 
 ONNX_CPU_OPERATOR_VERSIONED_TYPED_KERNEL(
@@ -30,7 +36,9 @@ ONNX_CPU_OPERATOR_VERSIONED_TYPED_KERNEL(
     9,
     12,
     float,
-    KernelDefBuilder().TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
+    KernelDefBuilder()
+        .TypeConstraint("T", DataTypeImpl::GetTensorType<float>())
+        .SparseInitializerInputs({0, 1}),
     MatMul<float>);
 
 ONNX_CPU_OPERATOR_VERSIONED_TYPED_KERNEL(
@@ -63,7 +71,9 @@ ONNX_CPU_OPERATOR_TYPED_KERNEL(
     MatMul,
     13,
     float,
-    KernelDefBuilder().TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
+    KernelDefBuilder()
+        .TypeConstraint("T", DataTypeImpl::GetTensorType<float>())
+        .SparseInitializerInputs({0, 1}),
     MatMul<float>);
 
 ONNX_CPU_OPERATOR_TYPED_KERNEL(
@@ -126,11 +136,172 @@ Status MatMul<T>::Compute(OpKernelContext* ctx) const {
   return Status::OK();
 }
 
+namespace {
+
+// A constant matrix is multiplied in compressed form when at most this fraction
+// of its elements is nonzero. Above this density the packed dense GEMM is
+// faster for all but single row products.
+constexpr double kMaxSparseMatrixDensity = 0.02;
+
+// Compresses the 2-D matrix held by tensor, transposed first if requested.
+// The result is stored by row when by_row is true and by column otherwise.
+// Returns nullptr if the matrix is too dense to benefit.
+template <typename SparseMatrix>
+std::unique_ptr<SparseMatrix> CompressSparseMatrix(const Tensor& tensor, bool transposed, bool by_row) {
+  const auto& shape = tensor.Shape();
+  const size_t rows = static_cast<size_t>(shape[0]);
+  const size_t cols = static_cast<size_t>(shape[1]);
+  const float* data = tensor.Data<float>();
+
+  const size_t size = rows * cols;
+  const size_t nonzero_count = static_cast<size_t>(size - std::count(data, data + size, 0.0f));
+  if (size == 0 || static_cast<double>(nonzero_count) > kMaxSparseMatrixDensity * static_cast<double>(size) ||
+      std::max(rows, cols) > std::numeric_limits<uint32_t>::max()) {
+    return nullptr;
+  }
+
+  // The compressed outer dimension walks the stored rows of the tensor when
+  // compressing by row without a transpose or by column with one.
+  const bool outer_is_stored_rows = by_row != transposed;
+  const size_t outer_count = outer_is_stored_rows ? rows : cols;
+  const size_t inner_count = outer_is_stored_rows ? cols : rows;
+
+  auto sparse = onnxruntime::make_unique<SparseMatrix>();
+  sparse->values.reserve(nonzero_count);
+  sparse->indices.reserve(nonzero_count);
+  sparse->offsets.reserve(outer_count + 1);
+  sparse->offsets.push_back(0);
+
+  for (size_t outer = 0; outer < outer_count; outer++) {
+    for (size_t inner = 0; inner < inner_count; inner++) {
+      const float value = outer_is_stored_rows ? data[outer * cols + inner] : data[inner * cols + outer];
+      if (value != 0.0f) {
+        sparse->values.push_back(value);
+        sparse->indices.push_back(static_cast<uint32_t>(inner));
+      }
+    }
+    sparse->offsets.push_back(sparse->values.size());
+  }
+
+  return sparse;
+}
+
+// Compresses the 2-D matrix held by a sparse initializer, as above. The
+// coordinates are bucketed by the compressed outer dimension, which keeps
+// their relative order within each row or column.
+template <typename SparseMatrix>
+std::unique_ptr<SparseMatrix> CompressSparseMatrix(const SparseTensor& tensor, bool transposed, bool by_row) {
+  const auto& shape = tensor.Shape();
+  const size_t rows = static_cast<size_t>(shape[0]);
+  const size_t cols = static_cast<size_t>(shape[1]);
+  const size_t value_count = tensor.NumValues();
+  const float* values = tensor.Values().Data<float>();
+  const int64_t* indices = tensor.Indices().Data<int64_t>();
+
+  const size_t size = rows * cols;
+  const size_t nonzero_count = static_cast<size_t>(value_count - std::count(values, values + value_count, 0.0f));
+  if (size == 0 || static_cast<double>(nonzero_count) > kMaxSparseMatrixDensity * static_cast<double>(size) ||
+      std::max(rows, cols) > std::numeric_limits<uint32_t>::max()) {
+    return nullptr;
+  }
+
+  const bool outer_is_stored_rows = by_row != transposed;
+  const size_t outer_count = outer_is_stored_rows ? rows : cols;
+
+  auto sparse = onnxruntime::make_unique<SparseMatrix>();
+  sparse->values.resize(nonzero_count);
+  sparse->indices.resize(nonzero_count);
+  sparse->offsets.assign(outer_count + 1, 0);
+
+  for (size_t i = 0; i < value_count; i++) {
+    if (values[i] != 0.0f) {
+      const size_t outer = static_cast<size_t>(indices[i * 2 + (outer_is_stored_rows ? 0 : 1)]);
+      sparse->offsets[outer + 1]++;
+    }
+  }
+  for (size_t outer = 0; outer < outer_count; outer++) {
+    sparse->offsets[outer + 1] += sparse->offsets[outer];
+  }
+
+  std::vector<size_t> next(sparse->offsets.begin(), sparse->offsets.end() - 1);
+  for (size_t i = 0; i < value_count; i++) {
+    if (values[i] != 0.0f) {
+      const size_t outer = static_cast<size_t>(indices[i * 2 + (outer_is_stored_rows ? 0 : 1)]);
+      const size_t inner = static_cast<size_t>(indices[i * 2 + (outer_is_stored_rows ? 1 : 0)]);
+      const size_t pos = next[outer]++;
+      sparse->values[pos] = values[i];
+      sparse->indices[pos] = static_cast<uint32_t>(inner);
+    }
+  }
+
+  return sparse;
+}
+
+}  // namespace
+
+Status MatMul<float>::PrePackSparse(const SparseTensor& tensor, int input_idx, bool& is_packed) {
+  is_packed = false;
+
+  // The same conditions as PrePack apply. A matrix that is too dense is
+  // densified by the session and passed to PrePack instead.
+  if (tensor.Shape().NumDimensions() != 2 || !tensor.Values().IsDataType<float>()) {
+    return Status::OK();
+  }
+
+  if (input_idx == 0 && !trans_b_attr_) {
+    sparse_a_ = CompressSparseMatrix<SparseMatrix>(tensor, trans_a_attr_ != 0, true);
+    if (sparse_a_) {
+      a_shape_ = tensor.Shape();
+      is_packed = true;
+    }
+  }
+
+  if (input_idx == 1 && !sparse_a_ && !trans_a_attr_) {
+    sparse_b_ = CompressSparseMatrix<SparseMatrix>(tensor, trans_b_attr_ != 0, false);
+    if (sparse_b_) {
+      b_shape_ = tensor.Shape();
+      is_packed = true;
+    }
+  }
+
+  return Status::OK();
+}
+
 Status MatMul<float>::PrePack(const Tensor& tensor, int input_idx, bool& is_packed) {
   is_packed = false;
 
-  // only pack Matrix B
-  if (input_idx == 1) {
+  // A sparse constant A is multiplied as rows of a dense B, which cannot be
+  // transposed or packed.
+  if (input_idx == 0) {
+    if (tensor.Shape().NumDimensions() == 2 && !trans_b_attr_) {
+      sparse_a_ = CompressSparseMatrix<SparseMatrix>(tensor, trans_a_attr_ != 0, true);
+      if (sparse_a_) {
+        a_shape_ = tensor.Shape();
+        is_packed = true;
+      }
+    }
+  }
+
+  if (input_idx == 1 && !sparse_a_) {
+    // A sparse constant B is multiplied with the rows of a dense A, which
+    // cannot be transposed.
+    if (tensor.Shape().NumDimensions() == 2 && !trans_a_attr_) {
+      sparse_b_ = CompressSparseMatrix<SparseMatrix>(tensor, trans_b_attr_ != 0, false);
+      if (sparse_b_) {
+        b_shape_ = tensor.Shape();
+        is_packed = true;
+        return Status::OK();
+      }
+    }
+
+    if (UseFp16Initializers(Info())) {
+      packed_b_fp16_ = GemmPackBFp16(Info(), tensor, packed_b_, b_shape_);
+      if (packed_b_fp16_) {
+        is_packed = true;
+        return Status::OK();
+      }
+    }
+
     is_packed = GemmPackBFp32(Info(), tensor, trans_b_attr_, packed_b_, b_shape_);
   }
   return Status::OK();
@@ -139,29 +310,83 @@ Status MatMul<float>::PrePack(const Tensor& tensor, int input_idx, bool& is_pack
 Status MatMul<float>::Compute(OpKernelContext* ctx) const {
   concurrency::ThreadPool* thread_pool = ctx->GetOperatorThreadPool();
 
-  const Tensor* a = ctx->Input<Tensor>(0);
-  const Tensor* b = packed_b_ ? nullptr : ctx->Input<Tensor>(1);
+  const Tensor* a = sparse_a_ ? nullptr : ctx->Input<Tensor>(0);
+  const Tensor* b = (packed_b_ || sparse_b_) ? nullptr : ctx->Input<Tensor>(1);
+  const auto& a_shape = a ? a->Shape() : a_shape_;
   const auto& b_shape = b ? b->Shape() : b_shape_;
 
   // match CUDA kernel implementation, ignore transpose for vectors
-  const bool trans_a = trans_a_attr_ && a->Shape().NumDimensions() != 1;
+  const bool trans_a = trans_a_attr_ && a_shape.NumDimensions() != 1;
   const bool trans_b = trans_b_attr_ && b_shape.NumDimensions() != 1;
 
   MatMulComputeHelper helper;
-  ORT_RETURN_IF_ERROR(helper.Compute(a->Shape(), b_shape, trans_a, trans_b));
+  ORT_RETURN_IF_ERROR(helper.Compute(a_shape, b_shape, trans_a, trans_b));
   Tensor* y = ctx->Output(0, helper.OutputShape());
 
   // Bail out early if the output is going to be empty
   if (y->Shape().Size() == 0)
     return Status::OK();
 
-  const auto* a_data = a->Data<float>();
+  const auto* a_data = a ? a->Data<float>() : nullptr;
   const auto* b_data = b ? b->Data<float>() : nullptr;
   auto* y_data = y->MutableData<float>();
 
+  AllocatorPtr alloc;
+  if (packed_b_fp16_) {
+    ORT_RETURN_IF_ERROR(ctx->GetTempSpaceAllocator(&alloc));
+  }
+
   // TODO: replace it with GemmBatch for performance, it's OK for now as GemmBatch unrolls as well
   size_t max_len = helper.OutputOffsets().size();
   for (size_t i = 0; i < max_len; i++) {
+    if (sparse_a_) {
+      MlasSparseGemmCsrA(
+          static_cast<size_t>(helper.M()),
+          static_cast<size_t>(helper.N()),
+          alpha_attr_,
+          sparse_a_->values.data(),
+          sparse_a_->indices.data(),
+          sparse_a_->offsets.data(),
+          b_data + helper.RightOffsets()[i],
+          static_cast<size_t>(helper.N()),
+          y_data + helper.OutputOffsets()[i],
+          static_cast<size_t>(helper.N()),
+          thread_pool);
+      continue;
+    }
+    if (sparse_b_) {
+      MlasSparseGemmCscB(
+          static_cast<size_t>(helper.M()),
+          static_cast<size_t>(helper.N()),
+          alpha_attr_,
+          a_data + helper.LeftOffsets()[i],
+          static_cast<size_t>(helper.K()),
+          sparse_b_->values.data(),
+          sparse_b_->indices.data(),
+          sparse_b_->offsets.data(),
+          y_data + helper.OutputOffsets()[i],
+          static_cast<size_t>(helper.N()),
+          thread_pool);
+      continue;
+    }
+    if (packed_b_fp16_) {
+      GemmWithPackedBFp16(
+          trans_a ? CblasTrans : CblasNoTrans,
+          trans_b,
+          static_cast<size_t>(helper.M()),
+          static_cast<size_t>(helper.N()),
+          static_cast<size_t>(helper.K()),
+          alpha_attr_,
+          a_data + helper.LeftOffsets()[i],
+          static_cast<size_t>(trans_a ? helper.M() : helper.K()),
+          static_cast<const uint16_t*>(packed_b_.get()),
+          0.0f,
+          y_data + helper.OutputOffsets()[i],
+          static_cast<size_t>(helper.N()),
+          alloc,
+          thread_pool);
+      continue;
+    }
     if (packed_b_) {
       MlasGemm(
           trans_a ? CblasTrans : CblasNoTrans,
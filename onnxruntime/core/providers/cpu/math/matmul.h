@@ -5,6 +5,8 @@
 
 #include "core/framework/op_kernel.h"
 
+#include <vector>
+
 namespace onnxruntime {
 
 template <typename T>
@@ -26,11 +28,28 @@ class MatMul<float> final : public OpKernel {
 
   Status PrePack(const Tensor& tensor, int input_idx, bool& is_packed) override;
 
+  Status PrePackSparse(const SparseTensor& tensor, int input_idx, bool& is_packed) override;
+
   Status Compute(OpKernelContext* context) const override;
 
  private:
+  // Constant matrix with few enough nonzero elements to be multiplied in
+  // compressed form: compressed sparse row for A, compressed sparse column
+  // for B.
+  struct SparseMatrix {
+    std::vector<float> values;
+    std::vector<uint32_t> indices;
+    std::vector<size_t> offsets;
+  };
+
+  TensorShape a_shape_;
+  std::unique_ptr<SparseMatrix> sparse_a_;
+
   TensorShape b_shape_;
   BufferUniquePtr packed_b_;
+  // packed_b_ holds B as float16 in its original layout instead of the MLAS packed format
+  bool packed_b_fp16_{false};
+  std::unique_ptr<SparseMatrix> sparse_b_;
 
   // For FusedMatMul contrib ops
   float alpha_attr_;
@@ -66,8 +66,8 @@ class MatMulComputeHelper {
     // output shape would squeeze the reduced 1D dimension
     size_t num_output_dims = num_input_dims - (has_1D_input ? 1 : 0);
 
-    left_padded_dims_ = std::vector<ptrdiff_t>(num_dims_with_pad, 1);
-    right_padded_dims_ = std::vector<ptrdiff_t>(num_dims_with_pad, 1);
+    left_padded_dims_.assign(num_dims_with_pad, 1);
+    right_padded_dims_.assign(num_dims_with_pad, 1);
 
     if (right_num_dims == 1) {
       // right padded to (1,...,K,1)
@@ -90,7 +90,7 @@ class MatMulComputeHelper {
     }
 
     // validate input shape and generate output shape
-    std::vector<int64_t> output_dims(num_output_dims);
+    TensorShapeVector output_dims(num_output_dims);
 
     // broadcasting for all output dims except last two
     for (size_t idx_dim = 0; idx_dim < num_dims_with_pad - 2; ++idx_dim) {
@@ -141,7 +141,7 @@ class MatMulComputeHelper {
     }
 
     // assign shape
-    output_shape_ = TensorShape(output_dims);
+    output_shape_ = TensorShape(std::move(output_dims));
 
     // compute broadcast offsets
     ComputeBroadcastOffsets();
@@ -210,13 +210,14 @@ class MatMulComputeHelper {
 
   size_t num_broadcasted_dims_ = 0;
 
-  std::vector<ptrdiff_t> left_padded_dims_;
-  std::vector<ptrdiff_t> right_padded_dims_;
-  std::vector<ptrdiff_t> output_broadcast_dims_;
+  // Per dimension values, sized for the common ranks so that computing the helper does not allocate.
+  InlinedVector<ptrdiff_t, kTensorShapeSmallBufferElementsSize> left_padded_dims_;
+  InlinedVector<ptrdiff_t, kTensorShapeSmallBufferElementsSize> right_padded_dims_;
+  InlinedVector<ptrdiff_t, kTensorShapeSmallBufferElementsSize> output_broadcast_dims_;
 
-  std::vector<size_t> left_padded_strides_;
-  std::vector<size_t> right_padded_strides_;
-  std::vector<size_t> output_broadcast_strides_;
+  InlinedVector<size_t, kTensorShapeSmallBufferElementsSize> left_padded_strides_;
+  InlinedVector<size_t, kTensorShapeSmallBufferElementsSize> right_padded_strides_;
+  InlinedVector<size_t, kTensorShapeSmallBufferElementsSize> output_broadcast_strides_;
 
   TensorShape output_shape_;
 
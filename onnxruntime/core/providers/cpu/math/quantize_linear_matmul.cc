@@ -19,9 +19,9 @@ ONNX_OPERATOR_KERNEL_EX(
     10,
     kCpuExecutionProvider,
     KernelDefBuilder()
-        .TypeConstraint("T1", DataTypeImpl::GetTensorType<uint8_t>())
+        .TypeConstraint("T1", {DataTypeImpl::GetTensorType<uint8_t>(), DataTypeImpl::GetTensorType<int8_t>()})
         .TypeConstraint("T2", {DataTypeImpl::GetTensorType<uint8_t>(), DataTypeImpl::GetTensorType<int8_t>()})
-        .TypeConstraint("T3", DataTypeImpl::GetTensorType<uint8_t>()),
+        .TypeConstraint("T3", {DataTypeImpl::GetTensorType<uint8_t>(), DataTypeImpl::GetTensorType<int8_t>()}),
     QLinearMatMul);
 
 Status QLinearMatMul::Compute(OpKernelContext* ctx) const {
@@ -91,31 +91,45 @@ Status QLinearMatMul::Compute(OpKernelContext* ctx) const {
   gemm_shape.M = static_cast<size_t>(helper.M());
   gemm_shape.N = static_cast<size_t>(helper.N());
   gemm_shape.K = static_cast<size_t>(helper.K());
+  gemm_shape.AIsSigned = a->IsDataType<int8_t>();
   gemm_shape.BIsSigned = b_is_signed;
 
   MLAS_GEMM_U8X8_DATA_PARAMS gemm_params;
   gemm_params.lda = gemm_shape.K;
-  gemm_params.ZeroPointA = *a_offset->template Data<uint8_t>();
+  gemm_params.ZeroPointA = *static_cast<const uint8_t*>(a_offset->DataRaw());
   gemm_params.ldb = gemm_shape.N;
   gemm_params.ZeroPointB = static_cast<const uint8_t*>(b_offset->DataRaw());
   gemm_params.C = gemm_output;
   gemm_params.ldc = gemm_shape.N;
   gemm_params.BIsPacked = bool(packed_b_);
 
+  const bool y_is_signed = y->IsDataType<int8_t>();
+
   for (size_t i = 0; i < helper.OutputOffsets().size(); i++) {
-    gemm_params.A = a->template Data<uint8_t>() + helper.LeftOffsets()[i];
+    gemm_params.A = static_cast<const uint8_t*>(a->DataRaw()) + helper.LeftOffsets()[i];
     gemm_params.B = b_data + helper.RightOffsets()[i];
 
     MlasGemm(gemm_shape, gemm_params, ctx->GetOperatorThreadPool());
 
-    MlasRequantizeOutput(gemm_output,
-                         y->template MutableData<uint8_t>() + helper.OutputOffsets()[i],
-                         nullptr,
-                         static_cast<size_t>(helper.M()),
-                         static_cast<size_t>(helper.N()),
-                         &real_multiplier,
-                         false,
-                         *y_offset->template Data<uint8_t>());
+    if (y_is_signed) {
+      MlasRequantizeOutput(gemm_output,
+                           y->template MutableData<int8_t>() + helper.OutputOffsets()[i],
+                           nullptr,
+                           static_cast<size_t>(helper.M()),
+                           static_cast<size_t>(helper.N()),
+                           &real_multiplier,
+                           false,
+                           *y_offset->template Data<int8_t>());
+    } else {
+      MlasRequantizeOutput(gemm_output,
+                           y->template MutableData<uint8_t>() + helper.OutputOffsets()[i],
+                           nullptr,
+                           static_cast<size_t>(helper.M()),
+                           static_cast<size_t>(helper.N()),
+                           &real_multiplier,
+                           false,
+                           *y_offset->template Data<uint8_t>());
+    }
   }
 
   return Status::OK();
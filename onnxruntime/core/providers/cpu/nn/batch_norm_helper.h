@@ -106,10 +106,10 @@ class BatchNormHelper {
 
   static void NormalizeDims(const TensorShape& x_shape, std::vector<int64_t>& new_dims) {
     new_dims.clear();
-    auto& orig_dims = x_shape.GetDims();
+    const auto& orig_dims = x_shape.GetDims();
     if (orig_dims.size() == 4 /*supported size by CUDA*/ ||
         orig_dims.size() == 5 /*supported size by CUDA*/) {
-      new_dims = orig_dims;
+      new_dims.assign(orig_dims.begin(), orig_dims.end());
       return;
     }
 
@@ -18,6 +18,7 @@
 #include "core/providers/cpu/nn/conv.h"
 
 #include "core/common/safeint.h"
+#include "core/framework/tensorprotoutils.h"
 #include "core/util/math_cpuonly.h"
 
 namespace onnxruntime {
@@ -151,18 +152,103 @@ Status Conv<T>::Compute(OpKernelContext* context) const {
   return Status::OK();
 }
 
+Status Conv<float>::PrePack(const Tensor& tensor, int input_idx, bool& is_packed) {
+  is_packed = false;
+
+  if (input_idx != 1) {
+    return Status::OK();
+  }
+
+  const auto& shape = tensor.Shape();
+  if (shape.NumDimensions() != 4 || conv_attrs_.group <= 0 || shape[0] % conv_attrs_.group != 0) {
+    return Status::OK();
+  }
+
+  std::vector<int64_t> kernel_shape;
+  if (!conv_attrs_.ComputeKernelShape(shape, kernel_shape).IsOK()) {
+    return Status::OK();
+  }
+
+  std::vector<int64_t> dilations(conv_attrs_.dilations);
+  if (dilations.empty()) {
+    dilations.resize(kernel_shape.size(), 1);
+  }
+  std::vector<int64_t> strides(conv_attrs_.strides);
+  if (strides.empty()) {
+    strides.resize(kernel_shape.size(), 1);
+  }
+
+  const size_t group_count = static_cast<size_t>(conv_attrs_.group);
+  const size_t filter_count = static_cast<size_t>(shape[0]) / group_count;
+  const size_t input_channels = static_cast<size_t>(shape[1]);
+
+  // Only pack the filters when MlasConvPrepare will select the Winograd
+  // algorithm, as the other algorithms need the original weight.
+  if (!MlasConvWinogradIsSupported(kernel_shape.size(), kernel_shape.data(), dilations.data(), strides.data(),
+                                   input_channels, filter_count)) {
+    return Status::OK();
+  }
+
+  // The tile size depends on the output size. If the spatial dimensions of
+  // the input are known, transform the filters for that tile size only,
+  // otherwise transform them for both tile sizes.
+  bool need_tile2 = true;
+  bool need_tile4 = true;
+  const auto* input_shape_proto = Node().InputDefs()[0]->Shape();
+  if (input_shape_proto != nullptr) {
+    const TensorShape input_shape = utils::GetTensorShapeFromTensorShapeProto(*input_shape_proto);
+    if (input_shape.NumDimensions() == 4 && input_shape[2] > 0 && input_shape[3] > 0) {
+      std::vector<int64_t> pads(conv_attrs_.pads);
+      if (pads.empty()) {
+        pads.resize(kernel_shape.size() * 2, 0);
+      }
+      std::vector<int64_t> output_dims;
+      if (conv_attrs_.InferOutputShape(input_shape.Slice(2), kernel_shape, strides, dilations, pads, output_dims).IsOK()) {
+        const size_t tile_size = MlasConvWinogradTileSize(static_cast<size_t>(output_dims[0]),
+                                                          static_cast<size_t>(output_dims[1]));
+        need_tile2 = tile_size == 2;
+        need_tile4 = tile_size == 4;
+      }
+    }
+  }
+
+  auto alloc = Info().GetAllocator(0, OrtMemTypeDefault);
+  auto transform_filter = [&](size_t tile_size) {
+    const size_t transformed_size =
+        MlasConvWinogradTransformedFilterSize(tile_size, group_count, filter_count, input_channels);
+    auto* transformed_data = alloc->Alloc(SafeInt<size_t>(sizeof(float)) * transformed_size);
+    BufferUniquePtr transformed_filter(transformed_data, BufferDeleter(alloc));
+    MlasConvWinogradTransformFilter(tile_size, group_count, filter_count, input_channels,
+                                    tensor.Data<float>(), static_cast<float*>(transformed_data));
+    return transformed_filter;
+  };
+
+  if (need_tile2) {
+    winograd_filter_tile2_ = transform_filter(2);
+  }
+  if (need_tile4) {
+    winograd_filter_tile4_ = transform_filter(4);
+  }
+
+  W_shape_ = shape;
+  is_packed = true;
+
+  return Status::OK();
+}
+
 Status Conv<float>::Compute(OpKernelContext* context) const {
   size_t num_inputs = OpKernel::Node().InputDefs().size();
   const auto* X = context->Input<Tensor>(0);
-  const auto* W = context->Input<Tensor>(1);
+  const Tensor* W = W_shape_.NumDimensions() != 0 ? nullptr : context->Input<Tensor>(1);
+  const auto& W_shape = W != nullptr ? W->Shape() : W_shape_;
   const Tensor* B = num_inputs == 3 ? context->Input<Tensor>(2) : nullptr;
   const int64_t N = X->Shape()[0];
   const int64_t C = X->Shape()[1];
-  const int64_t M = W->Shape()[0];
-  ORT_RETURN_IF_ERROR(conv_attrs_.ValidateInputShape(X, W));
+  const int64_t M = W_shape[0];
+  ORT_RETURN_IF_ERROR(conv_attrs_.ValidateInputShape(X->Shape(), W_shape));
 
   std::vector<int64_t> kernel_shape;
-  ORT_RETURN_IF_ERROR(conv_attrs_.ComputeKernelShape(W->Shape(), kernel_shape));
+  ORT_RETURN_IF_ERROR(conv_attrs_.ComputeKernelShape(W_shape, kernel_shape));
 
   std::vector<int64_t> pads(conv_attrs_.pads);
   if (pads.empty()) {
@@ -217,13 +303,25 @@ Status Conv<float>::Compute(OpKernelContext* context) const {
                     &WorkingBufferSize,
                     thread_pool);
 
+    const float* Wdata = W != nullptr ? W->template Data<float>() : nullptr;
+
+    if (Parameters.Algorithm == MlasConvAlgorithmWinograd) {
+      const auto& transformed_filter =
+          Parameters.u.Winograd.TileSize == 4 ? winograd_filter_tile4_ : winograd_filter_tile2_;
+      Parameters.u.Winograd.TransformedFilter = static_cast<const float*>(transformed_filter.get());
+    }
+
+    ORT_RETURN_IF(Wdata == nullptr && (Parameters.Algorithm != MlasConvAlgorithmWinograd ||
+                                       Parameters.u.Winograd.TransformedFilter == nullptr),
+                  "Conv weight was not packed for the Winograd tile size selected for this input.");
+
     auto* working_data = WorkingBufferSize > 0 ? alloc->Alloc(SafeInt<size_t>(sizeof(float)) * WorkingBufferSize)
                                                : nullptr;
     BufferUniquePtr working_buffer(working_data, BufferDeleter(alloc));
 
     MlasConv(&Parameters,
              Xdata,
-             W->template Data<float>(),
+             Wdata,
              Bdata,
              static_cast<float*>(working_buffer.get()),
              Ydata,
@@ -28,12 +28,22 @@ class Conv<float> : public OpKernel {
     activation_.ActivationKind = MlasIdentityActivation;
   }
 
+  Status PrePack(const Tensor& tensor, int input_idx, bool& is_packed) override;
+
   Status Compute(OpKernelContext* context) const override;
 
  protected:
   MLAS_ACTIVATION activation_;
 
   ConvAttributes conv_attrs_;
+
+ private:
+  // 3x3 filters transformed for the Winograd algorithm, one buffer per tile
+  // size that Compute may select. When these are packed, the original weight
+  // is released and only its shape is kept.
+  BufferUniquePtr winograd_filter_tile2_;
+  BufferUniquePtr winograd_filter_tile4_;
+  TensorShape W_shape_;
 };
 
 }  // namespace onnxruntime
@@ -79,7 +79,7 @@ struct ConvAttributes {
         }
       }
     } else {
-      auto& weight_dims = weight_shape.GetDims();
+      const auto& weight_dims = weight_shape.GetDims();
       kernel_shape = std::vector<int64_t>(weight_dims.begin() + 2, weight_dims.end());
     }
 
@@ -96,7 +96,7 @@ struct ConvAttributes {
     }
 
     const int64_t M = weight_shape[0];
-    const int64_t C = channels_last ? input_shape.GetDims().back() : input_shape[1];
+    const int64_t C = channels_last ? input_shape[input_shape.NumDimensions() - 1] : input_shape[1];
 
     if (C != weight_shape[1] * group) {
       return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Input channels C is not equal to kernel channels * group.",
@@ -55,9 +55,9 @@ ONNX_CPU_OPERATOR_KERNEL(
     QLinearConv,
     10,
     KernelDefBuilder()
-        .TypeConstraint("T1", DataTypeImpl::GetTensorType<uint8_t>())
+        .TypeConstraint("T1", {DataTypeImpl::GetTensorType<uint8_t>(), DataTypeImpl::GetTensorType<int8_t>()})
         .TypeConstraint("T2", {DataTypeImpl::GetTensorType<uint8_t>(), DataTypeImpl::GetTensorType<int8_t>()})
-        .TypeConstraint("T3", DataTypeImpl::GetTensorType<uint8_t>())
+        .TypeConstraint("T3", {DataTypeImpl::GetTensorType<uint8_t>(), DataTypeImpl::GetTensorType<int8_t>()})
         .TypeConstraint("T4", DataTypeImpl::GetTensorType<int32_t>()),
     QLinearConv);
 
@@ -73,9 +73,9 @@ ONNX_OPERATOR_KERNEL_EX(
     1,
     kCpuExecutionProvider,
     KernelDefBuilder()
-        .TypeConstraint("T1", DataTypeImpl::GetTensorType<uint8_t>())
+        .TypeConstraint("T1", {DataTypeImpl::GetTensorType<uint8_t>(), DataTypeImpl::GetTensorType<int8_t>()})
         .TypeConstraint("T2", {DataTypeImpl::GetTensorType<uint8_t>(), DataTypeImpl::GetTensorType<int8_t>()})
-        .TypeConstraint("T3", DataTypeImpl::GetTensorType<uint8_t>())
+        .TypeConstraint("T3", {DataTypeImpl::GetTensorType<uint8_t>(), DataTypeImpl::GetTensorType<int8_t>()})
         .TypeConstraint("T4", DataTypeImpl::GetTensorType<int32_t>()),
     QLinearConv);
 
@@ -164,6 +164,7 @@ Status QLinearConv::Compute(OpKernelContext* context) const {
   const Tensor* W = is_W_packed_ ? nullptr : context->Input<Tensor>(3);
   const auto& W_shape = W ? W->Shape() : W_shape_;
   const bool is_W_signed = (W != nullptr) ? W->IsDataType<int8_t>() : is_W_signed_;
+  const bool is_X_signed = X->IsDataType<int8_t>();
 
   const int64_t N = X->Shape()[0];
   const int64_t M = W_shape[0];
@@ -177,8 +178,9 @@ Status QLinearConv::Compute(OpKernelContext* context) const {
   ORT_ENFORCE(IsScalarOr1ElementVector(Y_zero_point),
               "QLinearConv : result zero point must be a scalar or 1D tensor of size 1");
 
-  auto X_zero_point_value = *(X_zero_point->template Data<uint8_t>());
-  auto Y_zero_point_value = *(Y_zero_point->template Data<uint8_t>());
+  auto X_zero_point_value = *static_cast<const uint8_t*>(X_zero_point->DataRaw());
+  auto Y_zero_point_value = *static_cast<const uint8_t*>(Y_zero_point->DataRaw());
+  const bool is_Y_signed = Y_zero_point->IsDataType<int8_t>();
 
   uint8_t W_zero_point_value;
   const auto& W_zero_point_shape = W_zero_point->Shape();
@@ -306,6 +308,14 @@ Status QLinearConv::Compute(OpKernelContext* context) const {
     group_count = 1;
   }
 
+  // The depthwise kernels only consume unsigned inputs. Signed inputs are
+  // converted by flipping the sign bit of each element, which preserves the
+  // difference between the input and its zero point.
+  const bool convert_X_to_unsigned = is_depthwise_conv && is_X_signed;
+  if (convert_X_to_unsigned) {
+    X_zero_point_value = static_cast<uint8_t>(X_zero_point_value ^ 0x80);
+  }
+
   const int64_t X_offset = C * input_image_size;
   const int64_t Y_offset = M * output_image_size;
   const int64_t kernel_dim = group_input_channels * kernel_size;
@@ -317,9 +327,9 @@ Status QLinearConv::Compute(OpKernelContext* context) const {
   BufferUniquePtr gemm_output_buffer(gemm_output_data, BufferDeleter(alloc));
   auto* gemm_output = static_cast<int32_t*>(gemm_output_buffer.get());
 
-  const auto* Xdata = X->template Data<uint8_t>();
+  const auto* Xdata = static_cast<const uint8_t*>(X->DataRaw());
   const auto* Bdata = B != nullptr ? B->template Data<int32_t>() : nullptr;
-  auto* Ydata = Y->template MutableData<uint8_t>();
+  auto* Ydata = static_cast<uint8_t*>(Y->MutableDataRaw());
 
   BufferUniquePtr transpose_input_buffer;
   BufferUniquePtr transpose_output_buffer;
@@ -330,6 +340,10 @@ Status QLinearConv::Compute(OpKernelContext* context) const {
     transpose_input_buffer = BufferUniquePtr(transpose_input, BufferDeleter(alloc));
     auto* transpose_output = alloc->Alloc(SafeInt<size_t>(sizeof(uint8_t)) * Y_offset);
     transpose_output_buffer = BufferUniquePtr(transpose_output, BufferDeleter(alloc));
+  } else if (convert_X_to_unsigned) {
+    // Allocate a temporary buffer to hold the input converted to unsigned.
+    auto* transpose_input = alloc->Alloc(SafeInt<size_t>(sizeof(uint8_t)) * X_offset);
+    transpose_input_buffer = BufferUniquePtr(transpose_input, BufferDeleter(alloc));
   }
 
   BufferUniquePtr col_buffer;
@@ -390,6 +404,14 @@ Status QLinearConv::Compute(OpKernelContext* context) const {
       output_data = static_cast<uint8_t*>(transpose_output_buffer.get());
     }
 
+    if (convert_X_to_unsigned) {
+      auto* converted_input = static_cast<uint8_t*>(transpose_input_buffer.get());
+      for (int64_t i = 0; i < X_offset; i++) {
+        converted_input[i] = static_cast<uint8_t>(input_data[i] ^ 0x80);
+      }
+      input_data = converted_input;
+    }
+
     // Threaded implementation of ND convolution is not yet supported, so
     // prepare all im2col transformations here.
     if (!is_depthwise_conv && col_buffer && kernel_rank > 2) {
@@ -504,6 +526,7 @@ Status QLinearConv::Compute(OpKernelContext* context) const {
           gemm_shape.M = static_cast<size_t>(output_count);
           gemm_shape.N = static_cast<size_t>(group_output_channels);
           gemm_shape.K = static_cast<size_t>(kernel_dim);
+          gemm_shape.AIsSigned = is_X_signed;
           gemm_shape.BIsSigned = is_W_signed;
 
           MLAS_GEMM_U8X8_DATA_PARAMS gemm_params;
@@ -524,15 +547,27 @@ Status QLinearConv::Compute(OpKernelContext* context) const {
         }
       }
 
-      MlasRequantizeOutput(
-          worker_gemm_output,
-          worker_requantize_output,
-          Bdata,
-          static_cast<size_t>(output_count),
-          static_cast<size_t>(M),
-          output_scales.data(),
-          output_scales.size() > 1,
-          Y_zero_point_value);
+      if (is_Y_signed) {
+        MlasRequantizeOutput(
+            worker_gemm_output,
+            reinterpret_cast<int8_t*>(worker_requantize_output),
+            Bdata,
+            static_cast<size_t>(output_count),
+            static_cast<size_t>(M),
+            output_scales.data(),
+            output_scales.size() > 1,
+            static_cast<int8_t>(Y_zero_point_value));
+      } else {
+        MlasRequantizeOutput(
+            worker_gemm_output,
+            worker_requantize_output,
+            Bdata,
+            static_cast<size_t>(output_count),
+            static_cast<size_t>(M),
+            output_scales.data(),
+            output_scales.size() > 1,
+            Y_zero_point_value);
+      }
     };
 
     concurrency::ThreadPool::TrySimpleParallelFor(thread_pool, thread_count, conv_worker);
@@ -5,7 +5,6 @@
 
 #include "core/framework/op_kernel.h"
 
-#include <locale>
 #include <string>
 #include <unordered_set>
 
@@ -28,10 +27,8 @@ class StringNormalizer : public OpKernel {
   bool is_case_sensitive_;
   CaseAction case_change_action_;
   CaseAction compare_caseaction_;  // used for case-insensitive compare
-  std::string locale_name_;
-  // Either if these are populated but not both
+  // Stopwords in utf8, converted to compare_caseaction_ if case-insensitive
   std::unordered_set<std::string> stopwords_;
-  std::unordered_set<std::wstring> wstopwords_;
 };
 
 }  // namespace onnxruntime
@@ -3,6 +3,7 @@
 
 #include "core/providers/cpu/reduction/reduction_ops.h"
 #include "core/providers/common.h"
+#include "core/mlas/inc/mlas.h"
 
 using namespace std;
 namespace onnxruntime {
@@ -251,7 +252,7 @@ bool SetupForReduce(const Tensor* input_tensor_ptr,
   }
 
   empty_reduce = false;
-  output_shape = new_input_shape.GetDims();
+  output_shape = new_input_shape.GetDimsAsVector();
   for (auto a : axes) {
     output_shape[a] = new_input_shape[a] > 0 ? 1 : 0;
     empty_reduce |= output_shape[a] == 0;
@@ -262,7 +263,7 @@ void NoTransposePrepareForReduce(const TensorShape& new_input_shape,
                                  const std::vector<int64_t>& reduced_axes,
                                  ResultsNoTransposePrepareForReduce& results) {
   // Common initialisation for the indices.
-  std::vector<int64_t> cumulative_shape = new_input_shape.GetDims();
+  std::vector<int64_t> cumulative_shape = new_input_shape.GetDimsAsVector();
   cumulative_shape[cumulative_shape.size() - 1] = 1;
   for (int i = static_cast<int>(cumulative_shape.size()) - 2; i >= 0; --i) {
     cumulative_shape[i] = cumulative_shape[i + 1] * new_input_shape[i + 1];
@@ -355,6 +356,170 @@ void NoTransposePrepareForReduce(const TensorShape& new_input_shape,
   }
 }
 
+// Number of columns of the input reduced by a unit of work in a column reduction
+static constexpr int64_t kFastReduceColumnsPerUnit = 64;
+
+// Number of elements reduced by a unit of work when the whole input is reduced to a single value
+static constexpr int64_t kFastReduceElementsPerUnit = 16384;
+
+/**
+Reduces a float input with the MLAS row and column reductions if, after dropping the axes of size 1 and merging
+adjacent axes that are all reduced or all kept, the input is
+  [R]       - the whole input is reduced to one value, in blocks that are combined afterwards,
+  [K, R]    - the trailing axes are reduced, by rows that are split among the threads, or
+  [K, R, K] - the leading or middle axes are reduced, by columns that are split among the threads.
+Returns false for other reductions, which use the general implementation.
+*/
+static bool FastReduce(MLAS_REDUCTION_KIND kind, bool is_mean, Tensor* output, const TensorShape& input_shape,
+                       const Tensor& input, const std::vector<int64_t>& reduced_axes,
+                       concurrency::ThreadPool* tp) {
+  if (input_shape.Size() <= 0) {
+    return false;
+  }
+
+  int64_t block_sizes[3];
+  bool block_is_reduced[3];
+  size_t num_blocks = 0;
+  const auto dims = input_shape.GetDims();
+  for (size_t i = 0; i < dims.size(); ++i) {
+    if (dims[i] == 1)
+      continue;
+    const bool is_reduced = reduced_axes.empty() ||
+                            std::find(reduced_axes.begin(), reduced_axes.end(), static_cast<int64_t>(i)) !=
+                                reduced_axes.end();
+    if (num_blocks > 0 && block_is_reduced[num_blocks - 1] == is_reduced) {
+      block_sizes[num_blocks - 1] *= dims[i];
+    } else {
+      if (num_blocks == 3)
+        return false;
+      block_sizes[num_blocks] = dims[i];
+      block_is_reduced[num_blocks++] = is_reduced;
+    }
+  }
+
+  // Inputs with a single element or without reduced axes of size > 1 are copied by the general implementation
+  if (num_blocks == 0 || (num_blocks == 1 && !block_is_reduced[0]) || (num_blocks == 3 && block_is_reduced[0])) {
+    return false;
+  }
+
+  const float* from_data = input.template Data<float>();
+  float* to_data = output->template MutableData<float>();
+  const double compute_cycles = kind == MlasLogSumExpReduction ? 16.0 : 1.0;
+
+  if (num_blocks == 1) {
+    const int64_t size = block_sizes[0];
+    const int64_t num_units = (size + kFastReduceElementsPerUnit - 1) / kFastReduceElementsPerUnit;
+    if (num_units == 1 || kind == MlasLogSumExpReduction ||
+        concurrency::ThreadPool::DegreeOfParallelism(tp) == 1) {
+      MlasReduceRows(kind, from_data, to_data, 1, static_cast<size_t>(size));
+    } else {
+      std::vector<float> partial_results(static_cast<size_t>(num_units));
+      concurrency::ThreadPool::TrySimpleParallelFor(tp, num_units, [&](std::ptrdiff_t unit) {
+        const int64_t first = unit * kFastReduceElementsPerUnit;
+        MlasReduceRows(kind, from_data + first, &partial_results[unit], 1,
+                       static_cast<size_t>(std::min(kFastReduceElementsPerUnit, size - first)));
+      });
+      MlasReduceRows(kind, partial_results.data(), to_data, 1, partial_results.size());
+    }
+    if (is_mean) {
+      to_data[0] /= static_cast<float>(size);
+    }
+    return true;
+  }
+
+  if (block_is_reduced[1]) {
+    const int64_t rows = block_sizes[0];
+    const int64_t columns = block_sizes[1];
+    const float scale = 1.0f / static_cast<float>(columns);
+    concurrency::ThreadPool::TryParallelFor(
+        tp, rows,
+        TensorOpCost{static_cast<double>(columns * sizeof(float)), static_cast<double>(sizeof(float)),
+                     columns * compute_cycles},
+        [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+          MlasReduceRows(kind, from_data + first * columns, to_data + first, static_cast<size_t>(last - first),
+                         static_cast<size_t>(columns));
+          if (is_mean) {
+            for (std::ptrdiff_t i = first; i < last; ++i) {
+              to_data[i] *= scale;
+            }
+          }
+        });
+    return true;
+  }
+
+  const int64_t outer_size = num_blocks == 3 ? block_sizes[0] : 1;
+  const int64_t reduced_size = num_blocks == 3 ? block_sizes[1] : block_sizes[0];
+  const int64_t inner_size = num_blocks == 3 ? block_sizes[2] : block_sizes[1];
+  const int64_t units_per_outer = (inner_size + kFastReduceColumnsPerUnit - 1) / kFastReduceColumnsPerUnit;
+  const int64_t columns_per_unit = std::min(inner_size, kFastReduceColumnsPerUnit);
+  const float scale = 1.0f / static_cast<float>(reduced_size);
+  concurrency::ThreadPool::TryParallelFor(
+      tp, outer_size * units_per_outer,
+      TensorOpCost{static_cast<double>(reduced_size * columns_per_unit * sizeof(float)),
+                   static_cast<double>(columns_per_unit * sizeof(float)),
+                   reduced_size * columns_per_unit * compute_cycles},
+      [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+        for (std::ptrdiff_t unit = first; unit < last; ++unit) {
+          const int64_t outer = unit / units_per_outer;
+          const int64_t column = (unit % units_per_outer) * kFastReduceColumnsPerUnit;
+          const int64_t num_columns = std::min(kFastReduceColumnsPerUnit, inner_size - column);
+          float* to = to_data + outer * inner_size + column;
+          MlasReduceColumns(kind, from_data + outer * reduced_size * inner_size + column,
+                            static_cast<size_t>(inner_size), to,
+                            static_cast<size_t>(reduced_size), static_cast<size_t>(num_columns));
+          if (is_mean) {
+            for (int64_t i = 0; i < num_columns; ++i) {
+              to[i] *= scale;
+            }
+          }
+        }
+      });
+  return true;
+}
+
+// Reductions that have an MLAS implementation are specialized to use it where possible.
+template <typename T, typename AGG>
+static bool TryFastReduce(Tensor*, const TensorShape&, const Tensor&, const std::vector<int64_t>&,
+                          concurrency::ThreadPool*) {
+  return false;
+}
+
+template <>
+bool TryFastReduce<float, ReduceAggregatorSum<float>>(Tensor* output, const TensorShape& input_shape,
+                                                      const Tensor& input, const std::vector<int64_t>& reduced_axes,
+                                                      concurrency::ThreadPool* tp) {
+  return FastReduce(MlasSumReduction, false, output, input_shape, input, reduced_axes, tp);
+}
+
+template <>
+bool TryFastReduce<float, ReduceAggregatorMean<float>>(Tensor* output, const TensorShape& input_shape,
+                                                       const Tensor& input, const std::vector<int64_t>& reduced_axes,
+                                                       concurrency::ThreadPool* tp) {
+  return FastReduce(MlasSumReduction, true, output, input_shape, input, reduced_axes, tp);
+}
+
+template <>
+bool TryFastReduce<float, ReduceAggregatorMax<float>>(Tensor* output, const TensorShape& input_shape,
+                                                      const Tensor& input, const std::vector<int64_t>& reduced_axes,
+                                                      concurrency::ThreadPool* tp) {
+  return FastReduce(MlasMaximumReduction, false, output, input_shape, input, reduced_axes, tp);
+}
+
+template <>
+bool TryFastReduce<float, ReduceAggregatorMin<float>>(Tensor* output, const TensorShape& input_shape,
+                                                      const Tensor& input, const std::vector<int64_t>& reduced_axes,
+                                                      concurrency::ThreadPool* tp) {
+  return FastReduce(MlasMinimumReduction, false, output, input_shape, input, reduced_axes, tp);
+}
+
+template <>
+bool TryFastReduce<float, ReduceAggregatorLogSumExp<float>>(Tensor* output, const TensorShape& input_shape,
+                                                            const Tensor& input,
+                                                            const std::vector<int64_t>& reduced_axes,
+                                                            concurrency::ThreadPool* tp) {
+  return FastReduce(MlasLogSumExpReduction, false, output, input_shape, input, reduced_axes, tp);
+}
+
 template <typename T, typename AGG>
 void NoTransposeReduce(Tensor* output, const TensorShape& new_input_shape, const Tensor& input,
                        const std::vector<int64_t>& reduced_axes, concurrency::ThreadPool* tp,
@@ -364,6 +529,10 @@ void NoTransposeReduce(Tensor* output, const TensorShape& new_input_shape, const
   typename AGG::value_type* to_data = output->template MutableData<typename AGG::value_type>();
   int64_t count = output_shape.Size();
 
+  if (TryFastReduce<T, AGG>(output, new_input_shape, input, reduced_axes, tp)) {
+    return;
+  }
+
   if (reduced_axes.size() == 0 || reduced_axes.size() == new_input_shape.NumDimensions()) {
     ORT_ENFORCE(count == 1, "Reduction on all axes, output size should be 1.");
     int64_t input_size = new_input_shape.Size();
@@ -462,7 +631,7 @@ void CommonReduce(OpKernelContext* ctx,
                   bool noop_with_empty_axes) {
   std::vector<int64_t> axes;
   const Tensor* input = ctx->Input<Tensor>(0);
-  auto reduced_dims = input->Shape().GetDims();
+  auto reduced_dims = input->Shape().GetDimsAsVector();
   std::vector<int64_t> output_shape;
   bool empty_reduce;
   TensorShape new_input_shape;
@@ -590,7 +759,7 @@ Tensor ReduceSum<T>::Impl(const Tensor& input, const std::vector<int64_t>& reduc
                           AllocatorPtr allocator, concurrency::ThreadPool* tp, bool keep_dims,
                           const TensorShape* input_shape_override) {
   std::vector<int64_t> axes;
-  auto reduced_dims = input.Shape().GetDims();
+  auto reduced_dims = input.Shape().GetDimsAsVector();
   std::vector<int64_t> output_shape;
   TensorShape new_input_shape;
   bool empty_reduce;
@@ -32,16 +32,13 @@ class ResultsNoTransposePrepareForReduce {
     last_loop_inc = 0;
   }
 
-  bool equal(const std::vector<int64_t>& local_input_shape, const std::vector<int64_t>& local_reduced_axes) {
+  bool equal(gsl::span<const int64_t> local_input_shape, const std::vector<int64_t>& local_reduced_axes) {
     if (input_shape.size() != local_input_shape.size())
       return false;
     if (reduced_axes.size() != local_reduced_axes.size())
       return false;
-    for (std::vector<int64_t>::const_iterator it1 = input_shape.begin(), it2 = local_input_shape.begin();
-         it1 != input_shape.end(); ++it1, ++it2) {
-      if (*it1 != *it2)
-        return false;
-    }
+    if (!std::equal(input_shape.begin(), input_shape.end(), local_input_shape.begin()))
+      return false;
     for (std::vector<int64_t>::const_iterator it1 = reduced_axes.begin(), it2 = local_reduced_axes.begin();
          it1 != reduced_axes.end(); ++it1, ++it2) {
       if (*it1 != *it2)
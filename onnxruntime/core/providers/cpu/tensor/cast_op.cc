@@ -15,6 +15,7 @@
 #include "core/framework/data_types.h"
 #include "core/framework/element_type_lists.h"
 #include "core/framework/op_kernel.h"
+#include "core/mlas/inc/mlas.h"
 #include "core/providers/cpu/tensor/utils.h"
 #include "core/providers/op_kernel_type_control.h"
 #include "core/util/math_cpuonly.h"
@@ -22,10 +23,6 @@
 #include "Eigen/src/Core/arch/Default/BFloat16.h"
 #include "Eigen/src/Core/arch/Default/Half.h"
 
-#if defined(_M_AMD64) && !defined(_M_ARM64EC)
-#include "core/mlas/inc/mlas.h"
-#endif
-
 namespace onnxruntime {
 
 namespace op_kernel_type_control {
@@ -213,9 +210,8 @@ struct TensorCaster<std::string, DstType> {
   }
 };
 
-#if defined(_M_AMD64) && !defined(_M_ARM64EC)
-// specializations to use optimized and Windows x64-specific
-// MlasConvertHalfToFloatBuffer() routine for MLFloat16 -> float conversion
+// specializations to use the optimized MlasConvertHalfToFloatBuffer() and
+// MlasConvertFloatToHalfBuffer() routines for MLFloat16 <-> float conversion
 
 // tensor MLFloat16 -> float
 template <>
@@ -228,6 +224,17 @@ struct TensorCaster<MLFloat16, float> {
   }
 };
 
+// tensor float -> MLFloat16
+template <>
+struct TensorCaster<float, MLFloat16> {
+  void Cast(const OpKernelContext&, const TensorShape& shape, const Tensor& in, Tensor& out) const {
+    auto out_data = out.MutableData<MLFloat16>();
+    auto in_data = in.Data<float>();
+    const size_t shape_size = gsl::narrow<size_t>(shape.Size());
+    MlasConvertFloatToHalfBuffer(in_data, &out_data[0].val, shape_size);
+  }
+};
+
 Tensor GetIntermediateMLFloat16ToFloatTensor(
     const OpKernelContext& context, const TensorShape& shape, const Tensor& in) {
   AllocatorPtr allocator;
@@ -260,7 +267,6 @@ struct TensorCaster<MLFloat16, std::string> {
     CastMLFloat16ThroughFloatTensor<std::string>(context, shape, in, out);
   }
 };
-#endif
 
 class Cast final : public OpKernel {
  public:
@@ -91,7 +91,7 @@ Status ConcatBase::PrepareForCompute(OpKernelContext* ctx,
   }
 
   // Calculate the shape of the output tensor
-  std::vector<int64_t> output_dims = inputs_0_dims;
+  std::vector<int64_t> output_dims(inputs_0_dims.begin(), inputs_0_dims.end());
   // 'Concat' mode
   if (!is_stack_) {
     // While concating, the rank of the output is the same as the input rank(s)
@@ -54,8 +54,15 @@ ONNX_CPU_OPERATOR_KERNEL(
     Gather);
 
 Status GatherBase::PrepareForCompute(OpKernelContext* context, Prepare& p) const {
-  p.input_tensor = context->Input<Tensor>(0);
-  const TensorShape& input_data_shape = p.input_tensor->Shape();
+  const Tensor* input_tensor = context->Input<Tensor>(0);
+  ORT_RETURN_IF_ERROR(PrepareForCompute(context, input_tensor->Shape(), p));
+  p.input_tensor = input_tensor;
+  return Status::OK();
+}
+
+Status GatherBase::PrepareForCompute(OpKernelContext* context, const TensorShape& input_data_shape,
+                                     Prepare& p) const {
+  p.input_tensor = nullptr;
   p.indices_tensor = context->Input<Tensor>(1);
   const TensorShape& indices_shape = p.indices_tensor->Shape();
 
@@ -80,10 +87,11 @@ Status GatherBase::PrepareForCompute(OpKernelContext* context, Prepare& p) const
   return Status::OK();
 }
 
+// src_packed is set instead of src_base when the data is constant float stored in a PackedGatherTable.
 template <typename Tin>
-Status GatherCopyData(const Tensor* indices_tensor, const uint8_t* src_base, uint8_t* dst_base, bool is_string_type,
-                      const size_t element_bytes, const int64_t block_size, const int64_t M,
-                      const int64_t N, const int64_t data_batch_bytes, const int64_t gathered_batch_bytes,
+Status GatherCopyData(const Tensor* indices_tensor, const uint8_t* src_base, const PackedGatherTable* src_packed,
+                      uint8_t* dst_base, bool is_string_type, const size_t element_bytes,
+                      const int64_t block_size, const int64_t M, const int64_t N,
                       const TensorShape& input_data_shape, const int64_t axis, concurrency::ThreadPool* tp) {
   const Tin* indices_data = indices_tensor->template Data<Tin>();
 
@@ -99,64 +107,98 @@ Status GatherCopyData(const Tensor* indices_tensor, const uint8_t* src_base, uin
     }
   }
 
-  auto lambda = [&](int64_t index) {
-    int64_t batch = index / N;
-    int64_t i = index % N;
+  // Output block index is gathered from the input block (slice along the axis) returned here. Blocks of
+  // consecutive batches are axis_dim_limit apart in the input and N apart in the output.
+  auto source_block = [&](ptrdiff_t index) -> int64_t {
+    const int64_t batch = index / N;
+    const int64_t idx = static_cast<int64_t>(indices_data[index % N]);
+    return batch * axis_dim_limit + (idx < 0 ? idx + axis_dim_limit : idx);
+  };
 
-    const int64_t src_offset_batch = batch * data_batch_bytes;
-    const int64_t dst_offset_batch = batch * gathered_batch_bytes;
-    Tin idx = indices_data[i];
-    idx = idx < 0 ? idx + static_cast<Tin>(axis_dim_limit) : idx;
-    const int64_t src_offset = src_offset_batch + idx * block_size;
-    const int64_t dst_offset = dst_offset_batch + i * block_size;
-
-    if (is_string_type) {
-      reinterpret_cast<std::string*>(dst_base)[dst_offset / element_bytes] =
-          reinterpret_cast<const std::string*>(src_base)[src_offset / element_bytes];
-    } else {
-      memcpy(dst_base + dst_offset, src_base + src_offset, block_size);
+  // Strings live outside the tensor buffer, so prefetching the tensor data would not help.
+  const bool prefetch = !is_string_type &&
+                        (src_packed != nullptr || static_cast<size_t>(block_size) >= kGatherPrefetchMinRowBytes);
+
+  auto lambda = [&](ptrdiff_t first, ptrdiff_t last) {
+    for (ptrdiff_t index = first; index < last; ++index) {
+      if (prefetch && index + kGatherPrefetchDistance < last) {
+        const int64_t prefetch_block = source_block(index + kGatherPrefetchDistance);
+        if (src_packed != nullptr) {
+          src_packed->PrefetchRow(prefetch_block);
+        } else {
+          GatherPrefetchRow(src_base + prefetch_block * block_size, static_cast<size_t>(block_size));
+        }
+      }
+
+      const int64_t src_block = source_block(index);
+      const int64_t dst_offset = index * block_size;
+
+      if (is_string_type) {
+        reinterpret_cast<std::string*>(dst_base)[dst_offset / element_bytes] =
+            reinterpret_cast<const std::string*>(src_base)[src_block * block_size / element_bytes];
+      } else if (src_packed != nullptr) {
+        src_packed->CopyRow(src_block, reinterpret_cast<float*>(dst_base + dst_offset));
+      } else {
+        memcpy(dst_base + dst_offset, src_base + src_block * block_size, block_size);
+      }
     }
   };
-  concurrency::ThreadPool::TryParallelFor(tp, M * N, static_cast<double>(block_size),
-                                          [&lambda](ptrdiff_t first, ptrdiff_t last) {
-                                            for (int index = static_cast<int>(first), end = static_cast<int>(last); index < end; ++index) {
-                                              lambda(index);
-                                            }
-                                          });
+  concurrency::ThreadPool::TryParallelFor(tp, M * N, static_cast<double>(block_size), lambda);
+
+  return Status::OK();
+}
+
+Status Gather::PrePack(const Tensor& tensor, int input_idx, bool& is_packed) {
+  is_packed = false;
+
+  PackedGatherTable::Format format;
+  if (input_idx == 0 && tensor.IsDataType<float>() && tensor.Shape().NumDimensions() >= 1 &&
+      tensor.Shape().Size() > 0 &&
+      PackedGatherTable::GetFormat(Info(), format)) {
+    const TensorShape& shape = tensor.Shape();
+    const int64_t axis = HandleNegativeAxis(axis_, shape.NumDimensions());
+    packed_data_ = onnxruntime::make_unique<PackedGatherTable>(tensor.Data<float>(), shape.SizeToDimension(axis + 1),
+                                                               shape.SizeFromDimension(axis + 1), format,
+                                                               Info().GetAllocator(0, OrtMemTypeDefault));
+    packed_data_shape_ = shape;
+    is_packed = true;
+  }
 
   return Status::OK();
 }
 
 Status Gather::Compute(OpKernelContext* context) const {
   Prepare p;
-  ORT_RETURN_IF_ERROR(PrepareForCompute(context, p));
+  if (packed_data_) {
+    ORT_RETURN_IF_ERROR(PrepareForCompute(context, packed_data_shape_, p));
+  } else {
+    ORT_RETURN_IF_ERROR(PrepareForCompute(context, p));
+  }
 
-  const TensorShape& input_data_shape = p.input_tensor->Shape();
+  const TensorShape& input_data_shape = packed_data_ ? packed_data_shape_ : p.input_tensor->Shape();
 
-  bool is_string_type = p.input_tensor->IsDataTypeString();
+  bool is_string_type = !packed_data_ && p.input_tensor->IsDataTypeString();
 
-  const size_t element_bytes = p.input_tensor->DataType()->Size();
+  const size_t element_bytes = packed_data_ ? sizeof(float) : p.input_tensor->DataType()->Size();
   const int64_t block = input_data_shape.SizeFromDimension(p.axis + 1);
   const int64_t block_size = block * element_bytes;
   const int64_t M = input_data_shape.SizeToDimension(p.axis);
   const int64_t N = p.indices_tensor->Shape().Size();
-  const int64_t data_batch_bytes = input_data_shape.SizeFromDimension(p.axis) * element_bytes;
-  const int64_t gathered_batch_bytes = N * block * element_bytes;
 
-  const auto* src_base = static_cast<const uint8_t*>(p.input_tensor->DataRaw());
+  const auto* src_base = packed_data_ ? nullptr : static_cast<const uint8_t*>(p.input_tensor->DataRaw());
   auto* dst_base = static_cast<uint8_t*>(p.output_tensor->MutableDataRaw());
 
   concurrency::ThreadPool* tp = context->GetOperatorThreadPool();
 
   if (utils::HasType<EnabledIndexTypes, int32_t>() &&
       p.indices_tensor->IsDataType<int32_t>()) {
-    return GatherCopyData<int32_t>(p.indices_tensor, src_base, dst_base, is_string_type, element_bytes,
-                                   block_size, M, N, data_batch_bytes, gathered_batch_bytes, input_data_shape, p.axis, tp);
+    return GatherCopyData<int32_t>(p.indices_tensor, src_base, packed_data_.get(), dst_base, is_string_type,
+                                   element_bytes, block_size, M, N, input_data_shape, p.axis, tp);
   }
   if (utils::HasType<EnabledIndexTypes, int64_t>() &&
       p.indices_tensor->IsDataType<int64_t>()) {
-    return GatherCopyData<int64_t>(p.indices_tensor, src_base, dst_base, is_string_type, element_bytes,
-                                   block_size, M, N, data_batch_bytes, gathered_batch_bytes, input_data_shape, p.axis, tp);
+    return GatherCopyData<int64_t>(p.indices_tensor, src_base, packed_data_.get(), dst_base, is_string_type,
+                                   element_bytes, block_size, M, N, input_data_shape, p.axis, tp);
   }
 
   return ORT_MAKE_STATUS(ONNXRUNTIME, NOT_IMPLEMENTED, "Gather Tind type not supported in this build.");
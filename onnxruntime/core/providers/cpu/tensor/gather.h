@@ -6,6 +6,7 @@
 #include "core/common/common.h"
 #include "core/framework/op_kernel.h"
 #include "core/providers/common.h"
+#include "core/providers/cpu/tensor/gather_table.h"
 
 namespace onnxruntime {
 
@@ -24,7 +25,10 @@ class GatherBase {
 
   Status PrepareForCompute(OpKernelContext* context, Prepare& p) const;
 
- private:
+  // Variant for a prepacked data input, which is not available from the
+  // context: p.input_tensor is set to nullptr.
+  Status PrepareForCompute(OpKernelContext* context, const TensorShape& input_data_shape, Prepare& p) const;
+
   int64_t axis_;
 };
 
@@ -32,6 +36,13 @@ class Gather final : public OpKernel, public GatherBase {
  public:
   Gather(const OpKernelInfo& info) : OpKernel(info), GatherBase(info) {}
 
+  Status PrePack(const Tensor& tensor, int input_idx, bool& is_packed) override;
+
   Status Compute(OpKernelContext* context) const override;
+
+ private:
+  // Constant float data stored with a narrower type, with a row for each slice along the gathered axis.
+  TensorShape packed_data_shape_;
+  std::unique_ptr<PackedGatherTable> packed_data_;
 };
 }  // namespace onnxruntime
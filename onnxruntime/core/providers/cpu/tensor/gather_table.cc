@@ -0,0 +1,115 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/providers/cpu/tensor/gather_table.h"
+
+#include <cmath>
+
+#include "core/common/safeint.h"
+#include "core/framework/op_kernel.h"
+#include "core/mlas/inc/mlas.h"
+#include "core/providers/cpu/cpu_execution_provider.h"
+
+namespace onnxruntime {
+
+PackedGatherTable::PackedGatherTable(const float* data, int64_t row_count, int64_t row_size, Format format,
+                                     const AllocatorPtr& alloc)
+    : row_count_(row_count),
+      row_size_(row_size),
+      format_(format),
+      element_bytes_(format == Format::kFloat16 ? sizeof(uint16_t) : sizeof(int8_t)) {
+  const size_t count = SafeInt<size_t>(row_count) * row_size;
+  data_ = BufferUniquePtr(alloc->Alloc(SafeInt<size_t>(count) * element_bytes_), BufferDeleter(alloc));
+
+  if (format == Format::kFloat16) {
+    MlasConvertFloatToHalfBuffer(data, static_cast<uint16_t*>(data_.get()), count);
+    return;
+  }
+
+  scales_ = BufferUniquePtr(alloc->Alloc(SafeInt<size_t>(row_count) * sizeof(float)), BufferDeleter(alloc));
+  auto* scales = static_cast<float*>(scales_.get());
+  auto* quantized = static_cast<int8_t*>(data_.get());
+
+  for (int64_t row = 0; row < row_count; row++) {
+    const float* input = data + row * row_size;
+    int8_t* output = quantized + row * row_size;
+
+    float max_abs = 0.0f;
+    for (int64_t i = 0; i < row_size; i++) {
+      max_abs = std::max(max_abs, std::fabs(input[i]));
+    }
+
+    // A row of zeros keeps a zero scale and quantizes to zeros.
+    const float scale = max_abs / 127.0f;
+    const float inverse_scale = max_abs > 0.0f ? 127.0f / max_abs : 0.0f;
+    for (int64_t i = 0; i < row_size; i++) {
+      const float value = std::nearbyint(input[i] * inverse_scale);
+      output[i] = static_cast<int8_t>(std::min(std::max(value, -127.0f), 127.0f));
+    }
+    scales[row] = scale;
+  }
+}
+
+bool PackedGatherTable::GetFormat(const OpKernelInfo& info, Format& format) {
+  const auto* provider = info.GetExecutionProvider();
+  if (provider->Type() != kCpuExecutionProvider) {
+    return false;
+  }
+
+  const auto* cpu_provider = static_cast<const CPUExecutionProvider*>(provider);
+  if (cpu_provider->QuantizeGatherTables()) {
+    format = Format::kInt8;
+    return true;
+  }
+  if (cpu_provider->UseFp16Initializers()) {
+    format = Format::kFloat16;
+    return true;
+  }
+  return false;
+}
+
+void PackedGatherTable::PrefetchRow(int64_t row) const {
+  const size_t row_bytes = static_cast<size_t>(row_size_) * element_bytes_;
+  if (row_bytes >= kGatherPrefetchMinRowBytes) {
+    GatherPrefetchRow(RowData(row), row_bytes);
+  }
+}
+
+void PackedGatherTable::CopyRow(int64_t row, float* output) const {
+  if (format_ == Format::kFloat16) {
+    MlasConvertHalfToFloatBuffer(reinterpret_cast<const uint16_t*>(RowData(row)), output,
+                                 static_cast<size_t>(row_size_));
+    return;
+  }
+
+  const auto* input = reinterpret_cast<const int8_t*>(RowData(row));
+  const float scale = static_cast<const float*>(scales_.get())[row];
+  for (int64_t i = 0; i < row_size_; i++) {
+    output[i] = scale * static_cast<float>(input[i]);
+  }
+}
+
+void PackedGatherTable::AccumulateRow(int64_t row, float* output) const {
+  if (format_ == Format::kFloat16) {
+    // Widen the row in pieces small enough to stay on the stack.
+    constexpr int64_t kChunkSize = 256;
+    float buffer[kChunkSize];
+    const auto* input = reinterpret_cast<const uint16_t*>(RowData(row));
+    for (int64_t offset = 0; offset < row_size_; offset += kChunkSize) {
+      const int64_t count = std::min(kChunkSize, row_size_ - offset);
+      MlasConvertHalfToFloatBuffer(input + offset, buffer, static_cast<size_t>(count));
+      for (int64_t i = 0; i < count; i++) {
+        output[offset + i] += buffer[i];
+      }
+    }
+    return;
+  }
+
+  const auto* input = reinterpret_cast<const int8_t*>(RowData(row));
+  const float scale = static_cast<const float*>(scales_.get())[row];
+  for (int64_t i = 0; i < row_size_; i++) {
+    output[i] += scale * static_cast<float>(input[i]);
+  }
+}
+
+}  // namespace onnxruntime
@@ -0,0 +1,91 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <algorithm>
+
+#if defined(_MSC_VER) && (defined(_M_AMD64) || defined(_M_IX86))
+#include <xmmintrin.h>
+#endif
+
+#include "core/common/common.h"
+#include "core/framework/allocator.h"
+#include "core/framework/tensor.h"
+
+namespace onnxruntime {
+
+class OpKernelInfo;
+
+// Gather style kernels read rows at data dependent addresses which the hardware prefetchers cannot predict, so
+// the loops copying the rows prefetch the row needed a few iterations ahead.
+constexpr ptrdiff_t kGatherPrefetchDistance = 4;
+
+// Rows shorter than this are cheaper to copy than to prefetch.
+constexpr size_t kGatherPrefetchMinRowBytes = 64;
+
+// Issues prefetch hints for the leading cache lines of the row at address. The remainder of a long row is
+// picked up by the hardware prefetchers once the first lines are being read.
+inline void GatherPrefetchRow(const void* address, size_t row_bytes) {
+  constexpr size_t kCacheLineBytes = 64;
+  constexpr size_t kMaxPrefetchBytes = 1024;
+
+  const auto* row = static_cast<const char*>(address);
+  const size_t prefetch_bytes = std::min(row_bytes, kMaxPrefetchBytes);
+
+  for (size_t offset = 0; offset < prefetch_bytes; offset += kCacheLineBytes) {
+#if defined(_MSC_VER) && (defined(_M_AMD64) || defined(_M_IX86))
+    _mm_prefetch(row + offset, _MM_HINT_T0);
+#elif defined(__GNUC__)
+    __builtin_prefetch(row + offset, 0, 3);
+#else
+    ORT_UNUSED_PARAMETER(row);
+#endif
+  }
+}
+
+// A constant float tensor viewed as rows of row_size elements and stored with a narrower element type, so that
+// gathering a row reads less memory. Rows are widened back to float when they are read.
+class PackedGatherTable {
+ public:
+  enum class Format {
+    // Each element is rounded to float16. See kOrtSessionOptionsConfigUseFp16Initializers.
+    kFloat16,
+    // Each row is quantized to symmetric int8 with its own float scale.
+    // See kOrtSessionOptionsConfigQuantizeGatherTables.
+    kInt8,
+  };
+
+  PackedGatherTable(const float* data, int64_t row_count, int64_t row_size, Format format,
+                    const AllocatorPtr& alloc);
+
+  // Returns the format in which the CPU execution provider running the kernel described by info stores constant
+  // gather tables, or false if they are kept as float.
+  static bool GetFormat(const OpKernelInfo& info, Format& format);
+
+  int64_t RowCount() const { return row_count_; }
+  int64_t RowSize() const { return row_size_; }
+
+  void PrefetchRow(int64_t row) const;
+
+  // Writes the row_size elements of row to output.
+  void CopyRow(int64_t row, float* output) const;
+
+  // Adds the row_size elements of row to output.
+  void AccumulateRow(int64_t row, float* output) const;
+
+ private:
+  const uint8_t* RowData(int64_t row) const {
+    return static_cast<const uint8_t*>(data_.get()) + row * row_size_ * element_bytes_;
+  }
+
+  int64_t row_count_;
+  int64_t row_size_;
+  Format format_;
+  size_t element_bytes_;
+  BufferUniquePtr data_;
+  // Scale of each row for Format::kInt8.
+  BufferUniquePtr scales_;
+};
+
+}  // namespace onnxruntime
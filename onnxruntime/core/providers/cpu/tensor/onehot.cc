@@ -91,7 +91,7 @@ Status PrepareOutputShape(const Tensor* indices, const int64_t depth_val, const
   const auto& indices_shape = indices->Shape();
   const auto& indices_dims = indices_shape.GetDims();
   const auto indices_num_dims = indices_shape.NumDimensions();
-  output_shape = indices_dims;
+  output_shape.assign(indices_dims.begin(), indices_dims.end());
 
   // output rank is always 1 more than the input rank as a new dimension is added to the input shape
   const auto output_rank = static_cast<int64_t>(indices_num_dims + 1);
@@ -24,14 +24,14 @@ class Reshape final : public OpKernel {
                 "A shape tensor must be a vector tensor.");
     auto nDims = static_cast<size_t>(shapeTensor->Shape()[0]);
     const auto* data = shapeTensor->template Data<int64_t>();
-    std::vector<int64_t> shape(data, data + nDims);
+    TensorShapeVector shape(data, data + nDims);
 
     const auto* X = context->Input<Tensor>(0);
     const TensorShape& X_shape = X->Shape();
 
     ReshapeHelper helper(X_shape, shape);
 
-    Tensor* Y = context->Output(0, TensorShape(shape));
+    Tensor* Y = context->Output(0, TensorShape(std::move(shape)));
 
     CopyCpuTensor(X, Y);
 
@@ -47,13 +47,13 @@ class Reshape_1 final : public OpKernel {
   }
 
   Status Compute(OpKernelContext* context) const override {
-    std::vector<int64_t> shape = shape_;
+    TensorShapeVector shape(shape_.begin(), shape_.end());
     const auto* X = context->Input<Tensor>(0);
     const TensorShape& X_shape = X->Shape();
 
     ReshapeHelper helper(X_shape, shape);
 
-    Tensor* Y = context->Output(0, TensorShape(shape));
+    Tensor* Y = context->Output(0, TensorShape(std::move(shape)));
 
     CopyCpuTensor(X, Y);
 
@@ -9,10 +9,12 @@
 
 namespace onnxruntime {
 
-// Verify and convert unknown dim during reshape
+// Verify and convert unknown dim during reshape.
+// The requested shape is updated in place, so callers can keep it in a TensorShapeVector and move it into the
+// output shape without a heap allocation.
 class ReshapeHelper {
  public:
-  ReshapeHelper(const TensorShape& input_shape, std::vector<int64_t>& requested_shape) {
+  ReshapeHelper(const TensorShape& input_shape, gsl::span<int64_t> requested_shape) {
     auto nDims = requested_shape.size();
     ptrdiff_t unknown_dim = -1;
     int64_t size = 1;
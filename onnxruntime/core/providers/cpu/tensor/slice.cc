@@ -90,11 +90,11 @@ ONNX_CPU_OPERATOR_KERNEL(
 // Updates starts and steps to match flattened_output_dims if it is.
 // e.g. if input shape is { 2, 2, 2 }, output shape is { 1, 2, 2 }, and the 'steps' value for the last two dims is 1,
 // we are keeping all the data of the inner most two dimensions so can combine those into dims of { 1, 4 }
-static void FlattenOutputDims(const std::vector<int64_t>& input_dimensions,
-                              const std::vector<int64_t>& output_dims,
-                              std::vector<int64_t>& starts,
-                              std::vector<int64_t>& steps,
-                              std::vector<int64_t>*& flattened_output_dims) {
+static void FlattenOutputDims(gsl::span<const int64_t> input_dimensions,
+                              const TensorShapeVector& output_dims,
+                              TensorShapeVector& starts,
+                              TensorShapeVector& steps,
+                              TensorShapeVector*& flattened_output_dims) {
   int num_to_combine = 0;
   for (int64_t i = static_cast<int64_t>(starts.size()) - 1; i >= 0; --i) {
     // if we're keeping all the data for the dimension and not reversing the direction we can potentially combine it
@@ -131,7 +131,7 @@ Status SliceBase::PrepareForCompute(const std::vector<int64_t>& raw_starts,
                                     const std::vector<int64_t>& raw_axes,
                                     SliceOp::PrepareForComputeMetadata& compute_metadata) {
   // Initialize axes to the provided axes attribute or to the default sequence
-  std::vector<int64_t> axes(raw_axes);
+  TensorShapeVector axes(raw_axes.begin(), raw_axes.end());
   if (axes.empty()) {
     //axes are omitted, they are set to[0, ..., ndim - 1]
     axes.resize(compute_metadata.starts_.size());
@@ -139,15 +139,15 @@ Status SliceBase::PrepareForCompute(const std::vector<int64_t>& raw_starts,
   }
 
   // Iterate through the provided axes and override the start/end ranges
-  std::unordered_set<int64_t> unique_axes;
-  const auto& dimension_count = compute_metadata.input_dimensions_.size();
+  const auto dimension_count = compute_metadata.input_dimensions_.size();
+  InlinedVector<bool, kTensorShapeSmallBufferElementsSize> seen_axes(dimension_count, false);
   for (size_t axis_index = 0, axes_count = axes.size(); axis_index < axes_count; ++axis_index) {
     auto axis = HandleNegativeAxis(axes[axis_index], dimension_count);  // handle negative and enforce axis is valid
     if (axis >= static_cast<int64_t>(dimension_count) || axis < 0)
       return Status(ONNXRUNTIME, INVALID_ARGUMENT, "'axes' has an axis outside of the tensor dimension count");
-    if (unique_axes.find(axis) != unique_axes.end())
+    if (seen_axes[axis])
       return Status(ONNXRUNTIME, INVALID_ARGUMENT, "'axes' has duplicates");
-    unique_axes.insert(axis);
+    seen_axes[axis] = true;
 
     // process start
     auto start = raw_starts[axis_index];
@@ -181,7 +181,7 @@ Status SliceBase::PrepareForCompute(const std::vector<int64_t>& raw_starts,
                                     const std::vector<int64_t>& raw_steps,
                                     SliceOp::PrepareForComputeMetadata& compute_metadata) {
   // Initialize axes to the provided axes attribute or to the default sequence
-  std::vector<int64_t> axes(raw_axes);
+  TensorShapeVector axes(raw_axes.begin(), raw_axes.end());
 
   if (axes.empty()) {
     // axes are omitted, they are set to[0, ..., ndim - 1]
@@ -190,15 +190,15 @@ Status SliceBase::PrepareForCompute(const std::vector<int64_t>& raw_starts,
   }
 
   // Iterate through the provided axes and override the start/end/steps ranges
-  std::unordered_set<int64_t> unique_axes;
-  const auto& dimension_count = compute_metadata.input_dimensions_.size();
+  const auto dimension_count = compute_metadata.input_dimensions_.size();
+  InlinedVector<bool, kTensorShapeSmallBufferElementsSize> seen_axes(dimension_count, false);
   for (size_t axis_index = 0, axes_count = axes.size(); axis_index < axes_count; ++axis_index) {
     auto axis = axes[axis_index] < 0 ? axes[axis_index] + static_cast<int64_t>(dimension_count) : axes[axis_index];
     if (axis >= static_cast<int64_t>(dimension_count) || axis < 0)
       return Status(ONNXRUNTIME, INVALID_ARGUMENT, "'axes' has an axis outside of the tensor dimension count");
-    if (unique_axes.find(axis) != unique_axes.end())
+    if (seen_axes[axis])
       return Status(ONNXRUNTIME, INVALID_ARGUMENT, "'axes' has duplicates");
-    unique_axes.insert(axis);
+    seen_axes[axis] = true;
 
     // process step
     auto step = axis_index < raw_steps.size() ? raw_steps[axis_index] : 1;
@@ -339,7 +339,7 @@ static Status SliceImpl(OpKernelContext* ctx,
   if (compute_metadata.p_flattened_output_dims_) {
     // if we have flattened output dims we need to also flatten the input dims.
     // as we're combining the innermost dims and keeping all values we can just copy the size of the last dim
-    std::vector<int64_t> flattened_input_dims(input_tensor.Shape().GetDims());
+    TensorShapeVector flattened_input_dims = input_tensor.Shape().AsShapeVector();
     flattened_input_dims.resize(compute_metadata.p_flattened_output_dims_->size());
     flattened_input_dims.back() = compute_metadata.p_flattened_output_dims_->back();
     TensorShape input_shape(std::move(flattened_input_dims));
@@ -8,22 +8,23 @@
 namespace onnxruntime {
 
 namespace SliceOp {
+// The dimensions are held inline so that preparing a slice does not allocate for tensors of typical rank.
+// input_dimensions_ refers to the caller's dimensions, which must outlive the metadata.
 struct PrepareForComputeMetadata {
   PrepareForComputeMetadata() = delete;
-  PrepareForComputeMetadata(const std::vector<int64_t>& input_dimensions)
-      : input_dimensions_(input_dimensions) {
-    size_t dimension_count = input_dimensions.size();
-    starts_.resize(dimension_count, 0);
-    steps_.resize(dimension_count, 1);
-    output_dims_ = input_dimensions;
+  PrepareForComputeMetadata(gsl::span<const int64_t> input_dimensions)
+      : input_dimensions_(input_dimensions),
+        starts_(input_dimensions.size(), 0),
+        steps_(input_dimensions.size(), 1),
+        output_dims_(input_dimensions.begin(), input_dimensions.end()) {
   }
 
-  const std::vector<int64_t>& input_dimensions_;
-  std::vector<int64_t> starts_;
-  std::vector<int64_t> steps_;
-  std::vector<int64_t> output_dims_;
-  std::vector<int64_t> flattened_output_dims_;
-  std::vector<int64_t>* p_flattened_output_dims_ = &flattened_output_dims_;
+  gsl::span<const int64_t> input_dimensions_;
+  TensorShapeVector starts_;
+  TensorShapeVector steps_;
+  TensorShapeVector output_dims_;
+  TensorShapeVector flattened_output_dims_;
+  TensorShapeVector* p_flattened_output_dims_ = &flattened_output_dims_;
 };
 }  // namespace SliceOp
 
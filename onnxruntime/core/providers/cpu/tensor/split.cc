@@ -58,7 +58,7 @@ ONNX_CPU_OPERATOR_KERNEL(
 Status SplitBase::PrepareForCompute(const TensorShape& input_shape, int num_outputs, int64_t& axis, int& before_dims,
                                     int& after_dims_including_split_axis, int& after_dims_excluding_split,
                                     std::vector<int64_t>& split_sizes) const {
-  auto& input_dims = input_shape.GetDims();
+  const auto& input_dims = input_shape.GetDims();
   const auto num_dimensions = gsl::narrow_cast<int64_t>(input_shape.NumDimensions());
   axis = HandleNegativeAxis(axis_, num_dimensions);  // handle negative and enforce axis is valid
   const int64_t split_dim_size = input_dims[axis];
@@ -160,8 +160,8 @@ Status Split::ComputeImpl(OpKernelContext& context, const Tensor& input) const {
                                         split_sizes));
 
   // copy dimensions so we can update the selected axis in place
-  auto& input_dims = input_shape.GetDims();
-  std::vector<int64_t> output_dimensions{input_dims};
+  const auto& input_dims = input_shape.GetDims();
+  std::vector<int64_t> output_dimensions(input_dims.begin(), input_dims.end());
 
   int64_t input_offset = 0;
   const T* input_data = input.template Data<T>();
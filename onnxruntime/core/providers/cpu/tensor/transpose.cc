@@ -3,9 +3,13 @@
 
 #include "core/providers/cpu/tensor/transpose.h"
 
+#include <algorithm>
+#include <numeric>
+
 #include "core/framework/element_type_lists.h"
 #include "core/framework/utils.h"
 #include "core/mlas/inc/mlas.h"
+#include "core/platform/threadpool.h"
 #include "core/providers/op_kernel_type_control.h"
 #include "core/providers/op_kernel_type_control_utils.h"
 #include "utils.h"
@@ -74,7 +78,7 @@ struct MultiIndex {
 * be transposed, if source_dims is the shape, stride[i] = source_dims[i+1] * source_dims[i+2] * ... * 1.
 * element_size is the size of the tensor element (sizeof(float), sizeof(double)).
 */
-static void IncrementIndexAndComputeOffsetSetup(MultiIndex& mindex, size_t num_axes, const std::vector<int64_t>& target_dims,
+static void IncrementIndexAndComputeOffsetSetup(MultiIndex& mindex, size_t num_axes, gsl::span<const int64_t> target_dims,
                                                 const std::vector<size_t>& stride, size_t element_size) {
   mindex.Init(num_axes);
   size_t naxes = 0;
@@ -121,13 +125,6 @@ static inline void IncrementIndexAndComputeOffset(MultiIndex& mindex, const T*&
 
 // DoTransposeSingleBlock: specialization of DoTranspose for the num_blocks=1 case.
 // copies source tensor to target, transposing elements.
-static inline void DoTransposeSingleBlock(size_t num_elts_in_block, const void* source, void* target,
-                                          size_t element_size) {
-  size_t blocksize = num_elts_in_block * element_size;
-  // copy
-  memcpy(target, source, blocksize);
-}
-
 static inline void DoTransposeSingleBlock(size_t num_elts_in_block, const std::string* source, std::string* target) {
   const std::string* end = source + num_elts_in_block;
   std::copy(source, end, target);
@@ -135,23 +132,7 @@ static inline void DoTransposeSingleBlock(size_t num_elts_in_block, const std::s
 
 // DoTranspose: copies source tensor to target, transposing elements.
 // The stride vector indicates the transposition.
-static void DoTransposeImpl(int64_t num_axes, const std::vector<int64_t>& target_dims,
-                            size_t num_blocks, size_t num_elts_in_block, const std::vector<size_t>& stride,
-                            const uint8_t* source, uint8_t* target, size_t element_size) {
-  size_t blocksize = num_elts_in_block * element_size;
-  MultiIndex mindex;
-  IncrementIndexAndComputeOffsetSetup(mindex, num_axes, target_dims, stride, element_size);
-
-  const uint8_t* local_source = source;
-  for (size_t i = 0; i < num_blocks; ++i) {
-    ORT_ENFORCE((local_source >= source) && (local_source < source + num_blocks * blocksize));
-    memcpy(target, local_source, blocksize);
-    IncrementIndexAndComputeOffset(mindex, local_source);
-    target += blocksize;
-  }
-}
-
-static void DoTransposeImpl(int64_t num_axes, const std::vector<int64_t>& target_dims,
+static void DoTransposeImpl(int64_t num_axes, gsl::span<const int64_t> target_dims,
                             size_t num_blocks, size_t num_elts_in_block, const std::vector<size_t>& stride,
                             const std::string* source, std::string* target) {
   ORT_ENFORCE(num_axes > 0, "Transpose not implemented for empty tensors.");
@@ -174,7 +155,7 @@ inline void CopyPrim(uint8_t* target, const uint8_t* source) {
 
 // The function does not check num_axes > 0 but this is expected.
 template <class T>
-static bool TypedDoTransposeEltWise(int64_t num_axes, const std::vector<int64_t>& target_dims, size_t num_blocks,
+static bool TypedDoTransposeEltWise(int64_t num_axes, gsl::span<const int64_t> target_dims, size_t num_blocks,
                                     const std::vector<size_t>& stride, const uint8_t* source, uint8_t* target) {
   constexpr bool enabled = utils::HasTypeWithSameSize<EnabledDataTypes, T>();
 
@@ -197,7 +178,7 @@ static bool TypedDoTransposeEltWise(int64_t num_axes, const std::vector<int64_t>
 // DoTransposeEltWise: specialization of DoTranspose for the num_elts_in_block=1 case.
 // copies source tensor to target, transposing elements.
 // The stride vector indicates the transposition.
-Status DoTransposeEltWise(int64_t num_axes, const std::vector<int64_t>& target_dims, size_t num_blocks,
+Status DoTransposeEltWise(int64_t num_axes, gsl::span<const int64_t> target_dims, size_t num_blocks,
                           const std::vector<size_t>& stride, const uint8_t* source, uint8_t* target,
                           size_t element_size) {
   bool enabled = false;
@@ -224,7 +205,7 @@ Status DoTransposeEltWise(int64_t num_axes, const std::vector<int64_t>& target_d
                                    element_size);
 }
 
-static void DoTransposeEltWise(int64_t num_axes, const std::vector<int64_t>& target_dims, size_t num_blocks,
+static void DoTransposeEltWise(int64_t num_axes, gsl::span<const int64_t> target_dims, size_t num_blocks,
                                const std::vector<size_t>& stride, const std::string* source, std::string* target) {
   ORT_ENFORCE(num_axes > 0, "Transpose not implemented for empty tensors.");
   MultiIndex mindex;
@@ -240,16 +221,19 @@ static void DoTransposeEltWise(int64_t num_axes, const std::vector<int64_t>& tar
   }
 }
 
+// Transpose of std::string tensors. Tensors with fixed size elements use BlockedTranspose.
 //  `input_shape_override` overrides the shape of `input` for compute purposes.
-static Status DoUntypedTranspose(const std::vector<size_t>& permutations, const Tensor& input, Tensor& output,
-                                 const TensorShape* input_shape_override = nullptr) {
+static Status DoStringTranspose(const std::vector<size_t>& permutations, const Tensor& input, Tensor& output,
+                                const TensorShape* input_shape_override = nullptr) {
+  constexpr bool string_enabled = utils::HasType<EnabledDataTypes, std::string>();
+  if (!string_enabled) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Transpose of std::string is not supported in this build.");
+  }
+
   const auto& input_shape = input_shape_override ? *input_shape_override : input.Shape();
   const auto& input_dims = input_shape.GetDims();
   auto rank = input_shape.NumDimensions();
 
-  const auto element_size = input.DataType()->Size();
-  const bool is_string_type = input.IsDataTypeString();
-
   std::vector<size_t> stride(rank);
   for (size_t i = 0; i < rank; i++) {
     size_t inpdim = permutations[i];
@@ -277,385 +261,228 @@ static Status DoUntypedTranspose(const std::vector<size_t>& permutations, const
     }
   }
 
-  Status status = Status::OK();
-
-  if (is_string_type) {
-    constexpr bool string_enabled = utils::HasType<EnabledDataTypes, std::string>();
-
-    if (string_enabled) {
-      const auto* input_data = input.template Data<std::string>();
-      auto* output_data = output.template MutableData<std::string>();
-      if (1 == prefix_blocksize) {
-        DoTransposeSingleBlock(suffix_blocksize, input_data, output_data);
-      } else if (1 == suffix_blocksize) {
-        DoTransposeEltWise(num_axes_in_prefix, output.Shape().GetDims(), prefix_blocksize, stride,
-                           input_data, output_data);
-      } else {
-        DoTransposeImpl(num_axes_in_prefix, output.Shape().GetDims(), prefix_blocksize, suffix_blocksize, stride,
-                        input_data, output_data);
-      }
-    } else {
-      status = ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Transpose of std::string is not supported in this build.");
-    }
+  const auto* input_data = input.template Data<std::string>();
+  auto* output_data = output.template MutableData<std::string>();
+  if (1 == prefix_blocksize) {
+    DoTransposeSingleBlock(suffix_blocksize, input_data, output_data);
+  } else if (1 == suffix_blocksize) {
+    DoTransposeEltWise(num_axes_in_prefix, output.Shape().GetDims(), prefix_blocksize, stride,
+                       input_data, output_data);
   } else {
-    const auto* input_data = reinterpret_cast<const uint8_t*>(input.DataRaw());
-    auto* output_data = reinterpret_cast<uint8_t*>(output.MutableDataRaw());
-    if (1 == prefix_blocksize) {
-      DoTransposeSingleBlock(suffix_blocksize, input_data, output_data, element_size);
-    } else if (1 == suffix_blocksize) {
-      // this may return a failed status if the data size is not supported in this build
-      status = DoTransposeEltWise(num_axes_in_prefix, output.Shape().GetDims(), prefix_blocksize, stride,
-                                  input_data, output_data, element_size);
-    } else {
-      DoTransposeImpl(num_axes_in_prefix, output.Shape().GetDims(), prefix_blocksize, suffix_blocksize, stride,
-                      input_data, output_data, element_size);
-    }
+    DoTransposeImpl(num_axes_in_prefix, output.Shape().GetDims(), prefix_blocksize, suffix_blocksize, stride,
+                    input_data, output_data);
   }
 
-  return status;
+  return Status::OK();
 }
 
 /*
-Optimizations for moving a single axis either inwards or outwards.
-
-If moving outwards we can use a single reader and multiple writers. The number of writers is equal to the value of
-the axis being moved.
-
-  e.g. if the input is NHWC with shape {N, 300, 300, 3}, we can transpose to NCHW by reading once and having
-       one writer for each of the 3 channels at a different offset in the output, updating the offset for each item
-       in the batch of N.
+Blocked transpose of tensors with fixed size elements.
 
-Similarly if one axis is moving inwards we can use a single writer and multiple readers. The number of readers is equal
-to the value of the axis being moved.
+The size 1 axes are removed, and axes that are adjacent in both the input and the output are merged, so e.g. NCHW to
+NHWC, (0, 2, 3, 1), becomes (0, 2, 1) of {N, C, H*W}. If the innermost input axis stays innermost, its values are
+copied as a single element: (0, 2, 1, 3) of a {B, S, H, D} tensor moves elements of D values.
 
-  e.g. if the input is NCHW with shape {N, 3, 300, 300}, we can transpose to NHWC by writing once using one reader for
-       each of the 3 channels at a different offset in the input, updating the read offset for each item in the batch
-       of N.
-
-This can be generalized for any input where only one axis is being moved, with the block size for each read/write
-being dependent on which axis is moving, what direction it's moving in, and where it's moving to.
-
-We use simple pointer arithmetic if the size of each read/write is a power of 2 and between 8 and 64 bits.
-We use memcpy if the block size is larger.
-
-We fall back to the default implementation in all other cases, and if the input is std::string.
+The innermost input axis is then contiguous in the input and the innermost output axis is contiguous in the
+output, so each pair of them is a strided 2D transpose, which MLAS does in cache sized tiles of SIMD blocks. The 2D
+transposes for the remaining (outer) axes, and the row tiles within them, are run in parallel on the thread pool.
 */
 
 namespace {
 
-template <typename T>
-struct has_mlas_transpose : std::false_type {};
-
-template <>
-struct has_mlas_transpose<uint8_t> : std::true_type {};
+// Rows of the 2D transpose handled by one unit of work.
+constexpr int64_t kTransposeRowsPerUnit = 64;
 
-template <>
-struct has_mlas_transpose<uint32_t> : std::true_type {};
+// Remove the size 1 axes and merge the axes that stay adjacent.
+void MergeTransposeAxes(const std::vector<size_t>& permutations, gsl::span<const int64_t> input_dims,
+                        std::vector<int64_t>& merged_dims, std::vector<size_t>& merged_perm) {
+  const size_t rank = permutations.size();
 
-// moving a single axis outwards where the read/write size is a power of 2 and between 8 and 64 bits.
-template <typename T>
-typename std::enable_if<!has_mlas_transpose<T>::value, void>::type
-SimpleTransposeSingleAxisOutwards(const T* input_data, T* output_data,
-                                  int64_t num_loops, int64_t num_writers,
-                                  int64_t writes_per_loop, int64_t writes_per_writer_per_loop) {
-  const T* end;
-  for (int64_t l = 0; l < num_loops; ++l) {
-    T* output_for_first_writer = output_data;
-
-    for (auto wwpl = 0; wwpl < writes_per_writer_per_loop; ++wwpl) {
-      T* output_for_current_writer = output_for_first_writer;
-
-      end = input_data + num_writers;
-      for (; input_data != end;) {
-        *output_for_current_writer = *input_data++;
-
-        // skip to output position for next writer
-        output_for_current_writer += writes_per_writer_per_loop;
-      }
+  // index of each input axis once the size 1 axes are removed
+  std::vector<size_t> reduced_axis(rank, 0);
+  size_t reduced_rank = 0;
+  for (size_t i = 0; i < rank; ++i) {
+    if (input_dims[i] != 1) {
+      reduced_axis[i] = reduced_rank++;
+    }
+  }
 
-      ++output_for_first_writer;
+  // the output axes as runs of consecutive input axes, in output order
+  std::vector<size_t> run_first_axis;
+  std::vector<int64_t> run_size;
+  size_t previous_axis = 0;
+  for (size_t i = 0; i < rank; ++i) {
+    const size_t input_axis = permutations[i];
+    if (input_dims[input_axis] == 1) {
+      continue;
     }
 
-    output_data += writes_per_loop;
+    const size_t axis = reduced_axis[input_axis];
+    if (!run_first_axis.empty() && axis == previous_axis + 1) {
+      run_size.back() *= input_dims[input_axis];
+    } else {
+      run_first_axis.push_back(axis);
+      run_size.push_back(input_dims[input_axis]);
+    }
+    previous_axis = axis;
   }
-}
 
-template <typename T>
-typename std::enable_if<has_mlas_transpose<T>::value, void>::type
-SimpleTransposeSingleAxisOutwards(const T* input_data, T* output_data,
-                                  int64_t num_loops, int64_t num_writers,
-                                  int64_t writes_per_loop, int64_t writes_per_writer_per_loop) {
-  for (int64_t l = 0; l < num_loops; ++l) {
-    MlasTranspose(input_data,
-                  output_data,
-                  static_cast<size_t>(writes_per_writer_per_loop),
-                  static_cast<size_t>(num_writers));
-    input_data += writes_per_loop;
-    output_data += writes_per_loop;
+  // the runs in input order are the merged input axes
+  const size_t merged_rank = run_first_axis.size();
+  std::vector<size_t> input_order(merged_rank);
+  std::iota(input_order.begin(), input_order.end(), size_t{0});
+  std::sort(input_order.begin(), input_order.end(),
+            [&run_first_axis](size_t a, size_t b) { return run_first_axis[a] < run_first_axis[b]; });
+
+  merged_dims.resize(merged_rank);
+  merged_perm.resize(merged_rank);
+  for (size_t merged_axis = 0; merged_axis < merged_rank; ++merged_axis) {
+    const size_t run = input_order[merged_axis];
+    merged_dims[merged_axis] = run_size[run];
+    merged_perm[run] = merged_axis;
   }
 }
 
-//  `input_shape_override` overrides the shape of `input` for compute purposes.
-void TransposeSingleAxisOutwards(const std::vector<size_t>& permutations, const Tensor& input, Tensor& output,
-                                 int64_t from, int64_t to, const TensorShape* input_shape_override = nullptr) {
-  ORT_UNUSED_PARAMETER(permutations);
-
-  const auto& input_shape = input_shape_override ? *input_shape_override : input.Shape();
-  const auto& input_dims = input_shape.GetDims();
+// MLAS transpose of elements of type T. Returns false if no enabled type has the size of T, so the MLAS kernel is
+// only used in builds that need it.
+template <typename T>
+bool TypedStridedTranspose2D(const uint8_t* input, size_t input_stride, uint8_t* output, size_t output_stride,
+                             size_t rows, size_t columns) {
+  constexpr bool enabled = utils::HasTypeWithSameSize<EnabledDataTypes, T>();
 
-  const auto element_size = input.DataType()->Size();
+  if (enabled) {
+    MlasTranspose(reinterpret_cast<const T*>(input), input_stride,
+                  reinterpret_cast<T*>(output), output_stride, rows, columns);
+  }
 
-  const auto* input_data = reinterpret_cast<const uint8_t*>(input.DataRaw());
-  auto* output_data = reinterpret_cast<uint8_t*>(output.MutableDataRaw());
+  return enabled;
+}
 
-  auto num_loops = input_shape.SizeToDimension(to);
-  auto num_writers = input_dims[from];
-  auto block_size = input_shape.SizeFromDimension(from + 1);
-  auto writes_per_loop = int64_t(input_shape.Size() / num_loops / block_size);
-  auto writes_per_writer_per_loop = int64_t(writes_per_loop / num_writers);
-  const int64_t bytes_per_write = block_size * element_size;
-
-  switch (bytes_per_write) {
-    case (sizeof(uint8_t)): {
-      SimpleTransposeSingleAxisOutwards(input_data, output_data,
-                                        num_loops, num_writers, writes_per_loop, writes_per_writer_per_loop);
+// Transposes the rows x columns matrix at `input` with rows `input_stride` elements apart into `output` with rows
+// `output_stride` elements apart.
+void StridedTranspose2D(const uint8_t* input, size_t input_stride, uint8_t* output, size_t output_stride,
+                        size_t rows, size_t columns, size_t element_size) {
+  bool done = false;
+  switch (element_size) {
+    case sizeof(uint8_t):
+      done = TypedStridedTranspose2D<uint8_t>(input, input_stride, output, output_stride, rows, columns);
       break;
-    }
-    case (sizeof(uint16_t)): {
-      SimpleTransposeSingleAxisOutwards(reinterpret_cast<const uint16_t*>(input_data),
-                                        reinterpret_cast<uint16_t*>(output_data),
-                                        num_loops, num_writers, writes_per_loop, writes_per_writer_per_loop);
+    case sizeof(uint16_t):
+      done = TypedStridedTranspose2D<uint16_t>(input, input_stride, output, output_stride, rows, columns);
       break;
-    }
-    case (sizeof(uint32_t)): {
-      SimpleTransposeSingleAxisOutwards(reinterpret_cast<const uint32_t*>(input_data),
-                                        reinterpret_cast<uint32_t*>(output_data),
-                                        num_loops, num_writers, writes_per_loop, writes_per_writer_per_loop);
+    case sizeof(uint32_t):
+      done = TypedStridedTranspose2D<uint32_t>(input, input_stride, output, output_stride, rows, columns);
       break;
-    }
-    case (sizeof(uint64_t)): {
-      SimpleTransposeSingleAxisOutwards(reinterpret_cast<const uint64_t*>(input_data),
-                                        reinterpret_cast<uint64_t*>(output_data),
-                                        num_loops, num_writers, writes_per_loop, writes_per_writer_per_loop);
+    case sizeof(uint64_t):
+      done = TypedStridedTranspose2D<uint64_t>(input, input_stride, output, output_stride, rows, columns);
+      break;
+    default:
       break;
-    }
-    default: {
-      // we need to use memcpy for each block
-      for (int64_t l = 0; l < num_loops; ++l) {
-        uint8_t* output_for_first_writer = output_data;
-
-        for (auto wwpl = 0; wwpl < writes_per_writer_per_loop; ++wwpl) {
-          uint8_t* output_for_current_writer = output_for_first_writer;
-
-          for (int64_t w = 0; w < num_writers; ++w) {
-            memcpy(output_for_current_writer, input_data, bytes_per_write);
-            // skip to output position for next writer
-            output_for_current_writer += (writes_per_writer_per_loop * bytes_per_write);
-            input_data += bytes_per_write;
-          }
-
-          output_for_first_writer += bytes_per_write;
-        }
-
-        output_data += writes_per_loop * bytes_per_write;
-      }
-    }
   }
-}
 
-template <typename T>
-typename std::enable_if<!has_mlas_transpose<T>::value, void>::type
-SimpleTransposeSingleAxisInwards(const T* input_data, T* output_data,
-                                 int64_t num_loops, int64_t num_readers,
-                                 int64_t reads_per_loop, int64_t reads_per_reader_per_loop) {
-  T* end;
-  for (int64_t l = 0; l < num_loops; ++l) {
-    const T* input_for_first_reader = input_data;
-
-    for (auto rrpl = 0; rrpl < reads_per_reader_per_loop; ++rrpl) {
-      const T* input_for_current_reader = input_for_first_reader;
-
-      end = output_data + num_readers;
-      for (; output_data != end;) {
-        *output_data++ = *input_for_current_reader;
-        // skip to input position for next reader
-        input_for_current_reader += reads_per_reader_per_loop;
+  if (!done) {
+    // blocks of the innermost axis are large enough for memcpy to be efficient, and element sizes of merged axes
+    // that no enabled type has are also copied this way
+    for (size_t r = 0; r < rows; ++r) {
+      const uint8_t* source = input + r * input_stride * element_size;
+      uint8_t* target = output + r * element_size;
+      for (size_t c = 0; c < columns; ++c) {
+        memcpy(target, source, element_size);
+        source += element_size;
+        target += output_stride * element_size;
       }
-
-      ++input_for_first_reader;
     }
-
-    input_data += reads_per_loop;
   }
 }
 
-template <typename T>
-typename std::enable_if<has_mlas_transpose<T>::value, void>::type
-SimpleTransposeSingleAxisInwards(const T* input_data, T* output_data,
-                                 int64_t num_loops, int64_t num_readers,
-                                 int64_t reads_per_loop, int64_t reads_per_reader_per_loop) {
-  for (int64_t l = 0; l < num_loops; ++l) {
-    MlasTranspose(input_data,
-                  output_data,
-                  static_cast<size_t>(num_readers),
-                  static_cast<size_t>(reads_per_reader_per_loop));
-    input_data += reads_per_loop;
-    output_data += reads_per_loop;
-  }
-}
-
-// moving a single axis inwards where the read/write size is a power of 2 and between 8 and 64 bits.
 //  `input_shape_override` overrides the shape of `input` for compute purposes.
-void TransposeSingleAxisInwards(const std::vector<size_t>& permutations, const Tensor& input, Tensor& output,
-                                int64_t from, int64_t to, const TensorShape* input_shape_override = nullptr) {
-  ORT_UNUSED_PARAMETER(permutations);
-
+void BlockedTranspose(const std::vector<size_t>& permutations, const Tensor& input, Tensor& output,
+                      const TensorShape* input_shape_override, concurrency::ThreadPool* tp) {
   const auto& input_shape = input_shape_override ? *input_shape_override : input.Shape();
-  const auto& input_dims = input_shape.GetDims();
-
-  const auto element_size = input.DataType()->Size();
 
   const auto* input_data = reinterpret_cast<const uint8_t*>(input.DataRaw());
   auto* output_data = reinterpret_cast<uint8_t*>(output.MutableDataRaw());
 
-  auto num_loops = input_shape.SizeToDimension(from);
-  auto num_readers = input_dims[from];
-  auto block_size = input_shape.SizeFromDimension(to + 1);
-  auto reads_per_loop = int64_t(input_shape.Size() / num_loops / block_size);
-  auto reads_per_reader_per_loop = int64_t(reads_per_loop / num_readers);
-  const int64_t bytes_per_read = block_size * element_size;
-
-  switch (bytes_per_read) {
-    case (sizeof(uint8_t)): {
-      SimpleTransposeSingleAxisInwards(input_data, output_data,
-                                       num_loops, num_readers, reads_per_loop, reads_per_reader_per_loop);
-      break;
-    }
-    case (sizeof(uint16_t)): {
-      SimpleTransposeSingleAxisInwards(reinterpret_cast<const uint16_t*>(input_data),
-                                       reinterpret_cast<uint16_t*>(output_data),
-                                       num_loops, num_readers, reads_per_loop, reads_per_reader_per_loop);
-      break;
-    }
-    case (sizeof(uint32_t)): {
-      SimpleTransposeSingleAxisInwards(reinterpret_cast<const uint32_t*>(input_data),
-                                       reinterpret_cast<uint32_t*>(output_data),
-                                       num_loops, num_readers, reads_per_loop, reads_per_reader_per_loop);
-      break;
-    }
-    case (sizeof(uint64_t)): {
-      SimpleTransposeSingleAxisInwards(reinterpret_cast<const uint64_t*>(input_data),
-                                       reinterpret_cast<uint64_t*>(output_data),
-                                       num_loops, num_readers, reads_per_loop, reads_per_reader_per_loop);
-      break;
-    }
-    default: {
-      // we need to use memcpy for each block
-      for (int64_t l = 0; l < num_loops; ++l) {
-        const uint8_t* input_for_first_reader = input_data;
-
-        for (auto rrpl = 0; rrpl < reads_per_reader_per_loop; ++rrpl) {
-          const uint8_t* input_for_current_reader = input_for_first_reader;
+  std::vector<int64_t> dims;
+  std::vector<size_t> perm;
+  MergeTransposeAxes(permutations, input_shape.GetDims(), dims, perm);
 
-          for (int64_t r = 0; r < num_readers; ++r) {
-            memcpy(output_data, input_for_current_reader, bytes_per_read);
-            output_data += bytes_per_read;
-
-            // skip to input position for next reader
-            input_for_current_reader += (reads_per_reader_per_loop * bytes_per_read);
-          }
-
-          input_for_first_reader += bytes_per_read;
-        }
-
-        input_data += reads_per_loop * bytes_per_read;
-      }
-    }
+  size_t element_size = input.DataType()->Size();
+  if (!perm.empty() && perm.back() == perm.size() - 1) {
+    element_size *= static_cast<size_t>(dims.back());
+    dims.pop_back();
+    perm.pop_back();
   }
-}
 
-//  `input_shape_override` overrides the shape of `input` for compute purposes.
-void SingleAxisTranspose(const std::vector<size_t>& permutations, const Tensor& input, Tensor& output,
-                         size_t from, size_t to, const TensorShape* input_shape_override = nullptr) {
-  if (from > to) {
-    TransposeSingleAxisOutwards(permutations, input, output, from, to, input_shape_override);
-  } else {
-    TransposeSingleAxisInwards(permutations, input, output, from, to, input_shape_override);
+  const size_t rank = perm.size();
+  if (rank < 2) {
+    memcpy(output_data, input_data, input_shape.Size() * input.DataType()->Size());
+    return;
   }
-}
-
-bool IsMovingSingleAxis(const std::vector<size_t>& permutations, size_t& from, size_t& to) {
-  // if a single axis moved to an outer dimension, the values should be one lower than the index until the slot the
-  // axis was moved from, and equal to the index after that.
-  // e.g. axis 3 moves out to 1 would be: 0, 3, 1, 2, 4
-  auto check_moved_outwards = [&permutations](size_t cur, size_t moved_from) {
-    // we start processing with the slot after the moved one, so the expected value is one less than the index
-    size_t expected = cur - 1;
-    for (size_t end = permutations.size(); cur < end; ++cur) {
-      if (permutations[cur] != expected) {
-        return false;
-      }
-
-      // we are at the slot the axis moved from, so do an additional increment before checking the next value
-      if (cur == moved_from) {
-        ++expected;
-      }
 
-      ++expected;
-    }
-
-    return true;
-  };
-
-  // if a single axis moved to an inner dimension, the values should be one higher than the index until the slot the
-  // axis was moved to, and equal to the index after that.
-  // e.g. axis 1 moves inwards to 3 would be: 0, 2, 3, 1, 4
-  auto check_moved_inwards = [&permutations](size_t cur, size_t& moved_to) {
-    size_t started_at = cur;
-    size_t expected = cur + 1;
-    moved_to = std::numeric_limits<size_t>::max();
-
-    for (size_t end = permutations.size(); cur < end; ++cur) {
-      if (permutations[cur] != expected) {
-        // if a single axis moved it must have come from the location we started at
-        if (started_at != permutations[cur]) {
-          return false;
-        }
-
-        moved_to = cur;
-      } else {
-        ++expected;
-      }
-    }
-
-    return moved_to != std::numeric_limits<size_t>::max();
-  };
-
-  bool single_axis_moved = false;
-  // check axis moving outwards (earlier entry in permutations)
-  for (size_t i = 0, end = permutations.size(); i < end; ++i) {
-    size_t axis = permutations[i];
-
-    if (axis != i) {
-      if (check_moved_outwards(i + 1, axis)) {
-        single_axis_moved = true;
-        to = i;
-        from = axis;
-      } else if (check_moved_inwards(i, to)) {
-        single_axis_moved = true;
-        from = i;
-      }
+  std::vector<size_t> input_strides(rank);
+  std::vector<size_t> output_strides(rank);
+  size_t input_stride = 1;
+  size_t output_stride = 1;
+  for (size_t i = rank; i-- > 0;) {
+    input_strides[i] = input_stride;
+    input_stride *= static_cast<size_t>(dims[i]);
+    output_strides[i] = output_stride;
+    output_stride *= static_cast<size_t>(dims[perm[i]]);
+  }
 
-      break;
+  // The innermost output axis supplies the rows of the 2D transpose, and the innermost input axis the columns.
+  const size_t row_axis = perm[rank - 1];
+  const size_t column_output_axis = static_cast<size_t>(std::find(perm.begin(), perm.end(), rank - 1) - perm.begin());
+  const auto rows = dims[row_axis];
+  const auto columns = static_cast<size_t>(dims[rank - 1]);
+  const size_t row_stride = input_strides[row_axis];
+  const size_t column_stride = output_strides[column_output_axis];
+
+  // The other output axes, outermost first.
+  std::vector<int64_t> outer_dims;
+  std::vector<size_t> outer_input_strides;
+  std::vector<size_t> outer_output_strides;
+  int64_t num_outer = 1;
+  for (size_t i = 0; i < rank - 1; ++i) {
+    if (i != column_output_axis) {
+      outer_dims.push_back(dims[perm[i]]);
+      outer_input_strides.push_back(input_strides[perm[i]]);
+      outer_output_strides.push_back(output_strides[i]);
+      num_outer *= dims[perm[i]];
     }
   }
 
-  return single_axis_moved;
+  const int64_t row_units = (rows + kTransposeRowsPerUnit - 1) / kTransposeRowsPerUnit;
+  const double bytes_per_unit = static_cast<double>(std::min(rows, kTransposeRowsPerUnit) * columns * element_size);
+
+  concurrency::ThreadPool::TryParallelFor(
+      tp, num_outer * row_units, TensorOpCost{bytes_per_unit, bytes_per_unit, bytes_per_unit},
+      [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+        for (std::ptrdiff_t unit = first; unit < last; ++unit) {
+          int64_t outer = unit / row_units;
+          const int64_t row = (unit % row_units) * kTransposeRowsPerUnit;
+
+          size_t input_offset = static_cast<size_t>(row) * row_stride;
+          size_t output_offset = static_cast<size_t>(row);
+          for (size_t i = outer_dims.size(); i-- > 0;) {
+            const auto index = static_cast<size_t>(outer % outer_dims[i]);
+            outer /= outer_dims[i];
+            input_offset += index * outer_input_strides[i];
+            output_offset += index * outer_output_strides[i];
+          }
+
+          StridedTranspose2D(input_data + input_offset * element_size, row_stride,
+                             output_data + output_offset * element_size, column_stride,
+                             static_cast<size_t>(std::min(kTransposeRowsPerUnit, rows - row)), columns,
+                             element_size);
+        }
+      });
 }
 
 }  // namespace
 
-bool IsTransposeReshape(const std::vector<size_t>& perm, const std::vector<int64_t>& input_dims) {
+bool IsTransposeReshape(const std::vector<size_t>& perm, gsl::span<const int64_t> input_dims) {
   // As long as the dims with values > 1 stay in the same order, it's a reshape.
   // Example: Shape=(1,1,1024,4096) -> perm=(2,0,3,1).
   size_t last_permuted_axis = 0;
@@ -671,7 +498,7 @@ bool IsTransposeReshape(const std::vector<size_t>& perm, const std::vector<int64
 
 //`input_shape_override` overrides the shape of `input` for compute purposes.
 Status TransposeBase::DoTranspose(const std::vector<size_t>& permutations, const Tensor& input, Tensor& output,
-                                  const TensorShape* input_shape_override) {
+                                  const TensorShape* input_shape_override, concurrency::ThreadPool* tp) {
   Status status = Status::OK();
 
   auto input_type = input.DataType();
@@ -689,14 +516,10 @@ Status TransposeBase::DoTranspose(const std::vector<size_t>& permutations, const
       return Status::OK();
     }
 
-    size_t from = 0, to = 0;
-    bool moving_single_axis = IsMovingSingleAxis(permutations, from, to);
-
-    if (moving_single_axis && !input.IsDataTypeString()) {
-      SingleAxisTranspose(permutations, input, output, from, to, input_shape_override);
+    if (!input.IsDataTypeString()) {
+      BlockedTranspose(permutations, input, output, input_shape_override, tp);
     } else {
-      // fall back to default implementation
-      status = DoUntypedTranspose(permutations, input, output, input_shape_override);
+      status = DoStringTranspose(permutations, input, output, input_shape_override);
     }
   }
 
@@ -708,7 +531,7 @@ Status Transpose::Compute(OpKernelContext* ctx) const {
   ORT_ENFORCE(input_tensor_ptr != nullptr);
   const Tensor& X = *input_tensor_ptr;
   const TensorShape& input_shape = X.Shape();
-  const std::vector<int64_t>& input_dims = input_shape.GetDims();
+  const auto& input_dims = input_shape.GetDims();
   size_t rank = input_dims.size();
 
   std::vector<int64_t> output_dims(rank);
@@ -724,24 +547,7 @@ Status Transpose::Compute(OpKernelContext* ctx) const {
   if (output_shape.Size() == 0)
     return Status::OK();
 
-  if (IsTransposeReshape(*p_perm, input_dims)) {
-    // As long as the dims with values > 1 stay in the same order, it's a reshape.
-    // Example: Shape=(1,1,1024,4096) -> perm=(2,0,3,1).
-    CopyCpuTensor(&X, &Y);
-    return Status::OK();
-  }
-
-  size_t from = 0, to = 0;
-  bool moving_single_axis = IsMovingSingleAxis(*p_perm, from, to);
-
-  if (moving_single_axis && !X.IsDataTypeString()) {
-    SingleAxisTranspose(*p_perm, X, Y, from, to);
-  } else {
-    // fall back to default implementation
-    status = DoUntypedTranspose(*p_perm, X, Y);
-  }
-
-  return status;
+  return DoTranspose(*p_perm, X, Y, nullptr, ctx->GetOperatorThreadPool());
 }
 
 ONNX_CPU_OPERATOR_VERSIONED_KERNEL(
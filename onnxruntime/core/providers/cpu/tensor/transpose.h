@@ -14,10 +14,10 @@ namespace onnxruntime {
  empty dimensions can change place, not empty dimensions must be in
  the same order in the permuted tenosr.
 */
-bool IsTransposeReshape(const std::vector<size_t>& perm, const std::vector<int64_t>& input_dims);
+bool IsTransposeReshape(const std::vector<size_t>& perm, gsl::span<const int64_t> input_dims);
 
 // Public function for element-wise transpose, primarily to unit test any out of bounds access
-Status DoTransposeEltWise(int64_t num_axes, const std::vector<int64_t>& target_dims, size_t num_blocks,
+Status DoTransposeEltWise(int64_t num_axes, gsl::span<const int64_t> target_dims, size_t num_blocks,
                           const std::vector<size_t>& stride, const uint8_t* source, uint8_t* target,
                           size_t element_size);
 
@@ -26,9 +26,11 @@ class TransposeBase {
   /**
   Transpose the input Tensor into the output Tensor using the provided permutations.
   Both Tensors must have the same data type. `input_shape_override` overrides the shape of `input` for compute purposes.
+  If `tp` is provided, large transposes are split across its threads.
   */
   static Status DoTranspose(const std::vector<size_t>& permutations, const Tensor& input, Tensor& output,
-                            const TensorShape* input_shape_override = nullptr);
+                            const TensorShape* input_shape_override = nullptr,
+                            concurrency::ThreadPool* tp = nullptr);
 
  protected:
   TransposeBase(const OpKernelInfo& info) {
@@ -100,7 +100,7 @@ std::unique_ptr<Tensor> Diagonal(const Tensor& input, int64_t dim_1, int64_t dim
   }
 
   // Make a copy - we are going to mutate the dims
-  std::vector<int64_t> output_dims = input_dims;
+  std::vector<int64_t> output_dims(input_dims.begin(), input_dims.end());
 
   // Remove the dim value in `second_dim` -
   // The diagonal values are stored along `first_dim`
@@ -97,7 +97,7 @@ Status SliceOutUnwantedOutputSection(cudaStream_t stream,
   SliceBase::PrepareForCompute(starts, ends, axes, compute_metadata);
 
   // As a sanity check, ensure that the slice operator's output shape matches with the expected output shape
-  ORT_ENFORCE(compute_metadata.output_dims_ == output_dims);
+  ORT_ENFORCE(gsl::make_span(compute_metadata.output_dims_) == gsl::make_span(output_dims));
 
   return SliceCuda::Impl(stream, input_data, input_dims, output_data, compute_metadata, element_size);
 }
@@ -113,7 +113,7 @@ Status Conv<T>::UpdateState(OpKernelContext* context, bool bias_expected) const
   //set W
   const Tensor* W = context->Input<Tensor>(1);
   const TensorShape& w_shape = W->Shape();
-  std::vector<int64_t> w_dims = w_shape.GetDims();
+  std::vector<int64_t> w_dims = w_shape.GetDimsAsVector();
   s_.w_data = reinterpret_cast<const CudaT*>(W->template Data<T>());
   //set B
   if (context->InputCount() >= 3) {
@@ -125,16 +125,16 @@ Status Conv<T>::UpdateState(OpKernelContext* context, bool bias_expected) const
   //set Z
   if (context->InputCount() >= 4) {
     const Tensor* Z = context->Input<Tensor>(3);
-    ORT_RETURN_IF_ERROR(s_.z_tensor.Set(Z->Shape().GetDims(), CudnnTensor::GetDataType<CudaT>()));
+    ORT_RETURN_IF_ERROR(s_.z_tensor.Set(Z->Shape().GetDimsAsVector(), CudnnTensor::GetDataType<CudaT>()));
     s_.z_data = reinterpret_cast<const CudaT*>(Z->template Data<T>());
   } else {
     s_.z_data = nullptr;
   }
-  bool input_dims_changed = (s_.last_x_dims != x_dims);
+  bool input_dims_changed = (gsl::make_span(s_.last_x_dims) != x_dims);
   bool w_dims_changed = (s_.last_w_dims != w_dims);
   if (input_dims_changed || w_dims_changed) {
     if (input_dims_changed)
-      s_.last_x_dims = x_dims;
+      s_.last_x_dims.assign(x_dims.begin(), x_dims.end());
 
     if (w_dims_changed) {
       s_.last_w_dims = w_dims;
@@ -204,7 +204,7 @@ Status Conv<T>::UpdateState(OpKernelContext* context, bool bias_expected) const
       s_.y_data = reinterpret_cast<CudaT*>(s_.Y->template MutableData<T>());
     }
 
-    std::vector<int64_t> x_dims_cudnn = x_dims;
+    std::vector<int64_t> x_dims_cudnn(x_dims.begin(), x_dims.end());
     std::vector<int64_t> y_dims_cudnn = !post_slicing_required ? y_dims : y_dims_with_adjusted_pads;
     if (rank < 2) {
       // cudnn only takes 4D or 5D input, so pad dimensions if needed
@@ -71,7 +71,7 @@ Status LRN<T>::ComputeInternal(OpKernelContext* context) const {
   Tensor* Y = context->Output(0, X->Shape());
 
   CudnnTensor x_tensor;
-  ORT_RETURN_IF_ERROR(x_tensor.Set(X->Shape().GetDims(), CudnnTensor::GetDataType<CudaT>()));
+  ORT_RETURN_IF_ERROR(x_tensor.Set(X->Shape().GetDimsAsVector(), CudnnTensor::GetDataType<CudaT>()));
 
   const auto one = Consts<CudaT>::One;
   const auto zero = Consts<CudaT>::Zero;
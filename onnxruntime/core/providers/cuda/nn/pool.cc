@@ -153,7 +153,7 @@ Status Pool<T, PoolType>::ComputeInternal(OpKernelContext* context) const {
   auto x_data = reinterpret_cast<const CudaT*>(X->template Data<T>());
   auto y_data = reinterpret_cast<CudaT*>(Y->template MutableData<T>());
 
-  std::vector<int64_t> x_dims_cudnn = x_dims;
+  std::vector<int64_t> x_dims_cudnn(x_dims.begin(), x_dims.end());
   std::vector<int64_t> y_dims_cudnn = y_dims;
   if (kernel_shape.size() < 2) {
     // cudnn only takes 4D or 5D input, so pad dimensions if needed
@@ -172,7 +172,7 @@ Status ReduceKernel<allow_multi_axes>::ReduceKernelShared(
   }
 
   // CUDNN requires at least 3D input, so pad 1s if needed
-  std::vector<int64_t> input_dims_cudnn = input_dims;
+  std::vector<int64_t> input_dims_cudnn(input_dims.begin(), input_dims.end());
   std::vector<int64_t> output_dims_cudnn = output_dims;
   if (rank < 3) {
     std::vector<int64_t> pads(3 - rank, 1);
@@ -359,7 +359,7 @@ Status PrepareForReduce(const Tensor* X,
   std::vector<bool> reduced(rank, false);
   prepare_reduce_metadata.output_dims.reserve(input_dims.size());
   if (axes.size() > 0) {
-    prepare_reduce_metadata.output_dims = input_dims;
+    prepare_reduce_metadata.output_dims.assign(input_dims.begin(), input_dims.end());
     for (auto axis : axes) {
       axis = HandleNegativeAxis(axis, rank);
       ORT_ENFORCE(input_dims[axis] != 0,
@@ -395,7 +395,7 @@ Status PrepareForReduce(const Tensor* X,
   }
 
   // CUDNN requires at least 3D input, so pad 1s if needed
-  prepare_reduce_metadata.input_dims_cudnn = input_dims;
+  prepare_reduce_metadata.input_dims_cudnn.assign(input_dims.begin(), input_dims.end());
   prepare_reduce_metadata.output_dims_cudnn = prepare_reduce_metadata.output_dims;
   if (rank < 3) {
     std::vector<int64_t> pads(3 - rank, 1);
@@ -12,6 +12,7 @@
 
 #include "core/common/common.h"
 #include "core/providers/cuda/shared_inc/fast_divmod.h"
+#include "gsl/gsl"
 
 namespace onnxruntime {
 namespace cuda {
@@ -59,7 +60,10 @@ struct TArray {
         "TArray size must be within range [0, ", capacity, "]. Actual: ", size);
   }
 
-  TArray(const std::vector<T>& vec) : TArray(static_cast<int32_t>(vec.size())) {
+  TArray(const std::vector<T>& vec) : TArray(gsl::make_span(vec)) {
+  }
+
+  TArray(gsl::span<const T> vec) : TArray(static_cast<int32_t>(vec.size())) {
 // std::is_trivially_copyable is not implemented in older versions of GCC
 #if !defined(__GNUC__) || __GNUC__ >= 5
     static_assert(std::is_trivially_copyable<T>::value, "T must be trivially copyable.");
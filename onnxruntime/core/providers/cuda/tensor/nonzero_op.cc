@@ -52,13 +52,13 @@ NONZERO_TYPED_KERNEL(float)
 
 template <typename T>
 Status NonZero<T>::ComputeInternal(OpKernelContext* context) const {
-  static const std::vector<int64_t> kScalarDims = {1};
+  static const int64_t kScalarDims[] = {1};
   const auto x = context->Input<Tensor>(0);
 
   int nonzero_elements = 0;
   const auto& x_shape = x->Shape();
   const int x_rank = x_shape.IsScalar() ? 1 : static_cast<int>(x_shape.NumDimensions());
-  const std::vector<int64_t>& x_dims = (x_shape.IsScalar()) ? kScalarDims : x_shape.GetDims();
+  const gsl::span<const int64_t> x_dims = (x_shape.IsScalar()) ? gsl::make_span(kScalarDims) : x_shape.GetDims();
   const int64_t x_size = x_shape.Size();
   if (x_size > 0) {
     auto x_data = reinterpret_cast<const typename ToCudaType<T>::MappedType*>(x->template Data<T>());
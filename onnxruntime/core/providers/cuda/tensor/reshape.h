@@ -23,14 +23,14 @@ class Reshape final : public CudaKernel {
     if (shapeTensor->Shape().NumDimensions() != 1) return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "A shape tensor must be a vector tensor, got ", shapeTensor->Shape().NumDimensions(), " dimensions");
     size_t nDims = static_cast<size_t>(shapeTensor->Shape()[0]);
     const int64_t* data = shapeTensor->template Data<int64_t>();
-    std::vector<int64_t> shape(data, data + nDims);
+    TensorShapeVector shape(data, data + nDims);
     const Tensor* X = context->Input<Tensor>(0);
     if (X == nullptr) return Status(common::ONNXRUNTIME, common::FAIL, "input count mismatch");
     const TensorShape& X_shape = X->Shape();
 
     ReshapeHelper helper(X_shape, shape);
 
-    Tensor* Y = context->Output(0, TensorShape(shape));
+    Tensor* Y = context->Output(0, TensorShape(std::move(shape)));
     const void* source = X->DataRaw();
     void* target = Y->MutableDataRaw();
     //If source and target pointers are not equal (non-inplace operation), we need to copy the data.
@@ -50,13 +50,13 @@ class Reshape_1 final : public CudaKernel {
   }
 
   Status ComputeInternal(OpKernelContext* context) const override {
-    std::vector<int64_t> shape = shape_;
+    TensorShapeVector shape(shape_.begin(), shape_.end());
     const Tensor* X = context->Input<Tensor>(0);
     const TensorShape& X_shape = X->Shape();
 
     ReshapeHelper helper(X_shape, shape);
 
-    Tensor* Y = context->Output(0, TensorShape(shape));
+    Tensor* Y = context->Output(0, TensorShape(std::move(shape)));
     const void* source = X->DataRaw();
     void* target = Y->MutableDataRaw();
     //If source and target pointers are not equal (non-inplace operation), we need to copy the data.
@@ -421,7 +421,7 @@ namespace Dml
 
                 onnxruntime::Tensor* tensor = kernelContext->Output(
                     static_cast<int>(i), 
-                    onnxruntime::TensorShape::ReinterpretBaseType(outputDims)
+                    onnxruntime::TensorShape(outputDims)
                     );
 
                 uint64_t allocId;
@@ -163,7 +163,7 @@ class DnnlRelu : public DnnlKernel {
     }
 
     if (mklnode_ptr_->output_index >= 0) {
-      auto& y_dims = primitive_dst_shape_.GetDims();
+      const auto& y_dims = primitive_dst_shape_.GetDims();
       // Allocate memory for output bufffer
       OrtValue* output = ort.KernelContext_GetOutput(context, mklnode_ptr_->output_index, &y_dims[0], static_cast<int>(primitive_dst_shape_.GetDims().size()));
       T* dst_data = ort.GetTensorMutableData<T>(output);
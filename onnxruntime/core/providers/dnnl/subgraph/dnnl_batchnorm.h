@@ -61,10 +61,10 @@ class BatchNormHelper {
 
   static void NormalizeDims(const TensorShape& x_shape, std::vector<int64_t>& new_dims) {
     new_dims.clear();
-    auto& orig_dims = x_shape.GetDims();
+    const auto& orig_dims = x_shape.GetDims();
     if (orig_dims.size() == 4 /*supported size by CUDA*/ ||
         orig_dims.size() == 5 /*supported size by CUDA*/) {
-      new_dims = orig_dims;
+      new_dims.assign(orig_dims.begin(), orig_dims.end());
       return;
     }
 
@@ -393,7 +393,7 @@ class DnnlBatchNorm : public DnnlKernel {
     MEMCPY_S(&scale_shift_buf[scale_dims_mkl[0]], b_data, src_bytes, dst_bytes);
 
     if (mklnode_ptr_->output_index >= 0) {
-      auto& y_dims = primitive_dst_shape_.GetDims();
+      const auto& y_dims = primitive_dst_shape_.GetDims();
       // Allocate memory for output bufffer
       OrtValue* output = ort.KernelContext_GetOutput(context, mklnode_ptr_->output_index, &y_dims[0], static_cast<int>(primitive_dst_shape_.GetDims().size()));
       T* dst_data = ort.GetTensorMutableData<T>(output);
@@ -577,7 +577,7 @@ class DnnlConvBatchNorm : public DnnlKernel {
     }
 
     if (mklnode_ptr_->output_index >= 0) {
-      auto& y_dims = primitive_dst_shape_.GetDims();
+      const auto& y_dims = primitive_dst_shape_.GetDims();
       // Allocate memory for output bufffer
       OrtValue* output = ort.KernelContext_GetOutput(context, mklnode_ptr_->output_index, &y_dims[0], static_cast<int>(primitive_dst_shape_.GetDims().size()));
       T* dst_data = ort.GetTensorMutableData<T>(output);
@@ -713,7 +713,7 @@ class DnnlConvBatchNorm : public DnnlKernel {
         }
       }
     } else {
-      auto& weight_dims = weight_shape.GetDims();
+      const auto& weight_dims = weight_shape.GetDims();
       kernel_shape = std::vector<int64_t>(weight_dims.begin() + 2, weight_dims.end());
     }
 
@@ -429,7 +429,7 @@ class DnnlConvGrad : public DnnlKernel {
 
     if (mklnode_ptr_->output_index >= 0) {
       // Allocate memory for output buffers
-      auto& dx_dims = primitive_dst_shape_.GetDims();
+      const auto& dx_dims = primitive_dst_shape_.GetDims();
       OrtValue* dx_output = ort.KernelContext_GetOutput(context, 0, &dx_dims[0], static_cast<int>(dx_dims.size()));
       T* diff_src_data = ort.GetTensorMutableData<T>(dx_output);
 
@@ -443,7 +443,7 @@ class DnnlConvGrad : public DnnlKernel {
         reorder_dst_mem_to_->set_data_handle(diff_src_data);
       }
 
-      auto& dw_dims = diff_weights_shape_.GetDims();
+      const auto& dw_dims = diff_weights_shape_.GetDims();
       OrtValue* dw_output = ort.KernelContext_GetOutput(context, 1, &dw_dims[0], static_cast<int>(dw_dims.size()));
       T* dw_data = ort.GetTensorMutableData<T>(dw_output);
       if (!gpu_available_) {
@@ -452,7 +452,7 @@ class DnnlConvGrad : public DnnlKernel {
         diff_weights_reorder_mem_to_->set_data_handle(dw_data);
       }
 
-      auto& db_dims = diff_bias_shape_.GetDims();
+      const auto& db_dims = diff_bias_shape_.GetDims();
       OrtValue* db_output = ort.KernelContext_GetOutput(context, 2, &db_dims[0], static_cast<int>(db_dims.size()));
       T* db_data = ort.GetTensorMutableData<T>(db_output);
       if (!gpu_available_) {
@@ -600,7 +600,7 @@ class DnnlConvGrad : public DnnlKernel {
         }
       }
     } else {
-      auto& weight_dims = weight_shape.GetDims();
+      const auto& weight_dims = weight_shape.GetDims();
       kernel_shape = std::vector<int64_t>(weight_dims.begin() + 2, weight_dims.end());
     }
 
@@ -283,7 +283,7 @@ class DnnlMatmul : public DnnlKernel {
     }
 
     if (mklnode_ptr_->output_index >= 0) {
-      auto& y_dims = primitive_dst_shape_.GetDims();
+      const auto& y_dims = primitive_dst_shape_.GetDims();
       // Allocate memory for output buffer
       OrtValue* output = ort.KernelContext_GetOutput(context, mklnode_ptr_->output_index, &y_dims[0], static_cast<int>(primitive_dst_shape_.GetDims().size()));
       T* dst_data = ort.GetTensorMutableData<T>(output);
@@ -327,21 +327,21 @@ class DnnlMatmul : public DnnlKernel {
   IAllocatorUniquePtr<void> src_reorder_buffer_;
 
   void InferOutputShape(const TensorShape& input_shape, const TensorShape& weight_shape, std::vector<int64_t>& output_shape) const {
-    output_shape = input_shape.GetDims();
+    output_shape = input_shape.GetDimsAsVector();
     output_shape.pop_back();
-    output_shape.emplace_back(weight_shape.GetDims().back());
+    output_shape.emplace_back(weight_shape[weight_shape.NumDimensions() - 1]);
   }
 
   void AdjustSrcWeightsShape(TensorShape& input_shape, TensorShape& weights_shape) const {
     
     if (input_shape.NumDimensions() > weights_shape.NumDimensions()) {
-      auto dims = weights_shape.GetDims();
+      auto dims = weights_shape.GetDimsAsVector();
       for (size_t i = 0; i < input_shape.NumDimensions() - weights_shape.NumDimensions(); i++) {
         dims.insert(dims.begin(), 1);
       }
       weights_shape = TensorShape(dims);
     } else if (input_shape.NumDimensions() < weights_shape.NumDimensions()) {
-      auto dims = input_shape.GetDims();
+      auto dims = input_shape.GetDimsAsVector();
       for (size_t i = 0; i < weights_shape.NumDimensions() - input_shape.NumDimensions(); i++) {
         dims.insert(dims.begin(), 1);
       }
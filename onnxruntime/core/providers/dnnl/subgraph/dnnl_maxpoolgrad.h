@@ -112,7 +112,7 @@ class DnnlMaxPoolGrad : public DnnlKernel {
     //Obtain output size and shape from the forward desc in maxpool.
     //This would be the input shape and size in the maxpool forward
     primitive_dst_shape_ = pool_fwd_->GetOutputShape();
-    std::vector<int64_t> y_dims = primitive_dst_shape_.GetDims();
+    std::vector<int64_t> y_dims = primitive_dst_shape_.GetDimsAsVector();
 
     if (xgrad_shape_.NumDimensions() < 3) {
       primitive_created_status_ = ORT_MAKE_STATUS(ONNXRUNTIME, EP_FAIL,
@@ -291,7 +291,7 @@ class DnnlMaxPoolGrad : public DnnlKernel {
     if (mklnode_ptr_->output_index >= 0) {
       // Last node of sub-graph. Allocate memory for output_buffer data
       // Reorder if needed
-      auto& y_dims = primitive_dst_shape_.GetDims();
+      const auto& y_dims = primitive_dst_shape_.GetDims();
       // Allocate memory for output bufffer
       OrtValue* output = ort.KernelContext_GetOutput(context, mklnode_ptr_->output_index, &y_dims[0], static_cast<int>(primitive_dst_shape_.GetDims().size()));
       T* dst_data = ort.GetTensorMutableData<T>(output);
@@ -437,7 +437,7 @@ class DnnlMaxPoolGrad : public DnnlKernel {
     return output_dims;
   }
 
-  inline void InferOutputSize(const std::vector<int64_t>& input_dims,
+  inline void InferOutputSize(gsl::span<const int64_t> input_dims,
                               std::vector<int64_t>* output_dims,
                               std::vector<int64_t>* pads) const {
     ORT_ENFORCE(input_dims.size() >= 2);
@@ -287,7 +287,7 @@ class DnnlPool : public DnnlKernel {
     if (mklnode_ptr_->output_index >= 0) {
       // Last node of sub-graph. Allocate memory for output_buffer data
       // Reorder if needed
-      auto& y_dims = primitive_dst_shape_.GetDims();
+      const auto& y_dims = primitive_dst_shape_.GetDims();
       // Allocate memory for output bufffer
 #ifndef ENABLE_TRAINING
       OrtValue* output = ort.KernelContext_GetOutput(context, mklnode_ptr_->output_index, &y_dims[0], static_cast<int>(primitive_dst_shape_.GetDims().size()));
@@ -466,7 +466,7 @@ class DnnlPool : public DnnlKernel {
     return output_dims;
   }
 
-  inline void InferOutputSize(const std::vector<int64_t>& input_dims,
+  inline void InferOutputSize(gsl::span<const int64_t> input_dims,
                               std::vector<int64_t>* output_dims,
                               std::vector<int64_t>* pads) const {
     ORT_ENFORCE(input_dims.size() >= 2);
@@ -104,7 +104,7 @@ class KernelComputeCtx {
 
   inline void* OutputData(const NupharFuncInfo* func_info,
                           int index,
-                          const TensorShape& shape,
+                          const std::vector<int64_t>& shape,
                           MLDataType dtype) {
     const auto& ort_output_allocator = func_info->ort_output_allocators[index];
 
@@ -116,8 +116,9 @@ class KernelComputeCtx {
       return t->MutableDataRaw();
     }
 
-    internal_ort_buffer_unique_ptrs_[offset].allocator_ptr = AllocateDataUniquePtr(shape, dtype);
-    internal_ort_buffer_unique_ptrs_[offset].shape = shape.GetDims().data();
+    // The shape is owned by the caller and outlives the buffer.
+    internal_ort_buffer_unique_ptrs_[offset].allocator_ptr = AllocateDataUniquePtr(shape.data(), shape.size(), dtype);
+    internal_ort_buffer_unique_ptrs_[offset].shape = shape.data();
     return internal_ort_buffer_unique_ptrs_[offset].allocator_ptr.get();
   }
 
@@ -172,7 +172,7 @@ Status ReduceKernel<allow_multi_axes>::ReduceKernelShared(
   }
 
   // MIOpen requires at least 3D input, so pad 1s if needed
-  std::vector<int64_t> input_dims_miopen = input_dims;
+  std::vector<int64_t> input_dims_miopen(input_dims.begin(), input_dims.end());
   std::vector<int64_t> output_dims_miopen = output_dims;
   if (rank < 3) {
     std::vector<int64_t> pads(3 - rank, 1);
@@ -364,7 +364,7 @@ Status PrepareForReduce(const Tensor* X,
   std::vector<bool> reduced(rank, false);
   prepare_reduce_metadata.output_dims.reserve(input_dims.size());
   if (axes.size() > 0) {
-    prepare_reduce_metadata.output_dims = input_dims;
+    prepare_reduce_metadata.output_dims.assign(input_dims.begin(), input_dims.end());
     for (auto axis : axes) {
       axis = HandleNegativeAxis(axis, rank);
       ORT_ENFORCE(input_dims[axis] != 0,
@@ -400,7 +400,7 @@ Status PrepareForReduce(const Tensor* X,
   }
 
   // MIOpen requires at least 3D input, so pad 1s if needed
-  prepare_reduce_metadata.input_dims_miopen = input_dims;
+  prepare_reduce_metadata.input_dims_miopen.assign(input_dims.begin(), input_dims.end());
   prepare_reduce_metadata.output_dims_miopen = prepare_reduce_metadata.output_dims;
   if (rank < 3) {
     std::vector<int64_t> pads(3 - rank, 1);
@@ -71,19 +71,8 @@ Status IDataTransfer::CopyTensors(const std::vector<SrcDstPair>& src_dst_pairs)
   return g_host->IDataTransfer__CopyTensors(this, src_dst_pairs);
 }
 
-TensorShape::TensorShape(const int64_t* dimension_sizes, size_t dimension_count)
-    : std::vector<int64_t>(dimension_count) {
-  for (size_t i = 0; i < dimension_count; ++i) {
-    (*this)[i] = dimension_sizes[i];
-  }
-}
-
-TensorShape::TensorShape(const std::vector<int64_t>& dims, size_t start, size_t end) {
-  assign(dims.begin() + start, dims.begin() + end);
-}
-
 int64_t TensorShape::Size() const {
-  size_t arraySize = size();
+  size_t arraySize = NumDimensions();
   int64_t size = SizeHelper(0, arraySize);
   //should we cache the size? as multiple operation may be expensive.
   return size;
@@ -94,12 +83,12 @@ int64_t TensorShape::SizeHelper(size_t start, size_t end) const {
 }
 
 TensorShape TensorShape::Slice(size_t dimstart, size_t dimend) const {
-  assert(dimstart <= dimend && dimend <= size());  // "Invalid tensor shape slice argument."
-  return TensorShape(*this, dimstart, dimend);
+  assert(dimstart <= dimend && dimend <= NumDimensions());  // "Invalid tensor shape slice argument."
+  return TensorShape(GetDims().subspan(dimstart, dimend - dimstart));
 }
 
 TensorShape TensorShape::Slice(size_t dimstart) const {
-  return Slice(dimstart, size());
+  return Slice(dimstart, NumDimensions());
 }
 
 std::string TensorShape::ToString() const {
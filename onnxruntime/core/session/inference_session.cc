@@ -4,6 +4,7 @@
 #include "core/graph/onnx_protobuf.h"
 #include "core/session/inference_session.h"
 
+#include <algorithm>
 #include <memory>
 #include <sstream>
 #include <unordered_set>
@@ -13,7 +14,9 @@
 
 #include "core/common/denormal.h"
 #include "core/common/logging/logging.h"
+#include "core/common/parse_string.h"
 #include "core/framework/allocatormgr.h"
+#include "core/framework/arena.h"
 #include "core/framework/error_code_helper.h"
 #include "core/framework/execution_frame.h"
 #include "core/framework/feeds_fetches_manager.h"
@@ -369,6 +372,18 @@ InferenceSession::InferenceSession(const SessionOptions& session_options, const
 #endif  // !defined(ORT_MINIMAL_BUILD)
 
 InferenceSession::~InferenceSession() {
+  std::vector<std::thread> async_run_threads;
+  {
+    std::unique_lock<OrtMutex> lock(async_runs_mutex_);
+    async_runs_cv_.wait(lock, [this]() { return async_runs_in_flight_ == 0; });
+    async_run_shutdown_ = true;
+    async_run_threads.swap(async_run_threads_);
+  }
+  async_run_queue_cv_.notify_all();
+  for (auto& thread : async_run_threads) {
+    thread.join();
+  }
+
   if (session_options_.enable_profiling) {
     ORT_TRY {
       EndProfiling();
@@ -1171,6 +1186,20 @@ common::Status InferenceSession::Initialize() {
       UpdateProvidersWithSharedAllocators();
     }
 
+    // The CPU execution provider may have been registered by the user, so apply the option to whichever
+    // instance ended up in the session rather than only to the default one created above.
+    if (session_options_.GetConfigOrDefault(kOrtSessionOptionsConfigUseFp16Initializers, "0") == "1") {
+      LOGS(*session_logger_, INFO) << "This session will store eligible constant float weights as float16.";
+      auto* cpu_provider = execution_providers_.Get(onnxruntime::kCpuExecutionProvider);
+      static_cast<CPUExecutionProvider*>(cpu_provider)->SetUseFp16Initializers(true);
+    }
+
+    if (session_options_.GetConfigOrDefault(kOrtSessionOptionsConfigQuantizeGatherTables, "0") == "1") {
+      LOGS(*session_logger_, INFO) << "This session will store constant float Gather tables as int8.";
+      auto* cpu_provider = execution_providers_.Get(onnxruntime::kCpuExecutionProvider);
+      static_cast<CPUExecutionProvider*>(cpu_provider)->SetQuantizeGatherTables(true);
+    }
+
 #ifdef ONNXRUNTIME_ENABLE_INSTRUMENT
     TraceLoggingWriteStart(session_activity, "OrtInferenceSessionActivity");
     session_activity_started_ = true;
@@ -1257,6 +1286,20 @@ common::Status InferenceSession::Initialize() {
                                              !saving_model,
                                              saving_ort_format));
 
+    if (session_options_.GetConfigOrDefault(kOrtSessionOptionsEnableOperatorMetrics, "0") == "1") {
+      session_state_->EnableOperatorMetrics();
+    }
+
+    if (session_options_.GetConfigOrDefault(kOrtSessionOptionsEnableStaticShapeReplay, "0") == "1") {
+      if (session_options_.enable_mem_pattern && session_options_.execution_mode == ExecutionMode::ORT_SEQUENTIAL) {
+        session_state_->EnableStaticShapeReplay();
+      } else {
+        LOGS(*session_logger_, WARNING)
+            << "Static shape replay requires the memory pattern optimization and sequential execution. "
+            << "It will not be used.";
+      }
+    }
+
 #if !defined(ORT_MINIMAL_BUILD)
     if (saving_model) {
       if (session_state_->GetFuncMgr().NumFuncs() > 0) {
@@ -1510,6 +1553,21 @@ Status InferenceSession::Run(const RunOptions& run_options,
                              const std::vector<std::string>& feed_names, const std::vector<OrtValue>& feeds,
                              const std::vector<std::string>& output_names, std::vector<OrtValue>* p_fetches,
                              const std::vector<OrtDevice>* p_fetches_device_info) {
+  return RunImpl(run_options, feed_names, feeds, output_names, p_fetches, p_fetches_device_info, nullptr);
+}
+
+Status InferenceSession::RunWithStatistics(const RunOptions& run_options,
+                                           const std::vector<std::string>& feed_names,
+                                           const std::vector<OrtValue>& feeds,
+                                           const std::vector<std::string>& output_names,
+                                           std::vector<OrtValue>* p_fetches, RunStatistics& statistics) {
+  return RunImpl(run_options, feed_names, feeds, output_names, p_fetches, nullptr, &statistics);
+}
+
+Status InferenceSession::RunImpl(const RunOptions& run_options,
+                                 const std::vector<std::string>& feed_names, const std::vector<OrtValue>& feeds,
+                                 const std::vector<std::string>& output_names, std::vector<OrtValue>* p_fetches,
+                                 const std::vector<OrtDevice>* p_fetches_device_info, RunStatistics* p_statistics) {
   TimePoint tp;
   if (session_profiler_.IsEnabled()) {
     tp = session_profiler_.Now();
@@ -1526,12 +1584,39 @@ Status InferenceSession::Run(const RunOptions& run_options,
   std::vector<IExecutionProvider*> exec_providers_to_stop;
   exec_providers_to_stop.reserve(execution_providers_.NumProviders());
 
+  // The threads working on the run and the arenas add to the accounting while it runs.
+  std::unique_ptr<concurrency::ThreadPool::RequestAccounting> accounting;
+  std::vector<IArenaAllocator*> accounted_arenas;
+  std::chrono::steady_clock::time_point accounting_start_time;
+  uint64_t accounting_start_cpu_time_ns = 0;
+  bool has_accounting_start_cpu_time = false;
+  if (p_statistics != nullptr) {
+    accounting = onnxruntime::make_unique<concurrency::ThreadPool::RequestAccounting>();
+    accounting_start_time = std::chrono::steady_clock::now();
+    has_accounting_start_cpu_time = GetThreadCpuTimeNanos(&accounting_start_cpu_time_ns);
+  }
+
   ORT_TRY {
     if (!is_inited_) {
       LOGS(*session_logger_, ERROR) << "Session was not initialized";
       return Status(common::ONNXRUNTIME, common::FAIL, "Session not initialized.");
     }
 
+    // The parallel loops of the run are scheduled by its priority and deadline, and it fails once cancelled.
+    concurrency::ThreadPool::RequestContext request;
+    request.priority = static_cast<concurrency::ThreadPool::RequestPriority>(run_options.priority);
+    request.terminate = &run_options.terminate;
+    request.accounting = accounting.get();
+    if (run_options.deadline_ms > 0) {
+      const auto now = std::chrono::steady_clock::now();
+      const std::chrono::milliseconds deadline_ms{run_options.deadline_ms};
+      if (deadline_ms < std::chrono::duration_cast<std::chrono::milliseconds>(
+                            std::chrono::steady_clock::time_point::max() - now)) {
+        request.deadline = now + deadline_ms;
+      }
+    }
+    concurrency::ThreadPool::RequestScope request_scope(&request);
+
     // log evaluation start to trace logging provider
     env.GetTelemetryProvider().LogEvaluationStart();
 
@@ -1557,6 +1642,23 @@ Status InferenceSession::Run(const RunOptions& run_options,
 
     ++current_num_runs_;
 
+    if (accounting != nullptr) {
+      // Allocators may be shared between execution providers.
+      for (const auto& xp : execution_providers_) {
+        for (const auto& allocator : xp->GetAllocators()) {
+          if (allocator->Info().alloc_type != OrtArenaAllocator) {
+            continue;
+          }
+
+          auto* arena = static_cast<IArenaAllocator*>(allocator.get());
+          if (std::find(accounted_arenas.cbegin(), accounted_arenas.cend(), arena) == accounted_arenas.cend()) {
+            arena->StartRequestAccounting(accounting->id);
+            accounted_arenas.push_back(arena);
+          }
+        }
+      }
+    }
+
     // scope of owned_run_logger is just the call to Execute.
     // If Execute ever becomes async we need a different approach
     std::unique_ptr<logging::Logger> owned_run_logger;
@@ -1605,6 +1707,25 @@ Status InferenceSession::Run(const RunOptions& run_options,
 
   --current_num_runs_;
 
+  if (p_statistics != nullptr) {
+    RunStatistics& statistics = *p_statistics;
+    statistics.wall_time_ns = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                                        std::chrono::steady_clock::now() - accounting_start_time)
+                                                        .count());
+    statistics.cpu_time_ns = accounting->worker_cpu_time_ns.load(std::memory_order_relaxed);
+    uint64_t accounting_end_cpu_time_ns;
+    if (has_accounting_start_cpu_time && GetThreadCpuTimeNanos(&accounting_end_cpu_time_ns) &&
+        accounting_end_cpu_time_ns > accounting_start_cpu_time_ns) {
+      statistics.cpu_time_ns += accounting_end_cpu_time_ns - accounting_start_cpu_time_ns;
+    }
+    statistics.kernels_executed = accounting->kernels_executed.load(std::memory_order_relaxed);
+    statistics.bytes_copied = accounting->bytes_copied.load(std::memory_order_relaxed);
+    statistics.arenas.clear();
+    for (auto* arena : accounted_arenas) {
+      statistics.arenas.push_back({arena->Info().name, arena->Info().id, arena->EndRequestAccounting(accounting->id)});
+    }
+  }
+
   // keep track of telemetry
   ++telemetry_.total_runs_since_last_;
   telemetry_.total_run_duration_since_last_ += TimeDiffMicroSeconds(tp);
@@ -1633,6 +1754,96 @@ Status InferenceSession::Run(const RunOptions& run_options,
   return retval;
 }
 
+common::Status InferenceSession::RunAsync(const RunOptions& run_options, std::vector<std::string> feed_names,
+                                          std::vector<OrtValue> feeds, std::vector<std::string> output_names,
+                                          std::vector<OrtValue> fetches, RunAsyncCallback callback) {
+  if (!is_inited_) {
+    LOGS(*session_logger_, ERROR) << "Session was not initialized";
+    return Status(common::ONNXRUNTIME, common::FAIL, "Session not initialized.");
+  }
+
+  // std::function must be copyable, so the request state is shared with the task.
+  struct AsyncRunRequest {
+    const RunOptions* run_options;
+    std::vector<std::string> feed_names;
+    std::vector<OrtValue> feeds;
+    std::vector<std::string> output_names;
+    std::vector<OrtValue> fetches;
+    RunAsyncCallback callback;
+  };
+  auto request = std::make_shared<AsyncRunRequest>(AsyncRunRequest{&run_options, std::move(feed_names),
+                                                                   std::move(feeds), std::move(output_names),
+                                                                   std::move(fetches), std::move(callback)});
+
+  auto task = [this, request]() {
+    Status status;
+    ORT_TRY {
+      status = Run(*request->run_options, request->feed_names, request->feeds, request->output_names,
+                   &request->fetches);
+    }
+    ORT_CATCH(const std::exception& ex) {
+      ORT_HANDLE_EXCEPTION([&]() {
+        status = ORT_MAKE_STATUS(ONNXRUNTIME, RUNTIME_EXCEPTION, ex.what());
+      });
+    }
+
+    // Release the inputs before invoking the callback, so that the caller controls where the last references to
+    // them are dropped.
+    request->feeds.clear();
+
+    request->callback(status, request->fetches);
+  };
+
+  {
+    std::lock_guard<OrtMutex> lock(async_runs_mutex_);
+    if (async_run_threads_.empty()) {
+      int num_threads = 1;
+      const std::string num_threads_str =
+          session_options_.GetConfigOrDefault(kOrtSessionOptionsConfigRunAsyncNumThreads, "1");
+      if (!TryParseStringWithClassicLocale(num_threads_str, num_threads) || num_threads < 1) {
+        return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Invalid value for ",
+                               kOrtSessionOptionsConfigRunAsyncNumThreads, ": ", num_threads_str);
+      }
+
+      async_run_threads_.reserve(static_cast<size_t>(num_threads));
+      for (int i = 0; i < num_threads; ++i) {
+        async_run_threads_.emplace_back(&InferenceSession::RunAsyncWorker, this);
+      }
+    }
+
+    async_run_queue_.push_back(std::move(task));
+    ++async_runs_in_flight_;
+  }
+  async_run_queue_cv_.notify_one();
+
+  return Status::OK();
+}
+
+void InferenceSession::RunAsyncWorker() {
+  for (;;) {
+    std::function<void()> task;
+    {
+      std::unique_lock<OrtMutex> lock(async_runs_mutex_);
+      async_run_queue_cv_.wait(lock, [this]() { return async_run_shutdown_ || !async_run_queue_.empty(); });
+      if (async_run_queue_.empty()) {
+        return;
+      }
+
+      task = std::move(async_run_queue_.front());
+      async_run_queue_.pop_front();
+    }
+
+    task();
+
+    // The task is released before the request is counted as done, so that nothing it holds outlives the session.
+    task = nullptr;
+    std::lock_guard<OrtMutex> lock(async_runs_mutex_);
+    if (--async_runs_in_flight_ == 0) {
+      async_runs_cv_.notify_all();
+    }
+  }
+}
+
 common::Status InferenceSession::Run(const NameMLValMap& feeds, const std::vector<std::string>& output_names,
                                      std::vector<OrtValue>* p_fetches) {
   return Run(RunOptions(), feeds, output_names, p_fetches);
@@ -1769,6 +1980,21 @@ const profiling::Profiler& InferenceSession::GetProfiling() const {
   return session_profiler_;
 }
 
+common::Status InferenceSession::GetOperatorMetrics(std::string& metrics) const {
+  if (!is_inited_) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Session not initialized.");
+  }
+
+  const OperatorMetrics* operator_metrics = session_state_->GetOperatorMetrics();
+  if (operator_metrics == nullptr) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Operator metrics are not enabled. Set the session config entry '",
+                           kOrtSessionOptionsEnableOperatorMetrics, "' to '1' to enable them.");
+  }
+
+  metrics = operator_metrics->ToJson();
+  return Status::OK();
+}
+
 AllocatorPtr InferenceSession::GetAllocator(const OrtMemoryInfo& mem_info) const {
   return session_state_->GetAllocator(mem_info);
 }
@@ -3,7 +3,10 @@
 
 #pragma once
 
+#include <deque>
+#include <functional>
 #include <string>
+#include <thread>
 #include <unordered_map>
 
 #include "core/common/common.h"
@@ -14,6 +17,7 @@
 #include "core/framework/framework_common.h"
 #include "core/framework/iexecutor.h"
 #include "core/framework/kernel_registry_manager.h"
+#include "core/framework/run_statistics.h"
 #include "core/framework/session_state.h"
 #include "core/graph/basic_types.h"
 #include "core/optimizer/graph_transformer_level.h"
@@ -270,6 +274,17 @@ class InferenceSession {
                      std::vector<OrtValue>* p_fetches,
                      const std::vector<OrtDevice>* p_fetches_device_info = nullptr) ORT_MUST_USE_RESULT;
 
+  /**
+    * Run as above, and also account for the resources used by the run.
+    * Accounting adds a small overhead to the run, so it is only done for runs made with this method.
+    * @param statistics receives the wall and CPU time of the run, the peak memory allocated on its behalf from
+    *        each arena, the bytes copied across devices and the number of kernels executed.
+    * @return OK if success.
+    */
+  common::Status RunWithStatistics(const RunOptions& run_options, const std::vector<std::string>& feed_names,
+                                   const std::vector<OrtValue>& feeds, const std::vector<std::string>& output_names,
+                                   std::vector<OrtValue>* p_fetches, RunStatistics& statistics) ORT_MUST_USE_RESULT;
+
   /**
     * Run a pre-loaded and pre-intialized model.
     * Multiple threads are allowed to run this function; hence its thread-safe.
@@ -292,6 +307,24 @@ class InferenceSession {
                      const std::vector<std::string>& output_names,
                      std::vector<OrtValue>* p_fetches) ORT_MUST_USE_RESULT;
 
+  using RunAsyncCallback = std::function<void(const common::Status& status, std::vector<OrtValue>& fetches)>;
+
+  /**
+    * Queue a Run of the model and return without waiting for it.
+    * Requests are run in order by threads dedicated to them, started by the first request. Their number is set by
+    * the session config entry "session.run_async_num_threads" and is 1 by default. The kernels of a request use the
+    * intra-op thread pool as usual.
+    * The feeds, names and fetches are owned by the request, so they do not need to outlive this call. run_options is
+    * not copied, so setting its terminate flag cancels the run. It must remain valid until callback is invoked.
+    * callback is invoked on a request thread with the status and outputs once the run completes. The request
+    * releases feeds before callback is invoked.
+    * The session waits for outstanding requests when destroyed, so callback must not destroy the session.
+    * @return OK if the request was queued. callback is not invoked if an error is returned.
+    */
+  common::Status RunAsync(const RunOptions& run_options, std::vector<std::string> feed_names,
+                          std::vector<OrtValue> feeds, std::vector<std::string> output_names,
+                          std::vector<OrtValue> fetches, RunAsyncCallback callback) ORT_MUST_USE_RESULT;
+
   /**
   * Creates a new binding object for binding inputs and outputs.
   * @param provider_type specifies the location where the inputs need to be potentially copied.
@@ -385,6 +418,14 @@ class InferenceSession {
     */
   const profiling::Profiler& GetProfiling() const;
 
+  /**
+    * Get the aggregate per-operator latency metrics collected since the session was initialized.
+    * Requires the session config entry kOrtSessionOptionsEnableOperatorMetrics to be set to "1".
+    * @param metrics receives the metrics as a JSON document.
+    * @return OK if success.
+    */
+  common::Status GetOperatorMetrics(std::string& metrics) const;
+
   /**
     * Search registered execution providers for an allocator that has characteristics
     * specified within mem_info
@@ -527,6 +568,12 @@ class InferenceSession {
 
   common::Status WaitForNotification(Notification* p_executor_done, int64_t timeout_in_ms) ORT_MUST_USE_RESULT;
 
+  // Implements Run and RunWithStatistics. The resources used by the run are accounted for if p_statistics is set.
+  common::Status RunImpl(const RunOptions& run_options, const std::vector<std::string>& feed_names,
+                         const std::vector<OrtValue>& feeds, const std::vector<std::string>& output_names,
+                         std::vector<OrtValue>* p_fetches, const std::vector<OrtDevice>* p_fetches_device_info,
+                         RunStatistics* p_statistics) ORT_MUST_USE_RESULT;
+
   template <typename T>
   void StartProfiling(const std::basic_string<T>& file_prefix);
 
@@ -625,6 +672,20 @@ class InferenceSession {
   std::atomic<int> current_num_runs_;
 
   mutable onnxruntime::OrtMutex session_mutex_;  // to ensure only one thread can invoke Load/Initialize
+
+  // Runs the queued RunAsync requests until the session is destroyed.
+  void RunAsyncWorker();
+
+  // Number of RunAsync requests whose callback has not returned yet. The destructor waits for it to reach 0.
+  size_t async_runs_in_flight_ = 0;  // GUARDED_BY(async_runs_mutex_)
+  onnxruntime::OrtMutex async_runs_mutex_;
+  onnxruntime::OrtCondVar async_runs_cv_;
+  // RunAsync requests wait in an unbounded queue for threads of their own, so a request is never run on the calling
+  // thread when the queue is long, and does not take an intra-op thread that its kernels could use.
+  std::deque<std::function<void()>> async_run_queue_;  // GUARDED_BY(async_runs_mutex_)
+  std::vector<std::thread> async_run_threads_;          // GUARDED_BY(async_runs_mutex_)
+  bool async_run_shutdown_ = false;                     // GUARDED_BY(async_runs_mutex_)
+  onnxruntime::OrtCondVar async_run_queue_cv_;
   bool is_model_loaded_ = false;                 // GUARDED_BY(session_mutex_)
   bool is_inited_ = false;                       // GUARDED_BY(session_mutex_)
 
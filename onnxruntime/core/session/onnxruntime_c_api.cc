@@ -534,12 +534,13 @@ ORT_API_STATUS_IMPL(OrtApis::CreateSessionFromArray, _In_ const OrtEnv* env, _In
   API_IMPL_END
 }
 
-ORT_API_STATUS_IMPL(OrtApis::Run, _Inout_ OrtSession* sess, _In_opt_ const OrtRunOptions* run_options,
-                    _In_reads_(input_len) const char* const* input_names,
-                    _In_reads_(input_len) const OrtValue* const* input, size_t input_len,
-                    _In_reads_(output_names_len) const char* const* output_names1, size_t output_names_len,
-                    _Inout_updates_all_(output_names_len) OrtValue** output) {
-  API_IMPL_BEGIN
+// Implements Run and RunWithStatistics. The resources used by the run are returned in statistics if it is set.
+static OrtStatus* RunImpl(_Inout_ OrtSession* sess, _In_opt_ const OrtRunOptions* run_options,
+                          _In_reads_(input_len) const char* const* input_names,
+                          _In_reads_(input_len) const OrtValue* const* input, size_t input_len,
+                          _In_reads_(output_names_len) const char* const* output_names1, size_t output_names_len,
+                          _Inout_updates_all_(output_names_len) OrtValue** output,
+                          _Inout_opt_ onnxruntime::RunStatistics* statistics) {
   auto session = reinterpret_cast<::onnxruntime::InferenceSession*>(sess);
   const int queue_id = 0;
 
@@ -576,11 +577,12 @@ ORT_API_STATUS_IMPL(OrtApis::Run, _Inout_ OrtSession* sess, _In_opt_ const OrtRu
     }
   }
   Status status;
-  if (run_options == nullptr) {
-    OrtRunOptions op;
-    status = session->Run(op, feed_names, feeds, output_names, &fetches, nullptr);
+  OrtRunOptions default_run_options;
+  const OrtRunOptions& options = run_options == nullptr ? default_run_options : *run_options;
+  if (statistics == nullptr) {
+    status = session->Run(options, feed_names, feeds, output_names, &fetches, nullptr);
   } else {
-    status = session->Run(*run_options, feed_names, feeds, output_names, &fetches, nullptr);
+    status = session->RunWithStatistics(options, feed_names, feeds, output_names, &fetches, *statistics);
   }
 
   if (!status.IsOK())
@@ -594,6 +596,15 @@ ORT_API_STATUS_IMPL(OrtApis::Run, _Inout_ OrtSession* sess, _In_opt_ const OrtRu
     }
   }
   return nullptr;
+}
+
+ORT_API_STATUS_IMPL(OrtApis::Run, _Inout_ OrtSession* sess, _In_opt_ const OrtRunOptions* run_options,
+                    _In_reads_(input_len) const char* const* input_names,
+                    _In_reads_(input_len) const OrtValue* const* input, size_t input_len,
+                    _In_reads_(output_names_len) const char* const* output_names1, size_t output_names_len,
+                    _Inout_updates_all_(output_names_len) OrtValue** output) {
+  API_IMPL_BEGIN
+  return RunImpl(sess, run_options, input_names, input, input_len, output_names1, output_names_len, output, nullptr);
   API_IMPL_END
 }
 
@@ -604,6 +615,67 @@ struct OrtIoBinding {
   OrtIoBinding& operator=(const OrtIoBinding&) = delete;
 };
 
+ORT_API_STATUS_IMPL(OrtApis::RunAsync, _Inout_ OrtSession* sess, _In_opt_ const OrtRunOptions* run_options,
+                    _In_reads_(input_len) const char* const* input_names,
+                    _In_reads_(input_len) const OrtValue* const* input, size_t input_len,
+                    _In_reads_(output_names_len) const char* const* output_names1, size_t output_names_len,
+                    _Inout_updates_all_(output_names_len) OrtValue** output,
+                    _In_ RunAsyncCallbackFn callback, _In_opt_ void* user_data) {
+  API_IMPL_BEGIN
+  auto session = reinterpret_cast<::onnxruntime::InferenceSession*>(sess);
+
+  if (callback == nullptr) {
+    return OrtApis::CreateStatus(ORT_INVALID_ARGUMENT, "callback cannot be null");
+  }
+
+  std::vector<std::string> feed_names(input_len);
+  std::vector<OrtValue> feeds(input_len);
+  for (size_t i = 0; i != input_len; ++i) {
+    if (input_names[i] == nullptr || input_names[i][0] == '\0') {
+      return OrtApis::CreateStatus(ORT_INVALID_ARGUMENT, "input name cannot be empty");
+    }
+    feed_names[i] = input_names[i];
+    feeds[i] = *reinterpret_cast<const ::OrtValue*>(input[i]);
+  }
+
+  std::vector<std::string> output_names(output_names_len);
+  std::vector<OrtValue> fetches(output_names_len);
+  for (size_t i = 0; i != output_names_len; ++i) {
+    if (output_names1[i] == nullptr || output_names1[i][0] == '\0') {
+      return OrtApis::CreateStatus(ORT_INVALID_ARGUMENT, "output name cannot be empty");
+    }
+    output_names[i] = output_names1[i];
+    if (output[i] != nullptr) {
+      fetches[i] = *(output[i]);
+    }
+  }
+
+  auto on_complete = [output, output_names_len, callback, user_data](const Status& status,
+                                                                     std::vector<OrtValue>& results) {
+    if (!status.IsOK()) {
+      OrtStatus* ort_status = ToOrtStatus(status);
+      callback(user_data, output, output_names_len, ort_status);
+      OrtApis::ReleaseStatus(ort_status);
+      return;
+    }
+
+    for (size_t i = 0; i != output_names_len; ++i) {
+      if (output[i] == nullptr) {
+        output[i] = new OrtValue(results[i]);
+      }
+    }
+    callback(user_data, output, output_names_len, nullptr);
+  };
+
+  // The session keeps a reference to the run options until the run completes.
+  static const OrtRunOptions default_run_options;
+  ORT_API_RETURN_IF_STATUS_NOT_OK(session->RunAsync(run_options == nullptr ? default_run_options : *run_options,
+                                                    std::move(feed_names), std::move(feeds), std::move(output_names),
+                                                    std::move(fetches), on_complete));
+  return nullptr;
+  API_IMPL_END
+}
+
 ORT_API_STATUS_IMPL(OrtApis::RunWithBinding, _Inout_ OrtSession* sess, _In_ const OrtRunOptions* run_options,
                     _In_ const OrtIoBinding* binding_ptr) {
   API_IMPL_BEGIN
@@ -978,6 +1050,34 @@ ORT_API_STATUS_IMPL(OrtApis::SessionEndProfiling, _In_ OrtSession* sess, _Inout_
   API_IMPL_END
 }
 
+ORT_API_STATUS_IMPL(OrtApis::SessionGetOperatorMetrics, _In_ const OrtSession* sess, _Inout_ OrtAllocator* allocator,
+                    _Outptr_ char** out) {
+  API_IMPL_BEGIN
+  auto session = reinterpret_cast<const ::onnxruntime::InferenceSession*>(sess);
+  std::string metrics;
+  ORT_API_RETURN_IF_STATUS_NOT_OK(session->GetOperatorMetrics(metrics));
+  *out = StrDup(metrics, allocator);
+  return nullptr;
+  API_IMPL_END
+}
+
+ORT_API_STATUS_IMPL(OrtApis::RunWithStatistics, _Inout_ OrtSession* sess, _In_opt_ const OrtRunOptions* run_options,
+                    _In_reads_(input_len) const char* const* input_names,
+                    _In_reads_(input_len) const OrtValue* const* input, size_t input_len,
+                    _In_reads_(output_names_len) const char* const* output_names1, size_t output_names_len,
+                    _Inout_updates_all_(output_names_len) OrtValue** output,
+                    _Inout_ OrtAllocator* allocator, _Outptr_ char** statistics) {
+  API_IMPL_BEGIN
+  onnxruntime::RunStatistics run_statistics;
+  OrtStatus* status = RunImpl(sess, run_options, input_names, input, input_len, output_names1, output_names_len,
+                              output, &run_statistics);
+  if (status != nullptr)
+    return status;
+  *statistics = StrDup(run_statistics.ToJson(), allocator);
+  return nullptr;
+  API_IMPL_END
+}
+
 ORT_API_STATUS_IMPL(OrtApis::SessionGetModelMetadata, _In_ const OrtSession* sess,
                     _Outptr_ OrtModelMetadata** out) {
   API_IMPL_BEGIN
@@ -2123,6 +2223,11 @@ static constexpr OrtApi ort_api_1_to_8 = {
     // Version 8 - In development, feel free to add/remove/rearrange here
     &OrtApis::KernelInfoGetAttributeArray_float,
     &OrtApis::KernelInfoGetAttributeArray_int64,
+    &OrtApis::SessionGetOperatorMetrics,
+    &OrtApis::RunAsync,
+    &OrtApis::RunOptionsSetPriority,
+    &OrtApis::RunOptionsSetDeadline,
+    &OrtApis::RunWithStatistics,
 };
 
 // Assert to do a limited check to ensure Version 1 of OrtApi never changes (will detect an addition or deletion but not if they cancel out each other)
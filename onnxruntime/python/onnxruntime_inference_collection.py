@@ -197,6 +197,64 @@ class Session:
             else:
                 raise
 
+    def run_with_statistics(self, output_names, input_feed, run_options=None):
+        """
+        Compute the predictions, and account for the resources used to compute them.
+
+        :param output_names: name of the outputs
+        :param input_feed: dictionary ``{ input_name: input_value }``
+        :param run_options: See :class:`onnxruntime.RunOptions`.
+        :return: a tuple of the outputs and a :class:`onnxruntime.RunStatistics` with the wall time and CPU time of
+            the run in nanoseconds (``wall_time_ns``, ``cpu_time_ns``), the number of kernels executed
+            (``kernels_executed``), the bytes copied between devices (``bytes_copied``) and the peak bytes allocated
+            on behalf of the run from each arena (``arenas``, a list of objects with ``name``, ``device_id`` and
+            ``peak_bytes``).
+
+        ::
+
+            outputs, statistics = sess.run_with_statistics([output_name], {input_name: x})
+        """
+        num_required_inputs = len(self._inputs_meta)
+        num_inputs = len(input_feed)
+        # the graph may have optional inputs used to override initializers. allow for that.
+        if num_inputs < num_required_inputs:
+            raise ValueError("Model requires {} inputs. Input Feed contains {}".format(num_required_inputs, num_inputs))
+        if not output_names:
+            output_names = [output.name for output in self._outputs_meta]
+        return self._sess.run_with_statistics(output_names, input_feed, run_options)
+
+    def run_async(self, output_names, input_feed, callback, user_data, run_options=None):
+        """
+        Compute the predictions asynchronously. The run is queued for a thread of the session dedicated to requests
+        and this returns without waiting for it, so many requests can be outstanding with few threads. The number of
+        these threads is set by the session config entry ``session.run_async_num_threads`` and is 1 by default.
+
+        :param output_names: name of the outputs
+        :param input_feed: dictionary ``{ input_name: input_value }``
+        :param callback: called as ``callback(outputs, user_data, err)`` on a request thread when the run
+            completes. ``err`` is an empty string on success and ``outputs`` is empty on failure.
+        :param user_data: any object, passed through to the callback
+        :param run_options: See :class:`onnxruntime.RunOptions`. It is not copied, so setting
+            ``run_options.terminate`` cancels the run.
+
+        ::
+
+            def callback(outputs, user_data, err):
+                user_data.put((outputs, err))
+
+            results = queue.Queue()
+            sess.run_async([output_name], {input_name: x}, callback, results)
+            outputs, err = results.get()
+        """
+        num_required_inputs = len(self._inputs_meta)
+        num_inputs = len(input_feed)
+        # the graph may have optional inputs used to override initializers. allow for that.
+        if num_inputs < num_required_inputs:
+            raise ValueError("Model requires {} inputs. Input Feed contains {}".format(num_required_inputs, num_inputs))
+        if not output_names:
+            output_names = [output.name for output in self._outputs_meta]
+        return self._sess.run_async(output_names, input_feed, callback, user_data, run_options)
+
     def end_profiling(self):
         """
         End profiling and return results in a file.
@@ -426,15 +426,70 @@ static void AddNonTensorAsPyObj(const OrtValue& val, std::vector<py::object>& py
   }
 }
 
+// Returns a numpy array that wraps the buffer of a CPU tensor instead of copying it.
+// The array's base object holds a copy of the OrtValue, which keeps the buffer alive as long as the array or any
+// view of it exists. Only use this for OrtValues that ORT does not write to again, such as the fetches of a run.
+// Tensors that do not own their buffer (e.g. an output aliasing an initializer or a buffer provided by the user)
+// are not wrapped, so writing to the array can never modify memory ORT still uses.
+static bool GetPyObjFromTensorWithoutCopy(const OrtValue& val, py::object& obj) {
+  const Tensor& rtensor = val.Get<Tensor>();
+  if (rtensor.Location().device.Type() != OrtDevice::CPU || rtensor.IsDataTypeString() ||
+      !rtensor.OwnsBuffer() || rtensor.Shape().Size() == 0) {
+    return false;
+  }
+
+  std::vector<npy_intp> npy_dims;
+  const TensorShape& shape = rtensor.Shape();
+  for (size_t n = 0; n < shape.NumDimensions(); ++n) {
+    npy_dims.push_back(shape[n]);
+  }
+
+  const int numpy_type = OnnxRuntimeTensorToNumpyType(rtensor.DataType());
+  obj = py::reinterpret_steal<py::object>(PyArray_SimpleNewFromData(
+      shape.NumDimensions(), npy_dims.data(), numpy_type, const_cast<void*>(rtensor.DataRaw())));
+  if (!obj) {
+    throw py::error_already_set();
+  }
+
+  py::capsule owner(new OrtValue(val), [](void* p) { delete reinterpret_cast<OrtValue*>(p); });
+  // PyArray_SetBaseObject steals the reference it is given, also when it fails, so give it a new one. The reference
+  // held by owner is released when owner goes out of scope, which frees the capsule and the OrtValue copy on failure.
+  if (PyArray_SetBaseObject(reinterpret_cast<PyArrayObject*>(obj.ptr()), owner.inc_ref().ptr()) != 0) {
+    throw py::error_already_set();
+  }
+  return true;
+}
+
 static void AddTensorAsPyObj(const OrtValue& val, std::vector<py::object>& pyobjs,
                              const DataTransferManager* data_transfer_manager,
                              const std::unordered_map<OrtDevice::DeviceType, MemCpyFunc>* mem_cpy_to_host_functions) {
-  const Tensor& rtensor = val.Get<Tensor>();
   py::object obj;
-  GetPyObjFromTensor(rtensor, obj, data_transfer_manager, mem_cpy_to_host_functions);
+  if (!GetPyObjFromTensorWithoutCopy(val, obj)) {
+    GetPyObjFromTensor(val.Get<Tensor>(), obj, data_transfer_manager, mem_cpy_to_host_functions);
+  }
   pyobjs.push_back(obj);
 }
 
+// Converts the feeds passed to InferenceSession.run and its variants to OrtValues. Numeric numpy arrays are used
+// without copying, so they must stay alive until the run completes.
+static void CreateFeedsFromPyObjects(InferenceSession* sess, std::map<std::string, py::object>& pyfeeds,
+                                     std::vector<std::string>& feed_names, std::vector<OrtValue>& feeds) {
+  auto px = sess->GetModelInputs();
+  if (!px.first.IsOK() || !px.second) {
+    throw std::runtime_error("Either failed to get model inputs from the session object or the input def list was null");
+  }
+
+  feed_names.reserve(pyfeeds.size());
+  feeds.reserve(pyfeeds.size());
+  for (auto& _ : pyfeeds) {
+    OrtValue ml_value;
+    CreateGenericMLValue(px.second, GetAllocator(), _.first, _.second, &ml_value);
+    ThrowIfPyErrOccured();
+    feed_names.push_back(_.first);
+    feeds.push_back(ml_value);
+  }
+}
+
 static inline void RegisterExecutionProvider(InferenceSession* sess, onnxruntime::IExecutionProviderFactory& f) {
   auto p = f.CreateProvider();
   OrtPybindThrowIfError(sess->RegisterExecutionProvider(std::move(p)));
@@ -1218,6 +1273,11 @@ void addObjectMethods(py::module& m, Environment& env) {
       .value("ORT_SEQUENTIAL", ExecutionMode::ORT_SEQUENTIAL)
       .value("ORT_PARALLEL", ExecutionMode::ORT_PARALLEL);
 
+  py::enum_<OrtRunPriority>(m, "RunPriority")
+      .value("LOW", OrtRunPriority::ORT_RUN_PRIORITY_LOW)
+      .value("NORMAL", OrtRunPriority::ORT_RUN_PRIORITY_NORMAL)
+      .value("HIGH", OrtRunPriority::ORT_RUN_PRIORITY_HIGH);
+
   py::enum_<ExecutionOrder>(m, "ExecutionOrder")
       .value("DEFAULT", ExecutionOrder::DEFAULT)
       .value("PRIORITY_BASED", ExecutionOrder::PRIORITY_BASED);
@@ -1583,7 +1643,11 @@ void addObjectMethods(py::module& m, Environment& env) {
         rfetch.reserve(outputs.size());
         for (const auto& _ : outputs) {
           if (_.IsTensor()) {
-            AddTensorAsPyObj(_, rfetch, &io_binding->GetInferenceSession()->GetDataTransferManager(), nullptr);
+            // The bound outputs are reused by the next run, so the tensors are always copied.
+            py::object obj;
+            GetPyObjFromTensor(_.Get<Tensor>(), obj, &io_binding->GetInferenceSession()->GetDataTransferManager(),
+                               nullptr);
+            rfetch.push_back(obj);
           } else {
             AddNonTensorAsPyObj(_, rfetch, &io_binding->GetInferenceSession()->GetDataTransferManager(), nullptr);
           }
@@ -1762,9 +1826,26 @@ Applies to session load, initialization, etc. Default is 0.)pbdoc")
 Applies to a particular Run() invocation. Default is 0.)pbdoc")
       .def_readwrite("logid", &RunOptions::run_tag,
                      "To identify logs generated by a particular Run() invocation.")
-      .def_readwrite("terminate", &RunOptions::terminate,
-                     R"pbdoc(Set to True to terminate any currently executing calls that are using this
+      .def_property(
+          "terminate",
+          [](const RunOptions* options) -> bool { return options->terminate; },
+          [](RunOptions* options, bool terminate) -> void { options->terminate = terminate; },
+          R"pbdoc(Set to True to terminate any currently executing calls that are using this
 RunOptions instance. The individual calls will exit gracefully and return an error status.)pbdoc")
+      .def_readwrite("priority", &RunOptions::priority,
+                     R"pbdoc(Priority of the Run relative to concurrent calls that share its thread pools.
+Default is RunPriority.NORMAL.)pbdoc")
+      .def_property(
+          "deadline_ms",
+          [](const RunOptions* options) -> int64_t { return options->deadline_ms; },
+          [](RunOptions* options, int64_t deadline_ms) -> void {
+            if (deadline_ms < 0) {
+              throw std::runtime_error("deadline_ms must not be negative.");
+            }
+            options->deadline_ms = deadline_ms;
+          },
+          R"pbdoc(If positive, the Run fails once this many milliseconds have passed since it started,
+as if terminate had been set. Default is 0 (no deadline).)pbdoc")
 #ifdef ENABLE_TRAINING
       .def_readwrite("training_mode", &RunOptions::training_mode,
                      R"pbdoc(Choose to run in training or inferencing mode)pbdoc")
@@ -1783,6 +1864,21 @@ facilitate the comparison.)pbdoc")
       .def_readwrite("version", &ModelMetadata::version, "version of the model")
       .def_readwrite("custom_metadata_map", &ModelMetadata::custom_metadata_map, "additional metadata");
 
+  py::class_<RunStatistics> run_statistics(m, "RunStatistics", R"pbdoc(Resources used by a single run.
+CPU time includes the time intra-op and inter-op worker threads spent on the run.)pbdoc");
+  py::class_<RunStatistics::ArenaUsage>(run_statistics, "ArenaUsage",
+                                        R"pbdoc(Peak bytes allocated on behalf of the run from one arena.)pbdoc")
+      .def_readonly("name", &RunStatistics::ArenaUsage::name, "name of the arena's memory location")
+      .def_readonly("device_id", &RunStatistics::ArenaUsage::device_id, "device id of the arena")
+      .def_readonly("peak_bytes", &RunStatistics::ArenaUsage::peak_bytes,
+                    "peak bytes allocated for the run, including its memory pattern buffer");
+  run_statistics
+      .def_readonly("wall_time_ns", &RunStatistics::wall_time_ns, "wall time of the run in nanoseconds")
+      .def_readonly("cpu_time_ns", &RunStatistics::cpu_time_ns, "CPU time of the run in nanoseconds")
+      .def_readonly("kernels_executed", &RunStatistics::kernels_executed, "number of kernels executed")
+      .def_readonly("bytes_copied", &RunStatistics::bytes_copied, "bytes copied between devices")
+      .def_readonly("arenas", &RunStatistics::arenas, "memory used from each arena allocator of the session");
+
   py::class_<onnxruntime::NodeArg>(m, "NodeArg", R"pbdoc(Node argument definition, for both input and output,
 including arg name, arg type (contains both type and shape).)pbdoc")
       .def_property_readonly("name", &onnxruntime::NodeArg::Name, "node name")
@@ -1891,17 +1987,9 @@ including arg name, arg type (contains both type and shape).)pbdoc")
            [](PyInferenceSession* sess, std::vector<std::string> output_names,
               std::map<std::string, py::object> pyfeeds, RunOptions* run_options = nullptr)
                -> std::vector<py::object> {
-             NameMLValMap feeds;
-             for (auto _ : pyfeeds) {
-               OrtValue ml_value;
-               auto px = sess->GetSessionHandle()->GetModelInputs();
-               if (!px.first.IsOK() || !px.second) {
-                 throw std::runtime_error("Either failed to get model inputs from the session object or the input def list was null");
-               }
-               CreateGenericMLValue(px.second, GetAllocator(), _.first, _.second, &ml_value);
-               ThrowIfPyErrOccured();
-               feeds.insert(std::make_pair(_.first, ml_value));
-             }
+             std::vector<std::string> feed_names;
+             std::vector<OrtValue> feeds;
+             CreateFeedsFromPyObjects(sess->GetSessionHandle(), pyfeeds, feed_names, feeds);
 
              std::vector<OrtValue> fetches;
              common::Status status;
@@ -1910,9 +1998,11 @@ including arg name, arg type (contains both type and shape).)pbdoc")
                // release GIL to allow multiple python threads to invoke Run() in parallel.
                py::gil_scoped_release release;
                if (run_options != nullptr) {
-                 OrtPybindThrowIfError(sess->GetSessionHandle()->Run(*run_options, feeds, output_names, &fetches));
+                 OrtPybindThrowIfError(sess->GetSessionHandle()->Run(*run_options, feed_names, feeds, output_names,
+                                                                     &fetches));
                } else {
-                 OrtPybindThrowIfError(sess->GetSessionHandle()->Run(feeds, output_names, &fetches));
+                 OrtPybindThrowIfError(sess->GetSessionHandle()->Run(RunOptions(), feed_names, feeds, output_names,
+                                                                     &fetches));
                }
              }
 
@@ -1927,6 +2017,107 @@ including arg name, arg type (contains both type and shape).)pbdoc")
              }
              return rfetch;
            })
+      .def("run_with_statistics",
+           [](PyInferenceSession* sess, std::vector<std::string> output_names,
+              std::map<std::string, py::object> pyfeeds, RunOptions* run_options = nullptr)
+               -> std::pair<std::vector<py::object>, RunStatistics> {
+             std::vector<std::string> feed_names;
+             std::vector<OrtValue> feeds;
+             CreateFeedsFromPyObjects(sess->GetSessionHandle(), pyfeeds, feed_names, feeds);
+
+             std::vector<OrtValue> fetches;
+             RunStatistics statistics;
+
+             {
+               // release GIL to allow multiple python threads to invoke Run() in parallel.
+               py::gil_scoped_release release;
+               if (run_options != nullptr) {
+                 OrtPybindThrowIfError(sess->GetSessionHandle()->RunWithStatistics(
+                     *run_options, feed_names, feeds, output_names, &fetches, statistics));
+               } else {
+                 OrtPybindThrowIfError(sess->GetSessionHandle()->RunWithStatistics(
+                     RunOptions(), feed_names, feeds, output_names, &fetches, statistics));
+               }
+             }
+
+             std::vector<py::object> rfetch;
+             rfetch.reserve(fetches.size());
+             for (auto _ : fetches) {
+               if (_.IsTensor()) {
+                 AddTensorAsPyObj(_, rfetch, nullptr, nullptr);
+               } else {
+                 AddNonTensorAsPyObj(_, rfetch, nullptr, nullptr);
+               }
+             }
+             return std::make_pair(std::move(rfetch), std::move(statistics));
+           },
+           R"pbdoc(Runs the model and also returns the resources used by the run.)pbdoc")
+      .def("run_async",
+           [](PyInferenceSession* sess, std::vector<std::string> output_names,
+              std::map<std::string, py::object> pyfeeds, py::object callback, py::object user_data,
+              py::object run_options) {
+             std::vector<std::string> feed_names;
+             std::vector<OrtValue> feeds;
+             CreateFeedsFromPyObjects(sess->GetSessionHandle(), pyfeeds, feed_names, feeds);
+
+             // The session does not copy the run options, so that setting terminate cancels the run.
+             static const RunOptions default_run_options;
+             const RunOptions* p_run_options =
+                 run_options.is_none() ? &default_run_options : run_options.cast<RunOptions*>();
+
+             // The Python objects are released on a request thread, so they must take the GIL to do so.
+             // The feeds may wrap the memory of the numpy arrays passed in, so the arrays are kept alive until the
+             // run completes, as are the run options. The session releases its copies of the feeds before invoking
+             // the callback, so the copies held here are the last references and are also released with the GIL held.
+             struct PyCallbackState {
+               py::object callback;
+               py::object user_data;
+               py::object run_options;
+               std::map<std::string, py::object> pyfeeds;
+               std::vector<OrtValue> feeds;
+             };
+             std::shared_ptr<PyCallbackState> state(new PyCallbackState{std::move(callback), std::move(user_data),
+                                                                        std::move(run_options), pyfeeds, feeds},
+                                                    [](PyCallbackState* p) {
+                                                      py::gil_scoped_acquire acquire;
+                                                      delete p;
+                                                    });
+
+             std::vector<OrtValue> fetches(output_names.size());
+             OrtPybindThrowIfError(sess->GetSessionHandle()->RunAsync(
+                 *p_run_options, std::move(feed_names), std::move(feeds),
+                 std::move(output_names), std::move(fetches),
+                 [state](const common::Status& status, std::vector<OrtValue>& results) {
+                   py::gil_scoped_acquire acquire;
+                   std::vector<py::object> rfetch;
+                   std::string err = status.IsOK() ? std::string() : status.ErrorMessage();
+                   if (status.IsOK()) {
+                     try {
+                       rfetch.reserve(results.size());
+                       for (auto _ : results) {
+                         if (_.IsTensor()) {
+                           AddTensorAsPyObj(_, rfetch, nullptr, nullptr);
+                         } else {
+                           AddNonTensorAsPyObj(_, rfetch, nullptr, nullptr);
+                         }
+                       }
+                     } catch (const std::exception& e) {
+                       rfetch.clear();
+                       err = e.what();
+                     }
+                   }
+                   try {
+                     state->callback(rfetch, state->user_data, err);
+                   } catch (py::error_already_set& e) {
+                     // There is no caller to propagate the exception to.
+                     e.restore();
+                     PyErr_WriteUnraisable(state->callback.ptr());
+                   }
+                 }));
+           },
+           R"pbdoc(Queues a run on a thread of the session dedicated to requests and returns without waiting for it.
+callback(outputs, user_data, err) is invoked on that thread when the run completes. err is an empty string on
+success. Setting terminate on run_options cancels the run.)pbdoc")
       .def("end_profiling", [](PyInferenceSession* sess) -> std::string {
         return sess->GetSessionHandle()->EndProfiling();
       })
@@ -1,6 +1,8 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 
+#include <pybind11/pybind11.h>
+
 #include "core/common/logging/logging.h"
 #include "core/common/logging/sinks/cerr_sink.h"
 #include "core/framework/allocator.h"
@@ -73,7 +75,13 @@ struct PyInferenceSession {
 
   InferenceSession* GetSessionHandle() const { return sess_.get(); }
 
-  virtual ~PyInferenceSession() {}
+  virtual ~PyInferenceSession() {
+    // The InferenceSession destructor waits for outstanding run_async requests, whose callbacks need the GIL.
+    if (PyGILState_Check()) {
+      pybind11::gil_scoped_release release;
+      sess_.reset();
+    }
+  }
 
  protected:
   PyInferenceSession(std::unique_ptr<InferenceSession> sess) {
@@ -0,0 +1,174 @@
+# -------------------------------------------------------------------------
+# Copyright (c) Microsoft Corporation. All rights reserved.
+# Licensed under the MIT License. See License.txt in the project root for
+# license information.
+# --------------------------------------------------------------------------
+
+import argparse
+import logging
+from pathlib import Path
+
+import numpy as np
+import onnx
+from onnx import numpy_helper
+
+# Absolute imports, so the module can also be run as a script.
+from onnxruntime.quantization.onnx_model import ONNXModel
+from onnxruntime.quantization.quant_utils import ms_domain
+
+logger = logging.getLogger(__name__)
+
+
+class MatMul4BitsQuantizer:
+    '''
+    Replaces MatMul nodes whose weight is a constant 2D float initializer with MatMulNBits nodes,
+    quantizing the weight to 4 bits in blocks of 'block_size' elements along the K dimension.
+    The activation stays in float, so no calibration data is required.
+    '''
+    def __init__(self, model: onnx.ModelProto, block_size: int = 32, is_symmetric: bool = False, nodes_to_exclude=None):
+        if block_size < 16 or block_size > 256 or (block_size & (block_size - 1)) != 0:
+            raise ValueError("block_size must be a power of 2 from 16 to 256, got {}".format(block_size))
+        self.model = ONNXModel(model)
+        self.block_size = block_size
+        self.is_symmetric = is_symmetric
+        self.nodes_to_exclude = set(nodes_to_exclude or [])
+        # weight name -> names of its quantized initializers, so a weight shared by several MatMuls is quantized once
+        self.quantized_weights = {}
+
+    def _quantize_weight(self, fp32weight: np.ndarray):
+        '''
+        Quantize a [K, N] weight to the MatMulNBits layout:
+            packed: uint8 [N, blocks_per_col, block_size / 2], two elements per byte, lower k in the low nibble
+            scales: float [N * blocks_per_col]
+            zero_points: uint8 [N * ((blocks_per_col + 1) / 2)], two blocks per byte, lower block in the low nibble
+        '''
+        K, N = fp32weight.shape
+        block_size = self.block_size
+        blocks_per_col = (K + block_size - 1) // block_size
+        padded_k = blocks_per_col * block_size
+
+        # [N, blocks_per_col, block_size]
+        weight = np.zeros((N, padded_k), dtype=np.float32)
+        weight[:, :K] = fp32weight.T
+        weight = weight.reshape(N, blocks_per_col, block_size)
+
+        if self.is_symmetric:
+            abs_max = np.abs(weight).max(axis=2)
+            scales = abs_max / 7.0
+            zero_points = np.full((N, blocks_per_col), 8, dtype=np.int32)
+        else:
+            min_value = np.minimum(weight.min(axis=2), 0.0)
+            max_value = np.maximum(weight.max(axis=2), 0.0)
+            scales = (max_value - min_value) / 15.0
+            safe_scales = np.where(scales == 0.0, 1.0, scales)
+            zero_points = np.clip(np.round(-min_value / safe_scales), 0, 15).astype(np.int32)
+            zero_points = np.where(scales == 0.0, 8, zero_points)
+
+        safe_scales = np.where(scales == 0.0, 1.0, scales)[:, :, np.newaxis]
+        quantized = np.clip(np.round(weight / safe_scales) + zero_points[:, :, np.newaxis], 0, 15).astype(np.uint8)
+
+        packed = (quantized[:, :, 0::2] | (quantized[:, :, 1::2] << 4)).astype(np.uint8)
+
+        if blocks_per_col % 2 != 0:
+            zero_points = np.concatenate([zero_points, np.full((N, 1), 8, dtype=np.int32)], axis=1)
+        packed_zero_points = (zero_points[:, 0::2] | (zero_points[:, 1::2] << 4)).astype(np.uint8)
+
+        return packed, scales.astype(np.float32).reshape(-1), packed_zero_points.reshape(-1)
+
+    def _quantize_matmul(self, node: onnx.NodeProto):
+        if node.name in self.nodes_to_exclude:
+            return None
+
+        weight = self.model.get_initializer(node.input[1])
+        if weight is None:
+            return None
+
+        fp32weight = numpy_helper.to_array(weight)
+        if fp32weight.dtype != np.float32 or len(fp32weight.shape) != 2:
+            return None
+
+        K, N = fp32weight.shape
+        if weight.name not in self.quantized_weights:
+            packed, scales, zero_points = self._quantize_weight(fp32weight)
+
+            b_quant = numpy_helper.from_array(packed, weight.name + "_Q4")
+            scales_tensor = numpy_helper.from_array(scales, weight.name + "_scales")
+            self.model.add_initializer(b_quant)
+            self.model.add_initializer(scales_tensor)
+
+            quantized_inputs = [b_quant.name, scales_tensor.name]
+            if not self.is_symmetric:
+                zp_tensor = numpy_helper.from_array(zero_points, weight.name + "_zero_points")
+                self.model.add_initializer(zp_tensor)
+                quantized_inputs.append(zp_tensor.name)
+            self.quantized_weights[weight.name] = quantized_inputs
+
+        inputs = [node.input[0]] + self.quantized_weights[weight.name]
+
+        return onnx.helper.make_node("MatMulNBits",
+                                     inputs=inputs,
+                                     outputs=[node.output[0]],
+                                     name=node.name + "_Q4" if node.name else "",
+                                     domain=ms_domain,
+                                     K=K,
+                                     N=N,
+                                     bits=4,
+                                     block_size=self.block_size)
+
+    def process(self):
+        new_nodes = []
+        for node in self.model.nodes():
+            quantized_node = self._quantize_matmul(node) if node.op_type == "MatMul" else None
+            if quantized_node is None:
+                new_nodes.append(node)
+            else:
+                logger.info("quantized MatMul node {} to 4 bits".format(node.name))
+                new_nodes.append(quantized_node)
+
+        self.model.graph().ClearField('node')
+        self.model.graph().node.extend(new_nodes)
+
+        if not any(opset.domain == ms_domain for opset in self.model.opset_import()):
+            self.model.opset_import().extend([onnx.helper.make_opsetid(ms_domain, 1)])
+
+        self.model.remove_unused_constant()
+        return self.model.model
+
+
+def quantize_matmul_4bits(model_input: Path,
+                          model_output: Path,
+                          block_size: int = 32,
+                          is_symmetric: bool = False,
+                          nodes_to_exclude=None,
+                          use_external_data_format=False):
+    '''
+        Quantize the constant weights of MatMul nodes in an onnx model to 4 bits and save it into a file
+    :param model_input: file path of model to quantize
+    :param model_output: file path of quantized model
+    :param block_size: number of elements along K sharing a scale and zero point, a power of 2 from 16 to 256
+    :param is_symmetric: quantize with a fixed zero point of 8 and omit the zero_points input
+    :param nodes_to_exclude: list of MatMul node names to keep in float
+    :param use_external_data_format: option used for large size (>2GB) model. Set to False by default.
+    '''
+    model = onnx.load(Path(model_input))
+    quantizer = MatMul4BitsQuantizer(model, block_size, is_symmetric, nodes_to_exclude)
+    quantizer.process()
+    quantizer.model.save_model_to_file(str(model_output), use_external_data_format)
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description="Quantize the weights of MatMul nodes to 4 bits (MatMulNBits)")
+    parser.add_argument("--input_model", required=True, help="path to the float model")
+    parser.add_argument("--output_model", required=True, help="path to the quantized model")
+    parser.add_argument("--block_size", type=int, default=32, help="quantization block size along K")
+    parser.add_argument("--symmetric", action="store_true", help="use symmetric quantization")
+    parser.add_argument("--nodes_to_exclude", nargs="+", default=[], help="MatMul node names to keep in float")
+    parser.add_argument("--use_external_data_format", action="store_true", help="save tensors to an external file")
+    return parser.parse_args()
+
+
+if __name__ == "__main__":
+    args = parse_args()
+    logging.basicConfig(level=logging.INFO)
+    quantize_matmul_4bits(args.input_model, args.output_model, args.block_size, args.symmetric, args.nodes_to_exclude,
+                          args.use_external_data_format)
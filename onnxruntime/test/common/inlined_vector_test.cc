@@ -0,0 +1,201 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/common/inlined_vector.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace onnxruntime {
+namespace test {
+
+using SmallVector = InlinedVector<int64_t, 4>;
+
+static std::vector<int64_t> ToVector(const SmallVector& v) {
+  return std::vector<int64_t>(v.begin(), v.end());
+}
+
+static bool IsInline(const SmallVector& v) {
+  const auto* object = reinterpret_cast<const char*>(&v);
+  const auto* data = reinterpret_cast<const char*>(v.data());
+  return data >= object && data < object + sizeof(v);
+}
+
+TEST(InlinedVectorTest, Construct) {
+  SmallVector empty;
+  EXPECT_TRUE(empty.empty());
+  EXPECT_EQ(empty.capacity(), 4u);
+  EXPECT_TRUE(IsInline(empty));
+
+  SmallVector filled(3, 7);
+  EXPECT_EQ(ToVector(filled), (std::vector<int64_t>{7, 7, 7}));
+
+  SmallVector list{1, 2, 3, 4, 5};
+  EXPECT_EQ(ToVector(list), (std::vector<int64_t>{1, 2, 3, 4, 5}));
+  EXPECT_FALSE(IsInline(list));
+
+  const std::vector<int64_t> source{9, 8};
+  SmallVector range(source.begin(), source.end());
+  EXPECT_EQ(ToVector(range), source);
+}
+
+TEST(InlinedVectorTest, InlineToHeapTransition) {
+  SmallVector v;
+  for (int64_t i = 0; i < 4; ++i) {
+    v.push_back(i);
+  }
+  EXPECT_TRUE(IsInline(v));
+  EXPECT_EQ(v.capacity(), 4u);
+
+  v.push_back(4);
+  EXPECT_FALSE(IsInline(v));
+  EXPECT_GE(v.capacity(), 5u);
+  EXPECT_EQ(ToVector(v), (std::vector<int64_t>{0, 1, 2, 3, 4}));
+
+  // Shrinking keeps the heap buffer.
+  v.resize(2);
+  EXPECT_FALSE(IsInline(v));
+  EXPECT_EQ(ToVector(v), (std::vector<int64_t>{0, 1}));
+}
+
+TEST(InlinedVectorTest, CopyAndMove) {
+  SmallVector inline_values{1, 2};
+  SmallVector heap_values{1, 2, 3, 4, 5, 6};
+
+  SmallVector inline_copy(inline_values);
+  SmallVector heap_copy(heap_values);
+  EXPECT_EQ(inline_copy, inline_values);
+  EXPECT_EQ(heap_copy, heap_values);
+  EXPECT_NE(heap_copy.data(), heap_values.data());
+
+  const int64_t* heap_data = heap_values.data();
+  SmallVector heap_moved(std::move(heap_values));
+  EXPECT_EQ(heap_moved.data(), heap_data);
+  EXPECT_EQ(ToVector(heap_moved), (std::vector<int64_t>{1, 2, 3, 4, 5, 6}));
+  EXPECT_TRUE(heap_values.empty());
+  EXPECT_TRUE(IsInline(heap_values));
+
+  SmallVector inline_moved(std::move(inline_values));
+  EXPECT_TRUE(IsInline(inline_moved));
+  EXPECT_EQ(ToVector(inline_moved), (std::vector<int64_t>{1, 2}));
+  EXPECT_TRUE(inline_values.empty());
+
+  // Assignment between inline and heap storage in both directions.
+  inline_moved = heap_moved;
+  EXPECT_EQ(ToVector(inline_moved), (std::vector<int64_t>{1, 2, 3, 4, 5, 6}));
+  heap_moved = SmallVector{3};
+  EXPECT_EQ(ToVector(heap_moved), (std::vector<int64_t>{3}));
+  EXPECT_TRUE(IsInline(heap_moved));
+
+  inline_moved = inline_moved;
+  EXPECT_EQ(ToVector(inline_moved), (std::vector<int64_t>{1, 2, 3, 4, 5, 6}));
+}
+
+TEST(InlinedVectorTest, Insert) {
+  SmallVector v{1, 4};
+  auto it = v.insert(v.begin() + 1, 2);
+  EXPECT_EQ(*it, 2);
+  EXPECT_EQ(ToVector(v), (std::vector<int64_t>{1, 2, 4}));
+
+  it = v.insert(v.end() - 1, 2, 3);
+  EXPECT_EQ(it, v.begin() + 2);
+  EXPECT_EQ(ToVector(v), (std::vector<int64_t>{1, 2, 3, 3, 4}));
+
+  const std::vector<int64_t> values{-2, -1, 0};
+  it = v.insert(v.begin(), values.begin(), values.end());
+  EXPECT_EQ(it, v.begin());
+  EXPECT_EQ(ToVector(v), (std::vector<int64_t>{-2, -1, 0, 1, 2, 3, 3, 4}));
+
+  v.insert(v.end(), values.begin(), values.begin());
+  EXPECT_EQ(v.size(), 8u);
+}
+
+TEST(InlinedVectorTest, Erase) {
+  SmallVector v{0, 1, 2, 3, 4, 5};
+  auto it = v.erase(v.begin() + 1);
+  EXPECT_EQ(*it, 2);
+  EXPECT_EQ(ToVector(v), (std::vector<int64_t>{0, 2, 3, 4, 5}));
+
+  it = v.erase(v.begin() + 1, v.begin() + 3);
+  EXPECT_EQ(*it, 4);
+  EXPECT_EQ(ToVector(v), (std::vector<int64_t>{0, 4, 5}));
+
+  it = v.erase(v.begin() + 2, v.end());
+  EXPECT_EQ(it, v.end());
+  EXPECT_EQ(ToVector(v), (std::vector<int64_t>{0, 4}));
+
+  v.erase(v.begin(), v.begin());
+  EXPECT_EQ(ToVector(v), (std::vector<int64_t>{0, 4}));
+}
+
+TEST(InlinedVectorTest, ResizeAndAssign) {
+  SmallVector v{1, 2};
+  v.resize(3);
+  EXPECT_EQ(ToVector(v), (std::vector<int64_t>{1, 2, 0}));
+  v.resize(6, 9);
+  EXPECT_EQ(ToVector(v), (std::vector<int64_t>{1, 2, 0, 9, 9, 9}));
+  v.resize(1, 5);
+  EXPECT_EQ(ToVector(v), (std::vector<int64_t>{1}));
+
+  v.assign(5, 3);
+  EXPECT_EQ(ToVector(v), (std::vector<int64_t>{3, 3, 3, 3, 3}));
+  v = {4, 5};
+  EXPECT_EQ(ToVector(v), (std::vector<int64_t>{4, 5}));
+
+  const std::vector<int64_t> values{6, 7, 8, 9, 10, 11, 12, 13, 14};
+  v.assign(values.begin(), values.end());
+  EXPECT_EQ(ToVector(v), values);
+
+  v.clear();
+  EXPECT_TRUE(v.empty());
+}
+
+// Arguments that refer to elements of the vector itself must stay valid when the vector reallocates, as they do
+// for std::vector. Each case starts from a full heap buffer, which growing frees.
+TEST(InlinedVectorTest, SelfAliasingArguments) {
+  const SmallVector heap_values{1, 2, 3, 4, 5};
+  ASSERT_FALSE(IsInline(heap_values));
+
+  {
+    SmallVector v(heap_values);
+    v.resize(v.capacity());
+    v.push_back(v[0]);
+    EXPECT_EQ(v.back(), 1);
+  }
+  {
+    SmallVector v(heap_values);
+    v.resize(16, v[1]);
+    EXPECT_EQ(v.size(), 16u);
+    EXPECT_EQ(v[4], 5);
+    for (size_t i = 5; i < v.size(); ++i) {
+      EXPECT_EQ(v[i], 2);
+    }
+  }
+  {
+    SmallVector v(heap_values);
+    v.assign(16, v[2]);
+    EXPECT_EQ(v.size(), 16u);
+    for (auto value : v) {
+      EXPECT_EQ(value, 3);
+    }
+  }
+  {
+    SmallVector v(heap_values);
+    v.insert(v.begin(), 3, v[4]);
+    EXPECT_EQ(ToVector(v), (std::vector<int64_t>{5, 5, 5, 1, 2, 3, 4, 5}));
+  }
+  {
+    SmallVector v(heap_values);
+    v.insert(v.begin() + 1, v.begin(), v.end());
+    EXPECT_EQ(ToVector(v), (std::vector<int64_t>{1, 1, 2, 3, 4, 5, 2, 3, 4, 5}));
+  }
+  {
+    SmallVector v(heap_values);
+    v.assign(v.begin() + 1, v.begin() + 3);
+    EXPECT_EQ(ToVector(v), (std::vector<int64_t>{2, 3}));
+  }
+}
+
+}  // namespace test
+}  // namespace onnxruntime
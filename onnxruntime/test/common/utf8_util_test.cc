@@ -41,5 +41,36 @@ TEST(Utf8UtilTest, Validate) {
   }
 }
 
+TEST(Utf8UtilTest, ChangeCase) {
+  using namespace utf8_util;
+  struct CaseSample {
+    const char* input;
+    const char* upper;
+    const char* lower;
+  };
+  const std::vector<CaseSample> case_samples = {
+      {"", "", ""},
+      {"Monday 42!", "MONDAY 42!", "monday 42!"},
+      {u8"École élémentaire", u8"ÉCOLE ÉLÉMENTAIRE", u8"école élémentaire"},
+      {u8"Понедельник", u8"ПОНЕДЕЛЬНИК", u8"понедельник"},
+      // Characters without a one to one mapping are left unchanged
+      {u8"grüßen", u8"GRÜßEN", u8"grüßen"},
+      {u8"中文", u8"中文", u8"中文"},
+      // Four byte sequences
+      {u8"\U00010428", u8"\U00010400", u8"\U00010428"}};
+
+  for (const auto& sample : case_samples) {
+    std::string upper;
+    std::string lower;
+    ASSERT_TRUE(utf8_change_case(sample.input, true, upper));
+    ASSERT_TRUE(utf8_change_case(sample.input, false, lower));
+    EXPECT_EQ(upper, sample.upper);
+    EXPECT_EQ(lower, sample.lower);
+  }
+
+  std::string out;
+  EXPECT_FALSE(utf8_change_case("\xc3\x28", true, out));
+}
+
 }  // namespace test
 }  // namespace onnxruntime
@@ -2,10 +2,15 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 #include "gtest/gtest.h"
 #include "test/common/tensor_op_test_utils.h"
 #include "test/common/cuda_op_test_utils.h"
 #include "test/providers/provider_test_utils.h"
+#include "contrib_ops/cpu/bert/attention_helper.h"
 
 namespace onnxruntime {
 namespace test {
@@ -1479,5 +1484,300 @@ TEST(AttentionTest, AttentionPrunedModel) {
                    batch_size, sequence_length, hidden_size, number_of_heads,
                    use_float16, is_unidirectional, use_past_state, past_sequence_length, past_data, present_data, kMaskRaw, input_hidden_size);
 }
+
+// Sequences of 512 or more tokens are computed in blocks without materializing the attention probabilities. The
+// expected output is computed from the mask directly, so the blocked masking is checked for each type of mask.
+static void RunAttentionLongSequenceTest(const std::vector<int32_t>& mask_index_data,
+                                         MaskIndexType mask_index_type,
+                                         bool is_unidirectional) {
+  int batch_size = 2;
+  int sequence_length = 600;
+  int hidden_size = 8;
+  int number_of_heads = 2;
+  int head_size = hidden_size / number_of_heads;
+
+  std::vector<float> input_data(batch_size * sequence_length * hidden_size);
+  for (size_t i = 0; i < input_data.size(); i++) {
+    input_data[i] = std::sin(0.37f * static_cast<float>(i));
+  }
+
+  // Q, K and V are the input.
+  std::vector<float> weight_data(hidden_size * 3 * hidden_size, 0.0f);
+  for (int i = 0; i < hidden_size; i++) {
+    for (int j = 0; j < 3; j++) {
+      weight_data[i * 3 * hidden_size + j * hidden_size + i] = 1.0f;
+    }
+  }
+  std::vector<float> bias_data(3 * hidden_size, 0.0f);
+
+  // The value added to the score of query s and key m of batch b. Each condition adds -10000 like the kernel does.
+  auto mask_value = [&](int b, int s, int m) {
+    float value = 0.0f;
+    switch (mask_index_type) {
+      case kMaskIndexEnd:
+        value += m >= mask_index_data[b] ? -10000.0f : 0.0f;
+        break;
+      case kMaskIndexEndAndStart:
+        value += (m >= mask_index_data[b] || m < mask_index_data[b + batch_size]) ? -10000.0f : 0.0f;
+        break;
+      case kMaskRaw:
+        value += mask_index_data[b * sequence_length + m] > 0 ? 0.0f : -10000.0f;
+        break;
+      case kMask3D:
+        value += mask_index_data[(b * sequence_length + s) * sequence_length + m] > 0 ? 0.0f : -10000.0f;
+        break;
+      default:
+        break;
+    }
+    if (is_unidirectional && m > s) {
+      value += -10000.0f;
+    }
+    return value;
+  };
+
+  const float scale = 1.0f / std::sqrt(static_cast<float>(head_size));
+  std::vector<float> output_data(input_data.size());
+  std::vector<float> scores(sequence_length);
+  for (int b = 0; b < batch_size; b++) {
+    for (int n = 0; n < number_of_heads; n++) {
+      for (int s = 0; s < sequence_length; s++) {
+        const float* q = input_data.data() + (b * sequence_length + s) * hidden_size + n * head_size;
+        float max_score = -std::numeric_limits<float>::infinity();
+        for (int m = 0; m < sequence_length; m++) {
+          const float* k = input_data.data() + (b * sequence_length + m) * hidden_size + n * head_size;
+          float dot = 0.0f;
+          for (int h = 0; h < head_size; h++) {
+            dot += q[h] * k[h];
+          }
+          scores[m] = dot * scale + mask_value(b, s, m);
+          max_score = std::max(max_score, scores[m]);
+        }
+        float sum = 0.0f;
+        for (int m = 0; m < sequence_length; m++) {
+          scores[m] = std::exp(scores[m] - max_score);
+          sum += scores[m];
+        }
+        float* out = output_data.data() + (b * sequence_length + s) * hidden_size + n * head_size;
+        for (int h = 0; h < head_size; h++) {
+          float value = 0.0f;
+          for (int m = 0; m < sequence_length; m++) {
+            value += scores[m] * input_data[(b * sequence_length + m) * hidden_size + n * head_size + h];
+          }
+          out[h] = value / sum;
+        }
+      }
+    }
+  }
+
+  bool use_float16 = false;
+  bool use_past_state = false;
+  int past_sequence_length = 0;
+  RunAttentionTest(input_data, weight_data, bias_data, mask_index_data, output_data,
+                   batch_size, sequence_length, hidden_size, number_of_heads,
+                   use_float16, is_unidirectional, use_past_state, past_sequence_length, nullptr, nullptr,
+                   mask_index_type);
+}
+
+TEST(AttentionTest, AttentionLongSequence) {
+  std::vector<int32_t> mask_index_data = {600, 450};
+  RunAttentionLongSequenceTest(mask_index_data, kMaskIndexEnd, true);
+}
+
+TEST(AttentionTest, AttentionLongSequenceMaskIndexEndAndStart) {
+  // The end and start positions fall inside different blocks of keys.
+  std::vector<int32_t> mask_index_data = {580, 450, 10, 300};
+  RunAttentionLongSequenceTest(mask_index_data, kMaskIndexEndAndStart, false);
+}
+
+TEST(AttentionTest, AttentionLongSequenceRawMask) {
+  int batch_size = 2;
+  int sequence_length = 600;
+  std::vector<int32_t> mask_index_data(batch_size * sequence_length);
+  for (int b = 0; b < batch_size; b++) {
+    for (int m = 0; m < sequence_length; m++) {
+      mask_index_data[b * sequence_length + m] = (m % 7 == 3 || m >= 550 - 100 * b) ? 0 : 1;
+    }
+  }
+  RunAttentionLongSequenceTest(mask_index_data, kMaskRaw, false);
+  RunAttentionLongSequenceTest(mask_index_data, kMaskRaw, true);
+}
+
+TEST(AttentionTest, AttentionLongSequence3DMask) {
+  int batch_size = 2;
+  int sequence_length = 600;
+  std::vector<int32_t> mask_index_data(batch_size * sequence_length * sequence_length);
+  for (int b = 0; b < batch_size; b++) {
+    for (int s = 0; s < sequence_length; s++) {
+      for (int m = 0; m < sequence_length; m++) {
+        mask_index_data[(b * sequence_length + s) * sequence_length + m] = ((s + 2 * m + b) % 5 == 0) ? 0 : 1;
+      }
+    }
+  }
+  RunAttentionLongSequenceTest(mask_index_data, kMask3D, false);
+  RunAttentionLongSequenceTest(mask_index_data, kMask3D, true);
+}
+
+// ApplyMaskToScoreBlock must add the same values as PrepareMask for any block of queries and keys.
+TEST(AttentionTest, ApplyMaskToScoreBlockMatchesPrepareMask) {
+  const int batch_size = 2;
+  const int sequence_length = 70;
+  const int past_sequence_length = 30;
+  const int all_sequence_length = past_sequence_length + sequence_length;
+  const int query_block_size = 16;
+  const int key_block_size = 24;
+
+  std::vector<int32_t> mask_index_end = {90, 100};
+  std::vector<int32_t> mask_index_end_and_start = {90, 100, 0, 45};
+  std::vector<int32_t> raw_mask(batch_size * all_sequence_length);
+  for (size_t i = 0; i < raw_mask.size(); i++) {
+    raw_mask[i] = (i % 5 == 2) ? 0 : 1;
+  }
+  std::vector<int32_t> mask_3d(batch_size * sequence_length * all_sequence_length);
+  for (size_t i = 0; i < mask_3d.size(); i++) {
+    mask_3d[i] = (i % 7 == 4) ? 0 : 1;
+  }
+
+  struct MaskCase {
+    const std::vector<int32_t>* mask_index;
+    std::vector<int64_t> dims;
+  };
+  const std::vector<MaskCase> mask_cases = {
+      {nullptr, {}},
+      {&mask_index_end, {batch_size}},
+      {&mask_index_end_and_start, {2 * batch_size}},
+      {&raw_mask, {batch_size, all_sequence_length}},
+      {&mask_3d, {batch_size, sequence_length, all_sequence_length}},
+  };
+
+  for (const auto& mask_case : mask_cases) {
+    for (bool is_unidirectional : {false, true}) {
+      const int32_t* mask_index = mask_case.mask_index != nullptr ? mask_case.mask_index->data() : nullptr;
+      gsl::span<const int64_t> mask_index_dims(mask_case.dims);
+
+      std::vector<float> expected(batch_size * sequence_length * all_sequence_length, 0.0f);
+      contrib::PrepareMask(mask_index, mask_index_dims, expected.data(), is_unidirectional,
+                           batch_size, sequence_length, past_sequence_length);
+
+      std::vector<float> scores(query_block_size * key_block_size);
+      for (int b = 0; b < batch_size; b++) {
+        for (int query_start = 0; query_start < sequence_length; query_start += query_block_size) {
+          const int query_count = std::min(query_block_size, sequence_length - query_start);
+          for (int key_start = 0; key_start < all_sequence_length; key_start += key_block_size) {
+            const int key_count = std::min(key_block_size, all_sequence_length - key_start);
+            std::fill(scores.begin(), scores.end(), 0.0f);
+            contrib::ApplyMaskToScoreBlock(scores.data(), mask_index, mask_index_dims, is_unidirectional,
+                                           b, batch_size, sequence_length, past_sequence_length,
+                                           query_start, query_count, key_start, key_count);
+            for (int q = 0; q < query_count; q++) {
+              for (int k = 0; k < key_count; k++) {
+                const int s = query_start + q;
+                const int m = key_start + k;
+                ASSERT_EQ(expected[(b * sequence_length + s) * all_sequence_length + m], scores[q * key_count + k])
+                    << "mask rank " << mask_case.dims.size() << ", unidirectional " << is_unidirectional
+                    << ", batch " << b << ", query " << s << ", key " << m;
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST(AttentionTest, AttentionLongSequenceWithPastState) {
+  // The past state makes the total sequence long enough for the blocked computation, which also writes the present
+  // state.
+  int batch_size = 2;
+  int sequence_length = 24;
+  int past_sequence_length = 500;
+  int all_sequence_length = past_sequence_length + sequence_length;
+  int hidden_size = 8;
+  int number_of_heads = 2;
+  int head_size = hidden_size / number_of_heads;
+
+  std::vector<float> input_data(batch_size * sequence_length * hidden_size);
+  for (size_t i = 0; i < input_data.size(); i++) {
+    input_data[i] = std::sin(0.37f * static_cast<float>(i));
+  }
+
+  std::vector<float> past_data(2 * batch_size * number_of_heads * past_sequence_length * head_size);
+  for (size_t i = 0; i < past_data.size(); i++) {
+    past_data[i] = std::cos(0.23f * static_cast<float>(i));
+  }
+
+  // Q, K and V are the input.
+  std::vector<float> weight_data(hidden_size * 3 * hidden_size, 0.0f);
+  for (int i = 0; i < hidden_size; i++) {
+    for (int j = 0; j < 3; j++) {
+      weight_data[i * 3 * hidden_size + j * hidden_size + i] = 1.0f;
+    }
+  }
+  std::vector<float> bias_data(3 * hidden_size, 0.0f);
+
+  std::vector<int32_t> mask_index_data = {all_sequence_length, 400};
+
+  // present is the past state followed by K and V of the input, for each batch and head.
+  std::vector<float> present_data(2 * batch_size * number_of_heads * all_sequence_length * head_size);
+  for (int kv = 0; kv < 2; kv++) {
+    for (int b = 0; b < batch_size; b++) {
+      for (int n = 0; n < number_of_heads; n++) {
+        const int bn = (kv * batch_size + b) * number_of_heads + n;
+        for (int m = 0; m < all_sequence_length; m++) {
+          for (int h = 0; h < head_size; h++) {
+            present_data[(bn * all_sequence_length + m) * head_size + h] =
+                m < past_sequence_length
+                    ? past_data[(bn * past_sequence_length + m) * head_size + h]
+                    : input_data[(b * sequence_length + m - past_sequence_length) * hidden_size + n * head_size + h];
+          }
+        }
+      }
+    }
+  }
+
+  const float scale = 1.0f / std::sqrt(static_cast<float>(head_size));
+  std::vector<float> output_data(input_data.size());
+  std::vector<float> scores(all_sequence_length);
+  for (int b = 0; b < batch_size; b++) {
+    for (int n = 0; n < number_of_heads; n++) {
+      const float* keys = present_data.data() + (b * number_of_heads + n) * all_sequence_length * head_size;
+      const float* values = keys + batch_size * number_of_heads * all_sequence_length * head_size;
+      for (int s = 0; s < sequence_length; s++) {
+        const float* q = input_data.data() + (b * sequence_length + s) * hidden_size + n * head_size;
+        float max_score = -std::numeric_limits<float>::infinity();
+        for (int m = 0; m < all_sequence_length; m++) {
+          float dot = 0.0f;
+          for (int h = 0; h < head_size; h++) {
+            dot += q[h] * keys[m * head_size + h];
+          }
+          scores[m] = dot * scale;
+          if (m >= mask_index_data[b] || m > past_sequence_length + s) {
+            scores[m] += -10000.0f;
+          }
+          max_score = std::max(max_score, scores[m]);
+        }
+        float sum = 0.0f;
+        for (int m = 0; m < all_sequence_length; m++) {
+          scores[m] = std::exp(scores[m] - max_score);
+          sum += scores[m];
+        }
+        float* out = output_data.data() + (b * sequence_length + s) * hidden_size + n * head_size;
+        for (int h = 0; h < head_size; h++) {
+          float value = 0.0f;
+          for (int m = 0; m < all_sequence_length; m++) {
+            value += scores[m] * values[m * head_size + h];
+          }
+          out[h] = value / sum;
+        }
+      }
+    }
+  }
+
+  bool use_float16 = false;
+  bool is_unidirectional = true;
+  bool use_past_state = true;
+  RunAttentionTest(input_data, weight_data, bias_data, mask_index_data, output_data,
+                   batch_size, sequence_length, hidden_size, number_of_heads,
+                   use_float16, is_unidirectional, use_past_state, past_sequence_length, &past_data, &present_data);
+}
 }  // namespace test
 }  // namespace onnxruntime
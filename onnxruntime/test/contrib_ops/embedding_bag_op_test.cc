@@ -0,0 +1,110 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "gtest/gtest.h"
+#include "core/session/onnxruntime_session_options_config_keys.h"
+#include "test/providers/provider_test_utils.h"
+#include "test/util/include/default_providers.h"
+
+namespace onnxruntime {
+namespace test {
+
+// Row r of the table is {r, r + 0.5, -r}.
+static const std::vector<float> kEmbeddingTable{0.0f, 0.5f, -0.0f,
+                                                1.0f, 1.5f, -1.0f,
+                                                2.0f, 2.5f, -2.0f,
+                                                3.0f, 3.5f, -3.0f};
+
+TEST(EmbeddingBagContribOpTest, Sum) {
+  OpTester test("EmbeddingBag", 1, kMSDomain);
+  test.AddInput<float>("data", {4, 3}, kEmbeddingTable);
+  test.AddInput<int64_t>("indices", {2, 3}, {0, 1, 2, 3, -1, 0});
+  test.AddOutput<float>("output", {2, 1, 3},
+                        {3.0f, 4.5f, -3.0f,
+                         6.0f, 7.5f, -6.0f});
+  test.Run();
+}
+
+TEST(EmbeddingBagContribOpTest, MeanNoKeepdims) {
+  OpTester test("EmbeddingBag", 1, kMSDomain);
+  test.AddAttribute<std::string>("mode", "mean");
+  test.AddAttribute<int64_t>("keepdims", 0);
+  test.AddInput<float>("data", {4, 3}, kEmbeddingTable);
+  test.AddInput<int32_t>("indices", {2, 3}, {0, 1, 2, 3, -1, 0});
+  test.AddOutput<float>("output", {2, 3},
+                        {1.0f, 1.5f, -1.0f,
+                         2.0f, 2.5f, -2.0f});
+  test.Run();
+}
+
+TEST(EmbeddingBagContribOpTest, SingleBagOfMatrices) {
+  OpTester test("EmbeddingBag", 1, kMSDomain);
+  test.AddAttribute<int64_t>("keepdims", 0);
+  test.AddInput<float>("data", {3, 2, 2},
+                       {1.0f, 2.0f, 3.0f, 4.0f,
+                        10.0f, 20.0f, 30.0f, 40.0f,
+                        100.0f, 200.0f, 300.0f, 400.0f});
+  test.AddInput<int64_t>("indices", {4}, {2, 0, 2, 1});
+  test.AddOutput<float>("output", {2, 2}, {211.0f, 422.0f, 633.0f, 844.0f});
+  test.Run();
+}
+
+TEST(EmbeddingBagContribOpTest, EmptyBags) {
+  OpTester test("EmbeddingBag", 1, kMSDomain);
+  test.AddAttribute<std::string>("mode", "mean");
+  test.AddInput<float>("data", {4, 3}, kEmbeddingTable);
+  test.AddInput<int64_t>("indices", {2, 0}, {});
+  test.AddOutput<float>("output", {2, 1, 3}, std::vector<float>(6, 0.0f));
+  test.Run();
+}
+
+TEST(EmbeddingBagContribOpTest, IndexOutOfBounds) {
+  OpTester test("EmbeddingBag", 1, kMSDomain);
+  test.AddInput<float>("data", {4, 3}, kEmbeddingTable);
+  test.AddInput<int64_t>("indices", {1, 2}, {1, 4});
+  test.AddOutput<float>("output", {1, 1, 3}, {0.0f, 0.0f, 0.0f});
+  test.Run(OpTester::ExpectResult::kExpectFailure, "indices element out of data bounds");
+}
+
+// The rows of the table are scaled by their largest magnitude of 127 and stored exactly as int8.
+TEST(EmbeddingBagContribOpTest, Int8Table) {
+  SessionOptions so;
+  ASSERT_TRUE(so.AddConfigEntry(kOrtSessionOptionsConfigQuantizeGatherTables, "1").IsOK());
+
+  std::vector<std::unique_ptr<IExecutionProvider>> execution_providers;
+  execution_providers.push_back(DefaultCpuExecutionProvider());
+
+  OpTester test("EmbeddingBag", 1, kMSDomain);
+  test.AddAttribute<std::string>("mode", "mean");
+  test.AddInput<float>("data", {3, 2},
+                       {127.0f, -3.0f,
+                        -5.0f, 127.0f,
+                        127.0f, 127.0f},
+                       true);
+  test.AddInput<int64_t>("indices", {2, 2}, {0, 1, 2, -3});
+  test.AddOutput<float>("output", {2, 1, 2},
+                        {61.0f, 62.0f,
+                         127.0f, 62.0f});
+  test.Run(so, OpTester::ExpectResult::kExpectSuccess, "", {}, nullptr, &execution_providers);
+}
+
+// The table is stored as float16, so 2049 is rounded to 2048.
+TEST(EmbeddingBagContribOpTest, Fp16Table) {
+  SessionOptions so;
+  ASSERT_TRUE(so.AddConfigEntry(kOrtSessionOptionsConfigUseFp16Initializers, "1").IsOK());
+
+  std::vector<std::unique_ptr<IExecutionProvider>> execution_providers;
+  execution_providers.push_back(DefaultCpuExecutionProvider());
+
+  OpTester test("EmbeddingBag", 1, kMSDomain);
+  test.AddInput<float>("data", {2, 2},
+                       {2049.0f, 0.5f,
+                        1.0f, -0.25f},
+                       true);
+  test.AddInput<int32_t>("indices", {1, 3}, {0, 1, 1});
+  test.AddOutput<float>("output", {1, 1, 2}, {2050.0f, 0.0f});
+  test.Run(so, OpTester::ExpectResult::kExpectSuccess, "", {}, nullptr, &execution_providers);
+}
+
+}  // namespace test
+}  // namespace onnxruntime
@@ -3,6 +3,7 @@
 
 #include "gtest/gtest.h"
 #include "test/providers/provider_test_utils.h"
+#include "test/util/include/default_providers.h"
 
 namespace onnxruntime {
 namespace test {
@@ -136,5 +137,57 @@ TEST(FusedConvTest, Conv2D_Bias_Z_Relu) {
 }
 #endif
 
+#if !defined(DISABLE_CONTRIB_OPS)
+// Activations that only the CPU FusedConv kernel implements. The convolution produces
+// {1.5, 2, 3, 3.5} for the first filter and the negated values for the second.
+static void TestCpuFusedConvActivation(const std::string& activation, const std::vector<float>& activation_params,
+                                       const std::vector<float>& expected_output) {
+  OpTester test("FusedConv", 1, onnxruntime::kMSDomain);
+  test.AddAttribute("kernel_shape", std::vector<int64_t>{2, 2});
+  test.AddAttribute("activation", activation);
+  if (!activation_params.empty()) {
+    test.AddAttribute("activation_params", activation_params);
+  }
+
+  test.AddInput<float>("X", {1, 1, 3, 3}, {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f});
+  test.AddInput<float>("W", {2, 1, 2, 2}, {0.125f, 0.125f, 0.125f, 0.125f, -0.125f, -0.125f, -0.125f, -0.125f});
+  test.AddOutput<float>("Y", {1, 2, 2, 2}, expected_output);
+  test.SetOutputAbsErr("Y", 1e-5f);
+
+  std::vector<std::unique_ptr<IExecutionProvider>> execution_providers;
+  execution_providers.push_back(DefaultCpuExecutionProvider());
+  test.Run(OpTester::ExpectResult::kExpectSuccess, "", {}, nullptr, &execution_providers);
+}
+
+TEST(FusedConvTest, Cpu_Conv2D_HardSigmoid) {
+  TestCpuFusedConvActivation("HardSigmoid", {0.25f, 0.5f},
+                             {0.875f, 1.0f, 1.0f, 1.0f, 0.125f, 0.0f, 0.0f, 0.0f});
+}
+
+TEST(FusedConvTest, Cpu_Conv2D_Softplus) {
+  TestCpuFusedConvActivation("Softplus", {},
+                             {1.7014133f, 2.126928f, 3.0485874f, 3.5297504f,
+                              0.20141328f, 0.12692801f, 0.048587352f, 0.029750418f});
+}
+
+TEST(FusedConvTest, Cpu_Conv2D_HardSwish) {
+  TestCpuFusedConvActivation("HardSwish", {},
+                             {1.125f, 1.6666667f, 3.0f, 3.5f, -0.375f, -0.33333333f, 0.0f, 0.0f});
+}
+
+TEST(FusedConvTest, Cpu_Conv2D_HardSigmoid_MissingParams) {
+  OpTester test("FusedConv", 1, onnxruntime::kMSDomain);
+  test.AddAttribute("kernel_shape", std::vector<int64_t>{2, 2});
+  test.AddAttribute("activation", "HardSigmoid");
+  test.AddInput<float>("X", {1, 1, 3, 3}, {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f});
+  test.AddInput<float>("W", {1, 1, 2, 2}, {1.0f, 1.0f, 1.0f, 1.0f});
+  test.AddOutput<float>("Y", {1, 1, 2, 2}, {1.0f, 1.0f, 1.0f, 1.0f});
+
+  std::vector<std::unique_ptr<IExecutionProvider>> execution_providers;
+  execution_providers.push_back(DefaultCpuExecutionProvider());
+  test.Run(OpTester::ExpectResult::kExpectFailure, "GetFusedActivationAttr", {}, nullptr, &execution_providers);
+}
+#endif
+
 }  // namespace test
 }  // namespace onnxruntime
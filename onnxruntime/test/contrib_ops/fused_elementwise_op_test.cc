@@ -0,0 +1,85 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <cmath>
+
+#include "gtest/gtest.h"
+#include "test/providers/provider_test_utils.h"
+
+namespace onnxruntime {
+namespace test {
+
+// x * sigmoid(x) where x = X * scale + bias. The output spans several tiles and the bias repeats along the first
+// axis.
+TEST(FusedElementwiseContribOpTest, SwishWithBias) {
+  constexpr int64_t rows = 3;
+  constexpr int64_t columns = 700;
+
+  std::vector<float> X(rows * columns);
+  std::vector<float> bias(columns);
+  std::vector<float> Y(rows * columns);
+  for (int64_t j = 0; j < columns; ++j) {
+    bias[j] = static_cast<float>(j % 13) * 0.25f - 1.5f;
+  }
+  for (int64_t i = 0; i < rows * columns; ++i) {
+    X[i] = static_cast<float>(i % 17) * 0.5f - 4.0f;
+    const float x = X[i] * 0.75f + bias[i % columns];
+    Y[i] = x / (1.0f + std::exp(-x));
+  }
+
+  OpTester test("FusedElementwise", 1, kMSDomain);
+  test.AddAttribute<std::vector<std::string>>("ops", {"Mul", "Add", "Sigmoid", "Mul"});
+  test.AddAttribute<std::vector<int64_t>>("operands", {0, 1, 3, 2, 4, -1, 4, 5});
+  test.AddInput<float>("X", {rows, columns}, X);
+  test.AddInput<float>("scale", {}, {0.75f});
+  test.AddInput<float>("bias", {1, columns}, bias);
+  test.AddOutput<float>("Y", {rows, columns}, Y);
+  test.Run();
+}
+
+TEST(FusedElementwiseContribOpTest, UnaryChain) {
+  const std::vector<float> X{-2.0f, -1.0f, -0.25f, 0.25f, 1.0f, 2.0f, 4.0f, 9.0f};
+
+  // relu(x) / exp(-1 / sqrt(abs(x)))
+  std::vector<float> Y;
+  for (float x : X) {
+    Y.push_back(std::max(x, 0.0f) / std::exp(-1.0f / std::sqrt(std::abs(x))));
+  }
+
+  OpTester test("FusedElementwise", 1, kMSDomain);
+  test.AddAttribute<std::vector<std::string>>("ops", {"Abs", "Sqrt", "Reciprocal", "Neg", "Exp", "Relu", "Div"});
+  test.AddAttribute<std::vector<int64_t>>("operands", {0, -1, 1, -1, 2, -1, 3, -1, 4, -1, 0, -1, 6, 5});
+  test.AddInput<float>("X", {2, 4}, X);
+  test.AddOutput<float>("Y", {2, 4}, Y);
+  test.Run();
+}
+
+TEST(FusedElementwiseContribOpTest, ErfTanhSub) {
+  const std::vector<float> X{-3.0f, -1.5f, -0.5f, 0.0f, 0.5f, 1.5f, 3.0f};
+
+  std::vector<float> Y;
+  for (float x : X) {
+    Y.push_back(x - std::tanh(std::erf(x)));
+  }
+
+  OpTester test("FusedElementwise", 1, kMSDomain);
+  test.AddAttribute<std::vector<std::string>>("ops", {"Erf", "Tanh", "Sub"});
+  test.AddAttribute<std::vector<int64_t>>("operands", {0, -1, 1, -1, 0, 2});
+  test.AddInput<float>("X", {7}, X);
+  test.AddOutput<float>("Y", {7}, Y);
+  test.Run();
+}
+
+// Inputs broadcast along an inner axis are not supported by the kernel.
+TEST(FusedElementwiseContribOpTest, InnerBroadcast) {
+  OpTester test("FusedElementwise", 1, kMSDomain);
+  test.AddAttribute<std::vector<std::string>>("ops", {"Add", "Relu"});
+  test.AddAttribute<std::vector<int64_t>>("operands", {0, 1, 2, -1});
+  test.AddInput<float>("A", {2, 3}, {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f});
+  test.AddInput<float>("B", {2, 1}, {1.0f, -10.0f});
+  test.AddOutput<float>("Y", {2, 3}, {2.0f, 3.0f, 4.0f, 0.0f, 0.0f, 0.0f});
+  test.Run(OpTester::ExpectResult::kExpectFailure, "does not match the trailing dimensions");
+}
+
+}  // namespace test
+}  // namespace onnxruntime
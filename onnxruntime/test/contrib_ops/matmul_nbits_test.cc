@@ -0,0 +1,134 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "test/common/tensor_op_test_utils.h"
+#include "test/providers/provider_test_utils.h"
+
+#include "gtest/gtest.h"
+
+namespace onnxruntime {
+namespace test {
+
+// Quantizes a [K, N] float matrix B to the MatMulNBits layout and returns the
+// dequantized values so the expected output uses the quantized weights.
+static void QuantizeBlockwise4Bits(const std::vector<float>& b, int64_t K, int64_t N, int64_t block_size,
+                                   bool symmetric,
+                                   std::vector<uint8_t>& quant_data,
+                                   std::vector<float>& scales,
+                                   std::vector<uint8_t>& zero_points,
+                                   std::vector<float>& dequant_b) {
+  const int64_t blocks_per_col = (K + block_size - 1) / block_size;
+  const int64_t blob_size = block_size / 2;
+
+  quant_data.assign(static_cast<size_t>(N * blocks_per_col * blob_size), 0);
+  scales.assign(static_cast<size_t>(N * blocks_per_col), 0.0f);
+  zero_points.assign(static_cast<size_t>(N * ((blocks_per_col + 1) / 2)), 0);
+  dequant_b.assign(b.size(), 0.0f);
+
+  for (int64_t n = 0; n < N; n++) {
+    for (int64_t block = 0; block < blocks_per_col; block++) {
+      const int64_t k_start = block * block_size;
+      const int64_t k_end = std::min(K, k_start + block_size);
+
+      float min_value = 0.0f;
+      float max_value = 0.0f;
+      for (int64_t k = k_start; k < k_end; k++) {
+        min_value = std::min(min_value, b[k * N + n]);
+        max_value = std::max(max_value, b[k * N + n]);
+      }
+
+      float scale;
+      int zp;
+      if (symmetric) {
+        const float abs_max = std::max(std::abs(min_value), std::abs(max_value));
+        scale = abs_max / 7.0f;
+        zp = 8;
+      } else {
+        scale = (max_value - min_value) / 15.0f;
+        zp = scale == 0.0f ? 8 : static_cast<int>(std::round(-min_value / scale));
+        zp = std::min(15, std::max(0, zp));
+      }
+
+      scales[n * blocks_per_col + block] = scale;
+      uint8_t& zp_pair = zero_points[n * ((blocks_per_col + 1) / 2) + block / 2];
+      zp_pair |= static_cast<uint8_t>((block & 1) ? (zp << 4) : zp);
+
+      for (int64_t k = k_start; k < k_end; k++) {
+        int q = scale == 0.0f ? zp : static_cast<int>(std::round(b[k * N + n] / scale)) + zp;
+        q = std::min(15, std::max(0, q));
+        uint8_t& pair = quant_data[(n * blocks_per_col + block) * blob_size + (k - k_start) / 2];
+        pair |= static_cast<uint8_t>((k & 1) ? (q << 4) : q);
+        dequant_b[k * N + n] = static_cast<float>(q - zp) * scale;
+      }
+    }
+  }
+}
+
+static void RunMatMulNBitsTest(const std::vector<int64_t>& a_dims, int64_t K, int64_t N, int64_t block_size,
+                               bool has_zero_points, bool is_b_constant) {
+  RandomValueGenerator random{};
+
+  std::vector<float> a_data = random.Uniform<float>(a_dims, -1.0f, 1.0f);
+  std::vector<float> b_data = random.Uniform<float>({K, N}, -1.0f, 1.0f);
+
+  std::vector<uint8_t> quant_data;
+  std::vector<float> scales;
+  std::vector<uint8_t> zero_points;
+  std::vector<float> dequant_b;
+  QuantizeBlockwise4Bits(b_data, K, N, block_size, !has_zero_points, quant_data, scales, zero_points, dequant_b);
+
+  const int64_t M = static_cast<int64_t>(a_data.size()) / K;
+  std::vector<float> expected(static_cast<size_t>(M * N));
+  for (int64_t m = 0; m < M; m++) {
+    for (int64_t n = 0; n < N; n++) {
+      float sum = 0.0f;
+      for (int64_t k = 0; k < K; k++) {
+        sum += a_data[m * K + k] * dequant_b[k * N + n];
+      }
+      expected[m * N + n] = sum;
+    }
+  }
+
+  std::vector<int64_t> y_dims(a_dims);
+  y_dims.back() = N;
+
+  const int64_t blocks_per_col = (K + block_size - 1) / block_size;
+
+  OpTester test("MatMulNBits", 1, onnxruntime::kMSDomain);
+  test.AddAttribute<int64_t>("K", K);
+  test.AddAttribute<int64_t>("N", N);
+  test.AddAttribute<int64_t>("block_size", block_size);
+  test.AddAttribute<int64_t>("bits", 4);
+  test.AddInput<float>("A", a_dims, a_data);
+  test.AddInput<uint8_t>("B", {N, blocks_per_col, block_size / 2}, quant_data, is_b_constant);
+  test.AddInput<float>("scales", {N * blocks_per_col}, scales, is_b_constant);
+  if (has_zero_points) {
+    test.AddInput<uint8_t>("zero_points", {N * ((blocks_per_col + 1) / 2)}, zero_points, is_b_constant);
+  } else {
+    test.AddMissingOptionalInput<uint8_t>();
+  }
+  test.AddOutput<float>("Y", y_dims, expected);
+  test.SetOutputAbsErr("Y", 1e-4f);
+  test.Run();
+}
+
+TEST(MatMulNBits, Float32_SingleRow) {
+  for (bool is_b_constant : {false, true}) {
+    RunMatMulNBitsTest({1, 64}, 64, 16, 32, true, is_b_constant);
+    RunMatMulNBitsTest({1, 100}, 100, 17, 16, false, is_b_constant);
+  }
+}
+
+TEST(MatMulNBits, Float32_MultiRow) {
+  for (bool is_b_constant : {false, true}) {
+    RunMatMulNBitsTest({3, 256}, 256, 40, 64, true, is_b_constant);
+    RunMatMulNBitsTest({2, 12, 200}, 200, 33, 128, false, is_b_constant);
+  }
+}
+
+TEST(MatMulNBits, Float32_EmptyInput) {
+  RunMatMulNBitsTest({0, 64}, 64, 16, 32, true, true);
+}
+
+}  // namespace test
+}  // namespace onnxruntime
@@ -0,0 +1,368 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <algorithm>
+#include <cmath>
+#include "core/util/math.h"
+#include "gtest/gtest.h"
+#include "test/providers/provider_test_utils.h"
+#include <random>
+
+namespace onnxruntime {
+namespace test {
+
+class NhwcFusedConvOpTester {
+ private:
+  std::default_random_engine generator_{1234};
+  std::vector<float> X_data_;
+  std::vector<int64_t> X_shape_;
+  std::vector<float> W_data_;
+  std::vector<int64_t> W_shape_;
+  std::vector<float> B_data_;
+  std::vector<int64_t> pads_;
+  std::vector<int64_t> strides_;
+  std::vector<int64_t> dilations_;
+  int64_t groups_{1};
+  std::string activation_;
+  std::vector<float> activation_params_;
+
+  static size_t ShapeSize(const std::vector<int64_t>& shape) {
+    return static_cast<size_t>(std::accumulate(shape.cbegin(), shape.cend(), 1LL, std::multiplies<int64_t>()));
+  }
+
+  static bool NextPosition(int64_t N, const int64_t* shape, int64_t* dims) {
+    // Loop over spatial axes in reverse order to choose an index, like counting.
+    bool incremented = false;
+    for (int64_t d_i = N - 1; d_i >= 0; --d_i) {
+      int64_t d_max = shape[d_i];
+      ORT_ENFORCE(dims[d_i] < d_max);
+      if (dims[d_i] == d_max - 1) {
+        dims[d_i] = 0;
+      } else {  // dims[d_i] < d_max - 1
+        ++dims[d_i];
+        incremented = true;
+        break;
+      }
+    }
+    return incremented;
+  }
+
+  // Generate values that are multiples of 1/8, so that the sums of products are exact.
+  std::vector<float> GenerateRandomData(size_t count) {
+    std::uniform_int_distribution<int32_t> distribution(-8, 8);
+    std::vector<float> data(count);
+    for (auto& value : data) {
+      value = static_cast<float>(distribution(generator_)) / 8.0f;
+    }
+    return data;
+  }
+
+  float ApplyActivation(float value) const {
+    if (activation_ == "Relu") {
+      return std::max(value, 0.0f);
+    } else if (activation_ == "LeakyRelu") {
+      return value >= 0.0f ? value : value * activation_params_[0];
+    } else if (activation_ == "Clip") {
+      return std::min(std::max(value, activation_params_[0]), activation_params_[1]);
+    } else if (activation_ == "Sigmoid") {
+      return 1.0f / (1.0f + std::exp(-value));
+    } else if (activation_ == "Tanh") {
+      return std::tanh(value);
+    } else if (activation_ == "HardSigmoid") {
+      return std::min(std::max(activation_params_[0] * value + activation_params_[1], 0.0f), 1.0f);
+    } else if (activation_ == "Softplus") {
+      return std::log1p(std::exp(value));
+    } else if (activation_ == "HardSwish") {
+      return value * std::min(std::max(value / 6.0f + 0.5f, 0.0f), 1.0f);
+    }
+    ORT_ENFORCE(activation_.empty(), "Unexpected activation ", activation_);
+    return value;
+  }
+
+  void ComputeExpectedOutput(std::vector<float>& Y_data, std::vector<int64_t>& Y_shape) {
+    ORT_ENFORCE(X_shape_.size() >= 3 && X_shape_.size() == W_shape_.size());
+
+    const size_t kernel_rank = W_shape_.size() - 2;
+
+    const int64_t batch_count = X_shape_[0];
+    const int64_t input_channels = X_shape_[X_shape_.size() - 1];
+    const int64_t output_channels = W_shape_[0];
+    const int64_t group_input_channels = W_shape_[1];
+    const int64_t group_output_channels = output_channels / groups_;
+    ORT_ENFORCE(input_channels == group_input_channels * groups_);
+
+    std::vector<int64_t> pads(pads_);
+    if (pads.empty()) {
+      pads.resize(kernel_rank * 2, 0);
+    }
+    std::vector<int64_t> dilations(dilations_);
+    if (dilations.empty()) {
+      dilations.resize(kernel_rank, 1);
+    }
+    std::vector<int64_t> strides(strides_);
+    if (strides.empty()) {
+      strides.resize(kernel_rank, 1);
+    }
+
+    const int64_t* input_shape = X_shape_.data() + 1;
+    const int64_t* kernel_shape = W_shape_.data() + 2;
+    const int64_t kernel_size = std::accumulate(kernel_shape, kernel_shape + kernel_rank, 1LL,
+                                                std::multiplies<int64_t>());
+
+    // Compute the expected shape of the output.
+    Y_shape.reserve(kernel_rank + 2);
+    Y_shape.push_back(batch_count);
+    for (size_t n = 0; n < kernel_rank; n++) {
+      Y_shape.push_back(((input_shape[n] + pads[n] + pads[kernel_rank + n]) -
+                         (dilations[n] * (kernel_shape[n] - 1) + 1)) / strides[n] + 1);
+    }
+    Y_shape.push_back(output_channels);
+    Y_data.resize(ShapeSize(Y_shape));
+
+    const int64_t* output_shape = Y_shape.data() + 1;
+
+    const int64_t input_image_size = std::accumulate(
+        input_shape, input_shape + kernel_rank, 1LL, std::multiplies<int64_t>());
+
+    const float* Xdata = X_data_.data();
+    float* Ydata = Y_data.data();
+
+    for (int64_t batch = 0; batch < batch_count; batch++) {
+      std::vector<int64_t> d_output(kernel_rank, 0);
+      do {
+        for (int64_t oc = 0; oc < output_channels; oc++) {
+          const int64_t group = oc / group_output_channels;
+          float sum = B_data_.empty() ? 0.0f : B_data_[oc];
+          std::vector<int64_t> d_kernel(kernel_rank, 0);
+          int64_t kernel_offset = 0;
+          do {
+            int64_t input_offset = 0;
+            bool is_padding = false;
+            for (size_t axis = 0; axis < kernel_rank; ++axis) {
+              int64_t input_dim = d_kernel[axis] * dilations[axis] + d_output[axis] * strides[axis] - pads[axis];
+              is_padding |= !math::is_a_ge_zero_and_a_lt_b(input_dim, input_shape[axis]);
+              input_offset *= input_shape[axis];
+              input_offset += input_dim;
+            }
+            if (!is_padding) {
+              const float* data_ptr = Xdata + input_offset * input_channels + group * group_input_channels;
+              for (int64_t ic = 0; ic < group_input_channels; ic++) {
+                sum += data_ptr[ic] * W_data_[(oc * group_input_channels + ic) * kernel_size + kernel_offset];
+              }
+            }
+            kernel_offset++;
+          } while (NextPosition(kernel_rank, kernel_shape, d_kernel.data()));
+          Ydata[oc] = ApplyActivation(sum);
+        }
+        Ydata += output_channels;
+      } while (NextPosition(kernel_rank, output_shape, d_output.data()));
+      Xdata += input_channels * input_image_size;
+    }
+  }
+
+ public:
+  NhwcFusedConvOpTester() {
+  }
+
+  // The input shape is in channels last format and the filter shape is in the standard channels first format.
+  void GenerateRandomInput(const std::vector<int64_t>& X_shape, const std::vector<int64_t>& W_shape,
+                           bool has_bias = false) {
+    X_data_ = GenerateRandomData(ShapeSize(X_shape));
+    X_shape_ = X_shape;
+    W_data_ = GenerateRandomData(ShapeSize(W_shape));
+    W_shape_ = W_shape;
+    if (has_bias) {
+      B_data_ = GenerateRandomData(static_cast<size_t>(W_shape[0]));
+    }
+  }
+
+  void SetPads(const std::vector<int64_t>& pads) {
+    pads_ = pads;
+  }
+
+  void SetStrides(const std::vector<int64_t>& strides) {
+    strides_ = strides;
+  }
+
+  void SetDilations(const std::vector<int64_t>& dilations) {
+    dilations_ = dilations;
+  }
+
+  void SetGroups(int64_t groups) {
+    groups_ = groups;
+  }
+
+  void SetActivation(const std::string& activation, const std::vector<float>& activation_params = {}) {
+    activation_ = activation;
+    activation_params_ = activation_params;
+  }
+
+  void Run() {
+    std::vector<float> Y_data;
+    std::vector<int64_t> Y_shape;
+    ComputeExpectedOutput(Y_data, Y_shape);
+
+    // A constant filter is reordered or packed by PrePack, otherwise it is reordered on every run.
+    for (bool weight_is_initializer : {false, true}) {
+      OpTester test("NhwcFusedConv", 1, onnxruntime::kMSDomain);
+      test.AddInput<float>("X", X_shape_, X_data_);
+      test.AddInput<float>("W", W_shape_, W_data_, weight_is_initializer);
+      if (!B_data_.empty()) {
+        test.AddInput<float>("B", {W_shape_[0]}, B_data_, weight_is_initializer);
+      }
+      test.AddOutput<float>("Y", Y_shape, Y_data);
+      test.SetOutputAbsErr("Y", 1e-4f);
+      if (!pads_.empty()) {
+        test.AddAttribute("pads", pads_);
+      }
+      if (!strides_.empty()) {
+        test.AddAttribute("strides", strides_);
+      }
+      if (!dilations_.empty()) {
+        test.AddAttribute("dilations", dilations_);
+      }
+      test.AddAttribute("group", groups_);
+      if (!activation_.empty()) {
+        test.AddAttribute("activation", activation_);
+        if (!activation_params_.empty()) {
+          test.AddAttribute("activation_params", activation_params_);
+        }
+      }
+      test.Run(OpTester::ExpectResult::kExpectSuccess, "");
+    }
+  }
+};
+
+TEST(NhwcFusedConvContribOpTest, Conv1D) {
+  NhwcFusedConvOpTester test;
+  test.GenerateRandomInput({2, 23, 12}, {16, 12, 5});
+  test.SetPads({2, 2});
+  test.Run();
+}
+
+TEST(NhwcFusedConvContribOpTest, Conv2D) {
+  NhwcFusedConvOpTester test;
+  test.GenerateRandomInput({1, 15, 19, 12}, {16, 12, 3, 5});
+  test.SetPads({1, 2, 1, 2});
+  test.Run();
+}
+
+TEST(NhwcFusedConvContribOpTest, Conv3D) {
+  NhwcFusedConvOpTester test;
+  test.GenerateRandomInput({1, 7, 9, 11, 6}, {10, 6, 2, 3, 3});
+  test.SetPads({0, 1, 1, 1, 1, 1});
+  test.Run();
+}
+
+TEST(NhwcFusedConvContribOpTest, Conv2D_Bias) {
+  NhwcFusedConvOpTester test;
+  test.GenerateRandomInput({2, 11, 13, 8}, {24, 8, 3, 3}, true);
+  test.SetPads({1, 1, 1, 1});
+  test.Run();
+}
+
+TEST(NhwcFusedConvContribOpTest, Conv2D_StridesDilations) {
+  NhwcFusedConvOpTester test;
+  test.GenerateRandomInput({2, 23, 19, 8}, {16, 8, 3, 3}, true);
+  test.SetStrides({2, 2});
+  test.SetDilations({2, 1});
+  test.Run();
+}
+
+TEST(NhwcFusedConvContribOpTest, Conv1D_Groups) {
+  NhwcFusedConvOpTester test;
+  test.GenerateRandomInput({1, 17, 12}, {18, 4, 3}, true);
+  test.SetGroups(3);
+  test.SetPads({1, 1});
+  test.Run();
+}
+
+TEST(NhwcFusedConvContribOpTest, Conv2D_Groups) {
+  NhwcFusedConvOpTester test;
+  test.GenerateRandomInput({2, 9, 11, 16}, {12, 4, 3, 3}, true);
+  test.SetGroups(4);
+  test.SetPads({1, 1, 1, 1});
+  test.Run();
+}
+
+TEST(NhwcFusedConvContribOpTest, Conv3D_Groups) {
+  NhwcFusedConvOpTester test;
+  test.GenerateRandomInput({1, 5, 7, 9, 8}, {6, 4, 3, 3, 3}, true);
+  test.SetGroups(2);
+  test.SetPads({1, 1, 1, 1, 1, 1});
+  test.Run();
+}
+
+TEST(NhwcFusedConvContribOpTest, Conv2D_Depthwise) {
+  NhwcFusedConvOpTester test;
+  test.GenerateRandomInput({2, 13, 17, 24}, {24, 1, 3, 3}, true);
+  test.SetGroups(24);
+  test.SetPads({1, 1, 1, 1});
+  test.SetActivation("Relu");
+  test.Run();
+}
+
+TEST(NhwcFusedConvContribOpTest, Conv2D_Pointwise) {
+  NhwcFusedConvOpTester test;
+  test.GenerateRandomInput({2, 13, 17, 24}, {32, 24, 1, 1}, true);
+  test.Run();
+}
+
+TEST(NhwcFusedConvContribOpTest, Conv2D_PointwiseGroups) {
+  // Reads the input in place with rows strided by all of the channels.
+  NhwcFusedConvOpTester test;
+  test.GenerateRandomInput({2, 13, 17, 24}, {16, 8, 1, 1}, true);
+  test.SetGroups(3);
+  test.Run();
+}
+
+TEST(NhwcFusedConvContribOpTest, Conv2D_PointwiseStrides) {
+  // Needs the im2col transform even though the kernel is a single pixel.
+  NhwcFusedConvOpTester test;
+  test.GenerateRandomInput({2, 13, 17, 24}, {32, 24, 1, 1}, true);
+  test.SetStrides({2, 2});
+  test.Run();
+}
+
+TEST(NhwcFusedConvContribOpTest, Conv1D_PointwiseStrides) {
+  NhwcFusedConvOpTester test;
+  test.GenerateRandomInput({1, 25, 16}, {8, 16, 1}, true);
+  test.SetStrides({3});
+  test.SetActivation("Relu");
+  test.Run();
+}
+
+TEST(NhwcFusedConvContribOpTest, Conv2D_Activations) {
+  const std::vector<std::pair<std::string, std::vector<float>>> activations = {
+      {"Relu", {}},
+      {"LeakyRelu", {0.125f}},
+      {"Clip", {-0.5f, 0.75f}},
+      {"Sigmoid", {}},
+      {"Tanh", {}},
+      {"HardSigmoid", {0.25f, 0.5f}},
+      {"Softplus", {}},
+      {"HardSwish", {}},
+  };
+
+  for (const auto& activation : activations) {
+    SCOPED_TRACE(activation.first);
+
+    // Standard convolution, which applies the activation after the GEMM.
+    NhwcFusedConvOpTester test;
+    test.GenerateRandomInput({1, 9, 11, 8}, {16, 8, 3, 3}, true);
+    test.SetPads({1, 1, 1, 1});
+    test.SetActivation(activation.first, activation.second);
+    test.Run();
+
+    // Depthwise convolution, which applies the activation in MlasConvDepthwise.
+    NhwcFusedConvOpTester depthwise_test;
+    depthwise_test.GenerateRandomInput({1, 9, 11, 16}, {16, 1, 3, 3}, true);
+    depthwise_test.SetGroups(16);
+    depthwise_test.SetPads({1, 1, 1, 1});
+    depthwise_test.SetActivation(activation.first, activation.second);
+    depthwise_test.Run();
+  }
+}
+
+}  // namespace test
+}  // namespace onnxruntime
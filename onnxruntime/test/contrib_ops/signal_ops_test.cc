@@ -120,6 +120,113 @@ TEST(MLSignalOpTest, STFTFloat) {
   test.Run();
 }
 
+// Computes the DFT of each batch of a real or complex signal with the naive O(n^2) definition.
+static std::vector<float> ReferenceDFT(const std::vector<float>& input, int64_t batch_size, int64_t n,
+                                       bool is_complex, int64_t output_size, bool inverse) {
+  const double pi = 3.14159265358979323846;
+  const int64_t components = is_complex ? 2 : 1;
+  std::vector<float> output;
+  for (int64_t b = 0; b < batch_size; b++) {
+    for (int64_t k = 0; k < output_size; k++) {
+      double real = 0, imag = 0;
+      for (int64_t j = 0; j < n; j++) {
+        const double angle = (inverse ? 2 : -2) * pi * static_cast<double>((k * j) % n) / n;
+        const double x_real = input[(b * n + j) * components];
+        const double x_imag = is_complex ? input[(b * n + j) * components + 1] : 0;
+        real += x_real * std::cos(angle) - x_imag * std::sin(angle);
+        imag += x_real * std::sin(angle) + x_imag * std::cos(angle);
+      }
+      output.push_back(static_cast<float>(inverse ? real / n : real));
+      output.push_back(static_cast<float>(inverse ? imag / n : imag));
+    }
+  }
+  return output;
+}
+
+static void TestDFTFloatLength(int64_t n, bool is_onesided) {
+  OpTester test("DFT", 1, onnxruntime::kMSExperimentalDomain);
+
+  const int64_t batch_size = 2;
+  std::vector<float> input(static_cast<size_t>(batch_size * n));
+  for (size_t i = 0; i < input.size(); i++) {
+    input[i] = static_cast<float>(i % 7) - 2.5f;
+  }
+
+  const int64_t output_size = is_onesided ? (n >> 1) + 1 : n;
+  test.AddInput<float>("input", {batch_size, n}, input);
+  test.AddAttribute<int64_t>("onesided", static_cast<int64_t>(is_onesided));
+  test.AddOutput<float>("output", {batch_size, output_size, 2}, ReferenceDFT(input, batch_size, n, false, output_size, false));
+  test.SetOutputAbsErr("output", 2e-3f);
+  test.Run();
+}
+
+// Lengths with factors of 2, 3, 4 and 5 use the mixed-radix transform, other
+// lengths use Bluestein's algorithm. Even lengths transform real signals at
+// half the length.
+TEST(MLSignalOpTest, DFTFloatMixedRadix) {
+  for (int64_t n : {1, 2, 6, 12, 30, 60, 400}) {
+    TestDFTFloatLength(n, false);
+    TestDFTFloatLength(n, true);
+  }
+}
+
+TEST(MLSignalOpTest, DFTFloatBluestein) {
+  for (int64_t n : {7, 14, 97}) {
+    TestDFTFloatLength(n, false);
+    TestDFTFloatLength(n, true);
+  }
+}
+
+TEST(MLSignalOpTest, IDFTFloatMixedRadix) {
+  OpTester test("IDFT", 1, onnxruntime::kMSExperimentalDomain);
+
+  const int64_t batch_size = 3;
+  const int64_t n = 15;
+  std::vector<float> input(static_cast<size_t>(batch_size * n * 2));
+  for (size_t i = 0; i < input.size(); i++) {
+    input[i] = static_cast<float>(i % 11) * 0.5f - 2.0f;
+  }
+
+  test.AddInput<float>("input", {batch_size, n, 2}, input);
+  test.AddOutput<float>("output", {batch_size, n, 2}, ReferenceDFT(input, batch_size, n, true, n, true));
+  test.Run();
+}
+
+TEST(MLSignalOpTest, STFTFloatMixedRadix) {
+  OpTester test("STFT", 1, onnxruntime::kMSExperimentalDomain);
+
+  const int64_t signal_size = 64;
+  const int64_t frame_length = 10;
+  const int64_t frame_step = 6;
+  const int64_t n_dfts = (signal_size - frame_length) / frame_step + 1;
+  const int64_t output_size = (frame_length >> 1) + 1;
+
+  std::vector<float> signal(signal_size);
+  for (size_t i = 0; i < signal.size(); i++) {
+    signal[i] = static_cast<float>(i % 9) - 4.0f;
+  }
+  std::vector<float> window(frame_length);
+  for (size_t i = 0; i < window.size(); i++) {
+    window[i] = 0.25f * static_cast<float>(i + 1);
+  }
+
+  // Window each frame and compute its reference transform.
+  std::vector<float> frames;
+  for (int64_t f = 0; f < n_dfts; f++) {
+    for (int64_t i = 0; i < frame_length; i++) {
+      frames.push_back(signal[f * frame_step + i] * window[i]);
+    }
+  }
+
+  test.AddInput<float>("signal", {1, signal_size}, signal);
+  test.AddInput<float>("window", {frame_length}, window);
+  test.AddInput<int64_t>("frame_length", {}, {frame_length});
+  test.AddInput<int64_t>("frame_step", {}, {frame_step});
+  test.AddOutput<float>("output", {1, n_dfts, output_size, 2}, ReferenceDFT(frames, n_dfts, frame_length, false, output_size, false));
+  test.SetOutputAbsErr("output", 1e-3f);
+  test.Run();
+}
+
 TEST(MLSignalOpTest, HannWindowFloat) {
   OpTester test("HannWindow", 1, onnxruntime::kMSExperimentalDomain);
 
@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 
 #include "core/framework/bfc_arena.h"
+#include "core/platform/threadpool.h"
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
 #include <cstdlib>
@@ -285,6 +286,38 @@ TEST(BFCArenaTest, TestReserve) {
   EXPECT_EQ(stats.total_allocated_bytes, 1048576);
 }
 
+TEST(BFCArenaTest, TestRequestAccounting) {
+  BFCArena a(std::unique_ptr<IAllocator>(new CPUAllocator()), 1 << 30);
+  concurrency::ThreadPool::RequestAccounting accounting;
+  concurrency::ThreadPool::RequestContext request;
+  request.accounting = &accounting;
+
+  void* before_ptr = a.Alloc(1024);
+  a.StartRequestAccounting(accounting.id);
+  void* first_ptr;
+  void* second_ptr;
+  void* third_ptr;
+  {
+    concurrency::ThreadPool::RequestScope request_scope(&request);
+    first_ptr = a.Alloc(4096);
+    second_ptr = a.Alloc(4096);
+    a.Free(first_ptr);
+    third_ptr = a.Alloc(1024);
+  }
+  // Not allocated on behalf of the request.
+  void* after_ptr = a.Alloc(16384);
+
+  EXPECT_EQ(a.EndRequestAccounting(accounting.id), 8192u);
+  EXPECT_EQ(a.EndRequestAccounting(accounting.id), 0u);
+
+  // Memory still attributed to the request may be freed once accounting ended.
+  a.Free(second_ptr);
+  a.Free(third_ptr);
+  a.Free(before_ptr);
+  a.Free(after_ptr);
+  EXPECT_EQ(a.Used(), 0u);
+}
+
 class BadAllocator : public IAllocator {
  public:
   BadAllocator() : IAllocator(OrtMemoryInfo(CPU, OrtAllocatorType::OrtDeviceAllocator)) {}
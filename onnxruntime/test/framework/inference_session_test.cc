@@ -187,8 +187,7 @@ template <typename T = float>
 void VerifyOutputs(const Tensor& tensor, const std::vector<int64_t>& expected_dims,
                    const std::vector<T>& expected_values) {
   TensorShape expected_shape(expected_dims);
-  //Use reinterpret_cast to bypass a gcc bug: https://gcc.gnu.org/bugzilla/show_bug.cgi?id=51213
-  ASSERT_EQ(*reinterpret_cast<const std::vector<int64_t>*>(&expected_shape), *reinterpret_cast<const std::vector<int64_t>*>(&tensor.Shape()));
+  ASSERT_EQ(expected_shape.GetDimsAsVector(), tensor.Shape().GetDimsAsVector());
   const std::vector<T> found(tensor.template Data<T>(),
                              tensor.template Data<T>() + expected_values.size());
   ASSERT_EQ(expected_values, found);
@@ -685,6 +684,349 @@ TEST(InferenceSessionTests, CheckRunProfilerWithStartProfile) {
   }
 }
 
+TEST(InferenceSessionTests, CheckOperatorMetrics) {
+  SessionOptions so;
+
+  so.session_logid = "CheckOperatorMetrics";
+  so.AddConfigEntry(kOrtSessionOptionsEnableOperatorMetrics, "1");
+
+  InferenceSession session_object(so, GetEnvironment());
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  RunOptions run_options;
+  run_options.run_tag = "RunTag";
+
+  RunModel(session_object, run_options);
+  RunModel(session_object, run_options);
+
+  std::string metrics;
+  ASSERT_STATUS_OK(session_object.GetOperatorMetrics(metrics));
+  ASSERT_TRUE(metrics.find("\"op_type\":\"Mul\",\"count\":2,") != string::npos) << metrics;
+  ASSERT_TRUE(metrics.find("\"histogram_bounds_ns\":[1024,") != string::npos) << metrics;
+}
+
+TEST(InferenceSessionTests, CheckOperatorMetricsDisabled) {
+  SessionOptions so;
+
+  so.session_logid = "CheckOperatorMetricsDisabled";
+
+  InferenceSession session_object(so, GetEnvironment());
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  std::string metrics;
+  ASSERT_FALSE(session_object.GetOperatorMetrics(metrics).IsOK());
+}
+
+TEST(InferenceSessionTests, CheckRunStatistics) {
+  SessionOptions so;
+
+  so.session_logid = "CheckRunStatistics";
+
+  InferenceSession session_object(so, GetEnvironment());
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  std::vector<int64_t> dims_mul_x = {3, 2};
+  std::vector<float> values_mul_x = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f};
+  OrtValue ml_value;
+  CreateMLValue<float>(TestCPUExecutionProvider()->GetAllocator(0, OrtMemTypeDefault), dims_mul_x, values_mul_x,
+                       &ml_value);
+  std::vector<std::string> feed_names{"X"};
+  std::vector<OrtValue> feeds{ml_value};
+  std::vector<std::string> output_names{"Y"};
+  std::vector<OrtValue> fetches;
+
+  RunStatistics statistics;
+  ASSERT_STATUS_OK(session_object.RunWithStatistics(RunOptions{}, feed_names, feeds, output_names, &fetches,
+                                                    statistics));
+  VerifyOutputs(fetches, {3, 2}, {1.0f, 4.0f, 9.0f, 16.0f, 25.0f, 36.0f});
+
+  ASSERT_GT(statistics.wall_time_ns, 0u);
+  ASSERT_EQ(statistics.kernels_executed, 1u);
+  ASSERT_EQ(statistics.bytes_copied, 0u);
+
+  // The output of the run is allocated from the CPU arena.
+  auto cpu_arena = std::find_if(statistics.arenas.cbegin(), statistics.arenas.cend(),
+                                [](const RunStatistics::ArenaUsage& arena) { return arena.name == CPU; });
+  ASSERT_NE(cpu_arena, statistics.arenas.cend());
+  ASSERT_GE(cpu_arena->peak_bytes, values_mul_x.size() * sizeof(float));
+
+  std::string json = statistics.ToJson();
+  ASSERT_TRUE(json.find("\"kernels_executed\":1,") != string::npos) << json;
+}
+
+// A chain of MatMul nodes that takes long enough to run for a short deadline to pass in the middle of it.
+static void CreateMatMulChainModel(std::string& model_data, int64_t dim, int num_nodes) {
+  onnxruntime::Model model("matmul_chain", false, DefaultLoggingManager().DefaultLogger());
+  auto& graph = model.MainGraph();
+
+  ONNX_NAMESPACE::TypeProto float_tensor;
+  float_tensor.mutable_tensor_type()->set_elem_type(ONNX_NAMESPACE::TensorProto_DataType_FLOAT);
+  float_tensor.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(dim);
+  float_tensor.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(dim);
+
+  ONNX_NAMESPACE::TensorProto weight{};
+  weight.set_name("W");
+  weight.add_dims(dim);
+  weight.add_dims(dim);
+  weight.set_data_type(ONNX_NAMESPACE::TensorProto_DataType_FLOAT);
+  for (int64_t i = 0; i < dim * dim; ++i) {
+    weight.add_float_data(1.f / dim);
+  }
+  graph.AddInitializedTensor(weight);
+
+  auto* input_arg = &graph.GetOrCreateNodeArg("X", &float_tensor);
+  auto& weight_arg = graph.GetOrCreateNodeArg("W", &float_tensor);
+  for (int i = 0; i < num_nodes; ++i) {
+    const std::string name = "matmul_" + std::to_string(i);
+    auto& output_arg = graph.GetOrCreateNodeArg(i == num_nodes - 1 ? "Y" : name, &float_tensor);
+    graph.AddNode(name, "MatMul", name, {input_arg, &weight_arg}, {&output_arg});
+    input_arg = &output_arg;
+  }
+  ASSERT_STATUS_OK(graph.Resolve());
+
+  model.ToProto().SerializeToString(&model_data);
+}
+
+TEST(InferenceSessionTests, RunDeadline) {
+  const int64_t dim = 256;
+  std::string model_data;
+  CreateMatMulChainModel(model_data, dim, 64);
+
+  for (auto execution_mode : {ExecutionMode::ORT_SEQUENTIAL, ExecutionMode::ORT_PARALLEL}) {
+    SessionOptions so;
+    so.session_logid = "RunDeadline";
+    so.execution_mode = execution_mode;
+    so.inter_op_param.thread_pool_size = 2;
+    InferenceSession session_object{so, GetEnvironment()};
+    ASSERT_STATUS_OK(session_object.Load(model_data.data(), static_cast<int>(model_data.size())));
+    ASSERT_STATUS_OK(session_object.Initialize());
+
+    std::vector<int64_t> dims{dim, dim};
+    std::vector<float> values(dim * dim, 1.f);
+    OrtValue ml_value;
+    CreateMLValue<float>(TestCPUExecutionProvider()->GetAllocator(0, OrtMemTypeDefault), dims, values, &ml_value);
+    NameMLValMap feeds{{"X", ml_value}};
+    std::vector<std::string> output_names{"Y"};
+
+    // The deadline passes while the chain is running, and the run fails instead of returning outputs.
+    RunOptions run_options;
+    run_options.deadline_ms = 1;
+    std::vector<OrtValue> fetches;
+    auto status = session_object.Run(run_options, feeds, output_names, &fetches);
+    ASSERT_FALSE(status.IsOK());
+    ASSERT_TRUE(status.ErrorMessage().find("deadline") != std::string::npos ||
+                status.ErrorMessage().find("cancelled") != std::string::npos)
+        << status.ErrorMessage();
+
+    // A deadline that is not reached does not affect the run, and the session remains usable.
+    run_options.deadline_ms = 60 * 60 * 1000;
+    fetches.clear();
+    ASSERT_STATUS_OK(session_object.Run(run_options, feeds, output_names, &fetches));
+    VerifyOutputs(fetches, dims, values);
+  }
+}
+
+// Y = -abs(X) with a symbolic batch dimension, so runs with different input shapes share the session.
+static void CreateStaticShapeReplayModel(std::string& model_data) {
+  onnxruntime::Model model("static_shape_replay", false, DefaultLoggingManager().DefaultLogger());
+  auto& graph = model.MainGraph();
+
+  ONNX_NAMESPACE::TypeProto float_tensor;
+  float_tensor.mutable_tensor_type()->set_elem_type(ONNX_NAMESPACE::TensorProto_DataType_FLOAT);
+  float_tensor.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_param("N");
+  float_tensor.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(2);
+
+  auto& x_arg = graph.GetOrCreateNodeArg("X", &float_tensor);
+  auto& abs_arg = graph.GetOrCreateNodeArg("abs_out", &float_tensor);
+  auto& y_arg = graph.GetOrCreateNodeArg("Y", &float_tensor);
+  graph.AddNode("abs", "Abs", "abs", {&x_arg}, {&abs_arg});
+  graph.AddNode("neg", "Neg", "neg", {&abs_arg}, {&y_arg});
+  ASSERT_STATUS_OK(graph.Resolve());
+
+  model.ToProto().SerializeToString(&model_data);
+}
+
+static void InitializeStaticShapeReplaySession(InferenceSessionWrapper& session_object, const std::string& model_data) {
+  ASSERT_STATUS_OK(session_object.Load(model_data.data(), static_cast<int>(model_data.size())));
+  ASSERT_STATUS_OK(session_object.Initialize());
+  ASSERT_NE(session_object.GetSessionState().GetStaticShapeReplay(), nullptr);
+}
+
+static SessionOptions StaticShapeReplaySessionOptions() {
+  SessionOptions so;
+  so.session_logid = "StaticShapeReplay";
+  so.graph_optimization_level = TransformerLevel::Default;
+  so.AddConfigEntry(kOrtSessionOptionsEnableStaticShapeReplay, "1");
+  return so;
+}
+
+// Runs the Abs/Neg model with a batch whose values are offset by seed and checks Y.
+static void RunStaticShapeReplayModel(InferenceSession& session_object, int64_t batch, float seed = 0.f) {
+  std::vector<int64_t> dims{batch, 2};
+  std::vector<float> values;
+  std::vector<float> expected_values;
+  for (int64_t i = 0; i < batch * 2; ++i) {
+    const float value = seed + static_cast<float>(i);
+    values.push_back(i % 2 == 0 ? value : -value);
+    expected_values.push_back(-value);
+  }
+
+  OrtValue ml_value;
+  CreateMLValue<float>(TestCPUExecutionProvider()->GetAllocator(0, OrtMemTypeDefault), dims, values, &ml_value);
+  NameMLValMap feeds{{"X", ml_value}};
+  std::vector<std::string> output_names{"Y"};
+  std::vector<OrtValue> fetches;
+  ASSERT_STATUS_OK(session_object.Run(RunOptions{}, feeds, output_names, &fetches));
+  VerifyOutputs(fetches, dims, expected_values);
+}
+
+TEST(InferenceSessionTests, StaticShapeReplay) {
+  std::string model_data;
+  CreateStaticShapeReplayModel(model_data);
+
+  InferenceSessionWrapper session_object{StaticShapeReplaySessionOptions(), GetEnvironment()};
+  InitializeStaticShapeReplaySession(session_object, model_data);
+  const StaticShapeReplay* replay = session_object.GetSessionState().GetStaticShapeReplay();
+
+  // The first run generates the memory pattern, the second uses it and is recorded, the third is replayed.
+  RunStaticShapeReplayModel(session_object, 3);
+  RunStaticShapeReplayModel(session_object, 3);
+  ASSERT_EQ(replay->ReplayCount(), 0u);
+  RunStaticShapeReplayModel(session_object, 3);
+  ASSERT_EQ(replay->ReplayCount(), 1u);
+
+  // Other input shapes use the regular execution path.
+  RunStaticShapeReplayModel(session_object, 4);
+  RunStaticShapeReplayModel(session_object, 4);
+  ASSERT_EQ(replay->ReplayCount(), 1u);
+
+  RunStaticShapeReplayModel(session_object, 3);
+  ASSERT_EQ(replay->ReplayCount(), 2u);
+}
+
+// A run that fetches an intermediate value of the recording must not be given the recorded tensor, which the next
+// replay would overwrite.
+TEST(InferenceSessionTests, StaticShapeReplayWithOtherFetches) {
+  std::string model_data;
+  CreateStaticShapeReplayModel(model_data);
+
+  InferenceSessionWrapper session_object{StaticShapeReplaySessionOptions(), GetEnvironment()};
+  InitializeStaticShapeReplaySession(session_object, model_data);
+  const StaticShapeReplay* replay = session_object.GetSessionState().GetStaticShapeReplay();
+
+  RunStaticShapeReplayModel(session_object, 3);
+  RunStaticShapeReplayModel(session_object, 3);
+  RunStaticShapeReplayModel(session_object, 3);
+  ASSERT_EQ(replay->ReplayCount(), 1u);
+
+  std::vector<int64_t> dims{3, 2};
+  std::vector<float> values{1.f, -2.f, 3.f, -4.f, 5.f, -6.f};
+  std::vector<float> expected_abs{1.f, 2.f, 3.f, 4.f, 5.f, 6.f};
+  OrtValue ml_value;
+  CreateMLValue<float>(TestCPUExecutionProvider()->GetAllocator(0, OrtMemTypeDefault), dims, values, &ml_value);
+  NameMLValMap feeds{{"X", ml_value}};
+  std::vector<std::string> output_names{"abs_out", "Y"};
+  std::vector<OrtValue> fetches;
+  ASSERT_STATUS_OK(session_object.Run(RunOptions{}, feeds, output_names, &fetches));
+  ASSERT_EQ(replay->ReplayCount(), 1u);
+  ASSERT_EQ(fetches.size(), 2u);
+  VerifyOutputs(fetches[0].Get<Tensor>(), dims, expected_abs);
+
+  // A later replay with other values leaves the fetched intermediate value alone.
+  RunStaticShapeReplayModel(session_object, 3, 100.f);
+  ASSERT_EQ(replay->ReplayCount(), 2u);
+  VerifyOutputs(fetches[0].Get<Tensor>(), dims, expected_abs);
+}
+
+// Y = -NonZero(X). The shape of the NonZero output depends on the values of X, so a replay with the recorded input
+// shape can need an intermediate value with another shape.
+TEST(InferenceSessionTests, StaticShapeReplayWithDataDependentShape) {
+  onnxruntime::Model model("static_shape_replay_nonzero", false, DefaultLoggingManager().DefaultLogger());
+  auto& graph = model.MainGraph();
+
+  ONNX_NAMESPACE::TypeProto float_tensor;
+  float_tensor.mutable_tensor_type()->set_elem_type(ONNX_NAMESPACE::TensorProto_DataType_FLOAT);
+  float_tensor.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_param("N");
+  float_tensor.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(2);
+  ONNX_NAMESPACE::TypeProto int64_tensor;
+  int64_tensor.mutable_tensor_type()->set_elem_type(ONNX_NAMESPACE::TensorProto_DataType_INT64);
+
+  auto& x_arg = graph.GetOrCreateNodeArg("X", &float_tensor);
+  auto& nonzero_arg = graph.GetOrCreateNodeArg("nonzero_out", &int64_tensor);
+  auto& y_arg = graph.GetOrCreateNodeArg("Y", &int64_tensor);
+  graph.AddNode("nonzero", "NonZero", "nonzero", {&x_arg}, {&nonzero_arg});
+  graph.AddNode("neg", "Neg", "neg", {&nonzero_arg}, {&y_arg});
+  ASSERT_STATUS_OK(graph.Resolve());
+
+  std::string model_data;
+  model.ToProto().SerializeToString(&model_data);
+
+  InferenceSessionWrapper session_object{StaticShapeReplaySessionOptions(), GetEnvironment()};
+  InitializeStaticShapeReplaySession(session_object, model_data);
+  const StaticShapeReplay* replay = session_object.GetSessionState().GetStaticShapeReplay();
+
+  auto run = [&session_object](const std::vector<float>& values, const std::vector<int64_t>& expected_dims,
+                               const std::vector<int64_t>& expected_values) {
+    OrtValue ml_value;
+    CreateMLValue<float>(TestCPUExecutionProvider()->GetAllocator(0, OrtMemTypeDefault), {2, 2}, values, &ml_value);
+    NameMLValMap feeds{{"X", ml_value}};
+    std::vector<std::string> output_names{"Y"};
+    std::vector<OrtValue> fetches;
+    ASSERT_STATUS_OK(session_object.Run(RunOptions{}, feeds, output_names, &fetches));
+    ASSERT_EQ(fetches.size(), 1u);
+    VerifyOutputs<int64_t>(fetches[0].Get<Tensor>(), expected_dims, expected_values);
+  };
+
+  // Two non-zero values are recorded.
+  run({1.f, 0.f, 0.f, 1.f}, {2, 2}, {0, -1, 0, -1});
+  run({1.f, 0.f, 0.f, 1.f}, {2, 2}, {0, -1, 0, -1});
+  run({0.f, 2.f, 3.f, 0.f}, {2, 2}, {0, -1, -1, 0});
+  ASSERT_EQ(replay->ReplayCount(), 1u);
+
+  // Three non-zero values do not match the recorded shape of the NonZero output, which is allocated as usual.
+  run({1.f, 2.f, 0.f, 4.f}, {2, 3}, {0, 0, -1, 0, -1, -1});
+  ASSERT_EQ(replay->ReplayCount(), 2u);
+
+  run({0.f, 0.f, 0.f, 0.f}, {2, 0}, {});
+  run({1.f, 0.f, 0.f, 1.f}, {2, 2}, {0, -1, 0, -1});
+  ASSERT_EQ(replay->ReplayCount(), 4u);
+}
+
+// Only one run replays at a time. Concurrent runs with the recorded shapes take the regular path and must not see
+// the values of the replay.
+TEST(InferenceSessionTests, StaticShapeReplayConcurrentRuns) {
+  std::string model_data;
+  CreateStaticShapeReplayModel(model_data);
+
+  InferenceSessionWrapper session_object{StaticShapeReplaySessionOptions(), GetEnvironment()};
+  InitializeStaticShapeReplaySession(session_object, model_data);
+  const StaticShapeReplay* replay = session_object.GetSessionState().GetStaticShapeReplay();
+
+  RunStaticShapeReplayModel(session_object, 3);
+  RunStaticShapeReplayModel(session_object, 3);
+
+  constexpr int num_threads = 4;
+  constexpr int num_runs = 25;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < num_threads; ++t) {
+    threads.emplace_back([&session_object, t]() {
+      for (int i = 0; i < num_runs; ++i) {
+        RunStaticShapeReplayModel(session_object, 3, static_cast<float>(t * 1000 + i * 10));
+      }
+    });
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  ASSERT_GT(replay->ReplayCount(), 0u);
+  ASSERT_LE(replay->ReplayCount(), static_cast<size_t>(num_threads * num_runs));
+}
+
 TEST(InferenceSessionTests, CheckRunProfilerStartTime) {
   // Test whether the InferenceSession can access the profiler's start time
   SessionOptions so;
@@ -1697,8 +2039,7 @@ TEST(InferenceSessionTests, TestTruncatedSequence) {
   ASSERT_EQ(1u, fetches.size());
   auto& rtensor = fetches.front().Get<Tensor>();
   TensorShape expected_shape(Y_dims);
-  //Use reinterpret_cast to bypass a gcc bug: https://gcc.gnu.org/bugzilla/show_bug.cgi?id=51213
-  ASSERT_EQ(*reinterpret_cast<const std::vector<int64_t>*>(&expected_shape), *reinterpret_cast<const std::vector<int64_t>*>(&rtensor.Shape()));
+  ASSERT_EQ(expected_shape.GetDimsAsVector(), rtensor.Shape().GetDimsAsVector());
   for (size_t i = 0; i < Y_data.size(); ++i)
     EXPECT_NEAR(Y_data[i], rtensor.template Data<float>()[i], FLT_EPSILON);
 
@@ -1740,8 +2081,7 @@ TEST(InferenceSessionTests, TestTruncatedSequence) {
     std::vector<int64_t> truncated_output_dims = Y_dims;
     truncated_output_dims[0] = truncated_len;
     TensorShape truncated_shape(truncated_output_dims);
-    //Use reinterpret_cast to bypass a gcc bug: https://gcc.gnu.org/bugzilla/show_bug.cgi?id=51213
-    ASSERT_EQ(*reinterpret_cast<const std::vector<int64_t>*>(&truncated_shape), *reinterpret_cast<const std::vector<int64_t>*>(&truncated_rtensor.Shape()));
+    ASSERT_EQ(truncated_shape.GetDimsAsVector(), truncated_rtensor.Shape().GetDimsAsVector());
     auto seq_output_stride = truncated_shape.SizeFromDimension(1);
     for (int i = 0; i < truncated_shape.Size(); ++i)
       EXPECT_NEAR(Y_data[i + seq_start * seq_output_stride], truncated_rtensor.template Data<float>()[i], FLT_EPSILON);
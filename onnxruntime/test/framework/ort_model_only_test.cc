@@ -74,7 +74,7 @@ static void CompareTensors(const OrtValue& left_value, const OrtValue& right_val
   const Tensor& left = left_value.Get<Tensor>();
   const Tensor& right = right_value.Get<Tensor>();
 
-  ASSERT_EQ(left.Shape().GetDims(), right.Shape().GetDims());
+  ASSERT_EQ(left.Shape().GetDimsAsVector(), right.Shape().GetDimsAsVector());
   ASSERT_EQ(left.GetElementType(), right.GetElementType());
 
   if (left.IsDataTypeString()) {
@@ -395,6 +395,164 @@ INSTANTIATE_TEST_SUITE_P(SessionStateTests,
                                          PrepackingTestParam{false, true},
                                          PrepackingTestParam{true, false},
                                          PrepackingTestParam{true, true}));
+
+// Records what the session passed to PrePackSparse and PrePack for the sparse initializer.
+struct SparsePrePackingResult {
+  size_t sparse_num_values{0};
+  std::vector<float> dense_values;
+};
+
+class SparsePrePackingTestOpKernel : public OpKernel {
+ public:
+  SparsePrePackingTestOpKernel(const OpKernelInfo& info, bool pack_sparse, SparsePrePackingResult& result)
+      : OpKernel(info), pack_sparse_(pack_sparse), result_(result) {}
+
+  Status Compute(OpKernelContext* context) const override {
+    ORT_UNUSED_PARAMETER(context);
+    return Status::OK();
+  }
+
+  Status PrePackSparse(const SparseTensor& tensor, int input_idx, bool& is_packed) override {
+    ORT_RETURN_IF_NOT(input_idx == 1, "Unexpected sparse input ", input_idx);
+    result_.sparse_num_values = tensor.NumValues();
+    is_packed = pack_sparse_;
+    return Status::OK();
+  }
+
+  Status PrePack(const Tensor& tensor, int input_idx, bool& is_packed) override {
+    ORT_RETURN_IF_NOT(input_idx == 1, "Unexpected dense input ", input_idx);
+    const float* data = tensor.Data<float>();
+    result_.dense_values.assign(data, data + tensor.Shape().Size());
+    is_packed = false;
+    return Status::OK();
+  }
+
+ private:
+  bool pack_sparse_;
+  SparsePrePackingResult& result_;
+};
+
+// Model with a single SparsePrePackingTest node whose second input is the 2x3 sparse initializer
+// [[0, 2, 0], [0, 0, 5]].
+static void CreateModelWithSparseInitializer(ModelProto& model_proto) {
+  std::unordered_map<std::string, int> domain_to_version;
+  domain_to_version[kOnnxDomain] = 11;
+  Model model("sparse_prepacking", false, ModelMetaData(), PathString(), IOnnxRuntimeOpSchemaRegistryList(),
+              domain_to_version, std::vector<ONNX_NAMESPACE::FunctionProto>(),
+              DefaultLoggingManager().DefaultLogger());
+  model_proto = model.ToProto();
+
+  auto& graph_proto = *model_proto.mutable_graph();
+  graph_proto.set_name("sparse_prepacking");
+  auto* node = graph_proto.add_node();
+  node->set_op_type("SparsePrePackingTest");
+  node->add_input("input");
+  node->add_input("sparse_weight");
+  node->add_output("output");
+
+  for (auto* value_info : {graph_proto.add_input(), graph_proto.add_output()}) {
+    auto* tensor_type = value_info->mutable_type()->mutable_tensor_type();
+    tensor_type->set_elem_type(TensorProto_DataType_FLOAT);
+    tensor_type->mutable_shape()->add_dim()->set_dim_value(2);
+    tensor_type->mutable_shape()->add_dim()->set_dim_value(3);
+  }
+  graph_proto.mutable_input(0)->set_name("input");
+  graph_proto.mutable_output(0)->set_name("output");
+
+  auto& sparse_initializer = *graph_proto.add_sparse_initializer();
+  sparse_initializer.add_dims(2);
+  sparse_initializer.add_dims(3);
+  auto& values = *sparse_initializer.mutable_values();
+  values.set_name("sparse_weight");
+  values.set_data_type(TensorProto_DataType_FLOAT);
+  values.add_dims(2);
+  values.add_float_data(2.0f);
+  values.add_float_data(5.0f);
+  auto& indices = *sparse_initializer.mutable_indices();
+  indices.set_data_type(TensorProto_DataType_INT64);
+  indices.add_dims(2);
+  indices.add_int64_data(1);
+  indices.add_int64_data(5);
+}
+
+class SessionStateSparsePrepackingTest : public testing::TestWithParam<bool> {};
+TEST_P(SessionStateSparsePrepackingTest, PrePackSparseInitializer) {
+  const bool pack_sparse = GetParam();
+
+  OrtThreadPoolParams to;
+  auto tp = concurrency::CreateThreadPool(&onnxruntime::Env::Default(), to, concurrency::ThreadPoolType::INTRA_OP);
+  ONNX_OPERATOR_SCHEMA(SparsePrePackingTest)
+      .SetDoc("Faking Node for PrePacking sparse initializers")
+      .Input(0, "Input_0", "input 0", "tensor(float)")
+      .Input(1, "Input_1", "input 1", "tensor(float)")
+      .Output(0, "output_0", "docstr for output_0.", "tensor(float)");
+
+  ExecutionProviders execution_providers;
+  auto cpu_execution_provider = onnxruntime::make_unique<CPUExecutionProvider>(CPUExecutionProviderInfo(false));
+  execution_providers.Add(kCpuExecutionProvider, std::move(cpu_execution_provider));
+
+  DataTransferManager dtm;
+  profiling::Profiler profiler;
+
+  ModelProto model_proto;
+  CreateModelWithSparseInitializer(model_proto);
+  std::shared_ptr<Model> model;
+  ASSERT_STATUS_OK(Model::Load(model_proto, model, nullptr, DefaultLoggingManager().DefaultLogger()));
+  Graph& graph = model->MainGraph();
+  ASSERT_STATUS_OK(graph.Resolve());
+  ASSERT_TRUE(graph.IsSparseInitializer("sparse_weight"));
+  PlaceAllNodesToCPUEP(graph);
+
+  SessionState session_state(graph,
+                             execution_providers,
+                             true, /*enable_mem_pattern*/
+                             tp.get(),
+                             nullptr, /*inter_op_thread_pool*/
+                             dtm,
+                             DefaultLoggingManager().DefaultLogger(),
+                             profiler);
+
+  KernelRegistryManager kernel_registry_manager;
+  ASSERT_STATUS_OK(kernel_registry_manager.RegisterKernels(execution_providers));
+  std::shared_ptr<KernelRegistry> kernel_registry = std::make_shared<KernelRegistry>();
+  auto kernel_def = KernelDefBuilder()
+                        .SetName("SparsePrePackingTest")
+                        .Provider(kCpuExecutionProvider)
+                        .SinceVersion(1)
+                        .SparseInitializerInputs({1})
+                        .Build();
+  SparsePrePackingResult result;
+  ASSERT_STATUS_OK(kernel_registry->Register(
+      KernelCreateInfo(std::move(kernel_def),
+                       [pack_sparse, &result](const OpKernelInfo& info) -> OpKernel* {
+                         return new SparsePrePackingTestOpKernel(info, pack_sparse, result);
+                       })));
+  kernel_registry_manager.RegisterKernelRegistry(kernel_registry);
+
+  SessionOptions sess_options;
+  ASSERT_STATUS_OK(session_state.FinalizeSessionState(std::basic_string<PATH_CHAR_TYPE>(),
+                                                      kernel_registry_manager,
+                                                      sess_options));
+
+  // the kernel is offered the nonzero values only
+  EXPECT_EQ(result.sparse_num_values, size_t(2));
+
+  const auto& const_initialized_tensors = session_state.GetConstantInitializedTensors();
+  if (pack_sparse) {
+    // packed in sparse form, so the initializer was never densified and has been released
+    EXPECT_TRUE(result.dense_values.empty());
+    EXPECT_TRUE(const_initialized_tensors.empty());
+  } else {
+    // declined, so the kernel received the dense initializer and it stays available at compute time
+    EXPECT_EQ(result.dense_values, (std::vector<float>{0.0f, 2.0f, 0.0f, 0.0f, 0.0f, 5.0f}));
+    ASSERT_EQ(const_initialized_tensors.size(), size_t(1));
+    const OrtValue& value = const_initialized_tensors.cbegin()->second;
+    ASSERT_TRUE(value.IsTensor());
+    EXPECT_EQ(value.Get<Tensor>().Shape(), TensorShape({2, 3}));
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(SessionStateTests, SessionStateSparsePrepackingTest, testing::Bool());
 #endif
 
 }  // namespace test
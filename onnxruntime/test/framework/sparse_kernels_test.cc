@@ -14,6 +14,7 @@
 #include "core/session/inference_session.h"
 #include "test/providers/provider_test_utils.h"
 #include "test_utils.h"
+#include "inference_session_wrapper.h"
 #include "file_util.h"
 
 #include "gtest/gtest.h"
@@ -1103,6 +1104,147 @@ TEST(SparseTensorConversionTests, TestDenseToSparseConversion) {
       RawSparseDataChecker<uint8_t>);
 }
 
+#ifndef ENABLE_TRAINING
+// Y = MatMul(X, W) with W a K x N sparse initializer holding the given linear indices.
+// With add_consumer, W is also fed to Add(W, B) -> Z, which needs W dense.
+static void CreateSparseMatMulModel(int64_t K, int64_t N, const std::vector<int64_t>& indices,
+                                    const std::vector<float>& values, bool add_consumer, std::string& model_data) {
+  Model model("sparse_matmul", false, DefaultLoggingManager().DefaultLogger());
+  auto model_proto = model.ToProto();
+  auto& graph_proto = *model_proto.mutable_graph();
+  graph_proto.set_name("sparse_matmul");
+
+  auto add_value_info = [](ValueInfoProto& value_info, const std::string& name, std::vector<int64_t> dims) {
+    value_info.set_name(name);
+    auto* tensor_type = value_info.mutable_type()->mutable_tensor_type();
+    tensor_type->set_elem_type(TensorProto_DataType_FLOAT);
+    for (auto dim : dims) {
+      tensor_type->mutable_shape()->add_dim()->set_dim_value(dim);
+    }
+  };
+
+  auto* matmul = graph_proto.add_node();
+  matmul->set_op_type("MatMul");
+  matmul->add_input("X");
+  matmul->add_input("W");
+  matmul->add_output("Y");
+  add_value_info(*graph_proto.add_input(), "X", {4, K});
+  add_value_info(*graph_proto.add_output(), "Y", {4, N});
+
+  if (add_consumer) {
+    auto* add = graph_proto.add_node();
+    add->set_op_type("Add");
+    add->add_input("W");
+    add->add_input("B");
+    add->add_output("Z");
+    add_value_info(*graph_proto.add_input(), "B", {K, N});
+    add_value_info(*graph_proto.add_output(), "Z", {K, N});
+  }
+
+  auto& sparse_initializer = *graph_proto.add_sparse_initializer();
+  sparse_initializer.add_dims(K);
+  sparse_initializer.add_dims(N);
+  auto& sparse_values = *sparse_initializer.mutable_values();
+  sparse_values.set_name("W");
+  sparse_values.set_data_type(TensorProto_DataType_FLOAT);
+  sparse_values.add_dims(static_cast<int64_t>(values.size()));
+  sparse_values.mutable_float_data()->Add(values.cbegin(), values.cend());
+  auto& sparse_indices = *sparse_initializer.mutable_indices();
+  sparse_indices.set_data_type(TensorProto_DataType_INT64);
+  sparse_indices.add_dims(static_cast<int64_t>(indices.size()));
+  sparse_indices.mutable_int64_data()->Add(indices.cbegin(), indices.cend());
+
+  model_proto.SerializeToString(&model_data);
+}
+
+// Runs the model built by CreateSparseMatMulModel and compares with a reference product.
+// Returns the number of constant initializers the session kept after PrePack.
+static size_t RunSparseMatMulModel(int64_t K, int64_t N, const std::vector<int64_t>& indices,
+                                   const std::vector<float>& values, bool add_consumer) {
+  std::string model_data;
+  CreateSparseMatMulModel(K, N, indices, values, add_consumer, model_data);
+
+  std::vector<float> dense_w(K * N, 0.f);
+  for (size_t i = 0; i < indices.size(); ++i) {
+    dense_w[indices[i]] = values[i];
+  }
+
+  std::vector<float> x(4 * K);
+  for (size_t i = 0; i < x.size(); ++i) {
+    x[i] = static_cast<float>(i % 7) - 3.f;
+  }
+  std::vector<float> b(K * N, 0.5f);
+
+  std::vector<float> expected_y(4 * N, 0.f);
+  for (int64_t m = 0; m < 4; ++m) {
+    for (int64_t k = 0; k < K; ++k) {
+      for (int64_t n = 0; n < N; ++n) {
+        expected_y[m * N + n] += x[m * K + k] * dense_w[k * N + n];
+      }
+    }
+  }
+
+  SessionOptions so;
+  so.session_logid = "SparseInitializerMatMul";
+  InferenceSessionWrapper session_object{so, GetEnvironment()};
+  EXPECT_STATUS_OK(session_object.Load(model_data.data(), static_cast<int>(model_data.size())));
+  EXPECT_STATUS_OK(session_object.Initialize());
+
+  auto alloc = TestCPUExecutionProvider()->GetAllocator(0, OrtMemTypeDefault);
+  OrtValue x_value;
+  CreateMLValue<float>(alloc, {4, K}, x, &x_value);
+  NameMLValMap feeds{{"X", x_value}};
+  std::vector<std::string> output_names{"Y"};
+  if (add_consumer) {
+    OrtValue b_value;
+    CreateMLValue<float>(alloc, {K, N}, b, &b_value);
+    feeds.insert({"B", b_value});
+    output_names.push_back("Z");
+  }
+
+  std::vector<OrtValue> fetches;
+  EXPECT_STATUS_OK(session_object.Run(RunOptions(), feeds, output_names, &fetches));
+  EXPECT_EQ(fetches.size(), output_names.size());
+
+  const auto& y = fetches[0].Get<Tensor>();
+  EXPECT_EQ(y.Shape(), TensorShape({4, N}));
+  EXPECT_THAT(gsl::make_span(y.Data<float>(), expected_y.size()),
+              testing::Pointwise(testing::FloatNear(1e-5f), expected_y));
+
+  if (add_consumer) {
+    const auto& z = fetches[1].Get<Tensor>();
+    for (int64_t i = 0; i < K * N; ++i) {
+      EXPECT_FLOAT_EQ(z.Data<float>()[i], dense_w[i] + 0.5f) << "at " << i;
+    }
+  }
+
+  return session_object.GetSessionState().GetConstantInitializedTensors().size();
+}
+
+TEST(SparseInitializerTests, MatMulWithSparseInitializer) {
+  const int64_t K = 64;
+  const int64_t N = 32;
+
+  // a few values, spread over rows and columns and including an explicit zero, are multiplied in
+  // compressed form straight from the sparse initializer
+  std::vector<int64_t> indices{0, 33, 70, 500, 1023, 1024, 1500, 2047};
+  std::vector<float> values{1.5f, -2.f, 3.f, 0.f, 4.f, -0.5f, 2.5f, 7.f};
+  EXPECT_EQ(RunSparseMatMulModel(K, N, indices, values, false), size_t(0));
+
+  // an Add consuming the same initializer needs it dense, so it is not kept sparse
+  EXPECT_EQ(RunSparseMatMulModel(K, N, indices, values, true), size_t(1));
+
+  // too dense for the compressed product, so MatMul gets the densified initializer and packs it
+  indices.clear();
+  values.clear();
+  for (int64_t i = 0; i < K * N; i += 3) {
+    indices.push_back(i);
+    values.push_back(static_cast<float>(i % 11) - 5.f);
+  }
+  EXPECT_EQ(RunSparseMatMulModel(K, N, indices, values, false), size_t(0));
+}
+#endif  // !ENABLE_TRAINING
+
 #endif  // !ORT_MINIMAL_BUILD
 
 }  // namespace test
@@ -26,7 +26,7 @@ void CPUTensorTest(std::vector<int64_t> dims, const int offset_elements = 0) {
 
   Tensor t(DataTypeImpl::GetType<T>(), shape, data, alloc->Info(), offset_bytes);
   auto tensor_shape = t.Shape();
-  EXPECT_EQ(shape.GetDims(), tensor_shape.GetDims());
+  EXPECT_EQ(shape.GetDimsAsVector(), tensor_shape.GetDimsAsVector());
   EXPECT_EQ(t.DataType(), DataTypeImpl::GetType<T>());
   auto& location = t.Location();
   EXPECT_STREQ(location.name, CPU);
@@ -44,7 +44,7 @@ void CPUTensorTest(std::vector<int64_t> dims, const int offset_elements = 0) {
     EXPECT_TRUE(new_t.OwnsBuffer());
 
     tensor_shape = new_t.Shape();
-    EXPECT_EQ(shape.GetDims(), tensor_shape.GetDims());
+    EXPECT_EQ(shape.GetDimsAsVector(), tensor_shape.GetDimsAsVector());
     EXPECT_EQ(new_t.DataType(), DataTypeImpl::GetType<T>());
     auto& new_location = new_t.Location();
     ASSERT_STREQ(new_location.name, CPU);
@@ -159,8 +159,7 @@ TEST(TensorTest, StringTensorTest) {
     Tensor t(DataTypeImpl::GetType<std::string>(), shape, alloc);
 
     auto& tensor_shape = t.Shape();
-    //Use reinterpret_cast to bypass a gcc bug: https://gcc.gnu.org/bugzilla/show_bug.cgi?id=51213
-    EXPECT_EQ(*reinterpret_cast<const std::vector<int64_t>*>(&shape), *reinterpret_cast<const std::vector<int64_t>*>(&tensor_shape));
+    EXPECT_EQ(shape.GetDimsAsVector(), tensor_shape.GetDimsAsVector());
     EXPECT_EQ(t.DataType(), DataTypeImpl::GetType<std::string>());
     auto& location = t.Location();
     ASSERT_STREQ(location.name, CPU);
@@ -193,7 +192,33 @@ TEST(TensorTest, Int64PtrConstructor) {
   TensorShape shape(dimensions, 2);  // just use first 2
   EXPECT_EQ(shape.Size(), 6);
   EXPECT_EQ(shape.NumDimensions(), 2u);
-  EXPECT_THAT(shape.GetDims(), testing::ElementsAre(2, 3));
+  EXPECT_THAT(shape.GetDimsAsVector(), testing::ElementsAre(2, 3));
+}
+
+TEST(TensorTest, ShapeRanks) {
+  // ranks stored inline and ranks that spill to the heap
+  for (size_t rank : {size_t{0}, kTensorShapeSmallBufferElementsSize, kTensorShapeSmallBufferElementsSize + 3}) {
+    TensorShapeVector dims;
+    for (size_t i = 0; i < rank; ++i) {
+      dims.push_back(static_cast<int64_t>(i + 1));
+    }
+    const std::vector<int64_t> expected(dims.begin(), dims.end());
+
+    TensorShape shape(dims);
+    EXPECT_EQ(shape.GetDimsAsVector(), expected);
+
+    TensorShape copy(shape);
+    EXPECT_EQ(copy, shape);
+
+    TensorShape moved(std::move(copy));
+    EXPECT_EQ(moved, shape);
+    EXPECT_EQ(moved.GetDimsAsVector(), expected);
+
+    TensorShapeVector modified = shape.AsShapeVector();
+    modified.push_back(2);
+    EXPECT_EQ(shape.NumDimensions(), rank);
+    EXPECT_EQ(TensorShape(std::move(modified)).Slice(0, rank), shape);
+  }
 }
 
 TEST(TensorTest, SizeOverflow) {
@@ -0,0 +1,86 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "mlas.h"
+#include "bench_util.h"
+#include "core/util/thread_utils.h"
+
+#include <stdexcept>
+#include <memory>
+#include <vector>
+
+static const std::vector<std::string> q4gemm_arg_names = {"M", "N", "K", "BlockSize", "Threads"};
+
+void Q4GEMM(benchmark::State& state, bool has_zero_points) {
+  const int64_t M = state.range(0);
+  const int64_t N = state.range(1);
+  const int64_t K = state.range(2);
+  const int64_t block_size = state.range(3);
+  const int64_t threads = state.range(4);
+
+  if (M <= 0) throw std::invalid_argument("M must greater than 0!");
+  if (N <= 0) throw std::invalid_argument("N must greater than 0!");
+  if (K <= 0) throw std::invalid_argument("K must greater than 0!");
+  if (threads <= 0) throw std::invalid_argument("Threads must greater than 0!");
+
+  const size_t packed_b_size = MlasQ4GemmPackBSize(N, K, block_size);
+  if (packed_b_size == 0) throw std::invalid_argument("BlockSize is not supported!");
+
+  OrtThreadPoolParams tpo;
+  tpo.thread_pool_size = int(threads);
+  tpo.auto_set_affinity = true;
+  std::unique_ptr<onnxruntime::concurrency::ThreadPool> tp(
+      onnxruntime::concurrency::CreateThreadPool(&onnxruntime::Env::Default(),
+      tpo, onnxruntime::concurrency::ThreadPoolType::INTRA_OP));
+
+  const int64_t blocks_per_col = (K + block_size - 1) / block_size;
+
+  auto A_holder = RandomVectorUniform(static_cast<size_t>(M * K), -1.0f, 1.0f);
+  auto B_holder = RandomVectorUniform<uint8_t>(static_cast<size_t>(N * blocks_per_col * block_size / 2), uint8_t(0), uint8_t(255));
+  auto scales_holder = RandomVectorUniform(static_cast<size_t>(N * blocks_per_col), 0.01f, 0.1f);
+  auto zp_holder = RandomVectorUniform<uint8_t>(static_cast<size_t>(N * ((blocks_per_col + 1) / 2)), uint8_t(0), uint8_t(255));
+  std::vector<float> C_holder(static_cast<size_t>(M * N));
+  std::vector<uint8_t> packed_b_holder(packed_b_size);
+
+  MlasQ4GemmPackB(packed_b_holder.data(), B_holder.data(), scales_holder.data(),
+                  has_zero_points ? zp_holder.data() : nullptr, N, K, block_size);
+
+  MLAS_Q4_GEMM_DATA_PARAMS params;
+  params.A = A_holder.data();
+  params.lda = K;
+  params.PackedB = packed_b_holder.data();
+  params.C = C_holder.data();
+  params.ldc = N;
+
+  for (auto _ : state) {
+    MlasQ4GemmBatch(M, N, K, block_size, &params, 1, tp.get());
+  }
+}
+
+static void Q4GemmSize(benchmark::internal::Benchmark* b) {
+  b->ArgNames(q4gemm_arg_names);
+  // Args for  "M", "N", "K"
+  std::vector<std::vector<int64_t>> mnk = {
+      {1, 4096, 4096},
+      {1, 11008, 4096},
+      {1, 4096, 11008},
+      {4, 4096, 4096},
+      {32, 4096, 4096},
+      {128, 4096, 4096},
+  };
+
+  // Args for BlockSize, Threads
+  for (int64_t block_size : {32, 128}) {
+    for (int64_t threads : {1, 4, 8}) {
+      for (auto& shape : mnk) {
+        std::vector<int64_t> copy(shape);
+        copy.push_back(block_size);
+        copy.push_back(threads);
+        b->Args(copy);
+      }
+    }
+  }
+}
+
+BENCHMARK_CAPTURE(Q4GEMM, ZeroPoints, true)->Apply(Q4GemmSize)->UseRealTime();
+BENCHMARK_CAPTURE(Q4GEMM, Symmetric, false)->Apply(Q4GemmSize)->UseRealTime();
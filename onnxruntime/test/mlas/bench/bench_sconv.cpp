@@ -245,3 +245,29 @@ static void General_Conv2d(benchmark::internal::Benchmark* b) {
 }
 
 BENCHMARK_CAPTURE(SCONV_NCHW, 2d, "")->Apply(General_Conv2d)->UseRealTime();
+
+static void Depthwise_Conv2d(benchmark::internal::Benchmark* b) {
+  b->ArgNames(ArgNamesForConv(2));
+
+  //************************* MobileNetV2 *************************
+  //    Rank, N,   G,Cpg,Fpg,  I,   , K, , P, , , , S, , D, ,
+  b->Args({2, 1,  32,  1,  1,112,112, 3,3, 1,1,1,1, 1,1, 1,1});
+  b->Args({2, 1,  96,  1,  1,112,112, 3,3, 1,1,1,1, 2,2, 1,1});
+  b->Args({2, 1, 144,  1,  1, 56, 56, 3,3, 1,1,1,1, 1,1, 1,1});
+  b->Args({2, 1, 144,  1,  1, 56, 56, 3,3, 1,1,1,1, 2,2, 1,1});
+  b->Args({2, 1, 192,  1,  1, 28, 28, 3,3, 1,1,1,1, 1,1, 1,1});
+  b->Args({2, 1, 384,  1,  1, 14, 14, 3,3, 1,1,1,1, 1,1, 1,1});
+  b->Args({2, 1, 960,  1,  1,  7,  7, 3,3, 1,1,1,1, 1,1, 1,1});
+
+  //*********************** EfficientNet/MnasNet ***********************
+  //    Rank, N,   G,Cpg,Fpg,  I,   , K, , P, , , , S, , D, ,
+  b->Args({2, 1, 144,  1,  1, 56, 56, 5,5, 2,2,2,2, 2,2, 1,1});
+  b->Args({2, 1, 240,  1,  1, 28, 28, 5,5, 2,2,2,2, 1,1, 1,1});
+  b->Args({2, 1, 672,  1,  1, 14, 14, 5,5, 2,2,2,2, 1,1, 1,1});
+
+  //************************* Dilated *************************
+  //    Rank, N,   G,Cpg,Fpg,  I,   , K, , P, , , , S, , D, ,
+  b->Args({2, 1, 256,  1,  1, 33, 33, 3,3, 2,2,2,2, 1,1, 2,2});
+}
+
+BENCHMARK_CAPTURE(SCONV_NCHW, Depthwise, "")->Apply(Depthwise_Conv2d)->UseRealTime();
@@ -0,0 +1,89 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "test_util.h"
+
+class MlasActivationFunctionsTest : public MlasTestBase {
+ private:
+  MatrixGuardBuffer<float> BufferInput;
+  MatrixGuardBuffer<float> BufferOutput;
+  MatrixGuardBuffer<float> BufferActivation;
+
+  typedef void(MLASCALL* ComputeRoutine)(const float* Input, float* Output, size_t N);
+
+  void Test(const char* Name, ComputeRoutine Routine, MLAS_ACTIVATION_KIND ActivationKind,
+            double (*Reference)(double), size_t N, float MinimumValue, float MaximumValue) {
+    float* Input = BufferInput.GetBuffer(N);
+    float* Output = BufferOutput.GetBuffer(N);
+    float* Activation = BufferActivation.GetBuffer(N);
+
+    std::default_random_engine generator(static_cast<unsigned>(N));
+    std::uniform_real_distribution<float> distribution(MinimumValue, MaximumValue);
+
+    for (size_t n = 0; n < N; n++) {
+      Input[n] = distribution(generator);
+      Activation[n] = Input[n];
+    }
+
+    Routine(Input, Output, N);
+
+    MLAS_ACTIVATION ActivationParameters;
+    ActivationParameters.ActivationKind = ActivationKind;
+    MlasActivation(&ActivationParameters, Activation, nullptr, 1, N, N);
+
+    constexpr double epsilon = 1e-5;
+
+    for (size_t n = 0; n < N; n++) {
+      double Expected = Reference(Input[n]);
+      ASSERT_NEAR(Output[n], Expected, epsilon * std::max(1.0, std::fabs(Expected)))
+          << Name << " of " << Input[n] << " with parameter (" << N << "," << MinimumValue << "," << MaximumValue << ")";
+      ASSERT_EQ(Output[n], Activation[n])
+          << Name << " activation of " << Input[n] << " with parameter (" << N << ")";
+    }
+
+    // The routines support in place updates of the output buffer.
+    Routine(Input, Input, N);
+    for (size_t n = 0; n < N; n++) {
+      ASSERT_EQ(Input[n], Output[n]) << Name << " in place with parameter (" << N << ")";
+    }
+  }
+
+  static double Softplus(double x) {
+    return x > 0.0 ? x + std::log1p(std::exp(-x)) : std::log1p(std::exp(x));
+  }
+
+  static double Gelu(double x) { return 0.5 * x * (1.0 + std::erf(x / std::sqrt(2.0))); }
+
+  static double Silu(double x) { return x / (1.0 + std::exp(-x)); }
+
+  static double Mish(double x) { return x * std::tanh(Softplus(x)); }
+
+  static double HardSwish(double x) { return x * std::min(1.0, std::max(0.0, x / 6.0 + 0.5)); }
+
+ public:
+  static const char* GetTestSuiteName() {
+    static const std::string suite_name("ActivationFunctions");
+    return suite_name.c_str();
+  }
+
+  void ExecuteShort(void) override {
+    for (size_t n : {1, 3, 4, 7, 16, 255, 256, 257, 1000}) {
+      Test("Gelu", MlasComputeGelu, MlasGeluActivation, Gelu, n, -10.f, 10.f);
+      Test("Silu", MlasComputeSilu, MlasSiluActivation, Silu, n, -20.f, 20.f);
+      Test("Softplus", MlasComputeSoftplus, MlasSoftplusActivation, Softplus, n, -30.f, 30.f);
+      Test("Mish", MlasComputeMish, MlasMishActivation, Mish, n, -30.f, 30.f);
+      Test("HardSwish", MlasComputeHardSwish, MlasHardSwishActivation, HardSwish, n, -8.f, 8.f);
+    }
+  }
+};
+
+template <> MlasActivationFunctionsTest* MlasTestFixture<MlasActivationFunctionsTest>::mlas_tester(nullptr);
+
+#ifdef __GNUC__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#endif
+
+static UNUSED_VARIABLE bool added_to_main = AddTestRegister([](bool is_short_execute) {
+  return is_short_execute ? MlasDirectShortExecuteTests<MlasActivationFunctionsTest>::RegisterShortExecute() : 0;
+});
@@ -59,6 +59,12 @@ class MlasConv2DTest : public MlasTestBase {
                     &WorkingBufferSize,
                     threadpool_);
 
+    //
+    // The Winograd transforms of F(4x4,3x3) are not exact for integer inputs.
+    //
+
+    ExactMatch = Parameters.Algorithm != MlasConvAlgorithmWinograd;
+
     MlasConv(&Parameters,
              Input,
              Filter,
@@ -155,6 +161,7 @@ class MlasConv2DTest : public MlasTestBase {
   MatrixGuardBuffer<float> BufferIm2Col;
 
   MLAS_THREADPOOL* threadpool_;
+  bool ExactMatch = true;
 
  public:
   static const char* GetTestSuiteName() {
@@ -208,6 +215,8 @@ class MlasConv2DTest : public MlasTestBase {
     size_t BiasElements = GroupCount * FilterCount;
     size_t OutputElements = BatchCount * GroupCount * FilterCount * OutputSize;
 
+    ExactMatch = true;
+
     const float* Input = BufferInput.GetBuffer(InputElements);
     const float* Filter = BufferFilter.GetBuffer(FilterElements);
     const float* Bias = BufferBias.GetBuffer(BiasElements);
@@ -245,6 +254,24 @@ class MlasConv2DTest : public MlasTestBase {
                     Bias,
                     OutputReference);
 
+    if (!ExactMatch) {
+      float MaximumValue = 1.0f;
+      for (size_t i = 0; i < OutputElements; i++) {
+        MaximumValue = std::max(MaximumValue, std::fabs(OutputReference[i]));
+      }
+      for (size_t i = 0; i < OutputElements; i++) {
+        ASSERT_LE(std::fabs(Output[i] - OutputReference[i]), 1e-5f * MaximumValue)
+            << "@" << i << " B" << BatchCount << "/"
+            << "G" << GroupCount << "/"
+            << "Cpg" << InputChannels << "/"
+            << "Fpg" << FilterCount << "/"
+            << "H" << InputHeight << "/"
+            << "W" << InputWidth << "/"
+            << "Pad" << PaddingLeftHeight << "," << PaddingLeftWidth << "," << PaddingRightHeight << "," << PaddingRightWidth;
+      }
+      return;
+    }
+
     ASSERT_EQ(memcmp(Output, OutputReference, OutputElements * sizeof(float)), 0)
         << "B" << BatchCount << "/"
         << "G" << GroupCount << "/"
@@ -286,6 +313,7 @@ class MlasConv2DTest : public MlasTestBase {
                       for (unsigned sh = 1; sh <= 2; sh++) {
                         for (unsigned sw = 1; sw <= 2; sw++) {
                           Test(1, cs[gc], 1, is[ih], is[iw], 1, 3, 3, p0, p1, p2, p3, dh, dw, sh, sw);
+                          Test(1, cs[gc], 1, is[ih], is[iw], 1, 5, 5, p0 * 2, p1 * 2, p2 * 2, p3 * 2, dh, dw, sh, sw);
                         }
                       }
                     }
@@ -139,6 +139,14 @@ class Conv2dShortExecuteTest : public MlasTestFixture<Conv2dTester> {
       test_registered += RegisterSingleTest(1, 16, 1, i, i, 1, 3, 3, 0, 0, 0, 0, 1, 1, 2, 2);
       test_registered += RegisterSingleTest(1, 16, 1, i, i, 1, 3, 3, 1, 1, 1, 1, 1, 1, 1, 1);
       test_registered += RegisterSingleTest(1, 16, 1, i, i, 1, 3, 3, 1, 1, 1, 1, 1, 1, 2, 2);
+      test_registered += RegisterSingleTest(1, 16, 1, i, i, 1, 3, 3, 1, 1, 1, 1, 2, 2, 1, 1);
+      test_registered += RegisterSingleTest(1, 16, 1, i, i, 1, 3, 3, 0, 1, 1, 0, 1, 2, 2, 1);
+      test_registered += RegisterSingleTest(1, 16, 1, i, i, 1, 5, 5, 0, 0, 0, 0, 1, 1, 1, 1);
+      test_registered += RegisterSingleTest(1, 16, 1, i, i, 1, 5, 5, 2, 2, 2, 2, 1, 1, 1, 1);
+      test_registered += RegisterSingleTest(1, 16, 1, i, i, 1, 5, 5, 1, 2, 2, 1, 1, 1, 2, 2);
+      test_registered += RegisterSingleTest(2, 16, 1, i, i, 1, 5, 5, 2, 2, 2, 2, 2, 2, 1, 1);
+      test_registered += RegisterSingleTest(1, 1, 32, i, i, 48, 3, 3, 1, 1, 1, 1, 1, 1, 1, 1);
+      test_registered += RegisterSingleTest(2, 1, 16, i, i + 3, 24, 3, 3, 0, 1, 2, 1, 1, 1, 1, 1);
     }
     return test_registered;
   }
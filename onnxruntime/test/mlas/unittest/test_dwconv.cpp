@@ -0,0 +1,140 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "test_util.h"
+
+class MlasNhwcDepthwiseTest : public MlasTestBase {
+ private:
+  MatrixGuardBuffer<float> BufferInput;
+  std::vector<const float*> BufferIndirection;
+  MatrixGuardBuffer<float> BufferFilter;
+  MatrixGuardBuffer<float> BufferBias;
+  MatrixGuardBuffer<float> BufferOutput;
+  MatrixGuardBuffer<float> BufferOutputReference;
+
+  //
+  // Generate an indirection buffer that references random rows of the input
+  // buffer, including some rows more than once as happens with overlapping
+  // kernel windows.
+  //
+
+  const float** PrepareInput(size_t Channels, size_t OutputCount, size_t KernelSize, std::default_random_engine& generator) {
+    const size_t RowCount = OutputCount + KernelSize;
+
+    std::uniform_real_distribution<float> real_distribution(-1.0f, 1.0f);
+    float* Input = BufferInput.GetBuffer(RowCount * Channels);
+    for (size_t i = 0; i < RowCount * Channels; i++) {
+      Input[i] = real_distribution(generator);
+    }
+
+    std::uniform_int_distribution<size_t> row_distribution(0, RowCount - 1);
+    BufferIndirection.resize(OutputCount * KernelSize);
+    const float** Indirection = BufferIndirection.data();
+    for (size_t i = 0; i < OutputCount * KernelSize; i++) {
+      Indirection[i] = Input + row_distribution(generator) * Channels;
+    }
+
+    return Indirection;
+  }
+
+  void TestConvDepthwise(size_t Channels, size_t OutputCount, size_t KernelSize, bool HasBias, const MLAS_ACTIVATION& Activation) {
+    std::default_random_engine generator(static_cast<unsigned>(Channels * OutputCount * KernelSize));
+    std::uniform_real_distribution<float> real_distribution(-1.0f, 1.0f);
+
+    const float** Indirection = PrepareInput(Channels, OutputCount, KernelSize, generator);
+
+    float* Filter = BufferFilter.GetBuffer(KernelSize * Channels);
+    for (size_t i = 0; i < KernelSize * Channels; i++) {
+      Filter[i] = real_distribution(generator);
+    }
+
+    float* Bias = nullptr;
+    if (HasBias) {
+      Bias = BufferBias.GetBuffer(Channels);
+      for (size_t i = 0; i < Channels; i++) {
+        Bias[i] = real_distribution(generator);
+      }
+    }
+
+    float* Output = BufferOutput.GetBuffer(OutputCount * Channels);
+    float* OutputReference = BufferOutputReference.GetBuffer(OutputCount * Channels);
+
+    for (size_t o = 0; o < OutputCount; o++) {
+      for (size_t c = 0; c < Channels; c++) {
+        float Accumulator = HasBias ? Bias[c] : 0.0f;
+        for (size_t k = 0; k < KernelSize; k++) {
+          Accumulator += Indirection[o * KernelSize + k][c] * Filter[k * Channels + c];
+        }
+        OutputReference[o * Channels + c] = Accumulator;
+      }
+    }
+    MlasActivation(&Activation, OutputReference, nullptr, OutputCount, Channels, Channels);
+
+    MlasConvDepthwise(Indirection, Filter, Bias, Output, Channels, OutputCount, KernelSize, &Activation);
+
+    for (size_t i = 0; i < OutputCount * Channels; i++) {
+      ASSERT_TRUE(std::fabs(Output[i] - OutputReference[i]) <= 1e-5f * (1.0f + std::fabs(OutputReference[i])))
+          << "@" << i << " of " << OutputCount * Channels << ", got: " << Output[i]
+          << ", expecting: " << OutputReference[i] << ", Channels=" << Channels
+          << ", OutputCount=" << OutputCount << ", KernelSize=" << KernelSize;
+    }
+  }
+
+  void TestMaximumPool(size_t Channels, size_t OutputCount, size_t KernelSize) {
+    std::default_random_engine generator(static_cast<unsigned>(Channels * OutputCount + KernelSize));
+
+    const float** Indirection = PrepareInput(Channels, OutputCount, KernelSize, generator);
+
+    float* Output = BufferOutput.GetBuffer(OutputCount * Channels);
+    float* OutputReference = BufferOutputReference.GetBuffer(OutputCount * Channels);
+
+    for (size_t o = 0; o < OutputCount; o++) {
+      for (size_t c = 0; c < Channels; c++) {
+        float MaximumValue = Indirection[o * KernelSize][c];
+        for (size_t k = 1; k < KernelSize; k++) {
+          MaximumValue = std::max(MaximumValue, Indirection[o * KernelSize + k][c]);
+        }
+        OutputReference[o * Channels + c] = MaximumValue;
+      }
+    }
+
+    MlasMaximumPool(Indirection, Output, Channels, OutputCount, KernelSize);
+
+    for (size_t i = 0; i < OutputCount * Channels; i++) {
+      ASSERT_EQ(Output[i], OutputReference[i])
+          << "@" << i << " of " << OutputCount * Channels << ", Channels=" << Channels
+          << ", OutputCount=" << OutputCount << ", KernelSize=" << KernelSize;
+    }
+  }
+
+ public:
+  static const char* GetTestSuiteName() {
+    static const std::string suite_name("NhwcDepthwise");
+    return suite_name.c_str();
+  }
+
+  void ExecuteShort(void) override {
+    MLAS_ACTIVATION Activations[3];
+    Activations[0].ActivationKind = MlasIdentityActivation;
+    Activations[1].ActivationKind = MlasReluActivation;
+    Activations[2].ActivationKind = MlasClipActivation;
+    Activations[2].Parameters.Clip.minimum = -0.5f;
+    Activations[2].Parameters.Clip.maximum = 0.5f;
+
+    for (size_t c : {1, 3, 4, 7, 8, 12, 17, 32, 67}) {
+      for (size_t k : {1, 3, 9, 25}) {
+        for (const auto& activation : Activations) {
+          TestConvDepthwise(c, 11, k, false, activation);
+          TestConvDepthwise(c, 11, k, true, activation);
+        }
+        TestMaximumPool(c, 11, k);
+      }
+    }
+  }
+};
+
+template <> MlasNhwcDepthwiseTest* MlasTestFixture<MlasNhwcDepthwiseTest>::mlas_tester(nullptr);
+
+static UNUSED_VARIABLE bool added_to_main = AddTestRegister([](bool is_short_execute) {
+  return is_short_execute ? MlasDirectShortExecuteTests<MlasNhwcDepthwiseTest>::RegisterShortExecute() : 0;
+});
@@ -0,0 +1,145 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "test_util.h"
+
+class MlasFp16Test : public MlasTestBase {
+ private:
+  MatrixGuardBuffer<float> BufferFloat;
+  MatrixGuardBuffer<unsigned short> BufferHalf;
+  MatrixGuardBuffer<unsigned short> BufferHalfReference;
+
+  static bool IsHalfNaN(unsigned short Half) {
+    return (Half & 0x7C00) == 0x7C00 && (Half & 0x03FF) != 0;
+  }
+
+  static float ReferenceHalfToFloat(unsigned short Half) {
+    const int Exponent = (Half >> 10) & 0x1F;
+    const int Mantissa = Half & 0x3FF;
+    float Magnitude;
+
+    if (Exponent == 0x1F) {
+      Magnitude = Mantissa != 0 ? std::numeric_limits<float>::quiet_NaN() : std::numeric_limits<float>::infinity();
+    } else if (Exponent == 0) {
+      Magnitude = std::ldexp(float(Mantissa), -24);
+    } else {
+      Magnitude = std::ldexp(float(Mantissa + 0x400), Exponent - 25);
+    }
+
+    return (Half & 0x8000) != 0 ? -Magnitude : Magnitude;
+  }
+
+  // Rounds to the nearest finite half precision value with ties to even by
+  // searching the ordered positive half precision values.
+  static unsigned short ReferenceFloatToHalf(float Value) {
+    if (std::isnan(Value)) {
+      return 0x7E00;
+    }
+
+    const unsigned short Sign = std::signbit(Value) ? 0x8000 : 0;
+    const double Magnitude = std::fabs(double(Value));
+
+    if (Magnitude >= 65520.0) {
+      return Sign | 0x7C00;
+    }
+
+    unsigned short Low = 0;
+    unsigned short High = 0x7BFF;
+    while (Low < High) {
+      unsigned short Middle = static_cast<unsigned short>((Low + High + 1) / 2);
+      if (double(ReferenceHalfToFloat(Middle)) <= Magnitude) {
+        Low = Middle;
+      } else {
+        High = static_cast<unsigned short>(Middle - 1);
+      }
+    }
+
+    unsigned short Half = Low;
+    if (Half < 0x7BFF) {
+      const double Below = Magnitude - double(ReferenceHalfToFloat(Half));
+      const double Above = double(ReferenceHalfToFloat(static_cast<unsigned short>(Half + 1))) - Magnitude;
+      if (Above < Below || (Above == Below && (Half & 1) != 0)) {
+        Half++;
+      }
+    }
+
+    return Sign | Half;
+  }
+
+  void TestAllHalfValues() {
+    constexpr size_t Count = 0x10000;
+    unsigned short* Half = BufferHalf.GetBuffer(Count);
+    unsigned short* HalfRoundTrip = BufferHalfReference.GetBuffer(Count);
+    float* Float = BufferFloat.GetBuffer(Count);
+
+    for (size_t i = 0; i < Count; i++) {
+      Half[i] = static_cast<unsigned short>(i);
+    }
+
+    MlasConvertHalfToFloatBuffer(Half, Float, Count);
+    MlasConvertFloatToHalfBuffer(Float, HalfRoundTrip, Count);
+
+    for (size_t i = 0; i < Count; i++) {
+      const float Expected = ReferenceHalfToFloat(Half[i]);
+      if (IsHalfNaN(Half[i])) {
+        ASSERT_TRUE(std::isnan(Float[i])) << "half 0x" << std::hex << i;
+        ASSERT_TRUE(IsHalfNaN(HalfRoundTrip[i])) << "half 0x" << std::hex << i;
+      } else {
+        ASSERT_EQ(Float[i], Expected) << "half 0x" << std::hex << i;
+        ASSERT_EQ(std::signbit(Float[i]), std::signbit(Expected)) << "half 0x" << std::hex << i;
+        ASSERT_EQ(HalfRoundTrip[i], Half[i]) << "half 0x" << std::hex << i;
+      }
+    }
+  }
+
+  void TestFloatToHalf(size_t Count, std::default_random_engine& generator) {
+    float* Float = BufferFloat.GetBuffer(Count);
+    unsigned short* Half = BufferHalf.GetBuffer(Count);
+    unsigned short* HalfReference = BufferHalfReference.GetBuffer(Count);
+
+    std::uniform_int_distribution<int> exponent_distribution(-30, 17);
+    std::uniform_real_distribution<float> mantissa_distribution(-1.0f, 1.0f);
+    std::uniform_int_distribution<int> special_distribution(0, 15);
+
+    for (size_t i = 0; i < Count; i++) {
+      float Value = std::ldexp(mantissa_distribution(generator), exponent_distribution(generator));
+
+      // Exercise exact ties between two half precision values.
+      if (special_distribution(generator) == 0) {
+        Value = ReferenceHalfToFloat(static_cast<unsigned short>(i & 0x7BFF)) +
+                std::ldexp(1.0f, -26 + std::max(int((i & 0x7BFF) >> 10), 1));
+      }
+
+      Float[i] = Value;
+      HalfReference[i] = ReferenceFloatToHalf(Value);
+    }
+
+    MlasConvertFloatToHalfBuffer(Float, Half, Count);
+
+    for (size_t i = 0; i < Count; i++) {
+      ASSERT_EQ(Half[i], HalfReference[i]) << "Count:" << Count << " index " << i << " value " << Float[i];
+    }
+  }
+
+ public:
+  static const char* GetTestSuiteName() {
+    static const std::string suite_name("Fp16");
+    return suite_name.c_str();
+  }
+
+  void ExecuteShort(void) override {
+    TestAllHalfValues();
+
+    std::default_random_engine generator(1234);
+    for (size_t Count = 1; Count < 70; Count++) {
+      TestFloatToHalf(Count, generator);
+    }
+    TestFloatToHalf(4099, generator);
+  }
+};
+
+template <> MlasFp16Test* MlasTestFixture<MlasFp16Test>::mlas_tester(nullptr);
+
+static UNUSED_VARIABLE bool added_to_main = AddTestRegister([](bool is_short_execute) {
+  return is_short_execute ? MlasDirectShortExecuteTests<MlasFp16Test>::RegisterShortExecute() : 0;
+});
@@ -0,0 +1,129 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "test_util.h"
+
+class MlasLayerNormTest : public MlasTestBase {
+ private:
+  MatrixGuardBuffer<float> BufferInput;
+  MatrixGuardBuffer<float> BufferSkip;
+  MatrixGuardBuffer<float> BufferBias;
+  MatrixGuardBuffer<float> BufferGamma;
+  MatrixGuardBuffer<float> BufferBeta;
+  MatrixGuardBuffer<float> BufferOutput;
+  MatrixGuardBuffer<float> BufferOutputReference;
+
+  void Test(size_t D, bool UseSkip, bool UseBias, bool UseBeta, bool Simplified, float Offset) {
+    float* Input = BufferInput.GetBuffer(D);
+    float* Skip = UseSkip ? BufferSkip.GetBuffer(D) : nullptr;
+    float* Bias = UseBias ? BufferBias.GetBuffer(D) : nullptr;
+    float* Gamma = BufferGamma.GetBuffer(D);
+    float* Beta = UseBeta ? BufferBeta.GetBuffer(D) : nullptr;
+    float* Output = BufferOutput.GetBuffer(D);
+    float* OutputReference = BufferOutputReference.GetBuffer(D);
+
+    std::default_random_engine generator(static_cast<unsigned>(D));
+    std::uniform_real_distribution<float> distribution(-2.0f, 2.0f);
+
+    for (size_t d = 0; d < D; d++) {
+      Input[d] = distribution(generator) + Offset;
+      if (Skip != nullptr) {
+        Skip[d] = distribution(generator);
+      }
+      if (Bias != nullptr) {
+        Bias[d] = distribution(generator);
+      }
+      Gamma[d] = distribution(generator);
+      if (Beta != nullptr) {
+        Beta[d] = distribution(generator);
+      }
+    }
+
+    constexpr float Epsilon = 1e-5f;
+
+    float Mean = 0.0f;
+    float InvStdDev = 0.0f;
+    MlasComputeLayerNormalization(Input, Skip, Bias, Gamma, Beta, Output, D, Epsilon, Simplified, &Mean, &InvStdDev);
+
+    double MeanReference;
+    double InvStdDevReference;
+    ReferenceLayerNorm(Input, Skip, Bias, Gamma, Beta, OutputReference, D, Epsilon, Simplified,
+                       &MeanReference, &InvStdDevReference);
+
+    constexpr float AbsoluteTolerance = 1e-4f;
+    constexpr float RelativeTolerance = 1e-4f;
+
+    for (size_t d = 0; d < D; d++) {
+      float diff = std::fabs(Output[d] - OutputReference[d]);
+      ASSERT_TRUE(diff <= AbsoluteTolerance || diff <= std::fabs(OutputReference[d]) * RelativeTolerance)
+          << "D:" << D << " Skip:" << UseSkip << " Bias:" << UseBias << " Beta:" << UseBeta
+          << " Simplified:" << Simplified << " Offset:" << Offset << " index " << d
+          << ", got: " << Output[d] << ", expecting: " << OutputReference[d];
+    }
+
+    ASSERT_NEAR(InvStdDev, InvStdDevReference, std::fabs(InvStdDevReference) * RelativeTolerance)
+        << "D:" << D << " Simplified:" << Simplified << " Offset:" << Offset;
+    if (!Simplified) {
+      ASSERT_NEAR(Mean, MeanReference, AbsoluteTolerance + std::fabs(MeanReference) * RelativeTolerance)
+          << "D:" << D << " Offset:" << Offset;
+    }
+  }
+
+  static void ReferenceLayerNorm(const float* Input, const float* Skip, const float* Bias,
+                                 const float* Gamma, const float* Beta, float* Output, size_t D,
+                                 float Epsilon, bool Simplified, double* Mean, double* InvStdDev) {
+    std::vector<double> Row(D);
+    double Sum = 0.0;
+
+    for (size_t d = 0; d < D; d++) {
+      Row[d] = double(Input[d]) + (Skip != nullptr ? Skip[d] : 0.0) + (Bias != nullptr ? Bias[d] : 0.0);
+      Sum += Row[d];
+    }
+
+    *Mean = Simplified ? 0.0 : Sum / D;
+
+    double SumSquares = 0.0;
+    for (size_t d = 0; d < D; d++) {
+      double Centered = Row[d] - *Mean;
+      SumSquares += Centered * Centered;
+    }
+
+    *InvStdDev = 1.0 / std::sqrt(SumSquares / D + Epsilon);
+
+    for (size_t d = 0; d < D; d++) {
+      Output[d] = float((Row[d] - *Mean) * *InvStdDev * Gamma[d] + (Beta != nullptr ? Beta[d] : 0.0));
+    }
+  }
+
+ public:
+  static const char* GetTestSuiteName() {
+    static const std::string suite_name("LayerNorm");
+    return suite_name.c_str();
+  }
+
+  void ExecuteShort(void) override {
+    for (size_t d = 1; d < 80; d++) {
+      Test(d, false, false, true, false, 0.0f);
+      Test(d, true, true, true, false, 0.0f);
+      Test(d, true, false, false, false, 0.0f);
+      Test(d, false, false, false, true, 0.0f);
+    }
+
+    for (size_t d : {128, 384, 768, 1024, 1031}) {
+      Test(d, false, false, true, false, 0.0f);
+      Test(d, true, true, true, false, 0.0f);
+      Test(d, true, false, true, true, 0.0f);
+      Test(d, false, true, false, false, 0.0f);
+    }
+
+    // Rows whose mean is large relative to their spread.
+    Test(768, false, false, true, false, 1000.0f);
+    Test(1031, true, true, true, false, 1000.0f);
+  }
+};
+
+template <> MlasLayerNormTest* MlasTestFixture<MlasLayerNormTest>::mlas_tester(nullptr);
+
+static UNUSED_VARIABLE bool added_to_main = AddTestRegister([](bool is_short_execute) {
+  return is_short_execute ? MlasDirectShortExecuteTests<MlasLayerNormTest>::RegisterShortExecute() : 0;
+});
@@ -0,0 +1,177 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "test_util.h"
+
+template <bool Threaded>
+class MlasQ4GemmTest : public MlasTestBase {
+ private:
+  MatrixGuardBuffer<float> BufferA;
+  MatrixGuardBuffer<uint8_t> BufferQuantB;
+  MatrixGuardBuffer<float> BufferScales;
+  MatrixGuardBuffer<uint8_t> BufferZeroPoints;
+  MatrixGuardBuffer<uint8_t> BufferPackedB;
+  MatrixGuardBuffer<float> BufferBias;
+  MatrixGuardBuffer<float> BufferDequantB;
+  MatrixGuardBuffer<float> BufferC;
+  MatrixGuardBuffer<float> BufferCReference;
+  MatrixGuardBuffer<float> BufferCTolerance;
+  MLAS_THREADPOOL* threadpool_;
+
+  void Test(size_t M, size_t N, size_t K, size_t BlockSize, bool HasZeroPoints, bool HasBias) {
+    const size_t BlockCountK = (K + BlockSize - 1) / BlockSize;
+    const size_t ZeroPointBytes = (BlockCountK + 1) / 2;
+
+    std::default_random_engine generator(static_cast<unsigned>(M * N * K + BlockSize));
+    std::uniform_real_distribution<float> real_distribution(-1.0f, 1.0f);
+    std::uniform_int_distribution<int> int_distribution(0, 255);
+
+    float* A = BufferA.GetBuffer(M * K);
+    for (size_t i = 0; i < M * K; i++) {
+      A[i] = real_distribution(generator);
+    }
+
+    //
+    // Generate random quantized elements, scales, and zero points. Elements
+    // in the padding of the final block are not zero to verify that they
+    // do not contribute to the output.
+    //
+
+    uint8_t* QuantB = BufferQuantB.GetBuffer(N * BlockCountK * BlockSize / 2);
+    for (size_t i = 0; i < N * BlockCountK * BlockSize / 2; i++) {
+      QuantB[i] = static_cast<uint8_t>(int_distribution(generator));
+    }
+
+    float* Scales = BufferScales.GetBuffer(N * BlockCountK);
+    for (size_t i = 0; i < N * BlockCountK; i++) {
+      Scales[i] = real_distribution(generator) / 8.0f;
+    }
+
+    uint8_t* ZeroPoints = nullptr;
+    if (HasZeroPoints) {
+      ZeroPoints = BufferZeroPoints.GetBuffer(N * ZeroPointBytes);
+      for (size_t i = 0; i < N * ZeroPointBytes; i++) {
+        ZeroPoints[i] = static_cast<uint8_t>(int_distribution(generator));
+      }
+    }
+
+    float* Bias = nullptr;
+    if (HasBias) {
+      Bias = BufferBias.GetBuffer(N);
+      for (size_t n = 0; n < N; n++) {
+        Bias[n] = real_distribution(generator);
+      }
+    }
+
+    //
+    // Dequantize matrix B to row major order for the reference computation.
+    //
+
+    float* DequantB = BufferDequantB.GetBuffer(K * N);
+    for (size_t n = 0; n < N; n++) {
+      for (size_t k = 0; k < K; k++) {
+        const size_t b = k / BlockSize;
+        const uint8_t pair = QuantB[(n * BlockCountK + b) * (BlockSize / 2) + (k % BlockSize) / 2];
+        const int q = (k & 1) ? (pair >> 4) : (pair & 0x0F);
+        int zp = 8;
+        if (HasZeroPoints) {
+          const uint8_t zp_pair = ZeroPoints[n * ZeroPointBytes + b / 2];
+          zp = (b & 1) ? (zp_pair >> 4) : (zp_pair & 0x0F);
+        }
+        DequantB[k * N + n] = float(q - zp) * Scales[n * BlockCountK + b];
+      }
+    }
+
+    //
+    // The kernel accumulates in single precision in an implementation defined
+    // order, so scale the tolerance by the magnitude of the summed products.
+    //
+
+    float* CReference = BufferCReference.GetBuffer(M * N);
+    float* CTolerance = BufferCTolerance.GetBuffer(M * N);
+    for (size_t m = 0; m < M; m++) {
+      for (size_t n = 0; n < N; n++) {
+        double sum = HasBias ? Bias[n] : 0.0;
+        double abs_sum = std::fabs(sum);
+        for (size_t k = 0; k < K; k++) {
+          const double product = double(A[m * K + k]) * double(DequantB[k * N + n]);
+          sum += product;
+          abs_sum += std::fabs(product);
+        }
+        CReference[m * N + n] = float(sum);
+        CTolerance[m * N + n] = float(abs_sum * 1e-5 + 1e-6);
+      }
+    }
+
+    const size_t PackedBSize = MlasQ4GemmPackBSize(N, K, BlockSize);
+    ASSERT_GT(PackedBSize, size_t(0));
+
+    uint8_t* PackedB = BufferPackedB.GetBuffer(PackedBSize);
+    MlasQ4GemmPackB(PackedB, QuantB, Scales, ZeroPoints, N, K, BlockSize);
+
+    float* C = BufferC.GetBuffer(M * N);
+    std::fill_n(C, M * N, -0.5f);
+
+    MLAS_Q4_GEMM_DATA_PARAMS DataParams;
+    DataParams.A = A;
+    DataParams.lda = K;
+    DataParams.PackedB = PackedB;
+    DataParams.C = C;
+    DataParams.ldc = N;
+    DataParams.Bias = Bias;
+
+    MlasQ4GemmBatch(M, N, K, BlockSize, &DataParams, 1, threadpool_);
+
+    for (size_t i = 0; i < M * N; i++) {
+      ASSERT_LE(std::fabs(C[i] - CReference[i]), CTolerance[i])
+          << "@[" << i / N << "," << i % N << "], "
+          << "M=" << M << ", N=" << N << ", K=" << K << ", BlockSize=" << BlockSize
+          << ", ZeroPoints=" << HasZeroPoints << ", Bias=" << HasBias
+          << ", got:" << C[i] << ", expecting:" << CReference[i];
+    }
+  }
+
+ public:
+  MlasQ4GemmTest() : threadpool_(Threaded ? GetMlasThreadPool() : nullptr) {}
+
+  static const char* GetTestSuiteName() {
+    static const std::string suite_name(std::string("Q4Gemm") + (Threaded ? "_Threaded" : "_SingleThread"));
+    return suite_name.c_str();
+  }
+
+  void ExecuteShort(void) override {
+    EXPECT_EQ(MlasQ4GemmPackBSize(16, 16, 8), size_t(0));
+    EXPECT_EQ(MlasQ4GemmPackBSize(16, 16, 48), size_t(0));
+    EXPECT_EQ(MlasQ4GemmPackBSize(16, 16, 512), size_t(0));
+
+    static const size_t block_sizes[] = {16, 32, 64, 128, 256};
+
+    for (size_t block_size : block_sizes) {
+      for (size_t m : {1, 2, 3, 4, 7, 8, 9, 17}) {
+        for (size_t n : {1, 3, 4, 5, 16, 33}) {
+          for (size_t k : {1, 7, 16, 33, 96, 257}) {
+            Test(m, n, k, block_size, false, false);
+            Test(m, n, k, block_size, true, true);
+          }
+        }
+      }
+    }
+
+    Test(1, 1024, 1024, 32, true, false);
+    Test(5, 512, 768, 64, false, true);
+    Test(32, 256, 600, 128, true, true);
+    Test(64, 96, 1024, 32, true, false);
+  }
+};
+
+template <> MlasQ4GemmTest<false>* MlasTestFixture<MlasQ4GemmTest<false>>::mlas_tester(nullptr);
+template <> MlasQ4GemmTest<true>* MlasTestFixture<MlasQ4GemmTest<true>>::mlas_tester(nullptr);
+
+static UNUSED_VARIABLE bool added_to_main = AddTestRegister([](bool is_short_execute) {
+  size_t count = 0;
+  if (is_short_execute) {
+    count += MlasDirectShortExecuteTests<MlasQ4GemmTest<false>>::RegisterShortExecute();
+    count += MlasDirectShortExecuteTests<MlasQ4GemmTest<true>>::RegisterShortExecute();
+  }
+  return count;
+});
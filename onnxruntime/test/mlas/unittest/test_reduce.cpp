@@ -0,0 +1,95 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "test_util.h"
+
+class MlasReduceTest : public MlasTestBase {
+ private:
+  MatrixGuardBuffer<float> BufferInput;
+  MatrixGuardBuffer<float> BufferOutput;
+
+  static double ReferenceReduce(MLAS_REDUCTION_KIND Kind, const float* Input, size_t Stride, size_t Count) {
+    double Result = Input[0];
+    for (size_t i = 1; i < Count; i++) {
+      double Value = Input[i * Stride];
+      switch (Kind) {
+        case MlasMaximumReduction:
+        case MlasLogSumExpReduction:
+          Result = std::max(Result, Value);
+          break;
+        case MlasMinimumReduction:
+          Result = std::min(Result, Value);
+          break;
+        default:
+          Result += Value;
+          break;
+      }
+    }
+    if (Kind == MlasLogSumExpReduction) {
+      double Maximum = Result;
+      double Sum = 0.0;
+      for (size_t i = 0; i < Count; i++) {
+        Sum += std::exp(Input[i * Stride] - Maximum);
+      }
+      Result = std::log(Sum) + Maximum;
+    }
+    return Result;
+  }
+
+  void Test(MLAS_REDUCTION_KIND Kind, size_t Rows, size_t Columns, size_t InputStride) {
+    float* Input = BufferInput.GetBuffer(Rows * InputStride);
+    float* Output = BufferOutput.GetBuffer(std::max(Rows, Columns));
+
+    std::default_random_engine generator(static_cast<unsigned>(Rows * 131 + Columns));
+    std::uniform_real_distribution<float> distribution(-10.f, 10.f);
+    for (size_t n = 0; n < Rows * InputStride; n++) {
+      Input[n] = distribution(generator);
+    }
+
+    constexpr double epsilon = 1e-4;
+
+    MlasReduceRows(Kind, Input, Output, Rows, InputStride);
+    for (size_t r = 0; r < Rows; r++) {
+      double Expected = ReferenceReduce(Kind, Input + r * InputStride, 1, InputStride);
+      ASSERT_NEAR(Output[r], Expected, epsilon * std::max(1.0, std::fabs(Expected)))
+          << " for rows of kind " << Kind << " with parameter (" << Rows << "," << InputStride << ") at row " << r;
+    }
+
+    MlasReduceColumns(Kind, Input, InputStride, Output, Rows, Columns);
+    for (size_t c = 0; c < Columns; c++) {
+      double Expected = ReferenceReduce(Kind, Input + c, InputStride, Rows);
+      ASSERT_NEAR(Output[c], Expected, epsilon * std::max(1.0, std::fabs(Expected)))
+          << " for columns of kind " << Kind << " with parameter (" << Rows << "," << Columns << ","
+          << InputStride << ") at column " << c;
+    }
+  }
+
+ public:
+  static const char* GetTestSuiteName() {
+    static const std::string suite_name("Reduce");
+    return suite_name.c_str();
+  }
+
+  void ExecuteShort(void) override {
+    for (int Kind = 0; Kind < MlasReductionKindCount; Kind++) {
+      for (size_t Rows = 1; Rows < 20; Rows += 3) {
+        for (size_t Columns = 1; Columns < 70; Columns++) {
+          Test(static_cast<MLAS_REDUCTION_KIND>(Kind), Rows, Columns, Columns + Rows % 3);
+        }
+      }
+      Test(static_cast<MLAS_REDUCTION_KIND>(Kind), 3, 1000, 1000);
+      Test(static_cast<MLAS_REDUCTION_KIND>(Kind), 1000, 3, 5);
+    }
+  }
+};
+
+template <> MlasReduceTest* MlasTestFixture<MlasReduceTest>::mlas_tester(nullptr);
+
+#ifdef __GNUC__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#endif
+
+static UNUSED_VARIABLE bool added_to_main = AddTestRegister([](bool is_short_execute) {
+  return is_short_execute ? MlasDirectShortExecuteTests<MlasReduceTest>::RegisterShortExecute() : 0;
+});
@@ -0,0 +1,134 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "test_util.h"
+
+template <bool Threaded>
+class MlasSparseGemmTest : public MlasTestBase {
+ private:
+  MatrixGuardBuffer<float> BufferA;
+  MatrixGuardBuffer<float> BufferB;
+  MatrixGuardBuffer<float> BufferC;
+  MatrixGuardBuffer<float> BufferCReference;
+  MLAS_THREADPOOL* threadpool_;
+
+  // Builds a compressed form of the Rows x Columns matrix. When ByRow is false the
+  // matrix is compressed by column.
+  static void Compress(const float* Matrix, size_t Rows, size_t Columns, bool ByRow,
+                       std::vector<float>& Values, std::vector<uint32_t>& Indices, std::vector<size_t>& Offsets) {
+    const size_t Outer = ByRow ? Rows : Columns;
+    const size_t Inner = ByRow ? Columns : Rows;
+
+    Values.clear();
+    Indices.clear();
+    Offsets.assign(1, 0);
+
+    for (size_t o = 0; o < Outer; o++) {
+      for (size_t i = 0; i < Inner; i++) {
+        const float Value = ByRow ? Matrix[o * Columns + i] : Matrix[i * Columns + o];
+        if (Value != 0.0f) {
+          Values.push_back(Value);
+          Indices.push_back(static_cast<uint32_t>(i));
+        }
+      }
+      Offsets.push_back(Values.size());
+    }
+  }
+
+  static void FillSparse(float* Matrix, size_t Count, float Density, std::default_random_engine& generator) {
+    std::uniform_real_distribution<float> value_distribution(-1.0f, 1.0f);
+    std::uniform_real_distribution<float> density_distribution(0.0f, 1.0f);
+
+    for (size_t i = 0; i < Count; i++) {
+      Matrix[i] = density_distribution(generator) < Density ? value_distribution(generator) : 0.0f;
+    }
+  }
+
+  void Test(size_t M, size_t N, size_t K, float Density, float Alpha, bool SparseA) {
+    float* A = BufferA.GetBuffer(M * K);
+    float* B = BufferB.GetBuffer(K * N);
+    float* C = BufferC.GetBuffer(M * N);
+    float* CReference = BufferCReference.GetBuffer(M * N);
+
+    std::default_random_engine generator(static_cast<unsigned>(M * N * K + SparseA));
+
+    FillSparse(A, M * K, SparseA ? Density : 1.0f, generator);
+    FillSparse(B, K * N, SparseA ? 1.0f : Density, generator);
+
+    for (size_t i = 0; i < M * N; i++) {
+      C[i] = -0.5f;
+    }
+
+    std::vector<float> Values;
+    std::vector<uint32_t> Indices;
+    std::vector<size_t> Offsets;
+
+    if (SparseA) {
+      Compress(A, M, K, true, Values, Indices, Offsets);
+      MlasSparseGemmCsrA(M, N, Alpha, Values.data(), Indices.data(), Offsets.data(), B, N, C, N, threadpool_);
+    } else {
+      Compress(B, K, N, false, Values, Indices, Offsets);
+      MlasSparseGemmCscB(M, N, Alpha, A, K, Values.data(), Indices.data(), Offsets.data(), C, N, threadpool_);
+    }
+
+    ReferenceGemm(M, N, K, Alpha, A, B, CReference);
+
+    for (size_t i = 0; i < M * N; i++) {
+      ASSERT_NEAR(C[i], CReference[i], 1e-4f + std::fabs(CReference[i]) * 1e-5f)
+          << "SparseA:" << SparseA << " M:" << M << " N:" << N << " K:" << K
+          << " Density:" << Density << " index " << i;
+    }
+  }
+
+  static void ReferenceGemm(size_t M, size_t N, size_t K, float Alpha, const float* A, const float* B, float* C) {
+    for (size_t m = 0; m < M; m++) {
+      for (size_t n = 0; n < N; n++) {
+        double Sum = 0.0;
+        for (size_t k = 0; k < K; k++) {
+          Sum += double(A[m * K + k]) * double(B[k * N + n]);
+        }
+        C[m * N + n] = float(Sum * Alpha);
+      }
+    }
+  }
+
+ public:
+  static const char* GetTestSuiteName() {
+    static const std::string suite_name(Threaded ? "SparseGemm_Threaded" : "SparseGemm_SingleThread");
+    return suite_name.c_str();
+  }
+
+  MlasSparseGemmTest() : threadpool_(Threaded ? GetMlasThreadPool() : nullptr) {}
+
+  void ExecuteShort(void) override {
+    for (bool SparseA : {false, true}) {
+      for (size_t m : {1, 3, 4, 7, 16}) {
+        for (size_t n : {1, 5, 8, 13, 32}) {
+          Test(m, n, 19, 0.2f, 1.0f, SparseA);
+        }
+      }
+
+      Test(64, 96, 128, 0.0f, 1.0f, SparseA);
+      Test(64, 96, 128, 0.05f, 0.5f, SparseA);
+      Test(128, 256, 512, 0.1f, 1.0f, SparseA);
+      Test(1, 1024, 2048, 0.02f, 1.0f, SparseA);
+      Test(33, 1, 77, 0.5f, 2.0f, SparseA);
+      Test(40, 24, 700, 0.1f, 1.0f, SparseA);
+      Test(5, 7, 0, 0.1f, 1.0f, SparseA);
+    }
+  }
+};
+
+template <> MlasSparseGemmTest<false>* MlasTestFixture<MlasSparseGemmTest<false>>::mlas_tester(nullptr);
+template <> MlasSparseGemmTest<true>* MlasTestFixture<MlasSparseGemmTest<true>>::mlas_tester(nullptr);
+
+static UNUSED_VARIABLE bool added_to_main = AddTestRegister([](bool is_short_execute) {
+  size_t count = 0;
+  if (is_short_execute) {
+    count += MlasDirectShortExecuteTests<MlasSparseGemmTest<false>>::RegisterShortExecute();
+    if (GetMlasThreadPool() != nullptr) {
+      count += MlasDirectShortExecuteTests<MlasSparseGemmTest<true>>::RegisterShortExecute();
+    }
+  }
+  return count;
+});
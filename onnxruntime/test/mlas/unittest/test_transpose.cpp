@@ -10,22 +10,57 @@ class MlasTransposeTest : public MlasTestBase {
   MatrixGuardBuffer<ElementType> BufferOutput;
   MatrixGuardBuffer<ElementType> BufferOutputReference;
 
+  // Element types without a contiguous transpose routine use the strided one.
+  template <typename T>
+  static void Transpose(const T* Input, T* Output, size_t M, size_t N) {
+    MlasTranspose(Input, N, Output, M, M, N);
+  }
+
+  static void Transpose(const uint8_t* Input, uint8_t* Output, size_t M, size_t N) {
+    MlasTranspose(Input, Output, M, N);
+  }
+
+  static void Transpose(const uint32_t* Input, uint32_t* Output, size_t M, size_t N) {
+    MlasTranspose(Input, Output, M, N);
+  }
+
   void
   Test(size_t M, size_t N) {
     ElementType* Input = BufferInput.GetBuffer(M * N);
     ElementType* Output = BufferOutput.GetBuffer(M * N);
     ElementType* OutputReference = BufferOutputReference.GetBuffer(M * N);
 
-    MlasTranspose(Input, Output, M, N);
+    Transpose(Input, Output, M, N);
     ReferenceTranspose(Input, OutputReference, M, N);
 
     ASSERT_EQ(memcmp(Output, OutputReference, M * N * sizeof(ElementType)), 0) << " [" << M << "," << N << "]";
   }
 
+  // The rows of the matrices are padded, so elements outside the matrices must be left unchanged.
+  void
+  TestStrided(size_t M, size_t N) {
+    const size_t InputStride = N + 3;
+    const size_t OutputStride = M + 5;
+    ElementType* Input = BufferInput.GetBuffer(M * InputStride);
+    ElementType* Output = BufferOutput.GetBuffer(N * OutputStride);
+    ElementType* OutputReference = BufferOutputReference.GetBuffer(N * OutputStride);
+
+    MlasTranspose(Input, InputStride, Output, OutputStride, M, N);
+    ReferenceTranspose(Input, InputStride, OutputReference, OutputStride, M, N);
+
+    ASSERT_EQ(memcmp(Output, OutputReference, N * OutputStride * sizeof(ElementType)), 0)
+        << " strided [" << M << "," << N << "]";
+  }
+
   void ReferenceTranspose(const ElementType* Input, ElementType* Output, size_t M, size_t N) {
+    ReferenceTranspose(Input, N, Output, M, M, N);
+  }
+
+  void ReferenceTranspose(const ElementType* Input, size_t InputStride, ElementType* Output, size_t OutputStride,
+                          size_t M, size_t N) {
     for (size_t m = 0; m < M; m++) {
       for (size_t n = 0; n < N; n++) {
-        Output[n * M + m] = Input[m * N + n];
+        Output[n * OutputStride + m] = Input[m * InputStride + n];
       }
     }
   }
@@ -40,19 +75,28 @@ class MlasTransposeTest : public MlasTestBase {
     for (size_t m = 1; m <= 32; m++) {
       for (size_t n = 1; n <= 32; n++) {
         Test(m, n);
+        TestStrided(m, n);
       }
     }
+
+    // Larger matrices span several row tiles.
+    Test(200, 67);
+    TestStrided(131, 45);
   }
 };
 
 template <> MlasTransposeTest<uint32_t>* MlasTestFixture<MlasTransposeTest<uint32_t>>::mlas_tester(nullptr);
 template <> MlasTransposeTest<uint8_t>* MlasTestFixture<MlasTransposeTest<uint8_t>>::mlas_tester(nullptr);
+template <> MlasTransposeTest<uint16_t>* MlasTestFixture<MlasTransposeTest<uint16_t>>::mlas_tester(nullptr);
+template <> MlasTransposeTest<uint64_t>* MlasTestFixture<MlasTransposeTest<uint64_t>>::mlas_tester(nullptr);
 
 static UNUSED_VARIABLE bool added_to_main = AddTestRegister([](bool is_short_execute) {
   size_t count = 0;
   if (is_short_execute) {
       count += MlasDirectShortExecuteTests<MlasTransposeTest<uint32_t>>::RegisterShortExecute();
       count += MlasDirectShortExecuteTests<MlasTransposeTest<uint8_t>>::RegisterShortExecute();
+      count += MlasDirectShortExecuteTests<MlasTransposeTest<uint16_t>>::RegisterShortExecute();
+      count += MlasDirectShortExecuteTests<MlasTransposeTest<uint64_t>>::RegisterShortExecute();
   }
   return count;
 });
@@ -30,7 +30,9 @@
 #include "core/optimizer/div_mul_fusion.h"
 #include "core/optimizer/dropout_elimination.h"
 #include "core/optimizer/dynamic_quantize_matmul_fusion.h"
+#include "core/optimizer/elementwise_fusion.h"
 #include "core/optimizer/embed_layer_norm_fusion.h"
+#include "core/optimizer/embedding_bag_fusion.h"
 #include "core/optimizer/expand_elimination.h"
 #include "core/optimizer/fast_gelu_fusion.h"
 #include "core/optimizer/gelu_approximation.h"
@@ -66,6 +68,7 @@
 #include "test/common/tensor_op_test_utils.h"
 #include "test/compare_ortvalue.h"
 #include "test/framework/test_utils.h"
+#include "test/optimizer/graph_transform_test_builder.h"
 #include "test/optimizer/graph_transform_test_fixture.h"
 #include "test/providers/provider_test_utils.h"
 #include "test/test_environment.h"
@@ -727,6 +730,94 @@ TEST_F(GraphTransformationTests, FuseConvClip11Activation) {
     }
   }
 }
+
+// HardSigmoid, Softplus and HardSwish are only implemented by the CPU FusedConv kernel. The fused graph is run
+// against the unfused one, so this also checks the activations applied by the kernel.
+TEST_F(GraphTransformationTests, FuseConvCpuActivation) {
+  auto test_case = [&](const std::string& activation_op_type, const std::vector<float>& expected_params) {
+    auto build_test_case = [&](ModelTestBuilder& builder) {
+      auto* input_arg = builder.MakeInput<float>({1, 3, 7, 7}, -3.f, 3.f);
+      auto* weight_arg = builder.MakeInitializer<float>({8, 3, 3, 3}, -0.5f, 0.5f);
+      auto* bias_arg = builder.MakeInitializer<float>({8}, -1.f, 1.f);
+      auto* conv_output_arg = builder.MakeIntermediate();
+      auto* output_arg = builder.MakeOutput();
+
+      builder.AddNode("Conv", {input_arg, weight_arg, bias_arg}, {conv_output_arg})
+          .AddAttribute("pads", std::vector<int64_t>{1, 1, 1, 1});
+      Node& activation_node = builder.AddNode(activation_op_type, {conv_output_arg}, {output_arg});
+      if (activation_op_type == "HardSigmoid") {
+        activation_node.AddAttribute("alpha", expected_params[0]);
+      }
+    };
+
+    auto check_graph = [&](InferenceSessionWrapper& session) {
+      auto op_to_count = CountOpsInGraph(session.GetGraph());
+      EXPECT_EQ(op_to_count["com.microsoft.FusedConv"], 1);
+      EXPECT_EQ(op_to_count["Conv"], 0);
+      EXPECT_EQ(op_to_count[activation_op_type], 0);
+
+      for (const Node& node : session.GetGraph().Nodes()) {
+        if (node.OpType() == "FusedConv") {
+          EXPECT_EQ(node.GetAttributes().at("activation").s(), activation_op_type);
+          const auto& attributes = node.GetAttributes();
+          const auto params_attr = attributes.find("activation_params");
+          if (expected_params.empty()) {
+            EXPECT_TRUE(params_attr == attributes.cend());
+          } else {
+            ASSERT_TRUE(params_attr != attributes.cend());
+            std::vector<float> params(params_attr->second.floats().begin(), params_attr->second.floats().end());
+            EXPECT_EQ(params, expected_params);
+          }
+        }
+      }
+    };
+
+    TransformerTester(build_test_case, check_graph, TransformerLevel::Level1, TransformerLevel::Level2,
+                      14, 1e-4, 1e-4);
+  };
+
+  // beta is left at its default
+  test_case("HardSigmoid", {0.25f, 0.5f});
+  test_case("Softplus", {});
+  test_case("HardSwish", {});
+}
+
+TEST_F(GraphTransformationTests, FuseConvCpuActivationNotFusedForOtherProviders) {
+  std::unordered_map<std::string, int> domain_to_version;
+  domain_to_version[kOnnxDomain] = 14;
+  Model model("FuseConvCpuActivation", false, ModelMetaData(), PathString(), IOnnxRuntimeOpSchemaRegistryList(),
+              domain_to_version, {}, *logger_);
+  Graph& graph = model.MainGraph();
+  ModelTestBuilder builder(graph);
+
+  for (const char* activation_op_type : {"HardSigmoid", "Softplus", "HardSwish", "Relu"}) {
+    auto* input_arg = builder.MakeInput<float>({1, 3, 7, 7}, -3.f, 3.f);
+    auto* weight_arg = builder.MakeInitializer<float>({8, 3, 3, 3}, -0.5f, 0.5f);
+    auto* conv_output_arg = builder.MakeIntermediate();
+    auto* output_arg = builder.MakeOutput();
+    builder.AddConvNode(input_arg, weight_arg, conv_output_arg);
+    builder.AddNode(activation_op_type, {conv_output_arg}, {output_arg});
+  }
+  ASSERT_STATUS_OK(graph.Resolve());
+
+  // CUDA has its own fusion rules, so use another provider that takes the generic activation path.
+  for (auto& node : graph.Nodes()) {
+    node.SetExecutionProviderType(kRocmExecutionProvider);
+  }
+
+  onnxruntime::GraphTransformerManager graph_transformation_mgr{5};
+  graph_transformation_mgr.Register(onnxruntime::make_unique<ConvActivationFusion>(), TransformerLevel::Level2);
+  ASSERT_STATUS_OK(graph_transformation_mgr.ApplyTransformers(graph, TransformerLevel::Level2, *logger_));
+
+  // Relu is fused, the activations implemented only by the CPU FusedConv kernel are not.
+  std::map<std::string, int> op_to_count = CountOpsInGraph(graph);
+  EXPECT_EQ(op_to_count["com.microsoft.FusedConv"], 1);
+  EXPECT_EQ(op_to_count["Relu"], 0);
+  EXPECT_EQ(op_to_count["Conv"], 3);
+  EXPECT_EQ(op_to_count["HardSigmoid"], 1);
+  EXPECT_EQ(op_to_count["Softplus"], 1);
+  EXPECT_EQ(op_to_count["HardSwish"], 1);
+}
 #endif
 
 TEST_F(GraphTransformationTests, FuseConvMulNoBias) {
@@ -1173,8 +1264,7 @@ TEST_F(GraphTransformationTests, FuseConvBnAddMulFloat16) {
   ASSERT_EQ(1u, fetches.size());
   auto& rtensor = fetches.front().Get<Tensor>();
   TensorShape expected_shape(expected_dims_prod);
-  //Use reinterpret_cast to bypass a gcc bug: https://gcc.gnu.org/bugzilla/show_bug.cgi?id=51213
-  ASSERT_EQ(*reinterpret_cast<const std::vector<int64_t>*>(&expected_shape), *reinterpret_cast<const std::vector<int64_t>*>(&rtensor.Shape()));
+  ASSERT_EQ(expected_shape.GetDimsAsVector(), rtensor.Shape().GetDimsAsVector());
   const std::vector<MLFloat16> found(rtensor.template Data<MLFloat16>(),
                                      rtensor.template Data<MLFloat16>() + expected_dims_prod.size());
   ASSERT_EQ(expected_values_prod, found);
@@ -3942,6 +4032,87 @@ TEST_F(GraphTransformationTests, MatMulScaleFusionUnsupportedInputType) {
       {kCpuExecutionProvider});
 }
 
+TEST_F(GraphTransformationTests, EmbeddingBagFusion) {
+  auto test_case = [&](const std::string& reduce_op_type, int opset_version, int64_t axis, int64_t keepdims,
+                       bool expect_fusion) {
+    auto build_test_case = [&](ModelTestBuilder& builder) {
+      auto* data_arg = builder.MakeInitializer<float>({10, 8}, -1.f, 1.f);
+      auto* indices_arg = builder.MakeInput<int64_t>({3, 4}, -10, 10);
+      auto* gather_output_arg = builder.MakeIntermediate();
+      auto* output_arg = builder.MakeOutput();
+
+      builder.AddNode("Gather", {data_arg, indices_arg}, {gather_output_arg});
+
+      // ReduceSum takes the axes as an input from opset 13.
+      if (reduce_op_type == "ReduceSum" && opset_version >= 13) {
+        auto* axes_arg = builder.Make1DInitializer<int64_t>({axis});
+        builder.AddNode(reduce_op_type, {gather_output_arg, axes_arg}, {output_arg})
+            .AddAttribute("keepdims", keepdims);
+      } else {
+        Node& reduce_node = builder.AddNode(reduce_op_type, {gather_output_arg}, {output_arg});
+        reduce_node.AddAttribute("axes", std::vector<int64_t>{axis});
+        reduce_node.AddAttribute("keepdims", keepdims);
+      }
+    };
+
+    auto check_graph = [&](InferenceSessionWrapper& session) {
+      auto op_to_count = CountOpsInGraph(session.GetGraph());
+      EXPECT_EQ(op_to_count["com.microsoft.EmbeddingBag"], expect_fusion ? 1 : 0);
+      EXPECT_EQ(op_to_count["Gather"], expect_fusion ? 0 : 1);
+      EXPECT_EQ(op_to_count[reduce_op_type], expect_fusion ? 0 : 1);
+    };
+
+    TransformerTester(build_test_case, check_graph, TransformerLevel::Level1, TransformerLevel::Level2,
+                      opset_version, 1e-5, 1e-5);
+  };
+
+  test_case("ReduceSum", 12, 1, 1, true);
+  test_case("ReduceSum", 13, -2, 0, true);
+  test_case("ReduceMean", 12, 1, 0, true);
+  test_case("ReduceMean", 13, -2, 1, true);
+
+  // Reducing over the axes of the data is left alone.
+  test_case("ReduceSum", 12, 2, 1, false);
+  test_case("ReduceMean", 13, 0, 1, false);
+}
+
+TEST_F(GraphTransformationTests, ElementwiseFusion) {
+  auto test_case = [&](const std::vector<int64_t>& bias_shape, int opset_version, bool expect_fusion) {
+    auto build_test_case = [&](ModelTestBuilder& builder) {
+      auto* input_arg = builder.MakeInput<float>({2, 3, 4}, -2.f, 2.f);
+      auto* scale_arg = builder.MakeScalarInitializer<float>(0.5f);
+      auto* bias_arg = builder.MakeInitializer<float>(bias_shape, -1.f, 1.f);
+      auto* mul_output_arg = builder.MakeIntermediate();
+      auto* add_output_arg = builder.MakeIntermediate();
+      auto* sigmoid_output_arg = builder.MakeIntermediate();
+      auto* output_arg = builder.MakeOutput();
+
+      // x * sigmoid(x) where x = input * scale + bias, so the result of Add is read by two operators.
+      builder.AddNode("Mul", {input_arg, scale_arg}, {mul_output_arg});
+      builder.AddNode("Add", {mul_output_arg, bias_arg}, {add_output_arg});
+      builder.AddNode("Sigmoid", {add_output_arg}, {sigmoid_output_arg});
+      builder.AddNode("Mul", {add_output_arg, sigmoid_output_arg}, {output_arg});
+    };
+
+    auto check_graph = [&](InferenceSessionWrapper& session) {
+      auto op_to_count = CountOpsInGraph(session.GetGraph());
+      EXPECT_EQ(op_to_count["com.microsoft.FusedElementwise"], expect_fusion ? 1 : 0);
+      EXPECT_EQ(op_to_count["Mul"], expect_fusion ? 0 : 2);
+      EXPECT_EQ(op_to_count["Add"], expect_fusion ? 0 : 1);
+      EXPECT_EQ(op_to_count["Sigmoid"], expect_fusion ? 0 : 1);
+    };
+
+    TransformerTester(build_test_case, check_graph, TransformerLevel::Level1, TransformerLevel::Level2,
+                      opset_version, 1e-5, 1e-5);
+  };
+
+  test_case({4}, 12, true);
+  test_case({1, 3, 4}, 13, true);
+
+  // A bias that is broadcast along an inner axis is left alone.
+  test_case({2, 1, 4}, 13, false);
+}
+
 #if defined(USE_CUDA) || defined(USE_ROCM)
 TEST_F(GraphTransformationTests, IsInfReduceSum_Test) {
   auto model_uri = MODEL_FOLDER "fusion/isinf_reducesum.onnx";
@@ -1290,6 +1290,38 @@ TEST(NchwcOptimizerTests, Activation) {
   }
 }
 
+TEST(NchwcOptimizerTests, ElementwiseChain) {
+  auto build_test_case = [&](NchwcTestHelper& helper) {
+    auto* input_arg = helper.MakeInput<float>({1, 32, 23, 23});
+    auto* conv1_output_arg = helper.MakeIntermediate();
+    auto* conv2_output_arg = helper.MakeIntermediate();
+    auto* add_output_arg = helper.MakeIntermediate();
+    auto* relu_output_arg = helper.MakeIntermediate();
+    auto* sigmoid_output_arg = helper.MakeIntermediate();
+    auto* output_arg = helper.MakeOutput();
+
+    helper.AddConvNode(input_arg, conv1_output_arg, {32, 32, 3, 3});
+    helper.AddConvNode(input_arg, conv2_output_arg, {32, 32, 3, 3});
+    helper.AddNode("Add", {conv1_output_arg, conv2_output_arg}, {add_output_arg});
+    helper.AddNode("Relu", {add_output_arg}, {relu_output_arg});
+    helper.AddNode("Sigmoid", {relu_output_arg}, {sigmoid_output_arg});
+    helper.AddConvNode(sigmoid_output_arg, output_arg, {16, 32, 1, 1});
+  };
+
+  auto check_nchwc_graph = [&](InferenceSessionWrapper& session) {
+    auto op_to_count = CountOpsInGraph(session.GetGraph());
+    EXPECT_EQ(op_to_count["com.microsoft.nchwc.Conv"], 3);
+    EXPECT_EQ(op_to_count["com.microsoft.nchwc.ReorderInput"], 1);
+    EXPECT_EQ(op_to_count["com.microsoft.nchwc.ReorderOutput"], 1);
+    EXPECT_EQ(op_to_count["com.microsoft.FusedElementwise"], 0);
+  };
+
+  // Verify that the elementwise operators between the convolutions are not fused
+  // into a FusedElementwise node, which would stop the NCHWc format from
+  // propagating to the last convolution.
+  NchwcOptimizerTester(build_test_case, check_nchwc_graph);
+}
+
 TEST(NchwcOptimizerTests, MaxPoolTypeCheck) {
   auto build_test_case = [&](NchwcTestHelper& helper) {
     auto add_pool_node = [&](NchwcTestHelper& helper, NodeArg* input_arg) {
@@ -441,6 +441,85 @@ TEST(NhwcTransformerTests, ConvMixTensorRanks) {
                     TransformerLevel::Level3);
 }
 
+TEST(NhwcTransformerTests, FloatConvTransposed) {
+  auto build_test_case = [&](ModelTestBuilder& builder) {
+    auto* input_arg = builder.MakeInput<float>({1, 13, 13, 23}, -1.0f, 1.0f);
+    auto* nchw_input_arg = builder.MakeIntermediate();
+    auto* conv1_output_arg = builder.MakeIntermediate();
+    auto* relu_output_arg = builder.MakeIntermediate();
+    auto* dwconv_output_arg = builder.MakeIntermediate();
+    auto* conv2_output_arg = builder.MakeIntermediate();
+    auto* add_output_arg = builder.MakeIntermediate();
+    auto* pool_output_arg = builder.MakeIntermediate();
+    auto* output_arg = builder.MakeOutput();
+
+    Node& transpose1_node = builder.AddNode("Transpose", {input_arg}, {nchw_input_arg});
+    transpose1_node.AddAttribute("perm", std::vector<int64_t>{0, 3, 1, 2});
+
+    auto* conv1_weight_arg = builder.MakeInitializer<float>({32, 23, 3, 3}, -0.5f, 0.5f);
+    Node& conv1_node = builder.AddConvNode(nchw_input_arg, conv1_weight_arg, conv1_output_arg);
+    conv1_node.AddAttribute("pads", std::vector<int64_t>{1, 1, 1, 1});
+    builder.AddNode("Relu", {conv1_output_arg}, {relu_output_arg});
+
+    auto* dwconv_weight_arg = builder.MakeInitializer<float>({32, 1, 3, 3}, -0.5f, 0.5f);
+    Node& dwconv_node = builder.AddConvNode(relu_output_arg, dwconv_weight_arg, dwconv_output_arg);
+    dwconv_node.AddAttribute("group", static_cast<int64_t>(32));
+    dwconv_node.AddAttribute("strides", std::vector<int64_t>{2, 2});
+
+    auto* conv2_weight_arg = builder.MakeInitializer<float>({32, 32, 1, 1}, -0.5f, 0.5f);
+    builder.AddConvNode(dwconv_output_arg, conv2_weight_arg, conv2_output_arg);
+    builder.AddNode("Add", {dwconv_output_arg, conv2_output_arg}, {add_output_arg});
+
+    Node& pool_node = builder.AddNode("MaxPool", {add_output_arg}, {pool_output_arg});
+    pool_node.AddAttribute("kernel_shape", std::vector<int64_t>{3, 3});
+    pool_node.AddAttribute("pads", std::vector<int64_t>{1, 1, 1, 1});
+
+    Node& transpose2_node = builder.AddNode("Transpose", {pool_output_arg}, {output_arg});
+    transpose2_node.AddAttribute("perm", std::vector<int64_t>{0, 2, 3, 1});
+  };
+
+  auto check_nhwc_graph = [&](InferenceSessionWrapper& session) {
+    auto op_to_count = CountOpsInGraph(session.GetGraph());
+    EXPECT_EQ(op_to_count["com.microsoft.NhwcFusedConv"], 3);
+    EXPECT_EQ(op_to_count["com.microsoft.NhwcMaxPool"], 1);
+    EXPECT_EQ(op_to_count["Transpose"], 0);
+  };
+
+  // A channels last model that transposes to and from channels first around the
+  // convolutions should run without any layout transposes.
+  TransformerTester(build_test_case,
+                    check_nhwc_graph,
+                    TransformerLevel::Level2,
+                    TransformerLevel::Level3,
+                    12,
+                    1e-5,
+                    1e-4);
+}
+
+TEST(NhwcTransformerTests, FloatConvChannelsFirst) {
+  auto build_test_case = [&](ModelTestBuilder& builder) {
+    auto* input_arg = builder.MakeInput<float>({1, 23, 13, 13}, -1.0f, 1.0f);
+    auto* output_arg = builder.MakeOutput();
+    auto* weight_arg = builder.MakeInitializer<float>({32, 23, 3, 3}, -0.5f, 0.5f);
+
+    builder.AddConvNode(input_arg, weight_arg, output_arg);
+  };
+
+  auto check_nhwc_graph = [&](InferenceSessionWrapper& session) {
+    auto op_to_count = CountOpsInGraph(session.GetGraph());
+    EXPECT_EQ(op_to_count["com.microsoft.NhwcFusedConv"], 0);
+  };
+
+  // Channels first models are left to the NCHWc transformer.
+  TransformerTester(build_test_case,
+                    check_nhwc_graph,
+                    TransformerLevel::Level2,
+                    TransformerLevel::Level3,
+                    12,
+                    1e-5,
+                    1e-4);
+}
+
 #endif  // DISABLE_CONTRIB_OPS
 
 }  // namespace test
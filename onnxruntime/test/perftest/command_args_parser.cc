@@ -33,6 +33,12 @@ namespace perftest {
       "\t-A: Disable memory arena\n"
       "\t-I: Generate tensor input binding (Free dimensions are treated as 1.)\n"
       "\t-c [parallel runs]: Specifies the (max) number of runs to invoke simultaneously. Default:1.\n"
+      "\t-Q [queries_per_second]: Open-loop mode. Issues requests at the given rate, independent of completions,\n"
+      "\t\tusing '-c' worker threads. Latencies include the time requests wait in the queue. Runs for '-t' seconds or '-r' requests.\n"
+      "\t-a [poisson|fixed]: Inter-arrival time distribution of requests in open-loop mode. Default:'poisson'.\n"
+      "\t-g [free_dimension_range]: With '-I', draws the named free dimension uniformly from a range for each generated input set. "
+      "Syntax is [dimension_name:min_value:max_value]. Values must be > 0\n"
+      "\t-n [input_set_count]: With '-I', the number of generated input sets. Requests pick a set at random. Default:1.\n"
       "\t-e [cpu|cuda|dnnl|tensorrt|openvino|nuphar|dml|acl]: Specifies the provider 'cpu','cuda','dnnl','tensorrt', "
       "'openvino', 'nuphar', 'dml', 'acl', 'nnapi' or 'coreml'. "
       "Default:'cpu'.\n"
@@ -79,6 +85,29 @@ static const ORTCHAR_T* overrideDelimiter = L":";
 #else
 static const ORTCHAR_T* overrideDelimiter = ":";
 #endif
+static bool ParseDimensionRange(std::string& dim_name, std::pair<int64_t, int64_t>& range) {
+  std::basic_string<ORTCHAR_T> dim_range_str(optarg);
+  size_t first_delimiter = dim_range_str.find(overrideDelimiter);
+  if (first_delimiter == 0 || first_delimiter >= dim_range_str.size() - 1) {
+    return false;
+  }
+  size_t second_delimiter = dim_range_str.find(overrideDelimiter, first_delimiter + 1);
+  if (second_delimiter >= dim_range_str.size() - 1) {
+    return false;
+  }
+  dim_name = ToMBString(dim_range_str.substr(0, first_delimiter));
+  ORT_TRY {
+    range.first = std::stoll(dim_range_str.substr(first_delimiter + 1, second_delimiter - first_delimiter - 1));
+    range.second = std::stoll(dim_range_str.substr(second_delimiter + 1));
+    if (range.first <= 0 || range.second < range.first) {
+      return false;
+    }
+  } ORT_CATCH (...) {
+    return false;
+  }
+  return true;
+}
+
 static bool ParseDimensionOverride(std::basic_string<ORTCHAR_T>& dim_identifier, int64_t& override_val) {
   std::basic_string<ORTCHAR_T> free_dim_str(optarg);
   size_t delimiter_location = free_dim_str.find(overrideDelimiter);
@@ -100,7 +129,7 @@ static bool ParseDimensionOverride(std::basic_string<ORTCHAR_T>& dim_identifier,
 
 /*static*/ bool CommandLineParser::ParseArguments(PerformanceTestConfig& test_config, int argc, ORTCHAR_T* argv[]) {
   int ch;
-  while ((ch = getopt(argc, argv, ORT_TSTR("b:m:e:r:t:p:x:y:c:d:o:u:i:f:F:AMPIvhsqz"))) != -1) {
+  while ((ch = getopt(argc, argv, ORT_TSTR("b:m:e:r:t:p:x:y:c:d:o:u:i:f:F:Q:a:g:n:AMPIvhsqz"))) != -1) {
     switch (ch) {
       case 'f': {
         std::basic_string<ORTCHAR_T> dim_name;
@@ -211,6 +240,42 @@ static bool ParseDimensionOverride(std::basic_string<ORTCHAR_T>& dim_identifier,
           return false;
         }
         break;
+      case 'Q':
+        ORT_TRY {
+          test_config.run_config.target_qps = std::stod(optarg);
+        } ORT_CATCH (...) {
+          return false;
+        }
+        if (test_config.run_config.target_qps <= 0) {
+          return false;
+        }
+        break;
+      case 'a':
+        if (!CompareCString(optarg, ORT_TSTR("poisson"))) {
+          test_config.run_config.arrival_distribution = ArrivalDistribution::kPoisson;
+        } else if (!CompareCString(optarg, ORT_TSTR("fixed"))) {
+          test_config.run_config.arrival_distribution = ArrivalDistribution::kFixed;
+        } else {
+          return false;
+        }
+        break;
+      case 'g': {
+        std::string dim_name;
+        std::pair<int64_t, int64_t> range;
+        if (!ParseDimensionRange(dim_name, range)) {
+          return false;
+        }
+        test_config.run_config.free_dim_name_ranges[dim_name] = range;
+        break;
+      }
+      case 'n': {
+        const long generated_input_count = OrtStrtol<PATH_CHAR_TYPE>(optarg, nullptr);
+        if (generated_input_count <= 0) {
+          return false;
+        }
+        test_config.run_config.generated_input_count = static_cast<size_t>(generated_input_count);
+        break;
+      }
       case 'o': {
         int tmp = static_cast<int>(OrtStrtol<PATH_CHAR_TYPE>(optarg, nullptr));
         switch (tmp) {
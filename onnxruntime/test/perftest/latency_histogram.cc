@@ -0,0 +1,116 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "latency_histogram.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+
+namespace onnxruntime {
+namespace perftest {
+
+namespace {
+
+uint64_t MostSignificantBit(uint64_t value) {
+  uint64_t msb = 0;
+  while (value >>= 1) {
+    ++msb;
+  }
+  return msb;
+}
+
+}  // namespace
+
+LatencyHistogram::LatencyHistogram()
+    // One exact bucket per value below kSubBucketCount, then kSubBucketHalfCount buckets for each
+    // remaining power of two of a 64-bit value.
+    : counts_(kSubBucketCount + (64 - kSubBucketBits) * kSubBucketHalfCount) {
+}
+
+size_t LatencyHistogram::GetBucketIndex(uint64_t value) {
+  if (value < kSubBucketCount) {
+    return static_cast<size_t>(value);
+  }
+  const uint64_t shift = MostSignificantBit(value) - (kSubBucketBits - 1);
+  const uint64_t sub_bucket = value >> shift;
+  return static_cast<size_t>(kSubBucketCount + (shift - 1) * kSubBucketHalfCount + (sub_bucket - kSubBucketHalfCount));
+}
+
+uint64_t LatencyHistogram::GetBucketLowerBound(size_t index) {
+  if (index < kSubBucketCount) {
+    return index;
+  }
+  const uint64_t offset = index - kSubBucketCount;
+  const uint64_t shift = offset / kSubBucketHalfCount + 1;
+  const uint64_t sub_bucket = offset % kSubBucketHalfCount + kSubBucketHalfCount;
+  return sub_bucket << shift;
+}
+
+uint64_t LatencyHistogram::GetBucketUpperBound(size_t index) {
+  if (index < kSubBucketCount) {
+    return index;
+  }
+  const uint64_t shift = (index - kSubBucketCount) / kSubBucketHalfCount + 1;
+  return GetBucketLowerBound(index) + ((uint64_t{1} << shift) - 1);
+}
+
+void LatencyHistogram::Record(std::chrono::nanoseconds latency) {
+  const uint64_t value = static_cast<uint64_t>(std::max<std::chrono::nanoseconds::rep>(latency.count(), 0));
+  counts_[GetBucketIndex(value)]++;
+  count_++;
+  min_ = std::min(min_, value);
+  max_ = std::max(max_, value);
+  sum_ += static_cast<double>(value);
+}
+
+std::chrono::nanoseconds LatencyHistogram::Mean() const {
+  if (count_ == 0) {
+    return std::chrono::nanoseconds(0);
+  }
+  return std::chrono::nanoseconds(static_cast<std::chrono::nanoseconds::rep>(sum_ / count_));
+}
+
+std::chrono::nanoseconds LatencyHistogram::Percentile(double percentile) const {
+  if (count_ == 0) {
+    return std::chrono::nanoseconds(0);
+  }
+
+  // Rank of the requested value, counting from 1.
+  const double clamped = std::min(std::max(percentile, 0.0), 100.0);
+  const uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(clamped / 100.0 * count_)));
+
+  uint64_t cumulative = 0;
+  for (size_t i = 0; i < counts_.size(); i++) {
+    cumulative += counts_[i];
+    if (cumulative >= rank) {
+      // Report the bucket's highest equivalent value, but never beyond the recorded range.
+      const uint64_t value = std::min(std::max(GetBucketUpperBound(i), min_), max_);
+      return std::chrono::nanoseconds(static_cast<std::chrono::nanoseconds::rep>(value));
+    }
+  }
+  return Max();
+}
+
+void LatencyHistogram::Print(std::ostream& ostream) const {
+  auto to_ms = [](std::chrono::nanoseconds value) {
+    return std::chrono::duration<double, std::milli>(value).count();
+  };
+
+  const std::ios_base::fmtflags flags = ostream.flags();
+  ostream << std::fixed << std::setprecision(3);
+  ostream << "Latency histogram (ms), " << count_ << " requests:\n"
+          << "  Min:    " << to_ms(Min()) << "\n"
+          << "  Mean:   " << to_ms(Mean()) << "\n";
+  for (double percentile : {50.0, 90.0, 95.0, 99.0, 99.9, 99.99}) {
+    std::ostringstream label;
+    label << "P" << percentile << ":";
+    ostream << "  " << std::left << std::setw(8) << label.str() << std::right << to_ms(Percentile(percentile)) << "\n";
+  }
+  ostream << "  Max:    " << to_ms(Max()) << std::endl;
+  ostream.flags(flags);
+}
+
+}  // namespace perftest
+}  // namespace onnxruntime
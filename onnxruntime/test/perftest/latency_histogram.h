@@ -0,0 +1,52 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+namespace onnxruntime {
+namespace perftest {
+
+// Log-linear latency histogram with a fixed relative precision, in the spirit of HdrHistogram.
+// Values below kSubBucketCount nanoseconds are counted exactly. Larger values fall into one of
+// kSubBucketCount / 2 buckets per power of two, so a reported percentile is within 1/64 (~1.6%)
+// of the recorded value. Memory use is constant no matter how many requests are recorded.
+class LatencyHistogram {
+ public:
+  LatencyHistogram();
+
+  void Record(std::chrono::nanoseconds latency);
+
+  uint64_t Count() const { return count_; }
+  std::chrono::nanoseconds Min() const { return std::chrono::nanoseconds(count_ == 0 ? 0 : min_); }
+  std::chrono::nanoseconds Max() const { return std::chrono::nanoseconds(max_); }
+  std::chrono::nanoseconds Mean() const;
+
+  // percentile is in the range [0, 100].
+  std::chrono::nanoseconds Percentile(double percentile) const;
+
+  // Writes min/mean/percentiles/max in milliseconds.
+  void Print(std::ostream& ostream) const;
+
+ private:
+  static constexpr uint64_t kSubBucketBits = 7;
+  static constexpr uint64_t kSubBucketCount = uint64_t{1} << kSubBucketBits;
+  static constexpr uint64_t kSubBucketHalfCount = kSubBucketCount / 2;
+
+  static size_t GetBucketIndex(uint64_t value);
+  static uint64_t GetBucketLowerBound(size_t index);
+  static uint64_t GetBucketUpperBound(size_t index);
+
+  std::vector<uint64_t> counts_;
+  uint64_t count_{0};
+  uint64_t min_{UINT64_MAX};
+  uint64_t max_{0};
+  double sum_{0};
+};
+
+}  // namespace perftest
+}  // namespace onnxruntime
@@ -14,9 +14,13 @@ namespace onnxruntime {
 namespace perftest {
 
 std::chrono::duration<double> OnnxRuntimeTestSession::Run() {
-  //Randomly pick one OrtValueArray from test_inputs_. (NOT ThreadSafe)
+  //Randomly pick one OrtValueArray from test_inputs_.
   const std::uniform_int_distribution<int>::param_type p(0, static_cast<int>(test_inputs_.size() - 1));
-  const size_t id = static_cast<size_t>(dist_(rand_engine_, p));
+  size_t id;
+  {
+    std::lock_guard<OrtMutex> guard(rand_mutex_);
+    id = static_cast<size_t>(dist_(rand_engine_, p));
+  }
   auto& input = test_inputs_.at(id);
   auto start = std::chrono::high_resolution_clock::now();
   auto output_values = session_.Run(Ort::RunOptions{nullptr}, input_names_.data(), input.data(), input_names_.size(),
@@ -360,26 +364,38 @@ OnnxRuntimeTestSession::OnnxRuntimeTestSession(Ort::Env& env, std::random_device
   }
 }
 
-bool OnnxRuntimeTestSession::PopulateGeneratedInputTestData() {
-  // iterate over all input nodes
-  for (size_t i = 0; i < static_cast<size_t>(input_length_); i++) {
-    Ort::TypeInfo type_info = session_.GetInputTypeInfo(i);
-    Ort::MemoryInfo memory_info = Ort::MemoryInfo::CreateCpu(OrtArenaAllocator, OrtMemTypeDefault);
-    if (type_info.GetONNXType() == ONNX_TYPE_TENSOR) {
-      auto tensor_info = type_info.GetTensorTypeAndShapeInfo();
-      std::vector<int64_t> input_node_dim = tensor_info.GetShape();
+bool OnnxRuntimeTestSession::PopulateGeneratedInputTestData(
+    size_t input_set_count, const std::map<std::string, std::pair<int64_t, int64_t>>& free_dim_name_ranges) {
+  for (size_t input_set = 0; input_set < input_set_count; input_set++) {
+    // Pick one value per named free dimension so that inputs sharing a dimension stay consistent.
+    std::map<std::string, int64_t> free_dim_values;
+    for (const auto& range : free_dim_name_ranges) {
+      std::uniform_int_distribution<int64_t> dim_dist(range.second.first, range.second.second);
+      free_dim_values[range.first] = dim_dist(rand_engine_);
+    }
+
+    // iterate over all input nodes
+    for (size_t i = 0; i < static_cast<size_t>(input_length_); i++) {
+      Ort::TypeInfo type_info = session_.GetInputTypeInfo(i);
+      if (type_info.GetONNXType() == ONNX_TYPE_TENSOR) {
+        auto tensor_info = type_info.GetTensorTypeAndShapeInfo();
+        std::vector<int64_t> input_node_dim = tensor_info.GetShape();
+        std::vector<const char*> symbolic_dims(input_node_dim.size());
+        tensor_info.GetSymbolicDimensions(symbolic_dims.data(), symbolic_dims.size());
 
-      // free dimensions are treated as 1 if not overriden
-      for (int64_t& dim : input_node_dim) {
-        if (dim == -1) {
-          dim = 1;
+        // free dimensions are treated as 1 if not overriden or given a range
+        for (size_t d = 0; d < input_node_dim.size(); d++) {
+          if (input_node_dim[d] == -1) {
+            auto value = symbolic_dims[d] != nullptr ? free_dim_values.find(symbolic_dims[d]) : free_dim_values.end();
+            input_node_dim[d] = value != free_dim_values.end() ? value->second : 1;
+          }
         }
+        // default allocator doesn't have to be freed by user
+        auto allocator = static_cast<OrtAllocator*>(Ort::AllocatorWithDefaultOptions());
+        Ort::Value input_tensor = Ort::Value::CreateTensor(allocator, (const int64_t*)input_node_dim.data(),
+                                                           input_node_dim.size(), tensor_info.GetElementType());
+        PreLoadTestData(input_set, i, std::move(input_tensor));
       }
-      // default allocator doesn't have to be freed by user
-      auto allocator = static_cast<OrtAllocator*>(Ort::AllocatorWithDefaultOptions());
-      Ort::Value input_tensor = Ort::Value::CreateTensor(allocator, (const int64_t*)input_node_dim.data(),
-                                                         input_node_dim.size(), tensor_info.GetElementType());
-      PreLoadTestData(0, i, std::move(input_tensor));
     }
   }
   return true;
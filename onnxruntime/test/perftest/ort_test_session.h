@@ -3,7 +3,9 @@
 
 #pragma once
 #include <core/session/onnxruntime_cxx_api.h>
+#include <map>
 #include <random>
+#include <core/platform/ort_mutex.h>
 #include "test_configuration.h"
 #include "test_session.h"
 class TestModelInfo;
@@ -25,7 +27,10 @@ class OnnxRuntimeTestSession : public TestSession {
     test_inputs_[test_data_id][input_id] = std::move(value);
   }
 
-  bool PopulateGeneratedInputTestData();
+  // Generates input_set_count sets of inputs. Free dimensions named in free_dim_name_ranges are drawn
+  // uniformly from their range for each set, other free dimensions are treated as 1.
+  bool PopulateGeneratedInputTestData(size_t input_set_count,
+                                      const std::map<std::string, std::pair<int64_t, int64_t>>& free_dim_name_ranges);
 
   ~OnnxRuntimeTestSession() override {
     for (char* p : input_names_) {
@@ -40,6 +45,7 @@ class OnnxRuntimeTestSession : public TestSession {
   Ort::Session session_{nullptr};
   std::mt19937 rand_engine_;
   std::uniform_int_distribution<int> dist_;
+  OrtMutex rand_mutex_;
   std::vector<std::vector<Ort::Value>> test_inputs_;
   std::vector<std::string> output_names_;
   // The same size with output_names_.
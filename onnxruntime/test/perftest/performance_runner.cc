@@ -7,7 +7,9 @@
 #endif
 
 #include "performance_runner.h"
+#include <deque>
 #include <iostream>
+#include <thread>
 
 #include "TestCase.h"
 #include "TFModelInfo.h"
@@ -90,12 +92,23 @@ void PerformanceResult::DumpToFile(const std::basic_string<ORTCHAR_T>& path, boo
       ostream << "P999 Latency: " << sorted_time[n999] << " s" << std::endl;
     };
 
+    auto output_histogram = [&](std::ostream& ostream) {
+      latency_histogram.Print(ostream);
+      ostream << "Throughput timeline (requests per second):";
+      for (size_t second = 0; second < completions_per_second.size(); second++) {
+        ostream << (second % 10 == 0 ? "\n  " : " ") << completions_per_second[second];
+      }
+      ostream << std::endl;
+    };
+
     if (have_file) {
       outfile << std::endl;
       output_stats(outfile);
+      output_histogram(outfile);
     }
 
     output_stats(std::cout);
+    output_histogram(std::cout);
   }
 }
 
@@ -112,15 +125,19 @@ Status PerformanceRunner::Run() {
   performance_result_.start = std::chrono::high_resolution_clock::now();
 
   std::unique_ptr<utils::ICPUUsage> p_ICPUUsage = utils::CreateICPUUsage();
-  switch (performance_test_config_.run_config.test_mode) {
-    case TestMode::kFixDurationMode:
-      ORT_RETURN_IF_ERROR(FixDurationTest());
-      break;
-    case TestMode::KFixRepeatedTimesMode:
-      ORT_RETURN_IF_ERROR(RepeatedTimesTest());
-      break;
-    default:
-      return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "unknown test mode.");
+  if (performance_test_config_.run_config.target_qps > 0) {
+    ORT_RETURN_IF_ERROR(RunOpenLoop());
+  } else {
+    switch (performance_test_config_.run_config.test_mode) {
+      case TestMode::kFixDurationMode:
+        ORT_RETURN_IF_ERROR(FixDurationTest());
+        break;
+      case TestMode::KFixRepeatedTimesMode:
+        ORT_RETURN_IF_ERROR(RepeatedTimesTest());
+        break;
+      default:
+        return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "unknown test mode.");
+    }
   }
   performance_result_.end = std::chrono::high_resolution_clock::now();
 
@@ -142,9 +159,39 @@ Status PerformanceRunner::Run() {
             << "Peak working set size: " << performance_result_.peak_workingset_size << " bytes"
             << std::endl;
 
+  if (performance_test_config_.run_config.target_qps > 0) {
+    // No request may have completed, e.g. when the duration is shorter than the first arrival.
+    const size_t completed = performance_result_.time_costs.size();
+    const double achieved_qps = inference_duration.count() > 0 ? completed / inference_duration.count() : 0.0;
+    const double average_queue_time = completed > 0 ? performance_result_.total_queue_time / completed : 0.0;
+    std::cout << "Target QPS: " << performance_test_config_.run_config.target_qps << "\n"
+              << "Achieved QPS: " << achieved_qps << "\n"
+              << "Average queueing time: " << average_queue_time * 1000 << " ms"
+              << std::endl;
+  }
+
   return Status::OK();
 }
 
+void PerformanceRunner::RecordResult(std::chrono::duration<double> latency,
+                                     std::chrono::time_point<std::chrono::high_resolution_clock> completion_time) {
+  const size_t second = static_cast<size_t>(
+      std::chrono::duration_cast<std::chrono::seconds>(completion_time - performance_result_.start).count());
+
+  std::lock_guard<OrtMutex> guard(results_mutex_);
+  performance_result_.time_costs.emplace_back(latency.count());
+  performance_result_.total_time_cost += latency.count();
+  performance_result_.latency_histogram.Record(std::chrono::duration_cast<std::chrono::nanoseconds>(latency));
+  if (performance_result_.completions_per_second.size() <= second) {
+    performance_result_.completions_per_second.resize(second + 1);
+  }
+  performance_result_.completions_per_second[second]++;
+  if (performance_test_config_.run_config.f_verbose) {
+    std::cout << "iteration:" << performance_result_.time_costs.size() << ","
+              << "time_cost:" << performance_result_.time_costs.back() << std::endl;
+  }
+}
+
 Status PerformanceRunner::FixDurationTest() {
   if (performance_test_config_.run_config.concurrent_session_runs <= 1) {
     return RunFixDuration();
@@ -230,6 +277,105 @@ Status PerformanceRunner::ForkJoinRepeat() {
   return Status::OK();
 }
 
+Status PerformanceRunner::RunOpenLoop() {
+  // Requests are issued on a schedule that does not depend on when earlier requests complete, so
+  // when the workers fall behind the backlog grows and shows up in the latencies, as it would for a
+  // service receiving independent requests. Closed-loop tests hide this by waiting for a worker.
+  // The backlog is an unbounded queue served by dedicated threads: a bounded thread pool queue would
+  // run the overflow inline on the issuing thread and delay the arrivals after it.
+  const auto& run_config = performance_test_config_.run_config;
+  const bool fixed_duration = run_config.test_mode == TestMode::kFixDurationMode;
+  const std::chrono::duration<double> duration(static_cast<double>(run_config.duration_in_seconds));
+
+  std::exponential_distribution<double> poisson_interval(run_config.target_qps);
+  const std::chrono::duration<double> fixed_interval(1.0 / run_config.target_qps);
+
+  using TimePoint = std::chrono::time_point<std::chrono::high_resolution_clock>;
+  std::deque<TimePoint> arrivals;
+  bool done = false;
+  std::atomic<size_t> failures{0};
+  OrtMutex m;
+  OrtCondVar cv;
+
+  auto serve = [this, &arrivals, &done, &failures, &m, &cv]() {
+    for (;;) {
+      TimePoint arrival;
+      {
+        std::unique_lock<OrtMutex> lock(m);
+        cv.wait(lock, [&arrivals, &done]() { return done || !arrivals.empty(); });
+        if (arrivals.empty()) {
+          return;
+        }
+        arrival = arrivals.front();
+        arrivals.pop_front();
+      }
+
+      auto status = Status::OK();
+      auto service_start = std::chrono::high_resolution_clock::now();
+      ORT_TRY {
+        session_->Run();
+      }
+      ORT_CATCH(const std::exception& ex) {
+        ORT_HANDLE_EXCEPTION([&]() {
+          status = ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "PerformanceRunner::RunOpenLoop caught exception: ", ex.what());
+        });
+      }
+      auto end = std::chrono::high_resolution_clock::now();
+
+      if (status.IsOK()) {
+        RecordResult(end - arrival, end);
+        std::lock_guard<OrtMutex> guard(results_mutex_);
+        performance_result_.total_queue_time += std::chrono::duration<double>(service_start - arrival).count();
+      } else {
+        std::cerr << status.ErrorMessage() << std::endl;
+        failures++;
+      }
+    }
+  };
+
+  std::vector<std::thread> workers;
+  workers.reserve(run_config.concurrent_session_runs);
+  for (size_t i = 0; i < run_config.concurrent_session_runs; i++) {
+    workers.emplace_back(serve);
+  }
+
+  const auto start = std::chrono::high_resolution_clock::now();
+  auto arrival = start;
+  for (size_t request = 0;; request++) {
+    if (fixed_duration ? (arrival - start >= duration) : (request >= run_config.repeated_times)) {
+      break;
+    }
+
+    std::this_thread::sleep_until(arrival);
+    {
+      std::lock_guard<OrtMutex> lg(m);
+      arrivals.push_back(arrival);
+    }
+    cv.notify_one();
+
+    const std::chrono::duration<double> interval =
+        run_config.arrival_distribution == ArrivalDistribution::kPoisson
+            ? std::chrono::duration<double>(poisson_interval(rand_engine_))
+            : fixed_interval;
+    arrival += std::chrono::duration_cast<std::chrono::high_resolution_clock::duration>(interval);
+  }
+
+  //Join, once the workers have drained the backlog
+  {
+    std::lock_guard<OrtMutex> lg(m);
+    done = true;
+  }
+  cv.notify_all();
+  for (auto& worker : workers) {
+    worker.join();
+  }
+
+  if (failures > 0) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, failures.load(), " requests failed in open-loop mode.");
+  }
+  return Status::OK();
+}
+
 static std::unique_ptr<TestModelInfo> CreateModelInfo(const PerformanceTestConfig& performance_test_config_) {
   if (CompareCString(performance_test_config_.backend.c_str(), ORT_TSTR("ort")) == 0) {
     const auto& file_path = performance_test_config_.model_info.model_file_path;
@@ -272,7 +418,8 @@ static std::unique_ptr<TestSession> CreateSession(Ort::Env& env, std::random_dev
 
 PerformanceRunner::PerformanceRunner(Ort::Env& env, const PerformanceTestConfig& test_config, std::random_device& rd)
     : performance_test_config_(test_config),
-      test_model_info_(CreateModelInfo(test_config)) {
+      test_model_info_(CreateModelInfo(test_config)),
+      rand_engine_(rd()) {
   session_create_start_ = std::chrono::high_resolution_clock::now();
   session_ = CreateSession(env, rd, test_config, *test_model_info_);
   session_create_end_ = std::chrono::high_resolution_clock::now();
@@ -300,7 +447,9 @@ bool PerformanceRunner::Initialize() {
   test_case_ = CreateOnnxTestCase(narrow_model_name, std::move(test_model_info_), 0.0, 0.0);
 
   if (performance_test_config_.run_config.generate_model_input_binding) {
-    return static_cast<OnnxRuntimeTestSession*>(session_.get())->PopulateGeneratedInputTestData();
+    return static_cast<OnnxRuntimeTestSession*>(session_.get())
+        ->PopulateGeneratedInputTestData(performance_test_config_.run_config.generated_input_count,
+                                         performance_test_config_.run_config.free_dim_name_ranges);
   }
 
   // TODO: Place input tensor on cpu memory if dnnl provider type to avoid CopyTensor logic in CopyInputAcrossDevices
@@ -18,6 +18,7 @@
 #include <core/session/onnxruntime_cxx_api.h>
 #include "test_configuration.h"
 #include "heap_buffer.h"
+#include "latency_histogram.h"
 #include "test_session.h"
 #include "OrtValueList.h"
 
@@ -35,6 +36,12 @@ struct PerformanceResult {
   double total_time_cost{0};
   std::vector<double> time_costs;
   std::string model_name;
+  // Latency of every measured request. In open-loop mode this includes the time spent queued.
+  LatencyHistogram latency_histogram;
+  // Number of requests completed in each second since start.
+  std::vector<size_t> completions_per_second;
+  // Open-loop mode only: total time requests spent queued before a worker picked them up.
+  double total_queue_time{0};
 
   void DumpToFile(const std::basic_string<ORTCHAR_T>& path, bool f_include_statistics = false) const;
 };
@@ -73,21 +80,19 @@ class PerformanceRunner {
     ORT_RETURN_IF_ERROR(status);
 
     if (!isWarmup) {
-      std::lock_guard<OrtMutex> guard(results_mutex_);
-      performance_result_.time_costs.emplace_back(duration_seconds.count());
-      performance_result_.total_time_cost += duration_seconds.count();
-      if (performance_test_config_.run_config.f_verbose) {
-        std::cout << "iteration:" << performance_result_.time_costs.size() << ","
-                  << "time_cost:" << performance_result_.time_costs.back() << std::endl;
-      }
+      RecordResult(duration_seconds, std::chrono::high_resolution_clock::now());
     }
     return Status::OK();
   }
 
+  void RecordResult(std::chrono::duration<double> latency,
+                    std::chrono::time_point<std::chrono::high_resolution_clock> completion_time);
+
   Status FixDurationTest();
   Status RepeatedTimesTest();
   Status ForkJoinRepeat();
   Status RunParallelDuration();
+  Status RunOpenLoop();
 
   inline Status RunFixDuration() {
     while (performance_result_.total_time_cost < performance_test_config_.run_config.duration_in_seconds) {
@@ -112,6 +117,7 @@ class PerformanceRunner {
   std::unique_ptr<TestSession> session_;
   onnxruntime::test::HeapBuffer b_;
   std::unique_ptr<ITestCase> test_case_;
+  std::mt19937 rand_engine_;
 
   OrtMutex results_mutex_;
 };
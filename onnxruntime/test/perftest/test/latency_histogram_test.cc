@@ -0,0 +1,91 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "test/perftest/latency_histogram.h"
+
+#include <sstream>
+
+#include "gtest/gtest.h"
+
+namespace onnxruntime {
+namespace perftest {
+namespace test {
+
+using std::chrono::nanoseconds;
+
+TEST(LatencyHistogramTest, Empty) {
+  LatencyHistogram histogram;
+  EXPECT_EQ(histogram.Count(), 0u);
+  EXPECT_EQ(histogram.Min().count(), 0);
+  EXPECT_EQ(histogram.Max().count(), 0);
+  EXPECT_EQ(histogram.Mean().count(), 0);
+  EXPECT_EQ(histogram.Percentile(50).count(), 0);
+}
+
+TEST(LatencyHistogramTest, SmallValuesAreExact) {
+  LatencyHistogram histogram;
+  for (int64_t i = 1; i <= 100; i++) {
+    histogram.Record(nanoseconds(i));
+  }
+
+  EXPECT_EQ(histogram.Count(), 100u);
+  EXPECT_EQ(histogram.Min().count(), 1);
+  EXPECT_EQ(histogram.Max().count(), 100);
+  EXPECT_EQ(histogram.Mean().count(), 50);
+  EXPECT_EQ(histogram.Percentile(0).count(), 1);
+  EXPECT_EQ(histogram.Percentile(50).count(), 50);
+  EXPECT_EQ(histogram.Percentile(99).count(), 99);
+  EXPECT_EQ(histogram.Percentile(100).count(), 100);
+}
+
+TEST(LatencyHistogramTest, BucketReportsUpperBoundWithinRecordedRange) {
+  LatencyHistogram histogram;
+  // 128 and 129 share the first bucket that is two nanoseconds wide.
+  histogram.Record(nanoseconds(128));
+  histogram.Record(nanoseconds(129));
+  histogram.Record(nanoseconds(1000000));
+
+  EXPECT_EQ(histogram.Percentile(10).count(), 129);
+  EXPECT_EQ(histogram.Percentile(60).count(), 129);
+  // The upper bound of the last bucket is clamped to the maximum.
+  EXPECT_EQ(histogram.Percentile(100).count(), 1000000);
+}
+
+TEST(LatencyHistogramTest, LargeValuesWithinRelativePrecision) {
+  LatencyHistogram histogram;
+  for (int64_t i = 1; i <= 1000; i++) {
+    histogram.Record(nanoseconds(i * 12345));
+  }
+
+  for (double percentile : {1.0, 25.0, 50.0, 90.0, 99.0, 99.9}) {
+    const int64_t expected = static_cast<int64_t>(percentile * 10 + 0.5) * 12345;
+    const int64_t actual = histogram.Percentile(percentile).count();
+    EXPECT_GE(actual, expected) << "P" << percentile;
+    EXPECT_LE(actual - expected, expected / 64) << "P" << percentile;
+  }
+  EXPECT_EQ(histogram.Max().count(), 1000 * 12345);
+}
+
+TEST(LatencyHistogramTest, NegativeLatencyCountsAsZero) {
+  LatencyHistogram histogram;
+  histogram.Record(nanoseconds(-5));
+  EXPECT_EQ(histogram.Count(), 1u);
+  EXPECT_EQ(histogram.Min().count(), 0);
+  EXPECT_EQ(histogram.Max().count(), 0);
+}
+
+TEST(LatencyHistogramTest, Print) {
+  LatencyHistogram histogram;
+  histogram.Record(nanoseconds(2000000));
+
+  std::ostringstream output;
+  histogram.Print(output);
+  const std::string text = output.str();
+  EXPECT_NE(text.find("1 requests"), std::string::npos);
+  EXPECT_NE(text.find("P99:"), std::string::npos);
+  EXPECT_NE(text.find("2.000"), std::string::npos);
+}
+
+}  // namespace test
+}  // namespace perftest
+}  // namespace onnxruntime
@@ -6,6 +6,7 @@
 #include <map>
 #include <cstdint>
 #include <string>
+#include <utility>
 
 #include "core/graph/constants.h"
 #include "core/framework/session_options.h"
@@ -18,6 +19,12 @@ enum class TestMode : std::uint8_t {
   KFixRepeatedTimesMode
 };
 
+// Inter-arrival time distribution of requests in open-loop mode.
+enum class ArrivalDistribution : std::uint8_t {
+  kPoisson = 0,
+  kFixed
+};
+
 enum class Platform : std::uint8_t {
   kWindows = 0,
   kLinux
@@ -57,6 +64,12 @@ struct RunConfig {
   std::basic_string<ORTCHAR_T> ep_runtime_config_string;
   std::map<std::basic_string<ORTCHAR_T>, int64_t> free_dim_name_overrides;
   std::map<std::basic_string<ORTCHAR_T>, int64_t> free_dim_denotation_overrides;
+  // Open-loop mode: requests are issued at this rate regardless of completions. 0 means closed-loop.
+  double target_qps{0};
+  ArrivalDistribution arrival_distribution{ArrivalDistribution::kPoisson};
+  // Free dimensions of generated inputs (-I) drawn uniformly from [min, max] for each generated input set.
+  std::map<std::string, std::pair<int64_t, int64_t>> free_dim_name_ranges;
+  size_t generated_input_count{1};
 };
 
 struct PerformanceTestConfig {
@@ -9,6 +9,7 @@
 
 #include "gtest/gtest.h"
 #include <algorithm>
+#include <chrono>
 #include <memory>
 #include <functional>
 
@@ -188,6 +189,69 @@ void TestMultiLoopSections(const std::string& name, int num_threads, int num_loo
   }
 }
 
+void TestCancelledRequest(const std::string& name, int num_threads, bool use_deadline) {
+  // Once a request is cancelled helper threads stop claiming iterations of its loops, but the
+  // calling thread still runs the rest, so every iteration runs exactly once.
+  const int num_tasks = 10000;
+  auto test_data = CreateTestData(num_tasks);
+  CreateThreadPoolAndTest(name, num_threads, [&](ThreadPool* tp) {
+    std::atomic<bool> terminate{!use_deadline};
+    ThreadPool::RequestContext request;
+    request.terminate = &terminate;
+    if (use_deadline) {
+      request.deadline = std::chrono::steady_clock::now() - std::chrono::milliseconds(1);
+    }
+    ThreadPool::RequestScope request_scope(&request);
+    ASSERT_EQ(ThreadPool::CurrentRequest(), &request);
+    ASSERT_TRUE(ThreadPool::CurrentRequest()->IsCancelled());
+    ThreadPool::TrySimpleParallelFor(tp, num_tasks, [&](std::ptrdiff_t i) { IncrementElement(*test_data, i); });
+  });
+  ValidateTestData(*test_data);
+  ASSERT_EQ(ThreadPool::CurrentRequest(), nullptr);
+}
+
+void TestConcurrentRequests(const std::string& name, int num_threads, int num_tasks) {
+  // Run loops of requests with each priority, with and without deadlines, concurrently.  Helper
+  // threads give way to the more urgent requests, and each loop must still run every iteration
+  // exactly once.
+  const int num_requests = 6;
+  for (int rep = 0; rep < 5; rep++) {
+    CreateThreadPoolAndTest(name, num_threads, [&](ThreadPool* tp) {
+      std::vector<std::unique_ptr<TestData>> td;
+      std::vector<ThreadPool::RequestContext> requests(num_requests);
+      onnxruntime::Barrier b(num_requests - 1);
+
+      for (int r = 0; r < num_requests; r++) {
+        td.push_back(CreateTestData(num_tasks));
+        requests[r].priority = static_cast<ThreadPool::RequestPriority>(r % 3);
+        if (r >= 3) {
+          requests[r].deadline = std::chrono::steady_clock::now() + std::chrono::hours(1);
+        }
+      }
+
+      auto run_request = [&](int r) {
+        ThreadPool::RequestScope request_scope(&requests[r]);
+        ThreadPool::TrySimpleParallelFor(tp, num_tasks, [&](std::ptrdiff_t i) {
+          IncrementElement(*td[r], i);
+        });
+      };
+
+      for (int r = 0; r < num_requests - 1; r++) {
+        ThreadPool::Schedule(tp, [&, r]() {
+          run_request(r);
+          b.Notify();
+        });
+      }
+      run_request(num_requests - 1);
+
+      b.Wait();
+      for (int r = 0; r < num_requests; r++) {
+        ValidateTestData(*td[r]);
+      }
+    });
+  }
+}
+
 }  // namespace
 
 namespace onnxruntime {
@@ -381,6 +445,26 @@ TEST(ThreadPoolTest, TestMultiLoopSections_4Thread_100Loop) {
   TestMultiLoopSections("TestMultiLoopSections_4Thread_100Loop", 4, 100);
 }
 
+TEST(ThreadPoolTest, TestCancelledRequest_1Thread_Terminate) {
+  TestCancelledRequest("TestCancelledRequest_1Thread_Terminate", 1, false);
+}
+
+TEST(ThreadPoolTest, TestCancelledRequest_4Thread_Terminate) {
+  TestCancelledRequest("TestCancelledRequest_4Thread_Terminate", 4, false);
+}
+
+TEST(ThreadPoolTest, TestCancelledRequest_4Thread_Deadline) {
+  TestCancelledRequest("TestCancelledRequest_4Thread_Deadline", 4, true);
+}
+
+TEST(ThreadPoolTest, TestConcurrentRequests_2Thread_1KTasks) {
+  TestConcurrentRequests("TestConcurrentRequests_2Thread_1KTasks", 2, 1024);
+}
+
+TEST(ThreadPoolTest, TestConcurrentRequests_4Thread_100KTasks) {
+  TestConcurrentRequests("TestConcurrentRequests_4Thread_100KTasks", 4, 100000);
+}
+
 #ifdef _WIN32
 TEST(ThreadPoolTest, TestStackSize) {
   ThreadOptions to;
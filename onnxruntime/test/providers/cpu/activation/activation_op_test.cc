@@ -177,6 +177,13 @@ TEST_F(ActivationOpTest, Softplus) {
                           });
 }
 
+TEST_F(ActivationOpTest, HardSwish) {
+  TestActivationOp<float>("HardSwish",
+                          input_values,
+                          [](float x) { return x * std::max(std::min(x / 6.0f + 0.5f, 1.0f), 0.0f); },
+                          {}, false, 14);
+}
+
 TEST_F(ActivationOpNoInfTest, Softsign) {
   TestActivationOp<float>(
       "Softsign",
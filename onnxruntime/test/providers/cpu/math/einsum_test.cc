@@ -539,6 +539,54 @@ TEST(Einsum, ImplicitEinsumAsTensorContraction) {
   test.Run();
 }
 
+// Theme: Contraction order with more than 2 inputs
+
+// The middle pair is the cheapest to contract first
+TEST(Einsum, ExplicitEinsumAsMatmulChain) {
+  constexpr int64_t I = 2, J = 17, K = 19, L = 3;
+  std::vector<float> x(I * J), y(J * K), z(K * L), o(I * L, 0.f);
+  for (size_t i = 0; i < x.size(); ++i) x[i] = static_cast<float>(i % 5) - 2.f;
+  for (size_t i = 0; i < y.size(); ++i) y[i] = static_cast<float>(i % 7) - 3.f;
+  for (size_t i = 0; i < z.size(); ++i) z[i] = static_cast<float>(i % 3) - 1.f;
+  for (int64_t i = 0; i < I; ++i)
+    for (int64_t j = 0; j < J; ++j)
+      for (int64_t k = 0; k < K; ++k)
+        for (int64_t l = 0; l < L; ++l)
+          o[i * L + l] += x[i * J + j] * y[j * K + k] * z[k * L + l];
+
+  OpTester test("Einsum", 12, onnxruntime::kOnnxDomain);
+  test.AddAttribute<std::string>("equation", "ij,jk,kl->il");
+  test.AddInput<float>("x", {I, J}, x);
+  test.AddInput<float>("y", {J, K}, y);
+  test.AddInput<float>("z", {K, L}, z);
+  test.AddOutput<float>("o", {I, L}, o);
+  test.Run();
+}
+
+// Includes a dim that only one input has (c) and a dim that is broadcast (d)
+TEST(Einsum, ExplicitEinsumAsTensorNetwork_Multi_Input) {
+  constexpr int64_t A = 3, B = 4, C = 2, D = 5;
+  std::vector<int64_t> x(A * B), y(B * C * D), z(1 * A), w(D * B), o(D * A, 0);
+  for (size_t i = 0; i < x.size(); ++i) x[i] = static_cast<int64_t>(i % 4) - 1;
+  for (size_t i = 0; i < y.size(); ++i) y[i] = static_cast<int64_t>(i % 5) - 2;
+  for (size_t i = 0; i < z.size(); ++i) z[i] = static_cast<int64_t>(i) + 1;
+  for (size_t i = 0; i < w.size(); ++i) w[i] = static_cast<int64_t>(i % 3) - 1;
+  for (int64_t a = 0; a < A; ++a)
+    for (int64_t b = 0; b < B; ++b)
+      for (int64_t c = 0; c < C; ++c)
+        for (int64_t d = 0; d < D; ++d)
+          o[d * A + a] += x[a * B + b] * y[(b * C + c) * D + d] * z[a] * w[d * B + b];
+
+  OpTester test("Einsum", 12, onnxruntime::kOnnxDomain);
+  test.AddAttribute<std::string>("equation", "ab,bcd,da,db->da");
+  test.AddInput<int64_t>("x", {A, B}, x);
+  test.AddInput<int64_t>("y", {B, C, D}, y);
+  test.AddInput<int64_t>("z", {1, A}, z);
+  test.AddInput<int64_t>("w", {D, B}, w);
+  test.AddOutput<int64_t>("o", {D, A}, o);
+  test.Run();
+}
+
 // Test each theme for half support
 TEST(Einsum, ExplicitEinsumAsIdentity_1D_input_Half) {
   if (!HasCudaEnvironment(600)) {
@@ -2,8 +2,10 @@
 // Licensed under the MIT License.
 
 #include "gtest/gtest.h"
+#include "core/session/onnxruntime_session_options_config_keys.h"
 #include "test/providers/provider_test_utils.h"
 #include "test/common/cuda_op_test_utils.h"
+#include "test/util/include/default_providers.h"
 
 namespace onnxruntime {
 namespace test {
@@ -42,6 +44,35 @@ TEST(GemmOpTest, GemmNoTransBIsInitializer) {
   TestGemmNoTrans<double>(true);
 }
 
+// B is stored as float16, so 2049 is rounded to 2048 and 4097 to 4096.
+TEST(GemmOpTest, GemmTransBFp16Initializers) {
+  SessionOptions so;
+  ASSERT_TRUE(so.AddConfigEntry(kOrtSessionOptionsConfigUseFp16Initializers, "1").IsOK());
+
+  std::vector<std::unique_ptr<IExecutionProvider>> execution_providers;
+  execution_providers.push_back(DefaultCpuExecutionProvider());
+
+  OpTester test("Gemm");
+
+  test.AddAttribute("transA", (int64_t)0);
+  test.AddAttribute("transB", (int64_t)1);
+  test.AddAttribute("alpha", 1.0f);
+  test.AddAttribute("beta", 1.0f);
+
+  test.AddInput<float>("A", {2, 3},
+                       {1.0f, 2.0f, 3.0f,
+                        4.0f, 5.0f, 6.0f});
+  test.AddInput<float>("B", {2, 3},
+                       {2049.0f, 0.5f, -3.0f,
+                        1.0f, 4097.0f, 2.0f},
+                       true);
+  test.AddInput<float>("C", {2}, {1.0f, -1.0f});
+  test.AddOutput<float>("Y", {2, 2},
+                        {2041.0f, 8198.0f,
+                         8177.5f, 20495.0f});
+  test.Run(so, OpTester::ExpectResult::kExpectSuccess, "", {}, nullptr, &execution_providers);
+}
+
 // Only CUDA kernel has float 16 support
 #if defined(USE_CUDA) || defined(USE_ROCM)
 TEST(GemmOpTest, GemmNoTrans_f16) {
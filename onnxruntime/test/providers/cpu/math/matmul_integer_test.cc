@@ -273,17 +273,22 @@ T GetMiddle(const std::vector<T>& v) {
 }
 
 // [M x N] = [M x K] x [K x N] = [batch_seq x input_dim] x [input_dim x embed_dim]
-template <typename ScalarB>
-void RunMatMulIntegerU8X8Test(const int M, const int N, const int K, bool non_zero_zp, bool B_is_initializer) {
+template <typename ScalarA, typename ScalarB>
+void RunMatMulIntegerX8X8Test(const int M, const int N, const int K, bool non_zero_zp, bool B_is_initializer) {
   OpTester test("MatMulInteger", 10);
   static std::default_random_engine e(123);
-  static std::uniform_int_distribution<int> n_unsigned(0, 127);
-  static std::uniform_int_distribution<int> n_xint8(std::numeric_limits<ScalarB>::min(), std::numeric_limits<ScalarB>::max());
+  // Signed A is converted to unsigned by the CPU kernel, so narrow the ranges
+  // to keep the byte products within the saturating int16 math of AVX2 U8S8.
+  constexpr int range_shift = std::is_signed<ScalarA>::value ? 1 : 0;
+  static std::uniform_int_distribution<int> n_xint8_a(std::is_signed<ScalarA>::value ? -64 : 0,
+                                                      std::is_signed<ScalarA>::value ? 63 : 127);
+  static std::uniform_int_distribution<int> n_xint8(std::numeric_limits<ScalarB>::min() >> range_shift,
+                                                    std::numeric_limits<ScalarB>::max() >> range_shift);
 
   Eigen::MatrixXi matrix_a = Eigen::MatrixXi::Random(K, M)
-                                 .unaryExpr([](int) { return n_unsigned(e); });
-  std::vector<uint8_t> matrix_a_data = ToVector<uint8_t>(matrix_a.data(), M * K);
-  uint8_t a_zero_point = non_zero_zp ? GetMiddle(matrix_a_data) : 0;
+                                 .unaryExpr([](int) { return n_xint8_a(e); });
+  std::vector<ScalarA> matrix_a_data = ToVector<ScalarA>(matrix_a.data(), M * K);
+  ScalarA a_zero_point = non_zero_zp ? GetMiddle(matrix_a_data) : 0;
   Eigen::MatrixXi matrix_a_offset = matrix_a - a_zero_point * Eigen::MatrixXi::Ones(K, M);
 
   Eigen::MatrixXi matrix_b = Eigen::MatrixXi::Random(N, K)
@@ -294,10 +299,10 @@ void RunMatMulIntegerU8X8Test(const int M, const int N, const int K, bool non_ze
 
   Eigen::MatrixXi matrix_c = (matrix_b_offset * matrix_a_offset).eval();
 
-  test.AddInput<uint8_t>("T1", {M, K}, std::move(matrix_a_data));
+  test.AddInput<ScalarA>("T1", {M, K}, std::move(matrix_a_data));
   test.AddInput<ScalarB>("T2", {K, N}, std::move(matrix_b_data), B_is_initializer);
   if (non_zero_zp) {
-    test.AddInput<uint8_t>("a_zero_point", {}, {a_zero_point});
+    test.AddInput<ScalarA>("a_zero_point", {}, {a_zero_point});
     test.AddInput<ScalarB>("b_zero_point", {}, {b_zero_point});
   }
 
@@ -311,15 +316,18 @@ void RunMatMulIntegerU8X8Test(const int M, const int N, const int K, bool non_ze
   }
 }
 
-#define RUN_MATMUL_INTEGER_U8X8(M, N, K)                                                         \
-  RunMatMulIntegerU8X8Test<int8_t>(M, N, K, false /*non_zero_zp*/, false /*B_is_initializer*/);  \
-  RunMatMulIntegerU8X8Test<int8_t>(M, N, K, false /*non_zero_zp*/, true /*B_is_initializer*/);   \
-  RunMatMulIntegerU8X8Test<int8_t>(M, N, K, true /*non_zero_zp*/, false /*B_is_initializer*/);   \
-  RunMatMulIntegerU8X8Test<int8_t>(M, N, K, true /*non_zero_zp*/, true /*B_is_initializer*/);    \
-  RunMatMulIntegerU8X8Test<uint8_t>(M, N, K, false /*non_zero_zp*/, false /*B_is_initializer*/); \
-  RunMatMulIntegerU8X8Test<uint8_t>(M, N, K, false /*non_zero_zp*/, true /*B_is_initializer*/);  \
-  RunMatMulIntegerU8X8Test<uint8_t>(M, N, K, true /*non_zero_zp*/, false /*B_is_initializer*/);  \
-  RunMatMulIntegerU8X8Test<uint8_t>(M, N, K, true /*non_zero_zp*/, true /*B_is_initializer*/);
+#define RUN_MATMUL_INTEGER_X8X8(ScalarA, M, N, K)                                                          \
+  RunMatMulIntegerX8X8Test<ScalarA, int8_t>(M, N, K, false /*non_zero_zp*/, false /*B_is_initializer*/);  \
+  RunMatMulIntegerX8X8Test<ScalarA, int8_t>(M, N, K, false /*non_zero_zp*/, true /*B_is_initializer*/);   \
+  RunMatMulIntegerX8X8Test<ScalarA, int8_t>(M, N, K, true /*non_zero_zp*/, false /*B_is_initializer*/);   \
+  RunMatMulIntegerX8X8Test<ScalarA, int8_t>(M, N, K, true /*non_zero_zp*/, true /*B_is_initializer*/);    \
+  RunMatMulIntegerX8X8Test<ScalarA, uint8_t>(M, N, K, false /*non_zero_zp*/, false /*B_is_initializer*/); \
+  RunMatMulIntegerX8X8Test<ScalarA, uint8_t>(M, N, K, false /*non_zero_zp*/, true /*B_is_initializer*/);  \
+  RunMatMulIntegerX8X8Test<ScalarA, uint8_t>(M, N, K, true /*non_zero_zp*/, false /*B_is_initializer*/);  \
+  RunMatMulIntegerX8X8Test<ScalarA, uint8_t>(M, N, K, true /*non_zero_zp*/, true /*B_is_initializer*/);
+
+#define RUN_MATMUL_INTEGER_U8X8(M, N, K) RUN_MATMUL_INTEGER_X8X8(uint8_t, M, N, K)
+#define RUN_MATMUL_INTEGER_S8X8(M, N, K) RUN_MATMUL_INTEGER_X8X8(int8_t, M, N, K)
 
 TEST(MatmulIntegerOpTest, MatMulInteger_Uint8_Int8_Scalar) {
   RUN_MATMUL_INTEGER_U8X8(1, 1, 32);
@@ -343,5 +351,17 @@ TEST(MatmulIntegerOpTest, MatMulInteger_Uint8_Int8_GEMM) {
   RUN_MATMUL_INTEGER_U8X8(4, 8, 68);
 }
 
+TEST(MatmulIntegerOpTest, MatMulInteger_Int8_X8_GEMV) {
+  RUN_MATMUL_INTEGER_S8X8(1, 2, 16);
+  RUN_MATMUL_INTEGER_S8X8(1, 8, 36);
+  RUN_MATMUL_INTEGER_S8X8(1, 512, 1024);
+}
+
+TEST(MatmulIntegerOpTest, MatMulInteger_Int8_X8_GEMM) {
+  RUN_MATMUL_INTEGER_S8X8(2, 2, 40);
+  RUN_MATMUL_INTEGER_S8X8(2, 48, 33);
+  RUN_MATMUL_INTEGER_S8X8(4, 8, 68);
+}
+
 }  // namespace test
 }  // namespace onnxruntime
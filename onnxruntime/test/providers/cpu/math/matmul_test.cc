@@ -2,7 +2,9 @@
 // Licensed under the MIT License.
 
 #include "gtest/gtest.h"
+#include "core/session/onnxruntime_session_options_config_keys.h"
 #include "test/providers/provider_test_utils.h"
+#include "test/util/include/default_providers.h"
 
 namespace onnxruntime {
 namespace test {
@@ -99,11 +101,11 @@ void RunMatMulTest(int32_t opset_version, bool is_b_constant = false) {
   for (auto t : GenerateTestCases<T>()) {
     OpTester test("MatMul", opset_version);
 
-    int64_t size0 = TensorShape::ReinterpretBaseType(t.input0_dims).SizeHelper(0, t.input0_dims.size());
+    int64_t size0 = TensorShape(t.input0_dims).SizeHelper(0, t.input0_dims.size());
     std::vector<T> input0_vals(common_input_vals.cbegin(), common_input_vals.cbegin() + size0);
     test.AddInput<T>("A", t.input0_dims, input0_vals);
 
-    int64_t size1 = TensorShape::ReinterpretBaseType(t.input1_dims).SizeHelper(0, t.input1_dims.size());
+    int64_t size1 = TensorShape(t.input1_dims).SizeHelper(0, t.input1_dims.size());
     std::vector<T> input1_vals(common_input_vals.cbegin(), common_input_vals.cbegin() + size1);
     test.AddInput<T>("B", t.input1_dims, input1_vals, is_b_constant);
 
@@ -125,6 +127,110 @@ TEST(MathOpTest, MatMulFloatType) {
   RunMatMulTest<float>(7, true);
 }
 
+// Constant inputs with few nonzero elements are multiplied in compressed form
+// by the CPU kernel.
+void RunMatMulSparseConstantTest(const std::vector<int64_t>& a_dims, const std::vector<int64_t>& b_dims,
+                                 bool is_a_sparse) {
+  auto fill = [](const std::vector<int64_t>& dims, bool sparse) {
+    std::vector<float> vals(static_cast<size_t>(TensorShape(dims).Size()), 0.0f);
+    for (size_t i = 0; i < vals.size(); i++) {
+      if (!sparse || i % 97 == 5) {
+        vals[i] = static_cast<float>(i % 7) - 3.0f;
+      }
+    }
+    return vals;
+  };
+
+  std::vector<float> a_vals = fill(a_dims, is_a_sparse);
+  std::vector<float> b_vals = fill(b_dims, !is_a_sparse);
+
+  // A is [batch, M, K] or [M, K] and B is [batch, K, N] or [K, N].
+  const int64_t M = a_dims[a_dims.size() - 2];
+  const int64_t K = a_dims.back();
+  const int64_t N = b_dims.back();
+  const int64_t batch = std::max(TensorShape(a_dims).Size() / (M * K), TensorShape(b_dims).Size() / (K * N));
+  const int64_t a_stride = a_dims.size() == 2 ? 0 : M * K;
+  const int64_t b_stride = b_dims.size() == 2 ? 0 : K * N;
+
+  std::vector<float> y_vals(static_cast<size_t>(batch * M * N), 0.0f);
+  for (int64_t i = 0; i < batch; i++) {
+    for (int64_t m = 0; m < M; m++) {
+      for (int64_t n = 0; n < N; n++) {
+        float sum = 0.0f;
+        for (int64_t k = 0; k < K; k++) {
+          sum += a_vals[i * a_stride + m * K + k] * b_vals[i * b_stride + k * N + n];
+        }
+        y_vals[i * M * N + m * N + n] = sum;
+      }
+    }
+  }
+
+  std::vector<int64_t> y_dims{M, N};
+  if (batch > 1) {
+    y_dims.insert(y_dims.begin(), batch);
+  }
+
+  OpTester test("MatMul", 13);
+  test.AddInput<float>("A", a_dims, a_vals, is_a_sparse);
+  test.AddInput<float>("B", b_dims, b_vals, !is_a_sparse);
+  test.AddOutput<float>("Y", y_dims, y_vals);
+  test.Run(OpTester::ExpectResult::kExpectSuccess, "",
+           {kTensorrtExecutionProvider, kOpenVINOExecutionProvider, kNnapiExecutionProvider});
+}
+
+TEST(MathOpTest, MatMulFloatSparseConstant) {
+  RunMatMulSparseConstantTest({3, 256}, {256, 40}, false);
+  RunMatMulSparseConstantTest({2, 5, 256}, {256, 40}, false);
+  RunMatMulSparseConstantTest({40, 256}, {256, 3}, true);
+  RunMatMulSparseConstantTest({40, 256}, {2, 256, 3}, true);
+}
+
+// B is stored as float16, so every 2049 in it is rounded to 2048 while the
+// other values are exact.
+static void RunMatMulFp16InitializersTest(int64_t M, int64_t K, int64_t N) {
+  std::vector<float> a_vals(M * K);
+  for (int64_t i = 0; i < M * K; i++) {
+    a_vals[i] = static_cast<float>(i % 4) - 1.5f;
+  }
+
+  std::vector<float> b_vals(K * N);
+  std::vector<float> b_rounded(K * N);
+  for (int64_t i = 0; i < K * N; i++) {
+    b_rounded[i] = i % 7 == 0 ? 2048.0f : static_cast<float>(i % 11) * 0.25f;
+    b_vals[i] = i % 7 == 0 ? 2049.0f : b_rounded[i];
+  }
+
+  std::vector<float> y_vals(M * N, 0.0f);
+  for (int64_t m = 0; m < M; m++) {
+    for (int64_t n = 0; n < N; n++) {
+      for (int64_t k = 0; k < K; k++) {
+        y_vals[m * N + n] += a_vals[m * K + k] * b_rounded[k * N + n];
+      }
+    }
+  }
+
+  SessionOptions so;
+  ASSERT_TRUE(so.AddConfigEntry(kOrtSessionOptionsConfigUseFp16Initializers, "1").IsOK());
+
+  std::vector<std::unique_ptr<IExecutionProvider>> execution_providers;
+  execution_providers.push_back(DefaultCpuExecutionProvider());
+
+  OpTester test("MatMul", 13);
+  test.AddInput<float>("A", {M, K}, a_vals);
+  test.AddInput<float>("B", {K, N}, b_vals, true);
+  test.AddOutput<float>("Y", {M, N}, y_vals);
+  test.Run(so, OpTester::ExpectResult::kExpectSuccess, "", {}, nullptr, &execution_providers);
+}
+
+TEST(MathOpTest, MatMulFloatFp16Initializers) {
+  RunMatMulFp16InitializersTest(3, 5, 40);
+}
+
+// A single panel of columns, so the rows are split between the tasks.
+TEST(MathOpTest, MatMulFloatFp16InitializersManyRows) {
+  RunMatMulFp16InitializersTest(150, 5, 16);
+}
+
 TEST(MathOpTest, MatMulDoubleType) {
   RunMatMulTest<double>(7);
 }
@@ -85,6 +85,45 @@ TEST(QuantizeLinearMatmulOpTest, QLinearMatMul3D_U8S8) {
   test.Run();
 }
 
+// Same as QLinearMatMul3D_U8S8 with the activation and output shifted to int8.
+TEST(QuantizeLinearMatmulOpTest, QLinearMatMul3D_S8S8) {
+  OpTester test("QLinearMatMul", 10);
+  test.AddInput<int8_t>("T1", {2, 2, 4},
+                        {80, -2, -128, 110,
+                         -125, 86, 127, -99,
+
+                         80, 108, -128, 110,
+                         -125, 86, 127, -99});
+
+  test.AddInput<float>("a_scale", {}, {0.0066f});
+  test.AddInput<int8_t>("a_zero_point", {}, {-15});
+
+  test.AddInput<int8_t>("T2", {2, 4, 3},
+                        {-43, 51, -34,
+                         60, 26, -17,
+                         0, 63, -55,
+                         47, -29, -31,
+
+                         -62, 51, -42,
+                         60, 26, -22,
+                         0, -8, -19,
+                         37, -2, -47});
+
+  test.AddInput<float>("b_scale", {}, {0.00802f});
+  test.AddInput<int8_t>("b_zero_point", {}, {-2});
+
+  test.AddInput<float>("y_scale", {}, {0.0123f});
+  test.AddInput<int8_t>("y_zero_point", {}, {-10});
+  test.AddOutput<int8_t>("T3", {2, 2, 3},
+                         {2, -33, -14,
+                          20, 27, -23,
+
+                          18, 29, -53,
+                          32, -27, 6});
+
+  test.Run();
+}
+
 TEST(QuantizeLinearMatmulOpTest, QLinearMatMul2D_U8U8) {
   auto run_test = [](bool only_t1_not_initializer) {
     OpTester test("QLinearMatMul", 10);
@@ -713,5 +713,39 @@ TEST(ConvTest, Conv_AutoPad_with_non_default_strides) {
   TestConvOp(attrs, {X, W}, {X_shape, W_shape}, expected_vals, Y_shape, true);
 }
 
+// 3x3 convolution with enough channels for the Winograd algorithm. The weight is
+// an initializer, so the CPU kernel transforms it in PrePack and releases it.
+// The 4x4 and 8x8 images select the 2x2 and 4x4 output tiles respectively.
+TEST(ConvTest, Conv2D_Winograd_PrepackedWeight) {
+  constexpr int64_t C = 16;
+  constexpr int64_t M = 24;
+
+  for (int64_t size : {4, 8}) {
+    OpTester test("Conv", 11);
+    test.AddAttribute("group", static_cast<int64_t>(1));
+    test.AddAttribute("kernel_shape", vector<int64_t>{3, 3});
+    test.AddAttribute("pads", vector<int64_t>{1, 1, 1, 1});
+
+    vector<float> X(static_cast<size_t>(C * size * size), 1.0f);
+    vector<float> W(static_cast<size_t>(M * C * 3 * 3), 0.5f);
+    vector<float> Y;
+    for (int64_t m = 0; m < M; m++) {
+      for (int64_t y = 0; y < size; y++) {
+        for (int64_t x = 0; x < size; x++) {
+          const int64_t rows = (y == 0 || y == size - 1) ? 2 : 3;
+          const int64_t cols = (x == 0 || x == size - 1) ? 2 : 3;
+          Y.push_back(0.5f * static_cast<float>(C * rows * cols));
+        }
+      }
+    }
+
+    test.AddInput<float>("X", {1, C, size, size}, X);
+    test.AddInput<float>("W", {M, C, 3, 3}, W, true);
+    test.AddOutput<float>("Y", {1, M, size, size}, Y);
+    test.SetOutputRelErr("Y", 1e-5f);
+    test.Run(OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider});
+  }
+}
+
 }  // namespace test
 }  // namespace onnxruntime
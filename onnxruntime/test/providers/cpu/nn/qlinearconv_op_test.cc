@@ -492,7 +492,7 @@ class QLinearConvOpTester {
     abs_error = 1.0f;
 #endif
 
-    test.AddOutput<uint8_t>("y", Y_shape, Y_data, false /* sort_output */, 0.0f /* rel_error */, abs_error);
+    test.AddOutput<T1>("y", Y_shape, Y_data, false /* sort_output */, 0.0f /* rel_error */, abs_error);
 
     if (!pads_.empty()) {
       test.AddAttribute("pads", pads_);
@@ -515,7 +515,11 @@ class QLinearConvOpTester {
   }
 
   void GenerateRandomInput(const std::vector<int64_t>& shape, float scale, T1 zero_point) {
-    GenerateRandom(X_, shape, scale, zero_point, 0, 63);
+    if (std::is_signed<T1>::value) {
+      GenerateRandom(X_, shape, scale, zero_point, -32, 31);
+    } else {
+      GenerateRandom(X_, shape, scale, zero_point, 0, 63);
+    }
   }
 
   void GenerateRandomWeights(const std::vector<int64_t>& shape, float scale, T2 zero_point) {
@@ -733,6 +737,36 @@ TEST(QLinearConvTest, Conv2D_U8S8_Groups_PerChannel) {
   test.Run();
 }
 
+TEST(QLinearConvTest, Conv2D_S8S8) {
+  QLinearConvOpTester<int8_t, int8_t> test;
+  test.GenerateRandomInput({3, 24, 15, 11}, .05f, -4);
+  test.GenerateRandomWeights({32, 24, 3, 3}, .125f, 0);
+  test.GenerateRandomBias();
+  test.SetPads({1, 1, 1, 1});
+  test.SetOutputScaleAndZeroPoint(.55f, -54);
+  test.Run();
+}
+
+TEST(QLinearConvTest, Conv2D_S8U8_Pointwise) {
+  QLinearConvOpTester<int8_t, uint8_t> test;
+  test.GenerateRandomInput({3, 24, 15, 11}, .05f, 7);
+  test.GenerateRandomWeights({32, 24, 1, 1}, .125f, 126);
+  test.GenerateRandomBias();
+  test.SetOutputScaleAndZeroPoint(.55f, 14);
+  test.Run();
+}
+
+TEST(QLinearConvTest, Conv1D_S8S8_Groups) {
+  QLinearConvOpTester<int8_t, int8_t> test;
+  test.GenerateRandomInput({1, 8, 13}, .03f, -7);
+  test.GenerateRandomWeights({12, 4, 3}, .10f, 0);
+  test.GenerateRandomBias();
+  test.SetPads({1, 1});
+  test.SetGroups(2);
+  test.SetOutputScaleAndZeroPoint(.76f, -88);
+  test.Run();
+}
+
 TEST(QLinearConvTest, Conv1D_U8S8_Depthwise) {
   for (int64_t channels : std::initializer_list<int64_t>{7, 8, 9, 16, 25, 64}) {
     QLinearConvOpTester<uint8_t, int8_t> test;
@@ -772,6 +806,19 @@ TEST(QLinearConvTest, Conv2D_U8U8_Depthwise) {
   }
 }
 
+TEST(QLinearConvTest, Conv2D_S8S8_Depthwise) {
+  for (int64_t channels : std::initializer_list<int64_t>{7, 8, 9, 16, 25, 64}) {
+    QLinearConvOpTester<int8_t, int8_t> test;
+    test.GenerateRandomInput({1, channels, 25, 25}, .03f, -12);
+    test.GenerateRandomWeights({channels, 1, 5, 5}, .10f, 0);
+    test.GenerateRandomBias();
+    test.SetPads({2, 2, 2, 2});
+    test.SetGroups(channels);
+    test.SetOutputScaleAndZeroPoint(.76f, -8);
+    test.Run();
+  }
+}
+
 TEST(QLinearConvTest, Conv2D_U8S8_DepthwisePointwise) {
   // Tests the combination of using the depthwise convolution path along with the
   // pointed convolution optimization that avoids im2col.
@@ -166,6 +166,27 @@ TEST(ContribOpTest, StringNormalizerTest) {
     test.Run(OpTester::ExpectResult::kExpectSuccess);
   }
 
+  // - case-INSENSETIVE approach
+  // - non-ASCII stopwords are matched in any case
+  // - LOWER with ASCII and non-ASCII inputs
+  {
+    OpTester test("StringNormalizer", opset_ver, domain);
+    InitTestAttr(test, "LOWER", false, {u8"ПОНЕДЕЛЬНИК", u8"école"}, test_locale);
+    std::vector<int64_t> dims{5};
+    std::vector<std::string> input = {std::string(u8"Понедельник"),
+                                      std::string(u8"TUESDAY"),
+                                      std::string(u8"ÉCOLE"),
+                                      std::string(u8"Besançon"),
+                                      std::string(u8"ВТОРНИК")};
+    test.AddInput<std::string>("T", dims, input);
+
+    std::vector<std::string> output = {std::string(u8"tuesday"),
+                                       std::string(u8"besançon"),
+                                       std::string(u8"вторник")};
+    test.AddOutput<std::string>("Y", {3}, output);
+    test.Run(OpTester::ExpectResult::kExpectSuccess);
+  }
+
   // Empty output case
   // - casesensitive approach
   // - filter out monday
@@ -3,6 +3,7 @@
 
 #include <random>
 #include <cmath>
+#include <numeric>
 #include <type_traits>
 #include "gtest/gtest.h"
 #include "test/common/tensor_op_test_utils.h"
@@ -2430,5 +2431,70 @@ TEST(ReductionOpTest, ReduceInfLogSumExp_double) {
   test.Run();
 }
 
+// Reductions of the trailing, leading, middle and all axes, with inputs large enough to be split among threads.
+TEST(ReductionOpTest, ReduceLargeInputs) {
+  const std::vector<int64_t> input_dims{4, 65, 1, 301};
+  const int64_t size = 4 * 65 * 301;
+  std::vector<float> data(size);
+  for (int64_t i = 0; i < size; ++i) {
+    data[i] = static_cast<float>((i * 7) % 23) * 0.125f - 1.0f;
+  }
+
+  const std::vector<std::vector<int64_t>> all_axes{{3}, {0}, {1, 2}, {0, 1, 2, 3}};
+  const std::vector<std::string> ops{"ReduceSum", "ReduceMean", "ReduceMax", "ReduceMin", "ReduceLogSumExp"};
+  for (const auto& axes : all_axes) {
+    std::vector<int64_t> output_dims(input_dims);
+    for (auto axis : axes) {
+      output_dims[axis] = 1;
+    }
+    const int64_t output_size = std::accumulate(output_dims.begin(), output_dims.end(), int64_t{1},
+                                                std::multiplies<int64_t>());
+
+    for (const auto& op : ops) {
+      std::vector<double> maximum(output_size, -std::numeric_limits<double>::infinity());
+      std::vector<double> minimum(output_size, std::numeric_limits<double>::infinity());
+      std::vector<double> sum(output_size, 0.0);
+      std::vector<int64_t> output_index(size);
+      for (int64_t i = 0; i < size; ++i) {
+        int64_t index = 0;
+        int64_t stride = size;
+        for (size_t d = 0; d < input_dims.size(); ++d) {
+          stride /= input_dims[d];
+          index = index * output_dims[d] + (output_dims[d] == 1 ? 0 : (i / stride) % input_dims[d]);
+        }
+        output_index[i] = index;
+        maximum[index] = std::max(maximum[index], static_cast<double>(data[i]));
+        minimum[index] = std::min(minimum[index], static_cast<double>(data[i]));
+      }
+      for (int64_t i = 0; i < size; ++i) {
+        const int64_t index = output_index[i];
+        sum[index] += op == "ReduceLogSumExp" ? std::exp(data[i] - maximum[index]) : data[i];
+      }
+
+      std::vector<float> expected(output_size);
+      for (int64_t i = 0; i < output_size; ++i) {
+        if (op == "ReduceSum") {
+          expected[i] = static_cast<float>(sum[i]);
+        } else if (op == "ReduceMean") {
+          expected[i] = static_cast<float>(sum[i] * output_size / size);
+        } else if (op == "ReduceMax") {
+          expected[i] = static_cast<float>(maximum[i]);
+        } else if (op == "ReduceMin") {
+          expected[i] = static_cast<float>(minimum[i]);
+        } else {
+          expected[i] = static_cast<float>(std::log(sum[i]) + maximum[i]);
+        }
+      }
+
+      OpTester test(op.c_str());
+      test.AddAttribute("axes", axes);
+      test.AddAttribute("keepdims", (int64_t)1);
+      test.AddInput<float>("data", input_dims, data);
+      test.AddOutput<float>("reduced", output_dims, expected);
+      test.Run(OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider});
+    }
+  }
+}
+
 }  // namespace test
 }  // namespace onnxruntime
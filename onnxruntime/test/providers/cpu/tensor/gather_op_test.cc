@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 
 #include "gtest/gtest.h"
+#include "core/session/onnxruntime_session_options_config_keys.h"
 #include "test/providers/provider_test_utils.h"
 #include "test/util/include/default_providers.h"
 
@@ -29,6 +30,93 @@ TEST(GatherOpTest, Gather_axis0) {
   test.Run();
 }
 
+// The data is stored as float16, so 2049 is rounded to 2048.
+TEST(GatherOpTest, Gather_axis1_fp16_initializer) {
+  SessionOptions so;
+  ASSERT_TRUE(so.AddConfigEntry(kOrtSessionOptionsConfigUseFp16Initializers, "1").IsOK());
+
+  std::vector<std::unique_ptr<IExecutionProvider>> execution_providers;
+  execution_providers.push_back(DefaultCpuExecutionProvider());
+
+  OpTester test("Gather");
+  test.AddAttribute<int64_t>("axis", 1LL);
+  test.AddInput<float>("data", {2, 3, 2},
+                       {0.0f, 0.5f,
+                        1.0f, 2049.0f,
+                        -2.0f, 0.25f,
+                        10.0f, 10.5f,
+                        -11.0f, 11.5f,
+                        12.0f, 4096.0f},
+                       true);
+  test.AddInput<int32_t>("indices", {3}, {1, -1, 1});
+  test.AddOutput<float>("output", {2, 3, 2},
+                        {1.0f, 2048.0f,
+                         -2.0f, 0.25f,
+                         1.0f, 2048.0f,
+                         -11.0f, 11.5f,
+                         12.0f, 4096.0f,
+                         -11.0f, 11.5f});
+  test.Run(so, OpTester::ExpectResult::kExpectSuccess, "", {}, nullptr, &execution_providers);
+}
+
+// Each row of two elements is stored as int8 scaled by its largest magnitude, so 0.4 is rounded to 0.
+TEST(GatherOpTest, Gather_axis1_int8_initializer) {
+  SessionOptions so;
+  ASSERT_TRUE(so.AddConfigEntry(kOrtSessionOptionsConfigQuantizeGatherTables, "1").IsOK());
+
+  std::vector<std::unique_ptr<IExecutionProvider>> execution_providers;
+  execution_providers.push_back(DefaultCpuExecutionProvider());
+
+  OpTester test("Gather");
+  test.AddAttribute<int64_t>("axis", 1LL);
+  test.AddInput<float>("data", {2, 3, 2},
+                       {127.0f, 0.4f,
+                        254.0f, -2.0f,
+                        0.0f, 0.0f,
+                        63.5f, 0.5f,
+                        -127.0f, 5.0f,
+                        1.0f, -1.0f},
+                       true);
+  test.AddInput<int32_t>("indices", {3}, {0, -2, 2});
+  test.AddOutput<float>("output", {2, 3, 2},
+                        {127.0f, 0.0f,
+                         254.0f, -2.0f,
+                         0.0f, 0.0f,
+                         63.5f, 0.5f,
+                         -127.0f, 5.0f,
+                         1.0f, -1.0f});
+  test.Run(so, OpTester::ExpectResult::kExpectSuccess, "", {}, nullptr, &execution_providers);
+}
+
+// Rows of 64 bytes or more are prefetched ahead of the copy.
+TEST(GatherOpTest, Gather_axis0_long_rows) {
+  constexpr int64_t rows = 50;
+  constexpr int64_t row_size = 24;
+  constexpr int64_t index_count = 37;
+
+  std::vector<float> data(rows * row_size);
+  for (int64_t r = 0; r < rows; r++) {
+    for (int64_t c = 0; c < row_size; c++) {
+      data[r * row_size + c] = static_cast<float>(r * 100 + c);
+    }
+  }
+
+  std::vector<int64_t> indices(index_count);
+  std::vector<float> output;
+  for (int64_t i = 0; i < index_count; i++) {
+    indices[i] = (i % 3 == 0) ? -(i % rows) - 1 : (i * 7) % rows;
+    const int64_t row = indices[i] < 0 ? indices[i] + rows : indices[i];
+    output.insert(output.end(), data.begin() + row * row_size, data.begin() + (row + 1) * row_size);
+  }
+
+  OpTester test("Gather");
+  test.AddAttribute<int64_t>("axis", 0LL);
+  test.AddInput<float>("data", {rows, row_size}, data);
+  test.AddInput<int64_t>("indices", {index_count}, indices);
+  test.AddOutput<float>("output", {index_count, row_size}, output);
+  test.Run();
+}
+
 TEST(GatherOpTest, Gather_negative_axis) {
   OpTester test("Gather");
   test.AddAttribute<int64_t>("axis", -3LL);
@@ -565,6 +565,57 @@ TEST(TransposeOpTest, DoTransposeEltWise) {
   }
 }
 
+// Compare with a naive transpose. The shapes cover the merging of adjacent axes, size 1 axes, elements of several
+// sizes and 2D transposes larger than one unit of work.
+template <typename T>
+static void TestBlockedTranspose(const std::vector<int64_t>& input_shape, const std::vector<int64_t>& perm) {
+  const size_t rank = input_shape.size();
+  const TensorShape shape(input_shape);
+
+  std::vector<T> input_vals(static_cast<size_t>(shape.Size()));
+  for (size_t i = 0; i < input_vals.size(); ++i) {
+    input_vals[i] = static_cast<T>(i % 251);
+  }
+
+  std::vector<int64_t> output_shape(rank);
+  for (size_t i = 0; i < rank; ++i) {
+    output_shape[i] = input_shape[perm[i]];
+  }
+
+  std::vector<T> expected_vals(input_vals.size());
+  std::vector<int64_t> index(rank, 0);
+  for (size_t o = 0; o < expected_vals.size(); ++o) {
+    int64_t offset = 0;
+    for (size_t i = 0; i < rank; ++i) {
+      offset += index[i] * shape.SizeFromDimension(perm[i] + 1);
+    }
+    expected_vals[o] = input_vals[static_cast<size_t>(offset)];
+
+    for (size_t i = rank; i-- > 0;) {
+      if (++index[i] < output_shape[i]) {
+        break;
+      }
+      index[i] = 0;
+    }
+  }
+
+  OpTester test("Transpose");
+  test.AddAttribute("perm", perm);
+  test.AddInput<T>("X", input_shape, input_vals);
+  test.AddOutput<T>("Y", output_shape, expected_vals);
+  test.Run(OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider});
+}
+
+TEST(TransposeOpTest, BlockedTranspose) {
+  TestBlockedTranspose<float>({2, 67, 3, 5}, {0, 2, 1, 3});
+  TestBlockedTranspose<float>({2, 3, 67, 5}, {0, 2, 3, 1});
+  TestBlockedTranspose<float>({3, 1, 4, 130, 5}, {4, 2, 1, 0, 3});
+  TestBlockedTranspose<uint8_t>({5, 70, 19}, {2, 1, 0});
+  TestBlockedTranspose<int16_t>({3, 21, 70}, {0, 2, 1});
+  TestBlockedTranspose<double>({4, 3, 9, 7}, {3, 0, 2, 1});
+  TestBlockedTranspose<int8_t>({6, 3, 5, 3}, {2, 1, 0, 3});
+}
+
 #if USE_CUDA
 constexpr const char* kGpuExecutionProvider = kCudaExecutionProvider;
 #elif USE_ROCM
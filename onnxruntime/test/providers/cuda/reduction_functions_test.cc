@@ -104,7 +104,7 @@ void TestReduceRowsToRow(int m, int n, bool reset_initial_output, float relative
 
   const TensorShape shape{m, n};
   RandomValueGenerator random{};
-  const auto values = random.Uniform<float>(shape.GetDims(), 1.0f, 10.0f);
+  const auto values = random.Uniform<float>(shape.GetDimsAsVector(), 1.0f, 10.0f);
   const auto initial_value = reset_initial_output ? 0.0f : 5.0f;
   const std::vector<float> expected_row =
       [m, n, &values, initial_value]() {
@@ -154,7 +154,7 @@ void TestReduceColumnsToColumn(int m, int n, float relative_error_tolerance = 1e
 
   const TensorShape shape{m, n};
   RandomValueGenerator random{};
-  const auto values = random.Uniform<float>(shape.GetDims(), 1.0f, 10.0f);
+  const auto values = random.Uniform<float>(shape.GetDimsAsVector(), 1.0f, 10.0f);
   const auto expected_column = ExpectedReduceMatrixColumnsOutput(m, n, values);
 
   auto d_in = AllocateDeviceMemory<float>(m * n);
@@ -268,8 +268,8 @@ TEST(ReductionFunctionsTest, GetApplicableMatrixReduction) {
          const optional<int>& expected_n = nullopt) {
         SCOPED_TRACE(MakeString(
             "cudnn_op: ", cudnn_op,
-            ", dims: ", TensorShape::ReinterpretBaseType(dims),
-            ", axes: ", TensorShape::ReinterpretBaseType(axes)));
+            ", dims: ", TensorShape(dims),
+            ", axes: ", TensorShape(axes)));
         int m{}, n{};
         EXPECT_EQ(
             static_cast<int>(get_applicable_matrix_reduction(cudnn_op, dims, axes, m, n)),
@@ -52,7 +52,7 @@ static void ExecuteMnist(InferenceSessionWrapper& session, bool custom_ep_enable
   TensorShape input_shape{1, 1, 28, 28};
   std::vector<float> input(input_shape.Size(), 1.f);
 
-  CreateMLValue<float>(input_shape.GetDims(), input.data(), OrtMemoryInfo(), &ml_value_x);
+  CreateMLValue<float>(input_shape.GetDimsAsVector(), input.data(), OrtMemoryInfo(), &ml_value_x);
 
   NameMLValMap feeds;
   feeds.insert(std::make_pair("Input3", ml_value_x));
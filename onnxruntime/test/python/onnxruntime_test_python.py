@@ -3,10 +3,12 @@
 
 # -*- coding: UTF-8 -*-
 import unittest
+import gc
 import os
 import numpy as np
 import onnxruntime as onnxrt
 import threading
+import queue
 import sys
 from helper import get_name
 from onnxruntime.capi.onnxruntime_pybind11_state import Fail
@@ -253,6 +255,117 @@ class TestInferenceSession(unittest.TestCase):
         output_expected = np.array([[1.0, 4.0], [9.0, 16.0], [25.0, 36.0]], dtype=np.float32)
         np.testing.assert_allclose(output_expected, res[0], rtol=1e-05, atol=1e-08)
 
+    def testRunModelWithPriorityAndDeadline(self):
+        sess = onnxrt.InferenceSession(get_name("mul_1.onnx"))
+        x = np.array([[1.0, 2.0], [3.0, 4.0], [5.0, 6.0]], dtype=np.float32)
+        ro = onnxrt.RunOptions()
+        self.assertEqual(ro.priority, onnxrt.RunPriority.NORMAL)
+        self.assertEqual(ro.deadline_ms, 0)
+        ro.priority = onnxrt.RunPriority.HIGH
+        ro.deadline_ms = 60000
+        res = sess.run(["Y"], {"X": x}, ro)
+        output_expected = np.array([[1.0, 4.0], [9.0, 16.0], [25.0, 36.0]], dtype=np.float32)
+        np.testing.assert_allclose(output_expected, res[0], rtol=1e-05, atol=1e-08)
+        with self.assertRaises(RuntimeError):
+            ro.deadline_ms = -1
+
+    def testRunModelWithStatistics(self):
+        sess = onnxrt.InferenceSession(get_name("mul_1.onnx"))
+        x = np.array([[1.0, 2.0], [3.0, 4.0], [5.0, 6.0]], dtype=np.float32)
+        res, statistics = sess.run_with_statistics(["Y"], {"X": x})
+        output_expected = np.array([[1.0, 4.0], [9.0, 16.0], [25.0, 36.0]], dtype=np.float32)
+        np.testing.assert_allclose(output_expected, res[0], rtol=1e-05, atol=1e-08)
+        self.assertIsInstance(statistics, onnxrt.RunStatistics)
+        self.assertGreater(statistics.wall_time_ns, 0)
+        self.assertEqual(statistics.kernels_executed, 1)
+        self.assertEqual(statistics.bytes_copied, 0)
+        cpu_arenas = [arena for arena in statistics.arenas if arena.name == 'Cpu']
+        self.assertEqual(len(cpu_arenas), 1)
+        self.assertGreaterEqual(cpu_arenas[0].peak_bytes, x.nbytes)
+
+    def testRunModelOutputWithoutCopy(self):
+        sess = onnxrt.InferenceSession(get_name("mul_1.onnx"))
+        x = np.array([[1.0, 2.0], [3.0, 4.0], [5.0, 6.0]], dtype=np.float32)
+        res = sess.run(["Y"], {"X": x})
+        # The output wraps the ORT buffer, which the array keeps alive after the session is gone.
+        self.assertFalse(res[0].flags['OWNDATA'])
+        self.assertIsNotNone(res[0].base)
+        del sess
+        output_expected = np.array([[1.0, 4.0], [9.0, 16.0], [25.0, 36.0]], dtype=np.float32)
+        np.testing.assert_allclose(output_expected, res[0], rtol=1e-05, atol=1e-08)
+        res[0][0, 0] = 2.0
+        self.assertEqual(res[0][0, 0], 2.0)
+
+    def testRunModelAsync(self):
+        so = onnxrt.SessionOptions()
+        so.intra_op_num_threads = 2
+        sess = onnxrt.InferenceSession(get_name("mul_1.onnx"), sess_options=so)
+        x = np.array([[1.0, 2.0], [3.0, 4.0], [5.0, 6.0]], dtype=np.float32)
+        results = queue.Queue()
+
+        def callback(outputs, user_data, err):
+            user_data.put((outputs, err))
+
+        for _ in range(8):
+            sess.run_async(["Y"], {"X": x}, callback, results)
+
+        output_expected = np.array([[1.0, 4.0], [9.0, 16.0], [25.0, 36.0]], dtype=np.float32)
+        for _ in range(8):
+            res, err = results.get(timeout=60)
+            self.assertEqual(err, "")
+            np.testing.assert_allclose(output_expected, res[0], rtol=1e-05, atol=1e-08)
+
+    def testRunModelAsyncTerminate(self):
+        sess = onnxrt.InferenceSession(get_name("mul_1.onnx"))
+        x = np.array([[1.0, 2.0], [3.0, 4.0], [5.0, 6.0]], dtype=np.float32)
+        results = queue.Queue()
+        release = threading.Event()
+
+        def blocking_callback(outputs, user_data, err):
+            # Holds the only request thread, so the next request stays queued.
+            user_data.put(("blocking", err))
+            release.wait(60)
+
+        def callback(outputs, user_data, err):
+            user_data.put(("terminated", err))
+
+        sess.run_async(["Y"], {"X": x}, blocking_callback, results)
+        self.assertEqual(results.get(timeout=60), ("blocking", ""))
+
+        ro = onnxrt.RunOptions()
+        sess.run_async(["Y"], {"X": x}, callback, results, ro)
+        # The run options are not copied, so this cancels the queued request.
+        ro.terminate = True
+        release.set()
+
+        name, err = results.get(timeout=60)
+        self.assertEqual(name, "terminated")
+        self.assertIn("terminate", err)
+
+    def testRunModelAsyncTemporaryInput(self):
+        so = onnxrt.SessionOptions()
+        so.intra_op_num_threads = 2
+        sess = onnxrt.InferenceSession(get_name("mul_1.onnx"), sess_options=so)
+        x = np.array([[1.0, 2.0], [3.0, 4.0], [5.0, 6.0]], dtype=np.float32)
+        results = queue.Queue()
+
+        def callback(outputs, user_data, err):
+            user_data.put((outputs, err))
+
+        garbage = []
+        for _ in range(32):
+            # Only the pending run holds a reference to the input array.
+            sess.run_async(["Y"], {"X": x + 1}, callback, results)
+            gc.collect()
+            # Reuse the memory of any input array that was freed too early.
+            garbage.append(np.full_like(x, -1.0))
+
+        output_expected = np.array([[4.0, 9.0], [16.0, 25.0], [36.0, 49.0]], dtype=np.float32)
+        for _ in range(32):
+            res, err = results.get(timeout=60)
+            self.assertEqual(err, "")
+            np.testing.assert_allclose(output_expected, res[0], rtol=1e-05, atol=1e-08)
+
     def testRunModelFromBytes(self):
         with open(get_name("mul_1.onnx"), "rb") as f:
             content = f.read()
@@ -45,6 +45,22 @@ class TestIOBinding(unittest.TestCase):
         # Validate results
         self.assertTrue(np.array_equal(self.create_expected_output(), ort_output))
 
+    def test_copy_outputs_to_cpu_not_changed_by_next_run(self):
+        session = onnxruntime.InferenceSession(get_name("mul_1.onnx"))
+        io_binding = session.io_binding()
+        io_binding.bind_cpu_input('X', self.create_numpy_input())
+        io_binding.bind_output('Y')
+        session.run_with_iobinding(io_binding)
+        first_output = io_binding.copy_outputs_to_cpu()[0]
+
+        # The next run writes to the bound output again
+        io_binding.bind_cpu_input('X', 2 * self.create_numpy_input())
+        session.run_with_iobinding(io_binding)
+        second_output = io_binding.copy_outputs_to_cpu()[0]
+
+        self.assertTrue(np.array_equal(self.create_expected_output(), first_output))
+        self.assertTrue(np.array_equal(4 * self.create_expected_output(), second_output))
+
     def test_bind_input_only(self):
         input = self.create_ortvalue_input_on_gpu()
 
@@ -0,0 +1,94 @@
+#!/usr/bin/env python
+# coding: utf-8
+# -------------------------------------------------------------------------
+# Copyright (c) Microsoft Corporation. All rights reserved.
+# Licensed under the MIT License. See License.txt in the project root for
+# license information.
+# --------------------------------------------------------------------------
+
+import unittest
+import onnx
+import numpy as np
+from onnx import helper, TensorProto
+from onnxruntime.quantization.matmul_4bits_quantizer import quantize_matmul_4bits
+from op_test_utils import check_model_correctness, check_op_type_count
+
+
+class TestOpMatMul4Bits(unittest.TestCase):
+    def construct_weight(self, shape, block_size, is_symmetric):
+        # Every block along K holds the extreme values of the 4 bit range, so the scale of each block is
+        # exactly 'step' and the weights are quantized without loss.
+        step = 0.05
+        K, N = shape
+        weight = np.random.randint(-7, 8, shape).astype(np.float32)
+        for k in range(0, K, block_size):
+            weight[k, :] = -7
+            weight[k + 1, :] = 7 if is_symmetric else 8
+        return weight * step
+
+    def construct_model_matmul(self, output_model_path, block_size, is_symmetric):
+        #      (input)
+        #         |
+        #       MatMul (weight1)
+        #         |
+        #       MatMul (weight2)
+        #         |
+        #       MatMul (weight2)
+        #         |
+        #      (output)
+        input_name = 'input'
+        output_name = 'output'
+        # K of the first MatMul is not a multiple of the block size, so its last block is padded.
+        initializers = [
+            onnx.numpy_helper.from_array(self.construct_weight([48, 32], block_size, is_symmetric), name='weight1'),
+            onnx.numpy_helper.from_array(self.construct_weight([32, 32], block_size, is_symmetric), name='weight2')
+        ]
+        matmul1_node = onnx.helper.make_node('MatMul', [input_name, 'weight1'], ['matmul1_output'], name='matmul1')
+        matmul2_node = onnx.helper.make_node('MatMul', ['matmul1_output', 'weight2'], ['matmul2_output'],
+                                             name='matmul2')
+        matmul3_node = onnx.helper.make_node('MatMul', ['matmul2_output', 'weight2'], [output_name], name='matmul3')
+
+        input_tensor = helper.make_tensor_value_info(input_name, TensorProto.FLOAT, [-1, 48])
+        output_tensor = helper.make_tensor_value_info(output_name, TensorProto.FLOAT, [-1, 32])
+        graph_name = 'matmul_4bits_test'
+        graph = helper.make_graph([matmul1_node, matmul2_node, matmul3_node], graph_name,
+                                  [input_tensor], [output_tensor], initializer=initializers)
+        model = helper.make_model(graph, opset_imports=[helper.make_opsetid("", 13)])
+        model.ir_version = onnx.IR_VERSION
+
+        onnx.save(model, output_model_path)
+
+    def quant_test(self, block_size, is_symmetric):
+        model_fp32_path = 'matmul_fp32.onnx'
+        model_q4_path = 'matmul_q4_{}_{}.onnx'.format(block_size, 'symmetric' if is_symmetric else 'asymmetric')
+        self.construct_model_matmul(model_fp32_path, block_size, is_symmetric)
+
+        quantize_matmul_4bits(model_fp32_path, model_q4_path, block_size, is_symmetric)
+        check_op_type_count(self, model_q4_path, MatMul=0, MatMulNBits=3)
+
+        # The weight shared by two MatMul nodes is quantized once.
+        model = onnx.load(model_q4_path)
+        initializer_names = sorted(initializer.name for initializer in model.graph.initializer)
+        expected_names = []
+        for weight_name in ['weight1', 'weight2']:
+            expected_names += [weight_name + '_Q4', weight_name + '_scales']
+            if not is_symmetric:
+                expected_names.append(weight_name + '_zero_points')
+        self.assertEqual(initializer_names, sorted(expected_names))
+
+        data = np.random.uniform(-1, 1, [5, 48]).astype(np.float32)
+        check_model_correctness(self, model_fp32_path, model_q4_path, {'input': data}, rtol=1e-4, atol=1e-3)
+
+    def test_quantize_matmul_asymmetric(self):
+        np.random.seed(1)
+        self.quant_test(32, False)
+        self.quant_test(16, False)
+
+    def test_quantize_matmul_symmetric(self):
+        np.random.seed(1)
+        self.quant_test(32, True)
+        self.quant_test(16, True)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -8,6 +8,7 @@
 #include <sstream>
 #include <atomic>
 #include <mutex>
+#include <condition_variable>
 #include <algorithm>
 
 #include <gtest/gtest.h>
@@ -1160,6 +1161,175 @@ TEST(CApiTest, get_profiling_start_time) {
   ASSERT_TRUE(before_start_time <= profiling_start_time && profiling_start_time <= after_start_time);
 }
 
+namespace {
+struct RunAsyncState {
+  std::mutex mutex;
+  std::condition_variable cv;
+  size_t completed = 0;
+  size_t succeeded = 0;
+};
+
+void ORT_API_CALL RunAsyncCallback(void* user_data, OrtValue** outputs, size_t num_outputs, OrtStatusPtr status) {
+  auto* state = reinterpret_cast<RunAsyncState*>(user_data);
+  bool ok = status == nullptr && num_outputs == 1 && outputs[0] != nullptr;
+  std::lock_guard<std::mutex> lock(state->mutex);
+  state->completed++;
+  state->succeeded += ok ? 1 : 0;
+  state->cv.notify_all();
+}
+}  // namespace
+
+TEST(CApiTest, run_async) {
+  Ort::SessionOptions session_options;
+  session_options.SetIntraOpNumThreads(2);
+  session_options.AddConfigEntry(kOrtSessionOptionsConfigRunAsyncNumThreads, "2");
+  Ort::Session session(*ort_env, MODEL_URI, session_options);
+
+  std::vector<int64_t> dims = {3, 2};
+  std::vector<float> values = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f};
+  Ort::MemoryInfo info("Cpu", OrtDeviceAllocator, 0, OrtMemTypeDefault);
+  Ort::Value input = Ort::Value::CreateTensor<float>(info, values.data(), values.size(), dims.data(), dims.size());
+
+  const char* input_names[] = {"X"};
+  const char* output_names[] = {"Y"};
+  constexpr size_t request_count = 16;
+  std::vector<Ort::Value> outputs;
+  for (size_t i = 0; i < request_count; i++) {
+    outputs.emplace_back(nullptr);
+  }
+
+  Ort::RunOptions run_options;
+  RunAsyncState state;
+  for (size_t i = 0; i < request_count; i++) {
+    session.RunAsync(run_options, input_names, &input, 1, output_names, &outputs[i], 1, RunAsyncCallback, &state);
+  }
+
+  {
+    std::unique_lock<std::mutex> lock(state.mutex);
+    state.cv.wait(lock, [&state]() { return state.completed == request_count; });
+  }
+  ASSERT_EQ(state.succeeded, request_count);
+
+  std::vector<float> expected_values = {1.0f, 4.0f, 9.0f, 16.0f, 25.0f, 36.0f};
+  for (auto& output : outputs) {
+    ASSERT_EQ(output.GetTensorTypeAndShapeInfo().GetShape(), dims);
+    const float* output_values = output.GetTensorMutableData<float>();
+    for (size_t i = 0; i < expected_values.size(); i++) {
+      ASSERT_EQ(output_values[i], expected_values[i]);
+    }
+  }
+}
+
+namespace {
+// Holds the request thread in the callback of the first request until released.
+struct BlockingRunAsyncState : RunAsyncState {
+  bool entered = false;
+  bool released = false;
+};
+
+void ORT_API_CALL BlockingRunAsyncCallback(void* user_data, OrtValue** outputs, size_t num_outputs,
+                                           OrtStatusPtr status) {
+  auto* state = reinterpret_cast<BlockingRunAsyncState*>(user_data);
+  {
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->entered = true;
+    state->cv.notify_all();
+    state->cv.wait(lock, [state]() { return state->released; });
+  }
+  RunAsyncCallback(static_cast<RunAsyncState*>(state), outputs, num_outputs, status);
+}
+
+void ORT_API_CALL TerminatedRunAsyncCallback(void* user_data, OrtValue** /*outputs*/, size_t /*num_outputs*/,
+                                             OrtStatusPtr status) {
+  auto* state = reinterpret_cast<RunAsyncState*>(user_data);
+  std::lock_guard<std::mutex> lock(state->mutex);
+  state->completed++;
+  state->succeeded += status == nullptr ? 1 : 0;
+  state->cv.notify_all();
+}
+}  // namespace
+
+// Requests run on threads of their own, so they need no intra-op thread pool, and the run options are not copied,
+// so terminating them cancels a queued request.
+TEST(CApiTest, run_async_terminate) {
+  Ort::SessionOptions session_options;
+  session_options.SetIntraOpNumThreads(1);
+  Ort::Session session(*ort_env, MODEL_URI, session_options);
+
+  std::vector<int64_t> dims = {3, 2};
+  std::vector<float> values = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f};
+  Ort::MemoryInfo info("Cpu", OrtDeviceAllocator, 0, OrtMemTypeDefault);
+  Ort::Value input = Ort::Value::CreateTensor<float>(info, values.data(), values.size(), dims.data(), dims.size());
+
+  const char* input_names[] = {"X"};
+  const char* output_names[] = {"Y"};
+
+  // The first request holds the only request thread in its callback, so the second one stays queued.
+  Ort::RunOptions blocking_run_options;
+  Ort::Value blocking_output{nullptr};
+  BlockingRunAsyncState blocking_state;
+  session.RunAsync(blocking_run_options, input_names, &input, 1, output_names, &blocking_output, 1,
+                   BlockingRunAsyncCallback, &blocking_state);
+  {
+    std::unique_lock<std::mutex> lock(blocking_state.mutex);
+    blocking_state.cv.wait(lock, [&blocking_state]() { return blocking_state.entered; });
+  }
+
+  Ort::RunOptions run_options;
+  Ort::Value output{nullptr};
+  RunAsyncState state;
+  session.RunAsync(run_options, input_names, &input, 1, output_names, &output, 1, TerminatedRunAsyncCallback, &state);
+  run_options.SetTerminate();
+
+  {
+    std::lock_guard<std::mutex> lock(blocking_state.mutex);
+    blocking_state.released = true;
+    blocking_state.cv.notify_all();
+  }
+
+  {
+    std::unique_lock<std::mutex> lock(state.mutex);
+    state.cv.wait(lock, [&state]() { return state.completed == 1; });
+  }
+  ASSERT_EQ(state.succeeded, 0u);
+
+  {
+    std::unique_lock<std::mutex> lock(blocking_state.mutex);
+    blocking_state.cv.wait(lock, [&blocking_state]() { return blocking_state.completed == 1; });
+  }
+  ASSERT_EQ(blocking_state.succeeded, 1u);
+}
+
+TEST(CApiTest, run_with_statistics) {
+  auto allocator = onnxruntime::make_unique<MockedOrtAllocator>();
+  Ort::Session session(*ort_env, MODEL_URI, Ort::SessionOptions{});
+
+  std::vector<int64_t> dims = {3, 2};
+  std::vector<float> values = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f};
+  Ort::MemoryInfo info("Cpu", OrtDeviceAllocator, 0, OrtMemTypeDefault);
+  Ort::Value input = Ort::Value::CreateTensor<float>(info, values.data(), values.size(), dims.data(), dims.size());
+
+  const char* input_names[] = {"X"};
+  const char* output_names[] = {"Y"};
+  Ort::Value output{nullptr};
+  char* statistics = session.RunWithStatistics(Ort::RunOptions{}, input_names, &input, 1, output_names, &output, 1,
+                                               allocator.get());
+
+  const std::string statistics_json(statistics);
+  allocator->Free(statistics);
+  ASSERT_NE(statistics_json.find("\"wall_time_ns\":"), std::string::npos);
+  ASSERT_NE(statistics_json.find("\"cpu_time_ns\":"), std::string::npos);
+  ASSERT_NE(statistics_json.find("\"kernels_executed\":1,"), std::string::npos);
+  ASSERT_NE(statistics_json.find("\"bytes_copied\":0,"), std::string::npos);
+  ASSERT_NE(statistics_json.find("{\"name\":\"Cpu\""), std::string::npos);
+
+  std::vector<float> expected_values = {1.0f, 4.0f, 9.0f, 16.0f, 25.0f, 36.0f};
+  const float* output_values = output.GetTensorMutableData<float>();
+  for (size_t i = 0; i < expected_values.size(); i++) {
+    ASSERT_EQ(output_values[i], expected_values[i]);
+  }
+}
+
 TEST(CApiTest, model_metadata) {
   auto allocator = onnxruntime::make_unique<MockedOrtAllocator>();
   // The following all tap into the c++ APIs which internally wrap over C APIs
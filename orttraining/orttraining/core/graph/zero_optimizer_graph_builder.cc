@@ -168,11 +168,11 @@ static std::vector<ArgDef> AddViewForParameter(
 
       ArgDef shape_argdef(argdef.name + "_view_shape_" + std::to_string(view_num),
                           graph_defs.CreateTypeProto({dims}, ONNX_NAMESPACE::TensorProto_DataType_INT64));
-      graph_defs.AddInitializers({CreateTensorProto<int64_t>(shape_argdef.name, shape.GetDims(), {dims})});
+      graph_defs.AddInitializers({CreateTensorProto<int64_t>(shape_argdef.name, shape.GetDimsAsVector(), {dims})});
 
       auto dtype = static_cast<ONNX_NAMESPACE::TensorProto_DataType>(argdef.type_proto->tensor_type().elem_type());
       ArgDef view_argdef(GetViewName(argdef.name, view_num),
-                         graph_defs.CreateTypeProto(shape.GetDims(), dtype));
+                         graph_defs.CreateTypeProto(shape.GetDimsAsVector(), dtype));
 
       view_inputs.push_back(shape_argdef);
       view_outputs.push_back(view_argdef);
@@ -360,7 +360,7 @@ static Status ModifyParametersForOptimizerPartitioning(
         new_weight_argdefs.push_back(weight_argdef);
         new_gradient_argdefs.push_back(gradient_argdef);
       } else {
-        weight_partition_info[weight_argdef.name].original_dim = tensor_shape.GetDims();
+        weight_partition_info[weight_argdef.name].original_dim = tensor_shape.GetDimsAsVector();
         if (offset < rank_start && offset + tensor_count <= rank_end) {
           int64_t size_for_previous_rank = rank_start - offset;
           int64_t size_for_current_rank = offset + tensor_count - rank_start;
@@ -218,7 +218,7 @@ OrtValue SliceTensor(
     onnxruntime::InferenceSession& session_state) {
   ORT_ENFORCE(value.IsTensor(), "Sliced value must be a tensor.");
   auto& src = value.Get<Tensor>();
-  auto src_shape = src.Shape().GetDims();
+  auto src_shape = src.Shape().GetDimsAsVector();
 
   auto buf_value = CreateCpuTensorValue(src.DataType(), src_shape, session_state);
   ORT_ENFORCE(buf_value.IsTensor(), "Buffer value must be a tensor.");
@@ -290,7 +290,7 @@ OrtValue ConcatenateTensors(
   // Concatenated tensors in CPU buffers.
   std::vector<OrtValue> cpu_values;
   // Result tensor's shape.
-  std::vector<int64_t> new_shape = orig_values.front().Get<Tensor>().Shape().GetDims();
+  std::vector<int64_t> new_shape = orig_values.front().Get<Tensor>().Shape().GetDimsAsVector();
   // Tensor elements' type.
   MLDataType elem_type = orig_values.front().Get<Tensor>().DataType();
   int64_t new_dim = 0;
@@ -299,7 +299,7 @@ OrtValue ConcatenateTensors(
     ORT_ENFORCE(src.IsTensor(), "Only tensors can be concatenated.");
     // Extract the shape of the original tensor.
     auto& src_tensor = src.Get<Tensor>();
-    auto src_shape = src_tensor.Shape().GetDims();
+    auto src_shape = src_tensor.Shape().GetDimsAsVector();
     ORT_ENFORCE(src_shape.size() == new_shape.size(), "Tensors to be concatenated must have the same rank.");
     ORT_ENFORCE(src_tensor.DataType() == elem_type, "Tensors to be concatenated must have the same rank.");
 
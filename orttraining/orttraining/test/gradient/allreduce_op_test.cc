@@ -602,8 +602,8 @@ TEST(AllreduceTest, GPUHierarchicalAdasumAllreduceOptimizerTest) {
   // Verify tensor data
   auto& actual_output_tensor = fetches[0].Get<Tensor>();
   TensorShape expected_shape(expected_dims_allreduce);
-  ASSERT_EQ(*reinterpret_cast<const std::vector<int64_t>*>(&expected_shape),
-            *reinterpret_cast<const std::vector<int64_t>*>(&actual_output_tensor.Shape()));
+  ASSERT_EQ(expected_shape.GetDimsAsVector(),
+            actual_output_tensor.Shape().GetDimsAsVector());
 
   const std::vector<float> found(actual_output_tensor.template Data<float>(),
                              actual_output_tensor.template Data<float>() + expected_values_allreduce.size());
@@ -784,8 +784,8 @@ TEST(AllreduceTest, GPUHierarchicalAdasumAllreduceOptimizerFP16Test) {
   // Verify tensor data
   auto& actual_output_tensor = fetches[0].Get<Tensor>();
   TensorShape expected_shape(expected_dims_allreduce);
-  ASSERT_EQ(*reinterpret_cast<const std::vector<int64_t>*>(&expected_shape),
-            *reinterpret_cast<const std::vector<int64_t>*>(&actual_output_tensor.Shape()));
+  ASSERT_EQ(expected_shape.GetDimsAsVector(),
+            actual_output_tensor.Shape().GetDimsAsVector());
 
   const std::vector<float> found(actual_output_tensor.template Data<float>(),
                              actual_output_tensor.template Data<float>() + expected_values_allreduce.size());
@@ -884,8 +884,8 @@ TEST(AllreduceTest, GPUHierarchicalAdasumAllreduceTest) {
   // Verify tensor data
   auto& actual_output_tensor = fetches[0].Get<Tensor>();
   TensorShape expected_shape(expected_dims_allreduce);
-  ASSERT_EQ(*reinterpret_cast<const std::vector<int64_t>*>(&expected_shape),
-            *reinterpret_cast<const std::vector<int64_t>*>(&actual_output_tensor.Shape()));
+  ASSERT_EQ(expected_shape.GetDimsAsVector(),
+            actual_output_tensor.Shape().GetDimsAsVector());
 
   const std::vector<float> found(actual_output_tensor.template Data<float>(),
                              actual_output_tensor.template Data<float>() + expected_values_allreduce.size());
@@ -995,8 +995,8 @@ TEST(AllreduceTest, GPUHierarchicalAdasumFP16AllreduceTest) {
   // Verify tensor data
   auto& actual_output_tensor = fetches[0].Get<Tensor>();
   TensorShape expected_shape(expected_dims_allreduce);
-  ASSERT_EQ(*reinterpret_cast<const std::vector<int64_t>*>(&expected_shape),
-            *reinterpret_cast<const std::vector<int64_t>*>(&actual_output_tensor.Shape()));
+  ASSERT_EQ(expected_shape.GetDimsAsVector(),
+            actual_output_tensor.Shape().GetDimsAsVector());
 
   const std::vector<MLFloat16> found_half(actual_output_tensor.template Data<MLFloat16>(),
                              actual_output_tensor.template Data<MLFloat16>() + expected_values_allreduce_half.size());
@@ -1101,8 +1101,8 @@ TEST(AllreduceTest, GPUAdasumAllreduceTest) {
   // Verify tensor data
   auto& actual_output_tensor = fetches[0].Get<Tensor>();
   TensorShape expected_shape(expected_dims_allreduce);
-  ASSERT_EQ(*reinterpret_cast<const std::vector<int64_t>*>(&expected_shape),
-            *reinterpret_cast<const std::vector<int64_t>*>(&actual_output_tensor.Shape()));
+  ASSERT_EQ(expected_shape.GetDimsAsVector(),
+            actual_output_tensor.Shape().GetDimsAsVector());
 
   const std::vector<float> found(actual_output_tensor.template Data<float>(),
                              actual_output_tensor.template Data<float>() + expected_values_allreduce.size());
@@ -1211,8 +1211,8 @@ TEST(AllreduceTest, GPUAdasumFP16AllreduceTest) {
   // Verify tensor data
   auto& actual_output_tensor = fetches[0].Get<Tensor>();
   TensorShape expected_shape(expected_dims_allreduce);
-  ASSERT_EQ(*reinterpret_cast<const std::vector<int64_t>*>(&expected_shape),
-            *reinterpret_cast<const std::vector<int64_t>*>(&actual_output_tensor.Shape()));
+  ASSERT_EQ(expected_shape.GetDimsAsVector(),
+            actual_output_tensor.Shape().GetDimsAsVector());
 
   const std::vector<MLFloat16> found_half(actual_output_tensor.template Data<MLFloat16>(),
                              actual_output_tensor.template Data<MLFloat16>() + expected_values_allreduce_half.size());
@@ -78,25 +78,25 @@ inline std::vector<OrtValue> GradientChecker<X_T, Y_T, JAC_T>::EvaluateFunctionA
     if (x_infos[data_index].data_type == DataTypeImpl::GetTensorType<int64_t>()) {
       std::vector<int64_t> int64_data(data.size());
       std::transform(data.begin(), data.end(), int64_data.begin(), [](X_T x) { return static_cast<int64_t>(x); });
-      op_session.AddInput<int64_t>(name.c_str(), x_infos[data_index].shape.GetDims(), int64_data);
+      op_session.AddInput<int64_t>(name.c_str(), x_infos[data_index].shape.GetDimsAsVector(), int64_data);
     } else if (x_infos[data_index].data_type == DataTypeImpl::GetTensorType<int32_t>()) {
       std::vector<int32_t> int32_data(data.size());
       std::transform(data.begin(), data.end(), int32_data.begin(), [](X_T x) { return static_cast<int32_t>(x); });
-      op_session.AddInput<int32_t>(name.c_str(), x_infos[data_index].shape.GetDims(), int32_data);
+      op_session.AddInput<int32_t>(name.c_str(), x_infos[data_index].shape.GetDimsAsVector(), int32_data);
     } else if (x_infos[data_index].data_type == DataTypeImpl::GetTensorType<bool>()) {
       std::unique_ptr<bool[]> p_data(new bool[data.size()]);
       for (size_t i = 0; i < data.size(); ++i) {
         p_data[i] = static_cast<bool>(data[i]);
       }
-      op_session.AddInput<bool>(name.c_str(), x_infos[data_index].shape.GetDims(), p_data.get(), data.size());
+      op_session.AddInput<bool>(name.c_str(), x_infos[data_index].shape.GetDimsAsVector(), p_data.get(), data.size());
     } else {
-      op_session.AddInput<X_T>(name.c_str(), x_infos[data_index].shape.GetDims(), data);
+      op_session.AddInput<X_T>(name.c_str(), x_infos[data_index].shape.GetDimsAsVector(), data);
     }
   }
 
   for (size_t data_index = 0; data_index < y_infos.size(); data_index++) {
     std::string name = "output" + std::to_string(data_index);
-    op_session.AddOutput<Y_T>(name.c_str(), y_infos[data_index].shape.GetDims(), (*y_datas)[data_index]);
+    op_session.AddOutput<Y_T>(name.c_str(), y_infos[data_index].shape.GetDimsAsVector(), (*y_datas)[data_index]);
   }
   op_session.Run();
   return op_session.GetFetches();
@@ -142,25 +142,25 @@ inline Status GradientChecker<X_T, Y_T, JAC_T>::ComputeTheoreticalJacobianTransp
         if (x_infos[data_index].data_type == DataTypeImpl::GetTensorType<int64_t>()) {
           std::vector<int64_t> int64_data(data.size());
           std::transform(data.begin(), data.end(), int64_data.begin(), [](X_T x) { return static_cast<int64_t>(x); });
-          op_session.AddInput<int64_t>(name.c_str(), x_infos[data_index].shape.GetDims(), int64_data);
+          op_session.AddInput<int64_t>(name.c_str(), x_infos[data_index].shape.GetDimsAsVector(), int64_data);
         } else if (x_infos[data_index].data_type == DataTypeImpl::GetTensorType<int32_t>()) {
           std::vector<int32_t> int32_data(data.size());
           std::transform(data.begin(), data.end(), int32_data.begin(), [](X_T x) { return static_cast<int32_t>(x); });
-          op_session.AddInput<int32_t>(name.c_str(), x_infos[data_index].shape.GetDims(), int32_data);
+          op_session.AddInput<int32_t>(name.c_str(), x_infos[data_index].shape.GetDimsAsVector(), int32_data);
         } else if (x_infos[data_index].data_type == DataTypeImpl::GetTensorType<bool>()) {
           std::unique_ptr<bool[]> p_data(new bool[data.size()]);
           for (size_t i = 0; i < data.size(); ++i) {
             p_data[i] = static_cast<bool>(data[i]);
           }
-          op_session.AddInput<bool>(name.c_str(), x_infos[data_index].shape.GetDims(), p_data.get(), data.size());
+          op_session.AddInput<bool>(name.c_str(), x_infos[data_index].shape.GetDimsAsVector(), p_data.get(), data.size());
         } else {
-          op_session.AddInput<X_T>(name.c_str(), x_infos[data_index].shape.GetDims(), data);
+          op_session.AddInput<X_T>(name.c_str(), x_infos[data_index].shape.GetDimsAsVector(), data);
         }
       }
 
       for (size_t data_index = 0; data_index < y_num; data_index++) {
         std::string name = "output" + std::to_string(data_index);
-        op_session.AddOutput<Y_T>(name.c_str(), y_infos[data_index].shape.GetDims(), (*y_datas)[data_index]);
+        op_session.AddOutput<Y_T>(name.c_str(), y_infos[data_index].shape.GetDimsAsVector(), (*y_datas)[data_index]);
       }
 
       // While calculating theoritical jacobian transpose we calculate the gradient by
@@ -215,7 +215,7 @@ inline Status GradientChecker<X_T, Y_T, JAC_T>::InitOpTesterWithGraph(
       std::vector<int64_t> int64_data(data.size());
       std::transform(data.begin(), data.end(), int64_data.begin(), [](X_T x) { return static_cast<int64_t>(x); });
       op_session.AddInput<int64_t>(name.c_str(),
-                                   x_infos[data_index].shape.GetDims(),
+                                   x_infos[data_index].shape.GetDimsAsVector(),
                                    int64_data,
                                    false,
                                    &x_infos[data_index].dim_params);
@@ -223,7 +223,7 @@ inline Status GradientChecker<X_T, Y_T, JAC_T>::InitOpTesterWithGraph(
       std::vector<int32_t> int32_data(data.size());
       std::transform(data.begin(), data.end(), int32_data.begin(), [](X_T x) { return static_cast<int32_t>(x); });
       op_session.AddInput<int32_t>(name.c_str(),
-                                   x_infos[data_index].shape.GetDims(),
+                                   x_infos[data_index].shape.GetDimsAsVector(),
                                    int32_data,
                                    false,
                                    &x_infos[data_index].dim_params);
@@ -233,14 +233,14 @@ inline Status GradientChecker<X_T, Y_T, JAC_T>::InitOpTesterWithGraph(
         p_data[i] = static_cast<bool>(data[i]);
       }
       op_session.AddInput<bool>(name.c_str(),
-                                x_infos[data_index].shape.GetDims(),
+                                x_infos[data_index].shape.GetDimsAsVector(),
                                 p_data.get(),
                                 data.size(),
                                 false,
                                 &x_infos[data_index].dim_params);
     } else {
       op_session.AddInput<X_T>(name.c_str(),
-                               x_infos[data_index].shape.GetDims(),
+                               x_infos[data_index].shape.GetDimsAsVector(),
                                data,
                                false,
                                &x_infos[data_index].dim_params);
@@ -255,10 +255,10 @@ inline Status GradientChecker<X_T, Y_T, JAC_T>::InitOpTesterWithGraph(
       std::vector<int64_t> int64_data(data.size());
       std::transform(data.begin(), data.end(), int64_data.begin(), [](Y_T x) { return static_cast<int64_t>(x); });
       op_session.AddOutput<int64_t>(name.c_str(),
-                                    y_infos[data_index].shape.GetDims(),
+                                    y_infos[data_index].shape.GetDimsAsVector(),
                                     int64_data);
     } else {
-      op_session.AddOutput<Y_T>(name.c_str(), y_infos[data_index].shape.GetDims(), data);
+      op_session.AddOutput<Y_T>(name.c_str(), y_infos[data_index].shape.GetDimsAsVector(), data);
     }
   }
   // Currently only allows setting int attributes to zero. TODO: Expand this
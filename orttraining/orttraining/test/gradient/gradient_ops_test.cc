@@ -1607,7 +1607,7 @@ void TestSparseSoftmaxCrossEntropyGrad(const TensorShape& index_shape, const std
 
   // without weight
   {
-    std::vector<int64_t> logit_shape(index_shape.GetDims());
+    std::vector<int64_t> logit_shape(index_shape.GetDimsAsVector());
     logit_shape.emplace_back(D);
 
     TensorInfo x_info(logit_shape);
@@ -1621,7 +1621,7 @@ void TestSparseSoftmaxCrossEntropyGrad(const TensorShape& index_shape, const std
 
   // with weight
   {
-    std::vector<int64_t> logit_shape(index_shape.GetDims());
+    std::vector<int64_t> logit_shape(index_shape.GetDimsAsVector());
     logit_shape.emplace_back(D);
 
     TensorInfo x_info(logit_shape);
@@ -1669,12 +1669,12 @@ void TestSoftmaxCrossEntropyLossGrad(const TensorShape& index_shape,  //label_sh
 
   // without weight and ignore_index
   {
-    std::vector<int64_t> logit_shape(index_shape.GetDims());
+    std::vector<int64_t> logit_shape(index_shape.GetDimsAsVector());
     auto it = logit_shape.begin() + 1;
     logit_shape.insert(it, D);
     TensorInfo loss_info = {};
     if (reduction == "none") {
-      loss_info = {TensorInfo(index_shape.GetDims())};
+      loss_info = {TensorInfo(index_shape.GetDimsAsVector())};
     }
 
     include_ignore_index = true;
@@ -1689,12 +1689,12 @@ void TestSoftmaxCrossEntropyLossGrad(const TensorShape& index_shape,  //label_sh
 
   // with weight and no ignore_index
   {
-    std::vector<int64_t> logit_shape(index_shape.GetDims());
+    std::vector<int64_t> logit_shape(index_shape.GetDimsAsVector());
     auto it = logit_shape.begin() + 1;
     logit_shape.insert(it, D);
     TensorInfo loss_info = {};
     if (reduction == "none") {
-      loss_info = {TensorInfo(index_shape.GetDims())};
+      loss_info = {TensorInfo(index_shape.GetDimsAsVector())};
     }
 
     include_ignore_index = false;
@@ -1710,12 +1710,12 @@ void TestSoftmaxCrossEntropyLossGrad(const TensorShape& index_shape,  //label_sh
 
   // without weight and ignore index
   {
-    std::vector<int64_t> logit_shape(index_shape.GetDims());
+    std::vector<int64_t> logit_shape(index_shape.GetDimsAsVector());
     auto it = logit_shape.begin() + 1;
     logit_shape.insert(it, D);
     TensorInfo loss_info = {};
     if (reduction == "none") {
-      loss_info = {TensorInfo(index_shape.GetDims())};
+      loss_info = {TensorInfo(index_shape.GetDimsAsVector())};
     }
 
     include_ignore_index = true;
@@ -1730,12 +1730,12 @@ void TestSoftmaxCrossEntropyLossGrad(const TensorShape& index_shape,  //label_sh
 
   // with weight and ignore_index
   {
-    std::vector<int64_t> logit_shape(index_shape.GetDims());
+    std::vector<int64_t> logit_shape(index_shape.GetDimsAsVector());
     auto it = logit_shape.begin() + 1;
     logit_shape.insert(it, D);
     TensorInfo loss_info = {};
     if (reduction == "none") {
-      loss_info = {TensorInfo(index_shape.GetDims())};
+      loss_info = {TensorInfo(index_shape.GetDimsAsVector())};
     }
 
     include_ignore_index = true;
@@ -1871,11 +1871,11 @@ void TestDropoutOp(float ratio, TensorShape& x_shape, bool default_ratio = true)
   std::vector<float> x_data(x_shape.Size(), input_constant);
   std::vector<float> y_data(x_shape.Size(), 3.0f);
 
-  test.AddInput<float>("x", x_shape.GetDims(), x_data);
+  test.AddInput<float>("x", x_shape.GetDimsAsVector(), x_data);
   if (!default_ratio)
     test.AddInput<float>("ratio", {}, {ratio});
-  test.AddOutput<float>("y", x_shape.GetDims(), y_data);
-  test.AddOutput<bool>("mask", x_shape.GetDims(), {true, true, true, true, true, true, true, true, true, true, true, true, true, true, true, true});
+  test.AddOutput<float>("y", x_shape.GetDimsAsVector(), y_data);
+  test.AddOutput<bool>("mask", x_shape.GetDimsAsVector(), {true, true, true, true, true, true, true, true, true, true, true, true, true, true, true, true});
   test.Run();
 
   //Check output
@@ -1916,9 +1916,9 @@ void TestDropoutGradOp(float ratio, TensorShape& x_shape, bool default_ratio = t
                               output_constant, 0, output_constant, 0,
                               output_constant, 0, output_constant, 0});
 
-  test.AddInput<float>("dy", x_shape.GetDims(), dy_data);
+  test.AddInput<float>("dy", x_shape.GetDimsAsVector(), dy_data);
 
-  test.AddInput<bool>("mask", x_shape.GetDims(), {true, true, true, false,   //
+  test.AddInput<bool>("mask", x_shape.GetDimsAsVector(), {true, true, true, false,   //
                                                   true, false, true, false,  //
                                                   true, false, true, false,  //
                                                   true, false, true, false});
@@ -1930,7 +1930,7 @@ void TestDropoutGradOp(float ratio, TensorShape& x_shape, bool default_ratio = t
 
   test.AddInput("training_mode", {}, {true});
 
-  test.AddOutput<float>("dx", x_shape.GetDims(), dx_data);
+  test.AddOutput<float>("dx", x_shape.GetDimsAsVector(), dx_data);
 
   test.Run();
 }
@@ -430,7 +430,7 @@ static void RunBertTrainingWithChecks(
 
   std::vector<OrtValue> feeds(feed_names.size());
   for (size_t i = 0; i < 6; ++i) {
-    TrainingUtil::CreateCpuMLValue(tensor_shapes[i].GetDims(), tensor_values[i], &feeds[i]);
+    TrainingUtil::CreateCpuMLValue(tensor_shapes[i].GetDimsAsVector(), tensor_values[i], &feeds[i]);
   }
 
   auto output_names_include_gradients = GetModelOutputNames(*training_session);
@@ -55,10 +55,10 @@ Status SliceGrad::Compute(OpKernelContext* context) const {
 template <typename T>
 Status SliceGrad::ComputeImpl(OpKernelContext* ctx,
                               Tensor& output_grad_tensor,
-                              const std::vector<int64_t>& output_dims,
-                              std::vector<int64_t>* flattened_output_dims,
-                              const std::vector<int64_t>& starts,
-                              const std::vector<int64_t>& steps) const {
+                              const TensorShapeVector& output_dims,
+                              TensorShapeVector* flattened_output_dims,
+                              const TensorShapeVector& starts,
+                              const TensorShapeVector& steps) const {
   TensorShape output_shape(output_dims);
   // output tensor's size is 0, nothing to fill - return
   if (output_shape.Size() == 0)
@@ -85,7 +85,7 @@ Status SliceGrad::ComputeImpl(OpKernelContext* ctx,
   if (flattened_output_dims) {
     // if we have flattened output dims we need to also flatten the input dims.
     // as we're combining the innermost dims and keeping all values we can just copy the size of the last dim
-    std::vector<int64_t> flattened_input_dims(output_grad_tensor.Shape().GetDims());
+    TensorShapeVector flattened_input_dims(output_grad_tensor.Shape().AsShapeVector());
     flattened_input_dims.resize(flattened_output_dims->size());
     flattened_input_dims.back() = flattened_output_dims->back();
     TensorShape input_shape(std::move(flattened_input_dims));
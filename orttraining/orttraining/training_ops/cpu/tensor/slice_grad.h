@@ -21,10 +21,10 @@ class SliceGrad final : public OpKernel, public SliceBase {
   template <typename T>
   Status ComputeImpl(OpKernelContext* ctx,
                      Tensor& output_grad_tensor,
-                     const std::vector<int64_t>& output_dims,
-                     std::vector<int64_t>* flattened_output_dims,
-                     const std::vector<int64_t>& starts,
-                     const std::vector<int64_t>& steps) const;
+                     const TensorShapeVector& output_dims,
+                     TensorShapeVector* flattened_output_dims,
+                     const TensorShapeVector& starts,
+                     const TensorShapeVector& steps) const;
 };
 
 }  // namespace contrib
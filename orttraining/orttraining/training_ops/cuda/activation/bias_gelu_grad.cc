@@ -68,7 +68,7 @@ Status BiasGeluGrad_dX<GeluComputationMode>::ComputeInternal(OpKernelContext* co
   const auto& bias_shape = B->Shape();
   ORT_ENFORCE(
       input_shape.NumDimensions() >= 1 && bias_shape.NumDimensions() == 1 &&
-          input_shape.GetDims().back() == bias_shape.GetDims().back(),
+          input_shape[input_shape.NumDimensions() - 1] == bias_shape[bias_shape.NumDimensions() - 1],
       "B must be 1-dimensional and match the last dimension of X.");
 
   auto* dX = context->Output(0, input_shape);
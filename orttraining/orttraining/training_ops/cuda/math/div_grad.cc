@@ -26,7 +26,7 @@ DIVGRAD_REGISTER_KERNEL_TYPED(double)
 std::vector<int64_t> prepended_dimension_1(const TensorShape& shape, size_t total_rank) {
   size_t input_rank = shape.NumDimensions();
   if (input_rank == total_rank)
-    return shape.GetDims();
+    return shape.GetDimsAsVector();
 
   std::vector<int64_t> dims(total_rank, 1);
 
@@ -54,13 +54,13 @@ cudnnStatus_t getWorkspaceSize(
 template <typename T>
 Status ConvGrad<T>::PrepareArgs(const Tensor& input, const Tensor& output, const Tensor& weight, const Tensor* bias) const {
   const TensorShape& i_shape = input.Shape();
-  std::vector<int64_t> i_dims = i_shape.GetDims();
+  std::vector<int64_t> i_dims = i_shape.GetDimsAsVector();
 
   const TensorShape& o_shape = output.Shape();
-  std::vector<int64_t> o_dims = o_shape.GetDims();
+  std::vector<int64_t> o_dims = o_shape.GetDimsAsVector();
 
   const TensorShape& w_shape = weight.Shape();
-  std::vector<int64_t> w_dims = w_shape.GetDims();
+  std::vector<int64_t> w_dims = w_shape.GetDimsAsVector();
 
   // Update Attributes
   ORT_RETURN_IF_ERROR(conv_attrs_.ValidateInputShape(&input, &weight));
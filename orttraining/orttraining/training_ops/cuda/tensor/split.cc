@@ -44,8 +44,8 @@ Status SplitTraining::ComputeInternal(OpKernelContext* ctx) const {
 
   auto input_data = input_tensor->DataRaw();
 
-  auto& input_dims = input_shape.GetDims();
-  std::vector<int64_t> output_dimensions{input_dims};
+  const auto& input_dims = input_shape.GetDims();
+  std::vector<int64_t> output_dimensions(input_dims.begin(), input_dims.end());
 
   CudaAsyncBuffer<void*> output_ptr(this, num_outputs);
   gsl::span<void*> output_ptr_span = output_ptr.CpuSpan();